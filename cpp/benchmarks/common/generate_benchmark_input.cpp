@@ -29,6 +29,8 @@
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <future>
 #include <memory>
 #include <random>
@@ -59,6 +61,19 @@ T get_distribution_mean(distribution_params<T> const& dist)
       else
         return dist.lower_bound - (1. / p);
     }
+    case distribution_id::ZIPF: {
+      auto const range_size = dist.lower_bound < dist.upper_bound
+                                ? dist.upper_bound - dist.lower_bound
+                                : dist.lower_bound - dist.upper_bound;
+      // Mean rank of Zipf(s) over n elements is approximately n^(2-s) / ((2-s) * zeta(s));
+      // zeta(1.05) ~= 20.6 for the exponent used by the generator
+      auto const mean_rank =
+        std::pow(range_size + 1., 2 - zipf_exponent) / ((2 - zipf_exponent) * 20.6);
+      if (dist.lower_bound < dist.upper_bound)
+        return dist.lower_bound + mean_rank;
+      else
+        return dist.lower_bound - mean_rank;
+    }
     default: CUDF_FAIL("Unsupported distribution type.");
   }
 }
@@ -297,6 +312,8 @@ std::unique_ptr<cudf::column> create_random_column(data_profile const& profile,
     }
   }
 
+  if (profile.get_sorted()) { std::sort(data.begin(), data.end()); }
+
   return std::make_unique<cudf::column>(
     cudf::data_type{cudf::type_to_id<T>()},
     num_rows,
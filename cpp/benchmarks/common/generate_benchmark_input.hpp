@@ -59,6 +59,10 @@ enum class distribution_id : int8_t {
               ///< simulating real-world numeric data.
   GEOMETRIC,  ///< Geometric sampling - highest chance to sample close to the lower bound. Good for
               ///< simulating real data with asymmetric distribution (unsigned values, timestamps).
+  ZIPF,       ///< Zipfian sampling - the value at rank k is sampled with probability proportional
+              ///< to k^-s. Good for simulating the hot-key skew of production joins and groupbys,
+              ///< which uniform sampling systematically understates. Only valid for integral types
+              ///< (including string and list lengths).
 };
 
 // Default distribution types for each type
@@ -221,6 +225,7 @@ class data_profile {
   double null_frequency          = 0.01;
   cudf::size_type cardinality    = 2000;
   cudf::size_type avg_run_length = 4;
+  bool sorted                    = false;
 
  public:
   template <
@@ -293,6 +298,7 @@ class data_profile {
   auto get_null_frequency() const { return null_frequency; };
   auto get_cardinality() const { return cardinality; };
   auto get_avg_run_length() const { return avg_run_length; };
+  auto get_sorted() const { return sorted; };
 
   // Users should pass integral values for bounds when setting the parameters for types that have
   // discrete distributions (integers, strings, lists). Otherwise the call with have no effect.
@@ -339,6 +345,10 @@ class data_profile {
   void set_cardinality(cudf::size_type c) { cardinality = c; }
   void set_avg_run_length(cudf::size_type avg_rl) { avg_run_length = avg_rl; }
 
+  // Generate fixed-width columns with their values in ascending order, to simulate clustered
+  // input. Null positions are not affected by the ordering.
+  void set_sorted(bool sort_values) { sorted = sort_values; }
+
   void set_list_depth(cudf::size_type max_depth) { list_dist_desc.max_depth = max_depth; }
   void set_list_type(cudf::type_id type) { list_dist_desc.element_type = type; }
 };
@@ -18,6 +18,8 @@
 
 #include "generate_benchmark_input.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <random>
 
@@ -77,6 +79,59 @@ auto make_geometric_dist(T range_start, T range_end)
 template <typename T>
 using distribution_fn = std::function<T(std::mt19937&)>;
 
+/**
+ * @brief Exponent of the Zipf distribution used for `distribution_id::ZIPF`.
+ *
+ * Kept slightly above one so that the rank probabilities stay summable over arbitrarily large
+ * ranges while the first few ranks still receive most of the samples.
+ */
+constexpr double zipf_exponent = 1.05;
+
+// Helper functions for the rejection-inversion Zipf sampler below.
+// H is the integral of the rank weight function x^-s; its inverse maps a uniform sample back to
+// a (fractional) rank.
+inline double zipf_h_integral(double x)
+{
+  return std::exp((1 - zipf_exponent) * std::log(x)) / (1 - zipf_exponent);
+}
+
+inline double zipf_h(double x) { return std::exp(-zipf_exponent * std::log(x)); }
+
+inline double zipf_h_integral_inverse(double x)
+{
+  return std::exp(std::log((1 - zipf_exponent) * x) / (1 - zipf_exponent));
+}
+
+/**
+ * @brief Creates a Zipf sampler over the given range.
+ *
+ * Rank one (the lower bound) is the most frequent value. Uses the rejection-inversion method of
+ * Hormann and Derflinger (1996), so sampling is O(1) regardless of the range size.
+ */
+template <typename T, typename std::enable_if_t<std::is_integral<T>::value, T>* = nullptr>
+distribution_fn<T> make_zipf_dist(T range_start, T range_end)
+{
+  using uT = typename std::make_unsigned<T>::type;
+  if (range_start > range_end) std::swap(range_start, range_end);
+  double const num_elements = static_cast<double>((uT)range_end - (uT)range_start) + 1.0;
+
+  double const h_rank1 = zipf_h_integral(1.5) - 1.0;
+  double const h_rank_n = zipf_h_integral(num_elements + 0.5);
+  double const shift    = 2.0 - zipf_h_integral_inverse(zipf_h_integral(2.5) - zipf_h(2.0));
+
+  return [=](std::mt19937& engine) mutable -> T {
+    std::uniform_real_distribution<double> u_dist{h_rank1, h_rank_n};
+    while (true) {
+      double const u    = u_dist(engine);
+      double const x    = zipf_h_integral_inverse(u);
+      double const rank = std::max(1.0, std::min(num_elements, std::round(x)));
+      if (rank - x <= shift || u >= zipf_h_integral(rank + 0.5) - zipf_h(rank)) {
+        return static_cast<T>(range_start + static_cast<uT>(rank - 1));
+      }
+    }
+  };
+}
+
 template <typename T, typename std::enable_if_t<std::is_integral<T>::value, T>* = nullptr>
 distribution_fn<T> make_distribution(distribution_id did, T lower_bound, T upper_bound)
 {
@@ -95,6 +150,7 @@ distribution_fn<T> make_distribution(distribution_id did, T lower_bound, T upper
         else
           return lower_bound - dist(engine) + lower_bound;
       };
+    case distribution_id::ZIPF: return make_zipf_dist(lower_bound, upper_bound);
     default: CUDF_FAIL("Unsupported probability distribution");
   }
 }
@@ -117,6 +173,8 @@ distribution_fn<T> make_distribution(distribution_id dist_id, T lower_bound, T u
         else
           return lower_bound - dist(engine);
       };
+    case distribution_id::ZIPF:
+      CUDF_FAIL("ZIPF distribution is only supported for integral types");
     default: CUDF_FAIL("Unsupported random distribution");
   }
 }
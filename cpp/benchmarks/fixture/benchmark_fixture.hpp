@@ -17,6 +17,7 @@
 #pragma once
 
 #include <benchmark/benchmark.h>
+#include <benchmarks/synchronization/synchronization.hpp>
 #include <rmm/mr/device/cuda_memory_resource.hpp>
 #include <rmm/mr/device/owning_wrapper.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
@@ -104,6 +105,25 @@ class memory_stats_logger {
 
   size_t peak_memory_usage() const noexcept { return statistics_mr.get_bytes_counter().peak; }
 
+  size_t total_bytes_allocated() const noexcept { return statistics_mr.get_bytes_counter().total; }
+
+  size_t total_allocation_count() const noexcept
+  {
+    return statistics_mr.get_allocations_counter().total;
+  }
+
+  /**
+   * @brief Emits the recorded statistics as benchmark counters.
+   *
+   * Reports the peak memory usage along with the allocation count and the number of bytes
+   * allocated per iteration. Call after the benchmark loop, before the logger goes out of scope.
+   */
+  void set_counters(benchmark::State& state) const
+  {
+    set_memory_counters(
+      state, peak_memory_usage(), total_allocation_count(), total_bytes_allocated());
+  }
+
  private:
   rmm::mr::device_memory_resource* existing_mr;
   rmm::mr::statistics_resource_adaptor<rmm::mr::device_memory_resource> statistics_mr;
@@ -58,7 +58,7 @@ void BM_csv_read_varying_input(benchmark::State& state)
   }
 
   state.SetBytesProcessed(data_size * state.iterations());
-  state.counters["peak_memory_usage"] = mem_stats_logger.peak_memory_usage();
+  mem_stats_logger.set_counters(state);
 }
 
 void BM_csv_read_varying_options(benchmark::State& state)
@@ -130,7 +130,39 @@ void BM_csv_read_varying_options(benchmark::State& state)
 
   auto const data_processed = data_size * cols_to_read.size() / view.num_columns();
   state.SetBytesProcessed(data_processed * state.iterations());
-  state.counters["peak_memory_usage"] = mem_stats_logger.peak_memory_usage();
+  mem_stats_logger.set_counters(state);
+}
+
+void BM_csv_read_wide_schema(benchmark::State& state)
+{
+  auto const num_wide_cols = static_cast<cudf::size_type>(state.range(0));
+  auto const col_sel       = static_cast<column_selection>(state.range(1));
+
+  auto const tbl =
+    create_random_table({cudf::type_id::INT32}, num_wide_cols, table_size_bytes{data_size});
+  auto const view = tbl->view();
+
+  std::vector<char> csv_data;
+  cudf_io::csv_writer_options options =
+    cudf_io::csv_writer_options::builder(cudf_io::sink_info{&csv_data}, view)
+      .include_header(true)
+      .rows_per_chunk(1 << 14);  // TODO: remove once default is sensible
+  cudf_io::write_csv(options);
+
+  auto const cols_to_read = select_column_indexes(num_wide_cols, col_sel);
+  cudf_io::csv_reader_options const read_options =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{csv_data.data(), csv_data.size()})
+      .use_cols_indexes(cols_to_read);
+
+  auto mem_stats_logger = cudf::memory_stats_logger();
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::read_csv(read_options);
+  }
+
+  auto const data_processed = data_size * cols_to_read.size() / view.num_columns();
+  state.SetBytesProcessed(data_processed * state.iterations());
+  mem_stats_logger.set_counters(state);
 }
 
 #define CSV_RD_BM_INPUTS_DEFINE(name, type_or_group, src_type)       \
@@ -168,3 +200,12 @@ BENCHMARK_REGISTER_F(CsvRead, row_selection)
                  {1, 8}})
   ->Unit(benchmark::kMillisecond)
   ->UseManualTime();
+
+// {column count, column selectivity}; CSV has no row groups or compression to sweep
+BENCHMARK_DEFINE_F(CsvRead, wide_schema)
+(::benchmark::State& state) { BM_csv_read_wide_schema(state); }
+BENCHMARK_REGISTER_F(CsvRead, wide_schema)
+  ->ArgsProduct(
+    {{64, 1024, 4096}, {int32_t(column_selection::ALL), int32_t(column_selection::FIRST_HALF)}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
@@ -53,7 +53,7 @@ void BM_csv_write_varying_inout(benchmark::State& state)
   }
 
   state.SetBytesProcessed(data_size * state.iterations());
-  state.counters["peak_memory_usage"] = mem_stats_logger.peak_memory_usage();
+  mem_stats_logger.set_counters(state);
 }
 
 void BM_csv_write_varying_options(benchmark::State& state)
@@ -83,7 +83,7 @@ void BM_csv_write_varying_options(benchmark::State& state)
   }
 
   state.SetBytesProcessed(data_size * state.iterations());
-  state.counters["peak_memory_usage"] = mem_stats_logger.peak_memory_usage();
+  mem_stats_logger.set_counters(state);
 }
 
 #define CSV_WR_BM_INOUTS_DEFINE(name, type_or_group, sink_type)       \
@@ -21,6 +21,7 @@
 #include <benchmarks/io/cuio_benchmark_common.hpp>
 #include <benchmarks/synchronization/synchronization.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/io/orc.hpp>
 
 // to enable, run cmake with -DBUILD_BENCHMARKS=ON
@@ -65,7 +66,7 @@ void BM_orc_read_varying_input(benchmark::State& state)
   }
 
   state.SetBytesProcessed(data_size * state.iterations());
-  state.counters["peak_memory_usage"] = mem_stats_logger.peak_memory_usage();
+  mem_stats_logger.set_counters(state);
 }
 
 std::vector<std::string> get_col_names(std::vector<char> const& orc_data)
@@ -145,7 +146,54 @@ void BM_orc_read_varying_options(benchmark::State& state)
 
   auto const data_processed = data_size * cols_to_read.size() / view.num_columns();
   state.SetBytesProcessed(data_processed * state.iterations());
-  state.counters["peak_memory_usage"] = mem_stats_logger.peak_memory_usage();
+  mem_stats_logger.set_counters(state);
+}
+
+void BM_orc_read_wide_schema(benchmark::State& state)
+{
+  auto const num_wide_cols = static_cast<cudf::size_type>(state.range(0));
+  auto const num_stripes   = static_cast<cudf::size_type>(state.range(1));
+  cudf_io::compression_type const compression =
+    state.range(2) ? cudf_io::compression_type::SNAPPY : cudf_io::compression_type::NONE;
+  auto const col_sel = static_cast<column_selection>(state.range(3));
+
+  auto const tbl =
+    create_random_table({cudf::type_id::INT32}, num_wide_cols, table_size_bytes{data_size});
+  auto const view = tbl->view();
+
+  // Each chunked write emits at least one stripe; the writer options expose no
+  // stripe size knob, so the stripe count is controlled by splitting the writes
+  std::vector<char> orc_data;
+  cudf_io::chunked_orc_writer_options write_opts =
+    cudf_io::chunked_orc_writer_options::builder(cudf_io::sink_info{&orc_data})
+      .compression(compression);
+  cudf_io::orc_chunked_writer writer(write_opts);
+  auto const rows_per_stripe = view.num_rows() / num_stripes;
+  std::vector<cudf::size_type> split_indices;
+  for (cudf::size_type stripe = 0; stripe < num_stripes; ++stripe) {
+    split_indices.push_back(stripe * rows_per_stripe);
+    split_indices.push_back(stripe == num_stripes - 1 ? view.num_rows()
+                                                      : (stripe + 1) * rows_per_stripe);
+  }
+  for (auto const& chunk : cudf::slice(view, split_indices)) {
+    writer.write(chunk);
+  }
+  writer.close();
+
+  auto const cols_to_read = select_column_names(get_col_names(orc_data), col_sel);
+  cudf_io::orc_reader_options read_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{orc_data.data(), orc_data.size()})
+      .columns(cols_to_read);
+
+  auto mem_stats_logger = cudf::memory_stats_logger();
+  for (auto _ : state) {
+    cuda_event_timer const raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::read_orc(read_opts);
+  }
+
+  auto const data_processed = data_size * cols_to_read.size() / view.num_columns();
+  state.SetBytesProcessed(data_processed * state.iterations());
+  mem_stats_logger.set_counters(state);
 }
 
 #define ORC_RD_BM_INPUTS_DEFINE(name, type_or_group, src_type)                               \
@@ -197,3 +245,14 @@ BENCHMARK_REGISTER_F(OrcRead, misc_options)
                  {int32_t(cudf::type_id::EMPTY), int32_t(cudf::type_id::TIMESTAMP_NANOSECONDS)}})
   ->Unit(benchmark::kMillisecond)
   ->UseManualTime();
+
+// {column count, stripe count, compression, column selectivity}
+BENCHMARK_DEFINE_F(OrcRead, wide_schema)
+(::benchmark::State& state) { BM_orc_read_wide_schema(state); }
+BENCHMARK_REGISTER_F(OrcRead, wide_schema)
+  ->ArgsProduct({{64, 1024, 4096},
+                 {1, 32},
+                 {false, true},
+                 {int32_t(column_selection::ALL), int32_t(column_selection::FIRST_HALF)}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
@@ -60,7 +60,7 @@ void BM_orc_write_varying_inout(benchmark::State& state)
   }
 
   state.SetBytesProcessed(data_size * state.iterations());
-  state.counters["peak_memory_usage"] = mem_stats_logger.peak_memory_usage();
+  mem_stats_logger.set_counters(state);
 }
 
 void BM_orc_write_varying_options(benchmark::State& state)
@@ -88,7 +88,7 @@ void BM_orc_write_varying_options(benchmark::State& state)
   }
 
   state.SetBytesProcessed(data_size * state.iterations());
-  state.counters["peak_memory_usage"] = mem_stats_logger.peak_memory_usage();
+  mem_stats_logger.set_counters(state);
 }
 
 #define ORC_WR_BM_INOUTS_DEFINE(name, type_or_group, sink_type)                               \
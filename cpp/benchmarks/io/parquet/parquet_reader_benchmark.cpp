@@ -21,6 +21,7 @@
 #include <benchmarks/io/cuio_benchmark_common.hpp>
 #include <benchmarks/synchronization/synchronization.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/io/parquet.hpp>
 
 // to enable, run cmake with -DBUILD_BENCHMARKS=ON
@@ -65,7 +66,7 @@ void BM_parq_read_varying_input(benchmark::State& state)
   }
 
   state.SetBytesProcessed(data_size * state.iterations());
-  state.counters["peak_memory_usage"] = mem_stats_logger.peak_memory_usage();
+  mem_stats_logger.set_counters(state);
 }
 
 std::vector<std::string> get_col_names(std::vector<char> const& parquet_data)
@@ -147,7 +148,55 @@ void BM_parq_read_varying_options(benchmark::State& state)
 
   auto const data_processed = data_size * cols_to_read.size() / view.num_columns();
   state.SetBytesProcessed(data_processed * state.iterations());
-  state.counters["peak_memory_usage"] = mem_stats_logger.peak_memory_usage();
+  mem_stats_logger.set_counters(state);
+}
+
+void BM_parq_read_wide_schema(benchmark::State& state)
+{
+  auto const num_cols       = static_cast<cudf::size_type>(state.range(0));
+  auto const num_row_groups = static_cast<cudf::size_type>(state.range(1));
+  cudf_io::compression_type const compression =
+    state.range(2) ? cudf_io::compression_type::SNAPPY : cudf_io::compression_type::NONE;
+  auto const col_sel = static_cast<column_selection>(state.range(3));
+
+  auto const tbl =
+    create_random_table({cudf::type_id::INT32}, num_cols, table_size_bytes{data_size});
+  auto const view = tbl->view();
+
+  // Each chunked write emits at least one row group; the writer options expose no
+  // row group size knob, so the row group count is controlled by splitting the writes
+  std::vector<char> parquet_data;
+  cudf_io::chunked_parquet_writer_options write_opts =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{&parquet_data})
+      .compression(compression);
+  cudf_io::parquet_chunked_writer writer(write_opts);
+  auto const rows_per_group = view.num_rows() / num_row_groups;
+  std::vector<cudf::size_type> split_indices;
+  for (cudf::size_type group = 0; group < num_row_groups; ++group) {
+    split_indices.push_back(group * rows_per_group);
+    split_indices.push_back(group == num_row_groups - 1 ? view.num_rows()
+                                                        : (group + 1) * rows_per_group);
+  }
+  for (auto const& chunk : cudf::slice(view, split_indices)) {
+    writer.write(chunk);
+  }
+  writer.close();
+
+  auto const cols_to_read = select_column_names(get_col_names(parquet_data), col_sel);
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(
+      cudf_io::source_info{parquet_data.data(), parquet_data.size()})
+      .columns(cols_to_read);
+
+  auto mem_stats_logger = cudf::memory_stats_logger();
+  for (auto _ : state) {
+    cuda_event_timer const raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::read_parquet(read_opts);
+  }
+
+  auto const data_processed = data_size * cols_to_read.size() / view.num_columns();
+  state.SetBytesProcessed(data_processed * state.iterations());
+  mem_stats_logger.set_counters(state);
 }
 
 #define PARQ_RD_BM_INPUTS_DEFINE(name, type_or_group, src_type)                              \
@@ -199,3 +248,14 @@ BENCHMARK_REGISTER_F(ParquetRead, misc_options)
                  {int32_t(cudf::type_id::EMPTY), int32_t(cudf::type_id::TIMESTAMP_NANOSECONDS)}})
   ->Unit(benchmark::kMillisecond)
   ->UseManualTime();
+
+// {column count, row group count, compression, column selectivity}
+BENCHMARK_DEFINE_F(ParquetRead, wide_schema)
+(::benchmark::State& state) { BM_parq_read_wide_schema(state); }
+BENCHMARK_REGISTER_F(ParquetRead, wide_schema)
+  ->ArgsProduct({{64, 1024, 4096},
+                 {1, 32},
+                 {false, true},
+                 {int32_t(column_selection::ALL), int32_t(column_selection::FIRST_HALF)}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
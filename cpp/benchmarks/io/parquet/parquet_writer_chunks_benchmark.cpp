@@ -56,7 +56,7 @@ void PQ_write(benchmark::State& state)
   }
 
   state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
-  state.counters["peak_memory_usage"] = mem_stats_logger.peak_memory_usage();
+  mem_stats_logger.set_counters(state);
 }
 
 void PQ_write_chunked(benchmark::State& state)
@@ -83,7 +83,7 @@ void PQ_write_chunked(benchmark::State& state)
   }
 
   state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
-  state.counters["peak_memory_usage"] = mem_stats_logger.peak_memory_usage();
+  mem_stats_logger.set_counters(state);
 }
 
 #define PWBM_BENCHMARK_DEFINE(name, size, num_columns)                                    \
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/binaryop.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/join.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+
+#include <rmm/mr/device/cuda_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/mr/device/pool_memory_resource.hpp>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+// Single-operator benchmarks measure kernels in isolation; these pipelines chain
+// read->filter->join->groupby->write the way query engines drive libcudf, so that
+// allocator behavior and the serialization between operators show up in the numbers.
+// The allocator is a benchmark parameter for exactly that reason: pool vs plain
+// cuda allocation changes pipeline times in ways no single-operator benchmark shows.
+
+namespace cudf_io = cudf::io;
+
+namespace {
+
+constexpr cudf::size_type key_cardinality = 100'000;
+
+/**
+ * @brief Sets the current device resource for the lifetime of the benchmark run.
+ *
+ * The `cudf::benchmark` fixture unconditionally installs a pool; pipelines
+ * parameterize the allocator instead, so the resource is selected here.
+ */
+class rmm_mode_raii {
+ public:
+  explicit rmm_mode_raii(bool use_pool)
+  {
+    if (use_pool) {
+      pool = std::make_unique<rmm::mr::pool_memory_resource<rmm::mr::cuda_memory_resource>>(&cuda);
+      rmm::mr::set_current_device_resource(pool.get());
+    } else {
+      rmm::mr::set_current_device_resource(&cuda);
+    }
+  }
+  ~rmm_mode_raii() { rmm::mr::set_current_device_resource(nullptr); }
+
+ private:
+  rmm::mr::cuda_memory_resource cuda{};
+  std::unique_ptr<rmm::mr::pool_memory_resource<rmm::mr::cuda_memory_resource>> pool;
+};
+
+data_profile pipeline_data_profile()
+{
+  data_profile profile;
+  profile.set_distribution_params<int32_t>(
+    cudf::type_id::INT32, distribution_id::UNIFORM, 0, key_cardinality - 1);
+  profile.set_cardinality(key_cardinality);
+  profile.set_null_frequency(0.0);
+  return profile;
+}
+
+// Writes the table to an in-memory parquet buffer, standing in for the scan input
+std::vector<char> write_fact_table(cudf::table_view const& view)
+{
+  std::vector<char> parquet_data;
+  cudf_io::parquet_writer_options write_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{&parquet_data}, view);
+  cudf_io::write_parquet(write_opts);
+  return parquet_data;
+}
+
+std::unique_ptr<cudf::table> filter_fact_table(cudf::table_view const& fact,
+                                               cudf::size_type filter_column)
+{
+  // keys are uniform in [0, key_cardinality), so this keeps ~half of the rows
+  cudf::numeric_scalar<int32_t> threshold{key_cardinality / 2};
+  auto const mask = cudf::binary_operation(fact.column(filter_column),
+                                           threshold,
+                                           cudf::binary_operator::LESS,
+                                           cudf::data_type{cudf::type_id::BOOL8});
+  return cudf::apply_boolean_mask(fact, mask->view());
+}
+
+std::unique_ptr<cudf::table> group_and_sum(cudf::table_view const& input,
+                                           cudf::size_type key_column,
+                                           cudf::size_type value_column)
+{
+  cudf::groupby::groupby gb_obj(cudf::table_view({input.column(key_column)}));
+  std::vector<cudf::groupby::aggregation_request> requests;
+  requests.emplace_back(cudf::groupby::aggregation_request());
+  requests[0].values = input.column(value_column);
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+
+  auto result = gb_obj.aggregate(requests);
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(std::move(result.first->release()[0]));
+  columns.push_back(std::move(result.second[0].results[0]));
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+void write_result(cudf::table_view const& result)
+{
+  std::vector<char> out_data;
+  cudf_io::parquet_writer_options write_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{&out_data}, result);
+  cudf_io::write_parquet(write_opts);
+}
+
+}  // namespace
+
+class Pipeline : public ::benchmark::Fixture {
+};
+
+// TPC-H Q1-like shape: scan -> filter -> groupby -> write, no join
+void BM_pipeline_scan_groupby(benchmark::State& state)
+{
+  auto const num_fact_rows = static_cast<cudf::size_type>(state.range(0));
+  rmm_mode_raii const mr_raii(state.range(1) != 0);
+
+  auto const profile = pipeline_data_profile();
+  auto const fact    = create_random_table(
+    {cudf::type_id::INT32, cudf::type_id::INT32, cudf::type_id::FLOAT64},
+    3,
+    row_count{num_fact_rows},
+    profile);
+  auto const parquet_data = write_fact_table(fact->view());
+
+  cudf_io::parquet_reader_options read_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info{parquet_data.data(), parquet_data.size()});
+
+  auto mem_stats_logger = cudf::memory_stats_logger();
+  for (auto _ : state) {
+    cuda_event_timer const raii(state, true);  // flush_l2_cache = true, stream = 0
+    auto const input    = cudf_io::read_parquet(read_opts);
+    auto const filtered = filter_fact_table(input.tbl->view(), 0);
+    auto const result   = group_and_sum(filtered->view(), 1, 2);
+    write_result(result->view());
+  }
+
+  state.SetBytesProcessed(state.iterations() * num_fact_rows *
+                          (2 * sizeof(int32_t) + sizeof(double)));
+  mem_stats_logger.set_counters(state);
+}
+
+// TPC-H Q3-like shape: scan -> filter -> join -> groupby -> write
+void BM_pipeline_filter_join_groupby(benchmark::State& state)
+{
+  auto const num_fact_rows = static_cast<cudf::size_type>(state.range(0));
+  auto const num_dim_rows  = static_cast<cudf::size_type>(state.range(1));
+  rmm_mode_raii const mr_raii(state.range(2) != 0);
+
+  auto const profile = pipeline_data_profile();
+  auto const fact    = create_random_table(
+    {cudf::type_id::INT32, cudf::type_id::INT32, cudf::type_id::FLOAT64},
+    3,
+    row_count{num_fact_rows},
+    profile);
+  auto const dim =
+    create_random_table({cudf::type_id::INT32, cudf::type_id::INT32},
+                        2,
+                        row_count{num_dim_rows},
+                        profile,
+                        2);  // different seed so dim keys are not a copy of the fact keys
+  auto const parquet_data = write_fact_table(fact->view());
+
+  cudf_io::parquet_reader_options read_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info{parquet_data.data(), parquet_data.size()});
+
+  auto mem_stats_logger = cudf::memory_stats_logger();
+  for (auto _ : state) {
+    cuda_event_timer const raii(state, true);  // flush_l2_cache = true, stream = 0
+    auto const input    = cudf_io::read_parquet(read_opts);
+    auto const filtered = filter_fact_table(input.tbl->view(), 0);
+    auto const joined   = cudf::inner_join(filtered->view(), dim->view(), {0}, {0});
+    auto const result   = group_and_sum(joined->view(), 1, 2);
+    write_result(result->view());
+  }
+
+  state.SetBytesProcessed(state.iterations() * num_fact_rows *
+                          (2 * sizeof(int32_t) + sizeof(double)));
+  mem_stats_logger.set_counters(state);
+}
+
+BENCHMARK_DEFINE_F(Pipeline, ScanGroupby)(::benchmark::State& state)
+{
+  BM_pipeline_scan_groupby(state);
+}
+
+BENCHMARK_DEFINE_F(Pipeline, FilterJoinGroupby)(::benchmark::State& state)
+{
+  BM_pipeline_filter_join_groupby(state);
+}
+
+// {fact rows, use rmm pool}
+BENCHMARK_REGISTER_F(Pipeline, ScanGroupby)
+  ->Unit(benchmark::kMillisecond)
+  ->Args({1'000'000, 0})
+  ->Args({1'000'000, 1})
+  ->Args({10'000'000, 0})
+  ->Args({10'000'000, 1})
+  ->UseManualTime();
+
+// {fact rows, dimension rows, use rmm pool}
+BENCHMARK_REGISTER_F(Pipeline, FilterJoinGroupby)
+  ->Unit(benchmark::kMillisecond)
+  ->Args({1'000'000, 100'000, 0})
+  ->Args({1'000'000, 100'000, 1})
+  ->Args({10'000'000, 1'000'000, 0})
+  ->Args({10'000'000, 1'000'000, 1})
+  ->UseManualTime();
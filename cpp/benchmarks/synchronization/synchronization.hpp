@@ -100,4 +100,28 @@ class cuda_event_timer {
   benchmark::State* p_state;
 };
 
+/**
+ * @brief Emits memory usage statistics as benchmark counters.
+ *
+ * Sets `peak_memory_usage` (bytes), `allocation_count` and `bytes_allocated` (both averaged per
+ * iteration) on the benchmark state. Meant to be called after the benchmark loop with the totals
+ * observed by a tracking resource adaptor such as `cudf::memory_stats_logger`.
+ *
+ * @param[in,out] state The benchmark::State whose counters are set
+ * @param[in] peak_bytes Maximum number of bytes allocated at any point of the run
+ * @param[in] total_allocations Number of allocations made over all iterations
+ * @param[in] total_bytes_allocated Number of bytes allocated over all iterations
+ */
+inline void set_memory_counters(benchmark::State& state,
+                                size_t peak_bytes,
+                                size_t total_allocations,
+                                size_t total_bytes_allocated)
+{
+  state.counters["peak_memory_usage"] = static_cast<double>(peak_bytes);
+  state.counters["allocation_count"] =
+    benchmark::Counter(static_cast<double>(total_allocations), benchmark::Counter::kAvgIterations);
+  state.counters["bytes_allocated"] = benchmark::Counter(
+    static_cast<double>(total_bytes_allocated), benchmark::Counter::kAvgIterations);
+}
+
 #endif
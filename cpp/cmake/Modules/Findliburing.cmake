@@ -0,0 +1,88 @@
+#=============================================================================
+# Copyright (c) 2021, NVIDIA CORPORATION.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+#[=======================================================================[.rst:
+Findliburing
+------------
+
+Find liburing headers and library.
+
+Imported Targets
+^^^^^^^^^^^^^^^^
+
+``liburing::liburing``
+  The liburing library, if found.
+
+Result Variables
+^^^^^^^^^^^^^^^^
+
+This will define the following variables in your project:
+
+``liburing_FOUND``
+  true if (the requested version of) liburing is available.
+``liburing_VERSION``
+  the version of liburing.
+``liburing_LIBRARIES``
+  the libraries to link against to use liburing.
+``liburing_INCLUDE_DIRS``
+  where to find the liburing headers.
+
+#]=======================================================================]
+
+
+# use pkg-config to get the directories and then use these values
+# in the FIND_PATH() and FIND_LIBRARY() calls
+find_package(PkgConfig QUIET)
+pkg_check_modules(PKG_liburing QUIET liburing)
+
+set(liburing_VERSION ${PKG_liburing_VERSION})
+
+find_path(liburing_INCLUDE_DIR
+  NAMES
+    liburing.h
+  HINTS
+    ${PKG_liburing_INCLUDE_DIRS}
+)
+
+find_library(liburing_LIBRARY
+  NAMES
+    uring
+  HINTS
+    ${PKG_liburing_LIBRARY_DIRS}
+)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(liburing
+  FOUND_VAR
+    liburing_FOUND
+  REQUIRED_VARS
+    liburing_LIBRARY
+    liburing_INCLUDE_DIR
+  VERSION_VAR
+    liburing_VERSION
+)
+
+if (liburing_FOUND AND NOT TARGET liburing::liburing)
+  add_library(liburing::liburing UNKNOWN IMPORTED)
+  set_target_properties(liburing::liburing PROPERTIES
+    IMPORTED_LOCATION "${liburing_LIBRARY}"
+    INTERFACE_INCLUDE_DIRECTORIES "${liburing_INCLUDE_DIR}"
+  )
+  target_compile_definitions(liburing::liburing INTERFACE CUDF_IO_URING_FOUND)
+  set(liburing_LIBRARIES ${liburing_LIBRARY})
+  set(liburing_INCLUDE_DIRS ${liburing_INCLUDE_DIR})
+endif ()
+
+mark_as_advanced(liburing_LIBRARY liburing_INCLUDE_DIR)
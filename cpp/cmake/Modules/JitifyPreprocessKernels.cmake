@@ -56,9 +56,11 @@ endfunction()
 
 jit_preprocess_files(SOURCE_DIRECTORY      ${CUDF_SOURCE_DIR}/src
                      FILES                 binaryop/jit/kernel.cu
+                                           transform/jit/expression_kernel.cu
                                            transform/jit/masked_udf_kernel.cu
                                            transform/jit/kernel.cu
                                            rolling/jit/kernel.cu
+                                           strings/jit/kernel.cu
                      )
 
 add_custom_target(jitify_preprocess_run DEPENDS ${JIT_PREPROCESSED_FILES})
@@ -87,7 +87,11 @@ class aggregation {
     CUDA,            ///< CUDA UDF based reduction
     MERGE_LISTS,     ///< merge multiple lists values into one list
     MERGE_SETS,      ///< merge multiple lists values into one list then drop duplicate entries
-    MERGE_M2         ///< merge partial values of M2 aggregation
+    MERGE_M2,        ///< merge partial values of M2 aggregation
+    APPROX_NUNIQUE,  ///< approximate count of unique elements (HyperLogLog)
+    TOP_K,           ///< collect the k greatest (or least) values of each group
+    TDIGEST,         ///< build a t-digest sketch of the value distribution
+    MERGE_TDIGEST    ///< merge multiple t-digest sketches into one
   };
 
   aggregation() = delete;
@@ -260,6 +264,75 @@ std::unique_ptr<Base> make_argmin_aggregation();
 template <typename Base = aggregation>
 std::unique_ptr<Base> make_nunique_aggregation(null_policy null_handling = null_policy::EXCLUDE);
 
+/**
+ * @brief Factory to create an `approx_nunique` aggregation
+ *
+ * `approx_nunique` returns an estimate of the number of unique elements
+ * computed from per-group HyperLogLog sketches. The estimate uses
+ * `2^precision` sketch registers per group; the default precision of 11 gives
+ * a relative error of about 2.3%. Results may also be exact when an
+ * implementation computes the true distinct count more cheaply.
+ *
+ * @param null_handling Indicates if null values will be counted.
+ * @param precision Log2 of the number of sketch registers per group. Must be
+ * in `[4, 18]`. Larger values reduce the error at the cost of
+ * `2^precision` bytes of scratch memory per group.
+ */
+template <typename Base = aggregation>
+std::unique_ptr<Base> make_approx_nunique_aggregation(
+  null_policy null_handling = null_policy::EXCLUDE, size_type precision = 11);
+
+/**
+ * @brief Factory to create a `TOP_K` aggregation
+ *
+ * `TOP_K` returns a list column where each row holds the `k` greatest
+ * elements of the corresponding group, ordered greatest first. Passing
+ * `order::ASCENDING` selects the `k` least elements instead ("bottom-k"),
+ * ordered least first. Null elements are excluded; groups with fewer than
+ * `k` non-null elements return all of them.
+ *
+ * Unlike sorting each group and truncating, the selection touches every
+ * input element only once.
+ *
+ * @param k Number of elements to keep per group. Must be in `[1, 32]`.
+ * @param ord Whether to keep the greatest (`DESCENDING`, the default) or the
+ * least (`ASCENDING`) elements of each group.
+ */
+template <typename Base = aggregation>
+std::unique_ptr<Base> make_top_k_aggregation(size_type k, order ord = order::DESCENDING);
+
+/**
+ * @brief Factory to create a `TDIGEST` aggregation
+ *
+ * `TDIGEST` builds a t-digest sketch of each group's value distribution, from
+ * which approximate quantiles can be computed without sorting or retaining the
+ * raw values. Each output row is a `STRUCT` of two equal-length `LIST<double>`
+ * children holding the centroid means and weights, ordered by ascending mean.
+ * Null elements are excluded; an empty group produces empty centroid lists.
+ *
+ * Digests produced with the same `max_centroids` are mergeable with
+ * `MERGE_TDIGEST`, enabling distributed rollup of partial sketches.
+ *
+ * @param max_centroids Upper bound on the number of centroids per digest.
+ * Larger values trade memory for quantile accuracy. Must be at least 1.
+ */
+template <typename Base = aggregation>
+std::unique_ptr<Base> make_tdigest_aggregation(size_type max_centroids = 100);
+
+/**
+ * @brief Factory to create a `MERGE_TDIGEST` aggregation
+ *
+ * Merges t-digest sketches previously produced by `TDIGEST` (or by an earlier
+ * `MERGE_TDIGEST`) into a single digest per group. The input column must have
+ * the `STRUCT<LIST<double>, LIST<double>>` layout produced by `TDIGEST`; the
+ * output uses the same layout and remains mergeable.
+ *
+ * @param max_centroids Upper bound on the number of centroids in each merged
+ * digest. Must be at least 1.
+ */
+template <typename Base = aggregation>
+std::unique_ptr<Base> make_merge_tdigest_aggregation(size_type max_centroids = 100);
+
 /**
  * @brief Factory to create a `nth_element` aggregation
  *
@@ -63,20 +63,21 @@ struct expression_result {
     return static_cast<Subclass const&>(*this);
   }
 
-  // TODO: The index is ignored by the value subclass, but is included in this
-  // signature because it is required by the implementation in the template
-  // specialization for column views. It would be nice to clean this up, see
-  // the related TODO below. Note that storing the index in the class on
-  // construction (which would result in a cleaner delineation of the API for
-  // the derived types) results in a significant performance penalty because
-  // the index is pushed down the memory hierarchy by the time it needs to be
-  // used, whereas passing it as a parameter keeps it in registers for fast
-  // access at the point where indexing occurs.
+  // TODO: The indices are ignored by the value subclass, but are included in
+  // this signature because they are required by the implementations in the
+  // template specializations for column and table views. It would be nice to
+  // clean this up, see the related TODO below. Note that storing the indices
+  // in the class on construction (which would result in a cleaner delineation
+  // of the API for the derived types) results in a significant performance
+  // penalty because the index is pushed down the memory hierarchy by the time
+  // it needs to be used, whereas passing it as a parameter keeps it in
+  // registers for fast access at the point where indexing occurs.
   template <typename Element>
-  CUDA_DEVICE_CALLABLE void set_value(cudf::size_type index,
+  CUDA_DEVICE_CALLABLE void set_value(cudf::size_type column_index,
+                                      cudf::size_type row_index,
                                       possibly_null_value_t<Element, has_nulls> const& result)
   {
-    subclass().template set_value<Element>(index, result);
+    subclass().template set_value<Element>(column_index, row_index, result);
   }
 
   CUDA_DEVICE_CALLABLE bool is_valid() const { return subclass().is_valid(); }
@@ -100,7 +101,8 @@ struct value_expression_result
   CUDA_DEVICE_CALLABLE value_expression_result() {}
 
   template <typename Element>
-  CUDA_DEVICE_CALLABLE void set_value(cudf::size_type index,
+  CUDA_DEVICE_CALLABLE void set_value(cudf::size_type column_index,
+                                      cudf::size_type row_index,
                                       possibly_null_value_t<Element, has_nulls> const& result)
   {
     if constexpr (std::is_same_v<Element, T>) {
@@ -161,18 +163,19 @@ struct mutable_column_expression_result
   }
 
   template <typename Element>
-  CUDA_DEVICE_CALLABLE void set_value(cudf::size_type index,
+  CUDA_DEVICE_CALLABLE void set_value(cudf::size_type column_index,
+                                      cudf::size_type row_index,
                                       possibly_null_value_t<Element, has_nulls> const& result)
   {
     if constexpr (has_nulls) {
       if (result.has_value()) {
-        _obj.template element<Element>(index) = *result;
-        _obj.set_valid(index);
+        _obj.template element<Element>(row_index) = *result;
+        _obj.set_valid(row_index);
       } else {
-        _obj.set_null(index);
+        _obj.set_null(row_index);
       }
     } else {
-      _obj.template element<Element>(index) = result;
+      _obj.template element<Element>(row_index) = result;
     }
   }
 
@@ -201,6 +204,64 @@ struct mutable_column_expression_result
   mutable_column_device_view& _obj;  ///< The column to which the data is written.
 };
 
+/**
+ * @brief A container for capturing the outputs of evaluated expressions in a table.
+ *
+ * This subclass of `expression_result` functions as a non-owning container
+ * over a table of mutable columns. It is used when multiple expressions are
+ * evaluated together: each expression's root directs its result to the output
+ * column whose index is stored in the root's data reference.
+ *
+ * @tparam has_nulls Whether or not the result data is nullable.
+ */
+template <bool has_nulls>
+struct mutable_table_expression_result
+  : public expression_result<mutable_table_expression_result<has_nulls>,
+                             mutable_table_device_view,
+                             has_nulls> {
+  CUDA_DEVICE_CALLABLE mutable_table_expression_result(mutable_table_device_view& obj) : _obj(obj)
+  {
+  }
+
+  template <typename Element>
+  CUDA_DEVICE_CALLABLE void set_value(cudf::size_type column_index,
+                                      cudf::size_type row_index,
+                                      possibly_null_value_t<Element, has_nulls> const& result)
+  {
+    auto const& col = _obj.column(column_index);
+    if constexpr (has_nulls) {
+      if (result.has_value()) {
+        col.template element<Element>(row_index) = *result;
+        col.set_valid(row_index);
+      } else {
+        col.set_null(row_index);
+      }
+    } else {
+      col.template element<Element>(row_index) = result;
+    }
+  }
+
+  /**
+   * @brief Not implemented for this specialization.
+   */
+  CUDA_DEVICE_CALLABLE bool is_valid() const
+  {
+    cudf_assert(false && "This method is not implemented.");
+    // Unreachable return used to silence compiler warnings.
+    return {};
+  }
+
+  /**
+   * @brief Not implemented for this specialization.
+   */
+  CUDA_DEVICE_CALLABLE mutable_table_device_view value() const
+  {
+    cudf_assert(false && "This method is not implemented.");
+  }
+
+  mutable_table_device_view& _obj;  ///< The table to which the data is written.
+};
+
 /**
  * @brief Dispatch to a binary operator based on a single data type.
  *
@@ -299,13 +360,20 @@ struct expression_evaluator {
       // any case where input_reference.table_source == table_reference::RIGHT.
       // Otherwise, behavior is undefined.
       auto const row_index =
-        (input_reference.table_source == table_reference::LEFT) ? left_row_index : *right_row_index;
+        ((input_reference.table_source == table_reference::LEFT) ? left_row_index
+                                                                 : *right_row_index) -
+        input_reference.row_shift;
       if constexpr (has_nulls) {
+        // A shifted reference reads beyond the bounds of the column for rows
+        // near the edges; those reads evaluate to null.
+        if (row_index < 0 || row_index >= table.num_rows()) { return ReturnType(); }
         return table.column(input_reference.data_index).is_valid(row_index)
                  ? ReturnType(table.column(input_reference.data_index).element<Element>(row_index))
                  : ReturnType();
 
       } else {
+        // A non-zero row shift implies may_evaluate_null and therefore the
+        // nullable code path, so row_index is guaranteed to be in bounds here.
         return ReturnType(table.column(input_reference.data_index).element<Element>(row_index));
       }
     } else if (input_reference.reference_type == detail::device_data_reference_type::LITERAL) {
@@ -549,7 +617,8 @@ struct expression_evaluator {
       possibly_null_value_t<Element, has_nulls> const& result) const
     {
       if (device_data_reference.reference_type == detail::device_data_reference_type::COLUMN) {
-        output_object.template set_value<Element>(row_index, result);
+        output_object.template set_value<Element>(
+          device_data_reference.data_index, row_index, result);
       } else {  // Assumes device_data_reference.reference_type ==
                 // detail::device_data_reference_type::INTERMEDIATE
         // Using memcpy instead of reinterpret_cast<Element*> for safe type aliasing.
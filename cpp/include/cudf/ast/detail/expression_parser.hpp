@@ -23,8 +23,11 @@
 #include <thrust/optional.h>
 
 #include <functional>
+#include <map>
 #include <numeric>
 #include <optional>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 namespace ast {
@@ -52,7 +55,8 @@ struct alignas(8) device_data_reference {
   device_data_reference(device_data_reference_type reference_type,
                         cudf::data_type data_type,
                         cudf::size_type data_index,
-                        table_reference table_source);
+                        table_reference table_source,
+                        cudf::size_type row_shift = 0);
 
   device_data_reference(device_data_reference_type reference_type,
                         cudf::data_type data_type,
@@ -63,11 +67,12 @@ struct alignas(8) device_data_reference {
   cudf::size_type const data_index;                 // The column index of a table, index of a
                                                     // literal, or index of an intermediate
   table_reference const table_source;
+  cudf::size_type const row_shift;  // Offset applied to the row index when reading a column
 
   bool operator==(device_data_reference const& rhs) const
   {
-    return std::tie(data_index, reference_type, table_source) ==
-           std::tie(rhs.data_index, rhs.reference_type, rhs.table_source);
+    return std::tie(data_index, reference_type, table_source, row_shift) ==
+           std::tie(rhs.data_index, rhs.reference_type, rhs.table_source, rhs.row_shift);
   }
 };
 
@@ -103,7 +108,7 @@ using IntermediateDataType = possibly_null_value_t<std::int64_t, has_nulls>;
  */
 struct expression_device_view {
   device_span<detail::device_data_reference const> data_references;
-  device_span<cudf::detail::fixed_width_scalar_device_view_base const> literals;
+  device_span<cudf::detail::generic_scalar_device_view const> literals;
   device_span<ast_operator const> operators;
   device_span<cudf::size_type const> operator_source_indices;
   cudf::size_type num_intermediates;
@@ -161,6 +166,46 @@ class expression_parser {
   {
   }
 
+  /**
+   * @brief Construct a new expression_parser object for several expressions.
+   *
+   * The expressions are linearized into a single operator list sharing common
+   * subexpressions: operations with the same operator and operands are only
+   * evaluated once, and each expression's root writes to the output column
+   * matching its position in @p exprs. To keep shared intermediates valid,
+   * intermediate storage locations are not reused across operations in this
+   * mode, so shared memory usage grows with the total operator count.
+   *
+   * @param exprs The expressions to create an evaluable expression_parser for.
+   * @param table The table used for evaluating the abstract syntax trees.
+   */
+  expression_parser(std::vector<std::reference_wrapper<expression const>> const& exprs,
+                    cudf::table_view const& table,
+                    bool has_nulls,
+                    rmm::cuda_stream_view stream,
+                    rmm::mr::device_memory_resource* mr)
+    : _left{table},
+      _right{},
+      _expression_count{0},
+      _intermediate_counter{},
+      _has_nulls(has_nulls),
+      _share_subexpressions{true}
+  {
+    for (std::size_t i = 0; i < exprs.size(); ++i) {
+      _root_expression_index = _expression_count;
+      _current_output_index  = static_cast<cudf::size_type>(i);
+      _output_data_ref_indices.push_back(exprs[i].get().accept(*this));
+    }
+    move_to_device(stream, mr);
+  }
+
+  /**
+   * @brief Get the root data types of the parsed expressions.
+   *
+   * @return std::vector<cudf::data_type>
+   */
+  std::vector<cudf::data_type> output_types() const;
+
   /**
    * @brief Get the root data type of the abstract syntax tree.
    *
@@ -281,8 +326,8 @@ class expression_parser {
                                                              buffer_offsets[0]),
       _data_references.size());
     device_expression_data.literals =
-      device_span<cudf::detail::fixed_width_scalar_device_view_base const>(
-        reinterpret_cast<cudf::detail::fixed_width_scalar_device_view_base const*>(
+      device_span<cudf::detail::generic_scalar_device_view const>(
+        reinterpret_cast<cudf::detail::generic_scalar_device_view const*>(
           device_data_buffer_ptr + buffer_offsets[1]),
         _literals.size());
     device_expression_data.operators = device_span<ast_operator const>(
@@ -331,10 +376,17 @@ class expression_parser {
   cudf::size_type _expression_count;
   intermediate_counter _intermediate_counter;
   bool _has_nulls;
+  bool _share_subexpressions{false};
+  cudf::size_type _root_expression_index{0};
+  cudf::size_type _current_output_index{0};
+  std::vector<cudf::size_type> _output_data_ref_indices;
+  std::map<std::pair<ast_operator, std::vector<cudf::size_type>>, cudf::size_type>
+    _operation_cache;  ///< Memoized operations keyed by operator and operand data references, used
+                       ///< for common-subexpression elimination when parsing several expressions.
   std::vector<detail::device_data_reference> _data_references;
   std::vector<ast_operator> _operators;
   std::vector<cudf::size_type> _operator_source_indices;
-  std::vector<cudf::detail::fixed_width_scalar_device_view_base> _literals;
+  std::vector<cudf::detail::generic_scalar_device_view> _literals;
 };
 
 }  // namespace detail
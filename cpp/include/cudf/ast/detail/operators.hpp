@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/ast/expressions.hpp>
+#include <cudf/strings/string_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -123,6 +124,9 @@ CUDA_HOST_DEVICE_CALLABLE constexpr void ast_operator_dispatcher(ast_operator op
     case ast_operator::NULL_LOGICAL_OR:
       f.template operator()<ast_operator::NULL_LOGICAL_OR>(std::forward<Ts>(args)...);
       break;
+    case ast_operator::LIKE:
+      f.template operator()<ast_operator::LIKE>(std::forward<Ts>(args)...);
+      break;
     case ast_operator::IDENTITY:
       f.template operator()<ast_operator::IDENTITY>(std::forward<Ts>(args)...);
       break;
@@ -520,6 +524,58 @@ struct operator_functor<ast_operator::NULL_LOGICAL_OR, false>
   : public operator_functor<ast_operator::LOGICAL_OR, false> {
 };
 
+template <>
+struct operator_functor<ast_operator::LIKE, false> {
+  static constexpr auto arity{2};
+
+  // Concrete string_view parameters restrict this operator to string inputs.
+  CUDA_DEVICE_CALLABLE bool operator()(cudf::string_view const target,
+                                       cudf::string_view const pattern)
+  {
+    // Iterative glob-style matcher with a single level of backtracking: `%`
+    // matches any (possibly empty) sequence of characters and `_` matches
+    // exactly one character. On a mismatch after a `%`, the target position at
+    // which the `%` stopped consuming is advanced and matching resumes from
+    // the pattern position just past the `%`.
+    char const* target_pos      = target.data();
+    char const* const target_end = target_pos + target.size_bytes();
+    char const* pattern_pos      = pattern.data();
+    char const* const pattern_end = pattern_pos + pattern.size_bytes();
+    char const* resume_pattern = nullptr;  // Pattern position just past the last `%`
+    char const* resume_target  = nullptr;  // Target position to restart from on mismatch
+
+    // Advance a byte pointer past one UTF-8 character (a lead byte plus any
+    // continuation bytes).
+    auto const next_character = [](char const* pos, char const* const end) {
+      ++pos;
+      while (pos < end && (static_cast<unsigned char>(*pos) & 0xC0) == 0x80) { ++pos; }
+      return pos;
+    };
+
+    while (target_pos < target_end) {
+      if (pattern_pos < pattern_end && *pattern_pos == '%') {
+        resume_pattern = ++pattern_pos;
+        resume_target  = target_pos;
+      } else if (pattern_pos < pattern_end && *pattern_pos == '_') {
+        target_pos = next_character(target_pos, target_end);
+        ++pattern_pos;
+      } else if (pattern_pos < pattern_end && *pattern_pos == *target_pos) {
+        ++target_pos;
+        ++pattern_pos;
+      } else if (resume_pattern != nullptr) {
+        resume_target = next_character(resume_target, target_end);
+        target_pos    = resume_target;
+        pattern_pos   = resume_pattern;
+      } else {
+        return false;
+      }
+    }
+    // Any trailing `%` can match the empty remainder of the target.
+    while (pattern_pos < pattern_end && *pattern_pos == '%') { ++pattern_pos; }
+    return pattern_pos == pattern_end;
+  }
+};
+
 template <>
 struct operator_functor<ast_operator::IDENTITY, false> {
   static constexpr auto arity{1};
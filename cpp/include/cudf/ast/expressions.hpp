@@ -87,6 +87,9 @@ enum class ast_operator {
                      ///< NULL_LOGICAL_OR(null, true) is true,
                      ///< NULL_LOGICAL_OR(null, false) is null, and NULL_LOGICAL_OR(valid, valid) ==
                      ///< LOGICAL_OR(valid, valid)
+  LIKE,              ///< SQL LIKE match of a string against a pattern, where `%` matches any
+                     ///< sequence of characters and `_` matches any single character. Escape
+                     ///< sequences are not supported.
   // Unary operators
   IDENTITY,    ///< Identity function
   SIN,         ///< Trigonometric sine
@@ -136,8 +139,7 @@ class literal : public expression {
    * @param value A numeric scalar value.
    */
   template <typename T>
-  literal(cudf::numeric_scalar<T>& value)
-    : scalar(value), value(cudf::get_scalar_device_view(value))
+  literal(cudf::numeric_scalar<T>& value) : scalar(value), value(value)
   {
   }
 
@@ -148,8 +150,7 @@ class literal : public expression {
    * @param value A timestamp scalar value.
    */
   template <typename T>
-  literal(cudf::timestamp_scalar<T>& value)
-    : scalar(value), value(cudf::get_scalar_device_view(value))
+  literal(cudf::timestamp_scalar<T>& value) : scalar(value), value(value)
   {
   }
 
@@ -160,11 +161,17 @@ class literal : public expression {
    * @param value A duration scalar value.
    */
   template <typename T>
-  literal(cudf::duration_scalar<T>& value)
-    : scalar(value), value(cudf::get_scalar_device_view(value))
+  literal(cudf::duration_scalar<T>& value) : scalar(value), value(value)
   {
   }
 
+  /**
+   * @brief Construct a new literal object.
+   *
+   * @param value A string scalar value.
+   */
+  literal(cudf::string_scalar& value) : scalar(value), value(value) {}
+
   /**
    * @brief Get the data type.
    *
@@ -175,9 +182,16 @@ class literal : public expression {
   /**
    * @brief Get the value object.
    *
-   * @return cudf::detail::fixed_width_scalar_device_view_base
+   * @return cudf::detail::generic_scalar_device_view
    */
-  cudf::detail::fixed_width_scalar_device_view_base get_value() const { return value; }
+  cudf::detail::generic_scalar_device_view get_value() const { return value; }
+
+  /**
+   * @brief Get the underlying scalar, for host-side inspection of the literal value.
+   *
+   * @return cudf::scalar
+   */
+  cudf::scalar const& get_scalar() const { return scalar; }
 
   /**
    * @brief Accepts a visitor class.
@@ -203,7 +217,7 @@ class literal : public expression {
 
  private:
   cudf::scalar const& scalar;
-  cudf::detail::fixed_width_scalar_device_view_base const value;
+  cudf::detail::generic_scalar_device_view const value;
 };
 
 /**
@@ -214,13 +228,22 @@ class column_reference : public expression {
   /**
    * @brief Construct a new column reference object
    *
+   * A non-zero @p row_shift makes the reference read the column as if it had
+   * been shifted by `cudf::shift(column, row_shift)`: evaluating the reference
+   * at row `i` reads row `i - row_shift` of the column, and rows whose shifted
+   * index falls outside the column evaluate to null. This allows expressions
+   * such as `col - shift(col, 1)` to be computed in a single pass without
+   * materializing the shifted column.
+   *
    * @param column_index Index of this column in the table (provided when the expression is
    * evaluated).
    * @param table_source Which table to use in cases with two tables (e.g. joins).
+   * @param row_shift Offset by which reads through this reference are shifted.
    */
   column_reference(cudf::size_type column_index,
-                   table_reference table_source = table_reference::LEFT)
-    : column_index(column_index), table_source(table_source)
+                   table_reference table_source = table_reference::LEFT,
+                   cudf::size_type row_shift    = 0)
+    : column_index(column_index), table_source(table_source), row_shift(row_shift)
   {
   }
 
@@ -231,6 +254,13 @@ class column_reference : public expression {
    */
   cudf::size_type get_column_index() const { return column_index; }
 
+  /**
+   * @brief Get the row shift.
+   *
+   * @return cudf::size_type
+   */
+  cudf::size_type get_row_shift() const { return row_shift; }
+
   /**
    * @brief Get the table source.
    *
@@ -282,12 +312,15 @@ class column_reference : public expression {
                          table_view const& right,
                          rmm::cuda_stream_view stream) const override
   {
-    return (table_source == table_reference::LEFT ? left : right).column(column_index).has_nulls();
+    // Rows shifted in from beyond the bounds of the column are null.
+    return (row_shift != 0) ||
+           (table_source == table_reference::LEFT ? left : right).column(column_index).has_nulls();
   }
 
  private:
   cudf::size_type column_index;
   table_reference table_source;
+  cudf::size_type row_shift;
 };
 
 /**
@@ -19,6 +19,8 @@
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
 #include <memory>
 
 namespace cudf {
@@ -74,6 +76,22 @@ enum class binary_operator : int32_t {
                          ///< ptx code
   INVALID_BINARY         ///< invalid operation
 };
+
+/**
+ * @brief Policy for reading the validity of a scalar operand.
+ *
+ * Scalars are device-resident: reading their validity on the host forces a
+ * stream synchronization. When a scalar operand was itself produced on the
+ * device (e.g. by `cudf::reduce` or `cudf::minmax`), `READ_ON_DEVICE` keeps
+ * the whole chain asynchronous: the validity is combined into the output null
+ * mask by a device pass, the output column is nullable, and its null count is
+ * computed lazily on first use.
+ */
+enum class scalar_validity : bool {
+  READ_ON_HOST,   ///< read the scalar validity on the host (synchronizes the stream)
+  READ_ON_DEVICE  ///< read the scalar validity on the device (never synchronizes)
+};
+
 /**
  * @brief Performs a binary operation between a scalar and a column.
  *
@@ -84,10 +102,14 @@ enum class binary_operator : int32_t {
  * Regardless of the operator, the validity of the output value is the logical
  * AND of the validity of the two operands except NullMin and NullMax (logical OR).
  *
+ * If `rhs` is a dictionary column, the operation is evaluated once per distinct key and
+ * mapped through the indices; the output is a column of `output_type`, not a dictionary.
+ *
  * @param lhs         The left operand scalar
  * @param rhs         The right operand column
  * @param op          The binary operator
  * @param output_type The desired data type of the output column
+ * @param stream      CUDA stream used for device memory operations and kernel launches
  * @param mr          Device memory resource used to allocate the returned column's device memory
  * @return            Output column of `output_type` type containing the result of
  *                    the binary operation
@@ -100,6 +122,24 @@ std::unique_ptr<column> binary_operation(
   column_view const& rhs,
   binary_operator op,
   data_type output_type,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::binary_operation(scalar const&, column_view const&, binary_operator, data_type,
+ * rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
+ *
+ * @param validity_policy Whether the scalar validity is read on the host or on the device;
+ *                    `scalar_validity::READ_ON_DEVICE` avoids the implicit stream
+ *                    synchronization of the host read
+ */
+std::unique_ptr<column> binary_operation(
+  scalar const& lhs,
+  column_view const& rhs,
+  binary_operator op,
+  data_type output_type,
+  scalar_validity validity_policy,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -112,10 +152,14 @@ std::unique_ptr<column> binary_operation(
  * Regardless of the operator, the validity of the output value is the logical
  * AND of the validity of the two operands except NullMin and NullMax (logical OR).
  *
+ * If `lhs` is a dictionary column, the operation is evaluated once per distinct key and
+ * mapped through the indices; the output is a column of `output_type`, not a dictionary.
+ *
  * @param lhs         The left operand column
  * @param rhs         The right operand scalar
  * @param op          The binary operator
  * @param output_type The desired data type of the output column
+ * @param stream      CUDA stream used for device memory operations and kernel launches
  * @param mr          Device memory resource used to allocate the returned column's device memory
  * @return            Output column of `output_type` type containing the result of
  *                    the binary operation
@@ -128,6 +172,24 @@ std::unique_ptr<column> binary_operation(
   scalar const& rhs,
   binary_operator op,
   data_type output_type,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::binary_operation(column_view const&, scalar const&, binary_operator, data_type,
+ * rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
+ *
+ * @param validity_policy Whether the scalar validity is read on the host or on the device;
+ *                    `scalar_validity::READ_ON_DEVICE` avoids the implicit stream
+ *                    synchronization of the host read
+ */
+std::unique_ptr<column> binary_operation(
+  column_view const& lhs,
+  scalar const& rhs,
+  binary_operator op,
+  data_type output_type,
+  scalar_validity validity_policy,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -142,6 +204,7 @@ std::unique_ptr<column> binary_operation(
  * @param rhs         The right operand column
  * @param op          The binary operator
  * @param output_type The desired data type of the output column
+ * @param stream      CUDA stream used for device memory operations and kernel launches
  * @param mr          Device memory resource used to allocate the returned column's device memory
  * @return            Output column of `output_type` type containing the result of
  *                    the binary operation
@@ -155,6 +218,113 @@ std::unique_ptr<column> binary_operation(
   column_view const& rhs,
   binary_operator op,
   data_type output_type,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Performs a binary operation between two columns, writing the result
+ * into a preallocated output column.
+ *
+ * Equivalent to `binary_operation(lhs, rhs, op, output.type())` except that no
+ * output column is allocated: `op(lhs[i], rhs[i])` is written to `output[i]`
+ * for all `0 <= i < lhs.size()`. Use this from pipelines that process batches
+ * of a fixed shape and want to reuse the output buffer across batches instead
+ * of paying an allocator round trip per call.
+ *
+ * The output validity is the logical AND of the operand validities, written
+ * into the preallocated null mask of @p output; if neither operand has nulls,
+ * the mask of @p output (when present) is set to all-valid. Fixed-point,
+ * string and dictionary operands are not supported; use the allocating
+ * overloads for those.
+ *
+ * @param lhs    The left operand column
+ * @param rhs    The right operand column
+ * @param op     The binary operator
+ * @param output The preallocated column to write into; its type is the output
+ *               type of the operation
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @throw cudf::logic_error if @p lhs, @p rhs and @p output are different sizes
+ * @throw cudf::logic_error if an operand or @p output dtype isn't fixed-width or is
+ * fixed-point
+ * @throw cudf::logic_error if @p output dtype isn't boolean for comparison and logical
+ * operations.
+ * @throw cudf::logic_error if an operand has null values and @p output is not
+ * nullable.
+ */
+void binary_operation_in_place(column_view const& lhs,
+                               column_view const& rhs,
+                               binary_operator op,
+                               mutable_column_view& output,
+                               rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @brief Performs a binary operation between two columns, replacing null
+ * results in the same pass.
+ *
+ * The output contains `op(lhs[i], rhs[i])` where both operands are valid and
+ * @p null_replacement elsewhere, for all `0 <= i < lhs.size()`. The output
+ * column has no null mask. Equivalent to `binary_operation` followed by
+ * `replace_nulls`, except that the replacement is fused into the producing
+ * kernel, so no nullable intermediate column is materialized and no second
+ * pass over the result is made.
+ *
+ * Only the arithmetic operators `ADD`, `SUB`, `MUL`, `DIV`, `TRUE_DIV`,
+ * `FLOOR_DIV`, `MOD`, `PYMOD` and `POW` are supported; the comparison and
+ * null-aware operators define their own null semantics. Fixed-point types are
+ * not supported.
+ *
+ * @param lhs         The left operand column
+ * @param rhs         The right operand column
+ * @param op          The binary operator
+ * @param output_type The desired data type of the output column
+ * @param null_replacement Scalar written wherever either operand is null; must be
+ *                    valid and of `output_type` type
+ * @param stream      CUDA stream used for device memory operations and kernel launches
+ * @param mr          Device memory resource used to allocate the returned column's device memory
+ * @return            Non-nullable output column of `output_type` type
+ * @throw cudf::logic_error if @p lhs and @p rhs are different sizes
+ * @throw cudf::logic_error if @p output_type or an operand dtype isn't fixed-width or is
+ * fixed-point
+ * @throw cudf::logic_error if @p null_replacement is invalid or isn't of `output_type` type
+ * @throw cudf::logic_error if @p op isn't a supported arithmetic operator
+ */
+std::unique_ptr<column> binary_operation(
+  column_view const& lhs,
+  column_view const& rhs,
+  binary_operator op,
+  data_type output_type,
+  scalar const& null_replacement,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::binary_operation(column_view const&, column_view const&, binary_operator,
+ * data_type, scalar const&, rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
+ *
+ * The scalar is the left operand and the column elements are the right operand.
+ */
+std::unique_ptr<column> binary_operation(
+  scalar const& lhs,
+  column_view const& rhs,
+  binary_operator op,
+  data_type output_type,
+  scalar const& null_replacement,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::binary_operation(column_view const&, column_view const&, binary_operator,
+ * data_type, scalar const&, rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
+ *
+ * The column elements are the left operand and the scalar is the right operand.
+ */
+std::unique_ptr<column> binary_operation(
+  column_view const& lhs,
+  scalar const& rhs,
+  binary_operator op,
+  data_type output_type,
+  scalar const& null_replacement,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -172,6 +342,7 @@ std::unique_ptr<column> binary_operation(
  * @param output_type The desired data type of the output column. It is assumed
  *                    that output_type is compatible with the output data type
  *                    of the function in the PTX code
+ * @param stream      CUDA stream used for device memory operations and kernel launches
  * @param mr          Device memory resource used to allocate the returned column's device memory
  * @return            Output column of `output_type` type containing the result of
  *                    the binary operation
@@ -184,6 +355,52 @@ std::unique_ptr<column> binary_operation(
   column_view const& rhs,
   std::string const& ptx,
   data_type output_type,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Types of fused ternary operations that can be performed on data.
+ */
+enum class ternary_operator : int32_t {
+  MULTIPLY_ADD,  ///< (x * y) + z
+  ADD_MULTIPLY   ///< (x + y) * z
+};
+
+/**
+ * @brief Performs a fused ternary operation between three columns.
+ *
+ * The output contains the result of `op(x[i], y[i], z[i])` for all `0 <= i < x.size()`.
+ *
+ * Equivalent to chaining two calls to `binary_operation`, except that the
+ * fused operation makes a single pass over the operands and materializes no
+ * intermediate column. For floating point `MULTIPLY_ADD` the hardware fused
+ * multiply-add instruction is used, so results may differ from the chained
+ * binary operations by one rounding step.
+ *
+ * The operands are cast to the common type of the operand and output types
+ * before the operation. The validity of the output value is the logical AND of
+ * the validity of the three operands.
+ *
+ * @param x           The first operand column
+ * @param y           The second operand column
+ * @param z           The third operand column
+ * @param op          The ternary operator
+ * @param output_type The desired data type of the output column
+ * @param stream      CUDA stream used for device memory operations and kernel launches
+ * @param mr          Device memory resource used to allocate the returned column's device memory
+ * @return            Output column of `output_type` type containing the result of
+ *                    the ternary operation
+ * @throw cudf::logic_error if the column sizes don't match
+ * @throw cudf::logic_error if @p output_type dtype isn't fixed-width
+ * @throw cudf::logic_error if a common type among the operand and output types does not exist
+ */
+std::unique_ptr<column> ternary_operation(
+  column_view const& x,
+  column_view const& y,
+  column_view const& z,
+  ternary_operator op,
+  data_type output_type,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -19,6 +19,7 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/span.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
@@ -321,6 +322,53 @@ std::unique_ptr<column> make_fixed_width_column(
   return make_numeric_column(type, size, std::forward<B>(null_mask), null_count, stream, mr);
 }
 
+/**
+ * @brief Construct a fixed width column by copying element data from host memory.
+ *
+ * The copy is stream-ordered: when `data` refers to pinned or registered host
+ * memory (e.g. a `cudf::pinned_vector`) no pageable staging buffer is involved
+ * and the call returns without synchronizing the stream. The caller must keep
+ * the host memory alive and unmodified until the copy on `stream` has
+ * completed.
+ *
+ * @throws cudf::logic_error if `type` is not a fixed width type
+ * @throws cudf::logic_error if `data.size()` is not a multiple of the size of `type`
+ *
+ * @param[in] type The desired fixed width type
+ * @param[in] data Host memory holding the element data to copy
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ */
+std::unique_ptr<column> make_fixed_width_column(
+  data_type type,
+  host_span<uint8_t const> data,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Construct a fixed width column by copying typed element data from host memory.
+ *
+ * Convenience overload of the `host_span<uint8_t const>` factory that deduces
+ * the column type from `T`; the same stream-ordering and lifetime rules apply.
+ *
+ * @param[in] data Host memory holding the elements to copy
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ */
+template <typename T, CUDF_ENABLE_IF(is_fixed_width<T>())>
+std::unique_ptr<column> make_fixed_width_column(
+  host_span<T const> data,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  return make_fixed_width_column(
+    data_type{type_to_id<T>()},
+    host_span<uint8_t const>{reinterpret_cast<uint8_t const*>(data.data()),
+                             data.size() * sizeof(T)},
+    stream,
+    mr);
+}
+
 /**
  * @brief Construct a STRING type column given a device span of pointer/size pairs.
  *
@@ -575,6 +623,11 @@ std::unique_ptr<column> make_column_from_scalar(
  * The output column will have keys of type `s.type()`
  * The output column will be empty if `size==0`.
  *
+ * Only the single key value is materialized; each row costs one 8-bit index. This makes a
+ * dictionary the preferred representation for broadcasting a constant into table-level
+ * operations such as gather, concatenate, and joins, instead of materializing `size` copies
+ * of the value with `make_column_from_scalar`.
+ *
  * @throw cudf::logic_error if `s.is_valid()==false`
  *
  * @param[in] s The scalar to use for values in the column.
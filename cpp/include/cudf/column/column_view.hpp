@@ -156,6 +156,18 @@ class column_view_base {
    */
   size_type null_count() const;
 
+  /**
+   * @brief Indicates if the count of null elements is already known, i.e.,
+   * invoking `null_count()` will not scan the null mask.
+   *
+   * Useful to avoid materializing an unknown count when an algorithm can
+   * proceed without it.
+   *
+   * @return true The null count is known
+   * @return false Invoking `null_count()` will compute the count from the null mask
+   */
+  bool null_count_known() const noexcept { return _null_count > UNKNOWN_NULL_COUNT; }
+
   /**
    * @brief Returns the count of null elements in the range [begin, end)
    *
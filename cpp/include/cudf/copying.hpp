@@ -20,6 +20,7 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <memory>
 #include <vector>
@@ -81,6 +82,70 @@ std::unique_ptr<table> gather(
   out_of_bounds_policy bounds_policy  = out_of_bounds_policy::DONT_CHECK,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Gathers the rows of many tables in a single batched operation.
+ *
+ * Produces the same results as calling `gather` once per table but fuses the
+ * copies of all fixed-width, non-nullable columns into a single kernel
+ * launch. For workloads gathering many small tables (e.g. partition
+ * exchange) the per-call launch overhead dominates the copy time; this
+ * overload amortizes it across the whole batch. Columns that are nullable or
+ * not fixed-width, and all tables when @p bounds_policy is `NULLIFY`, are
+ * gathered through the regular per-table path.
+ *
+ * One gather map must be provided for each source table and the
+ * requirements on each map match those of the single-table `gather`.
+ *
+ * @throws cudf::logic_error if the number of gather maps does not match the
+ * number of source tables.
+ * @throws cudf::logic_error if any gather map contains null values.
+ *
+ * @param[in] source_tables Tables to gather from.
+ * @param[in] gather_maps Non-nullable columns of integral indices, one per
+ * source table.
+ * @param[in] bounds_policy Policy to apply to account for possible out-of-bounds indices.
+ * @param[in] mr Device memory resource used to allocate the returned tables' device memory.
+ * @return Result of gathering each source table with its map, in order.
+ */
+std::vector<std::unique_ptr<table>> gather(
+  std::vector<table_view> const& source_tables,
+  std::vector<column_view> const& gather_maps,
+  out_of_bounds_policy bounds_policy  = out_of_bounds_policy::DONT_CHECK,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Gathers the specified rows of a table into a preallocated destination table.
+ *
+ * @ingroup copy_gather
+ *
+ * As the single-table `gather`, but writes into caller-provided, preallocated columns
+ * instead of allocating the result, so pipelines that process batches of a fixed shape
+ * can reuse the same destination buffers across batches. Only the first
+ * `gather_map.size()` rows of each destination column are written; rows beyond that are
+ * left untouched. Use the allocating overload for use cases requiring memory
+ * reallocation, e.g. for strings columns and other variable-width types.
+ *
+ * All map values must be in the range `[0, source_table.num_rows())`; as with
+ * `out_of_bounds_policy::DONT_CHECK`, the behavior for out-of-bounds (including
+ * negative) indices is undefined.
+ *
+ * @throws cudf::logic_error if gather_map contains null values.
+ * @throws cudf::logic_error if @p source_table and @p destination have different
+ * numbers of columns, or a column pair has mismatched types.
+ * @throws cudf::logic_error if @p destination has fewer rows than @p gather_map
+ * has elements.
+ * @throws cudf::logic_error if a column is not fixed-width or a source column has
+ * null values.
+ *
+ * @param[in] source_table The input columns whose rows will be gathered
+ * @param[in] gather_map View into a non-nullable column of integral indices that maps the
+ * rows in the source columns to rows in the destination columns.
+ * @param[in,out] destination The preallocated columns to gather into
+ */
+void gather_in_place(table_view const& source_table,
+                     column_view const& gather_map,
+                     mutable_table_view& destination);
+
 /**
  * @brief Reverses the rows within a table.
  * Creates a new table that is the reverse of @p source_table.
@@ -195,6 +260,48 @@ std::unique_ptr<table> scatter(
   bool check_bounds                   = false,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Scatters many (source, scatter map) pairs into one copy of the target
+ * table.
+ *
+ * @ingroup copy_scatter
+ *
+ * Equivalent to applying `scatter(sources[i], scatter_maps[i], ...)` for each
+ * pair in turn, but the target is copied once and, when every column involved
+ * is fixed-width, all pairs are applied by a single kernel with the null-mask
+ * updates fused into the same pass. This collapses the per-pair kernel
+ * launches that dominate pipelines applying many small deltas per cycle.
+ * Tables containing variable-width or nested columns, and calls with
+ * `check_bounds == true`, fall back to one scatter per pair.
+ *
+ * Each source must match the target's column types, and each scatter map must
+ * be non-nullable with no more entries than its source has rows. A negative
+ * index `i` in a signed scatter map is interpreted as `i+n`, where `n` is the
+ * number of rows in `target`.
+ *
+ * The scatter maps are expected to be disjoint; if an index appears in more
+ * than one map (or more than once in a map), it is undefined which pair's row
+ * the result holds.
+ *
+ * @throws cudf::logic_error if the number of sources and scatter maps differ
+ * @throws cudf::logic_error if any source's column types do not match `target`
+ * @throws cudf::logic_error if any scatter map contains nulls
+ *
+ * @param sources The tables containing values to be scattered into the target
+ * @param scatter_maps A scatter map for each source table
+ * @param target The table into which the source values are scattered
+ * @param check_bounds Optionally perform bounds checking on each scatter map
+ * and throw an error if any of its values are out of bounds.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return Result of scattering all sources into a copy of target
+ */
+std::unique_ptr<table> scatter(
+  std::vector<table_view> const& sources,
+  std::vector<column_view> const& scatter_maps,
+  table_view const& target,
+  bool check_bounds                   = false,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Indicates when to allocate a mask, based on an existing mask.
  */
@@ -605,6 +712,13 @@ struct packed_table {
  * @throws cudf::logic_error When the value in `splits` is not in the range [0, input.size()).
  * @throws cudf::logic_error When the values in the `splits` are 'strictly decreasing'.
  *
+ * @note The partition buffers are allocated from `mr` and the pack kernel writes into them
+ * directly. Passing a resource whose allocations are device-accessible but live elsewhere —
+ * pinned host memory (e.g. `cudf::detail::pinned_host_memory_resource`) or memory on a peer
+ * device with peer access enabled — packs the partitions straight into that memory, avoiding
+ * a separate device-to-device-to-host copy of every packed byte when the results are destined
+ * for the host or another GPU.
+ *
  * @param input View of a table to split
  * @param splits A vector of indices where the view will be split
  * @param[in] mr Device memory resource used to allocate the returned result's device memory
@@ -683,6 +797,40 @@ table_view unpack(packed_columns const& input);
  */
 table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data);
 
+/**
+ * @brief Snappy-compresses the device buffer of a packed table on the GPU.
+ *
+ * Intended for spilling: the result of `cudf::pack` is compressed in fixed-size chunks by the
+ * device snappy encoder before it is copied off the device, typically cutting the host transfer
+ * volume several-fold. Chunks that do not shrink are stored uncompressed, so the operation never
+ * fails on incompressible data. The metadata is carried through unchanged.
+ *
+ * The returned buffer is not a valid `unpack` input; restore it with `cudf::decompress_packed`
+ * first.
+ *
+ * @param input The packed columns whose device buffer is to be compressed
+ * @param[in] mr Optional, The resource to use for all returned device allocations
+ * @return packed_columns with the same metadata and a compressed device buffer
+ */
+packed_columns compress_packed(
+  packed_columns const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Decompresses the result of `cudf::compress_packed`.
+ *
+ * Restores the original contiguous device buffer so the result can be passed to `cudf::unpack`.
+ *
+ * @throws cudf::logic_error if `input` was not produced by `cudf::compress_packed`
+ *
+ * @param input The compressed packed columns
+ * @param[in] mr Optional, The resource to use for all returned device allocations
+ * @return packed_columns with the same metadata and the decompressed device buffer
+ */
+packed_columns decompress_packed(
+  packed_columns const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief   Returns a new column, where each element is selected from either @p lhs or
  *          @p rhs based on the value of the corresponding element in @p boolean_mask
@@ -875,6 +1023,28 @@ std::unique_ptr<scalar> get_element(
   size_type index,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Get the elements at the specified indices from a column
+ *
+ * Equivalent to calling `get_element` once per index, but the requested rows
+ * are gathered by a single kernel and copied to the host in a single transfer
+ * with a single stream synchronization, instead of one round trip per element.
+ *
+ * Only fixed-width and string columns are supported.
+ *
+ * @throws cudf::logic_error if any index is not within the range `[0, input.size())`
+ * @throws cudf::logic_error if `input` is a dictionary or nested column
+ *
+ * @param input Column view to get the elements from
+ * @param indices Device span of indices into `input`
+ * @param mr Device memory resource used to allocate the returned scalars' device memory.
+ * @return Scalars containing the values, in the order of `indices`
+ */
+std::vector<std::unique_ptr<scalar>> get_elements(
+  column_view const& input,
+  device_span<size_type const> indices,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Indicates whether a row can be sampled more than once.
  */
@@ -19,6 +19,7 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <vector>
 
 /**
  * @file datetime.hpp
@@ -26,6 +27,7 @@
  */
 
 namespace cudf {
+class table;
 namespace datetime {
 /**
  * @addtogroup datetime_extract
@@ -33,6 +35,23 @@ namespace datetime {
  * @file
  */
 
+/**
+ * @brief Components of a timestamp that can be extracted.
+ */
+enum class datetime_component {
+  INVALID = 0,
+  YEAR,
+  MONTH,
+  DAY,
+  WEEKDAY,
+  HOUR,
+  MINUTE,
+  SECOND,
+  MILLISECOND,
+  MICROSECOND,
+  NANOSECOND
+};
+
 /**
  * @brief  Extracts year from any date time type and returns an int16_t
  * cudf::column.
@@ -124,6 +143,34 @@ std::unique_ptr<cudf::column> extract_second(
   cudf::column_view const& column,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief  Extracts several components from any date time type in a single pass
+ * and returns them as a table of int16_t cudf::columns.
+ *
+ * Extracting components one at a time (`extract_year`, `extract_month`, ...)
+ * repeats the civil-time decomposition of every timestamp once per component.
+ * This function decomposes each timestamp once and writes all requested
+ * components, so extracting the full date and time costs about as much as a
+ * single `extract_*` call.
+ *
+ * The output table has one INT16 column per requested component, in the order
+ * given by `components`, each identical to the corresponding `extract_*`
+ * result. Supported components are `YEAR`, `MONTH`, `DAY`, `WEEKDAY`, `HOUR`,
+ * `MINUTE` and `SECOND`.
+ *
+ * @param[in] column cudf::column_view of the input datetime values
+ * @param[in] components The components to extract from every timestamp
+ *
+ * @returns cudf::table of the extracted int16_t components
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw cudf::logic_error if `components` is empty or contains an unsupported
+ * component
+ */
+std::unique_ptr<cudf::table> extract_datetime_components(
+  cudf::column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 /**
  * @addtogroup datetime_compute
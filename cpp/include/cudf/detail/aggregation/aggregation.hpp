@@ -69,6 +69,14 @@ class simple_aggregations_collector {  // Declares the interface for the simple
                                                           class argmin_aggregation const& agg);
   virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
                                                           class nunique_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(
+    data_type col_type, class approx_nunique_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
+                                                          class top_k_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
+                                                          class tdigest_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(
+    data_type col_type, class merge_tdigest_aggregation const& agg);
   virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
                                                           class nth_element_aggregation const& agg);
   virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
@@ -114,6 +122,10 @@ class aggregation_finalizer {  // Declares the interface for the finalizer
   virtual void visit(class argmax_aggregation const& agg);
   virtual void visit(class argmin_aggregation const& agg);
   virtual void visit(class nunique_aggregation const& agg);
+  virtual void visit(class approx_nunique_aggregation const& agg);
+  virtual void visit(class top_k_aggregation const& agg);
+  virtual void visit(class tdigest_aggregation const& agg);
+  virtual void visit(class merge_tdigest_aggregation const& agg);
   virtual void visit(class nth_element_aggregation const& agg);
   virtual void visit(class row_number_aggregation const& agg);
   virtual void visit(class rank_aggregation const& agg);
@@ -533,6 +545,155 @@ class nunique_aggregation final : public groupby_aggregation {
   size_t hash_impl() const { return std::hash<int>{}(static_cast<int>(_null_handling)); }
 };
 
+/**
+ * @brief Derived class for specifying an approximate nunique aggregation
+ */
+class approx_nunique_aggregation final : public groupby_aggregation {
+ public:
+  approx_nunique_aggregation(null_policy null_handling, size_type precision)
+    : aggregation{APPROX_NUNIQUE}, _null_handling{null_handling}, _precision{precision}
+  {
+  }
+
+  null_policy _null_handling;  ///< include or exclude nulls
+  size_type _precision;        ///< log2 of the number of sketch registers per group
+
+  bool is_equal(aggregation const& _other) const override
+  {
+    if (!this->aggregation::is_equal(_other)) { return false; }
+    auto const& other = dynamic_cast<approx_nunique_aggregation const&>(_other);
+    return _null_handling == other._null_handling and _precision == other._precision;
+  }
+
+  size_t do_hash() const override { return this->aggregation::do_hash() ^ hash_impl(); }
+
+  std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<approx_nunique_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+
+ private:
+  size_t hash_impl() const
+  {
+    return std::hash<int>{}(static_cast<int>(_null_handling)) ^ std::hash<size_type>{}(_precision);
+  }
+};
+
+/**
+ * @brief Derived class for specifying a top-k aggregation
+ */
+class top_k_aggregation final : public groupby_aggregation {
+ public:
+  top_k_aggregation(size_type k, order ord) : aggregation{TOP_K}, _k{k}, _order{ord} {}
+
+  size_type _k;  ///< number of elements to keep per group
+  order _order;  ///< DESCENDING keeps the greatest elements, ASCENDING the least
+
+  bool is_equal(aggregation const& _other) const override
+  {
+    if (!this->aggregation::is_equal(_other)) { return false; }
+    auto const& other = dynamic_cast<top_k_aggregation const&>(_other);
+    return _k == other._k and _order == other._order;
+  }
+
+  size_t do_hash() const override { return this->aggregation::do_hash() ^ hash_impl(); }
+
+  std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<top_k_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+
+ private:
+  size_t hash_impl() const
+  {
+    return std::hash<size_type>{}(_k) ^ std::hash<int>{}(static_cast<int>(_order));
+  }
+};
+
+/**
+ * @brief Derived class for specifying a t-digest build aggregation
+ */
+class tdigest_aggregation final : public groupby_aggregation {
+ public:
+  explicit tdigest_aggregation(size_type max_centroids)
+    : aggregation{TDIGEST}, _max_centroids{max_centroids}
+  {
+  }
+
+  size_type _max_centroids;  ///< maximum number of centroids per digest
+
+  bool is_equal(aggregation const& _other) const override
+  {
+    if (!this->aggregation::is_equal(_other)) { return false; }
+    auto const& other = dynamic_cast<tdigest_aggregation const&>(_other);
+    return _max_centroids == other._max_centroids;
+  }
+
+  size_t do_hash() const override { return this->aggregation::do_hash() ^ hash_impl(); }
+
+  std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<tdigest_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+
+ private:
+  size_t hash_impl() const { return std::hash<size_type>{}(_max_centroids); }
+};
+
+/**
+ * @brief Derived class for specifying a t-digest merge aggregation
+ */
+class merge_tdigest_aggregation final : public groupby_aggregation {
+ public:
+  explicit merge_tdigest_aggregation(size_type max_centroids)
+    : aggregation{MERGE_TDIGEST}, _max_centroids{max_centroids}
+  {
+  }
+
+  size_type _max_centroids;  ///< maximum number of centroids in each merged digest
+
+  bool is_equal(aggregation const& _other) const override
+  {
+    if (!this->aggregation::is_equal(_other)) { return false; }
+    auto const& other = dynamic_cast<merge_tdigest_aggregation const&>(_other);
+    return _max_centroids == other._max_centroids;
+  }
+
+  size_t do_hash() const override { return this->aggregation::do_hash() ^ hash_impl(); }
+
+  std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<merge_tdigest_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+
+ private:
+  size_t hash_impl() const { return std::hash<size_type>{}(_max_centroids); }
+};
+
 /**
  * @brief Derived class for specifying a nth element aggregation
  */
@@ -1052,6 +1213,30 @@ struct target_type_impl<Source, aggregation::NUNIQUE> {
   using type = size_type;
 };
 
+// Always use size_type accumulator for APPROX_NUNIQUE
+template <typename Source>
+struct target_type_impl<Source, aggregation::APPROX_NUNIQUE> {
+  using type = size_type;
+};
+
+// Always use list for TOP_K
+template <typename Source>
+struct target_type_impl<Source, aggregation::TOP_K> {
+  using type = list_view;
+};
+
+// Always use struct for TDIGEST
+template <typename Source>
+struct target_type_impl<Source, aggregation::TDIGEST> {
+  using type = struct_view;
+};
+
+// Always use struct for MERGE_TDIGEST
+template <typename Source>
+struct target_type_impl<Source, aggregation::MERGE_TDIGEST> {
+  using type = struct_view;
+};
+
 // Always use Source for NTH_ELEMENT
 template <typename Source>
 struct target_type_impl<Source, aggregation::NTH_ELEMENT> {
@@ -1222,6 +1407,14 @@ CUDA_HOST_DEVICE_CALLABLE decltype(auto) aggregation_dispatcher(aggregation::Kin
       return f.template operator()<aggregation::MERGE_SETS>(std::forward<Ts>(args)...);
     case aggregation::MERGE_M2:
       return f.template operator()<aggregation::MERGE_M2>(std::forward<Ts>(args)...);
+    case aggregation::APPROX_NUNIQUE:
+      return f.template operator()<aggregation::APPROX_NUNIQUE>(std::forward<Ts>(args)...);
+    case aggregation::TOP_K:
+      return f.template operator()<aggregation::TOP_K>(std::forward<Ts>(args)...);
+    case aggregation::TDIGEST:
+      return f.template operator()<aggregation::TDIGEST>(std::forward<Ts>(args)...);
+    case aggregation::MERGE_TDIGEST:
+      return f.template operator()<aggregation::MERGE_TDIGEST>(std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported aggregation.");
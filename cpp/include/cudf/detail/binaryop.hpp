@@ -94,6 +94,19 @@ std::unique_ptr<column> binary_operation(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::binary_operation(scalar const&, column_view const&, binary_operator,
+ * data_type, scalar_validity, rmm::cuda_stream_view, rmm::mr::device_memory_resource *)
+ */
+std::unique_ptr<column> binary_operation(
+  scalar const& lhs,
+  column_view const& rhs,
+  binary_operator op,
+  data_type output_type,
+  scalar_validity validity_policy,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::binary_operation(column_view const&, scalar const&, binary_operator,
  * data_type, rmm::mr::device_memory_resource *)
@@ -108,6 +121,19 @@ std::unique_ptr<column> binary_operation(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::binary_operation(column_view const&, scalar const&, binary_operator,
+ * data_type, scalar_validity, rmm::cuda_stream_view, rmm::mr::device_memory_resource *)
+ */
+std::unique_ptr<column> binary_operation(
+  column_view const& lhs,
+  scalar const& rhs,
+  binary_operator op,
+  data_type output_type,
+  scalar_validity validity_policy,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::binary_operation(column_view const&, column_view const&,
  * binary_operator, data_type, rmm::mr::device_memory_resource *)
@@ -121,5 +147,69 @@ std::unique_ptr<column> binary_operation(
   data_type output_type,
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::binary_operation_in_place(column_view const&, column_view const&,
+ * binary_operator, mutable_column_view&, rmm::cuda_stream_view)
+ */
+void binary_operation_in_place(column_view const& lhs,
+                               column_view const& rhs,
+                               binary_operator op,
+                               mutable_column_view& output,
+                               rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::binary_operation(column_view const&, column_view const&, binary_operator,
+ * data_type, scalar const&, rmm::cuda_stream_view, rmm::mr::device_memory_resource *)
+ */
+std::unique_ptr<column> binary_operation(
+  column_view const& lhs,
+  column_view const& rhs,
+  binary_operator op,
+  data_type output_type,
+  scalar const& null_replacement,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::binary_operation(scalar const&, column_view const&, binary_operator,
+ * data_type, scalar const&, rmm::cuda_stream_view, rmm::mr::device_memory_resource *)
+ */
+std::unique_ptr<column> binary_operation(
+  scalar const& lhs,
+  column_view const& rhs,
+  binary_operator op,
+  data_type output_type,
+  scalar const& null_replacement,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::binary_operation(column_view const&, scalar const&, binary_operator,
+ * data_type, scalar const&, rmm::cuda_stream_view, rmm::mr::device_memory_resource *)
+ */
+std::unique_ptr<column> binary_operation(
+  column_view const& lhs,
+  scalar const& rhs,
+  binary_operator op,
+  data_type output_type,
+  scalar const& null_replacement,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::ternary_operation(column_view const&, column_view const&, column_view const&,
+ * ternary_operator, data_type, rmm::mr::device_memory_resource *)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> ternary_operation(
+  column_view const& x,
+  column_view const& y,
+  column_view const& z,
+  ternary_operator op,
+  data_type output_type,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 }  // namespace detail
 }  // namespace cudf
@@ -149,6 +149,26 @@ packed_columns pack(cudf::table_view const& input,
                     rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
                     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::compress_packed
+ *
+ * @param stream Optional CUDA stream on which to execute kernels
+ **/
+packed_columns compress_packed(
+  packed_columns const& input,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::decompress_packed
+ *
+ * @param stream Optional CUDA stream on which to execute kernels
+ **/
+packed_columns decompress_packed(
+  packed_columns const& input,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::allocate_like(column_view const&, size_type, mask_allocation_policy,
  * rmm::mr::device_memory_resource*)
@@ -237,5 +257,16 @@ std::unique_ptr<scalar> get_element(
   size_type index,
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::get_elements
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::unique_ptr<scalar>> get_elements(
+  column_view const& input,
+  device_span<size_type const> indices,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 }  // namespace detail
 }  // namespace cudf
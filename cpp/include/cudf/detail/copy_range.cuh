@@ -97,7 +97,7 @@ __global__ void copy_range_kernel(SourceValueIterator source_value_begin,
     mask_idx += masks_per_grid;
   }
 
-  if (has_validity) {
+  if (has_validity && null_count != nullptr) {
     auto block_null_change =
       cudf::detail::single_lane_block_sum_reduce<block_size, leader_lane>(warp_null_change);
     if (threadIdx.x == 0) {  // if the first thread in a block
@@ -155,24 +155,34 @@ void copy_range(SourceValueIterator source_value_begin,
   auto grid = cudf::detail::grid_1d{num_items, block_size, 1};
 
   if (target.nullable()) {
-    // TODO: if null_count is UNKNOWN_NULL_COUNT, no need to update null
-    // count (if null_count is UNKNOWN_NULL_COUNT, invoking null_count()
-    // will scan the entire bitmask array, and this can be surprising
-    // in performance if the copy range is small and the column size is
-    // large).
-    rmm::device_scalar<size_type> null_count(target.null_count(), stream);
-
     auto kernel =
       copy_range_kernel<block_size, SourceValueIterator, SourceValidityIterator, T, true>;
-    kernel<<<grid.num_blocks, block_size, 0, stream.value()>>>(
-      source_value_begin,
-      source_validity_begin,
-      *mutable_column_device_view::create(target, stream),
-      target_begin,
-      target_end,
-      null_count.data());
-
-    target.set_null_count(null_count.value(stream));
+    if (target.null_count_known()) {
+      // the kernel accumulates the change in null count, so only the known
+      // count needs to be adjusted
+      rmm::device_scalar<size_type> null_count(target.null_count(), stream);
+
+      kernel<<<grid.num_blocks, block_size, 0, stream.value()>>>(
+        source_value_begin,
+        source_validity_begin,
+        *mutable_column_device_view::create(target, stream),
+        target_begin,
+        target_end,
+        null_count.data());
+
+      target.set_null_count(null_count.value(stream));
+    } else {
+      // if the null count is unknown, obtaining a baseline for the delta would
+      // scan the entire bitmask -- surprisingly expensive when the copy range
+      // is small and the column is large. Leave the count unknown instead.
+      kernel<<<grid.num_blocks, block_size, 0, stream.value()>>>(
+        source_value_begin,
+        source_validity_begin,
+        *mutable_column_device_view::create(target, stream),
+        target_begin,
+        target_end,
+        nullptr);
+    }
   } else {
     auto kernel =
       copy_range_kernel<block_size, SourceValueIterator, SourceValidityIterator, T, false>;
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/indexalator.cuh>
 #include <cudf/detail/null_mask.hpp>
@@ -440,6 +441,62 @@ struct column_gatherer_impl<dictionary32> {
   }
 };
 
+/**
+ * @brief Source, destination, and element width of one fixed-width struct leaf
+ * gathered by `fused_leaf_gather_kernel`.
+ */
+struct fused_gather_leaf {
+  uint8_t const* source;  ///< leaf data adjusted for the parent's offset
+  uint8_t* target;        ///< output data for the gathered leaf
+  int32_t element_size;   ///< size of one element in bytes
+};
+
+/**
+ * @brief Gathers every fixed-width leaf of a struct column in a single kernel.
+ *
+ * Threads are assigned one element each, leaf-major, so that consecutive
+ * threads write consecutive rows of the same leaf and destination stores stay
+ * coalesced. Rows whose map index is out of bounds are skipped; their bits are
+ * cleared later by `gather_bitmask` with the NULLIFY op.
+ */
+template <typename MapIterator>
+__global__ void fused_leaf_gather_kernel(fused_gather_leaf const* leaves,
+                                         size_type num_leaves,
+                                         size_type num_rows,
+                                         size_type source_size,
+                                         MapIterator gather_map,
+                                         bool nullify_out_of_bounds)
+{
+  using map_type = typename std::iterator_traits<MapIterator>::value_type;
+
+  auto const num_elements = static_cast<int64_t>(num_leaves) * num_rows;
+  auto const stride       = static_cast<int64_t>(blockDim.x) * gridDim.x;
+  for (auto element_index = static_cast<int64_t>(threadIdx.x) + blockIdx.x * blockDim.x;
+       element_index < num_elements;
+       element_index += stride) {
+    auto const row       = static_cast<size_type>(element_index % num_rows);
+    auto const map_index = gather_map[row];
+    if (nullify_out_of_bounds and not bounds_checker<map_type>{0, source_size}(map_index)) {
+      continue;
+    }
+
+    auto const leaf = leaves[element_index / num_rows];
+    auto const src  = leaf.source + static_cast<int64_t>(map_index) * leaf.element_size;
+    auto const dst  = leaf.target + static_cast<int64_t>(row) * leaf.element_size;
+    switch (leaf.element_size) {
+      case 1: *dst = *src; break;
+      case 2: *reinterpret_cast<uint16_t*>(dst) = *reinterpret_cast<uint16_t const*>(src); break;
+      case 4: *reinterpret_cast<uint32_t*>(dst) = *reinterpret_cast<uint32_t const*>(src); break;
+      case 8: *reinterpret_cast<uint64_t*>(dst) = *reinterpret_cast<uint64_t const*>(src); break;
+      case 16: *reinterpret_cast<uint4*>(dst) = *reinterpret_cast<uint4 const*>(src); break;
+      default:
+        for (int32_t byte = 0; byte < leaf.element_size; ++byte) {
+          dst[byte] = src[byte];
+        }
+    }
+  }
+}
+
 template <>
 struct column_gatherer_impl<struct_view> {
   template <typename MapItRoot>
@@ -463,25 +520,54 @@ struct column_gatherer_impl<struct_view> {
                      return structs_view.get_sliced_child(idx);
                    });
 
-    std::vector<std::unique_ptr<cudf::column>> output_struct_members;
-    std::transform(sliced_children.begin(),
-                   sliced_children.end(),
-                   std::back_inserter(output_struct_members),
-                   [&](auto const& col) {
-                     return cudf::type_dispatcher<dispatch_storage_type>(col.type(),
-                                                                         column_gatherer{},
-                                                                         col,
-                                                                         gather_map_begin,
-                                                                         gather_map_end,
-                                                                         nullify_out_of_bounds,
-                                                                         stream,
-                                                                         mr);
-                   });
+    // Fixed-width leaves are all gathered by one fused kernel instead of one
+    // kernel launch per leaf; nested and variable-width children still go
+    // through the per-column gatherer.
+    auto const output_size = static_cast<size_type>(gather_map_size);
+    std::vector<std::unique_ptr<cudf::column>> output_struct_members(sliced_children.size());
+    std::vector<fused_gather_leaf> fused_leaves;
+    for (std::size_t i = 0; i < sliced_children.size(); ++i) {
+      auto const& col = sliced_children[i];
+      if (is_fixed_width(col.type()) and col.num_children() == 0) {
+        auto const element_size = cudf::size_of(col.type());
+        output_struct_members[i] =
+          make_fixed_width_column(col.type(), output_size, mask_state::UNALLOCATED, stream, mr);
+        fused_leaves.push_back(fused_gather_leaf{
+          col.head<uint8_t>() + static_cast<int64_t>(col.offset()) * element_size,
+          output_struct_members[i]->mutable_view().head<uint8_t>(),
+          static_cast<int32_t>(element_size)});
+      } else {
+        output_struct_members[i] = cudf::type_dispatcher<dispatch_storage_type>(col.type(),
+                                                                                column_gatherer{},
+                                                                                col,
+                                                                                gather_map_begin,
+                                                                                gather_map_end,
+                                                                                nullify_out_of_bounds,
+                                                                                stream,
+                                                                                mr);
+      }
+    }
+
+    if (not fused_leaves.empty()) {
+      auto const d_leaves     = make_device_uvector_async(fused_leaves, stream);
+      constexpr size_type block_size = 256;
+      auto const num_elements = static_cast<int64_t>(fused_leaves.size()) * output_size;
+      auto const num_blocks   = static_cast<int>(
+        std::min<int64_t>(65535, (num_elements + block_size - 1) / block_size));
+      fused_leaf_gather_kernel<<<num_blocks, block_size, 0, stream.value()>>>(
+        d_leaves.data(),
+        static_cast<size_type>(fused_leaves.size()),
+        output_size,
+        column.size(),
+        gather_map_begin,
+        nullify_out_of_bounds);
+      CHECK_CUDA(stream.value());
+    }
 
     auto const nullable =
       nullify_out_of_bounds || std::any_of(sliced_children.begin(),
                                            sliced_children.end(),
-                                           [](auto const& col) { return col.nullable(); });
+                                           [](auto const& col) { return col.has_nulls(); });
 
     if (nullable) {
       gather_bitmask(
@@ -565,9 +651,11 @@ void gather_bitmask(table_view const& source,
                            [target_rows](auto const& col) { return target_rows == col->size(); }),
                "Column size mismatch");
 
-  // Create null mask if source is nullable but target is not
+  // Create null mask if the source contains nulls but the target is not yet nullable. A source
+  // that is nullable with a zero null count gathers to an all-valid result, so no mask is
+  // allocated for it.
   for (size_t i = 0; i < target.size(); ++i) {
-    if ((source.column(i).nullable() or op == gather_bitmask_op::NULLIFY) and
+    if ((source.column(i).has_nulls() or op == gather_bitmask_op::NULLIFY) and
         not target[i]->nullable()) {
       auto const state =
         op == gather_bitmask_op::PASSTHROUGH ? mask_state::ALL_VALID : mask_state::UNINITIALIZED;
@@ -67,5 +67,31 @@ std::unique_ptr<table> gather(
   negative_index_policy neg_indices,
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::gather(std::vector<table_view> const&,std::vector<column_view>
+ * const&,out_of_bounds_policy,rmm::mr::device_memory_resource*)
+ *
+ * The negative index policy for each table is derived from its gather map
+ * type as in the single-table overload.
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::unique_ptr<table>> gather(
+  std::vector<table_view> const& source_tables,
+  std::vector<column_view> const& gather_maps,
+  out_of_bounds_policy bounds_policy,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::gather_in_place
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void gather_in_place(table_view const& source_table,
+                     column_view const& gather_map,
+                     mutable_table_view& destination,
+                     rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 }  // namespace detail
 }  // namespace cudf
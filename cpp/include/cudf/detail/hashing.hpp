@@ -49,6 +49,21 @@ std::unique_ptr<column> md5_hash(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+std::unique_ptr<column> xxhash_64(
+  table_view const& input,
+  uint64_t seed                       = 0,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::table_checksum
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+uint64_t table_checksum(table_view const& input,
+                        uint64_t seed                = 0,
+                        rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 template <template <typename> class hash_function>
 std::unique_ptr<column> serial_murmur_hash3_32(
   table_view const& input,
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/metrics.hpp>
+
+#include <chrono>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Returns true if a metrics callback is currently registered.
+ *
+ * Cheap enough to gate metrics bookkeeping on the hot path.
+ */
+bool has_metrics_callback();
+
+/**
+ * @brief Invokes the registered metrics callback, if any, with `metrics`.
+ */
+void report_operation(operation_metrics const& metrics);
+
+/**
+ * @brief RAII instrumentation scope for a public API call.
+ *
+ * Emits an NVTX range in the libcudf domain named after the operation and
+ * carrying the row count as payload, so per-operation device time can be
+ * attributed in a profiler. When a callback has been registered via
+ * `cudf::set_metrics_callback`, additionally reports an `operation_metrics`
+ * record on destruction. Use via `CUDF_OP_RANGE`.
+ */
+class operation_scope {
+ public:
+  operation_scope(char const* name, size_type num_rows, std::size_t num_bytes = 0)
+    : _name{name},
+      _num_rows{num_rows},
+      _num_bytes{num_bytes},
+      _range{nvtx3::event_attributes{name, nvtx3::payload{static_cast<int64_t>(num_rows)}}},
+      _enabled{has_metrics_callback()},
+      _start{_enabled ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{}}
+  {
+  }
+
+  ~operation_scope()
+  {
+    if (_enabled) {
+      report_operation(
+        {_name, _num_rows, _num_bytes, std::chrono::steady_clock::now() - _start});
+    }
+  }
+
+  operation_scope(operation_scope const&) = delete;
+  operation_scope& operator=(operation_scope const&) = delete;
+
+ private:
+  char const* _name;
+  size_type _num_rows;
+  std::size_t _num_bytes;
+  cudf::thread_range _range;
+  bool _enabled;
+  std::chrono::steady_clock::time_point _start;
+};
+
+}  // namespace detail
+}  // namespace cudf
+
+/**
+ * @brief Convenience macro instrumenting the enclosing public API function.
+ *
+ * Like `CUDF_FUNC_RANGE()`, but attaches the number of rows processed as the
+ * NVTX payload and feeds the metrics callback registered via
+ * `cudf::set_metrics_callback`. An optional second argument reports the number
+ * of input bytes.
+ *
+ * Example:
+ * ```
+ * std::unique_ptr<column> some_function(column_view const& input, ...){
+ *    CUDF_OP_RANGE(input.size());
+ *    ...
+ * }
+ * ```
+ */
+#define CUDF_OP_RANGE(num_rows, ...) \
+  cudf::detail::operation_scope _cudf_operation_scope { __func__, num_rows, ##__VA_ARGS__ }
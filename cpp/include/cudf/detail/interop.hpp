@@ -46,6 +46,16 @@ DLManagedTensor* to_dlpack(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::to_dlpack_view(column_view const&)
+ */
+DLManagedTensor* to_dlpack_view(column_view const& input);
+
+/**
+ * @copydoc cudf::to_dlpack_view(table_view const&)
+ */
+DLManagedTensor* to_dlpack_view(table_view const& input);
+
 // Creating arrow as per given type_id and buffer arguments
 template <typename... Ts>
 std::shared_ptr<arrow::Array> to_arrow_array(cudf::type_id id, Ts&&... args)
@@ -116,5 +126,16 @@ std::unique_ptr<table> from_arrow(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::to_arrow_device
+ */
+std::shared_ptr<arrow::Table> to_arrow_device(std::shared_ptr<table> input,
+                                              std::vector<column_metadata> const& metadata = {});
+
+/**
+ * @copydoc cudf::from_arrow_device
+ */
+table_view from_arrow_device(arrow::Table const& input_table);
+
 }  // namespace detail
 }  // namespace cudf
@@ -70,6 +70,39 @@ inline auto make_counting_transform_iterator(cudf::size_type start, UnaryFunctio
   return thrust::make_transform_iterator(thrust::make_counting_iterator(start), f);
 }
 
+/**
+ * @brief Computes the `i`-th element of the arithmetic sequence `init + i * step`.
+ */
+template <typename Element>
+struct sequence_accessor {
+  Element init;
+  Element step;
+
+  CUDA_HOST_DEVICE_CALLABLE Element operator()(cudf::size_type i) const
+  {
+    return init + static_cast<Element>(i) * step;
+  }
+};
+
+/**
+ * @brief Constructs a device iterator that generates the arithmetic sequence
+ * `init, init + step, init + 2 * step, ...` on the fly.
+ *
+ * Use this instead of materializing a `cudf::sequence` column when a sequence of row ids, gather
+ * map entries, or range keys is only consumed on the device; generating the values in the
+ * consuming kernel avoids writing and re-reading the sequence through global memory.
+ *
+ * @param init The starting value of the sequence
+ * @param step The increment between consecutive elements
+ * @return An iterator that computes sequence values on demand
+ */
+template <typename Element>
+auto inline make_sequence_iterator(Element init, Element step = Element{1})
+{
+  return make_counting_transform_iterator(cudf::size_type{0},
+                                          sequence_accessor<Element>{init, step});
+}
+
 /**
  * @brief Value accessor of column that may have a null bitmask.
  *
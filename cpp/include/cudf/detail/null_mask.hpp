@@ -20,6 +20,8 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <utility>
+
 #include <vector>
 
 namespace cudf {
@@ -114,7 +116,7 @@ rmm::device_buffer copy_bitmask(
  *
  * @param stream CUDA stream used for device memory operations and kernel launches
  */
-rmm::device_buffer bitmask_and(
+std::pair<rmm::device_buffer, size_type> bitmask_and(
   host_span<bitmask_type const*> masks,
   host_span<size_type const> masks_begin_bits,
   size_type mask_size_bits,
@@ -124,9 +126,12 @@ rmm::device_buffer bitmask_and(
 /**
  * @copydoc cudf::bitmask_and
  *
+ * Also returns the null count of the resulting mask, fused into the merge
+ * kernel, so callers never need a separate `count_set_bits` pass.
+ *
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  */
-rmm::device_buffer bitmask_and(
+std::pair<rmm::device_buffer, size_type> bitmask_and(
   table_view const& view,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
@@ -134,9 +139,12 @@ rmm::device_buffer bitmask_and(
 /**
  * @copydoc cudf::bitmask_or
  *
+ * Also returns the null count of the resulting mask, fused into the merge
+ * kernel, so callers never need a separate `count_set_bits` pass.
+ *
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  */
-rmm::device_buffer bitmask_or(
+std::pair<rmm::device_buffer, size_type> bitmask_or(
   table_view const& view,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
@@ -150,10 +158,10 @@ rmm::device_buffer bitmask_or(
  * @param masks_begin_bits The bit offsets from which each mask is to be ANDed
  * @param mask_size_bits The number of bits to be ANDed in each mask
  * @param stream CUDA stream used for device memory operations and kernel launches
- * @param mr Device memory resource used to allocate the returned device_buffer
- * @return rmm::device_buffer Output bitmask
+ * @param mr Device memory resource used to allocate device memory
+ * @return The number of bits that are unset in @p dest_mask after the merge
  */
-void inplace_bitmask_and(
+size_type inplace_bitmask_and(
   device_span<bitmask_type> dest_mask,
   host_span<bitmask_type const*> masks,
   host_span<size_type const> masks_begin_bits,
@@ -51,5 +51,20 @@ std::unique_ptr<column> sequence(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::calendrical_month_sequence(size_type size, scalar const& init,
+ *                                           size_type months,
+ *                                           rmm::mr::device_memory_resource* mr =
+ *rmm::mr::get_current_device_resource())
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> calendrical_month_sequence(
+  size_type size,
+  scalar const& init,
+  size_type months,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace detail
 }  // namespace cudf
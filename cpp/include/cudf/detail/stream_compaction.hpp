@@ -61,6 +61,60 @@ std::unique_ptr<table> apply_boolean_mask(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::mask_to_indices
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> mask_to_indices(
+  column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::apply_boolean_mask_with_indices
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> apply_boolean_mask_with_indices(
+  table_view const& input,
+  column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::apply_boolean_mask_in_place
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+size_type apply_boolean_mask_in_place(table_view const& input,
+                                      column_view const& boolean_mask,
+                                      mutable_table_view& destination,
+                                      rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::batched_apply_boolean_mask
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::unique_ptr<table>> batched_apply_boolean_mask(
+  std::vector<table_view> const& inputs,
+  std::vector<column_view> const& boolean_masks,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::filter
+ *
+ * The intermediate boolean column is allocated from
+ * `cudf::get_temp_memory_resource()` and released before returning.
+ */
+std::unique_ptr<table> filter(
+  table_view const& input,
+  ast::expression const& predicate,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::drop_duplicates
  *
@@ -94,5 +148,31 @@ cudf::size_type distinct_count(table_view const& input,
                                null_equality nulls_equal    = null_equality::EQUAL,
                                rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
+/**
+ * @copydoc cudf::distinct_count_sketch
+ */
+std::unique_ptr<column> distinct_count_sketch(
+  table_view const& input,
+  int32_t precision                   = 12,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::approx_distinct_count(table_view const&, int32_t)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+cudf::size_type approx_distinct_count(table_view const& input,
+                                      int32_t precision            = 12,
+                                      rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::approx_distinct_count(column_view const&)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+cudf::size_type approx_distinct_count(column_view const& sketch,
+                                      rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 }  // namespace detail
 }  // namespace cudf
@@ -791,6 +791,184 @@ SparkMurmurHash3_32<double>::operator()(double const& key) const
   return this->compute_floating_point(key);
 }
 
+/**
+ * @brief  64-bit xxHash hash function.
+ *
+ * Produces a 64-bit hash value, unlike the other hashers in this file. Useful when hashing
+ * large key domains, where the collision probability of a 32-bit hash becomes significant.
+ */
+template <typename Key>
+struct XXHash_64 {
+  using argument_type = Key;
+  using result_type   = uint64_t;
+
+  XXHash_64() = default;
+  constexpr XXHash_64(uint64_t seed) : m_seed(seed) {}
+
+  CUDA_DEVICE_CALLABLE uint64_t rotl64(uint64_t x, int8_t r) const
+  {
+    return (x << r) | (x >> (64 - r));
+  }
+
+  CUDA_DEVICE_CALLABLE uint64_t fmix64(uint64_t h) const
+  {
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+  }
+
+  result_type CUDA_DEVICE_CALLABLE operator()(Key const& key) const { return compute(key); }
+
+  // compute wrapper for floating point types
+  template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  result_type CUDA_DEVICE_CALLABLE compute_floating_point(T const& key) const
+  {
+    if (key == T{0.0}) {
+      return compute(T{0.0});
+    } else if (isnan(key)) {
+      T nan = std::numeric_limits<T>::quiet_NaN();
+      return compute(nan);
+    } else {
+      return compute(key);
+    }
+  }
+
+  template <typename TKey>
+  result_type CUDA_DEVICE_CALLABLE compute(TKey const& key) const
+  {
+    return compute_bytes(reinterpret_cast<uint8_t const*>(&key), sizeof(TKey));
+  }
+
+  result_type CUDA_DEVICE_CALLABLE compute_bytes(uint8_t const* data, cudf::size_type len) const
+  {
+    // Individual byte reads for unaligned accesses (very likely)
+    auto getblock32 = [](uint8_t const* q) -> uint32_t {
+      return q[0] | (q[1] << 8) | (q[2] << 16) | (uint32_t{q[3]} << 24);
+    };
+    auto getblock64 = [&getblock32](uint8_t const* q) -> uint64_t {
+      return uint64_t{getblock32(q)} | (uint64_t{getblock32(q + 4)} << 32);
+    };
+
+    auto const nbytes = static_cast<uint64_t>(len);
+    uint64_t h64;
+    if (len >= 32) {
+      uint64_t v1 = m_seed + prime1 + prime2;
+      uint64_t v2 = m_seed + prime2;
+      uint64_t v3 = m_seed;
+      uint64_t v4 = m_seed - prime1;
+      do {
+        v1 = rotl64(v1 + getblock64(data) * prime2, 31) * prime1;
+        v2 = rotl64(v2 + getblock64(data + 8) * prime2, 31) * prime1;
+        v3 = rotl64(v3 + getblock64(data + 16) * prime2, 31) * prime1;
+        v4 = rotl64(v4 + getblock64(data + 24) * prime2, 31) * prime1;
+        data += 32;
+        len -= 32;
+      } while (len >= 32);
+      h64 = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+      h64 ^= rotl64(v1 * prime2, 31) * prime1;
+      h64 = h64 * prime1 + prime4;
+      h64 ^= rotl64(v2 * prime2, 31) * prime1;
+      h64 = h64 * prime1 + prime4;
+      h64 ^= rotl64(v3 * prime2, 31) * prime1;
+      h64 = h64 * prime1 + prime4;
+      h64 ^= rotl64(v4 * prime2, 31) * prime1;
+      h64 = h64 * prime1 + prime4;
+    } else {
+      h64 = m_seed + prime5;
+    }
+    h64 += nbytes;
+    while (len >= 8) {
+      h64 ^= rotl64(getblock64(data) * prime2, 31) * prime1;
+      h64 = rotl64(h64, 27) * prime1 + prime4;
+      data += 8;
+      len -= 8;
+    }
+    if (len >= 4) {
+      h64 ^= uint64_t{getblock32(data)} * prime1;
+      h64 = rotl64(h64, 23) * prime2 + prime3;
+      data += 4;
+      len -= 4;
+    }
+    while (len > 0) {
+      h64 ^= data[0] * prime5;
+      h64 = rotl64(h64, 11) * prime1;
+      ++data;
+      --len;
+    }
+    return fmix64(h64);
+  }
+
+ private:
+  static constexpr uint64_t prime1 = 0x9e3779b185ebca87ul;
+  static constexpr uint64_t prime2 = 0xc2b2ae3d27d4eb4ful;
+  static constexpr uint64_t prime3 = 0x165667b19e3779f9ul;
+  static constexpr uint64_t prime4 = 0x85ebca77c2b2ae63ul;
+  static constexpr uint64_t prime5 = 0x27d4eb2f165667c5ul;
+
+  uint64_t m_seed{cudf::DEFAULT_HASH_SEED};
+};
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE XXHash_64<bool>::operator()(bool const& key) const
+{
+  return this->compute(static_cast<uint8_t>(key));
+}
+
+/**
+ * @brief Specialization of XXHash_64 operator for strings.
+ */
+template <>
+uint64_t CUDA_DEVICE_CALLABLE
+XXHash_64<cudf::string_view>::operator()(cudf::string_view const& key) const
+{
+  return this->compute_bytes(reinterpret_cast<uint8_t const*>(key.data()), key.size_bytes());
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE XXHash_64<float>::operator()(float const& key) const
+{
+  return this->compute_floating_point(key);
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE XXHash_64<double>::operator()(double const& key) const
+{
+  return this->compute_floating_point(key);
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE
+XXHash_64<numeric::decimal32>::operator()(numeric::decimal32 const& key) const
+{
+  return this->compute(key.value());
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE
+XXHash_64<numeric::decimal64>::operator()(numeric::decimal64 const& key) const
+{
+  return this->compute(key.value());
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE
+XXHash_64<cudf::list_view>::operator()(cudf::list_view const& key) const
+{
+  cudf_assert(false && "List column hashing is not supported");
+  return 0;
+}
+
+template <>
+uint64_t CUDA_DEVICE_CALLABLE
+XXHash_64<cudf::struct_view>::operator()(cudf::struct_view const& key) const
+{
+  cudf_assert(false && "Direct hashing of struct_view is not supported");
+  return 0;
+}
+
 /**
  * @brief  This hash function simply returns the value that is asked to be hash
  * reinterpreted as the result_type of the functor.
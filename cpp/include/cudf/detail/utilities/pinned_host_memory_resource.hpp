@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <cstddef>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Memory resource that allocates pinned host memory addressable from the device.
+ *
+ * The returned pointers are page-locked host memory mapped into the unified virtual address
+ * space, so kernels can write through them directly. This lets device-to-host producers such as
+ * `contiguous_split` pack their output straight into host memory over PCIe/NVLink, skipping the
+ * separate device-to-host copy of the packed buffers.
+ *
+ * Pinned allocation is slow (it serializes the device), so this resource is intended for large,
+ * long-lived output buffers, not temporary allocations. Deallocation synchronizes the stream
+ * before unpinning since `cudaFreeHost` is not stream-ordered.
+ */
+class pinned_host_memory_resource final : public rmm::mr::device_memory_resource {
+ public:
+  pinned_host_memory_resource()                                   = default;
+  ~pinned_host_memory_resource() override                         = default;
+  pinned_host_memory_resource(pinned_host_memory_resource const&) = default;
+  pinned_host_memory_resource(pinned_host_memory_resource&&)      = default;
+  pinned_host_memory_resource& operator=(pinned_host_memory_resource const&) = default;
+  pinned_host_memory_resource& operator=(pinned_host_memory_resource&&) = default;
+
+  bool supports_streams() const noexcept override { return false; }
+  bool supports_get_mem_info() const noexcept override { return false; }
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view) override
+  {
+    if (bytes == 0) { return nullptr; }
+    void* ptr = nullptr;
+    CUDA_TRY(cudaHostAlloc(&ptr, bytes, cudaHostAllocDefault));
+    return ptr;
+  }
+
+  void do_deallocate(void* ptr, std::size_t, rmm::cuda_stream_view stream) override
+  {
+    if (ptr == nullptr) { return; }
+    // cudaFreeHost is not stream-ordered; wait for in-flight work that may touch the buffer
+    stream.synchronize_no_throw();
+    cudaFreeHost(ptr);
+  }
+
+  bool do_is_equal(rmm::mr::device_memory_resource const& other) const noexcept override
+  {
+    return dynamic_cast<pinned_host_memory_resource const*>(&other) != nullptr;
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(rmm::cuda_stream_view) const override
+  {
+    return std::make_pair(0, 0);
+  }
+};
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace dictionary {
+/**
+ * @addtogroup dictionary_encode
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Maintains a shared, append-only set of dictionary keys across
+ * repeated encode calls.
+ *
+ * Encoding independent batches with `cudf::dictionary::encode` rebuilds the
+ * key-set for every batch, and concatenating the results re-unifies the keys
+ * each time (`add_keys`/`set_keys`). When the same categories recur batch
+ * after batch this repeated work dominates. A `key_registry` amortizes it:
+ * keys are registered once and every subsequent `encode` call whose values
+ * are already registered reuses the existing key-set without rebuilding it.
+ *
+ * The registered key-set only ever grows. Appending new keys does not
+ * invalidate previously returned dictionary columns -- each one owns a copy
+ * of the key-set it was encoded against. When the key-set does grow, the
+ * registry caches the remap table from the prior key positions to the new
+ * ones so columns from the previous batch can be brought up to date with a
+ * single gather (see `remap`).
+ *
+ * @code{.pseudo}
+ * r = key_registry(type_id::STRING)
+ * d1 = r.encode(["a","c","a"])     // registers keys ["a","c"]
+ * d2 = r.encode(["c","a","c"])     // no new keys; key-set reused as-is
+ * d3 = r.encode(["b","a"])         // key-set grows to ["a","b","c"]
+ * d1 = r.remap(d1)                 // d1 now shares the current key-set
+ * @endcode
+ */
+class key_registry {
+ public:
+  key_registry()                    = delete;
+  key_registry(key_registry const&) = delete;
+  key_registry& operator=(key_registry const&) = delete;
+  key_registry(key_registry&&)                 = default;
+  key_registry& operator=(key_registry&&) = default;
+  ~key_registry()                         = default;
+
+  /**
+   * @brief Construct an empty registry for keys of the given type.
+   *
+   * @param keys_type The type of the keys to be registered.
+   */
+  explicit key_registry(data_type keys_type);
+
+  /**
+   * @brief Return the type of the registered keys.
+   */
+  data_type keys_type() const noexcept { return _keys_type; }
+
+  /**
+   * @brief Return the number of registered keys.
+   */
+  size_type size() const;
+
+  /**
+   * @brief Return a view of the registered keys.
+   *
+   * The keys are unique, non-null and sorted ascending. The view remains
+   * valid until the next call that grows the key-set.
+   */
+  column_view keys() const;
+
+  /**
+   * @brief Register any values from `new_keys` not already in the key-set.
+   *
+   * If every value is already registered this is a no-op: the key-set is
+   * left untouched and views previously returned by `keys()` remain valid.
+   * Otherwise the new values are merged in and the remap table from the
+   * prior key positions to the new ones is cached for `remap`.
+   *
+   * @throw cudf::logic_error if the new_keys type does not match the registry
+   *        keys type.
+   * @throw cudf::logic_error if the new_keys contain nulls.
+   *
+   * @param new_keys Candidate key values; need not be sorted or unique.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource used to allocate the updated key-set.
+   * @return Number of keys added to the registry.
+   */
+  size_type add_keys(
+    column_view const& new_keys,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Dictionary encode a column against the registered key-set.
+   *
+   * Any values not yet registered are first added via `add_keys`. The
+   * returned dictionary column owns a copy of the full key-set, so columns
+   * encoded by the same registry concatenate without key unification once
+   * brought to the same key-set size (see `remap`).
+   *
+   * The null_mask and null count are copied from the input column.
+   *
+   * @throw cudf::logic_error if the column type does not match the registry
+   *        keys type.
+   *
+   * @param column The column to dictionary encode.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource used to allocate the returned column's device memory.
+   * @return Dictionary column keyed by the registry's key-set.
+   */
+  std::unique_ptr<column> encode(
+    column_view const& column,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Re-key a dictionary column produced by this registry to the
+   * current key-set.
+   *
+   * Columns encoded against the key-set in place just before the most recent
+   * growth are remapped through the cached remap table with a single gather.
+   * Columns from older key-sets fall back to recomputing the map. Columns
+   * already on the current key-set are returned as a copy.
+   *
+   * @throw cudf::logic_error if the dictionary keys type does not match the
+   *        registry keys type.
+   *
+   * @param dictionary_column Dictionary column previously returned by `encode`.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource used to allocate the returned column's device memory.
+   * @return Equivalent dictionary column keyed by the current key-set.
+   */
+  std::unique_ptr<column> remap(
+    dictionary_column_view const& dictionary_column,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  data_type _keys_type;            ///< type of the registered keys
+  std::unique_ptr<column> _keys;   ///< sorted, unique, non-null key-set
+  std::unique_ptr<column> _remap;  ///< INT32 map of prior key positions to current ones
+  size_type _previous_size = 0;    ///< key-set size the cached remap maps from
+};
+
+/** @} */  // end of group
+}  // namespace dictionary
+}  // namespace cudf
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace execution {
+/**
+ * @addtogroup execution_plan
+ * @{
+ * @file
+ * @brief APIs for executing a graph of libcudf operators as one unit
+ */
+
+/**
+ * @brief Identifies a node within a `plan`.
+ */
+using node_id = size_type;
+
+/**
+ * @brief A DAG of relational operators scheduled and executed by libcudf as
+ * one unit.
+ *
+ * Driving libcudf operator-by-operator from the host serializes every step on
+ * one stream and keeps each intermediate result alive until the host gets
+ * around to releasing it. A `plan` instead describes the whole operator graph
+ * up front, which lets `execute` do what per-call APIs cannot:
+ *
+ * - Independent branches (e.g. the two inputs of a join) are issued on
+ *   different streams from the process-wide stream pool, with CUDA events
+ *   expressing the dependencies between them, so they can overlap on the
+ *   device.
+ * - Each intermediate table is released as soon as its last consumer has been
+ *   issued, after ordering the release behind the consumer's work, so peak
+ *   memory tracks the live working set instead of the whole query.
+ * - Adjacent operators are fused where their semantics allow: a chain of
+ *   filters whose intermediate results have no other consumer collapses into
+ *   a single filter over the conjunction of the predicates, and all
+ *   expressions of a projection are evaluated by one fused kernel.
+ *
+ * Nodes are added bottom-up; each `add_*` call may only reference nodes that
+ * were added before it, and the node added last is the root whose result
+ * `execute` returns. A plan may be executed any number of times; the source
+ * `table_view`s are resolved at each execution and must remain valid for the
+ * lifetime of the plan.
+ *
+ * @code{.cpp}
+ * cudf::execution::plan p;
+ * auto const orders = p.add_source(orders_table);
+ * auto const kept   = p.add_filter(orders, price_predicate);
+ * auto const keyed  = p.add_inner_join(kept, p.add_source(parts_table), {0}, {0});
+ * auto result       = p.execute();
+ * @endcode
+ */
+class plan {
+ public:
+  plan();
+  ~plan();
+  plan(plan const&) = delete;
+  plan& operator=(plan const&) = delete;
+
+  /**
+   * @brief Adds an input table to the plan.
+   *
+   * The view is resolved at each `execute` call; the data it references must
+   * remain valid for the lifetime of the plan.
+   *
+   * @param input The table this node produces
+   * @return Identifier of the new node
+   */
+  node_id add_source(table_view const& input);
+
+  /**
+   * @brief Adds a filter keeping the rows of `input` for which `predicate` is true.
+   *
+   * Evaluation matches `cudf::filter`: rows where the predicate is null are
+   * filtered out. The expression must remain valid for the lifetime of the
+   * plan. Chains of filters with no other consumers of the intermediate
+   * results are fused into a single pass.
+   *
+   * @param input Node whose result is filtered
+   * @param predicate Expression over the input's columns selecting the rows to keep
+   * @return Identifier of the new node
+   */
+  node_id add_filter(node_id input, ast::expression const& predicate);
+
+  /**
+   * @brief Adds a projection computing one column per expression over `input`.
+   *
+   * All expressions are evaluated by a single fused kernel, as in
+   * `cudf::compute_columns`. The expressions must remain valid for the
+   * lifetime of the plan.
+   *
+   * @param input Node whose result the expressions are evaluated over
+   * @param exprs The expressions producing the output columns, in output order
+   * @return Identifier of the new node
+   */
+  node_id add_project(node_id input,
+                      std::vector<std::reference_wrapper<ast::expression const>> exprs);
+
+  /**
+   * @brief Adds an inner join of two nodes on the given key columns.
+   *
+   * Result columns match `cudf::inner_join`: all columns of the left result
+   * followed by the non-key columns of the right result.
+   *
+   * @param left Node producing the left table
+   * @param right Node producing the right table
+   * @param left_on Key column indices into the left result
+   * @param right_on Key column indices into the right result
+   * @param compare_nulls Controls whether null join-key values match
+   * @return Identifier of the new node
+   */
+  node_id add_inner_join(node_id left,
+                         node_id right,
+                         std::vector<size_type> left_on,
+                         std::vector<size_type> right_on,
+                         null_equality compare_nulls = null_equality::EQUAL);
+
+  /**
+   * @brief Adds a groupby aggregation over `input`.
+   *
+   * The result contains the unique key columns followed by one column per
+   * aggregation, in request order. As with `groupby::groupby`, the order of
+   * the result rows is unspecified.
+   *
+   * @param input Node whose result is aggregated
+   * @param keys Column indices into the input result to group by
+   * @param aggregations Pairs of a value column index and the aggregation to
+   * apply to it
+   * @return Identifier of the new node
+   */
+  node_id add_aggregate(
+    node_id input,
+    std::vector<size_type> keys,
+    std::vector<std::pair<size_type, std::unique_ptr<groupby_aggregation>>> aggregations);
+
+  /**
+   * @brief Executes the plan and returns the result of the root node.
+   *
+   * The root is the node added last. Every other node must be an ancestor of
+   * the root.
+   *
+   * @throws cudf::logic_error if the plan is empty or contains a node whose
+   * result is never consumed.
+   *
+   * @param stream CUDA stream the root result is ordered on
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @return The result of the root node
+   */
+  std::unique_ptr<table> execute(
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+ private:
+  struct node;
+  std::vector<node> _nodes;
+};
+
+/** @} */  // end of group
+}  // namespace execution
+}  // namespace cudf
@@ -19,6 +19,7 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <utility>
 
 namespace cudf {
 /**
@@ -149,6 +150,34 @@ std::unique_ptr<table> repeat(
   size_type count,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Compresses runs of adjacent equal rows into one row plus a run length.
+ *
+ * This is the inverse of the column-count overload of `cudf::repeat`: the returned
+ * table holds the first row of each run and the returned column holds the length of
+ * that run, so `repeat(values, run_lengths)` reconstructs @p input.
+ * Example:
+ * ```
+ * in          = [4,5,5,6,6,6]
+ * values      = [4,5,6]
+ * run_lengths = [1,2,3]
+ * ```
+ * Null rows compare equal to each other, so runs of nulls compress like any other
+ * value. Rows are only compared with their immediate predecessor; equal but
+ * non-adjacent rows produce separate runs.
+ *
+ * Run-length-compressed data can be aggregated without ever expanding it via
+ * `cudf::groupby::run_length_sum`.
+ *
+ * @param input Table to compress
+ * @param mr Device memory resource used to allocate the returned table's and column's
+ * device memory
+ * @return A pair of the run values and a non-nullable column of the run lengths
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> run_length_encode(
+  table_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Fills a column with a sequence of value specified by an initial value and a step.
  *
@@ -162,6 +191,10 @@ std::unique_ptr<table> repeat(
  * step = 2
  * return = [0, 2, 4]
  * ```
+ * @note Internal code that only consumes the sequence on the device should prefer
+ * `cudf::detail::make_sequence_iterator`, which generates the values on the fly instead of
+ * materializing the column.
+ *
  * @throws cudf::logic_error if @p init and @p @step are not the same type.
  * @throws cudf::logic_error if scalar types are not numeric.
  * @throws cudf::logic_error if @p size is < 0.
@@ -203,5 +236,36 @@ std::unique_ptr<column> sequence(
   scalar const& init,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Generate a sequence of timestamps beginning at `init` and incrementing by `months`
+ * calendar months.
+ *
+ * Stepping is calendrical, not a fixed duration: element `i` is `init` advanced by
+ * `i * months` calendar months, and a day-of-month that does not exist in the resulting month
+ * is scaled back to the last day of that month, matching `cudf::datetime::add_calendrical_months`.
+ * The sequence is generated entirely on the device.
+ *
+ * ```
+ * size   = 3
+ * init   = 2020-01-31 (timestamp_D)
+ * months = 1
+ * return = [2020-01-31, 2020-02-29, 2020-03-31]
+ * ```
+ *
+ * @throws cudf::logic_error if @p init is not a timestamp scalar.
+ * @throws cudf::logic_error if @p size is < 0.
+ *
+ * @param size Size of the output column
+ * @param init First timestamp in the sequence
+ * @param months Number of months to increment by; may be negative
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Timestamp column of the same type as `init` containing the sequence
+ */
+std::unique_ptr<column> calendrical_month_sequence(
+  size_type size,
+  scalar const& init,
+  size_type months,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -407,6 +407,175 @@ class groupby {
     rmm::cuda_stream_view stream,
     rmm::mr::device_memory_resource* mr);
 };
+
+/**
+ * @brief Maintains running aggregates over a stream of table chunks.
+ *
+ * Each `update()` call aggregates one chunk and merges the per-group partial
+ * results into the retained state, so the cost of an update is proportional to
+ * the chunk size plus the number of groups rather than to all rows seen so
+ * far. `results()` returns the aggregates over every row passed to `update()`.
+ *
+ * Only aggregations whose partial results can be merged are supported: SUM,
+ * MIN, MAX, COUNT_VALID, and COUNT_ALL. COUNT results are produced as INT64,
+ * since partial counts are merged by summation.
+ */
+class streaming_groupby {
+ public:
+  streaming_groupby() = delete;
+  ~streaming_groupby();
+  streaming_groupby(streaming_groupby const&) = delete;
+  streaming_groupby(streaming_groupby&&)      = delete;
+  streaming_groupby& operator=(streaming_groupby const&) = delete;
+  streaming_groupby& operator=(streaming_groupby&&) = delete;
+
+  /**
+   * @brief Construct a streaming groupby object computing one aggregation per
+   * value column.
+   *
+   * @throw cudf::logic_error if any aggregation kind is not mergeable
+   *
+   * @param aggs The aggregation to apply to each value column of `update()`
+   * calls, in column order
+   * @param null_handling Indicates whether rows in the keys of `update()`
+   * calls that contain NULL values should be included
+   */
+  explicit streaming_groupby(std::vector<aggregation::Kind> const& aggs,
+                             null_policy null_handling = null_policy::EXCLUDE);
+
+  /**
+   * @brief Folds one chunk of data into the running aggregates.
+   *
+   * All chunks must have the same schema: `keys` and `values` must match the
+   * column types of previous calls, and `values` must have one column per
+   * aggregation requested at construction.
+   *
+   * @throw cudf::logic_error if `keys` and `values` differ in row count or
+   * `values` does not match the requested aggregations
+   *
+   * @param keys Table whose rows act as the groupby keys of this chunk
+   * @param values Table whose columns are aggregated per key
+   * @param mr Device memory resource used to allocate the retained state
+   */
+  void update(table_view const& keys,
+              table_view const& values,
+              rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns the current per-group keys and aggregate values.
+   *
+   * The group order is unspecified. Calling `results()` does not modify the
+   * retained state; subsequent `update()` calls continue to fold into it.
+   *
+   * @param mr Device memory resource used to allocate the returned tables
+   * @return A pair of the unique keys seen so far and their aggregate values
+   */
+  std::pair<std::unique_ptr<table>, std::unique_ptr<table>> results(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  std::vector<aggregation::Kind> _aggs;  ///< One aggregation per value column
+  null_policy _null_handling;            ///< Whether null keys are included
+  std::unique_ptr<table> _keys;          ///< Unique group keys seen so far
+  std::unique_ptr<table> _values;        ///< Partial aggregate per group
+};
+
+/**
+ * @brief Computes mergeable per-group partial states for a set of
+ * aggregations.
+ *
+ * Applies `aggs[i]` to `values.column(i)` grouped by `keys` and returns the
+ * group keys together with one partial-state column per value column. The
+ * partial states of several workers can be concatenated (keys with keys,
+ * states with states) and reduced to final aggregate values with
+ * `merge_aggregates`, so only per-group states need to move between workers
+ * instead of raw rows.
+ *
+ * The partial state depends on the aggregation:
+ * - SUM, PRODUCT, MIN, MAX, and SUM_OF_SQUARES keep their own result type
+ * - COUNT_VALID and COUNT_ALL produce INT64 counts
+ * - MEAN, M2, VARIANCE, and STD produce the structs column of
+ *   (COUNT_VALID, MEAN, M2) children consumed by the MERGE_M2 aggregation
+ * - COLLECT_LIST and COLLECT_SET produce the collected lists; duplicates of
+ *   COLLECT_SET are only dropped when merging, as with MERGE_SETS
+ *
+ * @throw cudf::logic_error if an aggregation has no mergeable partial state
+ * or `values` does not have one column per aggregation
+ *
+ * @param keys Table whose rows act as the groupby keys
+ * @param values Table whose columns are aggregated per key
+ * @param aggs The aggregation to apply to each value column, in column order
+ * @param null_handling Indicates whether rows in `keys` that contain NULL
+ * values should be included
+ * @param mr Device memory resource used to allocate the returned tables
+ * @return A pair of the unique group keys and their partial aggregate states
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<table>> partial_aggregate(
+  table_view const& keys,
+  table_view const& values,
+  std::vector<aggregation::Kind> const& aggs,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Merges concatenated partial aggregate states into final aggregate
+ * values.
+ *
+ * `keys` and `partials` are the (vertically concatenated) outputs of
+ * `partial_aggregate` calls made with the same `aggs`, typically one call per
+ * worker. Groups that appear in several partial results are combined as if
+ * their input rows had been aggregated together. Null keys are preserved;
+ * filtering them is the responsibility of the `partial_aggregate` stage.
+ *
+ * @throw cudf::logic_error if `partials` does not have one column per
+ * aggregation
+ *
+ * @param keys Concatenated group keys from `partial_aggregate` outputs
+ * @param partials Concatenated partial states from `partial_aggregate`
+ * outputs
+ * @param aggs The aggregations the partial states were produced for
+ * @param mr Device memory resource used to allocate the returned tables
+ * @return A pair of the merged group keys and the final aggregate values
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<table>> merge_aggregates(
+  table_view const& keys,
+  table_view const& partials,
+  std::vector<aggregation::Kind> const& aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes per-group sums of run-length-encoded values without
+ * expanding the runs.
+ *
+ * Row `i` of `keys` and `values` stands for `run_lengths[i]` identical rows,
+ * as produced by `cudf::run_length_encode`. The result matches a groupby SUM
+ * over the expanded rows: each value is weighted by its run length in the SUM
+ * result type and the weighted runs are summed per key, so only one row per
+ * run is ever materialized. A null value row contributes nothing to its
+ * group's sum, exactly as its expanded rows would.
+ *
+ * A run length of zero contributes zero but its key still appears in the
+ * output, whereas after expansion the key would be absent.
+ *
+ * @throw cudf::logic_error if `keys`, `values`, and `run_lengths` do not have
+ * the same number of rows
+ * @throw cudf::logic_error if `run_lengths` is not of an integral type or
+ * contains nulls
+ *
+ * @param keys Table whose rows act as the groupby keys, one row per run
+ * @param values Table whose columns are summed per key, one row per run
+ * @param run_lengths Non-nullable integral column of the length of each run
+ * @param null_handling Indicates whether rows in `keys` that contain NULL
+ * values should be included
+ * @param mr Device memory resource used to allocate the returned tables
+ * @return A pair of the unique group keys and one sum column per value column
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<table>> run_length_sum(
+  table_view const& keys,
+  table_view const& values,
+  column_view const& run_lengths,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 /** @} */
 }  // namespace groupby
 }  // namespace cudf
@@ -29,6 +29,9 @@ namespace cudf {
 /**
  * @brief Computes the hash value of each row in the input set of columns.
  *
+ * The returned column holds 32-bit hash values, except for `hash_id::HASH_MD5` (string digests)
+ * and `hash_id::HASH_XXHASH64` (64-bit hash values).
+ *
  * @param input The table of columns to hash
  * @param initial_hash Optional host_span of initial hash values for each column.
  * If this span is empty then each element will be hashed as-is.
@@ -43,5 +46,29 @@ std::unique_ptr<column> hash(
   uint32_t seed                                = DEFAULT_HASH_SEED,
   rmm::mr::device_memory_resource* mr          = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes a 64-bit content fingerprint of a table.
+ *
+ * The digest covers the table's shape (column count, row count, and each
+ * column's type) and the value and validity of every element, computed
+ * through the same xxhash64 row hashing `cudf::hash` uses. Equal tables
+ * produce equal checksums; any difference in schema, row order or content
+ * changes the checksum with overwhelming probability. Intended as a cache
+ * key for content-addressed result caches, where it replaces a full table
+ * comparison per lookup with a 64-bit compare.
+ *
+ * The fingerprint is computed from the data the view references at the time
+ * of the call; a `table_view` does not own or version its buffers, so
+ * callers caching checksums must invalidate them when the underlying data is
+ * mutated.
+ *
+ * @throws cudf::logic_error if any column is of a nested type
+ *
+ * @param input The table to fingerprint
+ * @param seed Optional seed value folded into the digest
+ * @return 64-bit fingerprint of the table's schema and contents
+ */
+uint64_t table_checksum(table_view const& input, uint64_t seed = 0);
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <memory>
+#include <utility>
+
+namespace cudf {
+
+/**
+ * @addtogroup column_histogram
+ * @{
+ * @file
+ * @brief Column APIs for histograms and value counts
+ */
+
+/**
+ * @brief Counts how many elements of `input` fall into each bin defined by `bin_edges`.
+ *
+ * Bin `i` covers the interval `[bin_edges[i], bin_edges[i + 1])`; the last bin additionally
+ * includes its right edge, matching the conventions of NumPy's `histogram`. The counts are
+ * computed in a single pass over `input` using per-block shared memory counters, rather than
+ * labeling, grouping, and sorting in separate passes.
+ *
+ * Null and NaN elements and elements lying outside `[bin_edges.front(), bin_edges.back()]`
+ * are not counted. Edges must be sorted in increasing order, otherwise behavior is undefined.
+ *
+ * @throws cudf::logic_error if `input.type() != bin_edges.type()`.
+ * @throws cudf::logic_error if `input` is not of a numeric, timestamp, or duration type.
+ * @throws cudf::logic_error if `bin_edges` has fewer than two elements or contains nulls.
+ *
+ * @param input Column of values to count
+ * @param bin_edges Sorted column of `bin_edges.size() - 1` bin boundaries
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Non-nullable column of `bin_edges.size() - 1` counts, one per bin
+ */
+std::unique_ptr<column> histogram(
+  column_view const& input,
+  column_view const& bin_edges,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Counts the elements of `input` into `num_bins` equal-width bins spanning its range.
+ *
+ * The bin edges are `num_bins + 1` FLOAT64 values evenly spaced between the minimum and
+ * maximum of `input`, and the values are counted against them as in the `bin_edges` overload.
+ * If `input` is empty, entirely null, or constant, the edges span `[minimum, minimum + 1)`
+ * so that every valid element lands in the first bin.
+ *
+ * @throws cudf::logic_error if `input` is not of a numeric type.
+ * @throws cudf::logic_error if `num_bins` is not positive.
+ *
+ * @param input Column of values to count
+ * @param num_bins Number of equal-width bins to divide the value range into
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return A pair of the FLOAT64 bin edges and the count in each bin
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> histogram(
+  column_view const& input,
+  size_type num_bins,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the distinct elements of `input` and the number of times each occurs.
+ *
+ * The element order of the result is unspecified. Intended for profiling low-cardinality
+ * columns, where the result is far smaller than the input.
+ *
+ * @param input Column of values to count
+ * @param null_handling Indicates whether a count is produced for null elements
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return A pair of the distinct values and their occurrence counts
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> value_counts(
+  column_view const& input,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
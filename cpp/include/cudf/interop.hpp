@@ -75,6 +75,44 @@ DLManagedTensor* to_dlpack(
   table_view const& input,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Convert a cudf column into a 1D DLPack DLTensor view
+ *
+ * Unlike `to_dlpack`, no data is copied: the tensor points directly at the
+ * column's device buffer. The caller must keep the column's memory alive for
+ * the lifetime of the tensor; the `deleter` only frees the tensor metadata.
+ * The column type must be numeric and the null count must be zero. If the
+ * column has zero rows the result will be nullptr.
+ *
+ * @throw cudf::logic_error if the data type is not numeric or the column has
+ * a non-zero null count
+ *
+ * @param input Column to view through DLPack
+ * @return 1D DLPack tensor sharing the column's device buffer, or nullptr
+ */
+DLManagedTensor* to_dlpack_view(column_view const& input);
+
+/**
+ * @brief Convert a cudf table into a strided 2D DLPack DLTensor view
+ *
+ * Zero-copy counterpart of `to_dlpack`. In addition to the `to_dlpack`
+ * requirements (same numeric type for all columns, zero null counts), the
+ * columns must be equally spaced in device memory — e.g. a table imported with
+ * `from_dlpack` or unpacked from a contiguous buffer — since a single strided
+ * tensor cannot view independently allocated columns. The caller must keep the
+ * table's memory alive for the lifetime of the tensor; the `deleter` only
+ * frees the tensor metadata. If the input table is empty or has zero rows, the
+ * result will be nullptr.
+ *
+ * @throw cudf::logic_error if the data types are not equal or not numeric, if
+ * any of the columns have a non-zero null count, or if the columns are not
+ * uniformly strided in device memory
+ *
+ * @param input Table to view through DLPack
+ * @return 1D or 2D DLPack tensor sharing the table's device memory, or nullptr
+ */
+DLManagedTensor* to_dlpack_view(table_view const& input);
+
 /** @} */  // end of group
 
 /**
@@ -126,5 +164,45 @@ std::unique_ptr<table> from_arrow(
   arrow::Table const& input,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create `arrow::Table` that shares the device memory of cudf table `input`
+ *
+ * Unlike `to_arrow`, no data is copied: each arrow buffer points directly at the
+ * device memory of `input` and shares ownership of the table, so the device memory
+ * stays valid until every arrow reference is released. The buffers are device
+ * memory and must only be handed to consumers that expect CUDA buffers; reading
+ * them from the host requires an explicit copy.
+ *
+ * Only fixed-width types whose arrow layout matches cudf and strings are
+ * supported. `BOOL8` columns cannot be shared because arrow represents booleans
+ * as packed bits, and fixed-point and nested columns cannot be shared because
+ * their layouts differ.
+ *
+ * @throws cudf::logic_error if `metadata` size doesn't match number of columns or a
+ * column type cannot be shared without conversion.
+ *
+ * @param input table to export; the returned arrow Table shares ownership of it
+ * @param metadata Contains hierarchy of names of columns
+ * @return arrow Table viewing the device memory of `input`
+ */
+std::shared_ptr<arrow::Table> to_arrow_device(std::shared_ptr<table> input,
+                                              std::vector<column_metadata> const& metadata = {});
+
+/**
+ * @brief Create `cudf::table_view` over the device memory of given arrow Table input
+ *
+ * Zero-copy counterpart of `from_arrow`: the arrow buffers must already reference
+ * device-accessible memory, such as a table produced by `to_arrow_device`, and
+ * each column must consist of a single chunk. The returned view does not own the
+ * memory, so `input` must be kept alive for as long as the view is in use.
+ *
+ * @throws cudf::logic_error if a column has more than one chunk or its type cannot
+ * be shared without conversion.
+ *
+ * @param input arrow:Table whose buffers reference device memory
+ * @return cudf table_view viewing the device memory of `input`
+ */
+table_view from_arrow_device(arrow::Table const& input);
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/io/detail/csv.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -77,6 +78,8 @@ class csv_reader_options {
   size_type _skipfooter = 0;
   // Header row index
   size_type _header = 0;
+  // Maximum number of rows to sample for type inference; -1 is all rows
+  size_type _num_inference_rows = -1;
 
   // Parsing settings
 
@@ -255,6 +258,11 @@ class csv_reader_options {
    */
   size_type get_header() const { return _header; }
 
+  /**
+   * @brief Returns maximum number of rows to sample for type inference.
+   */
+  size_type get_num_inference_rows() const { return _num_inference_rows; }
+
   /**
    * @brief Returns line terminator.
    */
@@ -506,6 +514,23 @@ class csv_reader_options {
    */
   void set_header(size_type hdr) { _header = hdr; }
 
+  /**
+   * @brief Sets maximum number of rows to sample for type inference.
+   *
+   * When set, data types are inferred from (at most) this many rows, taken as contiguous blocks
+   * spread evenly across the input, instead of from every row. Sampling trades inference accuracy
+   * for speed: a type that only occurs outside of the sampled rows is not detected, so the
+   * affected values parse as null (or the read fails). Has no effect when the data types are
+   * specified explicitly.
+   *
+   * @param nrows Maximum number of rows to sample; -1: use all rows.
+   */
+  void set_num_inference_rows(size_type nrows)
+  {
+    CUDF_EXPECTS(nrows == -1 or nrows > 0, "Invalid number of rows to sample for type inference");
+    _num_inference_rows = nrows;
+  }
+
   /**
    * @brief Sets line terminator
    *
@@ -855,6 +880,18 @@ class csv_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets maximum number of rows to sample for type inference.
+   *
+   * @param nrows Maximum number of rows to sample; -1: use all rows.
+   * @return this for chaining.
+   */
+  csv_reader_options_builder& num_inference_rows(size_type nrows)
+  {
+    options.set_num_inference_rows(nrows);
+    return *this;
+  }
+
   /**
    * @brief Sets header row index.
    *
@@ -1200,6 +1237,80 @@ table_with_metadata read_csv(
   csv_reader_options options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked CSV reader class to read a CSV dataset in batches of rows.
+ *
+ * Unlike `read_csv()`, which materializes every selected row into a single table, this reader
+ * returns the dataset as a sequence of tables of (at most) a user-specified number of rows each.
+ * The input is read, decompressed and tokenized once, at construction; the row-offset index and
+ * the inferred (or user-specified) column types are cached and reused for every chunk, so only
+ * the row-to-column conversion is repeated per batch:
+ * @code
+ *  auto reader = cudf::io::chunked_csv_reader(rows_per_chunk, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    // Process chunk
+ *  }
+ * @endcode
+ */
+class chunked_csv_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  chunked_csv_reader() = default;
+
+  /**
+   * @brief Constructor for the chunked reader.
+   *
+   * This constructor reads and tokenizes the input upfront: the data selected by the options
+   * (byte range, skipped rows, row count limit) is kept on the GPU along with the gathered row
+   * offsets and the column types for the lifetime of the reader.
+   *
+   * @param rows_per_chunk Number of rows to return per read
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_csv_reader(
+    size_type rows_per_chunk,
+    csv_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_csv_reader();
+
+  /**
+   * @brief Check if there is any data in the given file has not yet read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Read a chunk of rows in the given CSV file.
+   *
+   * The sequence of returned tables, if concatenated by their order, guarantees to form a complete
+   * dataset as reading the entire given file at once.
+   *
+   * An empty table will be returned if the given file is empty, or all the data in the file has
+   * been read and returned by the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::csv::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
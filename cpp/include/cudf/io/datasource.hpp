@@ -101,6 +101,23 @@ class datasource {
    */
   static std::unique_ptr<datasource> create(datasource* source);
 
+  /**
+   * @brief Creates a source that serves reads from an LRU cache of pinned memory blocks.
+   *
+   * Reads are rounded out to `block_size`-sized blocks that are kept in pinned host memory until
+   * evicted, so repeated reads of hot ranges (e.g. footers and metadata of frequently read files)
+   * do not touch the wrapped source. Cache hits that fit in a single block are returned without a
+   * copy; reads into device memory are copied directly from the pinned blocks. Most beneficial
+   * when the wrapped source has high read latency and the same ranges are read repeatedly.
+   *
+   * @param[in] source The source whose reads are cached; owned by the returned object
+   * @param[in] max_cache_size Maximum amount of pinned memory used for cache blocks, in bytes
+   * @param[in] block_size Size of each cache block, in bytes
+   */
+  static std::unique_ptr<datasource> create_cached(std::unique_ptr<datasource> source,
+                                                   size_t max_cache_size = 256 << 20,
+                                                   size_t block_size     = 1 << 20);
+
   /**
    * @brief Creates a vector of datasources, one per element in the input vector.
    *
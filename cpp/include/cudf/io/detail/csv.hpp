@@ -16,19 +16,30 @@
 
 #pragma once
 
-#include <cudf/io/csv.hpp>
+#include <cudf/io/types.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <memory>
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace io {
+
+// Forward declaration
+class csv_reader_options;
+class csv_writer_options;
+
 namespace detail {
 namespace csv {
 /**
  * @brief Class to read CSV dataset data into columns.
  */
 class reader {
- private:
+ protected:
   class impl;
   std::unique_ptr<impl> _impl;
 
@@ -74,6 +85,43 @@ class reader {
   table_with_metadata read(rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 };
 
+/**
+ * @brief The reader class that supports iterative reading of a given file.
+ *
+ * This class intentionally subclasses the `reader` class with private inheritance to hide the
+ * `reader::read()` API. As such, only chunked reading APIs are supported.
+ */
+class chunked_reader : private reader {
+ public:
+  /**
+   * @copydoc cudf::io::chunked_csv_reader::chunked_csv_reader(size_type,
+   * csv_reader_options const&, rmm::mr::device_memory_resource*)
+   *
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  explicit chunked_reader(size_type rows_per_chunk,
+                          std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                          csv_reader_options const& options,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_reader();
+
+  /**
+   * @copydoc cudf::io::chunked_csv_reader::has_next
+   */
+  bool has_next() const;
+
+  /**
+   * @copydoc cudf::io::chunked_csv_reader::read_chunk
+   */
+  table_with_metadata read_chunk() const;
+};
+
 class writer {
  public:
   class impl;
@@ -69,12 +69,17 @@ class json_reader_options {
 
   // Data types of the column; empty to infer dtypes
   std::variant<std::vector<data_type>, std::map<std::string, data_type>> _dtypes;
+  // Names of columns to read; empty is all columns
+  std::vector<std::string> _use_cols_names;
   // Specify the compression format of the source or infer from file extension
   compression_type _compression = compression_type::AUTO;
 
   // Read the file as a json object per line
   bool _lines = false;
 
+  // Parse fields of nested objects as separate columns, named after the key path
+  bool _flatten_nested_objects = false;
+
   // Bytes to skip from the start
   size_t _byte_range_offset = 0;
   // Bytes to read; always reads complete rows
@@ -121,6 +126,11 @@ class json_reader_options {
     return _dtypes;
   }
 
+  /**
+   * @brief Returns names of the columns to be read.
+   */
+  std::vector<std::string> const& get_use_cols_names() const { return _use_cols_names; }
+
   /**
    * @brief Returns compression format of the source.
    */
@@ -173,6 +183,11 @@ class json_reader_options {
    */
   bool is_enabled_lines() const { return _lines; }
 
+  /**
+   * @brief Whether to parse fields of nested objects as separate columns.
+   */
+  bool is_enabled_flatten_nested_objects() const { return _flatten_nested_objects; }
+
   /**
    * @brief Whether to parse dates as DD/MM versus MM/DD.
    */
@@ -192,6 +207,20 @@ class json_reader_options {
    */
   void set_dtypes(std::map<std::string, data_type> types) { _dtypes = std::move(types); }
 
+  /**
+   * @brief Set names of the columns to be read.
+   *
+   * Values of keys that are not selected are not parsed, which avoids the conversion work for the
+   * unused columns. Names that are not present in the input are ignored. Only supported when rows
+   * are JSON objects.
+   *
+   * @param col_names Vector of column names.
+   */
+  void set_use_cols_names(std::vector<std::string> col_names)
+  {
+    _use_cols_names = std::move(col_names);
+  }
+
   /**
    * @brief Set the compression type.
    *
@@ -220,6 +249,17 @@ class json_reader_options {
    */
   void enable_lines(bool val) { _lines = val; }
 
+  /**
+   * @brief Set whether to parse fields of nested objects as separate columns.
+   *
+   * When enabled, the fields of object values are read into separate columns, named after the key
+   * path with a period as the separator (e.g. "parent.child"). Only one level of nesting is
+   * flattened; values nested deeper are returned as strings containing the unparsed input.
+   *
+   * @param val Boolean value to enable/disable the flattening of nested objects.
+   */
+  void enable_flatten_nested_objects(bool val) { _flatten_nested_objects = val; }
+
   /**
    * @brief Set whether to parse dates as DD/MM versus MM/DD.
    *
@@ -270,6 +310,18 @@ class json_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Set names of the columns to be read.
+   *
+   * @param col_names Vector of column names.
+   * @return this for chaining.
+   */
+  json_reader_options_builder& use_cols_names(std::vector<std::string> col_names)
+  {
+    options._use_cols_names = std::move(col_names);
+    return *this;
+  }
+
   /**
    * @brief Set the compression type.
    *
@@ -318,6 +370,18 @@ class json_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Set whether to parse fields of nested objects as separate columns.
+   *
+   * @param val Boolean value to enable/disable the flattening of nested objects.
+   * @return this for chaining.
+   */
+  json_reader_options_builder& flatten_nested_objects(bool val)
+  {
+    options._flatten_nested_objects = val;
+    return *this;
+  }
+
   /**
    * @brief Set whether to parse dates as DD/MM versus MM/DD.
    *
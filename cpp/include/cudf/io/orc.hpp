@@ -16,12 +16,14 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/io/detail/orc.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -50,6 +52,8 @@ class orc_reader_options {
 
   // List of individual stripes to read (ignored if empty)
   std::vector<std::vector<size_type>> _stripes;
+  // Optional AST expression used to prune stripes via their statistics
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
   // Rows to skip from the start;
   size_type _skip_rows = 0;
   // Rows to read; -1 is all
@@ -106,6 +110,11 @@ class orc_reader_options {
    */
   std::vector<std::vector<size_type>> const& get_stripes() const { return _stripes; }
 
+  /**
+   * @brief Returns the AST expression to be used to filter stripes, if set.
+   */
+  auto const& get_filter() const { return _filter; }
+
   /**
    * @brief Returns number of rows to skip from the start.
    */
@@ -160,6 +169,19 @@ class orc_reader_options {
     _stripes = std::move(stripes);
   }
 
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * Stripes whose column statistics prove that no row can satisfy the expression are skipped
+   * before any device read. The expression must reference columns of the table being read (by
+   * index into the selected output columns) and may only rely on operations that can be evaluated
+   * against min/max statistics; unsupported (sub)expressions conservatively keep the stripe. The
+   * expression must not outlive these options.
+   *
+   * @param filter AST expression to use as filter.
+   */
+  void set_filter(ast::expression const& filter) { _filter = filter; }
+
   /**
    * @brief Sets number of rows to skip from the start.
    *
@@ -256,6 +278,18 @@ class orc_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets AST based filter for stripe predicate pushdown.
+   *
+   * @param filter AST expression to use as filter.
+   * @return this for chaining.
+   */
+  orc_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
   /**
    * @brief Sets number of rows to skip from the start.
    *
@@ -364,6 +398,78 @@ table_with_metadata read_orc(
   orc_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked ORC reader class to read an ORC dataset in chunks.
+ *
+ * Unlike `read_orc()`, which materializes every selected stripe into a single table, this reader
+ * returns the dataset as a sequence of tables, each assembled from (at most) a user-specified
+ * number of whole stripes. The file footers are parsed and the sources are opened once, at
+ * construction, and reused for every chunk:
+ * @code
+ *  auto reader = cudf::io::chunked_orc_reader(stripes_per_chunk, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    // Process chunk
+ *  }
+ * @endcode
+ */
+class chunked_orc_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  chunked_orc_reader() = default;
+
+  /**
+   * @brief Constructor for the chunked reader.
+   *
+   * This constructor parses the dataset metadata and splits the selected stripes into chunks of
+   * `stripes_per_chunk` stripes each (the last chunk may hold fewer stripes).
+   *
+   * @param stripes_per_chunk Number of stripes to return per read
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_orc_reader(
+    size_type stripes_per_chunk,
+    orc_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_orc_reader();
+
+  /**
+   * @brief Check if there is any data in the given file has not yet read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Read a chunk of stripes in the given ORC file.
+   *
+   * The sequence of returned tables, if concatenated by their order, guarantees to form a complete
+   * dataset as reading the entire given file at once.
+   *
+   * An empty table will be returned if the given file is empty, or all the data in the file has
+   * been read and returned by the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::orc::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/io/detail/parquet.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
@@ -26,6 +27,7 @@
 
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -53,6 +55,8 @@ class parquet_reader_options {
 
   // List of individual row groups to read (ignored if empty)
   std::vector<std::vector<size_type>> _row_groups;
+  // Predicate filter as AST to filter row groups based on column chunk statistics
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
   // Number of rows to skip from the start
   size_type _skip_rows = 0;
   // Number of rows to read; -1 is all
@@ -60,8 +64,12 @@ class parquet_reader_options {
 
   // Whether to store string data as categorical type
   bool _convert_strings_to_categories = false;
+  // Whether to return string data as dictionary columns, preserving the file's dictionaries
+  bool _convert_strings_to_dictionaries = false;
   // Whether to use PANDAS metadata to load columns
   bool _use_pandas_metadata = true;
+  // Whether to reuse parsed footers from the process-wide cache for repeatedly scanned files
+  bool _use_footer_cache = false;
   // Cast timestamp columns to a specific type
   data_type _timestamp_type{type_id::EMPTY};
 
@@ -105,11 +113,26 @@ class parquet_reader_options {
    */
   bool is_enabled_convert_strings_to_categories() const { return _convert_strings_to_categories; }
 
+  /**
+   * @brief Returns true/false depending on whether string columns should be returned as
+   * dictionary columns built from the file's dictionary pages.
+   */
+  bool is_enabled_convert_strings_to_dictionaries() const
+  {
+    return _convert_strings_to_dictionaries;
+  }
+
   /**
    * @brief Returns true/false depending whether to use pandas metadata or not while reading.
    */
   bool is_enabled_use_pandas_metadata() const { return _use_pandas_metadata; }
 
+  /**
+   * @brief Returns true/false depending on whether parsed footer metadata may be reused from
+   * the process-wide cache.
+   */
+  bool is_enabled_use_footer_cache() const { return _use_footer_cache; }
+
   /**
    * @brief Returns number of rows to skip from the start.
    */
@@ -130,6 +153,11 @@ class parquet_reader_options {
    */
   std::vector<std::vector<size_type>> const& get_row_groups() const { return _row_groups; }
 
+  /**
+   * @brief Returns the AST expression to be used to filter row groups, if set.
+   */
+  auto const& get_filter() const { return _filter; }
+
   /**
    * @brief Returns timestamp type used to cast timestamp columns.
    */
@@ -162,6 +190,19 @@ class parquet_reader_options {
     _row_groups = std::move(row_groups);
   }
 
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * Row groups whose column chunk statistics prove that no row can satisfy the expression are
+   * skipped before any device read. The expression must reference columns of the table being read
+   * (by index into the selected output columns) and may only rely on operations that can be
+   * evaluated against min/max statistics; unsupported (sub)expressions conservatively keep the
+   * row group. The expression must not outlive these options.
+   *
+   * @param filter AST expression to use as filter.
+   */
+  void set_filter(ast::expression const& filter) { _filter = filter; }
+
   /**
    * @brief Sets to enable/disable conversion of strings to categories.
    *
@@ -169,6 +210,16 @@ class parquet_reader_options {
    */
   void enable_convert_strings_to_categories(bool val) { _convert_strings_to_categories = val; }
 
+  /**
+   * @brief Sets to enable/disable returning string columns as dictionary columns.
+   *
+   * @param val Boolean value to enable/disable reading string columns as dictionary columns.
+   */
+  void enable_convert_strings_to_dictionaries(bool val)
+  {
+    _convert_strings_to_dictionaries = val;
+  }
+
   /**
    * @brief Sets to enable/disable use of pandas metadata to read.
    *
@@ -176,6 +227,16 @@ class parquet_reader_options {
    */
   void enable_use_pandas_metadata(bool val) { _use_pandas_metadata = val; }
 
+  /**
+   * @brief Sets to enable/disable reuse of parsed footer metadata from the process-wide cache.
+   *
+   * Cache entries are keyed on the file's path, modification time and size, so files that are
+   * rewritten in place are parsed again. Only applies to filepath sources.
+   *
+   * @param val Boolean value whether to use the footer metadata cache.
+   */
+  void enable_use_footer_cache(bool val) { _use_footer_cache = val; }
+
   /**
    * @brief Sets number of rows to skip.
    *
@@ -262,6 +323,18 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * @param filter AST expression to use as filter.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
   /**
    * @brief Sets enable/disable conversion of strings to categories.
    *
@@ -274,6 +347,22 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets enable/disable returning string columns as dictionary columns.
+   *
+   * The dictionaries are built from the file's dictionary pages, skipping full string
+   * materialization. Requires the selection to consist of a single, fully
+   * dictionary-encoded row group of flat columns.
+   *
+   * @param val Boolean value to enable/disable reading string columns as dictionary columns.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& convert_strings_to_dictionaries(bool val)
+  {
+    options._convert_strings_to_dictionaries = val;
+    return *this;
+  }
+
   /**
    * @brief Sets to enable/disable use of pandas metadata to read.
    *
@@ -286,6 +375,18 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets to enable/disable reuse of parsed footer metadata from the process-wide cache.
+   *
+   * @param val Boolean value whether to use the footer metadata cache.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& use_footer_cache(bool val)
+  {
+    options._use_footer_cache = val;
+    return *this;
+  }
+
   /**
    * @brief Sets number of rows to skip.
    *
@@ -367,6 +468,81 @@ table_with_metadata read_parquet(
   parquet_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked parquet reader class to read a Parquet dataset in chunks.
+ *
+ * Unlike `read_parquet()`, which materializes every selected row group into a single table, this
+ * reader returns the dataset as a sequence of tables, each assembled from as many whole row
+ * groups as fit under a user-specified byte budget. The file footer is parsed and the sources are
+ * opened once, at construction, and reused for every chunk:
+ * @code
+ *  auto reader = cudf::io::chunked_parquet_reader(bytes_budget, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    // Process chunk
+ *  }
+ * @endcode
+ */
+class chunked_parquet_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  chunked_parquet_reader() = default;
+
+  /**
+   * @brief Constructor for the chunked reader.
+   *
+   * This constructor parses the dataset metadata and splits the selected row groups into chunks
+   * such that the total uncompressed size of each chunk does not exceed `chunk_read_limit`
+   * (a chunk always contains at least one row group, thus it may exceed the limit if a single
+   * row group is larger than the given value).
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   *        or `0` if there is no limit
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_parquet_reader(
+    std::size_t chunk_read_limit,
+    parquet_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_parquet_reader();
+
+  /**
+   * @brief Check if there is any data in the given file has not yet read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Read a chunk of rows in the given Parquet file.
+   *
+   * The sequence of returned tables, if concatenated by their order, guarantees to form a complete
+   * dataset as reading the entire given file at once.
+   *
+   * An empty table will be returned if the given file is empty, or all the data in the file has
+   * been read and returned by the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::parquet::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
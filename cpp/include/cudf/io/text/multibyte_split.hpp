@@ -32,6 +32,30 @@ std::unique_ptr<cudf::column> multibyte_split(
   std::string const& delimiter,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Splits the source text on the delimiter, returning only the rows owned by a byte range.
+ *
+ * A row is owned by the byte range which contains the row's first byte. A row which begins within
+ * the range but ends past it is still returned in full, i.e: the split scans past the end of the
+ * range to the next delimiter to resolve the seam. Splitting a source over contiguous,
+ * non-overlapping byte ranges therefore produces the same rows as a whole-source split, with each
+ * row appearing in exactly one range's output. This allows a single large source to be partitioned
+ * across multiple devices without pre-splitting it on the host.
+ *
+ * @param source The source text to split
+ * @param delimiter UTF-8 encoded string for which to find offsets in the source
+ * @param byte_range_offset Offset of the first byte of the range, in bytes
+ * @param byte_range_size Size of the range, in bytes; use `0` for all remaining data
+ * @param mr Memory resource to use for the device memory allocation
+ * @return The rows of the source text which begin within the byte range
+ */
+std::unique_ptr<cudf::column> multibyte_split(
+  data_chunk_source const& source,
+  std::string const& delimiter,
+  std::size_t byte_range_offset,
+  std::size_t byte_range_size,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace text
 }  // namespace io
 }  // namespace cudf
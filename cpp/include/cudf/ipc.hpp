@@ -1,8 +1,15 @@
+#include <cudf/copying.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
 #include <arrow/api.h>
 #include <arrow/gpu/cuda_api.h>
 #include <arrow/io/memory.h>
 #include <arrow/ipc/api.h>
 
+#include <cuda_runtime_api.h>
+
 class CudaMessageReader : arrow::ipc::MessageReader {
  public:
   CudaMessageReader(arrow::cuda::CudaBufferReader* stream, arrow::io::BufferReader* schema);
@@ -17,3 +24,85 @@ class CudaMessageReader : arrow::ipc::MessageReader {
   arrow::io::BufferReader* host_schema_reader_ = nullptr;
   std::shared_ptr<arrow::cuda::CudaBufferReader> owned_stream_;
 };
+
+namespace cudf {
+
+/**
+ * @brief A table exported for zero-copy sharing with co-located processes.
+ *
+ * Produced by `export_ipc`. The `handle` and the metadata bytes are what must
+ * be transported to the importing process (over any host channel, e.g. a unix
+ * socket or shared memory); `data` owns the packed device allocation and must
+ * be kept alive in the exporting process for as long as any importer is
+ * attached.
+ */
+struct ipc_exported_table {
+  cudaIpcMemHandle_t handle{};  ///< CUDA IPC handle to the packed device memory
+  packed_columns data;          ///< Owning packed table backing the handle
+
+  /// Host metadata bytes to transport alongside the handle
+  uint8_t const* metadata() const { return data.metadata_->data(); }
+  /// Size of the metadata in bytes
+  size_t metadata_size() const { return data.metadata_->size(); }
+};
+
+/**
+ * @brief Exports a table for zero-copy import in another process via CUDA IPC.
+ *
+ * Deep-copies `input` into a single contiguous device allocation (see
+ * `cudf::pack`) and obtains a CUDA IPC handle for it. The importing process
+ * reconstructs a `table_view` over the shared memory with `imported_ipc_table`
+ * without any device-to-host or device-to-device copies.
+ *
+ * @note `cudaIpcGetMemHandle` requires a base device allocation, so `mr` must
+ * return IPC-shareable memory (e.g. `rmm::mr::cuda_memory_resource`); memory
+ * sub-allocated from a pool cannot be exported.
+ *
+ * @throws cudf::logic_error if `input` is empty
+ *
+ * @param input Table to export
+ * @param mr Device memory resource used to allocate the packed table
+ * @return The IPC handle, metadata, and owning packed data
+ */
+ipc_exported_table export_ipc(
+  table_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief A table imported from another process via CUDA IPC.
+ *
+ * Opens the exported device allocation on construction and closes it on
+ * destruction. The `table_view` returned by `view()` aliases memory owned by
+ * the exporting process and is valid only while this object is alive and the
+ * exporter keeps its `ipc_exported_table` alive.
+ */
+class imported_ipc_table {
+ public:
+  /**
+   * @brief Attaches to a table exported by `export_ipc` in another process.
+   *
+   * @throws cudf::logic_error if `metadata` is empty
+   * @throws cudf::cuda_error if the handle cannot be opened
+   *
+   * @param handle IPC handle received from the exporting process
+   * @param metadata Metadata bytes received from the exporting process
+   */
+  imported_ipc_table(cudaIpcMemHandle_t const& handle, std::vector<uint8_t> metadata);
+  ~imported_ipc_table();
+
+  imported_ipc_table(imported_ipc_table&& other) noexcept;
+  imported_ipc_table& operator=(imported_ipc_table&& other) noexcept;
+  imported_ipc_table(imported_ipc_table const&) = delete;
+  imported_ipc_table& operator=(imported_ipc_table const&) = delete;
+
+  /**
+   * @brief Returns a zero-copy view of the shared table.
+   */
+  table_view view() const;
+
+ private:
+  std::vector<uint8_t> _metadata;
+  void* _gpu_data{nullptr};
+};
+
+}  // namespace cudf
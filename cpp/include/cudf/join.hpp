@@ -19,8 +19,10 @@
 #include <cudf/ast/expressions.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
 #include <optional>
@@ -493,6 +495,158 @@ std::unique_ptr<cudf::table> cross_join(
   cudf::table_view const& right,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join between two tables
+ * that are both sorted on the join keys.
+ *
+ * Unlike `cudf::inner_join`, no hash table is built: the matches of each left row form a
+ * contiguous run in the right table which is located by binary search. This avoids the build
+ * phase's memory overhead, at the cost of requiring both inputs to be sorted on the keys with
+ * the same column order and null precedence. Behavior is undefined if either input is not
+ * sorted accordingly.
+ *
+ * Null keys compare equal to null keys, i.e. rows with null join-key values match each other.
+ *
+ * @code{.pseudo}
+ * left_keys: {{0, 1, 2, 2}}
+ * right_keys: {{1, 2, 2, 4}}
+ * Result: {{1, 2, 2, 3, 3}, {0, 1, 2, 1, 2}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if number of elements in `left_keys` or `right_keys`
+ * mismatch.
+ * @throw cudf::logic_error if the join output size exceeds `cudf::size_type` range.
+ *
+ * @param left_keys The left table, sorted on all its columns
+ * @param right_keys The right table, sorted on all its columns
+ * @param column_order The desired sort order for each column; empty implies all ascending
+ * @param null_precedence The desired order of null compared to other elements for each column;
+ * empty implies null is smallest
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and `right_keys`
+ * as the join keys .
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sorted_merge_inner_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join between the
+ * specified tables, where the keys of the right table are known to be unique.
+ *
+ * Because each key occurs at most once in the right table, the hash table stores a single
+ * row index per key and each probe resolves with a single lookup instead of walking a chain
+ * of duplicates, and no output-size counting pass is needed. Behavior is undefined if the
+ * right table contains duplicate keys: at most one match per key is returned.
+ *
+ * @code{.pseudo}
+ * left_keys: {{0, 1, 2, 1}}
+ * right_keys: {{1, 2, 3}}
+ * Result: {{1, 2, 3}, {0, 1, 0}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if number of elements in `left_keys` or `right_keys`
+ * mismatch.
+ *
+ * @param[in] left_keys The left table
+ * @param[in] right_keys The right table, whose keys must be unique
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and `right_keys`
+ * as the join keys .
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+distinct_inner_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to a left join between the
+ * specified tables, where the keys of the right table are known to be unique.
+ *
+ * Because each key occurs at most once in the right table, every left row produces exactly
+ * one output row, so the output size equals the probe size and each probe resolves with a
+ * single lookup. Behavior is undefined if the right table contains duplicate keys: at most
+ * one match per key is returned.
+ *
+ * @code{.pseudo}
+ * left_keys: {{0, 1, 2}}
+ * right_keys: {{1, 2, 3}}
+ * Result: {{0, 1, 2}, {NoneValue, 0, 1}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if number of elements in `left_keys` or `right_keys`
+ * mismatch.
+ *
+ * @param[in] left_keys The left table
+ * @param[in] right_keys The right table, whose keys must be unique
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a left join between two tables with `left_keys` and `right_keys`
+ * as the join keys .
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+distinct_left_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join between the
+ * specified tables, processing the inputs one hash partition pair at a time.
+ *
+ * Both inputs are hash-partitioned on the join keys with the same hash function and seed, so
+ * matching keys always fall into the same partition pair. The partitions are spilled to pinned
+ * host memory and streamed back one pair at a time through a regular hash join, with the next
+ * pair's transfer overlapped with the current pair's probe. This bounds the device memory
+ * consumed by the hash table and intermediate results to roughly one partition's worth,
+ * allowing build sides larger than would otherwise fit alongside the working set.
+ *
+ * The result is equivalent to `cudf::inner_join` on the same keys, with row indices referring
+ * to the original (unpartitioned) tables.
+ *
+ * @throw cudf::logic_error if `num_partitions` is not positive.
+ * @throw cudf::logic_error if number of elements in `left_keys` or `right_keys`
+ * mismatch.
+ *
+ * @param[in] left_keys The left table
+ * @param[in] right_keys The right table
+ * @param[in] num_partitions The number of partition pairs to process the join in
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and `right_keys`
+ * as the join keys .
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+grace_hash_inner_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  int num_partitions,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Hash join that builds hash table in creation and probes results in subsequent `*_join`
  * member functions.
@@ -523,6 +677,45 @@ class hash_join {
             null_equality compare_nulls,
             rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
+  /**
+   * @brief Construct a hash join object from a hash table previously obtained from
+   * `serialize_hash_table()`, skipping the build phase.
+   *
+   * This allows a hash table built once to be broadcast to other devices or processes and reused
+   * for probing instead of being rebuilt. `build` must view the same data as the build table of
+   * the `hash_join` object that produced `serialized_hash_table`, else behavior is undefined.
+   *
+   * @note The `hash_join` object must not outlive the table viewed by `build`, else behavior is
+   * undefined.
+   *
+   * @throw cudf::logic_error if `serialized_hash_table` is empty while `build` has rows, or is
+   * not a valid serialized hash table.
+   *
+   * @param build The build table the serialized hash table was built from.
+   * @param serialized_hash_table The serialized hash table, as returned by
+   * `serialize_hash_table()`.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  hash_join(cudf::table_view const& build,
+            device_span<uint8_t const> serialized_hash_table,
+            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Returns the built hash table as a contiguous device buffer.
+   *
+   * The buffer, together with the build table, is sufficient to reconstruct this object via the
+   * deserializing constructor, e.g. after broadcasting both to another device.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned buffer's device memory.
+   *
+   * @return Device buffer containing the serialized hash table; empty if the build table has no
+   * rows.
+   */
+  rmm::device_buffer serialize_hash_table(
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
   /**
    * Returns the row indices that can be used to construct the result of performing
    * an inner join between two tables. @see cudf::inner_join(). Behavior is undefined if the
@@ -945,5 +1138,153 @@ std::size_t conditional_left_anti_join_size(
   table_view const& right,
   ast::expression const& binary_predicate,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to all pairs of
+ * rows between the specified tables where the columns of the equality table
+ * are equal and the predicate evaluates to true on the conditional tables.
+ *
+ * The first returned vector contains the row indices from the left
+ * table that have a match in the right table (in unspecified order).
+ * The corresponding values in the second returned vector are
+ * the matched row indices from the right table.
+ *
+ * The rows of the equality tables are hashed and matched with a hash join,
+ * and the predicate is only evaluated on pairs of rows whose equality keys
+ * match, so the cost of this join is proportional to the number of equality
+ * matches rather than to the full cross product of the two tables.
+ *
+ * If the provided predicate returns NULL for a pair of rows
+ * (left, right), that pair is not included in the output.
+ *
+ * @code{.pseudo}
+ * left_equality: {{0, 1, 2}}
+ * right_equality: {{1, 2, 3}}
+ * left_conditional: {{4, 4, 4}}
+ * right_conditional: {{3, 4, 5}}
+ * Expression: Left.Column_0 > Right.Column_0
+ * Result: {{1}, {0}}
+ * @endcode
+ *
+ * @throw cudf::logic_error If the binary predicate outputs a non-boolean result.
+ * @throw cudf::logic_error If the number of rows in left_equality and left_conditional do not
+ * match.
+ * @throw cudf::logic_error If the number of rows in right_equality and right_conditional do not
+ * match.
+ *
+ * @param left_equality The left table used for the equality join
+ * @param right_equality The right table used for the equality join
+ * @param left_conditional The left table used for the conditional join
+ * @param right_conditional The right table used for the conditional join
+ * @param binary_predicate The condition on which to join
+ * @param compare_nulls Whether or not null values join to each other or not
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a mixed inner join between the four input tables.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_inner_join(
+  table_view const& left_equality,
+  table_view const& right_equality,
+  table_view const& left_conditional,
+  table_view const& right_conditional,
+  ast::expression const& binary_predicate,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to all pairs of
+ * rows between the specified tables where the columns of the equality table
+ * are equal and the predicate evaluates to true on the conditional tables,
+ * or null matches for rows in left that have no match in right.
+ *
+ * The first returned vector contains all the row indices from the left
+ * table (in unspecified order). The corresponding value in the
+ * second returned vector is either (1) the row index of the matched row
+ * from the right table, if there is a match  or  (2) an unspecified
+ * out-of-bounds value.
+ *
+ * The rows of the equality tables are hashed and matched with a hash join,
+ * and the predicate is only evaluated on pairs of rows whose equality keys
+ * match, so the cost of this join is proportional to the number of equality
+ * matches rather than to the full cross product of the two tables.
+ *
+ * If the provided predicate returns NULL for a pair of rows
+ * (left, right), that pair is not included in the output.
+ *
+ * @code{.pseudo}
+ * left_equality: {{0, 1, 2}}
+ * right_equality: {{1, 2, 3}}
+ * left_conditional: {{4, 4, 4}}
+ * right_conditional: {{3, 4, 5}}
+ * Expression: Left.Column_0 > Right.Column_0
+ * Result: {{0, 1, 2}, {None, 0, None}}
+ * @endcode
+ *
+ * @throw cudf::logic_error If the binary predicate outputs a non-boolean result.
+ * @throw cudf::logic_error If the number of rows in left_equality and left_conditional do not
+ * match.
+ * @throw cudf::logic_error If the number of rows in right_equality and right_conditional do not
+ * match.
+ *
+ * @param left_equality The left table used for the equality join
+ * @param right_equality The right table used for the equality join
+ * @param left_conditional The left table used for the conditional join
+ * @param right_conditional The right table used for the conditional join
+ * @param binary_predicate The condition on which to join
+ * @param compare_nulls Whether or not null values join to each other or not
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a mixed left join between the four input tables.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_left_join(
+  table_view const& left_equality,
+  table_view const& right_equality,
+  table_view const& left_conditional,
+  table_view const& right_conditional,
+  ast::expression const& binary_predicate,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+namespace distributed {
+/**
+ * @brief Performs an inner join across multiple devices.
+ *
+ * `left[i]` and `right[i]` must reside on device `i`. Each device
+ * hash-partitions its local tables so that rows with equal keys map to the
+ * same destination device, the partitions are exchanged all-to-all with
+ * peer-to-peer copies (falling back to staging through host memory between
+ * devices without a peer link), and each device then joins its share of the
+ * data locally.
+ *
+ * The returned vector holds one result table per device; table `i` resides on
+ * device `i` and is allocated with that device's current device resource. The
+ * concatenation of the results equals the inner join of the concatenation of
+ * the inputs, up to row order.
+ *
+ * @throw cudf::logic_error if `left` and `right` have different sizes, are
+ * empty, or name more devices than are visible.
+ *
+ * @param left The left tables, one per device
+ * @param right The right tables, one per device
+ * @param left_on The column indices from each left table to join on
+ * @param right_on The column indices from each right table to join on
+ * @param compare_nulls controls whether null join-key values should match or not
+ *
+ * @return One result table per device of joining the distributed `left` and
+ * `right` tables on the columns specified by `left_on` and `right_on`.
+ */
+std::vector<std::unique_ptr<table>> inner_join(
+  std::vector<table_view> const& left,
+  std::vector<table_view> const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  null_equality compare_nulls = null_equality::EQUAL);
+}  // namespace distributed
 /** @} */  // end of group
 }  // namespace cudf
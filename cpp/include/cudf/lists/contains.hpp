@@ -74,6 +74,52 @@ std::unique_ptr<column> contains(
   cudf::column_view const& search_keys,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create a column of the positions of the first occurrence of the specified
+ * scalar in each row of a list column.
+ *
+ * The output column has as many elements as the input `lists` column.
+ * Output `column[i]` is set to the zero-based position of `search_key` within the
+ * lists row `lists[i]`, or to `-1` if the lists row does not contain the search key.
+ *
+ * Output `column[i]` is set to null if one or more of the following are true:
+ *   1. The search key `search_key` is null
+ *   2. The list row `lists[i]` is null
+ *
+ * @param lists Lists column whose `n` rows are to be searched
+ * @param search_key The scalar key to be looked up in each list row
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return std::unique_ptr<column> INT32 column of `n` rows with the position of the first
+ * occurrence of the search key in each list row
+ */
+std::unique_ptr<column> index_of(
+  cudf::lists_column_view const& lists,
+  cudf::scalar const& search_key,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a column of the positions of the first occurrence of the corresponding
+ * values in the second column within each row of a list column.
+ *
+ * The output column has as many elements as the input `lists` column.
+ * Output `column[i]` is set to the zero-based position of `search_keys[i]` within the
+ * lists row `lists[i]`, or to `-1` if the lists row does not contain the search key.
+ *
+ * Output `column[i]` is set to null if one or more of the following are true:
+ *   1. The row `search_keys[i]` is null
+ *   2. The list row `lists[i]` is null
+ *
+ * @param lists Lists column whose `n` rows are to be searched
+ * @param search_keys Column of elements to be looked up in each list row
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return std::unique_ptr<column> INT32 column of `n` rows with the position of the first
+ * occurrence of each search key in each list row
+ */
+std::unique_ptr<column> index_of(
+  cudf::lists_column_view const& lists,
+  cudf::column_view const& search_keys,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace lists
 }  // namespace cudf
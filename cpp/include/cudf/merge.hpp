@@ -100,5 +100,59 @@ std::unique_ptr<cudf::table> merge(
   std::vector<cudf::null_order> const& null_precedence = {},
   rmm::mr::device_memory_resource* mr                  = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Merge a sorted table of updates into a sorted target table.
+ *
+ * Produces a new sorted table where every target row whose key (as selected by
+ * `key_cols`) equals an update row's key is replaced by that update row, and
+ * update rows with keys not present in the target are inserted in sorted
+ * position. Target rows with unmatched keys are carried through unchanged.
+ * This performs a single merge pass instead of the separate search, scatter,
+ * concatenate and re-sort steps an upsert otherwise requires.
+ *
+ * ```
+ * Example:
+ * target  => col 1 {0, 1, 3, 5}
+ *            col 2 {4, 5, 6, 7}
+ * updates => col 1 {1, 2}
+ *            col 2 {8, 9}
+ *
+ * with key_cols[] = {0}
+ *
+ * output:
+ * table => col 1 {0, 1, 2, 3, 5}
+ *          col 2 {4, 8, 9, 6, 7}
+ * ```
+ *
+ * Both inputs must already be sorted on `key_cols` according to `column_order`
+ * and `null_precedence`; otherwise the behavior is undefined. Keys are
+ * expected to be unique within each input. If an input contains duplicate
+ * keys, all rows of an equal-key run in `updates` are kept and only the
+ * target rows immediately following an equal-key update row are replaced.
+ *
+ * @throws cudf::logic_error if `target` and `updates` have different numbers
+ * of columns or mismatched column types
+ * @throws cudf::logic_error if `key_cols` is empty or larger than the number
+ * of columns
+ * @throws cudf::logic_error if `key_cols` size and `column_order` size mismatches
+ *
+ * @param[in] target Sorted table receiving the updates
+ * @param[in] updates Sorted table of replacement and new rows
+ * @param[in] key_cols Indices of columns to be used for comparison criteria
+ * @param[in] column_order Sort order types of columns indexed by key_cols
+ * @param[in] null_precedence Array indicating the order of nulls with respect
+ * to non-nulls for the indexing columns (key_cols)
+ * @param[in] mr Device memory resource used to allocate the returned table
+ *
+ * @returns A sorted table containing the target rows with updates applied
+ */
+std::unique_ptr<cudf::table> merge_upsert(
+  table_view const& target,
+  table_view const& updates,
+  std::vector<cudf::size_type> const& key_cols,
+  std::vector<cudf::order> const& column_order,
+  std::vector<cudf::null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr                  = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -229,5 +229,21 @@ rmm::device_buffer bitmask_or(
   table_view const& view,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Frees the null masks of a column, and of its descendants, that contain no nulls
+ *
+ * Operations that cannot prove their output all-valid up front allocate a null mask and
+ * discover only afterwards that every bit is set. Such a mask carries no information but
+ * still occupies `bitmask_allocation_size_bytes(size)` of device memory per column. This
+ * function releases those masks, leaving the affected columns non-nullable.
+ *
+ * Columns whose null count is nonzero are left untouched. If a null count is unknown it is
+ * computed to decide whether the mask can be freed.
+ *
+ * @param input The column whose all-valid null masks are released
+ * @return The number of bytes of device memory released
+ */
+std::size_t reclaim_null_masks(column& input);
+
 /** @} */  // end of group
 }  // namespace cudf
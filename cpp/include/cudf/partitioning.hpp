@@ -242,5 +242,68 @@ std::pair<std::unique_ptr<cudf::table>, std::vector<cudf::size_type>> round_robi
   cudf::size_type start_partition     = 0,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Range partition.
+ *
+ * Partitions rows of `input` into `splitters.num_rows() + 1` bins by comparing
+ * the key columns of each row against a sorted table of splitters: row `r`
+ * goes to the partition equal to the number of splitter rows that compare less
+ * than or equal to it. Rows in the same bin are grouped consecutively in the
+ * output, so partitions are ordered by key range, as required for sorted
+ * output and range joins. The order within each partition is undefined.
+ *
+ * `splitters` must have the same number and types of columns as
+ * `input.select(keys)` and must be sorted according to `column_order` and
+ * `null_precedence`; `compute_range_splitters` produces a suitable table.
+ *
+ * @throw cudf::logic_error if `splitters` column count does not match `keys`
+ *
+ * @param input The table to partition
+ * @param keys Indices of the input columns the splitters are compared against
+ * @param splitters Sorted table of partition boundary rows
+ * @param column_order The desired sort order for each key column
+ * @param null_precedence The desired order of null compared to other elements
+ * for each key column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @returns An output table and a vector of row offsets to each partition
+ */
+std::pair<std::unique_ptr<cudf::table>, std::vector<cudf::size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& keys,
+  table_view const& splitters,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes balanced splitters for `range_partition` by sampling.
+ *
+ * Draws an oversampled random sample of `keys`, sorts it on the device, and
+ * selects `num_partitions - 1` evenly spaced rows, so the resulting partitions
+ * are approximately equal-sized even on skewed data.
+ *
+ * @throws cudf::logic_error if `num_partitions <= 0`
+ *
+ * @param keys The key columns partitions will be split on
+ * @param num_partitions The number of partitions the splitters should produce
+ * @param column_order The desired sort order for each key column
+ * @param null_precedence The desired order of null compared to other elements
+ * for each key column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @returns A sorted table of `num_partitions - 1` splitter rows
+ */
+std::unique_ptr<table> compute_range_splitters(
+  table_view const& keys,
+  size_type num_partitions,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
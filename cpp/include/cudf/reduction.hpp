@@ -17,7 +17,9 @@
 #pragma once
 
 #include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
 
 namespace cudf {
 /**
@@ -57,6 +59,13 @@ enum class scan_type : bool { INCLUSIVE, EXCLUSIVE };
  * If the reduction fails, the member is_valid of the output scalar
  * will contain `false`.
  *
+ * The returned scalar is device-resident and the call does not synchronize the
+ * stream: its value and validity live in device memory and can be consumed by
+ * subsequent device operations -- e.g. as a `cudf::binary_operation` operand
+ * with `scalar_validity::READ_ON_DEVICE` -- without a round trip to the host.
+ * Only reading the result on the host (`scalar::is_valid()`, `value()`)
+ * synchronizes.
+ *
  * @param col Input column view
  * @param agg Aggregation operator applied by the reduction
  * @param output_dtype  The computation and output precision.
@@ -69,6 +78,76 @@ std::unique_ptr<scalar> reduce(
   data_type output_dtype,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the reduction of every column of a table by every requested
+ * aggregation in a minimal number of kernel launches.
+ *
+ * Applying `cudf::reduce` per column and per aggregation launches one kernel
+ * (or more) for each result; collecting basic statistics over wide tables this
+ * way is dominated by launch overhead. This function instead tiles the
+ * `MIN`, `MAX`, `SUM` and `COUNT_VALID` reductions of numeric columns into
+ * fused kernels -- one launch per distinct column type -- and computes the
+ * remaining column/aggregation pairs through the regular per-column paths.
+ *
+ * The result for `aggs[j]` applied to `input.column(i)` is returned at
+ * position `i * aggs.size() + j`. Each output type is the target type of the
+ * aggregation for the column type (e.g. `SUM` of an integral column produces
+ * an INT64 scalar). As with `cudf::reduce`, null elements are skipped and a
+ * reduction over zero valid rows produces an invalid scalar; `COUNT_VALID`
+ * always produces a valid count.
+ *
+ * @throw cudf::logic_error if `aggs` is empty.
+ * @throw cudf::logic_error if an aggregation is not supported for reduction.
+ *
+ * @param input Table whose columns are to be reduced
+ * @param aggs Aggregation operators to apply to every column
+ * @param mr Device memory resource used to allocate the returned scalars' device memory
+ * @returns Scalars with the reduce results, one per column/aggregation pair
+ */
+std::vector<std::unique_ptr<scalar>> reduce_multi(
+  table_view const& input,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes the reduction of each segment of a column.
+ *
+ * The segments are described by an offsets column of `n + 1` exclusive
+ * offsets, exactly as in a lists column: segment `i` covers the element range
+ * `[offsets[i], offsets[i+1])`. The output column has `n` rows, one reduction
+ * result per segment, computed in a single pass without materializing group
+ * labels or sorting (unlike routing segment reductions through groupby).
+ *
+ * Supported aggregations are `SUM`, `PRODUCT`, `MIN`, `MAX`, `ANY` and `ALL`
+ * over numeric columns. The reduction is computed in the aggregation's target
+ * type for the column type (e.g. `SUM` of an integral column accumulates in
+ * int64) and then cast to `output_dtype` if it differs.
+ *
+ * If `null_handling == null_policy::EXCLUDE`, null elements are skipped and a
+ * segment's result is null only when the segment is empty or entirely null.
+ * If `null_handling == null_policy::INCLUDE`, any null element makes its
+ * segment's result null; empty segments are always null.
+ *
+ * @throw cudf::logic_error if `offsets` is not a non-nullable INT32 column of
+ *        at least one element.
+ * @throw cudf::logic_error if the aggregation or column type is not supported.
+ *
+ * @param segmented_values Column whose segments are to be reduced
+ * @param offsets Exclusive segment offsets (`n + 1` values for `n` segments)
+ * @param agg Aggregation operator applied to each segment
+ * @param output_dtype The output precision
+ * @param null_handling Whether null elements should nullify their segment
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Column of `n` reduction results, one per segment
+ */
+std::unique_ptr<column> segmented_reduce(
+  column_view const& segmented_values,
+  column_view const& offsets,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief  Computes the scan of a column.
  *
@@ -94,9 +173,49 @@ std::unique_ptr<column> scan(
   null_policy null_handling           = null_policy::EXCLUDE,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the scan of every column of a table in a minimal number of
+ * scan launches.
+ *
+ * Applying `cudf::scan` per column launches at least one scan for each column;
+ * computing cumulative features over wide tables this way is dominated by
+ * launch overhead. This function instead batches the numeric columns sharing a
+ * column type into a single keyed scan -- one launch per distinct column type,
+ * with the column index as the key so each column is scanned independently --
+ * and scans the remaining columns through the regular per-column paths.
+ *
+ * The results are returned in input column order and match `cudf::scan` of
+ * each column with the same arguments, including the null handling: with
+ * `null_policy::EXCLUDE` null rows stay null and are skipped, while with
+ * `null_policy::INCLUDE` the validity is carried through the scan state so
+ * every row from the first null on is null.
+ *
+ * @throws cudf::logic_error if the aggregation is not supported for a column
+ *         type, as in `cudf::scan`.
+ *
+ * @param input Table whose columns are to be scanned
+ * @param agg Aggregation operator applied by the scans
+ * @param inclusive The flag for applying an inclusive scan if
+ *        scan_type::INCLUSIVE, an exclusive scan if scan_type::EXCLUSIVE.
+ * @param null_handling Exclude null values when computing the result if
+ *        null_policy::EXCLUDE. Include nulls if null_policy::INCLUDE.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @returns Columns with the scan results, one per input column
+ */
+std::vector<std::unique_ptr<column>> scan_multi(
+  table_view const& input,
+  std::unique_ptr<aggregation> const& agg,
+  scan_type inclusive,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Determines the minimum and maximum values of a column.
  *
+ * As with `cudf::reduce`, the returned scalars are device-resident and the
+ * call does not synchronize the stream; they can be chained into device
+ * operations (e.g. a normalize-by-max `cudf::binary_operation` with
+ * `scalar_validity::READ_ON_DEVICE`) without reading the values on the host.
  *
  * @param col column to compute minmax
  * @param mr Device memory resource used to allocate the returned column's device memory
@@ -251,6 +251,48 @@ std::unique_ptr<column> clamp(
   scalar const& hi,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Clamps, shifts, and scales the elements of `input` in a single pass.
+ *
+ * Each valid element `e` is replaced by `(clamp(e, lo, hi) - shift) / scale`, where
+ * `clamp(e, lo, hi)` replaces `e` with `lo` when `e < lo` and with `hi` when `e > hi`,
+ * following the same rules as `cudf::clamp`: an invalid `lo` or `hi` means no bound on
+ * that side. Null elements stay null.
+ *
+ * Equivalent to `cudf::clamp` followed by a subtract and a divide with scalar operands,
+ * except that the chain is fused into one kernel and no intermediate columns are
+ * materialized.
+ *
+ * ```
+ * Example:
+ *    input: {0, 4, NULL, 10}
+ *    lo: 2, hi: 8, shift: 2, scale: 2
+ *    output:{0, 1, NULL, 3}
+ * ```
+ *
+ * @throws cudf::logic_error if `input` is not of a numeric type
+ * @throws cudf::logic_error if the type of any scalar doesn't match `input.type()`
+ * @throws cudf::logic_error if `shift` or `scale` is invalid
+ *
+ * @param[in] input Column of numeric elements to normalize
+ * @param[in] lo Minimum clamp value. All elements less than `lo` will be replaced by `lo`. Ignored
+ * if null.
+ * @param[in] hi Maximum clamp value. All elements greater than `hi` will be replaced by `hi`.
+ * Ignored if null.
+ * @param[in] shift Value subtracted from each clamped element.
+ * @param[in] scale Value the shifted elements are divided by.
+ * @param[in] mr Device memory resource used to allocate device memory of the returned column.
+ *
+ * @return Returns a normalized column of the same type as `input`
+ */
+std::unique_ptr<column> normalize(
+  column_view const& input,
+  scalar const& lo,
+  scalar const& hi,
+  scalar const& shift,
+  scalar const& scale,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Copies from a column of floating-point elements and replaces `-NaN` and `-0.0` with `+NaN`
  * and `+0.0`, respectively.
@@ -523,6 +523,67 @@ std::unique_ptr<column> grouped_range_rolling_window(
   rolling_aggregation const& aggr,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Precomputed grouped range-rolling windows, reusable across aggregations.
+ *
+ * `grouped_range_rolling_window()` spends most of its non-aggregation time grouping the keys and
+ * binary-searching the order-by column for every row's window bounds — work that depends only on
+ * the keys, the order-by column and the window intervals, not on the aggregated values. This
+ * class runs that work once at construction and caches the per-row preceding/following window
+ * bounds, so each subsequent `aggregate()` call pays only for the aggregation itself.
+ *
+ * @code{.pseudo}
+ * grouped_range_rolling windows(group_keys, orderby_column, order, preceding, following, 1);
+ * auto sums   = windows.aggregate(values, *make_sum_aggregation<rolling_aggregation>());
+ * auto counts = windows.aggregate(values, *make_count_aggregation<rolling_aggregation>());
+ * @endcode
+ *
+ * The arguments, preconditions, and per-aggregation results are identical to
+ * `grouped_range_rolling_window()`.
+ */
+class grouped_range_rolling {
+ public:
+  /**
+   * @brief Groups the keys and computes the per-row window bounds.
+   *
+   * @param group_keys The (pre-sorted) grouping columns
+   * @param orderby_column The (pre-sorted) order-by column, for range comparisons
+   * @param order The order (ASCENDING/DESCENDING) in which the order-by column is sorted
+   * @param preceding The interval value in the backward direction
+   * @param following The interval value in the forward direction
+   * @param min_periods Minimum number of observations in window required to have a value,
+   *                    otherwise element `i` is null
+   */
+  grouped_range_rolling(table_view const& group_keys,
+                        column_view const& orderby_column,
+                        cudf::order const& order,
+                        range_window_bounds const& preceding,
+                        range_window_bounds const& following,
+                        size_type min_periods);
+
+  ~grouped_range_rolling();
+
+  /**
+   * @brief Applies an aggregation over the precomputed windows.
+   *
+   * @param input The input column (to be aggregated); must have as many rows as the
+   *              order-by column used at construction
+   * @param aggr The rolling window aggregation type (SUM, MAX, MIN, etc.)
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @returns A nullable output column containing the rolling window results
+   */
+  std::unique_ptr<column> aggregate(
+    column_view const& input,
+    rolling_aggregation const& aggr,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  std::unique_ptr<column> _preceding;  ///< per-row preceding window sizes
+  std::unique_ptr<column> _following;  ///< per-row following window sizes
+  size_type _min_periods;
+  size_type _num_rows;
+};
+
 /**
  * @brief  Applies a variable-size rolling window function to the values in a column.
  *
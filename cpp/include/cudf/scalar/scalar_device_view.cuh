@@ -191,6 +191,64 @@ class fixed_width_scalar_device_view : public detail::fixed_width_scalar_device_
   }
 };
 
+/**
+ * @brief A type-erased scalar_device_view that can hold either a fixed width
+ * value or a string.
+ *
+ * Used where heterogeneous scalars must be stored in a single container, such
+ * as the literals of an AST expression.
+ */
+class generic_scalar_device_view : public detail::scalar_device_view_base {
+ public:
+  template <typename T>
+  generic_scalar_device_view(numeric_scalar<T>& s)
+    : generic_scalar_device_view(s.type(), s.data(), s.validity_data())
+  {
+  }
+
+  template <typename T>
+  generic_scalar_device_view(timestamp_scalar<T>& s)
+    : generic_scalar_device_view(s.type(), s.data(), s.validity_data())
+  {
+  }
+
+  template <typename T>
+  generic_scalar_device_view(duration_scalar<T>& s)
+    : generic_scalar_device_view(s.type(), s.data(), s.validity_data())
+  {
+  }
+
+  generic_scalar_device_view(string_scalar& s)
+    : detail::scalar_device_view_base(s.type(), s.validity_data()), _data(s.data()), _size(s.size())
+  {
+  }
+
+  /**
+   * @brief Returns the stored value.
+   *
+   * @tparam T The desired type; must match the type of the underlying scalar.
+   */
+  template <typename T>
+  __device__ T value() const noexcept
+  {
+    if constexpr (std::is_same_v<T, cudf::string_view>) {
+      return cudf::string_view{static_cast<char const*>(_data), _size};
+    } else {
+      return *static_cast<T const*>(_data);
+    }
+  }
+
+ private:
+  template <typename T>
+  generic_scalar_device_view(data_type type, T* data, bool* is_valid)
+    : detail::scalar_device_view_base(type, is_valid), _data(data)
+  {
+  }
+
+  void const* _data{};   ///< Pointer to device memory containing the value
+  size_type _size{};     ///< Size of the string in bytes (string scalars only)
+};
+
 }  // namespace detail
 
 /**
@@ -21,6 +21,9 @@
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
+#include <memory>
 #include <vector>
 
 namespace cudf {
@@ -166,5 +169,62 @@ std::unique_ptr<column> contains(
   column_view const& needles,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief A reusable sorted-search index over a table.
+ *
+ * `lower_bound`/`upper_bound` treat the haystack as cold on every call. When
+ * the same reference table is probed repeatedly, a `sorted_index` built once
+ * amortizes the per-call setup: for single numeric or timestamp columns it
+ * precomputes a contiguous pivot hierarchy that search kernels cache in
+ * shared memory, and for all other inputs it retains the prepared comparator
+ * state.
+ *
+ * @note The `sorted_index` object must not outlive the table viewed by `t`,
+ * else behavior is undefined.
+ */
+class sorted_index {
+ public:
+  sorted_index() = delete;
+  ~sorted_index();
+  sorted_index(sorted_index const&) = delete;
+  sorted_index(sorted_index&&)      = delete;
+  sorted_index& operator=(sorted_index const&) = delete;
+  sorted_index& operator=(sorted_index&&) = delete;
+
+  /**
+   * @brief Construct a sorted-search index for subsequent probe calls.
+   *
+   * @throws cudf::logic_error if the sizes of @p column_order or
+   * @p null_precedence are nonzero and do not match the number of columns.
+   *
+   * @param t The sorted table to index.
+   * @param column_order Vector of column sort order.
+   * @param null_precedence Vector of null_precedence enum values.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  sorted_index(table_view const& t,
+               std::vector<order> const& column_order         = {},
+               std::vector<null_order> const& null_precedence = {},
+               rmm::cuda_stream_view stream                   = rmm::cuda_stream_default);
+
+  /**
+   * @copydoc cudf::lower_bound
+   */
+  std::unique_ptr<column> lower_bound(
+    table_view const& values,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @copydoc cudf::upper_bound
+   */
+  std::unique_ptr<column> upper_bound(
+    table_view const& values,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  struct sorted_index_impl;
+  std::unique_ptr<sorted_index_impl const> _impl;
+};
+
 /** @} */  // end of group
 }  // namespace cudf
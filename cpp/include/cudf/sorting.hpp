@@ -184,6 +184,35 @@ std::unique_ptr<column> rank(
   bool percentage,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the ranks of every column of the input table independently.
+ *
+ * Equivalent to calling the column overload of `rank` on each column of
+ * @p input with the same parameters, but issues all of the work as one batch,
+ * which amortizes per-call overhead when ranking many columns (e.g. feature
+ * tables) at once.
+ *
+ * @param input The table whose columns are ranked
+ * @param method The ranking method used for tie breaking (same values).
+ * @param column_order The desired sort order for ranking, applied to every column
+ * @param null_handling  flag to include nulls during ranking. If nulls are not
+ * included, corresponding rank will be null.
+ * @param null_precedence The desired order of null compared to other elements,
+ * applied to every column
+ * @param percentage flag to convert ranks to percentage in range (0,1}
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return A table of rank columns, one per column of `input`, with the same
+ * output types as the column overload.
+ */
+std::unique_ptr<table> rank(
+  table_view const& input,
+  rank_method method,
+  order column_order,
+  null_policy null_handling,
+  null_order null_precedence,
+  bool percentage,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns sorted order after sorting each segment in the table.
  *
@@ -241,5 +270,105 @@ std::unique_ptr<table> segmented_sort_by_key(
   std::vector<null_order> const& null_precedence = {},
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Performs a lexicographic sort of each table in a batch.
+ *
+ * All tables must have the same schema (number, order, and types of columns). The entire batch
+ * is sorted with a single set of kernel launches, which amortizes per-call launch and dispatch
+ * overhead when processing many small tables; the result is equivalent to calling `cudf::sort`
+ * on each table individually.
+ *
+ * @throws cudf::logic_error if the tables in `inputs` do not all have the same schema.
+ *
+ * @param inputs The tables to sort
+ * @param column_order The desired sort order for each column. Size must be
+ * equal to the number of columns or empty. If empty, all columns are sorted
+ * in ascending order.
+ * @param null_precedence The desired order of null compared to other elements
+ * for each column. Size must be equal to the number of columns or empty.
+ * If empty, all columns will be sorted with `null_order::BEFORE`.
+ * @param mr Device memory resource used to allocate the returned tables' device memory
+ * @return A sorted table for each table in `inputs`, in the same order
+ */
+std::vector<std::unique_ptr<table>> batched_sort(
+  std::vector<table_view> const& inputs,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+namespace detail {
+struct sort_spill_run;
+}  // namespace detail
+
+/**
+ * @brief Sorts a table too large for device memory by sorting chunks and
+ * merging spilled runs.
+ *
+ * `cudf::sort` requires the whole table plus temporary space to be resident on
+ * the device. `external_sorter` instead accepts the table one chunk at a time:
+ * each `add_chunk()` call sorts the chunk on the device and spills the sorted
+ * run to pinned host memory, so the device footprint is bounded by the chunk
+ * size rather than the table size. `sort()` then merges the spilled runs a
+ * bounded number at a time on the device until a single sorted table remains.
+ *
+ * All columns act as sort keys, as with `cudf::sort`. Every chunk must have
+ * the same schema.
+ */
+class external_sorter {
+ public:
+  ~external_sorter();
+  external_sorter(external_sorter const&) = delete;
+  external_sorter(external_sorter&&)      = delete;
+  external_sorter& operator=(external_sorter const&) = delete;
+  external_sorter& operator=(external_sorter&&) = delete;
+
+  /**
+   * @brief Construct an external sorter.
+   *
+   * @param column_order The desired order for each column. Size must be equal
+   * to the number of columns of each chunk or empty. If empty, all columns are
+   * sorted in ascending order.
+   * @param null_precedence The desired order of a null element compared to
+   * other elements for each column. Size must be equal to the number of columns
+   * of each chunk or empty. If empty, all columns will be sorted with
+   * `null_order::BEFORE`.
+   */
+  explicit external_sorter(std::vector<order> column_order         = {},
+                           std::vector<null_order> null_precedence = {});
+
+  /**
+   * @brief Sorts one chunk of the table on the device and spills the sorted
+   * run to pinned host memory.
+   *
+   * @throws cudf::logic_error if `chunk` does not match the schema of previous
+   * chunks, or its column count does not match a non-empty `column_order` or
+   * `null_precedence`.
+   *
+   * @param chunk Table chunk to sort and spill. The data is copied; the view
+   * need not outlive the call.
+   */
+  void add_chunk(table_view const& chunk);
+
+  /**
+   * @brief Merges all spilled runs into a single sorted table.
+   *
+   * Runs are merged a bounded number at a time, with intermediate merged runs
+   * spilled back to host memory, so device memory holds only one merge batch
+   * at any point. The spilled runs are consumed; the sorter is empty again
+   * after this call.
+   *
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @return The sorted table containing the rows of all chunks.
+   */
+  std::unique_ptr<table> sort(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+ private:
+  std::vector<order> _column_order;            ///< Per-column sort order
+  std::vector<null_order> _null_precedence;    ///< Per-column null order
+  std::vector<data_type> _types;               ///< Schema of the first chunk
+  std::vector<std::unique_ptr<detail::sort_spill_run>> _runs;  ///< Spilled sorted runs
+};
+
 /** @} */  // end of group
 }  // namespace cudf
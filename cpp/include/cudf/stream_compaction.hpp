@@ -16,9 +16,13 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/types.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace cudf {
@@ -204,13 +208,130 @@ std::unique_ptr<table> apply_boolean_mask(
   column_view const& boolean_mask,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the indices of the rows selected by a boolean mask.
+ *
+ * The result is a column of `size_type` row indices, in ascending order, holding every index
+ * `i` for which `boolean_mask[i]` is non-null and `true`. It is the gather map that
+ * `apply_boolean_mask` implicitly applies, and gathering with it produces the same table.
+ *
+ * @throws cudf::logic_error if `boolean_mask` is not `type_id::BOOL8` type.
+ *
+ * @param[in] boolean_mask A nullable column_view of type type_id::BOOL8
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @return Non-nullable column of the selected row indices
+ */
+std::unique_ptr<column> mask_to_indices(
+  column_view const& boolean_mask,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Filters `input` by a boolean mask and also returns the selected row indices.
+ *
+ * Produces the same table as `apply_boolean_mask(input, boolean_mask)` together with the
+ * gather map of the rows that were kept (as returned by `mask_to_indices`). Callers that
+ * need both — e.g. for row-provenance tracking — would otherwise scan the mask twice; here
+ * the mask is scanned once and the table is materialized by gathering with the indices.
+ *
+ * @throws cudf::logic_error if the `input` size and `boolean_mask` size mismatches.
+ * @throws cudf::logic_error if `boolean_mask` is not `type_id::BOOL8` type.
+ *
+ * @param[in] input The input table_view to filter
+ * @param[in] boolean_mask A nullable column_view of type type_id::BOOL8 used
+ * as a mask to filter the `input`.
+ * @param[in] mr Device memory resource used to allocate the returned table's and column's
+ * device memory
+ * @return The filtered table and the indices of the rows it was gathered from
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> apply_boolean_mask_with_indices(
+  table_view const& input,
+  column_view const& boolean_mask,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Filters `input` by a boolean mask into a preallocated destination table.
+ *
+ * As `apply_boolean_mask`, but the selected rows are written into caller-provided,
+ * preallocated columns instead of an allocated result table, so pipelines that filter
+ * batches of a bounded size can reuse the same destination buffers across batches. The
+ * selected rows are written to the first rows of @p destination, in their input order,
+ * and the number of rows written is returned; rows of @p destination beyond that are
+ * left untouched.
+ *
+ * The columns of @p destination must satisfy the requirements of `gather_in_place`:
+ * fixed-width, matching the types of `input`, and the `input` columns must not have
+ * null values.
+ *
+ * @throws cudf::logic_error if the `input` size and `boolean_mask` size mismatches.
+ * @throws cudf::logic_error if `boolean_mask` is not `type_id::BOOL8` type.
+ * @throws cudf::logic_error if more rows are selected than @p destination has.
+ *
+ * @param[in] input The input table_view to filter
+ * @param[in] boolean_mask A nullable column_view of type type_id::BOOL8 used
+ * as a mask to filter the `input`.
+ * @param[in,out] destination The preallocated columns the selected rows are written to
+ * @return The number of selected rows written to @p destination
+ */
+size_type apply_boolean_mask_in_place(table_view const& input,
+                                      column_view const& boolean_mask,
+                                      mutable_table_view& destination);
+
+/**
+ * @brief Filters each table in a batch by its corresponding boolean mask.
+ *
+ * All tables must have the same schema (number, order, and types of columns), and
+ * `boolean_masks[i]` must be a `type_id::BOOL8` column with `inputs[i].num_rows()` rows. The
+ * entire batch is filtered with a single set of kernel launches, which amortizes per-call
+ * launch and dispatch overhead when processing many small tables; the result is equivalent to
+ * calling `cudf::apply_boolean_mask` on each table/mask pair individually.
+ *
+ * @throws cudf::logic_error if `inputs.size() != boolean_masks.size()`.
+ * @throws cudf::logic_error if the tables in `inputs` do not all have the same schema.
+ * @throws cudf::logic_error if a mask is not of type bool or does not match its table's row
+ * count.
+ *
+ * @param inputs The tables to filter
+ * @param boolean_masks The mask selecting the rows to keep from each table
+ * @param mr Device memory resource used to allocate the returned tables' device memory
+ * @return A filtered table for each table in `inputs`, in the same order
+ */
+std::vector<std::unique_ptr<table>> batched_apply_boolean_mask(
+  std::vector<table_view> const& inputs,
+  std::vector<column_view> const& boolean_masks,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Filters `input` by a predicate expression evaluated over its columns.
+ *
+ * Equivalent to `apply_boolean_mask(input, *compute_column(input, predicate))`
+ * but without materializing the boolean column for the caller: the predicate
+ * result is operator-scoped scratch and rows are compacted with the same
+ * block-scan copy used by `apply_boolean_mask`. Rows where the predicate is
+ * null are filtered out. This operation is stable: the input order is
+ * preserved.
+ *
+ * @throws cudf::logic_error if `predicate` does not evaluate to a boolean
+ *
+ * @param input The table to filter
+ * @param predicate Expression over `input` that selects the rows to keep
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Table containing all rows of `input` for which `predicate` is true
+ */
+std::unique_ptr<table> filter(
+  table_view const& input,
+  ast::expression const& predicate,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Choices for drop_duplicates API for retainment of duplicate rows
  */
 enum class duplicate_keep_option {
   KEEP_FIRST = 0,  ///< Keeps first duplicate row and unique rows
   KEEP_LAST,       ///< Keeps last  duplicate row and unique rows
-  KEEP_NONE        ///< Keeps only unique rows are kept
+  KEEP_NONE,       ///< Keeps only unique rows are kept
+  KEEP_ANY         ///< Keeps an unspecified duplicate row and unique rows
 };
 
 /**
@@ -221,6 +342,12 @@ enum class duplicate_keep_option {
  * - KEEP_FIRST: only the first of a sequence of duplicate rows is copied
  * - KEEP_LAST: only the last of a sequence of duplicate rows is copied
  * - KEEP_NONE: no duplicate rows are copied
+ * - KEEP_ANY: an unspecified one of the duplicate rows is copied
+ *
+ * KEEP_ANY deduplicates with a hash table instead of sorting the keys and is
+ * considerably faster when no particular survivor or output order is required;
+ * the order of the returned rows is unspecified and `null_precedence` is
+ * ignored.
  *
  * @throws cudf::logic_error if The `input` row size mismatches with `keys`.
  *
@@ -276,5 +403,65 @@ cudf::size_type distinct_count(column_view const& input,
 cudf::size_type distinct_count(table_view const& input,
                                null_equality nulls_equal = null_equality::EQUAL);
 
+/**
+ * @brief Builds a HyperLogLog sketch of the distinct rows in a table.
+ *
+ * The sketch is a column of `2^precision` UINT8 registers computed in a single
+ * streaming pass over the input, so its memory footprint is fixed and tiny
+ * regardless of the input size. Two sketches built with the same `precision`
+ * merge by taking the elementwise maximum of their registers (e.g. with
+ * `cudf::binary_operation` and `binary_operator::NULL_MAX`); estimating the
+ * merged sketch yields the approximate distinct count of the union of the
+ * inputs, which makes the sketch suitable for incremental, per-batch
+ * cardinality tracking.
+ *
+ * Null rows contribute a single distinct value to the sketch.
+ *
+ * @throws cudf::logic_error if `precision` is outside `[4, 18]`
+ *
+ * @param input Table whose distinct rows will be sketched
+ * @param precision Log2 of the number of registers; the relative estimation
+ * error is approximately `1.04 / sqrt(2^precision)`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @return UINT8 column of `2^precision` HyperLogLog registers
+ */
+std::unique_ptr<column> distinct_count_sketch(
+  table_view const& input,
+  int32_t precision                   = 12,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Approximates the number of distinct rows in a table.
+ *
+ * Equivalent to estimating a sketch produced by `distinct_count_sketch`, but
+ * without materializing the sketch for the caller. Unlike `distinct_count`,
+ * this runs in a single pass with fixed scratch memory instead of building a
+ * per-call hash set, at the cost of a relative error of approximately
+ * `1.04 / sqrt(2^precision)`.
+ *
+ * @throws cudf::logic_error if `precision` is outside `[4, 18]`
+ *
+ * @param input Table whose distinct rows will be counted
+ * @param precision Log2 of the number of sketch registers
+ *
+ * @return approximate number of distinct rows in the table
+ */
+cudf::size_type approx_distinct_count(table_view const& input, int32_t precision = 12);
+
+/**
+ * @brief Approximates the number of distinct rows summarized by a sketch.
+ *
+ * @throws cudf::logic_error if `sketch` is not a non-nullable UINT8 column
+ * whose size is a power of two in `[2^4, 2^18]`
+ *
+ * @param sketch A (possibly merged) sketch produced by `distinct_count_sketch`
+ *
+ * @return approximate number of distinct rows summarized by the sketch
+ */
+cudf::size_type approx_distinct_count(column_view const& sketch);
+
 /** @} */
 }  // namespace cudf
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <functional>
+
+namespace cudf {
+namespace strings {
+/**
+ * @addtogroup strings_modify
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Applies a strings operation once per distinct value and gathers
+ * the results back to the original rows.
+ *
+ * The input is first dictionary encoded, `op` is invoked on the column of
+ * distinct values only, and the result rows are gathered using the encoded
+ * indices. For heavily duplicated columns this runs the operation on a few
+ * distinct values instead of every row at the cost of one encode pass; for
+ * mostly-unique columns it is slower than calling `op` directly, so callers
+ * opt in when they know their data.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["AA","bb","AA",null,"bb"]
+ * r = apply_on_distinct(s, [](auto const& v){ return to_lower(v); })
+ * r is now ["aa","bb","aa",null,"bb"]  // to_lower ran on ["AA","bb"] only
+ * @endcode
+ *
+ * The `op` must return a strings column with exactly one row per input row
+ * (the distinct values it is given) and no null rows. Null input rows never
+ * reach `op` and produce null output rows.
+ *
+ * @throw cudf::logic_error if `op` returns a column that is not of strings
+ * type, has a different number of rows than its input, or contains nulls.
+ *
+ * @param input Strings instance for this operation.
+ * @param op Operation to apply to the distinct values.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New strings column with `op` applied to every row.
+ */
+std::unique_ptr<column> apply_on_distinct(
+  strings_column_view const& input,
+  std::function<std::unique_ptr<column>(strings_column_view const&)> const& op,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of doxygen group
+}  // namespace strings
+}  // namespace cudf
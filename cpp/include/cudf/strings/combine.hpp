@@ -20,6 +20,9 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <string>
 
 namespace cudf {
 namespace strings {
@@ -199,6 +202,50 @@ std::unique_ptr<column> concatenate(
   separator_on_nulls separate_nulls   = separator_on_nulls::YES,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Row-wise concatenates the given list of strings columns with a
+ * distinct separator between each pair of adjacent columns.
+ *
+ * This produces the same result as chaining pairwise concatenate calls with
+ * scalar separators but computes the output in a single pass, which is the
+ * preferred way to build composite keys like `col_a + '_' + col_b + '-' + col_c`.
+ *
+ * One separator must be provided for each pair of adjacent columns; the
+ * separators may be empty strings. The null-handling semantics match the
+ * single-separator overload: a null entry produces a null output row unless
+ * @p narep is provided, and with @p separate_nulls set to `NO` the separator
+ * preceding a null element is omitted.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s1 = ['a', 'b']
+ * s2 = ['c', 'd']
+ * s3 = ['e', 'f']
+ * out = concatenate({s1, s2, s3}, {'_', '-'})
+ * out is ['a_c-e', 'b_d-f']
+ * @endcode
+ *
+ * @throw cudf::logic_error if input columns are not all strings columns.
+ * @throw cudf::logic_error if fewer than 2 columns are specified.
+ * @throw cudf::logic_error if the number of separators is not one less than
+ *        the number of columns.
+ *
+ * @param strings_columns List of string columns to concatenate.
+ * @param separators Separator strings, one for each pair of adjacent columns.
+ * @param narep String to replace any null strings found in any column.
+ *        Default of invalid-scalar means any null entry in any column will
+ *        produces a null result for that row.
+ * @param separate_nulls If YES, then the separator is included for null rows if `narep` is valid.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New column with concatenated results.
+ */
+std::unique_ptr<column> concatenate(
+  table_view const& strings_columns,
+  host_span<std::string const> separators,
+  string_scalar const& narep          = string_scalar("", false),
+  separator_on_nulls separate_nulls   = separator_on_nulls::YES,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Given a lists column of strings (each row is a list of strings), concatenates the strings
  * within each row and returns a single strings column result.
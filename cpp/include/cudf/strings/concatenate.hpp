@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace strings {
+/**
+ * @addtogroup strings_copy
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Vertically concatenates the given strings columns into as few output
+ * columns as their combined size allows.
+ *
+ * A strings column uses 32-bit offsets so a single column cannot hold more
+ * than `numeric_limits<size_type>::max()` characters or rows. Where
+ * `cudf::concatenate` throws when the combined columns would exceed those
+ * limits, this function instead starts a new output column, so callers need
+ * not pre-partition their inputs. The inputs appear in the outputs in the
+ * order given and each input is contained entirely within one output column.
+ *
+ * If the combined columns fit in a single strings column the result is
+ * equivalent to `cudf::concatenate`.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s1 = ['aa', 'bb', 'cc']
+ * s2 = ['dd', 'ee']
+ * r = concatenate_into_batches([s1, s2])
+ * r is now [['aa', 'bb', 'cc', 'dd', 'ee']]
+ * @endcode
+ *
+ * @throw cudf::logic_error if any column is not a strings column.
+ *
+ * @param columns List of string columns to concatenate.
+ * @param mr Device memory resource used to allocate the returned columns' device memory.
+ * @return One or more columns with the concatenated results.
+ */
+std::vector<std::unique_ptr<column>> concatenate_into_batches(
+  host_span<column_view const> columns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of doxygen group
+}  // namespace strings
+}  // namespace cudf
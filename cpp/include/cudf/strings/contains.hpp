@@ -17,6 +17,9 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+
+#include <vector>
 
 namespace cudf {
 namespace strings {
@@ -52,6 +55,39 @@ std::unique_ptr<column> contains_re(
   std::string const& pattern,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a table of boolean columns identifying rows which
+ * match each of the given regex patterns.
+ *
+ * The strings are read from device memory once while evaluating all the
+ * patterns, making this faster than calling contains_re() per pattern when
+ * several patterns are checked over the same column.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["abc","123","def456"]
+ * r = contains_multiple_re(s,["\\d+","[a-z]+"])
+ * r is now a table of 2 columns:
+ * [false, true, true]
+ * [true, false, true]
+ * @endcode
+ *
+ * Any null string entries return corresponding null output column entries.
+ *
+ * See the @ref md_regex "Regex Features" page for details on patterns supported by this API.
+ *
+ * @throw cudf::logic_error if patterns is empty.
+ *
+ * @param strings Strings instance for this operation.
+ * @param patterns Regex patterns to match to each string.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return New table with one boolean column per pattern.
+ */
+std::unique_ptr<table> contains_multiple_re(
+  strings_column_view const& strings,
+  std::vector<std::string> const& patterns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns a boolean column identifying rows which
  * matching the given regex pattern but only at the beginning the string.
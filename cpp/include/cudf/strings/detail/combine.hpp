@@ -41,6 +41,20 @@ std::unique_ptr<column> concatenate(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc concatenate(table_view const&,host_span<std::string const>,string_scalar
+ * const&,rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> concatenate(
+  table_view const& strings_columns,
+  host_span<std::string const> separators,
+  string_scalar const& narep          = string_scalar("", false),
+  separator_on_nulls separate_nulls   = separator_on_nulls::YES,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc join_strings(table_view const&,string_scalar const&,string_scalar
  * const&,rmm::mr::device_memory_resource*)
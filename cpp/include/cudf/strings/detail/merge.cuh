@@ -60,10 +60,14 @@ std::unique_ptr<column> merge(strings_column_view const& lhs,
   auto rhs_column = column_device_view::create(rhs.parent(), stream);
   auto d_rhs      = *rhs_column;
 
-  // caller will set the null mask
+  // caller will set the null mask; an order covering only a subset of the input rows
+  // (e.g. merge_upsert) makes the exact null count unknowable up front
   rmm::device_buffer null_mask{0, stream, mr};
-  size_type null_count = lhs.null_count() + rhs.null_count();
-  if (null_count > 0)
+  bool const has_nulls = lhs.has_nulls() or rhs.has_nulls();
+  size_type null_count = strings_count == lhs.size() + rhs.size()
+                           ? lhs.null_count() + rhs.null_count()
+                           : (has_nulls ? cudf::UNKNOWN_NULL_COUNT : 0);
+  if (has_nulls)
     null_mask = cudf::detail::create_null_mask(strings_count, mask_state::ALL_VALID, stream, mr);
 
   // build offsets column
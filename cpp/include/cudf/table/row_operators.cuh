@@ -29,6 +29,7 @@
 #include <thrust/transform_reduce.h>
 
 #include <limits>
+#include <type_traits>
 
 namespace cudf {
 
@@ -317,6 +318,30 @@ class element_relational_comparator {
   null_order null_precedence;
 };
 
+/**
+ * @brief Invokes the callable `f` with the table's column count as a compile-time constant.
+ *
+ * Row operators such as `row_hasher` and `row_lexicographic_comparator` loop over the columns of
+ * a row with a `type_dispatcher` call per element. Passing the column count as a template
+ * argument lets the compiler fully unroll that loop for the narrow keys that dominate join,
+ * groupby, and sort workloads. Tables wider than four columns fall back to the run-time loop.
+ *
+ * @param num_columns Number of columns in the table(s) the row operator will process
+ * @param f Callable invoked with a `std::integral_constant<size_type, N>`, where `N` is
+ * `num_columns` for tables of up to four columns and `-1` otherwise
+ */
+template <typename Functor>
+inline decltype(auto) column_count_dispatcher(size_type num_columns, Functor f)
+{
+  switch (num_columns) {
+    case 1: return f(std::integral_constant<size_type, 1>{});
+    case 2: return f(std::integral_constant<size_type, 2>{});
+    case 3: return f(std::integral_constant<size_type, 3>{});
+    case 4: return f(std::integral_constant<size_type, 4>{});
+    default: return f(std::integral_constant<size_type, -1>{});
+  }
+}
+
 /**
  * @brief Computes whether one row is lexicographically *less* than another row.
  *
@@ -331,8 +356,10 @@ class element_relational_comparator {
  * `aac < abb`.
  *
  * @tparam has_nulls Indicates the potential for null values in either row.
+ * @tparam num_columns Compile-time number of columns in a row, or `-1` when the column count is
+ * only known at run time. See `column_count_dispatcher`.
  */
-template <bool has_nulls = true>
+template <bool has_nulls = true, size_type num_columns = -1>
 class row_lexicographic_comparator {
  public:
   /**
@@ -374,7 +401,9 @@ class row_lexicographic_comparator {
    */
   __device__ bool operator()(size_type lhs_index, size_type rhs_index) const noexcept
   {
-    for (size_type i = 0; i < _lhs.num_columns(); ++i) {
+    // A compile-time trip count lets the compiler fully unroll this loop
+    auto const num_cols = (num_columns < 0) ? _lhs.num_columns() : num_columns;
+    for (size_type i = 0; i < num_cols; ++i) {
       bool ascending = (_column_order == nullptr) or (_column_order[i] == order::ASCENDING);
 
       weak_ordering state{weak_ordering::EQUIVALENT};
@@ -458,8 +487,12 @@ class element_hasher_with_seed {
  *
  * @tparam hash_function Hash functor to use for hashing elements.
  * @tparam has_nulls Indicates the potential for null values in the table.
+ * @tparam num_columns Compile-time number of columns in the table, or `-1` when the column count
+ * is only known at run time. See `column_count_dispatcher`.
  */
-template <template <typename> class hash_function, bool has_nulls = true>
+template <template <typename> class hash_function,
+          bool has_nulls        = true,
+          size_type num_columns = -1>
 class row_hasher {
  public:
   row_hasher() = delete;
@@ -490,12 +523,14 @@ class row_hasher {
         row_index);
     };
 
-    // Hash each element and combine all the hash values together
+    // Hash each element and combine all the hash values together. A compile-time trip count
+    // lets the compiler fully unroll this reduction
+    auto const num_cols = (num_columns < 0) ? _table.num_columns() : num_columns;
     return thrust::transform_reduce(
       thrust::seq,
       // note that this starts at 1 and not 0 now since we already hashed the first column
       thrust::make_counting_iterator(1),
-      thrust::make_counting_iterator(_table.num_columns()),
+      thrust::make_counting_iterator(num_cols),
       hasher,
       initial_hash,
       hash_combiner);
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+
+/**
+ * @brief Accumulates many small tables into one table with amortized copying.
+ *
+ * Repeatedly concatenating a micro-batch onto an accumulated table with
+ * `cudf::concatenate` re-copies every previously appended row, costing O(n^2)
+ * device traffic over a session. A `table_builder` instead reserves geometric
+ * capacity per column (including string character and offset buffers) and
+ * appends each batch in place, so every appended byte is copied O(1) times.
+ * `release` hands the accumulated data over as a `cudf::table` without copying
+ * it; the column buffers simply keep their reserved capacity.
+ *
+ * Fixed-width and string columns are supported. All appended tables must match
+ * the column types given at construction.
+ *
+ * @code{.pseudo}
+ * table_builder builder({data_type{type_id::INT32}, data_type{type_id::STRING}});
+ * for (auto const& batch : batches) { builder.append(batch); }
+ * auto result = builder.release();
+ * @endcode
+ */
+class table_builder {
+ public:
+  /**
+   * @brief Constructs an empty builder for tables with the given column types.
+   *
+   * @throws cudf::logic_error if any type is neither fixed-width nor STRING
+   *
+   * @param types The column types of the tables to be appended
+   * @param mr Device memory resource used to allocate the accumulated column data
+   */
+  explicit table_builder(
+    std::vector<data_type> types,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  table_builder(table_builder&&);
+  table_builder& operator=(table_builder&&);
+  table_builder(table_builder const&) = delete;
+  table_builder& operator=(table_builder const&) = delete;
+  ~table_builder();
+
+  /**
+   * @brief Appends the rows of `batch` to the accumulated table.
+   *
+   * Column buffers grow geometrically as needed, so appending n total rows in
+   * any number of batches performs O(n) bytes of copying overall.
+   *
+   * @throws cudf::logic_error if the column types of `batch` do not match the
+   * types given at construction
+   * @throws cudf::logic_error if the total number of rows or string characters
+   * would exceed `numeric_limits<size_type>::max()`
+   *
+   * @param batch The rows to append
+   */
+  void append(table_view const& batch);
+
+  /**
+   * @brief Returns the number of rows appended so far.
+   */
+  size_type num_rows() const;
+
+  /**
+   * @brief Returns the accumulated rows as a table, leaving the builder empty.
+   *
+   * No data is copied; the returned columns take ownership of the accumulated
+   * buffers, which retain their reserved capacity.
+   */
+  std::unique_ptr<table> release();
+
+ private:
+  struct impl;
+  std::unique_ptr<impl> _impl;
+};
+
+}  // namespace cudf
@@ -19,7 +19,11 @@
 #include <cudf/ast/expressions.hpp>
 #include <cudf/types.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
+#include <functional>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -43,6 +47,7 @@ namespace cudf {
  * @param unary_udf     The PTX/CUDA string of the unary function to apply
  * @param output_type   The output type that is compatible with the output type in the UDF
  * @param is_ptx        true: the UDF is treated as PTX code; false: the UDF is treated as CUDA code
+ * @param stream        CUDA stream used for device memory operations and kernel launches
  * @param mr            Device memory resource used to allocate the returned column's device memory
  * @return              The column resulting from applying the unary function to
  *                      every element of the input
@@ -52,6 +57,41 @@ std::unique_ptr<column> transform(
   std::string const& unary_udf,
   data_type output_type,
   bool is_ptx,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Creates a new column by applying an n-ary function against every
+ * row of a table of input columns.
+ *
+ * Computes:
+ * `out[i] = F(in0[i], in1[i], ..., inN[i])`
+ *
+ * The UDF takes one output parameter followed by one input parameter per
+ * column of `inputs`, in column order. The output null mask is the bitwise
+ * AND of the input null masks, so if any input is null at row `i` then
+ * `out[i]` is null; the UDF itself is not passed validity information (use
+ * `generalized_masked_op` for UDFs that need to observe or produce nulls
+ * explicitly).
+ *
+ * @throws cudf::logic_error if `inputs` has no columns
+ * @throws cudf::logic_error if any input column is not fixed-width
+ *
+ * @param inputs        The table of input columns to transform
+ * @param udf           The PTX/CUDA string of the n-ary function to apply
+ * @param output_type   The output type that is compatible with the output type in the UDF
+ * @param is_ptx        true: the UDF is treated as PTX code; false: the UDF is treated as CUDA code
+ * @param stream        CUDA stream used for device memory operations and kernel launches
+ * @param mr            Device memory resource used to allocate the returned column's device memory
+ * @return              The column resulting from applying the function to
+ *                      every row of the input table
+ */
+std::unique_ptr<column> transform(
+  table_view const& inputs,
+  std::string const& udf,
+  data_type output_type,
+  bool is_ptx,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 std::unique_ptr<column> generalized_masked_op(
@@ -85,12 +125,69 @@ std::pair<std::unique_ptr<rmm::device_buffer>, size_type> nans_to_nulls(
  *
  * @param table The table used for expression evaluation.
  * @param expr The root of the expression tree.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
  * @param mr Device memory resource.
  * @return std::unique_ptr<column> Output column.
  */
 std::unique_ptr<column> compute_column(
   table_view const& table,
   ast::expression const& expr,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Compute a new column by JIT compiling an expression tree to a fused kernel.
+ *
+ * Equivalent to `compute_column`, but instead of interpreting the expression's
+ * opcodes per row, the expression tree is rendered to CUDA source, compiled
+ * once with NVRTC, and cached on disk (see `LIBCUDF_KERNEL_CACHE_PATH`), so
+ * repeated evaluations of the same expression pay no per-row interpretation
+ * overhead and no recompilation cost. The first evaluation of a new expression
+ * pays the compilation latency, so this path is intended for hot, recurring
+ * expressions.
+ *
+ * This path supports a subset of `compute_column`: fixed-width non-nullable
+ * input columns, numeric literals, and operators with a direct CUDA source
+ * rendering (arithmetic, comparison, logical, bitwise and elementwise math
+ * operators).
+ *
+ * @throws cudf::logic_error if an input column is nullable or not fixed-width.
+ * @throws cudf::logic_error if the expression contains an unsupported operator
+ * or literal type.
+ *
+ * @param table The table used for expression evaluation.
+ * @param expr The root of the expression tree.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource.
+ * @return std::unique_ptr<column> Output column.
+ */
+std::unique_ptr<column> compute_column_jit(
+  table_view const& table,
+  ast::expression const& expr,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Compute new columns by evaluating several expression trees on a table.
+ *
+ * Equivalent to calling `compute_column` once per expression, except that the
+ * expressions are evaluated by a single fused kernel: the input columns are
+ * only read once per row, and operations appearing in more than one
+ * expression (common subexpressions) are only evaluated once.
+ *
+ * @throws cudf::logic_error if `exprs` is empty.
+ * @throws cudf::logic_error if passed an expression operating on table_reference::RIGHT.
+ *
+ * @param table The table used for expression evaluation.
+ * @param exprs The roots of the expression trees.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource.
+ * @return std::unique_ptr<table> Output columns, one per expression.
+ */
+std::unique_ptr<table> compute_columns(
+  table_view const& table,
+  std::vector<std::reference_wrapper<ast::expression const>> const& exprs,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -196,5 +293,27 @@ std::unique_ptr<column> row_bit_count(
   table_view const& t,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns an approximate cumulative size in bits of all columns in the `table_view` for
+ * each segment of rows.
+ *
+ * This is equivalent to summing the output of `row_bit_count` over each consecutive group of
+ * `segment_length` rows (the last segment may be shorter), but the reduction is performed on
+ * the device, so no per-row output is materialized for the caller. The same approximation
+ * caveats as `row_bit_count` apply.
+ *
+ * @throws cudf::logic_error if `segment_length` is not positive.
+ *
+ * @param t The table view to perform the computation on.
+ * @param segment_length The number of rows in each segment.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return A 32-bit integer column containing the per-segment bit counts,
+ * of size `ceil(t.num_rows() / segment_length)`.
+ */
+std::unique_ptr<column> segmented_row_bit_count(
+  table_view const& t,
+  size_type segment_length,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
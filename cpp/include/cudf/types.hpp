@@ -229,6 +229,7 @@ enum class type_id : int32_t {
   DECIMAL32,               ///< Fixed-point type with int32_t
   DECIMAL64,               ///< Fixed-point type with int64_t
   STRUCT,                  ///< Struct elements
+  DECIMAL128,              ///< Fixed-point type with __int128_t
   // `NUM_TYPE_IDS` must be last!
   NUM_TYPE_IDS  ///< Total number of type ids
 };
@@ -263,7 +264,7 @@ class data_type {
    */
   explicit data_type(type_id id, int32_t scale) : _id{id}, _fixed_point_scale{scale}
   {
-    assert(id == type_id::DECIMAL32 || id == type_id::DECIMAL64);
+    assert(id == type_id::DECIMAL32 || id == type_id::DECIMAL64 || id == type_id::DECIMAL128);
   }
 
   /**
@@ -335,7 +336,8 @@ enum class hash_id {
   HASH_MURMUR3,         ///< Murmur3 hash function
   HASH_MD5,             ///< MD5 hash function
   HASH_SERIAL_MURMUR3,  ///< Serial Murmur3 hash function
-  HASH_SPARK_MURMUR3    ///< Spark Murmur3 hash function
+  HASH_SPARK_MURMUR3,   ///< Spark Murmur3 hash function
+  HASH_XXHASH64         ///< 64-bit xxHash function
 };
 
 /**
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <functional>
+
+namespace cudf {
+
+/**
+ * @addtogroup utility_types
+ * @{
+ * @file
+ * @brief Capture-and-replay helper for repeated small-batch pipelines
+ *
+ * Launch overhead dominates pipelines that run the same short operator
+ * sequence on small batches. `cuda_graph` captures such a sequence once into a
+ * CUDA graph and replays it with a single launch.
+ *
+ * Capture only admits operations that neither synchronize the stream nor read
+ * results back to the host. Of the public APIs, `gather`, `binary_operation`
+ * and `compute_column` (on the stream being captured, see the stream
+ * parameters added to those APIs) qualify; operations whose output size
+ * depends on the data, such as `apply_boolean_mask`, must copy the size to the
+ * host and therefore cannot be captured. Memory allocated during capture must
+ * come from a resource that performs no CUDA calls at steady state (e.g. a
+ * warmed-up `rmm::mr::pool_memory_resource`), so run the sequence once before
+ * capturing it.
+ */
+class cuda_graph {
+ public:
+  /**
+   * @brief Captures `work` issued on `stream` into an executable graph.
+   *
+   * @throws cudf::cuda_error if the work performs an operation that is
+   * incompatible with stream capture
+   *
+   * @param work Callable issuing the operations to capture; it must submit all
+   * work to the stream it is passed
+   * @param stream CUDA stream on which the work is captured
+   * @return The captured, instantiated graph
+   */
+  static cuda_graph capture(std::function<void(rmm::cuda_stream_view)> const& work,
+                            rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Replays the captured work on `stream`.
+   *
+   * @param stream CUDA stream on which the graph is launched
+   */
+  void launch(rmm::cuda_stream_view stream) const;
+
+  ~cuda_graph();
+
+  cuda_graph(cuda_graph&& other) noexcept;
+  cuda_graph& operator=(cuda_graph&& other) noexcept;
+  cuda_graph(cuda_graph const&) = delete;
+  cuda_graph& operator=(cuda_graph const&) = delete;
+
+ private:
+  cuda_graph() = default;
+
+  cudaGraph_t _graph{nullptr};     ///< The captured graph
+  cudaGraphExec_t _exec{nullptr};  ///< The instantiated, launchable graph
+};
+
+/**
+ * @brief Indicates whether `stream` is currently being captured into a graph.
+ *
+ * Operations use this to skip host-side result reads (e.g. deferring a null
+ * count) that would otherwise invalidate an ongoing capture.
+ *
+ * @param stream CUDA stream to query
+ * @return true if the stream is in capture mode
+ */
+bool is_stream_capturing(rmm::cuda_stream_view stream);
+
+/** @} */  // end of group
+}  // namespace cudf
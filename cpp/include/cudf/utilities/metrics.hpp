@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <chrono>
+#include <functional>
+
+namespace cudf {
+
+/**
+ * @addtogroup utility_types
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Measurements reported for a single instrumented libcudf operation.
+ *
+ * The wall time is the host-side duration of the call. Kernels are launched
+ * asynchronously, so for operations that do not synchronize it measures launch
+ * and setup cost rather than device execution time; device-side time per
+ * operation is available from the NVTX ranges the same instrumentation emits.
+ * Scratch allocation attribution can be layered underneath with
+ * `rmm::mr::statistics_resource_adaptor` rather than being duplicated here.
+ */
+struct operation_metrics {
+  char const* name;                    ///< Name of the operation (function name)
+  size_type num_rows;                  ///< Number of rows processed by the operation
+  std::size_t num_bytes;               ///< Number of input bytes, or 0 if not reported
+  std::chrono::nanoseconds wall_time;  ///< Host-side duration of the call
+};
+
+/**
+ * @brief Callback type invoked with the metrics of each instrumented operation.
+ */
+using metrics_callback = std::function<void(operation_metrics const&)>;
+
+/**
+ * @brief Registers a callback invoked at the end of every instrumented libcudf call.
+ *
+ * The callback runs on the thread that made the libcudf call, after the public
+ * API returns control; it must be cheap and must not call back into libcudf.
+ * Passing an empty function disables metrics reporting (the default). Setting
+ * the callback while other threads are inside libcudf calls is not
+ * synchronized with those calls observing it.
+ *
+ * @param callback The callback to invoke, or an empty function to disable
+ */
+void set_metrics_callback(metrics_callback callback);
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/host_vector.h>
+#include <thrust/system/cuda/experimental/pinned_allocator.h>
+
+namespace cudf {
+
+/**
+ * @addtogroup utility_types
+ * @{
+ * @file
+ */
+
+/**
+ * @brief A host vector backed by page-locked (pinned) memory.
+ *
+ * Copies between pinned memory and the device are fully asynchronous and reach
+ * peak transfer bandwidth, while pageable host memory is staged through an
+ * internal driver buffer. Stage host data in a `pinned_vector` before handing
+ * it to stream-ordered factories such as the `host_span` overload of
+ * `make_fixed_width_column`. Pinned allocation itself is expensive, so reuse
+ * these vectors across batches rather than allocating per call.
+ */
+template <typename T>
+using pinned_vector =
+  thrust::host_vector<T, thrust::system::cuda::experimental::pinned_allocator<T>>;
+
+/** @} */  // end of group
+}  // namespace cudf
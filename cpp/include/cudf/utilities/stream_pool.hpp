@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/cuda_stream_pool.hpp>
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+
+/**
+ * @addtogroup utility_types
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Returns the process-wide pool of CUDA streams.
+ *
+ * Independent operations may be issued on different streams from this pool so
+ * that they can overlap on the device instead of serializing on the default
+ * stream. The pool is created on first use and holds
+ * `LIBCUDF_STREAM_POOL_SIZE` streams (16 if the environment variable is not
+ * set). Streams obtained from the pool remain valid for the lifetime of the
+ * process.
+ *
+ * @return The process-wide stream pool
+ */
+rmm::cuda_stream_pool& stream_pool();
+
+/**
+ * @brief Returns a stream from the process-wide pool.
+ *
+ * Successive calls cycle through the streams in the pool. This function is
+ * thread safe.
+ *
+ * @return A view of a pooled CUDA stream
+ */
+rmm::cuda_stream_view get_stream_from_pool();
+
+/** @} */  // end of group
+}  // namespace cudf
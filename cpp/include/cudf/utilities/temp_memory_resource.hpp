@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+namespace cudf {
+
+/**
+ * @addtogroup memory_resource
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Returns the memory resource used for operator-scoped temporaries.
+ *
+ * Large, short-lived scratch allocations (e.g. reader decompression buffers or
+ * join scratch) interleave badly with small, long-lived column allocations and
+ * fragment pool resources. Routing temporaries through a distinct resource
+ * keeps them out of the pool that backs column data.
+ *
+ * By default this returns `rmm::mr::get_current_device_resource()`, so
+ * behavior is unchanged. Setting the `LIBCUDF_TEMP_ARENA_SIZE` environment
+ * variable to a size in bytes instead lazily creates a process-wide arena of
+ * that initial size over the current device resource and returns it. A
+ * resource installed with `set_temp_memory_resource` takes precedence over
+ * both.
+ *
+ * @return The memory resource to use for temporary allocations
+ */
+rmm::mr::device_memory_resource* get_temp_memory_resource();
+
+/**
+ * @brief Sets the memory resource used for operator-scoped temporaries.
+ *
+ * The caller retains ownership of `mr` and must keep it alive for as long as
+ * it is installed. Pass `nullptr` to restore the default behavior described in
+ * `get_temp_memory_resource`.
+ *
+ * @param mr The new temporary memory resource, or `nullptr` to reset
+ * @return The previously installed resource, or `nullptr` if none was set
+ */
+rmm::mr::device_memory_resource* set_temp_memory_resource(rmm::mr::device_memory_resource* mr);
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+namespace cudf {
+
+/**
+ * @addtogroup utility_types
+ * @{
+ * @file
+ * @brief APIs for estimating the scratch memory of operations before running them
+ *
+ * These estimates let a caller admission-control work against a memory budget
+ * instead of catching `rmm::bad_alloc` mid-operation. They are upper-bound
+ * oriented host-side estimates derived from the sizing rules the
+ * implementations themselves use (e.g. the hash table occupancy of the hash
+ * join build); they do not account for allocator padding or fragmentation,
+ * and they exclude the operation's output, which the caller sizes from the
+ * result shape.
+ */
+
+/**
+ * @brief Describes the build side of a hash join for working-memory estimation.
+ */
+struct hash_join_memory_descriptor {
+  size_type num_build_rows;  ///< Number of rows in the build table
+};
+
+/**
+ * @brief Describes a sort (or sort-by-key) for working-memory estimation.
+ */
+struct sort_memory_descriptor {
+  size_type num_rows;        ///< Number of rows to sort
+  std::size_t key_row_bytes;  ///< Bytes per row across the key columns
+};
+
+/**
+ * @brief Estimates the scratch memory of building a hash join table.
+ *
+ * Covers the multimap sized for the implementation's hash table occupancy and
+ * the row hash values of the build table.
+ *
+ * @param descriptor Description of the build side of the join
+ * @return Estimated scratch bytes allocated from the memory resource
+ */
+std::size_t estimate_working_memory(hash_join_memory_descriptor const& descriptor);
+
+/**
+ * @brief Estimates the scratch memory of sorting.
+ *
+ * Covers the double-buffered keys and row indices of the radix sort used for
+ * fixed-width keys; comparison-based fallbacks for nested types allocate less.
+ *
+ * @param descriptor Description of the sort
+ * @return Estimated scratch bytes allocated from the memory resource
+ */
+std::size_t estimate_working_memory(sort_memory_descriptor const& descriptor);
+
+/**
+ * @brief Returns the bytes per row across the columns of `keys`.
+ *
+ * Convenience for filling `sort_memory_descriptor::key_row_bytes`. Fixed-width
+ * columns contribute their element size; variable-width columns contribute the
+ * size of their offsets, so the result underestimates string-heavy keys.
+ *
+ * @param keys The key columns
+ * @return Bytes per row across `keys`
+ */
+std::size_t fixed_width_row_bytes(table_view const& keys);
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -511,8 +511,9 @@ class fixed_point_column_wrapper : public detail::column_wrapper {
 
     auto const size         = cudf::distance(begin, end);
     auto const elements     = thrust::host_vector<Rep>(begin, end);
-    auto const is_decimal32 = std::is_same_v<Rep, int32_t>;
-    auto const id           = is_decimal32 ? type_id::DECIMAL32 : type_id::DECIMAL64;
+    auto const id           = std::is_same_v<Rep, int32_t>   ? type_id::DECIMAL32
+                              : std::is_same_v<Rep, int64_t> ? type_id::DECIMAL64
+                                                             : type_id::DECIMAL128;
     auto const data_type    = cudf::data_type{id, static_cast<int32_t>(scale)};
 
     wrapped.reset(new cudf::column{
@@ -576,8 +577,9 @@ class fixed_point_column_wrapper : public detail::column_wrapper {
 
     auto const size         = cudf::distance(begin, end);
     auto const elements     = thrust::host_vector<Rep>(begin, end);
-    auto const is_decimal32 = std::is_same_v<Rep, int32_t>;
-    auto const id           = is_decimal32 ? type_id::DECIMAL32 : type_id::DECIMAL64;
+    auto const id           = std::is_same_v<Rep, int32_t>   ? type_id::DECIMAL32
+                              : std::is_same_v<Rep, int64_t> ? type_id::DECIMAL64
+                                                             : type_id::DECIMAL128;
     auto const data_type    = cudf::data_type{id, static_cast<int32_t>(scale)};
 
     wrapped.reset(new cudf::column{
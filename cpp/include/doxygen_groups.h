@@ -87,6 +87,7 @@
  *     @defgroup aggregation_groupby GroupBy
  *     @defgroup aggregation_rolling Rolling Window
  *   @}
+ *   @defgroup column_histogram Histogram
  *   @defgroup column_transformation Transformation
  *   @{
  *     @defgroup transformation_unaryops Unary Operations
@@ -115,6 +116,10 @@
  *   @defgroup datetime_extract Extracting
  *   @defgroup datetime_compute Compute Day
  * @}
+ * @defgroup execution_apis Execution
+ * @{
+ *   @defgroup execution_plan Plan Execution
+ * @}
  * @defgroup strings_apis Strings
  * @{
  *   @defgroup strings_case Case
@@ -154,6 +159,7 @@
  * @}
  * @defgroup nvtext_apis NVText
  * @{
+ *   @defgroup nvtext_minhash MinHashing
  *   @defgroup nvtext_ngrams NGrams
  *   @defgroup nvtext_normalize Normalizing
  *   @defgroup nvtext_stemmer Stemming
@@ -89,5 +89,25 @@ std::unique_ptr<cudf::column> count_tokens(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc nvtext::tokenize_with_vocabulary(strings_column_view const&,strings_column_view
+ * const&,string_scalar const&,size_type,rmm::mr::device_memory_resource*)
+ *
+ * @param strings Strings column to tokenize.
+ * @param vocabulary Strings column of vocabulary entries.
+ * @param delimiter Characters used to separate each string into tokens.
+ * @param default_id The token id assigned for tokens not found in the vocabulary.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New INT32 column of token ids.
+ */
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(
+  cudf::strings_column_view const& strings,
+  cudf::strings_column_view const& vocabulary,
+  cudf::string_scalar const& delimiter = cudf::string_scalar{""},
+  cudf::size_type default_id           = -1,
+  rmm::cuda_stream_view stream         = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr  = rmm::mr::get_current_device_resource());
+
 }  // namespace detail
 }  // namespace nvtext
@@ -61,6 +61,50 @@ std::unique_ptr<cudf::column> edit_distance(
   cudf::strings_column_view const& targets,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Compute the edit distance between individual strings in two strings columns
+ * up to a given maximum distance.
+ *
+ * The `output[i]` is the edit distance between `strings[i]` and `targets[i]` if that
+ * distance is at most `max_distance`; otherwise `output[i]` is `max_distance + 1`.
+ *
+ * Restricting the distance allows a banded version of the Levenshtein algorithm
+ * which only evaluates cells within `max_distance` of the diagonal and terminates
+ * early once every cell in a band row exceeds `max_distance`. Pairs whose lengths
+ * differ by more than `max_distance` are resolved without any table computation.
+ * This is significantly faster than `nvtext::edit_distance` for small thresholds.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["hello", "", "world"]
+ * t = ["hallo", "goodbye", "world"]
+ * d = edit_distance_bounded(s, t, 2)
+ * d is now [1, 3, 0]
+ * @endcode
+ *
+ * Any null entries for either `strings` or `targets` is ignored and the edit distance
+ * is computed as though the null entry is an empty string.
+ *
+ * The `targets.size()` must equal `strings.size()` unless `targets.size()==1`.
+ * In this case, all `strings` will be computed against the single `targets[0]` string.
+ *
+ * @throw cudf::logic_error if `max_distance` is negative
+ * @throw cudf::logic_error if `targets.size() != strings.size()` and
+ *                          if `targets.size() != 1`
+ *
+ * @param strings Strings column of input strings
+ * @param targets Strings to compute edit distance against `strings`
+ * @param max_distance Maximum distance of interest; larger distances are
+ *        reported as `max_distance + 1`
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New INT32 column of edit distance values.
+ */
+std::unique_ptr<cudf::column> edit_distance_bounded(
+  cudf::strings_column_view const& strings,
+  cudf::strings_column_view const& targets,
+  cudf::size_type max_distance,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Compute the edit distance between all the strings in the input column.
  *
@@ -90,5 +90,34 @@ std::unique_ptr<cudf::column> generate_character_ngrams(
   cudf::size_type ngrams              = 2,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Hashes ngrams of characters within each string.
+ *
+ * Each character ngram is hashed directly from the source characters using
+ * MurmurHash32 -- the ngram strings themselves are never materialized.
+ * The result is a lists column where each row holds the ngram hash values
+ * for the corresponding input string.
+ *
+ * ```
+ * ["ab", "cde"] would generate bigram hashes as
+ * [[hash("ab")], [hash("cd"), hash("de")]]
+ * ```
+ *
+ * Null and empty rows produce empty lists in the output.
+ *
+ * @throw cudf::logic_error if `ngrams < 2`
+ * @throw cudf::logic_error if there are not enough characters to generate any ngrams
+ *
+ * @param strings Strings column to produce ngram hashes from.
+ * @param ngrams The ngram number to generate.
+ *               Default is 2 = bigram.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New lists column of UINT32 hash values.
+ */
+std::unique_ptr<cudf::column> hash_character_ngrams(
+  cudf::strings_column_view const& strings,
+  cudf::size_type ngrams              = 2,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
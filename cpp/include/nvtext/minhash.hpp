@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+namespace nvtext {
+/**
+ * @addtogroup nvtext_minhash
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Returns the MinHash signature of each string.
+ *
+ * The signature for a string is `num_hashes` values where value `i` is the
+ * minimum of MurmurHash32 seeded with `i` over all `width`-character
+ * substrings of that string. The hashes are computed directly from the source
+ * characters in a single pass -- no substrings are materialized.
+ *
+ * Strings with fewer than `width` characters are hashed as a single
+ * substring. Null rows produce empty lists in the output.
+ *
+ * @throw cudf::logic_error if `width < 2`
+ * @throw cudf::logic_error if `num_hashes < 1`
+ *
+ * @param strings Strings column to compute signatures for.
+ * @param width The character width of the substrings to hash.
+ *              Default is 4 characters.
+ * @param num_hashes The number of hash values per signature.
+ *                   Default is 16 values.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New lists column of UINT32 signature values.
+ */
+std::unique_ptr<cudf::column> minhash(
+  cudf::strings_column_view const& strings,
+  cudf::size_type width               = 4,
+  cudf::size_type num_hashes          = 16,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace nvtext
@@ -97,6 +97,88 @@ struct tokenizer_result {
   std::unique_ptr<cudf::column> tensor_metadata;
 };
 
+/**
+ * @brief Reusable subword tokenizer holding the vocabulary in device memory.
+ *
+ * Construction loads the vocabulary into device memory and allocates the
+ * normalizer tables so repeated `tokenize()` calls do not pay these costs
+ * again. Use this instead of the free `subword_tokenize` functions when
+ * tokenizing many strings columns with the same vocabulary and parameters.
+ *
+ * The tokenizer parameters are fixed at construction and apply to every
+ * `tokenize()` call. See `nvtext::subword_tokenize` for their descriptions.
+ */
+class subword_tokenizer {
+ public:
+  /**
+   * @brief Construct from a pre-loaded vocabulary.
+   *
+   * @throw cudf::logic_error if `vocabulary` is null
+   * @throw cudf::logic_error if `stride > max_sequence_length`
+   * @throw cudf::logic_error if `max_sequence_length * max_rows_tensor` is
+   *        larger than the max value for cudf::size_type
+   *
+   * @param vocabulary The vocabulary table; ownership is transferred to this object.
+   * @param max_sequence_length Limit of the number of token-ids per row in final tensor
+   *        for each string.
+   * @param stride Each row in the output token-ids will replicate `max_sequence_length - stride`
+   *        the token-ids from the previous row, unless it is the first string.
+   * @param do_lower_case If true, the tokenizer will convert uppercase characters in the
+   *        input stream to lower-case and strip accents from those characters.
+   * @param do_truncate If true, the tokenizer will discard all the token-ids after
+   *        `max_sequence_length` for each input string.
+   * @param max_rows_tensor Maximum number of rows for the output token-ids expected
+   *        to be generated by the tokenizer for any single `tokenize()` call.
+   */
+  subword_tokenizer(std::unique_ptr<hashed_vocabulary> vocabulary,
+                    uint32_t max_sequence_length,
+                    uint32_t stride,
+                    bool do_lower_case,
+                    bool do_truncate,
+                    uint32_t max_rows_tensor);
+
+  /**
+   * @copydoc subword_tokenizer(std::unique_ptr<hashed_vocabulary>,uint32_t,uint32_t,bool,bool,uint32_t)
+   *
+   * This constructor loads the vocabulary from the given file.
+   *
+   * @param filename_hashed_vocabulary A path to the preprocessed vocab.txt file.
+   *        Note that this is the file AFTER python/perfect_hash.py has been used
+   *        for preprocessing.
+   */
+  subword_tokenizer(std::string const& filename_hashed_vocabulary,
+                    uint32_t max_sequence_length,
+                    uint32_t stride,
+                    bool do_lower_case,
+                    bool do_truncate,
+                    uint32_t max_rows_tensor);
+
+  subword_tokenizer() = delete;
+  ~subword_tokenizer();
+  subword_tokenizer(subword_tokenizer const&) = delete;
+  subword_tokenizer(subword_tokenizer&&)      = delete;
+  subword_tokenizer& operator=(subword_tokenizer const&) = delete;
+  subword_tokenizer& operator=(subword_tokenizer&&) = delete;
+
+  /**
+   * @brief Tokenize a strings column using the vocabulary held by this object.
+   *
+   * Produces the same result as calling `nvtext::subword_tokenize` with this
+   * object's vocabulary and parameters.
+   *
+   * @param strings The input strings to tokenize.
+   * @param mr Memory resource to allocate any returned objects.
+   * @return token-ids, attention-mask, and metadata
+   */
+  tokenizer_result tokenize(
+    cudf::strings_column_view const& strings,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+ private:
+  struct tokenizer_impl;
+  std::unique_ptr<tokenizer_impl> _impl;
+};
+
 /**
  * @brief Creates a tokenizer that cleans the text, splits it into tokens and
  *        returns token-ids from an input vocabulary.
@@ -176,6 +176,43 @@ std::unique_ptr<cudf::column> character_tokenize(
   cudf::strings_column_view const& strings,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a single column of token ids by tokenizing the input strings
+ * column and looking up each token in the given vocabulary.
+ *
+ * Tokens are identified the same way as in `nvtext::tokenize` and appear in the
+ * output in the same order. Instead of materializing the token strings, each
+ * token is hashed in place and resolved against `vocabulary`: the output id is
+ * the row index of the matching vocabulary entry, or `default_id` if the token
+ * does not appear in the vocabulary.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["hello world", null, "goodbye world"]
+ * v = ["goodbye", "hello", "world"]
+ * t = tokenize_with_vocabulary(s, v)
+ * t is now [1, 2, 0, 2]
+ * @endcode
+ *
+ * All null row entries are ignored and the output contains ids for all valid rows.
+ *
+ * @throw cudf::logic_error if `vocabulary` is empty or contains nulls
+ *
+ * @param strings Strings column to tokenize.
+ * @param vocabulary Strings column of vocabulary entries; entries are expected to be unique.
+ * @param delimiter UTF-8 characters used to separate each string into tokens.
+ *                  The default of empty string will separate tokens using whitespace.
+ * @param default_id The token id assigned for tokens not found in the vocabulary.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New INT32 column of token ids.
+ */
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(
+  cudf::strings_column_view const& strings,
+  cudf::strings_column_view const& vocabulary,
+  cudf::string_scalar const& delimiter = cudf::string_scalar{""},
+  cudf::size_type default_id           = -1,
+  rmm::mr::device_memory_resource* mr  = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Creates a strings column from a strings column of tokens and an
  * associated column of row ids.
@@ -74,6 +74,61 @@ class kafka_consumer : public cudf::io::datasource {
                  int batch_timeout,
                  std::string const& delimiter);
 
+  /**
+   * @brief Instantiate a Kafka consumer object that consumes into a pinned host ring buffer.
+   *
+   * Messages are written directly into pinned (page-locked) host memory instead of a pageable
+   * `std::string`, so readers that copy the data to the GPU only make a single copy from the
+   * broker payloads to the device. The buffer is reused as a ring across batches; call
+   * `consume_batch()` to consume the next batch of messages once the current one has been read.
+   *
+   * @throws cudf::logic_error if pinned_buffer_size is zero or the allocation fails
+   *
+   * @param configs key/value pairs of librdkafka configurations that will be
+   *                passed to the librdkafka client
+   * @param topic_name name of the Kafka topic to consume from
+   * @param partition partition index to consume from between `0` and `TOPIC_NUM_PARTITIONS - 1`
+   * inclusive
+   * @param start_offset seek position for the specified TOPPAR (Topic/Partition combo)
+   * @param end_offset position in the specified TOPPAR to read to
+   * @param batch_timeout maximum (millisecond) read time allowed. If end_offset is not reached
+   * before batch_timeout, a smaller subset will be returned
+   * @param delimiter optional delimiter to insert into the output between kafka messages, Ex: "\n"
+   * @param pinned_buffer_size size in bytes of the pinned ring buffer. A batch never exceeds this
+   * size; messages that do not fit are left for the next batch
+   */
+  kafka_consumer(std::map<std::string, std::string> const& configs,
+                 std::string const& topic_name,
+                 int partition,
+                 int64_t start_offset,
+                 int64_t end_offset,
+                 int batch_timeout,
+                 std::string const& delimiter,
+                 std::size_t pinned_buffer_size);
+
+  /**
+   * @brief Consume the next batch of messages into the pinned ring buffer
+   *
+   * The new batch replaces the current one, so the current batch must be fully read before this
+   * is called. Consumption resumes at the message offset following the last batch and stops at
+   * `end_offset`, at `batch_timeout`, or when the ring buffer is full, whichever comes first.
+   * `size()` and `host_read()` reflect the new batch once this returns.
+   *
+   * @throws cudf::logic_error if the consumer was not created with a pinned buffer
+   *
+   * @return Number of messages consumed into the batch
+   */
+  int64_t consume_batch();
+
+  /**
+   * @brief Get the Kafka offset of the last message consumed into the current batch
+   *
+   * This is the offset to hand to `commit_offset()` once the batch has been processed.
+   *
+   * @return Offset of the last consumed message, or `-1` if no message has been consumed
+   */
+  int64_t last_consumed_offset() const;
+
   /**
    * @brief Returns a buffer with a subset of data from Kafka Topic
    *
@@ -172,7 +227,7 @@ class kafka_consumer : public cudf::io::datasource {
    */
   void unsubscribe();
 
-  virtual ~kafka_consumer(){};
+  virtual ~kafka_consumer();
 
  private:
   std::unique_ptr<RdKafka::Conf> kafka_conf;  // RDKafka configuration object
@@ -188,6 +243,15 @@ class kafka_consumer : public cudf::io::datasource {
 
   std::string buffer;
 
+  // Pinned ring buffer state; pinned_data is only allocated when the consumer is created
+  // with a pinned buffer size and otherwise the std::string buffer above is used
+  char* pinned_data            = nullptr;
+  std::size_t pinned_capacity  = 0;
+  std::size_t batch_begin      = 0;   // byte position of the current batch within the ring
+  std::size_t batch_size       = 0;   // number of bytes in the current batch
+  int64_t next_offset          = 0;   // Kafka offset the next batch resumes from
+  int64_t last_offset          = -1;  // Kafka offset of the last consumed message
+
  private:
   RdKafka::ErrorCode update_consumer_topic_partition_assignment(std::string const& topic,
                                                                 int partition,
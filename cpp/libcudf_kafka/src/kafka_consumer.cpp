@@ -16,7 +16,10 @@
 
 #include "cudf_kafka/kafka_consumer.hpp"
 #include <librdkafka/rdkafkacpp.h>
+#include <cuda_runtime.h>
+#include <cudf/utilities/error.hpp>
 #include <chrono>
+#include <cstring>
 #include <memory>
 
 namespace cudf {
@@ -81,22 +84,128 @@ kafka_consumer::kafka_consumer(std::map<std::string, std::string> const& configs
   consume_to_buffer();
 }
 
+kafka_consumer::kafka_consumer(std::map<std::string, std::string> const& configs,
+                               std::string const& topic_name,
+                               int partition,
+                               int64_t start_offset,
+                               int64_t end_offset,
+                               int batch_timeout,
+                               std::string const& delimiter,
+                               std::size_t pinned_buffer_size)
+  : topic_name(topic_name),
+    partition(partition),
+    start_offset(start_offset),
+    end_offset(end_offset),
+    batch_timeout(batch_timeout),
+    delimiter(delimiter),
+    next_offset(start_offset)
+{
+  CUDF_EXPECTS(pinned_buffer_size > 0, "Pinned buffer size must be greater than zero");
+
+  kafka_conf = std::unique_ptr<RdKafka::Conf>(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL));
+
+  for (auto const& key_value : configs) {
+    std::string error_string;
+    CUDF_EXPECTS(RdKafka::Conf::ConfResult::CONF_OK ==
+                   kafka_conf->set(key_value.first, key_value.second, error_string),
+                 "Invalid Kafka configuration");
+  }
+
+  // Kafka 0.9 > requires group.id in the configuration
+  std::string conf_val;
+  CUDF_EXPECTS(RdKafka::Conf::ConfResult::CONF_OK == kafka_conf->get("group.id", conf_val),
+               "Kafka group.id must be configured");
+
+  std::string errstr;
+  consumer = std::unique_ptr<RdKafka::KafkaConsumer>(
+    RdKafka::KafkaConsumer::create(kafka_conf.get(), errstr));
+
+  CUDA_TRY(cudaMallocHost(reinterpret_cast<void**>(&pinned_data), pinned_buffer_size));
+  pinned_capacity = pinned_buffer_size;
+
+  // Pre fill the ring buffer with the first batch of messages so the
+  // datasource->size() invocation will return a valid size.
+  consume_batch();
+}
+
+kafka_consumer::~kafka_consumer()
+{
+  if (pinned_data != nullptr) { cudaFreeHost(pinned_data); }
+}
+
+int64_t kafka_consumer::consume_batch()
+{
+  CUDF_EXPECTS(pinned_data != nullptr, "Consumer was not created with a pinned buffer");
+
+  update_consumer_topic_partition_assignment(topic_name, partition, next_offset);
+
+  // The new batch starts where the previous batch ended, wrapping around to the
+  // front of the ring once the end of the allocation is reached. Batches are kept
+  // contiguous so host_read can hand out zero-copy views of the pinned memory.
+  batch_begin = batch_begin + batch_size >= pinned_capacity ? 0 : batch_begin + batch_size;
+  batch_size  = 0;
+
+  int64_t messages_read = 0;
+  auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_timeout);
+
+  while (next_offset < end_offset && end > std::chrono::steady_clock::now()) {
+    std::unique_ptr<RdKafka::Message> msg{
+      consumer->consume((end - std::chrono::steady_clock::now()).count())};
+
+    if (msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR) {
+      std::size_t const message_size = msg->len() + delimiter.size();
+      if (batch_begin + batch_size + message_size > pinned_capacity) {
+        if (batch_size == 0 && message_size <= pinned_capacity) {
+          // The batch is empty so it can wrap to the front of the ring
+          batch_begin = 0;
+        } else {
+          // No room left in this batch. The consumer is re-assigned to this message's
+          // offset on the next call so the message is consumed again rather than lost.
+          next_offset = msg->offset();
+          break;
+        }
+      }
+      char* write_position = pinned_data + batch_begin + batch_size;
+      std::memcpy(write_position, msg->payload(), msg->len());
+      std::memcpy(write_position + msg->len(), delimiter.data(), delimiter.size());
+      batch_size += message_size;
+      last_offset = msg->offset();
+      next_offset = last_offset + 1;
+      messages_read++;
+    } else if (msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
+      // If there are no more messages return
+      break;
+    }
+  }
+
+  return messages_read;
+}
+
+int64_t kafka_consumer::last_consumed_offset() const { return last_offset; }
+
 std::unique_ptr<cudf::io::datasource::buffer> kafka_consumer::host_read(size_t offset, size_t size)
 {
-  if (offset > buffer.size()) { return 0; }
-  size = std::min(size, buffer.size() - offset);
-  return std::make_unique<non_owning_buffer>((uint8_t*)buffer.data() + offset, size);
+  auto const* data      = pinned_data != nullptr ? pinned_data + batch_begin : buffer.data();
+  auto const data_size  = pinned_data != nullptr ? batch_size : buffer.size();
+  if (offset > data_size) { return 0; }
+  size = std::min(size, data_size - offset);
+  return std::make_unique<non_owning_buffer>((uint8_t*)data + offset, size);
 }
 
 size_t kafka_consumer::host_read(size_t offset, size_t size, uint8_t* dst)
 {
-  if (offset > buffer.size()) { return 0; }
-  auto const read_size = std::min(size, buffer.size() - offset);
-  memcpy(dst, buffer.data() + offset, size);
+  auto const* data      = pinned_data != nullptr ? pinned_data + batch_begin : buffer.data();
+  auto const data_size  = pinned_data != nullptr ? batch_size : buffer.size();
+  if (offset > data_size) { return 0; }
+  auto const read_size = std::min(size, data_size - offset);
+  memcpy(dst, data + offset, read_size);
   return read_size;
 }
 
-size_t kafka_consumer::size() const { return buffer.size(); }
+size_t kafka_consumer::size() const
+{
+  return pinned_data != nullptr ? batch_size : buffer.size();
+}
 
 /**
  * Change the TOPPAR assignment for this consumer instance
@@ -36,6 +36,20 @@ TEST_F(KafkaDatasourceTest, MissingGroupID)
 
   EXPECT_THROW(kafka::kafka_consumer kc(kafka_configs, "csv-topic", 0, 0, 3, 5000, "\n"),
                cudf::logic_error);
+
+  // The pinned buffer consumer has the same group.id requirement
+  EXPECT_THROW(kafka::kafka_consumer kc(kafka_configs, "csv-topic", 0, 0, 3, 5000, "\n", 4096),
+               cudf::logic_error);
+}
+
+TEST_F(KafkaDatasourceTest, ZeroSizedPinnedBuffer)
+{
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs.insert({"bootstrap.servers", "localhost:9092"});
+  kafka_configs.insert({"group.id", "libcudf-test"});
+
+  EXPECT_THROW(kafka::kafka_consumer kc(kafka_configs, "csv-topic", 0, 0, 3, 5000, "\n", 0),
+               cudf::logic_error);
 }
 
 TEST_F(KafkaDatasourceTest, InvalidConfigValues)
@@ -16,6 +16,7 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <memory>
@@ -136,6 +137,30 @@ std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
   return visit(col_type, static_cast<aggregation const&>(agg));
 }
 
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, approx_nunique_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, top_k_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, tdigest_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, merge_tdigest_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
 std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
   data_type col_type, nth_element_aggregation const& agg)
 {
@@ -291,6 +316,26 @@ void aggregation_finalizer::visit(nunique_aggregation const& agg)
   visit(static_cast<aggregation const&>(agg));
 }
 
+void aggregation_finalizer::visit(approx_nunique_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
+void aggregation_finalizer::visit(top_k_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
+void aggregation_finalizer::visit(tdigest_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
+void aggregation_finalizer::visit(merge_tdigest_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
 void aggregation_finalizer::visit(nth_element_aggregation const& agg)
 {
   visit(static_cast<aggregation const&>(agg));
@@ -533,6 +578,55 @@ template std::unique_ptr<aggregation> make_nunique_aggregation<aggregation>(
 template std::unique_ptr<groupby_aggregation> make_nunique_aggregation<groupby_aggregation>(
   null_policy null_handling);
 
+/// Factory to create an APPROX_NUNIQUE aggregation
+template <typename Base>
+std::unique_ptr<Base> make_approx_nunique_aggregation(null_policy null_handling,
+                                                      size_type precision)
+{
+  CUDF_EXPECTS(precision >= 4 and precision <= 18,
+               "APPROX_NUNIQUE precision must be in [4, 18]");
+  return std::make_unique<detail::approx_nunique_aggregation>(null_handling, precision);
+}
+template std::unique_ptr<aggregation> make_approx_nunique_aggregation<aggregation>(
+  null_policy null_handling, size_type precision);
+template std::unique_ptr<groupby_aggregation> make_approx_nunique_aggregation<groupby_aggregation>(
+  null_policy null_handling, size_type precision);
+
+/// Factory to create a TOP_K aggregation
+template <typename Base>
+std::unique_ptr<Base> make_top_k_aggregation(size_type k, order ord)
+{
+  CUDF_EXPECTS(k >= 1 and k <= 32, "TOP_K k must be in [1, 32]");
+  return std::make_unique<detail::top_k_aggregation>(k, ord);
+}
+template std::unique_ptr<aggregation> make_top_k_aggregation<aggregation>(size_type k, order ord);
+template std::unique_ptr<groupby_aggregation> make_top_k_aggregation<groupby_aggregation>(
+  size_type k, order ord);
+
+/// Factory to create a TDIGEST aggregation
+template <typename Base>
+std::unique_ptr<Base> make_tdigest_aggregation(size_type max_centroids)
+{
+  CUDF_EXPECTS(max_centroids >= 1, "TDIGEST max_centroids must be at least 1");
+  return std::make_unique<detail::tdigest_aggregation>(max_centroids);
+}
+template std::unique_ptr<aggregation> make_tdigest_aggregation<aggregation>(
+  size_type max_centroids);
+template std::unique_ptr<groupby_aggregation> make_tdigest_aggregation<groupby_aggregation>(
+  size_type max_centroids);
+
+/// Factory to create a MERGE_TDIGEST aggregation
+template <typename Base>
+std::unique_ptr<Base> make_merge_tdigest_aggregation(size_type max_centroids)
+{
+  CUDF_EXPECTS(max_centroids >= 1, "MERGE_TDIGEST max_centroids must be at least 1");
+  return std::make_unique<detail::merge_tdigest_aggregation>(max_centroids);
+}
+template std::unique_ptr<aggregation> make_merge_tdigest_aggregation<aggregation>(
+  size_type max_centroids);
+template std::unique_ptr<groupby_aggregation> make_merge_tdigest_aggregation<groupby_aggregation>(
+  size_type max_centroids);
+
 /// Factory to create an NTH_ELEMENT aggregation
 template <typename Base>
 std::unique_ptr<Base> make_nth_element_aggregation(size_type n, null_policy null_handling)
@@ -676,8 +770,9 @@ struct target_type_functor {
   constexpr data_type operator()() const noexcept
   {
     auto const id = type_to_id<target_type_t<Source, k>>();
-    return id == type_id::DECIMAL32 || id == type_id::DECIMAL64 ? data_type{id, type.scale()}
-                                                                : data_type{id};
+    return id == type_id::DECIMAL32 || id == type_id::DECIMAL64 || id == type_id::DECIMAL128
+             ? data_type{id, type.scale()}
+             : data_type{id};
   }
 };
 
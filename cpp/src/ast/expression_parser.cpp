@@ -38,11 +38,13 @@ namespace detail {
 device_data_reference::device_data_reference(device_data_reference_type reference_type,
                                              cudf::data_type data_type,
                                              cudf::size_type data_index,
-                                             table_reference table_source)
+                                             table_reference table_source,
+                                             cudf::size_type row_shift)
   : reference_type(reference_type),
     data_type(data_type),
     data_index(data_index),
-    table_source(table_source)
+    table_source(table_source),
+    row_shift(row_shift)
 {
 }
 
@@ -52,7 +54,8 @@ device_data_reference::device_data_reference(device_data_reference_type referenc
   : reference_type(reference_type),
     data_type(data_type),
     data_index(data_index),
-    table_source(table_reference::LEFT)
+    table_source(table_reference::LEFT),
+    row_shift(0)
 {
 }
 
@@ -85,7 +88,7 @@ cudf::size_type expression_parser::intermediate_counter::find_first_missing() co
 
 cudf::size_type expression_parser::visit(literal const& expr)
 {
-  if (_expression_count == 0) {
+  if (_expression_count == _root_expression_index) {
     // Handle the trivial case of a literal as the entire expression.
     return visit(operation(ast_operator::IDENTITY, expr));
   } else {
@@ -103,7 +106,7 @@ cudf::size_type expression_parser::visit(literal const& expr)
 
 cudf::size_type expression_parser::visit(column_reference const& expr)
 {
-  if (_expression_count == 0) {
+  if (_expression_count == _root_expression_index) {
     // Handle the trivial case of a column reference as the entire expression.
     return visit(operation(ast_operator::IDENTITY, expr));
   } else {
@@ -126,7 +129,8 @@ cudf::size_type expression_parser::visit(column_reference const& expr)
     auto const source = detail::device_data_reference(detail::device_data_reference_type::COLUMN,
                                                       data_type,
                                                       expr.get_column_index(),
-                                                      expr.get_table_source());
+                                                      expr.get_table_source(),
+                                                      expr.get_row_shift());
     return add_data_reference(source);
   }
 }
@@ -149,27 +153,40 @@ cudf::size_type expression_parser::visit(operation const& expr)
     CUDF_FAIL("An AST expression was provided non-matching operand types.");
   }
 
-  // Give back intermediate storage locations that are consumed by this operation
-  std::for_each(
-    operand_data_ref_indices.cbegin(),
-    operand_data_ref_indices.cend(),
-    [this](auto const& data_reference_index) {
-      auto const operand_source = _data_references[data_reference_index];
-      if (operand_source.reference_type == detail::device_data_reference_type::INTERMEDIATE) {
-        auto const intermediate_index = operand_source.data_index;
-        _intermediate_counter.give(intermediate_index);
-      }
-    });
+  auto const op            = expr.get_operator();
+  auto const is_root       = expression_index == _root_expression_index;
+  auto const cache_key     = std::make_pair(op, operand_data_ref_indices);
+  if (_share_subexpressions && !is_root) {
+    // Reuse an identical operation that has already been linearized. This is
+    // safe because intermediate storage locations are never given back (and
+    // therefore never overwritten) when subexpressions are shared.
+    auto const it = _operation_cache.find(cache_key);
+    if (it != _operation_cache.cend()) { return it->second; }
+  }
+  if (!_share_subexpressions) {
+    // Give back intermediate storage locations that are consumed by this operation
+    std::for_each(
+      operand_data_ref_indices.cbegin(),
+      operand_data_ref_indices.cend(),
+      [this](auto const& data_reference_index) {
+        auto const operand_source = _data_references[data_reference_index];
+        if (operand_source.reference_type == detail::device_data_reference_type::INTERMEDIATE) {
+          auto const intermediate_index = operand_source.data_index;
+          _intermediate_counter.give(intermediate_index);
+        }
+      });
+  }
   // Resolve expression type
-  auto const op        = expr.get_operator();
   auto const data_type = cudf::ast::detail::ast_operator_return_type(op, operand_types);
   _operators.push_back(op);
   // Push data reference
   auto const output = [&]() {
-    if (expression_index == 0) {
+    if (is_root) {
       // This expression is the root. Output should be directed to the output column.
-      return detail::device_data_reference(
-        detail::device_data_reference_type::COLUMN, data_type, 0, table_reference::OUTPUT);
+      return detail::device_data_reference(detail::device_data_reference_type::COLUMN,
+                                           data_type,
+                                           _current_output_index,
+                                           table_reference::OUTPUT);
     } else {
       // This expression is not the root. Output is an intermediate value.
       // Ensure that the output type is fixed width and fits in the intermediate storage.
@@ -190,6 +207,7 @@ cudf::size_type expression_parser::visit(operation const& expr)
                                   operand_data_ref_indices.cbegin(),
                                   operand_data_ref_indices.cend());
   _operator_source_indices.push_back(index);
+  if (_share_subexpressions && !is_root) { _operation_cache.emplace(cache_key, index); }
   return index;
 }
 
@@ -199,6 +217,17 @@ cudf::data_type expression_parser::output_type() const
                                   : _data_references.back().data_type;
 }
 
+std::vector<cudf::data_type> expression_parser::output_types() const
+{
+  auto types = std::vector<cudf::data_type>();
+  types.reserve(_output_data_ref_indices.size());
+  std::transform(_output_data_ref_indices.cbegin(),
+                 _output_data_ref_indices.cend(),
+                 std::back_inserter(types),
+                 [this](auto const index) { return _data_references[index].data_type; });
+  return types;
+}
+
 std::vector<cudf::size_type> expression_parser::visit_operands(
   std::vector<std::reference_wrapper<expression const>> operands)
 {
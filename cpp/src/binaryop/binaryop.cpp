@@ -29,8 +29,11 @@
 #include <cudf/binaryop.hpp>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/instrumentation.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
@@ -61,7 +64,7 @@ rmm::device_buffer scalar_col_valid_mask_and(column_view const& col,
 
   if (not s.is_valid()) {
     return cudf::detail::create_null_mask(col.size(), mask_state::ALL_NULL, stream, mr);
-  } else if (s.is_valid() and col.nullable()) {
+  } else if (s.is_valid() and col.has_nulls()) {
     return cudf::detail::copy_bitmask(col, stream, mr);
   } else {
     return rmm::device_buffer{0, stream, mr};
@@ -278,9 +281,13 @@ std::unique_ptr<column> binary_operation(LhsType const& lhs,
                                          binary_operator op,
                                          data_type output_type,
                                          rmm::cuda_stream_view stream,
-                                         rmm::mr::device_memory_resource* mr)
+                                         rmm::mr::device_memory_resource* mr,
+                                         scalar_validity validity_policy = scalar_validity::READ_ON_HOST)
 {
-  if constexpr (std::is_same_v<LhsType, column_view> and std::is_same_v<RhsType, column_view>)
+  constexpr bool has_scalar_operand =
+    not(std::is_same_v<LhsType, column_view> and std::is_same_v<RhsType, column_view>);
+
+  if constexpr (not has_scalar_operand)
     CUDF_EXPECTS(lhs.size() == rhs.size(), "Column sizes don't match");
 
   if (lhs.type().id() == type_id::STRING and rhs.type().id() == type_id::STRING and
@@ -291,7 +298,14 @@ std::unique_ptr<column> binary_operation(LhsType const& lhs,
   if (not cudf::binops::compiled::is_supported_operation(output_type, lhs.type(), rhs.type(), op))
     CUDF_FAIL("Unsupported operator for these types");
 
-  auto out = make_fixed_width_column_for_output(lhs, rhs, op, output_type, stream, mr);
+  auto out = [&] {
+    if constexpr (has_scalar_operand) {
+      return make_fixed_width_column_for_output(
+        lhs, rhs, op, output_type, stream, mr, validity_policy);
+    } else {
+      return make_fixed_width_column_for_output(lhs, rhs, op, output_type, stream, mr);
+    }
+  }();
 
   if constexpr (std::is_same_v<LhsType, column_view>)
     if (lhs.is_empty()) return out;
@@ -324,19 +338,26 @@ namespace detail {
  * @param rhs Right-hand side `column_view` used in the binary operation
  * @param op `binary_operator` to be used to combine `lhs` and `rhs`
  * @param output_type `data_type` of the output column
+ * @param validity_policy Whether the scalar validity is read on the host or on the device
  * @param mr Device memory resource to use for device memory allocation
  * @param stream CUDA stream used for device memory operations
  * @return std::unique_ptr<column> Output column used for binary operation
  */
-std::unique_ptr<column> make_fixed_width_column_for_output(scalar const& lhs,
-                                                           column_view const& rhs,
-                                                           binary_operator op,
-                                                           data_type output_type,
-                                                           rmm::cuda_stream_view stream,
-                                                           rmm::mr::device_memory_resource* mr)
+std::unique_ptr<column> make_fixed_width_column_for_output(
+  scalar const& lhs,
+  column_view const& rhs,
+  binary_operator op,
+  data_type output_type,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr,
+  scalar_validity validity_policy = scalar_validity::READ_ON_HOST)
 {
   if (binops::is_null_dependent(op)) {
     return make_fixed_width_column(output_type, rhs.size(), mask_state::ALL_VALID, stream, mr);
+  } else if (validity_policy == scalar_validity::READ_ON_DEVICE) {
+    auto new_mask = binops::compiled::scalar_col_valid_mask_and_async(rhs, lhs, stream, mr);
+    return make_fixed_width_column(
+      output_type, rhs.size(), std::move(new_mask), cudf::UNKNOWN_NULL_COUNT, stream, mr);
   } else {
     auto new_mask = binops::scalar_col_valid_mask_and(rhs, lhs, stream, mr);
     return make_fixed_width_column(
@@ -351,19 +372,26 @@ std::unique_ptr<column> make_fixed_width_column_for_output(scalar const& lhs,
  * @param rhs Right-hand side `scalar` used in the binary operation
  * @param op `binary_operator` to be used to combine `lhs` and `rhs`
  * @param output_type `data_type` of the output column
+ * @param validity_policy Whether the scalar validity is read on the host or on the device
  * @param mr Device memory resource to use for device memory allocation
  * @param stream CUDA stream used for device memory operations
  * @return std::unique_ptr<column> Output column used for binary operation
  */
-std::unique_ptr<column> make_fixed_width_column_for_output(column_view const& lhs,
-                                                           scalar const& rhs,
-                                                           binary_operator op,
-                                                           data_type output_type,
-                                                           rmm::cuda_stream_view stream,
-                                                           rmm::mr::device_memory_resource* mr)
+std::unique_ptr<column> make_fixed_width_column_for_output(
+  column_view const& lhs,
+  scalar const& rhs,
+  binary_operator op,
+  data_type output_type,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr,
+  scalar_validity validity_policy = scalar_validity::READ_ON_HOST)
 {
   if (binops::is_null_dependent(op)) {
     return make_fixed_width_column(output_type, lhs.size(), mask_state::ALL_VALID, stream, mr);
+  } else if (validity_policy == scalar_validity::READ_ON_DEVICE) {
+    auto new_mask = binops::compiled::scalar_col_valid_mask_and_async(lhs, rhs, stream, mr);
+    return make_fixed_width_column(
+      output_type, lhs.size(), std::move(new_mask), cudf::UNKNOWN_NULL_COUNT, stream, mr);
   } else {
     auto new_mask = binops::scalar_col_valid_mask_and(lhs, rhs, stream, mr);
     return make_fixed_width_column(
@@ -392,9 +420,9 @@ std::unique_ptr<column> make_fixed_width_column_for_output(column_view const& lh
   if (binops::is_null_dependent(op)) {
     return make_fixed_width_column(output_type, rhs.size(), mask_state::ALL_VALID, stream, mr);
   } else {
-    auto new_mask = cudf::detail::bitmask_and(table_view({lhs, rhs}), stream, mr);
+    auto [new_mask, null_count] = cudf::detail::bitmask_and(table_view({lhs, rhs}), stream, mr);
     return make_fixed_width_column(
-      output_type, lhs.size(), std::move(new_mask), cudf::UNKNOWN_NULL_COUNT, stream, mr);
+      output_type, lhs.size(), std::move(new_mask), null_count, stream, mr);
   }
 };
 
@@ -460,13 +488,19 @@ std::unique_ptr<column> fixed_point_binary_operation(scalar const& lhs,
         auto const scale  = scale_type{rhs.type().scale()};
         auto const scalar = make_fixed_point_scalar<decimal32>(val * factor, scale);
         binops::jit::binary_operation(out_view, *scalar, rhs, op, stream);
-      } else {
-        CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL64, "Unexpected DTYPE");
+      } else if (lhs.type().id() == type_id::DECIMAL64) {
         auto const factor = numeric::detail::ipow<int64_t, Radix::BASE_10>(diff);
         auto const val    = static_cast<fixed_point_scalar<decimal64> const&>(lhs).value();
         auto const scale  = scale_type{rhs.type().scale()};
         auto const scalar = make_fixed_point_scalar<decimal64>(val * factor, scale);
         binops::jit::binary_operation(out_view, *scalar, rhs, op, stream);
+      } else {
+        CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL128, "Unexpected DTYPE");
+        auto const factor = numeric::detail::ipow<__int128_t, Radix::BASE_10>(diff);
+        auto const val    = static_cast<fixed_point_scalar<decimal128> const&>(lhs).value();
+        auto const scale  = scale_type{rhs.type().scale()};
+        auto const scalar = make_fixed_point_scalar<decimal128>(val * factor, scale);
+        binops::jit::binary_operation(out_view, *scalar, rhs, op, stream);
       }
     } else {
       auto const diff   = rhs.type().scale() - lhs.type().scale();
@@ -475,11 +509,15 @@ std::unique_ptr<column> fixed_point_binary_operation(scalar const& lhs,
           auto const factor = numeric::detail::ipow<int32_t, Radix::BASE_10>(diff);
           auto const scalar = make_fixed_point_scalar<decimal32>(factor, scale_type{-diff});
           return jit::binary_operation(*scalar, rhs, binary_operator::MUL, lhs.type(), stream, mr);
-        } else {
-          CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL64, "Unexpected DTYPE");
+        } else if (lhs.type().id() == type_id::DECIMAL64) {
           auto const factor = numeric::detail::ipow<int64_t, Radix::BASE_10>(diff);
           auto const scalar = make_fixed_point_scalar<decimal64>(factor, scale_type{-diff});
           return jit::binary_operation(*scalar, rhs, binary_operator::MUL, lhs.type(), stream, mr);
+        } else {
+          CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL128, "Unexpected DTYPE");
+          auto const factor = numeric::detail::ipow<__int128_t, Radix::BASE_10>(diff);
+          auto const scalar = make_fixed_point_scalar<decimal128>(factor, scale_type{-diff});
+          return jit::binary_operation(*scalar, rhs, binary_operator::MUL, lhs.type(), stream, mr);
         }
       }();
       binops::jit::binary_operation(out_view, lhs, result->view(), op, stream);
@@ -530,13 +568,19 @@ std::unique_ptr<column> fixed_point_binary_operation(column_view const& lhs,
         auto const scale  = scale_type{lhs.type().scale()};
         auto const scalar = make_fixed_point_scalar<decimal32>(val * factor, scale);
         binops::jit::binary_operation(out_view, lhs, *scalar, op, stream);
-      } else {
-        CUDF_EXPECTS(rhs.type().id() == type_id::DECIMAL64, "Unexpected DTYPE");
+      } else if (rhs.type().id() == type_id::DECIMAL64) {
         auto const factor = numeric::detail::ipow<int64_t, Radix::BASE_10>(diff);
         auto const val    = static_cast<fixed_point_scalar<decimal64> const&>(rhs).value();
         auto const scale  = scale_type{rhs.type().scale()};
         auto const scalar = make_fixed_point_scalar<decimal64>(val * factor, scale);
         binops::jit::binary_operation(out_view, lhs, *scalar, op, stream);
+      } else {
+        CUDF_EXPECTS(rhs.type().id() == type_id::DECIMAL128, "Unexpected DTYPE");
+        auto const factor = numeric::detail::ipow<__int128_t, Radix::BASE_10>(diff);
+        auto const val    = static_cast<fixed_point_scalar<decimal128> const&>(rhs).value();
+        auto const scale  = scale_type{lhs.type().scale()};
+        auto const scalar = make_fixed_point_scalar<decimal128>(val * factor, scale);
+        binops::jit::binary_operation(out_view, lhs, *scalar, op, stream);
       }
     } else {
       auto const diff   = lhs.type().scale() - rhs.type().scale();
@@ -545,11 +589,15 @@ std::unique_ptr<column> fixed_point_binary_operation(column_view const& lhs,
           auto const factor = numeric::detail::ipow<int32_t, Radix::BASE_10>(diff);
           auto const scalar = make_fixed_point_scalar<decimal32>(factor, scale_type{-diff});
           return jit::binary_operation(*scalar, lhs, binary_operator::MUL, rhs.type(), stream, mr);
-        } else {
-          CUDF_EXPECTS(rhs.type().id() == type_id::DECIMAL64, "Unexpected DTYPE");
+        } else if (rhs.type().id() == type_id::DECIMAL64) {
           auto const factor = numeric::detail::ipow<int64_t, Radix::BASE_10>(diff);
           auto const scalar = make_fixed_point_scalar<decimal64>(factor, scale_type{-diff});
           return jit::binary_operation(*scalar, lhs, binary_operator::MUL, rhs.type(), stream, mr);
+        } else {
+          CUDF_EXPECTS(rhs.type().id() == type_id::DECIMAL128, "Unexpected DTYPE");
+          auto const factor = numeric::detail::ipow<__int128_t, Radix::BASE_10>(diff);
+          auto const scalar = make_fixed_point_scalar<decimal128>(factor, scale_type{-diff});
+          return jit::binary_operation(*scalar, lhs, binary_operator::MUL, rhs.type(), stream, mr);
         }
       }();
       binops::jit::binary_operation(out_view, result->view(), rhs, op, stream);
@@ -598,11 +646,15 @@ std::unique_ptr<column> fixed_point_binary_operation(column_view const& lhs,
           auto const factor = numeric::detail::ipow<int32_t, Radix::BASE_10>(diff);
           auto const scalar = make_fixed_point_scalar<decimal32>(factor, scale_type{-diff});
           return jit::binary_operation(*scalar, lhs, binary_operator::MUL, rhs.type(), stream, mr);
-        } else {
-          CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL64, "Unexpected DTYPE");
+        } else if (lhs.type().id() == type_id::DECIMAL64) {
           auto const factor = numeric::detail::ipow<int64_t, Radix::BASE_10>(diff);
           auto const scalar = make_fixed_point_scalar<decimal64>(factor, scale_type{-diff});
           return jit::binary_operation(*scalar, lhs, binary_operator::MUL, rhs.type(), stream, mr);
+        } else {
+          CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL128, "Unexpected DTYPE");
+          auto const factor = numeric::detail::ipow<__int128_t, Radix::BASE_10>(diff);
+          auto const scalar = make_fixed_point_scalar<decimal128>(factor, scale_type{-diff});
+          return jit::binary_operation(*scalar, lhs, binary_operator::MUL, rhs.type(), stream, mr);
         }
       }();
       binops::jit::binary_operation(out_view, result->view(), rhs, op, stream);
@@ -613,11 +665,15 @@ std::unique_ptr<column> fixed_point_binary_operation(column_view const& lhs,
           auto const factor = numeric::detail::ipow<int32_t, Radix::BASE_10>(diff);
           auto const scalar = make_fixed_point_scalar<decimal32>(factor, scale_type{-diff});
           return jit::binary_operation(*scalar, rhs, binary_operator::MUL, lhs.type(), stream, mr);
-        } else {
-          CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL64, "Unexpected DTYPE");
+        } else if (lhs.type().id() == type_id::DECIMAL64) {
           auto const factor = numeric::detail::ipow<int64_t, Radix::BASE_10>(diff);
           auto const scalar = make_fixed_point_scalar<decimal64>(factor, scale_type{-diff});
           return jit::binary_operation(*scalar, rhs, binary_operator::MUL, lhs.type(), stream, mr);
+        } else {
+          CUDF_EXPECTS(lhs.type().id() == type_id::DECIMAL128, "Unexpected DTYPE");
+          auto const factor = numeric::detail::ipow<__int128_t, Radix::BASE_10>(diff);
+          auto const scalar = make_fixed_point_scalar<decimal128>(factor, scale_type{-diff});
+          return jit::binary_operation(*scalar, rhs, binary_operator::MUL, lhs.type(), stream, mr);
         }
       }();
       binops::jit::binary_operation(out_view, lhs, result->view(), op, stream);
@@ -749,15 +805,92 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
 }  // namespace jit
 
 namespace detail {
+namespace {
+
+/**
+ * @brief Binary operation between a dictionary column and a scalar, computed over the keys.
+ *
+ * The operation is evaluated once per distinct key (cardinality-sized work) and the result
+ * is mapped through the dictionary's indices, so the input is never decoded to a
+ * materialized column. The output validity is the column's own validity combined with any
+ * nulls produced by the key-level operation (e.g. an invalid scalar operand).
+ */
+std::unique_ptr<column> dictionary_binary_operation(column_view const& col,
+                                                    scalar const& s,
+                                                    bool scalar_is_lhs,
+                                                    binary_operator op,
+                                                    data_type output_type,
+                                                    scalar_validity validity_policy,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  auto const dict_col = dictionary_column_view(col);
+  auto const keys     = dict_col.keys();
+
+  // evaluate the operation over the keys only
+  auto const keys_result =
+    scalar_is_lhs
+      ? binops::compiled::binary_operation<scalar, column_view>(
+          s, keys, op, output_type, stream, rmm::mr::get_current_device_resource(), validity_policy)
+      : binops::compiled::binary_operation<column_view, scalar>(
+          keys,
+          s,
+          op,
+          output_type,
+          stream,
+          rmm::mr::get_current_device_resource(),
+          validity_policy);
+
+  // map the key-level results through the indices
+  column_view indices{dict_col.indices().type(),
+                      dict_col.size(),
+                      dict_col.indices().head(),
+                      nullptr,  // no nulls for gather indices
+                      0,
+                      dict_col.offset()};
+  auto table_column = cudf::detail::gather(table_view{{keys_result->view()}},
+                                           indices,
+                                           cudf::out_of_bounds_policy::NULLIFY,
+                                           cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                           stream,
+                                           mr)
+                        ->release();
+  auto output = std::move(table_column.front());
+
+  // combine the gathered validity with the dictionary column's own null mask
+  if (col.has_nulls()) {
+    auto const annotated_indices = dict_col.get_indices_annotated();
+    auto [new_mask, null_count]  = cudf::detail::bitmask_and(
+      table_view({output->view(), annotated_indices}), stream, mr);
+    output->set_null_mask(std::move(new_mask), null_count);
+  }
+  return output;
+}
+
+}  // anonymous namespace
+
+std::unique_ptr<column> binary_operation(scalar const& lhs,
+                                         column_view const& rhs,
+                                         binary_operator op,
+                                         data_type output_type,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  return binary_operation(lhs, rhs, op, output_type, scalar_validity::READ_ON_HOST, stream, mr);
+}
 std::unique_ptr<column> binary_operation(scalar const& lhs,
                                          column_view const& rhs,
                                          binary_operator op,
                                          data_type output_type,
+                                         scalar_validity validity_policy,
                                          rmm::cuda_stream_view stream,
                                          rmm::mr::device_memory_resource* mr)
 {
+  if (rhs.type().id() == type_id::DICTIONARY32 and lhs.type().id() != type_id::DICTIONARY32) {
+    return dictionary_binary_operation(rhs, lhs, true, op, output_type, validity_policy, stream, mr);
+  }
   return binops::compiled::binary_operation<scalar, column_view>(
-    lhs, rhs, op, output_type, rmm::cuda_stream_default, mr);
+    lhs, rhs, op, output_type, rmm::cuda_stream_default, mr, validity_policy);
 }
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          scalar const& rhs,
@@ -766,8 +899,21 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          rmm::cuda_stream_view stream,
                                          rmm::mr::device_memory_resource* mr)
 {
+  return binary_operation(lhs, rhs, op, output_type, scalar_validity::READ_ON_HOST, stream, mr);
+}
+std::unique_ptr<column> binary_operation(column_view const& lhs,
+                                         scalar const& rhs,
+                                         binary_operator op,
+                                         data_type output_type,
+                                         scalar_validity validity_policy,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  if (lhs.type().id() == type_id::DICTIONARY32 and rhs.type().id() != type_id::DICTIONARY32) {
+    return dictionary_binary_operation(lhs, rhs, false, op, output_type, validity_policy, stream, mr);
+  }
   return binops::compiled::binary_operation<column_view, scalar>(
-    lhs, rhs, op, output_type, rmm::cuda_stream_default, mr);
+    lhs, rhs, op, output_type, rmm::cuda_stream_default, mr, validity_policy);
 }
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          column_view const& rhs,
@@ -810,6 +956,154 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   binops::jit::binary_operation(out_view, lhs, rhs, ptx, stream);
   return out;
 }
+
+std::unique_ptr<column> ternary_operation(column_view const& x,
+                                          column_view const& y,
+                                          column_view const& z,
+                                          ternary_operator op,
+                                          data_type output_type,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(x.size() == y.size() and x.size() == z.size(), "Column sizes don't match");
+  CUDF_EXPECTS(is_fixed_width(output_type) and not is_fixed_point(output_type),
+               "Invalid/Unsupported output datatype");
+  CUDF_EXPECTS(is_fixed_width(x.type()) and not is_fixed_point(x.type()),
+               "Invalid/Unsupported x datatype");
+  CUDF_EXPECTS(is_fixed_width(y.type()) and not is_fixed_point(y.type()),
+               "Invalid/Unsupported y datatype");
+  CUDF_EXPECTS(is_fixed_width(z.type()) and not is_fixed_point(z.type()),
+               "Invalid/Unsupported z datatype");
+
+  auto [new_mask, null_count] = cudf::detail::bitmask_and(table_view({x, y, z}), stream, mr);
+  auto out                    = make_fixed_width_column(
+    output_type, x.size(), std::move(new_mask), null_count, stream, mr);
+
+  if (x.is_empty()) return out;
+
+  auto out_view = out->mutable_view();
+  binops::compiled::ternary_operation(out_view, x, y, z, op, stream);
+  return out;
+}
+
+/**
+ * @brief Common validation and output allocation for the null-replacing binary operations.
+ *
+ * The output is allocated without a null mask: the fused kernel writes a value for every row.
+ */
+template <typename LhsType, typename RhsType>
+std::unique_ptr<column> binary_operation_replace_nulls(LhsType const& lhs,
+                                                       RhsType const& rhs,
+                                                       binary_operator op,
+                                                       data_type output_type,
+                                                       scalar const& null_replacement,
+                                                       size_type size,
+                                                       rmm::cuda_stream_view stream,
+                                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_fixed_width(output_type) and not is_fixed_point(output_type),
+               "Invalid/Unsupported output datatype");
+  CUDF_EXPECTS(is_fixed_width(lhs.type()) and not is_fixed_point(lhs.type()),
+               "Invalid/Unsupported lhs datatype");
+  CUDF_EXPECTS(is_fixed_width(rhs.type()) and not is_fixed_point(rhs.type()),
+               "Invalid/Unsupported rhs datatype");
+  CUDF_EXPECTS(null_replacement.type() == output_type,
+               "Replacement type should match output type");
+  CUDF_EXPECTS(null_replacement.is_valid(stream), "Replacement scalar must be valid");
+
+  auto out = make_fixed_width_column(output_type, size, mask_state::UNALLOCATED, stream, mr);
+
+  if (size == 0) return out;
+
+  auto out_view = out->mutable_view();
+  binops::compiled::binary_operation_replace_nulls(
+    out_view, lhs, rhs, null_replacement, op, stream);
+  return out;
+}
+
+std::unique_ptr<column> binary_operation(column_view const& lhs,
+                                         column_view const& rhs,
+                                         binary_operator op,
+                                         data_type output_type,
+                                         scalar const& null_replacement,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(lhs.size() == rhs.size(), "Column sizes don't match");
+  return binary_operation_replace_nulls(
+    lhs, rhs, op, output_type, null_replacement, lhs.size(), stream, mr);
+}
+
+std::unique_ptr<column> binary_operation(scalar const& lhs,
+                                         column_view const& rhs,
+                                         binary_operator op,
+                                         data_type output_type,
+                                         scalar const& null_replacement,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  return binary_operation_replace_nulls(
+    lhs, rhs, op, output_type, null_replacement, rhs.size(), stream, mr);
+}
+
+std::unique_ptr<column> binary_operation(column_view const& lhs,
+                                         scalar const& rhs,
+                                         binary_operator op,
+                                         data_type output_type,
+                                         scalar const& null_replacement,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  return binary_operation_replace_nulls(
+    lhs, rhs, op, output_type, null_replacement, lhs.size(), stream, mr);
+}
+
+void binary_operation_in_place(column_view const& lhs,
+                               column_view const& rhs,
+                               binary_operator op,
+                               mutable_column_view& output,
+                               rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(lhs.size() == rhs.size(), "Column sizes don't match");
+  CUDF_EXPECTS(lhs.size() == output.size(), "Output column size doesn't match the operands");
+  CUDF_EXPECTS(is_fixed_width(output.type()) and not is_fixed_point(output.type()),
+               "Invalid/Unsupported output datatype");
+  CUDF_EXPECTS(is_fixed_width(lhs.type()) and not is_fixed_point(lhs.type()),
+               "Invalid/Unsupported lhs datatype");
+  CUDF_EXPECTS(is_fixed_width(rhs.type()) and not is_fixed_point(rhs.type()),
+               "Invalid/Unsupported rhs datatype");
+
+  // The operand masks are merged into the preallocated output mask up front; the
+  // null-dependent operators then overwrite it from the producing kernel.
+  if (output.nullable()) {
+    std::vector<bitmask_type const*> masks;
+    std::vector<size_type> begin_bits;
+    if (lhs.nullable()) {
+      masks.push_back(lhs.null_mask());
+      begin_bits.push_back(lhs.offset());
+    }
+    if (rhs.nullable()) {
+      masks.push_back(rhs.null_mask());
+      begin_bits.push_back(rhs.offset());
+    }
+    if (masks.empty()) {
+      detail::set_null_mask(output.null_mask(), 0, output.size(), true, stream);
+    } else {
+      detail::inplace_bitmask_and(
+        device_span<bitmask_type>{output.null_mask(), num_bitmask_words(output.size())},
+        masks,
+        begin_bits,
+        output.size(),
+        stream);
+    }
+  } else {
+    CUDF_EXPECTS(not lhs.has_nulls() and not rhs.has_nulls(),
+                 "output must be nullable when an operand has null values.");
+  }
+
+  if (lhs.is_empty()) return;
+  binops::jit::binary_operation(output, lhs, rhs, op, stream);
+}
 }  // namespace detail
 
 int32_t binary_operation_fixed_point_scale(binary_operator op,
@@ -837,38 +1131,120 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
                                          column_view const& rhs,
                                          binary_operator op,
                                          data_type output_type,
+                                         rmm::cuda_stream_view stream,
                                          rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::binary_operation(lhs, rhs, op, output_type, rmm::cuda_stream_default, mr);
+  CUDF_OP_RANGE(rhs.size());
+  return detail::binary_operation(lhs, rhs, op, output_type, stream, mr);
+}
+std::unique_ptr<column> binary_operation(scalar const& lhs,
+                                         column_view const& rhs,
+                                         binary_operator op,
+                                         data_type output_type,
+                                         scalar_validity validity_policy,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_OP_RANGE(rhs.size());
+  return detail::binary_operation(lhs, rhs, op, output_type, validity_policy, stream, mr);
 }
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          scalar const& rhs,
                                          binary_operator op,
                                          data_type output_type,
+                                         scalar_validity validity_policy,
+                                         rmm::cuda_stream_view stream,
                                          rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::binary_operation(lhs, rhs, op, output_type, rmm::cuda_stream_default, mr);
+  CUDF_OP_RANGE(lhs.size());
+  return detail::binary_operation(lhs, rhs, op, output_type, validity_policy, stream, mr);
+}
+std::unique_ptr<column> binary_operation(column_view const& lhs,
+                                         scalar const& rhs,
+                                         binary_operator op,
+                                         data_type output_type,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_OP_RANGE(lhs.size());
+  return detail::binary_operation(lhs, rhs, op, output_type, stream, mr);
 }
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          column_view const& rhs,
                                          binary_operator op,
                                          data_type output_type,
+                                         rmm::cuda_stream_view stream,
                                          rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::binary_operation(lhs, rhs, op, output_type, rmm::cuda_stream_default, mr);
+  CUDF_OP_RANGE(lhs.size());
+  return detail::binary_operation(lhs, rhs, op, output_type, stream, mr);
+}
+
+void binary_operation_in_place(column_view const& lhs,
+                               column_view const& rhs,
+                               binary_operator op,
+                               mutable_column_view& output,
+                               rmm::cuda_stream_view stream)
+{
+  CUDF_OP_RANGE(lhs.size());
+  return detail::binary_operation_in_place(lhs, rhs, op, output, stream);
+}
+
+std::unique_ptr<column> binary_operation(column_view const& lhs,
+                                         column_view const& rhs,
+                                         binary_operator op,
+                                         data_type output_type,
+                                         scalar const& null_replacement,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_OP_RANGE(lhs.size());
+  return detail::binary_operation(lhs, rhs, op, output_type, null_replacement, stream, mr);
+}
+std::unique_ptr<column> binary_operation(scalar const& lhs,
+                                         column_view const& rhs,
+                                         binary_operator op,
+                                         data_type output_type,
+                                         scalar const& null_replacement,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_OP_RANGE(rhs.size());
+  return detail::binary_operation(lhs, rhs, op, output_type, null_replacement, stream, mr);
+}
+std::unique_ptr<column> binary_operation(column_view const& lhs,
+                                         scalar const& rhs,
+                                         binary_operator op,
+                                         data_type output_type,
+                                         scalar const& null_replacement,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_OP_RANGE(lhs.size());
+  return detail::binary_operation(lhs, rhs, op, output_type, null_replacement, stream, mr);
 }
 
 std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          column_view const& rhs,
                                          std::string const& ptx,
                                          data_type output_type,
+                                         rmm::cuda_stream_view stream,
                                          rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::binary_operation(lhs, rhs, ptx, output_type, rmm::cuda_stream_default, mr);
+  CUDF_OP_RANGE(lhs.size());
+  return detail::binary_operation(lhs, rhs, ptx, output_type, stream, mr);
+}
+
+std::unique_ptr<column> ternary_operation(column_view const& x,
+                                          column_view const& y,
+                                          column_view const& z,
+                                          ternary_operator op,
+                                          data_type output_type,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_OP_RANGE(x.size());
+  return detail::ternary_operation(x, y, z, op, output_type, stream, mr);
 }
 
 }  // namespace cudf
@@ -19,17 +19,72 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/strings/detail/utilities.cuh>
+#include <cudf/utilities/bit.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/tabulate.h>
+
 namespace cudf {
 namespace binops {
 namespace compiled {
 
+namespace {
+
+/**
+ * @brief Builds one output null-mask word from the column validity and the
+ * device-resident scalar validity.
+ *
+ * Reading the scalar validity inside the functor keeps the mask computation
+ * entirely on the device; bits past the column size are left set, matching
+ * `mask_state::ALL_VALID` padding.
+ */
+struct scalar_col_mask_word_functor {
+  column_device_view col;
+  bool const* d_scalar_valid;
+
+  __device__ bitmask_type operator()(size_type word_index) const
+  {
+    if (not *d_scalar_valid) { return bitmask_type{0}; }
+    if (not col.nullable()) { return ~bitmask_type{0}; }
+    bitmask_type word  = ~bitmask_type{0};
+    auto const first   = word_index * cudf::detail::size_in_bits<bitmask_type>();
+    auto const num_set = static_cast<size_type>(cudf::detail::size_in_bits<bitmask_type>());
+    for (size_type bit = 0; bit < num_set; ++bit) {
+      auto const row = first + bit;
+      if (row < col.size() and not col.is_valid_nocheck(row)) {
+        word &= ~(bitmask_type{1} << bit);
+      }
+    }
+    return word;
+  }
+};
+
+}  // namespace
+
+rmm::device_buffer scalar_col_valid_mask_and_async(column_view const& col,
+                                                   scalar const& s,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  if (col.is_empty()) return rmm::device_buffer{0, stream, mr};
+
+  auto mask =
+    cudf::detail::create_null_mask(col.size(), mask_state::UNINITIALIZED, stream, mr);
+  auto const d_col = column_device_view::create(col, stream);
+  auto const words = static_cast<bitmask_type*>(mask.data());
+  thrust::tabulate(rmm::exec_policy(stream),
+                   words,
+                   words + num_bitmask_words(col.size()),
+                   scalar_col_mask_word_functor{*d_col, s.validity_data()});
+  return mask;
+}
+
 namespace {
 /**
  * @brief Converts scalar to column_device_view with single element.
@@ -381,6 +436,76 @@ void binary_operation(mutable_column_view& out,
   operator_dispatcher(*outd, *lhsd, *rhsd, false, true, op, stream);
 }
 
+// Fused null replacement is restricted to the arithmetic operators; the comparison and
+// null-aware operators define their own null semantics.
+void operator_dispatcher_replace_nulls(mutable_column_device_view& out,
+                                       column_device_view const& lhs,
+                                       column_device_view const& rhs,
+                                       bool is_lhs_scalar,
+                                       bool is_rhs_scalar,
+                                       column_device_view const& repl,
+                                       binary_operator op,
+                                       rmm::cuda_stream_view stream)
+{
+  // clang-format off
+switch (op) {
+case binary_operator::ADD:       apply_binary_op_replace_nulls<ops::Add>(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, repl, stream); break;
+case binary_operator::SUB:       apply_binary_op_replace_nulls<ops::Sub>(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, repl, stream); break;
+case binary_operator::MUL:       apply_binary_op_replace_nulls<ops::Mul>(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, repl, stream); break;
+case binary_operator::DIV:       apply_binary_op_replace_nulls<ops::Div>(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, repl, stream); break;
+case binary_operator::TRUE_DIV:  apply_binary_op_replace_nulls<ops::TrueDiv>(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, repl, stream); break;
+case binary_operator::FLOOR_DIV: apply_binary_op_replace_nulls<ops::FloorDiv>(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, repl, stream); break;
+case binary_operator::MOD:       apply_binary_op_replace_nulls<ops::Mod>(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, repl, stream); break;
+case binary_operator::PYMOD:     apply_binary_op_replace_nulls<ops::PyMod>(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, repl, stream); break;
+case binary_operator::POW:       apply_binary_op_replace_nulls<ops::Pow>(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, repl, stream); break;
+default: CUDF_FAIL("Unsupported operator for null replacement");
+}
+  // clang-format on
+}
+
+// vector_vector
+void binary_operation_replace_nulls(mutable_column_view& out,
+                                    column_view const& lhs,
+                                    column_view const& rhs,
+                                    scalar const& replacement,
+                                    binary_operator op,
+                                    rmm::cuda_stream_view stream)
+{
+  auto lhsd         = column_device_view::create(lhs, stream);
+  auto rhsd         = column_device_view::create(rhs, stream);
+  auto [repld, aux] = scalar_to_column_device_view(replacement, stream);
+  auto outd         = mutable_column_device_view::create(out, stream);
+  operator_dispatcher_replace_nulls(*outd, *lhsd, *rhsd, false, false, *repld, op, stream);
+}
+// scalar_vector
+void binary_operation_replace_nulls(mutable_column_view& out,
+                                    scalar const& lhs,
+                                    column_view const& rhs,
+                                    scalar const& replacement,
+                                    binary_operator op,
+                                    rmm::cuda_stream_view stream)
+{
+  auto [lhsd, aux_lhs]   = scalar_to_column_device_view(lhs, stream);
+  auto rhsd              = column_device_view::create(rhs, stream);
+  auto [repld, aux_repl] = scalar_to_column_device_view(replacement, stream);
+  auto outd              = mutable_column_device_view::create(out, stream);
+  operator_dispatcher_replace_nulls(*outd, *lhsd, *rhsd, true, false, *repld, op, stream);
+}
+// vector_scalar
+void binary_operation_replace_nulls(mutable_column_view& out,
+                                    column_view const& lhs,
+                                    scalar const& rhs,
+                                    scalar const& replacement,
+                                    binary_operator op,
+                                    rmm::cuda_stream_view stream)
+{
+  auto lhsd              = column_device_view::create(lhs, stream);
+  auto [rhsd, aux_rhs]   = scalar_to_column_device_view(rhs, stream);
+  auto [repld, aux_repl] = scalar_to_column_device_view(replacement, stream);
+  auto outd              = mutable_column_device_view::create(out, stream);
+  operator_dispatcher_replace_nulls(*outd, *lhsd, *rhsd, false, true, *repld, op, stream);
+}
+
 }  // namespace compiled
 }  // namespace binops
 }  // namespace cudf
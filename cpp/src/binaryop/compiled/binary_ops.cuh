@@ -269,6 +269,67 @@ void apply_binary_op(mutable_column_device_view& outd,
   for_each(stream, outd.size(), binop_func);
 }
 
+/**
+ * @brief Copies the single replacement element over the `i`th element of the output column.
+ */
+struct replacement_element_writer {
+  template <typename Element>
+  CUDA_DEVICE_CALLABLE void operator()(cudf::size_type i,
+                                       mutable_column_device_view const& out,
+                                       column_device_view const& replacement) const
+  {
+    if constexpr (mutable_column_device_view::has_element_accessor<Element>()) {
+      out.element<Element>(i) = replacement.element<Element>(0);
+    }
+  }
+};
+
+/**
+ * @brief Functor which computes the binary operation where both operands are valid and writes
+ * the replacement element elsewhere.
+ *
+ * Fusing the replacement into the producing kernel yields a non-nullable output: no null mask
+ * is computed and no separate `replace_nulls` pass over the result is needed.
+ *
+ * @tparam BinaryOperator binary operator functor
+ */
+template <class BinaryOperator>
+struct device_type_dispatcher_replace_nulls {
+  device_type_dispatcher<BinaryOperator> binop;
+  column_device_view replacement;
+
+  __device__ void operator()(size_type i)
+  {
+    auto const lhs_valid = binop.lhs.is_valid(binop.is_lhs_scalar ? 0 : i);
+    auto const rhs_valid = binop.rhs.is_valid(binop.is_rhs_scalar ? 0 : i);
+    if (lhs_valid and rhs_valid) {
+      binop(i);
+    } else {
+      type_dispatcher(binop.out.type(), replacement_element_writer{}, i, binop.out, replacement);
+    }
+  }
+};
+
+template <class BinaryOperator>
+void apply_binary_op_replace_nulls(mutable_column_device_view& outd,
+                                   column_device_view const& lhsd,
+                                   column_device_view const& rhsd,
+                                   bool is_lhs_scalar,
+                                   bool is_rhs_scalar,
+                                   column_device_view const& replacementd,
+                                   rmm::cuda_stream_view stream)
+{
+  auto common_dtype = get_common_type(outd.type(), lhsd.type(), rhsd.type());
+
+  // Create fused binop functor instance
+  auto fused_func = device_type_dispatcher_replace_nulls<BinaryOperator>{
+    device_type_dispatcher<BinaryOperator>{
+      outd, lhsd, rhsd, is_lhs_scalar, is_rhs_scalar, common_dtype},
+    replacementd};
+  // Execute it on every element
+  for_each(stream, outd.size(), fused_func);
+}
+
 }  // namespace compiled
 }  // namespace binops
 }  // namespace cudf
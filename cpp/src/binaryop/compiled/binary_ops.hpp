@@ -31,6 +31,26 @@ class mutable_column_device_view;
 namespace binops {
 namespace compiled {
 
+/**
+ * @brief Computes the output null mask for an op between a column and a scalar
+ * without reading the scalar validity on the host.
+ *
+ * The returned mask is the logical AND of the column validity and the scalar
+ * validity, combined by a device pass; unlike `scalar_col_valid_mask_and` the
+ * call never synchronizes the stream, so a mask is always allocated and the
+ * null count must be taken as `UNKNOWN_NULL_COUNT`.
+ *
+ * @param col     Column operand providing the per-row validity
+ * @param s       Scalar operand whose validity is read on the device
+ * @param stream  CUDA stream used for device memory operations and kernel launches
+ * @param mr      Device memory resource used to allocate the returned mask's device memory
+ * @return        Null mask with `col.size()` bits
+ */
+rmm::device_buffer scalar_col_valid_mask_and_async(column_view const& col,
+                                                   scalar const& s,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr);
+
 std::unique_ptr<column> string_null_min_max(
   scalar const& lhs,
   column_view const& rhs,
@@ -148,6 +168,48 @@ void binary_operation(mutable_column_view& out,
                       binary_operator op,
                       rmm::cuda_stream_view stream);
 
+/**
+ * @brief Performs a fused ternary operation between three columns, writing into @p out.
+ *
+ * All operands are cast to the common type of the operands and the output before the operation;
+ * the fused operation produces no intermediate column.
+ *
+ * @throws cudf::logic_error if a common type among the operand and output types does not exist.
+ */
+void ternary_operation(mutable_column_view& out,
+                       column_view const& x,
+                       column_view const& y,
+                       column_view const& z,
+                       ternary_operator op,
+                       rmm::cuda_stream_view stream);
+
+/**
+ * @brief Performs a binary operation with fused null replacement, writing into @p out.
+ *
+ * Rows where either operand is null receive the replacement element instead of a null, so
+ * @p out is written for every row and needs no null mask.
+ *
+ * @throws cudf::logic_error if @p op is not a supported arithmetic operator.
+ */
+void binary_operation_replace_nulls(mutable_column_view& out,
+                                    column_view const& lhs,
+                                    column_view const& rhs,
+                                    scalar const& replacement,
+                                    binary_operator op,
+                                    rmm::cuda_stream_view stream);
+void binary_operation_replace_nulls(mutable_column_view& out,
+                                    scalar const& lhs,
+                                    column_view const& rhs,
+                                    scalar const& replacement,
+                                    binary_operator op,
+                                    rmm::cuda_stream_view stream);
+void binary_operation_replace_nulls(mutable_column_view& out,
+                                    column_view const& lhs,
+                                    scalar const& rhs,
+                                    scalar const& replacement,
+                                    binary_operator op,
+                                    rmm::cuda_stream_view stream);
+
 // Defined in util.cpp
 /**
  * @brief Get the common type among all input types.
@@ -191,6 +253,29 @@ void apply_binary_op(mutable_column_device_view&,
                      bool is_lhs_scalar,
                      bool is_rhs_scalar,
                      rmm::cuda_stream_view stream);
+/**
+ * @brief Deploys single type or double type dispatcher that runs binary operation on each element
+ * of @p lhsd and @p rhsd columns, writing @p replacementd wherever either operand is null.
+ *
+ * This template is instantiated for the arithmetic binary operators in replace_nulls_ops.cu.
+ *
+ * @tparam BinaryOperator Binary operator functor
+ * @param outd mutable device view of output column
+ * @param lhsd device view of left operand column
+ * @param rhsd device view of right operand column
+ * @param is_lhs_scalar true if @p lhsd is a single element column representing a scalar
+ * @param is_rhs_scalar true if @p rhsd is a single element column representing a scalar
+ * @param replacementd single element column device view holding the replacement value
+ * @param stream CUDA stream used for device memory operations
+ */
+template <class BinaryOperator>
+void apply_binary_op_replace_nulls(mutable_column_device_view& outd,
+                                   column_device_view const& lhsd,
+                                   column_device_view const& rhsd,
+                                   bool is_lhs_scalar,
+                                   bool is_rhs_scalar,
+                                   column_device_view const& replacementd,
+                                   rmm::cuda_stream_view stream);
 /**
  * @brief Deploys single type or double type dispatcher that runs equality operation on each element
  * of @p lhsd and @p rhsd columns.
@@ -415,6 +415,34 @@ struct NullMin {
     -> decltype(static_cast<common_t>(static_cast<common_t>(x) < static_cast<common_t>(y) ? x : y));
 };
 
+// Ternary operations, fused so that chained binary operations do not materialize an intermediate
+// column between the two steps.
+
+struct MultiplyAdd {
+  template <typename T1, typename T2, typename T3>
+  CUDA_DEVICE_CALLABLE auto operator()(T1 const& x, T2 const& y, T3 const& z)
+    -> decltype(x * y + z)
+  {
+    if constexpr (std::is_floating_point_v<T1> and std::is_same_v<T1, T2> and
+                  std::is_same_v<T1, T3>) {
+      // Use the fused multiply-add instruction for floating point types: a single rounding step
+      // and a single instruction instead of two.
+      return std::fma(x, y, z);
+    } else {
+      return x * y + z;
+    }
+  }
+};
+
+struct AddMultiply {
+  template <typename T1, typename T2, typename T3>
+  CUDA_DEVICE_CALLABLE auto operator()(T1 const& x, T2 const& y, T3 const& z)
+    -> decltype((x + y) * z)
+  {
+    return (x + y) * z;
+  }
+};
+
 }  // namespace ops
 }  // namespace compiled
 }  // namespace binops
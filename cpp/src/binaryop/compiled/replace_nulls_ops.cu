@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "binary_ops.cuh"
+
+namespace cudf::binops::compiled {
+template void apply_binary_op_replace_nulls<ops::Add>(mutable_column_device_view&,
+                                                      column_device_view const&,
+                                                      column_device_view const&,
+                                                      bool is_lhs_scalar,
+                                                      bool is_rhs_scalar,
+                                                      column_device_view const&,
+                                                      rmm::cuda_stream_view);
+template void apply_binary_op_replace_nulls<ops::Sub>(mutable_column_device_view&,
+                                                      column_device_view const&,
+                                                      column_device_view const&,
+                                                      bool is_lhs_scalar,
+                                                      bool is_rhs_scalar,
+                                                      column_device_view const&,
+                                                      rmm::cuda_stream_view);
+template void apply_binary_op_replace_nulls<ops::Mul>(mutable_column_device_view&,
+                                                      column_device_view const&,
+                                                      column_device_view const&,
+                                                      bool is_lhs_scalar,
+                                                      bool is_rhs_scalar,
+                                                      column_device_view const&,
+                                                      rmm::cuda_stream_view);
+template void apply_binary_op_replace_nulls<ops::Div>(mutable_column_device_view&,
+                                                      column_device_view const&,
+                                                      column_device_view const&,
+                                                      bool is_lhs_scalar,
+                                                      bool is_rhs_scalar,
+                                                      column_device_view const&,
+                                                      rmm::cuda_stream_view);
+template void apply_binary_op_replace_nulls<ops::TrueDiv>(mutable_column_device_view&,
+                                                          column_device_view const&,
+                                                          column_device_view const&,
+                                                          bool is_lhs_scalar,
+                                                          bool is_rhs_scalar,
+                                                          column_device_view const&,
+                                                          rmm::cuda_stream_view);
+template void apply_binary_op_replace_nulls<ops::FloorDiv>(mutable_column_device_view&,
+                                                           column_device_view const&,
+                                                           column_device_view const&,
+                                                           bool is_lhs_scalar,
+                                                           bool is_rhs_scalar,
+                                                           column_device_view const&,
+                                                           rmm::cuda_stream_view);
+template void apply_binary_op_replace_nulls<ops::Mod>(mutable_column_device_view&,
+                                                      column_device_view const&,
+                                                      column_device_view const&,
+                                                      bool is_lhs_scalar,
+                                                      bool is_rhs_scalar,
+                                                      column_device_view const&,
+                                                      rmm::cuda_stream_view);
+template void apply_binary_op_replace_nulls<ops::PyMod>(mutable_column_device_view&,
+                                                        column_device_view const&,
+                                                        column_device_view const&,
+                                                        bool is_lhs_scalar,
+                                                        bool is_rhs_scalar,
+                                                        column_device_view const&,
+                                                        rmm::cuda_stream_view);
+template void apply_binary_op_replace_nulls<ops::Pow>(mutable_column_device_view&,
+                                                      column_device_view const&,
+                                                      column_device_view const&,
+                                                      bool is_lhs_scalar,
+                                                      bool is_rhs_scalar,
+                                                      column_device_view const&,
+                                                      rmm::cuda_stream_view);
+}  // namespace cudf::binops::compiled
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ternary_ops.cuh"
+
+namespace cudf {
+namespace binops {
+namespace compiled {
+
+void ternary_operation(mutable_column_view& out,
+                       column_view const& x,
+                       column_view const& y,
+                       column_view const& z,
+                       ternary_operator op,
+                       rmm::cuda_stream_view stream)
+{
+  auto const common_xy = get_common_type(out.type(), x.type(), y.type());
+  CUDF_EXPECTS(common_xy.has_value(), "Unsupported operand types for ternary operation");
+  auto const common_dtype = get_common_type(out.type(), *common_xy, z.type());
+  CUDF_EXPECTS(common_dtype.has_value(), "Unsupported operand types for ternary operation");
+
+  auto xd   = column_device_view::create(x, stream);
+  auto yd   = column_device_view::create(y, stream);
+  auto zd   = column_device_view::create(z, stream);
+  auto outd = mutable_column_device_view::create(out, stream);
+
+  switch (op) {
+    case ternary_operator::MULTIPLY_ADD:
+      apply_ternary_op<ops::MultiplyAdd>(*outd, *xd, *yd, *zd, *common_dtype, stream);
+      break;
+    case ternary_operator::ADD_MULTIPLY:
+      apply_ternary_op<ops::AddMultiply>(*outd, *xd, *yd, *zd, *common_dtype, stream);
+      break;
+    default: CUDF_FAIL("Unsupported ternary operator");
+  }
+}
+
+}  // namespace compiled
+}  // namespace binops
+}  // namespace cudf
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "binary_ops.cuh"
+
+namespace cudf {
+namespace binops {
+namespace compiled {
+
+/**
+ * @brief Functor to launch only defined ternary operations with common type.
+ *
+ * All three operands are cast to the common type before the operation, like the
+ * `ops_wrapper` common type path for binary operations.
+ *
+ * @tparam TernaryOperator ternary operator functor
+ */
+template <typename TernaryOperator>
+struct ternary_ops_wrapper {
+  mutable_column_device_view& out;
+  column_device_view const& x;
+  column_device_view const& y;
+  column_device_view const& z;
+  template <typename TypeCommon>
+  __device__ void operator()(size_type i)
+  {
+    if constexpr (std::is_invocable_v<TernaryOperator, TypeCommon, TypeCommon, TypeCommon>) {
+      TypeCommon a = type_dispatcher(x.type(), type_casted_accessor<TypeCommon>{}, i, x, false);
+      TypeCommon b = type_dispatcher(y.type(), type_casted_accessor<TypeCommon>{}, i, y, false);
+      TypeCommon c = type_dispatcher(z.type(), type_casted_accessor<TypeCommon>{}, i, z, false);
+      auto result =
+        TernaryOperator{}.template operator()<TypeCommon, TypeCommon, TypeCommon>(a, b, c);
+      type_dispatcher(out.type(), typed_casted_writer<decltype(result)>{}, i, out, result);
+    }
+    (void)i;
+  }
+};
+
+/**
+ * @brief Functor which dispatches the common type in device code
+ *
+ * @tparam TernaryOperator ternary operator functor
+ */
+template <class TernaryOperator>
+struct device_ternary_dispatcher {
+  mutable_column_device_view out;
+  column_device_view x;
+  column_device_view y;
+  column_device_view z;
+  data_type common_data_type;
+
+  __device__ void operator()(size_type i)
+  {
+    type_dispatcher(common_data_type, ternary_ops_wrapper<TernaryOperator>{out, x, y, z}, i);
+  }
+};
+
+template <class TernaryOperator>
+void apply_ternary_op(mutable_column_device_view& outd,
+                      column_device_view const& xd,
+                      column_device_view const& yd,
+                      column_device_view const& zd,
+                      data_type common_dtype,
+                      rmm::cuda_stream_view stream)
+{
+  // Create ternary op functor instance
+  auto ternop_func =
+    device_ternary_dispatcher<TernaryOperator>{outd, xd, yd, zd, common_dtype};
+  // Execute it on every element
+  for_each(stream, outd.size(), ternop_func);
+}
+
+}  // namespace compiled
+}  // namespace binops
+}  // namespace cudf
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/null_mask.cuh>
 #include <cudf/detail/null_mask.hpp>
@@ -247,9 +248,30 @@ __global__ void copy_offset_bitmask(bitmask_type* __restrict__ destination,
                                     size_type source_end_bit,
                                     size_type number_of_mask_words)
 {
-  for (size_type destination_word_index = threadIdx.x + blockIdx.x * blockDim.x;
+  auto const tid    = threadIdx.x + blockIdx.x * blockDim.x;
+  auto const stride = blockDim.x * gridDim.x;
+
+  // Each thread stitches four consecutive words and stores them with a single
+  // 128-bit write. The destination is a fresh allocation, so a four-word chunk
+  // starting at a multiple of four words is always 16-byte aligned.
+  auto const num_chunks = number_of_mask_words / 4;
+  for (size_type chunk_index = tid; chunk_index < num_chunks; chunk_index += stride) {
+    auto const word_index = chunk_index * 4;
+    uint4 chunk;
+    chunk.x = detail::get_mask_offset_word(source, word_index, source_begin_bit, source_end_bit);
+    chunk.y =
+      detail::get_mask_offset_word(source, word_index + 1, source_begin_bit, source_end_bit);
+    chunk.z =
+      detail::get_mask_offset_word(source, word_index + 2, source_begin_bit, source_end_bit);
+    chunk.w =
+      detail::get_mask_offset_word(source, word_index + 3, source_begin_bit, source_end_bit);
+    *reinterpret_cast<uint4*>(destination + word_index) = chunk;
+  }
+
+  // Remaining words that do not fill a four-word chunk
+  for (size_type destination_word_index = num_chunks * 4 + tid;
        destination_word_index < number_of_mask_words;
-       destination_word_index += blockDim.x * gridDim.x) {
+       destination_word_index += stride) {
     destination[destination_word_index] = detail::get_mask_offset_word(
       source, destination_word_index, source_begin_bit, source_end_bit);
   }
@@ -274,10 +296,19 @@ rmm::device_buffer copy_bitmask(bitmask_type const* mask,
   if ((mask == nullptr) || (num_bytes == 0)) { return dest_mask; }
   if (begin_bit == 0) {
     dest_mask = rmm::device_buffer{static_cast<void const*>(mask), num_bytes, stream, mr};
+  } else if (begin_bit % detail::size_in_bits<bitmask_type>() == 0) {
+    // Word-aligned slice: a straight copy, no bit stitching needed
+    auto number_of_mask_words = num_bitmask_words(end_bit - begin_bit);
+    dest_mask                 = rmm::device_buffer{num_bytes, stream, mr};
+    CUDA_TRY(cudaMemcpyAsync(dest_mask.data(),
+                             mask + word_index(begin_bit),
+                             number_of_mask_words * sizeof(bitmask_type),
+                             cudaMemcpyDeviceToDevice,
+                             stream.value()));
   } else {
     auto number_of_mask_words = num_bitmask_words(end_bit - begin_bit);
     dest_mask                 = rmm::device_buffer{num_bytes, stream, mr};
-    cudf::detail::grid_1d config(number_of_mask_words, 256);
+    cudf::detail::grid_1d config(number_of_mask_words, 256, 4);
     copy_offset_bitmask<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
       static_cast<bitmask_type*>(dest_mask.data()), mask, begin_bit, end_bit, number_of_mask_words);
     CHECK_CUDA(stream.value());
@@ -300,14 +331,14 @@ rmm::device_buffer copy_bitmask(column_view const& view,
 }
 
 // Inplace Bitwise AND of the masks
-void inplace_bitmask_and(device_span<bitmask_type> dest_mask,
-                         host_span<bitmask_type const*> masks,
-                         host_span<size_type const> begin_bits,
-                         size_type mask_size,
-                         rmm::cuda_stream_view stream,
-                         rmm::mr::device_memory_resource* mr)
+cudf::size_type inplace_bitmask_and(device_span<bitmask_type> dest_mask,
+                                    host_span<bitmask_type const*> masks,
+                                    host_span<size_type const> begin_bits,
+                                    size_type mask_size,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
 {
-  inplace_bitmask_binop(
+  return inplace_bitmask_binop(
     [] __device__(bitmask_type left, bitmask_type right) { return left & right; },
     dest_mask,
     masks,
@@ -318,7 +349,7 @@ void inplace_bitmask_and(device_span<bitmask_type> dest_mask,
 }
 
 // Bitwise AND of the masks
-rmm::device_buffer bitmask_and(host_span<bitmask_type const*> masks,
+std::pair<rmm::device_buffer, size_type> bitmask_and(host_span<bitmask_type const*> masks,
                                host_span<size_type const> begin_bits,
                                size_type mask_size,
                                rmm::cuda_stream_view stream,
@@ -372,18 +403,22 @@ cudf::size_type count_unset_bits(bitmask_type const* bitmask,
 }
 
 // Returns the bitwise AND of the null masks of all columns in the table view
-rmm::device_buffer bitmask_and(table_view const& view,
-                               rmm::cuda_stream_view stream,
-                               rmm::mr::device_memory_resource* mr)
+std::pair<rmm::device_buffer, size_type> bitmask_and(table_view const& view,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   rmm::device_buffer null_mask{0, stream, mr};
-  if (view.num_rows() == 0 or view.num_columns() == 0) { return null_mask; }
+  if (view.num_rows() == 0 or view.num_columns() == 0) {
+    return std::make_pair(std::move(null_mask), 0);
+  }
 
   std::vector<bitmask_type const*> masks;
   std::vector<size_type> offsets;
   for (auto&& col : view) {
-    if (col.nullable()) {
+    // all-valid masks are the AND identity; skip them so provably null-free inputs
+    // produce no output mask at all
+    if (col.has_nulls()) {
       masks.push_back(col.null_mask());
       offsets.push_back(col.offset());
     }
@@ -399,22 +434,26 @@ rmm::device_buffer bitmask_and(table_view const& view,
       mr);
   }
 
-  return null_mask;
+  return std::make_pair(std::move(null_mask), 0);
 }
 
 // Returns the bitwise OR of the null masks of all columns in the table view
-rmm::device_buffer bitmask_or(table_view const& view,
-                              rmm::cuda_stream_view stream,
-                              rmm::mr::device_memory_resource* mr)
+std::pair<rmm::device_buffer, size_type> bitmask_or(table_view const& view,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   rmm::device_buffer null_mask{0, stream, mr};
-  if (view.num_rows() == 0 or view.num_columns() == 0) { return null_mask; }
+  if (view.num_rows() == 0 or view.num_columns() == 0) {
+    return std::make_pair(std::move(null_mask), 0);
+  }
 
   std::vector<bitmask_type const*> masks;
   std::vector<size_type> offsets;
   for (auto&& col : view) {
-    if (col.nullable()) {
+    // a column with no nulls makes the OR all valid; dropping it from the list makes the
+    // size check below return the empty mask without launching a kernel
+    if (col.has_nulls()) {
       masks.push_back(col.null_mask());
       offsets.push_back(col.offset());
     }
@@ -430,7 +469,7 @@ rmm::device_buffer bitmask_or(table_view const& view,
       mr);
   }
 
-  return null_mask;
+  return std::make_pair(std::move(null_mask), 0);
 }
 
 /**
@@ -504,12 +543,27 @@ rmm::device_buffer copy_bitmask(column_view const& view, rmm::mr::device_memory_
 
 rmm::device_buffer bitmask_and(table_view const& view, rmm::mr::device_memory_resource* mr)
 {
-  return detail::bitmask_and(view, rmm::cuda_stream_default, mr);
+  return detail::bitmask_and(view, rmm::cuda_stream_default, mr).first;
 }
 
 rmm::device_buffer bitmask_or(table_view const& view, rmm::mr::device_memory_resource* mr)
 {
-  return detail::bitmask_or(view, rmm::cuda_stream_default, mr);
+  return detail::bitmask_or(view, rmm::cuda_stream_default, mr).first;
+}
+
+// Free the null masks of a column and its descendants when they contain no nulls
+std::size_t reclaim_null_masks(column& input)
+{
+  CUDF_FUNC_RANGE();
+  std::size_t released = 0;
+  for (size_type i = 0; i < input.num_children(); ++i) {
+    released += reclaim_null_masks(input.child(i));
+  }
+  if (input.nullable() and input.null_count() == 0) {
+    released += bitmask_allocation_size_bytes(input.size());
+    input.set_null_mask(rmm::device_buffer{}, 0);
+  }
+  return released;
 }
 
 }  // namespace cudf
@@ -158,6 +158,32 @@ std::unique_ptr<column> make_fixed_width_column(data_type type,
   /// clang-format on
 }
 
+// Copy fixed width elements from host memory, stream-ordered
+std::unique_ptr<column> make_fixed_width_column(data_type type,
+                                                host_span<uint8_t const> data,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(is_fixed_width(type), "Invalid, non-fixed-width type.");
+  auto const elem_size = cudf::size_of(type);
+  CUDF_EXPECTS(data.size() % elem_size == 0,
+               "Data size is not a multiple of the element size of the column type.");
+  auto const size = static_cast<size_type>(data.size() / elem_size);
+
+  rmm::device_buffer buffer{data.size(), stream, mr};
+  if (data.size() > 0) {
+    CUDA_TRY(cudaMemcpyAsync(
+      buffer.data(), data.data(), data.size(), cudaMemcpyHostToDevice, stream.value()));
+  }
+  return std::make_unique<column>(type,
+                                  size,
+                                  std::move(buffer),
+                                  rmm::device_buffer{},
+                                  0,
+                                  std::vector<std::unique_ptr<column>>{});
+}
+
 std::unique_ptr<column> make_dictionary_from_scalar(scalar const& s,
                                                     size_type size,
                                                     rmm::cuda_stream_view stream,
@@ -165,11 +191,16 @@ std::unique_ptr<column> make_dictionary_from_scalar(scalar const& s,
 {
   if (size == 0) return make_empty_column(data_type{type_id::DICTIONARY32});
   CUDF_EXPECTS(s.is_valid(), "cannot create a dictionary with a null key");
-  return make_dictionary_column(
-    make_column_from_scalar(s, 1, stream, mr),
-    make_column_from_scalar(numeric_scalar<uint32_t>(0), size, stream, mr),
-    rmm::device_buffer{0, stream, mr},
-    0);
+  // A single key needs only 8-bit indices, which can be zero-filled without a kernel. This keeps
+  // broadcasting a scalar at one byte per row instead of materializing `size` copies of the value.
+  rmm::device_buffer indices_data{static_cast<std::size_t>(size), stream, mr};
+  CUDA_TRY(cudaMemsetAsync(indices_data.data(), 0, indices_data.size(), stream.value()));
+  auto indices = std::make_unique<column>(
+    data_type{type_id::UINT8}, size, std::move(indices_data), rmm::device_buffer{}, 0);
+  return make_dictionary_column(make_column_from_scalar(s, 1, stream, mr),
+                                std::move(indices),
+                                rmm::device_buffer{0, stream, mr},
+                                0);
 }
 
 }  // namespace cudf
@@ -1,5 +1,6 @@
 #include <arrow/result.h>
 #include <cudf/ipc.hpp>
+#include <cudf/utilities/error.hpp>
 
 CudaMessageReader::CudaMessageReader(arrow::cuda::CudaBufferReader* stream,
                                      arrow::io::BufferReader* schema)
@@ -20,3 +21,55 @@ std::unique_ptr<arrow::ipc::MessageReader> CudaMessageReader::Open(
 {
   return std::unique_ptr<arrow::ipc::MessageReader>(new CudaMessageReader(stream, schema));
 }
+
+namespace cudf {
+
+ipc_exported_table export_ipc(table_view const& input, rmm::mr::device_memory_resource* mr)
+{
+  auto packed = cudf::pack(input, mr);
+  CUDF_EXPECTS(packed.gpu_data != nullptr && packed.gpu_data->size() > 0,
+               "Cannot export an empty table");
+
+  ipc_exported_table exported{};
+  CUDA_TRY(cudaIpcGetMemHandle(&exported.handle, packed.gpu_data->data()));
+  exported.data = std::move(packed);
+  return exported;
+}
+
+imported_ipc_table::imported_ipc_table(cudaIpcMemHandle_t const& handle,
+                                       std::vector<uint8_t> metadata)
+  : _metadata(std::move(metadata))
+{
+  CUDF_EXPECTS(not _metadata.empty(), "Encountered invalid packed column metadata");
+  CUDA_TRY(cudaIpcOpenMemHandle(&_gpu_data, handle, cudaIpcMemLazyEnablePeerAccess));
+}
+
+imported_ipc_table::~imported_ipc_table()
+{
+  // Destructors must not throw; failure to close just leaks the mapping
+  if (_gpu_data != nullptr) { cudaIpcCloseMemHandle(_gpu_data); }
+}
+
+imported_ipc_table::imported_ipc_table(imported_ipc_table&& other) noexcept
+  : _metadata(std::move(other._metadata)), _gpu_data(other._gpu_data)
+{
+  other._gpu_data = nullptr;
+}
+
+imported_ipc_table& imported_ipc_table::operator=(imported_ipc_table&& other) noexcept
+{
+  if (this != &other) {
+    if (_gpu_data != nullptr) { cudaIpcCloseMemHandle(_gpu_data); }
+    _metadata       = std::move(other._metadata);
+    _gpu_data       = other._gpu_data;
+    other._gpu_data = nullptr;
+  }
+  return *this;
+}
+
+table_view imported_ipc_table::view() const
+{
+  return cudf::unpack(_metadata.data(), static_cast<uint8_t const*>(_gpu_data));
+}
+
+}  // namespace cudf
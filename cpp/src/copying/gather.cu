@@ -14,19 +14,80 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/indexalator.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+
+#include <algorithm>
+#include <numeric>
 
 namespace cudf {
 namespace detail {
+namespace {
+
+/**
+ * @brief One fixed-width column copy within a batched gather.
+ */
+struct batched_gather_job {
+  char const* source;           ///< source column data (offset applied)
+  char* destination;            ///< output column data
+  input_indexalator gather_map;
+  size_type source_rows;        ///< for resolving negative map indices
+  size_type elem_size;          ///< element size in bytes
+  bool negative_indices;        ///< true if the map may hold negative indices
+};
+
+/**
+ * @brief Returns true if every column of the table can be gathered by the
+ * fused batched kernel.
+ */
+bool is_batchable(table_view const& table)
+{
+  return std::all_of(table.begin(), table.end(), [](auto const& col) {
+    return cudf::is_fixed_width(col.type()) && !col.nullable();
+  });
+}
+
+struct in_place_gather_dispatch {
+  column_view const& source;
+  mutable_column_view& destination;
+
+  template <typename T, CUDF_ENABLE_IF(cudf::is_rep_layout_compatible<T>())>
+  void operator()(column_view const& gather_map, rmm::cuda_stream_view stream)
+  {
+    auto map_begin = indexalator_factory::make_input_iterator(gather_map);
+    thrust::gather(rmm::exec_policy(stream),
+                   map_begin,
+                   map_begin + gather_map.size(),
+                   source.begin<T>(),
+                   destination.begin<T>());
+  }
+
+  template <typename T, typename... Args>
+  void operator()(Args&&...)
+  {
+    CUDF_FAIL("Unsupported type for in-place gather.");
+  }
+};
+
+}  // namespace
 
 std::unique_ptr<table> gather(table_view const& source_table,
                               column_view const& gather_map,
@@ -54,6 +115,109 @@ std::unique_ptr<table> gather(table_view const& source_table,
   return gather(source_table, map_begin, map_end, bounds_policy, stream, mr);
 }
 
+std::vector<std::unique_ptr<table>> gather(std::vector<table_view> const& source_tables,
+                                           std::vector<column_view> const& gather_maps,
+                                           out_of_bounds_policy bounds_policy,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(source_tables.size() == gather_maps.size(),
+               "A gather map must be provided for each source table");
+
+  std::vector<std::unique_ptr<table>> results(source_tables.size());
+
+  // Fixed-width, non-nullable columns from all the tables are copied by one
+  // fused kernel; nullable or variable-width columns and bounds-checked
+  // gathers take the regular per-table path.
+  std::vector<batched_gather_job> jobs;
+  std::vector<size_type> job_rows;
+  for (std::size_t tbl = 0; tbl < source_tables.size(); ++tbl) {
+    auto const& source     = source_tables[tbl];
+    auto const& gather_map = gather_maps[tbl];
+    CUDF_EXPECTS(gather_map.has_nulls() == false, "gather_map contains nulls");
+    auto const index_policy = is_unsigned(gather_map.type())
+                                ? negative_index_policy::NOT_ALLOWED
+                                : negative_index_policy::ALLOWED;
+    if (bounds_policy == out_of_bounds_policy::NULLIFY || !is_batchable(source)) {
+      results[tbl] = gather(source, gather_map, bounds_policy, index_policy, stream, mr);
+      continue;
+    }
+    std::vector<std::unique_ptr<column>> columns;
+    for (auto const& col : source) {
+      auto const elem_size = static_cast<size_type>(cudf::size_of(col.type()));
+      auto output          = make_fixed_width_column(
+        col.type(), gather_map.size(), mask_state::UNALLOCATED, stream, mr);
+      jobs.push_back(batched_gather_job{
+        col.head<char>() + static_cast<std::size_t>(col.offset()) * elem_size,
+        output->mutable_view().head<char>(),
+        indexalator_factory::make_input_iterator(gather_map),
+        col.size(),
+        elem_size,
+        index_policy == negative_index_policy::ALLOWED});
+      job_rows.push_back(gather_map.size());
+      columns.push_back(std::move(output));
+    }
+    results[tbl] = std::make_unique<table>(std::move(columns));
+  }
+
+  if (!jobs.empty()) {
+    // flattened element offsets for locating a job from a thread index
+    std::vector<size_type> h_offsets(jobs.size() + 1, 0);
+    std::partial_sum(job_rows.begin(), job_rows.end(), h_offsets.begin() + 1);
+    auto const d_jobs    = cudf::detail::make_device_uvector_async(jobs, stream);
+    auto const d_offsets = cudf::detail::make_device_uvector_async(h_offsets, stream);
+    auto const num_jobs  = static_cast<size_type>(jobs.size());
+
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      h_offsets.back(),
+      [d_jobs = d_jobs.data(), d_offsets = d_offsets.data(), num_jobs] __device__(size_type idx) {
+        auto const job_itr =
+          thrust::upper_bound(thrust::seq, d_offsets, d_offsets + num_jobs + 1, idx) - 1;
+        auto const& job = d_jobs[job_itr - d_offsets];
+        auto const row  = idx - *job_itr;
+        auto map_idx    = job.gather_map[row];
+        if (job.negative_indices && map_idx < 0) map_idx += job.source_rows;
+        memcpy(job.destination + static_cast<std::size_t>(row) * job.elem_size,
+               job.source + static_cast<std::size_t>(map_idx) * job.elem_size,
+               job.elem_size);
+      });
+  }
+
+  return results;
+}
+
+void gather_in_place(table_view const& source_table,
+                     column_view const& gather_map,
+                     mutable_table_view& destination,
+                     rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(gather_map.has_nulls() == false, "gather_map contains nulls");
+  CUDF_EXPECTS(source_table.num_columns() == destination.num_columns(),
+               "Column count mismatch between source and destination.");
+  CUDF_EXPECTS(destination.num_rows() >= gather_map.size(),
+               "Destination does not have capacity for the gathered rows.");
+
+  for (size_type i = 0; i < source_table.num_columns(); ++i) {
+    auto const& source = source_table.column(i);
+    auto& dest         = destination.column(i);
+    CUDF_EXPECTS(cudf::is_fixed_width(dest.type()),
+                 "In-place gather does not support variable-sized types.");
+    CUDF_EXPECTS(dest.type() == source.type(), "Data type mismatch.");
+    CUDF_EXPECTS(source.has_nulls() == false,
+                 "In-place gather does not support source columns with null values.");
+
+    if (gather_map.size() == 0) { continue; }
+    // any preallocated mask may carry stale nulls from a previous batch
+    if (dest.nullable()) {
+      cudf::detail::set_null_mask(dest.null_mask(), 0, gather_map.size(), true, stream);
+    }
+    cudf::type_dispatcher<dispatch_storage_type>(
+      dest.type(), in_place_gather_dispatch{source, dest}, gather_map, stream);
+  }
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> gather(table_view const& source_table,
@@ -70,4 +234,21 @@ std::unique_ptr<table> gather(table_view const& source_table,
     source_table, gather_map, bounds_policy, index_policy, rmm::cuda_stream_default, mr);
 }
 
+std::vector<std::unique_ptr<table>> gather(std::vector<table_view> const& source_tables,
+                                           std::vector<column_view> const& gather_maps,
+                                           out_of_bounds_policy bounds_policy,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::gather(source_tables, gather_maps, bounds_policy, rmm::cuda_stream_default, mr);
+}
+
+void gather_in_place(table_view const& source_table,
+                     column_view const& gather_map,
+                     mutable_table_view& destination)
+{
+  CUDF_FUNC_RANGE();
+  return detail::gather_in_place(source_table, gather_map, destination, rmm::cuda_stream_default);
+}
+
 }  // namespace cudf
@@ -17,16 +17,27 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/indexalator.cuh>
 #include <cudf/detail/is_element_valid.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/lists/detail/copying.hpp>
 #include <cudf/lists/lists_column_view.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/bit.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/logical.h>
+
+#include <string>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -190,6 +201,101 @@ struct get_element_functor {
   }
 };
 
+/**
+ * @brief Copies the validity bits of an unsliced column to the host.
+ *
+ * The copy is asynchronous; the caller must synchronize `stream` before
+ * reading the result. Returns an empty vector for non-nullable columns.
+ */
+std::vector<bitmask_type> copy_validity_async(column_view const& col, rmm::cuda_stream_view stream)
+{
+  if (!col.nullable()) { return {}; }
+  return make_std_vector_async(
+    device_span<bitmask_type const>(col.null_mask(), num_bitmask_words(col.size())), stream);
+}
+
+struct get_elements_functor {
+  template <typename T, std::enable_if_t<is_fixed_width<T>() && !is_fixed_point<T>()>* p = nullptr>
+  std::vector<std::unique_ptr<scalar>> operator()(column_view const& gathered,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+  {
+    // thrust::host_vector avoids the std::vector<bool> specialization for bool columns.
+    auto const values =
+      make_host_vector_async(device_span<T const>(gathered.head<T>(), gathered.size()), stream);
+    auto const mask = copy_validity_async(gathered, stream);
+    stream.synchronize();
+
+    using ScalarType = cudf::scalar_type_t<T>;
+    auto result      = std::vector<std::unique_ptr<scalar>>{};
+    result.reserve(gathered.size());
+    for (size_type i = 0; i < gathered.size(); ++i) {
+      auto const valid = mask.empty() || bit_is_set(mask.data(), i);
+      result.push_back(std::make_unique<ScalarType>(values[i], valid, stream, mr));
+    }
+    return result;
+  }
+
+  template <typename T, std::enable_if_t<cudf::is_fixed_point<T>()>* p = nullptr>
+  std::vector<std::unique_ptr<scalar>> operator()(column_view const& gathered,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+  {
+    using Type = typename T::rep;
+
+    auto const values =
+      make_std_vector_async(device_span<Type const>(gathered.head<Type>(), gathered.size()), stream);
+    auto const mask = copy_validity_async(gathered, stream);
+    stream.synchronize();
+
+    auto const scale = numeric::scale_type{gathered.type().scale()};
+    auto result      = std::vector<std::unique_ptr<scalar>>{};
+    result.reserve(gathered.size());
+    for (size_type i = 0; i < gathered.size(); ++i) {
+      auto const valid = mask.empty() || bit_is_set(mask.data(), i);
+      result.push_back(std::make_unique<fixed_point_scalar<T>>(values[i], scale, valid, stream, mr));
+    }
+    return result;
+  }
+
+  template <typename T, std::enable_if_t<std::is_same_v<T, string_view>>* p = nullptr>
+  std::vector<std::unique_ptr<scalar>> operator()(column_view const& gathered,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+  {
+    auto const strings = strings_column_view(gathered);
+    auto const offsets = make_std_vector_async(
+      device_span<offset_type const>(strings.offsets().head<offset_type>(), gathered.size() + 1),
+      stream);
+    auto const chars =
+      strings.chars_size() > 0
+        ? make_std_vector_async(
+            device_span<char const>(strings.chars().head<char>(), strings.chars_size()), stream)
+        : std::vector<char>{};
+    auto const mask = copy_validity_async(gathered, stream);
+    stream.synchronize();
+
+    auto result = std::vector<std::unique_ptr<scalar>>{};
+    result.reserve(gathered.size());
+    for (size_type i = 0; i < gathered.size(); ++i) {
+      auto const valid = mask.empty() || bit_is_set(mask.data(), i);
+      auto value       = valid ? std::string(chars.data() + offsets[i], offsets[i + 1] - offsets[i])
+                               : std::string{};
+      result.push_back(std::make_unique<string_scalar>(value, valid, stream, mr));
+    }
+    return result;
+  }
+
+  template <typename T,
+            std::enable_if_t<!is_fixed_width<T>() && !std::is_same_v<T, string_view>>* p = nullptr>
+  std::vector<std::unique_ptr<scalar>> operator()(column_view const&,
+                                                  rmm::cuda_stream_view,
+                                                  rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("get_elements does not support dictionary or nested types");
+  }
+};
+
 }  // namespace
 
 std::unique_ptr<scalar> get_element(column_view const& input,
@@ -201,6 +307,39 @@ std::unique_ptr<scalar> get_element(column_view const& input,
   return type_dispatcher(input.type(), get_element_functor{}, input, index, stream, mr);
 }
 
+std::vector<std::unique_ptr<scalar>> get_elements(column_view const& input,
+                                                  device_span<size_type const> indices,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_fixed_width(input.type()) || input.type().id() == type_id::STRING,
+               "get_elements does not support dictionary or nested types");
+  if (indices.empty()) { return {}; }
+
+  auto const num_rows = input.size();
+  CUDF_EXPECTS(thrust::all_of(rmm::exec_policy(stream),
+                              indices.begin(),
+                              indices.end(),
+                              [num_rows] __device__(size_type index) {
+                                return index >= 0 and index < num_rows;
+                              }),
+               "Index out of bounds");
+
+  // Gather the requested rows into a contiguous column so all values (and
+  // their validity) can be copied to the host in one transfer.
+  auto const gather_map = column_view(
+    data_type{type_to_id<size_type>()}, static_cast<size_type>(indices.size()), indices.data());
+  auto const gathered = gather(table_view{{input}},
+                               gather_map,
+                               out_of_bounds_policy::DONT_CHECK,
+                               negative_index_policy::NOT_ALLOWED,
+                               stream,
+                               rmm::mr::get_current_device_resource());
+
+  return type_dispatcher(
+    input.type(), get_elements_functor{}, gathered->get_column(0).view(), stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<scalar> get_element(column_view const& input,
@@ -210,4 +349,11 @@ std::unique_ptr<scalar> get_element(column_view const& input,
   return detail::get_element(input, index, rmm::cuda_stream_default, mr);
 }
 
+std::vector<std::unique_ptr<scalar>> get_elements(column_view const& input,
+                                                  device_span<size_type const> indices,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  return detail::get_elements(input, indices, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <io/comp/gpuinflate.h>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace cudf {
+namespace {
+
+// Identifies a compress_packed buffer; deliberately not a valid column data prefix
+constexpr uint32_t compressed_pack_magic = 0x70434B31;  // "pCK1"
+
+// Size of the independently compressed chunks. Matches the block sizes the device snappy
+// kernels are tuned for in the file writers.
+constexpr uint64_t compression_chunk_size = 64 * 1024;
+
+// Set on a chunk's size-table entry when the chunk is stored uncompressed
+constexpr uint64_t stored_raw_flag = uint64_t{1} << 63;
+
+/**
+ * @brief Leads the compressed buffer, followed by one size-table entry per chunk and then the
+ * chunk payloads back to back.
+ */
+struct compressed_pack_header {
+  uint32_t magic;
+  uint32_t chunk_size;
+  uint64_t uncompressed_size;
+  uint64_t num_chunks;
+};
+
+/**
+ * @brief Copies back-to-back chunk payloads from per-chunk source pointers.
+ *
+ * `d_chunk_offsets` holds the exclusive prefix sum of the payload sizes.
+ */
+void gather_chunk_payloads(uint8_t* d_output,
+                           uint8_t const* const* d_chunk_srcs,
+                           uint64_t const* d_chunk_offsets,
+                           uint64_t num_chunks,
+                           uint64_t total_bytes,
+                           rmm::cuda_stream_view stream)
+{
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<uint64_t>(0),
+    total_bytes,
+    [d_output, d_chunk_srcs, d_chunk_offsets, num_chunks] __device__(uint64_t idx) {
+      auto const offset_itr =
+        thrust::upper_bound(thrust::seq, d_chunk_offsets, d_chunk_offsets + num_chunks + 1, idx) -
+        1;
+      auto const chunk = offset_itr - d_chunk_offsets;
+      d_output[idx]    = d_chunk_srcs[chunk][idx - *offset_itr];
+    });
+}
+
+std::unique_ptr<packed_columns::metadata> copy_metadata(packed_columns const& input)
+{
+  if (input.metadata_ == nullptr) { return std::make_unique<packed_columns::metadata>(); }
+  return std::make_unique<packed_columns::metadata>(
+    std::vector<uint8_t>(input.metadata_->data(), input.metadata_->data() + input.metadata_->size()));
+}
+
+}  // namespace
+
+namespace detail {
+
+packed_columns compress_packed(packed_columns const& input,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  auto const total_bytes = input.gpu_data == nullptr ? 0 : input.gpu_data->size();
+  if (total_bytes == 0) {
+    return packed_columns{copy_metadata(input), std::make_unique<rmm::device_buffer>()};
+  }
+
+  auto const d_source   = static_cast<uint8_t const*>(input.gpu_data->data());
+  auto const num_chunks = (total_bytes + compression_chunk_size - 1) / compression_chunk_size;
+  // snappy worst case is len + len/6 + 32; round the stride up to keep chunks aligned
+  auto const scratch_stride = compression_chunk_size + compression_chunk_size / 6 + 64;
+
+  // compress every chunk into its own worst-case scratch slot
+  rmm::device_uvector<uint8_t> scratch(num_chunks * scratch_stride, stream);
+  std::vector<io::gpu_inflate_input_s> h_inputs(num_chunks);
+  for (uint64_t chunk = 0; chunk < num_chunks; ++chunk) {
+    auto const chunk_bytes =
+      std::min(compression_chunk_size, total_bytes - chunk * compression_chunk_size);
+    h_inputs[chunk] = io::gpu_inflate_input_s{d_source + chunk * compression_chunk_size,
+                                              chunk_bytes,
+                                              scratch.data() + chunk * scratch_stride,
+                                              scratch_stride};
+  }
+  auto d_inputs = cudf::detail::make_device_uvector_async(h_inputs, stream);
+  rmm::device_uvector<io::gpu_inflate_status_s> d_statuses(num_chunks, stream);
+  CUDA_TRY(
+    io::gpu_snap(d_inputs.data(), d_statuses.data(), static_cast<int>(num_chunks), stream));
+  auto const h_statuses = cudf::detail::make_std_vector_sync(d_statuses, stream);
+
+  // chunks that failed or did not shrink are stored uncompressed
+  std::vector<uint64_t> h_size_table(num_chunks);
+  std::vector<uint8_t const*> h_chunk_srcs(num_chunks);
+  std::vector<uint64_t> h_chunk_offsets(num_chunks + 1, 0);
+  for (uint64_t chunk = 0; chunk < num_chunks; ++chunk) {
+    auto const chunk_bytes = h_inputs[chunk].srcSize;
+    auto const compressed  = h_statuses[chunk].status == 0 &&
+                            h_statuses[chunk].bytes_written < chunk_bytes;
+    h_size_table[chunk] = compressed ? h_statuses[chunk].bytes_written
+                                     : (chunk_bytes | stored_raw_flag);
+    h_chunk_srcs[chunk] = compressed ? scratch.data() + chunk * scratch_stride
+                                     : d_source + chunk * compression_chunk_size;
+    h_chunk_offsets[chunk + 1] =
+      h_chunk_offsets[chunk] + (compressed ? h_statuses[chunk].bytes_written : chunk_bytes);
+  }
+  auto const payload_bytes = h_chunk_offsets.back();
+  auto const header_bytes  = sizeof(compressed_pack_header) + num_chunks * sizeof(uint64_t);
+
+  auto result = std::make_unique<rmm::device_buffer>(header_bytes + payload_bytes, stream, mr);
+  auto d_result = static_cast<uint8_t*>(result->data());
+
+  // header and size table, then the gathered chunk payloads
+  std::vector<uint8_t> h_header(header_bytes);
+  compressed_pack_header const header{compressed_pack_magic,
+                                      static_cast<uint32_t>(compression_chunk_size),
+                                      total_bytes,
+                                      num_chunks};
+  std::memcpy(h_header.data(), &header, sizeof(header));
+  std::memcpy(h_header.data() + sizeof(header), h_size_table.data(), num_chunks * sizeof(uint64_t));
+  CUDA_TRY(cudaMemcpyAsync(
+    d_result, h_header.data(), header_bytes, cudaMemcpyHostToDevice, stream.value()));
+
+  auto const d_chunk_srcs    = cudf::detail::make_device_uvector_async(h_chunk_srcs, stream);
+  auto const d_chunk_offsets = cudf::detail::make_device_uvector_async(h_chunk_offsets, stream);
+  gather_chunk_payloads(d_result + header_bytes,
+                        d_chunk_srcs.data(),
+                        d_chunk_offsets.data(),
+                        num_chunks,
+                        payload_bytes,
+                        stream);
+  stream.synchronize();
+
+  return packed_columns{copy_metadata(input), std::move(result)};
+}
+
+packed_columns decompress_packed(packed_columns const& input,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  auto const total_bytes = input.gpu_data == nullptr ? 0 : input.gpu_data->size();
+  if (total_bytes == 0) {
+    return packed_columns{copy_metadata(input), std::make_unique<rmm::device_buffer>()};
+  }
+  CUDF_EXPECTS(total_bytes >= sizeof(compressed_pack_header),
+               "Buffer was not produced by compress_packed");
+
+  auto const d_source = static_cast<uint8_t const*>(input.gpu_data->data());
+  compressed_pack_header header;
+  CUDA_TRY(cudaMemcpyAsync(
+    &header, d_source, sizeof(header), cudaMemcpyDeviceToHost, stream.value()));
+  stream.synchronize();
+  CUDF_EXPECTS(header.magic == compressed_pack_magic,
+               "Buffer was not produced by compress_packed");
+
+  auto const num_chunks = header.num_chunks;
+  std::vector<uint64_t> h_size_table(num_chunks);
+  CUDA_TRY(cudaMemcpyAsync(h_size_table.data(),
+                           d_source + sizeof(header),
+                           num_chunks * sizeof(uint64_t),
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  stream.synchronize();
+
+  auto result   = std::make_unique<rmm::device_buffer>(header.uncompressed_size, stream, mr);
+  auto d_result = static_cast<uint8_t*>(result->data());
+
+  auto const header_bytes = sizeof(compressed_pack_header) + num_chunks * sizeof(uint64_t);
+  std::vector<io::gpu_inflate_input_s> h_snappy_chunks;
+  std::vector<io::gpu_inflate_input_s> h_raw_chunks;
+  uint64_t payload_offset = 0;
+  for (uint64_t chunk = 0; chunk < num_chunks; ++chunk) {
+    auto const payload_bytes = h_size_table[chunk] & ~stored_raw_flag;
+    auto const chunk_bytes   = std::min(static_cast<uint64_t>(header.chunk_size),
+                                      header.uncompressed_size - chunk * header.chunk_size);
+    auto const descriptor    = io::gpu_inflate_input_s{d_source + header_bytes + payload_offset,
+                                                    payload_bytes,
+                                                    d_result + chunk * header.chunk_size,
+                                                    chunk_bytes};
+    if (h_size_table[chunk] & stored_raw_flag) {
+      h_raw_chunks.push_back(descriptor);
+    } else {
+      h_snappy_chunks.push_back(descriptor);
+    }
+    payload_offset += payload_bytes;
+  }
+
+  if (!h_snappy_chunks.empty()) {
+    auto d_snappy_chunks = cudf::detail::make_device_uvector_async(h_snappy_chunks, stream);
+    rmm::device_uvector<io::gpu_inflate_status_s> d_statuses(h_snappy_chunks.size(), stream);
+    CUDA_TRY(io::gpu_unsnap(d_snappy_chunks.data(),
+                            d_statuses.data(),
+                            static_cast<int>(h_snappy_chunks.size()),
+                            stream));
+    auto const h_statuses = cudf::detail::make_std_vector_sync(d_statuses, stream);
+    CUDF_EXPECTS(std::all_of(h_statuses.begin(),
+                             h_statuses.end(),
+                             [](auto const& status) { return status.status == 0; }),
+                 "Corrupt chunk in compressed pack buffer");
+  }
+  if (!h_raw_chunks.empty()) {
+    auto d_raw_chunks = cudf::detail::make_device_uvector_async(h_raw_chunks, stream);
+    CUDA_TRY(io::gpu_copy_uncompressed_blocks(
+      d_raw_chunks.data(), static_cast<int>(h_raw_chunks.size()), stream));
+    stream.synchronize();
+  }
+
+  return packed_columns{copy_metadata(input), std::move(result)};
+}
+
+}  // namespace detail
+
+// external APIs
+
+packed_columns compress_packed(packed_columns const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compress_packed(input, rmm::cuda_stream_default, mr);
+}
+
+packed_columns decompress_packed(packed_columns const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::decompress_packed(input, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
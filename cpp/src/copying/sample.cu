@@ -24,10 +24,16 @@
 #include <cudf/table/table_view.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
 #include <thrust/random.h>
 #include <thrust/random/uniform_int_distribution.h>
 #include <thrust/shuffle.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/unique.h>
 
 namespace cudf {
 namespace detail {
@@ -59,6 +65,53 @@ std::unique_ptr<table> sample(table_view const& input,
     auto begin = cudf::detail::make_counting_transform_iterator(0, RandomGen);
 
     return detail::gather(input, begin, begin + n, out_of_bounds_policy::DONT_CHECK, stream, mr);
+  } else if (n <= num_rows / 2) {
+    // Shuffling all row indices to keep n of them is O(num_rows). For small
+    // sample fractions, draw candidates directly instead, de-duplicate, and
+    // top up until n unique indices are collected -- O(n) independent of the
+    // table size.
+    rmm::device_uvector<size_type> selected(0, stream);
+    size_type unique_count = 0;
+    int64_t base           = 0;  // random draws consumed so far
+    while (unique_count < n) {
+      auto const need = n - unique_count;
+      // 25% + 32 headroom so collisions rarely cost another round
+      auto const draws = need + need / 4 + 32;
+      rmm::device_uvector<size_type> merged(unique_count + draws, stream);
+      thrust::copy(
+        rmm::exec_policy(stream), selected.begin(), selected.begin() + unique_count, merged.begin());
+      auto RandomGen = [seed, num_rows, base] __device__(int64_t i) {
+        thrust::default_random_engine rng(seed);
+        thrust::uniform_int_distribution<size_type> dist{0, num_rows - 1};
+        rng.discard(base + i);
+        return dist(rng);
+      };
+      thrust::transform(rmm::exec_policy(stream),
+                        thrust::counting_iterator<int64_t>(0),
+                        thrust::counting_iterator<int64_t>(draws),
+                        merged.begin() + unique_count,
+                        RandomGen);
+      thrust::sort(rmm::exec_policy(stream), merged.begin(), merged.end());
+      unique_count = static_cast<size_type>(thrust::distance(
+        merged.begin(), thrust::unique(rmm::exec_policy(stream), merged.begin(), merged.end())));
+      selected = std::move(merged);
+      base += draws;
+    }
+
+    // The draws are exchangeable over row indices, so shuffling the collected
+    // uniques and keeping the first n does not bias which rows are sampled,
+    // and gives the output rows a random order as the shuffle path does.
+    thrust::shuffle(rmm::exec_policy(stream),
+                    selected.begin(),
+                    selected.begin() + unique_count,
+                    thrust::default_random_engine(seed));
+
+    return detail::gather(input,
+                          selected.begin(),
+                          selected.begin() + n,
+                          out_of_bounds_policy::DONT_CHECK,
+                          stream,
+                          mr);
   } else {
     auto gather_map =
       make_numeric_column(data_type{type_id::INT32}, num_rows, mask_state::UNALLOCATED, stream);
@@ -31,15 +31,22 @@
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/strings/detail/scatter.cuh>
 #include <cudf/strings/string_view.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/structs/struct_view.hpp>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <thrust/binary_search.h>
 #include <thrust/count.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/sequence.h>
 
+#include <numeric>
+
 namespace cudf {
 namespace detail {
 namespace {
@@ -275,6 +282,31 @@ struct column_scalar_scatterer_impl<struct_view, MapIterator> {
   }
 };
 
+/**
+ * @brief One fixed-width column copy within a batched scatter.
+ */
+struct batched_scatter_job {
+  char const* source;                 ///< source column data (offset applied)
+  bitmask_type const* source_mask;    ///< source null mask; may be null
+  size_type source_offset;            ///< for indexing into `source_mask`
+  char* destination;                  ///< result column data
+  bitmask_type* destination_mask;     ///< result null mask; may be null
+  input_indexalator scatter_map;
+  size_type target_rows;              ///< for resolving negative map indices
+  size_type elem_size;                ///< element size in bytes
+  bool negative_indices;              ///< true if the map may hold negative indices
+};
+
+/**
+ * @brief Returns true if every column of the table can be handled by the fused
+ * batched scatter kernel.
+ */
+bool is_fused_scatterable(table_view const& table)
+{
+  return std::all_of(
+    table.begin(), table.end(), [](auto const& col) { return cudf::is_fixed_width(col.type()); });
+}
+
 }  // namespace
 
 std::unique_ptr<table> scatter(table_view const& source,
@@ -305,6 +337,129 @@ std::unique_ptr<table> scatter(table_view const& source,
   return detail::scatter(source, map_begin, map_end, target, check_bounds, stream, mr);
 }
 
+std::unique_ptr<table> scatter(std::vector<table_view> const& sources,
+                               std::vector<column_view> const& scatter_maps,
+                               table_view const& target,
+                               bool check_bounds,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(sources.size() == scatter_maps.size(),
+               "A scatter map must be provided for each source table");
+  for (std::size_t idx = 0; idx < sources.size(); ++idx) {
+    CUDF_EXPECTS(sources[idx].num_columns() == target.num_columns(),
+                 "Number of columns in source and target not equal");
+    CUDF_EXPECTS(scatter_maps[idx].size() <= sources[idx].num_rows(),
+                 "Size of scatter map must be equal to or less than source rows");
+    CUDF_EXPECTS(std::equal(sources[idx].begin(),
+                            sources[idx].end(),
+                            target.begin(),
+                            [](auto const& col1, auto const& col2) {
+                              return col1.type().id() == col2.type().id();
+                            }),
+                 "Column types do not match between source and target");
+    CUDF_EXPECTS(scatter_maps[idx].has_nulls() == false, "Scatter map contains nulls");
+  }
+
+  // Variable-width or nested columns and bounds-checked maps take the regular
+  // one-scatter-per-pair path.
+  auto const fused = !check_bounds && is_fused_scatterable(target) &&
+                     std::all_of(sources.begin(), sources.end(), [](auto const& source) {
+                       return is_fused_scatterable(source);
+                     });
+  if (!fused) {
+    std::unique_ptr<table> result;
+    table_view current = target;
+    for (std::size_t idx = 0; idx < sources.size(); ++idx) {
+      if (scatter_maps[idx].is_empty()) { continue; }
+      result  = scatter(sources[idx], scatter_maps[idx], current, check_bounds, stream, mr);
+      current = result->view();
+    }
+    if (result == nullptr) { result = std::make_unique<table>(target, stream, mr); }
+    return result;
+  }
+
+  auto result            = std::make_unique<table>(target, stream, mr);
+  auto const target_rows = target.num_rows();
+
+  // a result column needs a mask if any of its sources carry nulls
+  for (size_type col_idx = 0; col_idx < target.num_columns(); ++col_idx) {
+    auto& col = result->get_column(col_idx);
+    if (col.nullable()) { continue; }
+    if (std::any_of(sources.begin(), sources.end(), [col_idx](auto const& source) {
+          return source.column(col_idx).has_nulls();
+        })) {
+      col.set_null_mask(create_null_mask(col.size(), mask_state::ALL_VALID, stream, mr), 0);
+    }
+  }
+
+  std::vector<batched_scatter_job> jobs;
+  std::vector<size_type> job_rows;
+  for (std::size_t idx = 0; idx < sources.size(); ++idx) {
+    auto const& scatter_map = scatter_maps[idx];
+    if (scatter_map.is_empty()) { continue; }
+    bool const negative_indices = !is_unsigned(scatter_map.type());
+    for (size_type col_idx = 0; col_idx < target.num_columns(); ++col_idx) {
+      auto const source     = sources[idx].column(col_idx);
+      auto destination      = result->get_column(col_idx).mutable_view();
+      auto const elem_size  = static_cast<size_type>(cudf::size_of(source.type()));
+      jobs.push_back(batched_scatter_job{
+        source.head<char>() + static_cast<std::size_t>(source.offset()) * elem_size,
+        source.null_mask(),
+        source.offset(),
+        destination.head<char>(),
+        destination.null_mask(),
+        indexalator_factory::make_input_iterator(scatter_map),
+        target_rows,
+        elem_size,
+        negative_indices});
+      job_rows.push_back(scatter_map.size());
+    }
+  }
+
+  if (!jobs.empty()) {
+    // flattened element offsets for locating a job from a thread index
+    std::vector<size_type> h_offsets(jobs.size() + 1, 0);
+    std::partial_sum(job_rows.begin(), job_rows.end(), h_offsets.begin() + 1);
+    auto const d_jobs    = cudf::detail::make_device_uvector_async(jobs, stream);
+    auto const d_offsets = cudf::detail::make_device_uvector_async(h_offsets, stream);
+    auto const num_jobs  = static_cast<size_type>(jobs.size());
+
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      h_offsets.back(),
+      [d_jobs = d_jobs.data(), d_offsets = d_offsets.data(), num_jobs] __device__(size_type idx) {
+        auto const job_itr =
+          thrust::upper_bound(thrust::seq, d_offsets, d_offsets + num_jobs + 1, idx) - 1;
+        auto const& job = d_jobs[job_itr - d_offsets];
+        auto const row  = idx - *job_itr;
+        auto dst_row    = job.scatter_map[row];
+        if (job.negative_indices && dst_row < 0) dst_row += job.target_rows;
+        memcpy(job.destination + static_cast<std::size_t>(dst_row) * job.elem_size,
+               job.source + static_cast<std::size_t>(row) * job.elem_size,
+               job.elem_size);
+        if (job.destination_mask != nullptr) {
+          bool const valid =
+            job.source_mask == nullptr || bit_is_set(job.source_mask, job.source_offset + row);
+          if (valid) {
+            set_bit(job.destination_mask, dst_row);
+          } else {
+            clear_bit(job.destination_mask, dst_row);
+          }
+        }
+      });
+
+    // null counts have changed in data-dependent ways; recompute them lazily
+    for (size_type col_idx = 0; col_idx < target.num_columns(); ++col_idx) {
+      auto& col = result->get_column(col_idx);
+      if (col.nullable()) { col.set_null_count(UNKNOWN_NULL_COUNT); }
+    }
+  }
+
+  return result;
+}
+
 std::unique_ptr<table> scatter(std::vector<std::reference_wrapper<const scalar>> const& source,
                                column_view const& indices,
                                table_view const& target,
@@ -497,6 +652,16 @@ std::unique_ptr<table> scatter(std::vector<std::reference_wrapper<const scalar>>
   return detail::scatter(source, indices, target, check_bounds, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<table> scatter(std::vector<table_view> const& sources,
+                               std::vector<column_view> const& scatter_maps,
+                               table_view const& target,
+                               bool check_bounds,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::scatter(sources, scatter_maps, target, check_bounds, rmm::cuda_stream_default, mr);
+}
+
 std::unique_ptr<table> boolean_mask_scatter(table_view const& input,
                                             table_view const& target,
                                             column_view const& boolean_mask,
@@ -18,7 +18,6 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/iterator.cuh>
-#include <cudf/detail/null_mask.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/utilities/error.hpp>
 
@@ -36,12 +35,19 @@ std::vector<column_view> slice(column_view const& input,
 
   if (indices.empty()) return {};
 
-  // need to shift incoming indices by the column offset to generate the correct bit ranges
-  // to count
-  auto indices_iter = cudf::detail::make_counting_transform_iterator(
-    0, [offset = input.offset(), &indices](size_type index) { return indices[index] + offset; });
-  auto null_counts = cudf::detail::segmented_count_unset_bits(
-    input.null_mask(), indices_iter, indices_iter + indices.size(), stream);
+  // Null counts are only filled in when they are free to produce; otherwise
+  // the output views carry UNKNOWN_NULL_COUNT and compute (and cache) the
+  // count on first use. This keeps slice itself off the device, which matters
+  // to window-heavy callers that create far more views than they ever ask
+  // null counts of.
+  auto const null_count_of = [&input](size_type slice_size) {
+    if (!input.nullable()) { return size_type{0}; }
+    if (input.null_count_known()) {
+      if (input.null_count() == 0) { return size_type{0}; }
+      if (input.null_count() == input.size()) { return slice_size; }
+    }
+    return UNKNOWN_NULL_COUNT;
+  };
 
   auto const children = std::vector<column_view>(input.child_begin(), input.child_end());
 
@@ -55,7 +61,7 @@ std::vector<column_view> slice(column_view const& input,
                        end - begin,
                        input.head(),
                        input.null_mask(),
-                       null_counts[i],
+                       null_count_of(end - begin),
                        input.offset() + begin,
                        children};
   };
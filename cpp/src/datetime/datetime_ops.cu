@@ -20,12 +20,17 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/datetime.hpp>
 #include <cudf/detail/datetime.hpp>
+#include <cudf/detail/datetime_ops.cuh>
 #include <cudf/detail/indexalator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -34,24 +39,14 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 
 namespace cudf {
 namespace datetime {
 namespace detail {
-enum class datetime_component {
-  INVALID = 0,
-  YEAR,
-  MONTH,
-  DAY,
-  WEEKDAY,
-  HOUR,
-  MINUTE,
-  SECOND,
-  MILLISECOND,
-  MICROSECOND,
-  NANOSECOND
-};
+using cudf::datetime::datetime_component;
 
 template <datetime_component Component>
 struct extract_component_operator {
@@ -288,6 +283,65 @@ std::unique_ptr<column> apply_datetime_op(column_view const& column,
   return output;
 }
 
+// Decompose every timestamp once and write all requested components, instead
+// of repeating the civil-time decomposition per extract_* call
+struct extract_components_functor {
+  column_view input;
+  device_span<datetime_component const> components;
+  device_span<int16_t* const> outputs;
+
+  template <typename Element>
+  typename std::enable_if_t<!cudf::is_timestamp_t<Element>::value, void> operator()(
+    rmm::cuda_stream_view stream) const
+  {
+    CUDF_FAIL("Cannot extract datetime component from non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  typename std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, void> operator()(
+    rmm::cuda_stream_view stream) const
+  {
+    auto const d_timestamps = input.begin<Timestamp>();
+    auto const d_components = components;
+    auto const d_outputs    = outputs;
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      input.size(),
+      [d_timestamps, d_components, d_outputs] __device__(size_type row) {
+        using namespace cuda::std::chrono;
+
+        auto const ts               = d_timestamps[row];
+        auto const days_since_epoch = floor<days>(ts);
+
+        auto time_since_midnight = ts - days_since_epoch;
+        if (time_since_midnight.count() < 0) { time_since_midnight += days(1); }
+
+        auto const hrs_  = duration_cast<hours>(time_since_midnight);
+        auto const mins_ = duration_cast<minutes>(time_since_midnight - hrs_);
+        auto const secs_ = duration_cast<seconds>(time_since_midnight - hrs_ - mins_);
+        auto const ymd   = year_month_day(days_since_epoch);
+
+        for (std::size_t c = 0; c < d_components.size(); ++c) {
+          int16_t value = 0;
+          switch (d_components[c]) {
+            case datetime_component::YEAR: value = static_cast<int>(ymd.year()); break;
+            case datetime_component::MONTH: value = static_cast<unsigned>(ymd.month()); break;
+            case datetime_component::DAY: value = static_cast<unsigned>(ymd.day()); break;
+            case datetime_component::WEEKDAY:
+              value = year_month_weekday(days_since_epoch).weekday().iso_encoding();
+              break;
+            case datetime_component::HOUR: value = hrs_.count(); break;
+            case datetime_component::MINUTE: value = mins_.count(); break;
+            case datetime_component::SECOND: value = secs_.count(); break;
+            default: break;
+          }
+          d_outputs[c][row] = value;
+        }
+      });
+  }
+};
+
 struct add_calendrical_months_functor {
   template <typename Element, typename... Args>
   typename std::enable_if_t<!cudf::is_timestamp_t<Element>::value, std::unique_ptr<column>>
@@ -324,20 +378,8 @@ struct add_calendrical_months_functor {
                       [] __device__(auto time_val, auto months_val) {
                         using namespace cuda::std::chrono;
                         using duration_m = duration<int32_t, months::period>;
-
-                        // Get the days component from the input
-                        auto days_since_epoch = floor<days>(time_val);
-
-                        // Add the number of months
-                        year_month_day ymd{days_since_epoch};
-                        ymd += duration_m{months_val};
-
-                        // If the new date isn't valid, scale it back to the last day of the
-                        // month.
-                        if (!ymd.ok()) ymd = ymd.year() / ymd.month() / last;
-
-                        // Put back the time component to the date
-                        return sys_days{ymd} + (time_val - days_since_epoch);
+                        return add_calendrical_months_with_scale_back(time_val,
+                                                                      duration_m{months_val});
                       });
     return output;
   }
@@ -364,9 +406,9 @@ std::unique_ptr<column> add_calendrical_months(column_view const& timestamp_colu
                                 stream,
                                 mr);
 
-  auto output_null_mask =
+  auto [output_null_mask, null_count] =
     cudf::detail::bitmask_and(table_view{{timestamp_column, months_column}}, stream, mr);
-  output->set_null_mask(std::move(output_null_mask));
+  output->set_null_mask(std::move(output_null_mask), null_count);
   return output;
 }
 
@@ -469,6 +511,55 @@ std::unique_ptr<column> extract_second(column_view const& column,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
+std::unique_ptr<table> extract_datetime_components(
+  column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
+  CUDF_EXPECTS(not components.empty(), "No datetime components requested");
+  for (auto component : components) {
+    CUDF_EXPECTS(component >= datetime_component::YEAR and component <= datetime_component::SECOND,
+                 "Unsupported datetime component");
+  }
+
+  auto const size            = column.size();
+  auto const output_col_type = data_type{type_id::INT16};
+
+  std::vector<std::unique_ptr<column>> outputs;
+  outputs.reserve(components.size());
+
+  // Return empty columns if source column is empty
+  if (size == 0) {
+    for (std::size_t c = 0; c < components.size(); ++c) {
+      outputs.push_back(make_empty_column(output_col_type));
+    }
+    return std::make_unique<table>(std::move(outputs));
+  }
+
+  std::vector<int16_t*> output_ptrs;
+  output_ptrs.reserve(components.size());
+  for (std::size_t c = 0; c < components.size(); ++c) {
+    outputs.push_back(make_fixed_width_column(output_col_type,
+                                              size,
+                                              cudf::detail::copy_bitmask(column, stream, mr),
+                                              column.null_count(),
+                                              stream,
+                                              mr));
+    output_ptrs.push_back(outputs.back()->mutable_view().begin<int16_t>());
+  }
+
+  auto const temp_mr      = cudf::get_temp_memory_resource();
+  auto const d_components = cudf::detail::make_device_uvector_async(components, stream, temp_mr);
+  auto const d_outputs    = cudf::detail::make_device_uvector_async(output_ptrs, stream, temp_mr);
+
+  type_dispatcher(
+    column.type(), extract_components_functor{column, d_components, d_outputs}, stream);
+
+  return std::make_unique<table>(std::move(outputs));
+}
+
 std::unique_ptr<column> last_day_of_month(column_view const& column,
                                           rmm::cuda_stream_view stream,
                                           rmm::mr::device_memory_resource* mr)
@@ -606,6 +697,14 @@ std::unique_ptr<column> extract_second(column_view const& column,
   return detail::extract_second(column, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<table> extract_datetime_components(column_view const& column,
+                                                   std::vector<datetime_component> const& components,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extract_datetime_components(column, components, rmm::cuda_stream_default, mr);
+}
+
 std::unique_ptr<column> last_day_of_month(column_view const& column,
                                           rmm::mr::device_memory_resource* mr)
 {
@@ -40,7 +40,7 @@ std::unique_ptr<column> merge(dictionary_column_view const& lcol,
   auto const rcol_iter = cudf::detail::indexalator_factory::make_input_iterator(rcol.indices());
 
   // create output indices column
-  auto const merged_size  = lcol.size() + rcol.size();
+  auto const merged_size  = static_cast<size_type>(row_order.size());
   auto const indices_type = get_indices_type_for_size(merged_size);
   auto indices_column =
     make_fixed_width_column(indices_type, merged_size, cudf::mask_state::UNALLOCATED, stream, mr);
@@ -59,7 +59,12 @@ std::unique_ptr<column> merge(dictionary_column_view const& lcol,
                                 : rcol_iter[index]);
                     });
 
-  // build dictionary; the validity mask is updated by the caller
+  // build dictionary; the validity mask is updated by the caller. A row order covering
+  // only a subset of the input rows (e.g. merge_upsert) makes the exact null count
+  // unknowable up front.
+  auto const null_count = merged_size == lcol.size() + rcol.size()
+                            ? lcol.null_count() + rcol.null_count()
+                            : cudf::UNKNOWN_NULL_COUNT;
   return make_dictionary_column(
     std::make_unique<column>(lcol.keys(), stream, mr),
     std::move(indices_column),
@@ -68,7 +73,7 @@ std::unique_ptr<column> merge(dictionary_column_view const& lcol,
       mask_state::UNINITIALIZED,
       stream,
       mr),
-    lcol.null_count() + rcol.null_count());
+    null_count);
 }
 
 }  // namespace detail
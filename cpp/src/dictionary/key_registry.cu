@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/dictionary/key_registry.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/logical.h>
+
+namespace cudf {
+namespace dictionary {
+namespace {
+
+/**
+ * @brief Create unsigned indices for a dictionary column by mapping the given
+ * INT32 positions through the minimal indices type for the key-set size.
+ *
+ * The positions buffer is moved into the result for the UINT32 case.
+ */
+std::unique_ptr<column> make_unsigned_indices(std::unique_ptr<column> positions,
+                                              size_type keys_size,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  auto const indices_type = detail::get_indices_type_for_size(keys_size);
+  auto const indices_size = positions->size();
+  // we can use the positions data directly for the UINT32 case
+  if (indices_type.id() == type_id::UINT32) {
+    auto contents = positions->release();
+    return std::make_unique<column>(data_type{type_id::UINT32},
+                                    indices_size,
+                                    std::move(*(contents.data.release())),
+                                    rmm::device_buffer{0, stream, mr},
+                                    0);
+  }
+  // otherwise we need to convert the positions
+  column_view cast_view(positions->type(), indices_size, positions->view().head(), nullptr, 0);
+  return cudf::detail::cast(cast_view, indices_type, stream, mr);
+}
+
+}  // namespace
+
+key_registry::key_registry(data_type keys_type)
+  : _keys_type(keys_type), _keys(make_empty_column(keys_type))
+{
+}
+
+size_type key_registry::size() const { return _keys->size(); }
+
+column_view key_registry::keys() const { return _keys->view(); }
+
+size_type key_registry::add_keys(column_view const& new_keys,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(new_keys.type() == _keys_type, "Keys must match the registry keys type");
+  CUDF_EXPECTS(!new_keys.has_nulls(), "Keys must not have nulls");
+  if (new_keys.is_empty()) { return 0; }
+
+  auto temp_mr = cudf::get_temp_memory_resource();
+
+  // fast path: if every value is already registered the key-set is untouched
+  // so previously issued indices and key views remain valid
+  if (!_keys->view().is_empty()) {
+    auto matches = cudf::detail::contains(_keys->view(), new_keys, stream, temp_mr);
+    auto const all_found = thrust::all_of(rmm::exec_policy(stream),
+                                          matches->view().begin<bool>(),
+                                          matches->view().end<bool>(),
+                                          thrust::identity<bool>{});
+    if (all_found) { return 0; }
+  }
+
+  auto const old_size = _keys->size();
+  // merge the new values into the key-set -- sorted and unique
+  auto combined_keys =
+    cudf::detail::concatenate(std::vector<column_view>{_keys->view(), new_keys}, stream, temp_mr);
+  auto table_keys = cudf::detail::drop_duplicates(table_view{{combined_keys->view()}},
+                                                  std::vector<size_type>{0},
+                                                  duplicate_keep_option::KEEP_FIRST,
+                                                  null_equality::EQUAL,
+                                                  null_order::BEFORE,
+                                                  stream,
+                                                  mr)
+                      ->release();
+  std::unique_ptr<column> keys_column(std::move(table_keys.front()));
+
+  // cache the remap table from the prior key positions to the new ones
+  // lower_bound([a,b,c,d,e,f],[a,b,c,d,f]) = [0,1,2,3,5]
+  if (old_size > 0) {
+    _remap         = cudf::detail::lower_bound(table_view{{keys_column->view()}},
+                                       table_view{{_keys->view()}},
+                                       std::vector<order>{order::ASCENDING},
+                                       std::vector<null_order>{null_order::AFTER},
+                                       stream,
+                                       mr);
+    _previous_size = old_size;
+  }
+
+  _keys = std::move(keys_column);
+  return _keys->size() - old_size;
+}
+
+std::unique_ptr<column> key_registry::encode(column_view const& input_column,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(input_column.type() == _keys_type, "Column must match the registry keys type");
+
+  auto temp_mr = cudf::get_temp_memory_resource();
+
+  // gather the unique values of this batch and register any new ones
+  auto batch_table = cudf::detail::drop_duplicates(table_view{{input_column}},
+                                                   std::vector<size_type>{0},
+                                                   duplicate_keep_option::KEEP_FIRST,
+                                                   null_equality::EQUAL,
+                                                   null_order::BEFORE,
+                                                   stream,
+                                                   temp_mr);
+  auto batch_keys  = batch_table->get_column(0).view();
+  if (input_column.has_nulls()) {  // the null entry sorts first; remove it
+    batch_keys = cudf::slice(batch_keys, std::vector<size_type>{1, batch_keys.size()}).front();
+  }
+  add_keys(batch_keys, stream, mr);
+
+  // compute the indices against the (possibly grown) key-set;
+  // null rows produce an out-of-range position masked by the null mask
+  auto positions      = cudf::detail::lower_bound(table_view{{_keys->view()}},
+                                             table_view{{input_column}},
+                                             std::vector<order>{order::ASCENDING},
+                                             std::vector<null_order>{null_order::AFTER},
+                                             stream,
+                                             mr);
+  auto indices_column = make_unsigned_indices(std::move(positions), _keys->size(), stream, mr);
+
+  // each output column owns its own copy of the key-set
+  auto keys_column = std::make_unique<column>(_keys->view(), stream, mr);
+  return make_dictionary_column(std::move(keys_column),
+                                std::move(indices_column),
+                                cudf::detail::copy_bitmask(input_column, stream, mr),
+                                input_column.null_count());
+}
+
+std::unique_ptr<column> key_registry::remap(dictionary_column_view const& dictionary_column,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  auto old_keys = dictionary_column.keys();
+  CUDF_EXPECTS(old_keys.type() == _keys_type, "Keys must match the registry keys type");
+  CUDF_EXPECTS(old_keys.size() <= _keys->size(),
+               "Dictionary has more keys than the registry");
+
+  // already on the current key-set
+  if (old_keys.size() == _keys->size()) {
+    return std::make_unique<column>(dictionary_column.parent(), stream, mr);
+  }
+
+  // the key-set only grows, so a key-set size identifies a unique point in the
+  // registry's history; the cached remap covers the most recent growth
+  auto const use_cached = _remap && (old_keys.size() == _previous_size);
+  auto computed_map     = use_cached ? nullptr
+                                     : cudf::detail::lower_bound(table_view{{_keys->view()}},
+                                                             table_view{{old_keys}},
+                                                             std::vector<order>{order::ASCENDING},
+                                                             std::vector<null_order>{null_order::AFTER},
+                                                             stream,
+                                                             cudf::get_temp_memory_resource());
+  auto const map_view   = use_cached ? _remap->view() : computed_map->view();
+
+  // map the old indices to the new positions
+  column_view indices_view(dictionary_column.indices().type(),
+                           dictionary_column.size(),
+                           dictionary_column.indices().head(),
+                           nullptr,
+                           0,
+                           dictionary_column.offset());
+  auto table_positions = cudf::detail::gather(table_view{{map_view}},
+                                              indices_view,
+                                              cudf::out_of_bounds_policy::NULLIFY,
+                                              cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                              stream,
+                                              mr)
+                           ->release();
+  // any nulls in the gather result correspond to null rows already tracked
+  // by the parent null mask; make_unsigned_indices uses the data directly
+  auto indices_column =
+    make_unsigned_indices(std::move(table_positions.front()), _keys->size(), stream, mr);
+
+  auto keys_column = std::make_unique<column>(_keys->view(), stream, mr);
+  return make_dictionary_column(
+    std::move(keys_column),
+    std::move(indices_column),
+    cudf::detail::copy_bitmask(dictionary_column.parent(), stream, mr),
+    dictionary_column.null_count());
+}
+
+}  // namespace dictionary
+}  // namespace cudf
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/execution/plan.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/join.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/stream_pool.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace execution {
+namespace {
+
+/**
+ * @brief Owning wrapper over a CUDA event used to express inter-stream dependencies.
+ */
+struct cuda_event {
+  cuda_event() { CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming)); }
+  ~cuda_event() { cudaEventDestroy(event); }
+  cuda_event(cuda_event const&) = delete;
+  cuda_event& operator=(cuda_event const&) = delete;
+
+  cudaEvent_t event{};
+};
+
+}  // namespace
+
+struct plan::node {
+  enum class op { SOURCE, FILTER, PROJECT, INNER_JOIN, AGGREGATE };
+
+  op type;
+  std::vector<node_id> inputs;
+
+  // SOURCE
+  table_view source;
+  // FILTER
+  ast::expression const* predicate = nullptr;
+  // PROJECT
+  std::vector<std::reference_wrapper<ast::expression const>> exprs;
+  // INNER_JOIN
+  std::vector<size_type> left_on;
+  std::vector<size_type> right_on;
+  null_equality compare_nulls = null_equality::EQUAL;
+  // AGGREGATE
+  std::vector<size_type> keys;
+  std::vector<std::pair<size_type, std::unique_ptr<groupby_aggregation>>> aggregations;
+};
+
+plan::plan()  = default;
+plan::~plan() = default;
+
+node_id plan::add_source(table_view const& input)
+{
+  node nd;
+  nd.type   = node::op::SOURCE;
+  nd.source = input;
+  _nodes.push_back(std::move(nd));
+  return static_cast<node_id>(_nodes.size() - 1);
+}
+
+node_id plan::add_filter(node_id input, ast::expression const& predicate)
+{
+  CUDF_EXPECTS(input >= 0 && static_cast<std::size_t>(input) < _nodes.size(), "Unknown node id");
+  node nd;
+  nd.type      = node::op::FILTER;
+  nd.inputs    = {input};
+  nd.predicate = &predicate;
+  _nodes.push_back(std::move(nd));
+  return static_cast<node_id>(_nodes.size() - 1);
+}
+
+node_id plan::add_project(node_id input,
+                          std::vector<std::reference_wrapper<ast::expression const>> exprs)
+{
+  CUDF_EXPECTS(input >= 0 && static_cast<std::size_t>(input) < _nodes.size(), "Unknown node id");
+  CUDF_EXPECTS(not exprs.empty(), "Projection requires at least one expression");
+  node nd;
+  nd.type   = node::op::PROJECT;
+  nd.inputs = {input};
+  nd.exprs  = std::move(exprs);
+  _nodes.push_back(std::move(nd));
+  return static_cast<node_id>(_nodes.size() - 1);
+}
+
+node_id plan::add_inner_join(node_id left,
+                             node_id right,
+                             std::vector<size_type> left_on,
+                             std::vector<size_type> right_on,
+                             null_equality compare_nulls)
+{
+  CUDF_EXPECTS(left >= 0 && static_cast<std::size_t>(left) < _nodes.size(), "Unknown node id");
+  CUDF_EXPECTS(right >= 0 && static_cast<std::size_t>(right) < _nodes.size(), "Unknown node id");
+  node nd;
+  nd.type          = node::op::INNER_JOIN;
+  nd.inputs        = {left, right};
+  nd.left_on       = std::move(left_on);
+  nd.right_on      = std::move(right_on);
+  nd.compare_nulls = compare_nulls;
+  _nodes.push_back(std::move(nd));
+  return static_cast<node_id>(_nodes.size() - 1);
+}
+
+node_id plan::add_aggregate(
+  node_id input,
+  std::vector<size_type> keys,
+  std::vector<std::pair<size_type, std::unique_ptr<groupby_aggregation>>> aggregations)
+{
+  CUDF_EXPECTS(input >= 0 && static_cast<std::size_t>(input) < _nodes.size(), "Unknown node id");
+  CUDF_EXPECTS(not keys.empty(), "Aggregation requires at least one key column");
+  CUDF_EXPECTS(not aggregations.empty(), "Aggregation requires at least one aggregation");
+  node nd;
+  nd.type         = node::op::AGGREGATE;
+  nd.inputs       = {input};
+  nd.keys         = std::move(keys);
+  nd.aggregations = std::move(aggregations);
+  _nodes.push_back(std::move(nd));
+  return static_cast<node_id>(_nodes.size() - 1);
+}
+
+std::unique_ptr<table> plan::execute(rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(not _nodes.empty(), "Cannot execute an empty plan");
+
+  auto const num_nodes = _nodes.size();
+  auto const root      = static_cast<node_id>(num_nodes - 1);
+
+  // Fuse chains of filters whose intermediate result has no other consumer
+  // into one pass over the conjunction of the predicates. Node ids are
+  // topologically ordered (inputs always precede consumers), so one ascending
+  // sweep fuses chains of any length.
+  std::vector<std::size_t> num_consumers(num_nodes, 0);
+  for (auto const& nd : _nodes) {
+    for (auto const input : nd.inputs) { ++num_consumers[input]; }
+  }
+  for (node_id i = 0; i < root; ++i) {
+    CUDF_EXPECTS(num_consumers[i] > 0, "Plan contains a node whose result is never consumed");
+  }
+
+  std::list<ast::operation> fused_predicates;
+  std::vector<bool> elided(num_nodes, false);
+  std::vector<ast::expression const*> predicate(num_nodes, nullptr);
+  std::vector<std::vector<node_id>> inputs(num_nodes);
+  for (std::size_t i = 0; i < num_nodes; ++i) {
+    predicate[i] = _nodes[i].predicate;
+    inputs[i]    = _nodes[i].inputs;
+  }
+  for (node_id i = 0; i <= root; ++i) {
+    if (_nodes[i].type != node::op::FILTER) { continue; }
+    auto const upstream = inputs[i].front();
+    if (_nodes[upstream].type == node::op::FILTER && num_consumers[upstream] == 1) {
+      fused_predicates.emplace_back(
+        ast::ast_operator::LOGICAL_AND, *predicate[upstream], *predicate[i]);
+      predicate[i]     = &fused_predicates.back();
+      inputs[i].front() = inputs[upstream].front();
+      elided[upstream] = true;
+    }
+  }
+
+  // Recount consumers over the fused graph; the counts drive eager release.
+  std::fill(num_consumers.begin(), num_consumers.end(), 0);
+  for (node_id i = 0; i <= root; ++i) {
+    if (elided[i]) { continue; }
+    for (auto const input : inputs[i]) { ++num_consumers[input]; }
+  }
+
+  // Assign streams: a node's first input continues on its own stream, every
+  // further input starts an independent branch on a pooled stream. Operators
+  // whose public API is not stream-aware run on the default stream instead;
+  // the events below express the dependencies either way.
+  std::vector<rmm::cuda_stream_view> branch_stream(num_nodes, stream);
+  for (node_id i = root; i >= 0; --i) {
+    if (elided[i] || inputs[i].empty()) { continue; }
+    branch_stream[inputs[i].front()] = branch_stream[i];
+    for (std::size_t k = 1; k < inputs[i].size(); ++k) {
+      branch_stream[inputs[i][k]] = get_stream_from_pool();
+    }
+  }
+  auto const exec_stream = [&](node_id i) {
+    auto const type = _nodes[i].type;
+    return (type == node::op::INNER_JOIN || type == node::op::AGGREGATE)
+             ? rmm::cuda_stream_default
+             : branch_stream[i];
+  };
+
+  std::vector<std::unique_ptr<table>> results(num_nodes);
+  std::vector<table_view> views(num_nodes);
+  std::vector<std::unique_ptr<cuda_event>> issued(num_nodes);
+
+  for (node_id i = 0; i <= root; ++i) {
+    if (elided[i]) { continue; }
+    auto const& nd = _nodes[i];
+    if (nd.type == node::op::SOURCE) {
+      views[i] = nd.source;
+      continue;
+    }
+
+    // Wait for producers issued on other streams before consuming them.
+    for (auto const input : inputs[i]) {
+      if (issued[input] && exec_stream(input).value() != exec_stream(i).value()) {
+        CUDA_TRY(cudaStreamWaitEvent(exec_stream(i).value(), issued[input]->event, 0));
+      }
+    }
+
+    // Intermediate results are operator-scoped scratch; only the root is
+    // allocated from the caller's resource.
+    auto* node_mr = (i == root) ? mr : rmm::mr::get_current_device_resource();
+    switch (nd.type) {
+      case node::op::FILTER:
+        results[i] = cudf::filter(views[inputs[i].front()], *predicate[i], exec_stream(i), node_mr);
+        break;
+      case node::op::PROJECT:
+        results[i] =
+          cudf::compute_columns(views[inputs[i].front()], nd.exprs, exec_stream(i), node_mr);
+        break;
+      case node::op::INNER_JOIN:
+        results[i] = cudf::inner_join(views[inputs[i].front()],
+                                      views[inputs[i].back()],
+                                      nd.left_on,
+                                      nd.right_on,
+                                      nd.compare_nulls,
+                                      node_mr);
+        break;
+      case node::op::AGGREGATE: {
+        auto const& input_view = views[inputs[i].front()];
+        std::vector<groupby::aggregation_request> requests;
+        for (auto const& [value_index, agg] : nd.aggregations) {
+          groupby::aggregation_request request;
+          request.values = input_view.column(value_index);
+          // clone() preserves the dynamic type, so the cast cannot fail
+          request.aggregations.emplace_back(
+            static_cast<groupby_aggregation*>(agg->clone().release()));
+          requests.push_back(std::move(request));
+        }
+        groupby::groupby gb_obj(input_view.select(nd.keys));
+        auto [group_keys, group_results] = gb_obj.aggregate(requests, node_mr);
+        auto columns                     = group_keys->release();
+        for (auto& result : group_results) {
+          for (auto& col : result.results) { columns.push_back(std::move(col)); }
+        }
+        results[i] = std::make_unique<table>(std::move(columns));
+        break;
+      }
+      default: CUDF_FAIL("Unexpected plan node type");
+    }
+    views[i]  = results[i]->view();
+    issued[i] = std::make_unique<cuda_event>();
+    CUDA_TRY(cudaEventRecord(issued[i]->event, exec_stream(i).value()));
+
+    // Release inputs whose last consumer has now been issued. The producing
+    // stream first waits on this node's event so the stream-ordered
+    // deallocation cannot overtake the consuming kernels.
+    for (auto const input : inputs[i]) {
+      if (issued[input]) {
+        CUDA_TRY(cudaStreamWaitEvent(exec_stream(input).value(), issued[i]->event, 0));
+      }
+      if (--num_consumers[input] == 0 && results[input]) { results[input].reset(); }
+    }
+  }
+
+  // Order the caller's stream behind the root before handing the result back.
+  if (exec_stream(root).value() != stream.value()) {
+    CUDA_TRY(cudaStreamWaitEvent(stream.value(), issued[root]->event, 0));
+  }
+  return std::move(results[root]);
+}
+
+}  // namespace execution
+}  // namespace cudf
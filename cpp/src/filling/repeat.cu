@@ -23,7 +23,9 @@
 #include <cudf/detail/repeat.hpp>
 #include <cudf/filling.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -34,13 +36,17 @@
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_output_iterator.h>
 #include <thrust/scan.h>
+#include <thrust/transform.h>
 
 #include <limits>
 #include <memory>
+#include <utility>
 
 namespace {
 struct count_accessor {
@@ -95,6 +101,24 @@ struct count_checker {
   }
 };
 
+template <typename RowEqual>
+struct run_start_fn {
+  RowEqual comp;
+
+  __device__ bool operator()(cudf::size_type i) { return i == 0 or not comp(i, i - 1); }
+};
+
+struct run_length_fn {
+  cudf::size_type const* run_starts;
+  cudf::size_type const num_runs;
+  cudf::size_type const num_rows;
+
+  __device__ cudf::size_type operator()(cudf::size_type i)
+  {
+    return (i + 1 == num_runs ? num_rows : run_starts[i + 1]) - run_starts[i];
+  }
+};
+
 }  // namespace
 
 namespace cudf {
@@ -156,6 +180,57 @@ std::unique_ptr<table> repeat(table_view const& input_table,
   return gather(input_table, map_begin, map_end, out_of_bounds_policy::DONT_CHECK, stream, mr);
 }
 
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> run_length_encode(
+  table_view const& input, rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = input.num_rows();
+  if (num_rows == 0) {
+    return std::make_pair(cudf::empty_like(input),
+                          make_empty_column(data_type{type_to_id<size_type>()}));
+  }
+
+  auto const d_input = table_device_view::create(input, stream);
+
+  // A run starts at row 0 and at every row that differs from its predecessor. Nulls
+  // compare equal here so that runs of null rows compress like any other value.
+  rmm::device_uvector<size_type> run_starts(num_rows, stream);
+  auto const starts_end = [&] {
+    auto const row_begin = thrust::make_counting_iterator<size_type>(0);
+    if (cudf::has_nulls(input)) {
+      auto comp = row_equality_comparator<true>(*d_input, *d_input, true);
+      return thrust::copy_if(rmm::exec_policy(stream),
+                             row_begin,
+                             row_begin + num_rows,
+                             run_starts.begin(),
+                             run_start_fn<decltype(comp)>{comp});
+    }
+    auto comp = row_equality_comparator<false>(*d_input, *d_input, true);
+    return thrust::copy_if(rmm::exec_policy(stream),
+                           row_begin,
+                           row_begin + num_rows,
+                           run_starts.begin(),
+                           run_start_fn<decltype(comp)>{comp});
+  }();
+  auto const num_runs = static_cast<size_type>(thrust::distance(run_starts.begin(), starts_end));
+
+  auto run_lengths = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_runs, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_runs),
+                    run_lengths->mutable_view().begin<size_type>(),
+                    run_length_fn{run_starts.data(), num_runs, num_rows});
+
+  auto run_values = gather(input,
+                           run_starts.begin(),
+                           run_starts.begin() + num_runs,
+                           out_of_bounds_policy::DONT_CHECK,
+                           stream,
+                           mr);
+
+  return std::make_pair(std::move(run_values), std::move(run_lengths));
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> repeat(table_view const& input_table,
@@ -175,4 +250,11 @@ std::unique_ptr<table> repeat(table_view const& input_table,
   return detail::repeat(input_table, count, rmm::cuda_stream_default, mr);
 }
 
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> run_length_encode(
+  table_view const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::run_length_encode(input, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
@@ -16,12 +16,14 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/datetime_ops.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/filling.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
@@ -116,6 +118,52 @@ struct sequence_functor {
   }
 };
 
+// see tabulator above for why this is not a lambda
+template <typename T>
+struct month_tabulator {
+  cudf::timestamp_scalar_device_view<T> const n_init;
+  size_type const months;
+
+  T __device__ operator()(cudf::size_type i)
+  {
+    using duration_m = cuda::std::chrono::duration<int32_t, cuda::std::chrono::months::period>;
+    return datetime::detail::add_calendrical_months_with_scale_back(n_init.value(),
+                                                                    duration_m{months * i});
+  }
+};
+
+/**
+ * @brief Functor called by the `type_dispatcher` to generate a calendrical month sequence.
+ */
+struct calendrical_month_sequence_functor {
+  template <typename T, typename std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(size_type size,
+                                     scalar const& init,
+                                     size_type months,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    auto result = make_fixed_width_column(init.type(), size, mask_state::UNALLOCATED, stream, mr);
+    auto result_device_view = mutable_column_device_view::create(*result, stream);
+
+    auto n_init = get_scalar_device_view(
+      static_cast<cudf::scalar_type_t<T>&>(const_cast<scalar&>(init)));
+
+    thrust::tabulate(rmm::exec_policy(stream),
+                     result_device_view->begin<T>(),
+                     result_device_view->end<T>(),
+                     month_tabulator<T>{n_init, months});
+
+    return result;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not cudf::is_timestamp<T>(), std::unique_ptr<column>> operator()(Args&&...)
+  {
+    CUDF_FAIL("Unsupported calendrical month sequence scalar type");
+  }
+};
+
 }  // anonymous namespace
 
 std::unique_ptr<column> sequence(size_type size,
@@ -143,6 +191,19 @@ std::unique_ptr<column> sequence(
   return type_dispatcher(init.type(), sequence_functor{}, size, init, stream, mr);
 }
 
+std::unique_ptr<column> calendrical_month_sequence(size_type size,
+                                                   scalar const& init,
+                                                   size_type months,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(size >= 0, "size must be >= 0");
+  CUDF_EXPECTS(is_timestamp(init.type()), "init scalar type must be a timestamp");
+
+  return type_dispatcher(
+    init.type(), calendrical_month_sequence_functor{}, size, init, months, stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> sequence(size_type size,
@@ -160,4 +221,12 @@ std::unique_ptr<column> sequence(size_type size,
   return detail::sequence(size, init, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> calendrical_month_sequence(size_type size,
+                                                   scalar const& init,
+                                                   size_type months,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  return detail::calendrical_month_sequence(size, init, months, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
@@ -14,10 +14,13 @@
  * limitations under the License.
  */
 
+#include <cudf/binaryop.hpp>
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.hpp>
@@ -27,10 +30,12 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/string_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/unary.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <structs/utilities.hpp>
@@ -316,5 +321,399 @@ std::pair<std::unique_ptr<table>, std::unique_ptr<table>> groupby::shift(
                         std::make_unique<cudf::table>(std::move(results)));
 }
 
+namespace {
+
+/// Indicates if partial results of an aggregation merge with itself (or, for
+/// the COUNT kinds, with SUM)
+bool is_mergeable_aggregation(aggregation::Kind kind)
+{
+  return kind == aggregation::SUM or kind == aggregation::MIN or kind == aggregation::MAX or
+         kind == aggregation::COUNT_VALID or kind == aggregation::COUNT_ALL;
+}
+
+/// Makes the groupby aggregation used to fold chunk rows into partial results
+std::unique_ptr<groupby_aggregation> make_chunk_aggregation(aggregation::Kind kind)
+{
+  switch (kind) {
+    case aggregation::SUM: return cudf::make_sum_aggregation<groupby_aggregation>();
+    case aggregation::MIN: return cudf::make_min_aggregation<groupby_aggregation>();
+    case aggregation::MAX: return cudf::make_max_aggregation<groupby_aggregation>();
+    case aggregation::COUNT_VALID:
+      return cudf::make_count_aggregation<groupby_aggregation>(null_policy::EXCLUDE);
+    case aggregation::COUNT_ALL:
+      return cudf::make_count_aggregation<groupby_aggregation>(null_policy::INCLUDE);
+    default: CUDF_FAIL("Unsupported streaming aggregation");
+  }
+}
+
+/// Makes the groupby aggregation used to merge partial results; counts merge
+/// by summation, everything else with the original operation
+std::unique_ptr<groupby_aggregation> make_merge_aggregation(aggregation::Kind kind)
+{
+  if (kind == aggregation::COUNT_VALID or kind == aggregation::COUNT_ALL) {
+    return cudf::make_sum_aggregation<groupby_aggregation>();
+  }
+  return make_chunk_aggregation(kind);
+}
+
+/// Aggregates `values` by `keys` with one aggregation per column and returns
+/// the group keys and one result column per value column
+std::pair<std::unique_ptr<table>, std::vector<std::unique_ptr<column>>> aggregate_chunk(
+  table_view const& keys,
+  table_view const& values,
+  std::vector<std::unique_ptr<groupby_aggregation>>&& aggs,
+  null_policy null_handling,
+  rmm::mr::device_memory_resource* mr)
+{
+  std::vector<aggregation_request> requests(values.num_columns());
+  for (size_type i = 0; i < values.num_columns(); ++i) {
+    requests[i].values = values.column(i);
+    requests[i].aggregations.push_back(std::move(aggs[i]));
+  }
+
+  groupby gb_obj(keys, null_handling);
+  auto [group_keys, group_results] = gb_obj.aggregate(requests, mr);
+
+  std::vector<std::unique_ptr<column>> result_columns;
+  result_columns.reserve(group_results.size());
+  for (auto& result : group_results) {
+    result_columns.push_back(std::move(result.results.front()));
+  }
+  return std::make_pair(std::move(group_keys), std::move(result_columns));
+}
+
+}  // namespace
+
+streaming_groupby::streaming_groupby(std::vector<aggregation::Kind> const& aggs,
+                                     null_policy null_handling)
+  : _aggs(aggs), _null_handling(null_handling)
+{
+  CUDF_EXPECTS(std::all_of(_aggs.begin(), _aggs.end(), is_mergeable_aggregation),
+               "Streaming groupby only supports SUM, MIN, MAX, and COUNT aggregations");
+}
+
+streaming_groupby::~streaming_groupby() = default;
+
+void streaming_groupby::update(table_view const& keys,
+                               table_view const& values,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(static_cast<size_t>(values.num_columns()) == _aggs.size(),
+               "Mismatch between number of value columns and aggregations");
+  CUDF_EXPECTS(keys.num_rows() == values.num_rows(),
+               "Size mismatch between update keys and values");
+
+  // Aggregate the incoming chunk on its own first; the merge below then only
+  // touches per-group partial results, not the chunk rows again.
+  std::vector<std::unique_ptr<groupby_aggregation>> chunk_aggs;
+  std::transform(
+    _aggs.begin(), _aggs.end(), std::back_inserter(chunk_aggs), make_chunk_aggregation);
+  auto [chunk_keys, chunk_columns] =
+    aggregate_chunk(keys, values, std::move(chunk_aggs), _null_handling, mr);
+
+  // Promote counts to the type produced by their SUM-based merge so the state
+  // schema does not change from one update to the next
+  for (size_t i = 0; i < _aggs.size(); ++i) {
+    if (_aggs[i] == aggregation::COUNT_VALID or _aggs[i] == aggregation::COUNT_ALL) {
+      chunk_columns[i] = cudf::cast(
+        chunk_columns[i]->view(),
+        cudf::detail::target_type(chunk_columns[i]->type(), aggregation::SUM),
+        mr);
+    }
+  }
+  table chunk_state(std::move(chunk_columns));
+
+  if (not _keys) {
+    _keys   = std::move(chunk_keys);
+    _values = std::make_unique<table>(std::move(chunk_state));
+    return;
+  }
+
+  // Merge the chunk's partial results into the running state by aggregating
+  // the concatenation of both
+  auto merged_keys   = cudf::concatenate(std::vector<table_view>{_keys->view(), chunk_keys->view()});
+  auto merged_values = cudf::concatenate(std::vector<table_view>{_values->view(), chunk_state.view()});
+
+  std::vector<std::unique_ptr<groupby_aggregation>> merge_aggs;
+  std::transform(
+    _aggs.begin(), _aggs.end(), std::back_inserter(merge_aggs), make_merge_aggregation);
+  auto [new_keys, new_columns] = aggregate_chunk(
+    merged_keys->view(), merged_values->view(), std::move(merge_aggs), _null_handling, mr);
+
+  _keys   = std::move(new_keys);
+  _values = std::make_unique<table>(std::move(new_columns));
+}
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<table>> streaming_groupby::results(
+  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  if (not _keys) {
+    return std::make_pair(std::make_unique<table>(), std::make_unique<table>());
+  }
+  return std::make_pair(std::make_unique<table>(_keys->view(), rmm::cuda_stream_default, mr),
+                        std::make_unique<table>(_values->view(), rmm::cuda_stream_default, mr));
+}
+
+namespace {
+
+/// Indicates if an aggregation's partial state is the (COUNT_VALID, MEAN, M2)
+/// structs column consumed by MERGE_M2
+bool is_m2_family(aggregation::Kind kind)
+{
+  return kind == aggregation::MEAN or kind == aggregation::M2 or
+         kind == aggregation::VARIANCE or kind == aggregation::STD;
+}
+
+/// Marks group rows whose merged count reaches a minimum
+struct count_at_least {
+  int32_t const* counts;
+  int32_t minimum;
+  __device__ bool operator()(size_type i) const { return counts[i] >= minimum; }
+};
+
+/// Deep copies `values` with rows nulled out where the merged group count is
+/// below `minimum`
+std::unique_ptr<column> copy_with_count_validity(column_view const& values,
+                                                 column_view const& counts,
+                                                 int32_t minimum,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  auto result = std::make_unique<column>(values, rmm::cuda_stream_default, mr);
+  auto [null_mask, null_count] =
+    cudf::detail::valid_if(thrust::make_counting_iterator<size_type>(0),
+                           thrust::make_counting_iterator<size_type>(values.size()),
+                           count_at_least{counts.data<int32_t>(), minimum},
+                           rmm::cuda_stream_default,
+                           mr);
+  result->set_null_mask(std::move(null_mask), null_count);
+  return result;
+}
+
+}  // namespace
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<table>> partial_aggregate(
+  table_view const& keys,
+  table_view const& values,
+  std::vector<aggregation::Kind> const& aggs,
+  null_policy null_handling,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(static_cast<size_t>(values.num_columns()) == aggs.size(),
+               "Mismatch between number of value columns and aggregations");
+
+  std::vector<aggregation_request> requests(values.num_columns());
+  for (size_type i = 0; i < values.num_columns(); ++i) {
+    requests[i].values = values.column(i);
+    if (is_m2_family(aggs[i])) {
+      // The children of the MERGE_M2 input struct, in its expected order
+      requests[i].aggregations.push_back(cudf::make_count_aggregation<groupby_aggregation>());
+      requests[i].aggregations.push_back(cudf::make_mean_aggregation<groupby_aggregation>());
+      requests[i].aggregations.push_back(cudf::make_m2_aggregation<groupby_aggregation>());
+      continue;
+    }
+    switch (aggs[i]) {
+      case aggregation::SUM:
+        requests[i].aggregations.push_back(cudf::make_sum_aggregation<groupby_aggregation>());
+        break;
+      case aggregation::PRODUCT:
+        requests[i].aggregations.push_back(cudf::make_product_aggregation<groupby_aggregation>());
+        break;
+      case aggregation::MIN:
+        requests[i].aggregations.push_back(cudf::make_min_aggregation<groupby_aggregation>());
+        break;
+      case aggregation::MAX:
+        requests[i].aggregations.push_back(cudf::make_max_aggregation<groupby_aggregation>());
+        break;
+      case aggregation::SUM_OF_SQUARES:
+        requests[i].aggregations.push_back(
+          cudf::make_sum_of_squares_aggregation<groupby_aggregation>());
+        break;
+      case aggregation::COUNT_VALID:
+        requests[i].aggregations.push_back(
+          cudf::make_count_aggregation<groupby_aggregation>(null_policy::EXCLUDE));
+        break;
+      case aggregation::COUNT_ALL:
+        requests[i].aggregations.push_back(
+          cudf::make_count_aggregation<groupby_aggregation>(null_policy::INCLUDE));
+        break;
+      case aggregation::COLLECT_LIST:
+      case aggregation::COLLECT_SET:
+        // COLLECT_SET partials stay as plain lists; duplicates across workers
+        // can only be dropped when merging (see MERGE_SETS)
+        requests[i].aggregations.push_back(
+          cudf::make_collect_list_aggregation<groupby_aggregation>());
+        break;
+      default: CUDF_FAIL("Aggregation has no mergeable partial state");
+    }
+  }
+
+  groupby gb_obj(keys, null_handling);
+  auto [group_keys, results] = gb_obj.aggregate(requests, mr);
+
+  std::vector<std::unique_ptr<column>> partial_columns;
+  partial_columns.reserve(results.size());
+  for (size_t i = 0; i < results.size(); ++i) {
+    if (is_m2_family(aggs[i])) {
+      auto const num_rows = group_keys->num_rows();
+      partial_columns.push_back(make_structs_column(
+        num_rows, std::move(results[i].results), 0, {}, rmm::cuda_stream_default, mr));
+    } else if (aggs[i] == aggregation::COUNT_VALID or aggs[i] == aggregation::COUNT_ALL) {
+      // Promote counts to the type produced by their SUM-based merge so
+      // partial and merged states share a schema
+      partial_columns.push_back(
+        cudf::cast(results[i].results.front()->view(),
+                   cudf::detail::target_type(results[i].results.front()->type(), aggregation::SUM),
+                   mr));
+    } else {
+      partial_columns.push_back(std::move(results[i].results.front()));
+    }
+  }
+
+  return std::make_pair(std::move(group_keys),
+                        std::make_unique<table>(std::move(partial_columns)));
+}
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<table>> merge_aggregates(
+  table_view const& keys,
+  table_view const& partials,
+  std::vector<aggregation::Kind> const& aggs,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(static_cast<size_t>(partials.num_columns()) == aggs.size(),
+               "Mismatch between number of partial state columns and aggregations");
+
+  std::vector<aggregation_request> requests(partials.num_columns());
+  for (size_type i = 0; i < partials.num_columns(); ++i) {
+    requests[i].values = partials.column(i);
+    switch (aggs[i]) {
+      case aggregation::MEAN:
+      case aggregation::M2:
+      case aggregation::VARIANCE:
+      case aggregation::STD:
+        requests[i].aggregations.push_back(cudf::make_merge_m2_aggregation<groupby_aggregation>());
+        break;
+      case aggregation::SUM:
+      case aggregation::SUM_OF_SQUARES:
+      case aggregation::COUNT_VALID:
+      case aggregation::COUNT_ALL:
+        requests[i].aggregations.push_back(cudf::make_sum_aggregation<groupby_aggregation>());
+        break;
+      case aggregation::PRODUCT:
+        requests[i].aggregations.push_back(cudf::make_product_aggregation<groupby_aggregation>());
+        break;
+      case aggregation::MIN:
+        requests[i].aggregations.push_back(cudf::make_min_aggregation<groupby_aggregation>());
+        break;
+      case aggregation::MAX:
+        requests[i].aggregations.push_back(cudf::make_max_aggregation<groupby_aggregation>());
+        break;
+      case aggregation::COLLECT_LIST:
+        requests[i].aggregations.push_back(
+          cudf::make_merge_lists_aggregation<groupby_aggregation>());
+        break;
+      case aggregation::COLLECT_SET:
+        requests[i].aggregations.push_back(
+          cudf::make_merge_sets_aggregation<groupby_aggregation>());
+        break;
+      default: CUDF_FAIL("Aggregation has no mergeable partial state");
+    }
+  }
+
+  // Null keys were already filtered (or kept) by the partial stage; every
+  // partial group must survive the merge
+  groupby gb_obj(keys, null_policy::INCLUDE);
+  auto [group_keys, results] = gb_obj.aggregate(requests, mr);
+
+  std::vector<std::unique_ptr<column>> final_columns;
+  final_columns.reserve(results.size());
+  for (size_t i = 0; i < results.size(); ++i) {
+    auto merged = std::move(results[i].results.front());
+    if (not is_m2_family(aggs[i])) {
+      final_columns.push_back(std::move(merged));
+      continue;
+    }
+
+    // Finalize from the merged (COUNT_VALID, MEAN, M2) struct
+    auto const merged_view = merged->view();
+    auto const counts      = merged_view.child(0);
+    auto const means       = merged_view.child(1);
+    auto const m2s         = merged_view.child(2);
+    switch (aggs[i]) {
+      case aggregation::MEAN:
+        final_columns.push_back(copy_with_count_validity(means, counts, 1, mr));
+        break;
+      case aggregation::M2:
+        final_columns.push_back(copy_with_count_validity(m2s, counts, 1, mr));
+        break;
+      case aggregation::VARIANCE:
+      case aggregation::STD: {
+        auto const denominator = cudf::binary_operation(counts,
+                                                        numeric_scalar<int32_t>{1},
+                                                        binary_operator::SUB,
+                                                        data_type{type_id::INT32},
+                                                        rmm::cuda_stream_default,
+                                                        mr);
+        auto variance          = cudf::binary_operation(
+          m2s, denominator->view(), binary_operator::DIV, m2s.type(), rmm::cuda_stream_default, mr);
+        // A variance needs at least ddof + 1 = 2 observations
+        variance = copy_with_count_validity(variance->view(), counts, 2, mr);
+        final_columns.push_back(aggs[i] == aggregation::STD
+                                  ? cudf::unary_operation(variance->view(), unary_operator::SQRT, mr)
+                                  : std::move(variance));
+        break;
+      }
+      default: CUDF_FAIL("Aggregation has no mergeable partial state");
+    }
+  }
+
+  return std::make_pair(std::move(group_keys), std::make_unique<table>(std::move(final_columns)));
+}
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<table>> run_length_sum(
+  table_view const& keys,
+  table_view const& values,
+  column_view const& run_lengths,
+  null_policy null_handling,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(keys.num_rows() == run_lengths.size(),
+               "Mismatch between number of key rows and run lengths");
+  CUDF_EXPECTS(values.num_rows() == run_lengths.size(),
+               "Mismatch between number of value rows and run lengths");
+  CUDF_EXPECTS(cudf::is_index_type(run_lengths.type()),
+               "run_lengths must be of an integral index type");
+  CUDF_EXPECTS(not run_lengths.has_nulls(), "run_lengths cannot contain nulls");
+
+  // Weighting each run by its length and summing the weighted runs is equivalent to
+  // summing the fully expanded rows. The product is formed directly in the SUM result
+  // type so that the weighting itself cannot overflow the value type.
+  std::vector<std::unique_ptr<column>> weighted;
+  weighted.reserve(values.num_columns());
+  std::vector<aggregation_request> requests(values.num_columns());
+  for (size_type i = 0; i < values.num_columns(); ++i) {
+    auto const& col     = values.column(i);
+    auto const sum_type = cudf::detail::target_type(col.type(), aggregation::SUM);
+    weighted.push_back(cudf::binary_operation(
+      col, run_lengths, binary_operator::MUL, sum_type, rmm::cuda_stream_default, mr));
+    requests[i].values = weighted.back()->view();
+    requests[i].aggregations.push_back(cudf::make_sum_aggregation<groupby_aggregation>());
+  }
+
+  groupby gb_obj(keys, null_handling);
+  auto [group_keys, results] = gb_obj.aggregate(requests, mr);
+
+  std::vector<std::unique_ptr<column>> sums;
+  sums.reserve(results.size());
+  for (auto& result : results) {
+    sums.push_back(std::move(result.results.front()));
+  }
+  return std::make_pair(std::move(group_keys), std::make_unique<table>(std::move(sums)));
+}
+
 }  // namespace groupby
 }  // namespace cudf
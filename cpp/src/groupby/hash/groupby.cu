@@ -16,6 +16,7 @@
 
 #include <groupby/common/utils.hpp>
 #include <groupby/hash/groupby_kernels.cuh>
+#include <groupby/hash/hyperloglog_kernels.cuh>
 
 #include <cudf/aggregation.hpp>
 #include <cudf/column/column.hpp>
@@ -33,6 +34,7 @@
 #include <cudf/detail/unary.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/scalar/scalar.hpp>
@@ -45,7 +47,12 @@
 #include <hash/concurrent_unordered_map.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 
+#include <thrust/scatter.h>
+#include <thrust/uninitialized_fill.h>
+
+#include <functional>
 #include <memory>
 #include <unordered_set>
 #include <utility>
@@ -60,7 +67,7 @@ namespace {
  * @brief List of aggregation operations that can be computed with a hash-based
  * implementation.
  */
-constexpr std::array<aggregation::Kind, 12> hash_aggregations{aggregation::SUM,
+constexpr std::array<aggregation::Kind, 13> hash_aggregations{aggregation::SUM,
                                                               aggregation::PRODUCT,
                                                               aggregation::MIN,
                                                               aggregation::MAX,
@@ -71,7 +78,8 @@ constexpr std::array<aggregation::Kind, 12> hash_aggregations{aggregation::SUM,
                                                               aggregation::SUM_OF_SQUARES,
                                                               aggregation::MEAN,
                                                               aggregation::STD,
-                                                              aggregation::VARIANCE};
+                                                              aggregation::VARIANCE,
+                                                              aggregation::APPROX_NUNIQUE};
 
 // Could be hash: SUM, PRODUCT, MIN, MAX, COUNT_VALID, COUNT_ALL, ANY, ALL,
 // Compound: MEAN(SUM, COUNT_VALID), VARIANCE, STD(MEAN (SUM, COUNT_VALID), COUNT_VALID),
@@ -157,6 +165,14 @@ class groupby_simple_aggregations_collector final
 
     return aggs;
   }
+
+  std::vector<std::unique_ptr<aggregation>> visit(
+    data_type, cudf::detail::approx_nunique_aggregation const&) override
+  {
+    // Computed entirely by the finalizer from per-group sketches; nothing to
+    // do in the single pass kernel
+    return {};
+  }
 };
 
 template <typename Map>
@@ -296,26 +312,31 @@ class hash_compound_agg_finalizer final : public cudf::detail::aggregation_final
     auto count_agg = make_count_aggregation();
     this->visit(*sum_agg);
     this->visit(*count_agg);
-    column_view sum_result   = sparse_results->get_result(col_idx, *sum_agg);
-    column_view count_result = sparse_results->get_result(col_idx, *count_agg);
 
-    auto values_view = column_device_view::create(col);
-    auto sum_view    = column_device_view::create(sum_result);
-    auto count_view  = column_device_view::create(count_result);
-
-    auto var_result = make_fixed_width_column(
-      cudf::detail::target_type(result_type, agg.kind), col.size(), mask_state::ALL_NULL, stream);
-    auto var_result_view = mutable_column_device_view::create(var_result->mutable_view());
-    mutable_table_view var_table_view{{var_result->mutable_view()}};
-    cudf::detail::initialize_with_identity(var_table_view, {agg.kind}, stream);
-
-    thrust::for_each_n(
-      rmm::exec_policy(stream),
-      thrust::make_counting_iterator(0),
-      col.size(),
-      ::cudf::detail::var_hash_functor<Map>{
-        map, row_bitmask, *var_result_view, *values_view, *sum_view, *count_view, agg._ddof});
-    sparse_results->add_result(col_idx, agg, std::move(var_result));
+    // The fused multi-aggregation pass may have computed this sparse result
+    // already; only fall back to a dedicated pass when it has not.
+    if (not sparse_results->has_result(col_idx, agg)) {
+      column_view sum_result   = sparse_results->get_result(col_idx, *sum_agg);
+      column_view count_result = sparse_results->get_result(col_idx, *count_agg);
+
+      auto values_view = column_device_view::create(col);
+      auto sum_view    = column_device_view::create(sum_result);
+      auto count_view  = column_device_view::create(count_result);
+
+      auto var_result = make_fixed_width_column(
+        cudf::detail::target_type(result_type, agg.kind), col.size(), mask_state::ALL_NULL, stream);
+      auto var_result_view = mutable_column_device_view::create(var_result->mutable_view());
+      mutable_table_view var_table_view{{var_result->mutable_view()}};
+      cudf::detail::initialize_with_identity(var_table_view, {agg.kind}, stream);
+
+      thrust::for_each_n(
+        rmm::exec_policy(stream),
+        thrust::make_counting_iterator(0),
+        col.size(),
+        ::cudf::detail::var_hash_functor<Map>{
+          map, row_bitmask, *var_result_view, *values_view, *sum_view, *count_view, agg._ddof});
+      sparse_results->add_result(col_idx, agg, std::move(var_result));
+    }
     dense_results->add_result(col_idx, agg, to_dense_agg_result(agg));
   }
 
@@ -329,6 +350,50 @@ class hash_compound_agg_finalizer final : public cudf::detail::aggregation_final
     auto result = cudf::detail::unary_operation(variance, unary_operator::SQRT, stream, mr);
     dense_results->add_result(col_idx, agg, std::move(result));
   }
+
+  void visit(cudf::detail::approx_nunique_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col_idx, agg)) return;
+
+    auto const num_registers = size_type{1} << agg._precision;
+
+    // Dense group index for each sparse hash map value, so that sketch
+    // storage is proportional to the number of groups, not the input size
+    rmm::device_uvector<size_type> group_lookup(col.size(), stream);
+    thrust::scatter(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(map_size),
+                    gather_map.begin(),
+                    group_lookup.begin());
+
+    rmm::device_uvector<int8_t> registers(static_cast<size_t>(map_size) * num_registers, stream);
+    thrust::uninitialized_fill(
+      rmm::exec_policy(stream), registers.begin(), registers.end(), int8_t{0});
+
+    auto const d_source = column_device_view::create(col, stream);
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator(0),
+                       col.size(),
+                       hll_update_functor<Map>{map,
+                                               row_bitmask,
+                                               group_lookup.data(),
+                                               *d_source,
+                                               registers.data(),
+                                               agg._precision,
+                                               agg._null_handling == null_policy::EXCLUDE});
+
+    // The sketch estimate is already dense; no sparse gather is needed
+    auto result = make_numeric_column(
+      data_type(type_to_id<size_type>()), map_size, mask_state::UNALLOCATED, stream, mr);
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator(0),
+                       map_size,
+                       hll_estimate_functor{registers.data(),
+                                            agg._precision,
+                                            result->mutable_view().template data<size_type>()});
+
+    dense_results->add_result(col_idx, agg, std::move(result));
+  }
 };
 // flatten aggs to filter in single pass aggs
 std::tuple<table_view,
@@ -373,6 +438,80 @@ flatten_single_pass_aggs(host_span<aggregation_request const> requests)
     table_view(columns), std::move(agg_kinds), std::move(aggs), std::move(col_ids));
 }
 
+/**
+ * @brief Computes the sparse results of all requested VARIANCE/STD
+ * aggregations in a single fused pass over the input rows.
+ *
+ * Each variance result otherwise requires its own pass over the input in
+ * `hash_compound_agg_finalizer::visit(var_aggregation const&)`. Computing them
+ * together reads every row and probes `map` only once for all of them. The
+ * results are added to `sparse_results`, which makes the finalizer skip its
+ * per-aggregation pass.
+ */
+template <typename Map>
+void compute_fused_variance_results(host_span<aggregation_request const> requests,
+                                    cudf::detail::result_cache* sparse_results,
+                                    size_type num_rows,
+                                    Map const& map,
+                                    bitmask_type const* row_bitmask,
+                                    rmm::cuda_stream_view stream)
+{
+  auto sum_agg   = make_sum_aggregation();
+  auto count_agg = make_count_aggregation();
+
+  // Owners that must outlive the kernel launch below
+  std::vector<std::unique_ptr<aggregation>> var_aggs;
+  std::vector<std::unique_ptr<column_device_view, std::function<void(column_device_view*)>>>
+    source_views;
+  std::vector<
+    std::unique_ptr<mutable_column_device_view, std::function<void(mutable_column_device_view*)>>>
+    target_views;
+  std::vector<cudf::detail::var_target> h_targets;
+
+  for (size_t i = 0; i < requests.size(); i++) {
+    auto const& col = requests[i].values;
+    auto const result_type =
+      cudf::is_dictionary(col.type()) ? cudf::dictionary_column_view(col).keys().type() : col.type();
+    for (auto&& agg : requests[i].aggregations) {
+      if (agg->kind != aggregation::VARIANCE and agg->kind != aggregation::STD) continue;
+      auto const ddof = dynamic_cast<cudf::detail::std_var_aggregation const&>(*agg)._ddof;
+      // STD is finalized from the VARIANCE result with the same ddof
+      auto var_agg = make_variance_aggregation(ddof);
+      if (sparse_results->has_result(i, *var_agg)) continue;
+
+      column_view sum_result   = sparse_results->get_result(i, *sum_agg);
+      column_view count_result = sparse_results->get_result(i, *count_agg);
+
+      auto var_result = make_fixed_width_column(
+        cudf::detail::target_type(result_type, var_agg->kind), col.size(), mask_state::ALL_NULL, stream);
+      mutable_table_view var_table_view{{var_result->mutable_view()}};
+      cudf::detail::initialize_with_identity(var_table_view, {var_agg->kind}, stream);
+
+      target_views.push_back(mutable_column_device_view::create(var_result->mutable_view(), stream));
+      source_views.push_back(column_device_view::create(col, stream));
+      source_views.push_back(column_device_view::create(sum_result, stream));
+      source_views.push_back(column_device_view::create(count_result, stream));
+      auto const n = source_views.size();
+      h_targets.push_back(cudf::detail::var_target{*target_views.back(),
+                                                   *source_views[n - 3],
+                                                   *source_views[n - 2],
+                                                   *source_views[n - 1],
+                                                   ddof});
+      sparse_results->add_result(i, *var_agg, std::move(var_result));
+      var_aggs.push_back(std::move(var_agg));
+    }
+  }
+
+  if (h_targets.empty()) return;
+
+  auto const d_targets = cudf::detail::make_device_uvector_async(h_targets, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator(0),
+                     num_rows,
+                     ::cudf::detail::fused_var_hash_functor<Map>{
+                       map, row_bitmask, device_span<cudf::detail::var_target const>{d_targets}});
+}
+
 /**
  * @brief Gather sparse results into dense using `gather_map` and add to
  * `dense_cache`
@@ -397,6 +536,11 @@ void sparse_to_dense_results(table_view const& keys,
   bitmask_type const* row_bitmask_ptr =
     skip_key_rows_with_nulls ? static_cast<bitmask_type*>(row_bitmask.data()) : nullptr;
 
+  // Compute all requested variance results together before finalizing so that
+  // the input is only traversed once for them
+  compute_fused_variance_results(
+    requests, sparse_results, keys.num_rows(), map, row_bitmask_ptr, stream);
+
   for (size_t i = 0; i < requests.size(); i++) {
     auto const& agg_v = requests[i].aggregations;
     auto const& col   = requests[i].values;
@@ -485,6 +629,57 @@ auto create_sparse_results_table(table_view const& flattened_values,
   return sparse_table;
 }
 
+// Minimum number of input rows before the shared-memory pre-aggregation pass
+// is worth its partial-table setup cost.
+constexpr size_type shmem_prepass_min_rows = 1 << 14;
+
+/**
+ * @brief Indicates if the shared-memory pre-aggregation kernel can be used.
+ *
+ * The per-block partial results are merged into the global output with the
+ * same aggregation kinds, so only aggregations whose merge operation equals
+ * the aggregation itself are eligible. The partial table holds the target
+ * types of fixed-width columns only.
+ */
+bool can_use_shmem_prepass(table_view const& flattened_values,
+                           std::vector<aggregation::Kind> const& agg_kinds,
+                           size_type num_keys)
+{
+  if (num_keys < shmem_prepass_min_rows) { return false; }
+  if (not std::all_of(agg_kinds.begin(), agg_kinds.end(), [](aggregation::Kind k) {
+        return k == aggregation::SUM or k == aggregation::MIN or k == aggregation::MAX;
+      })) {
+    return false;
+  }
+  return std::all_of(flattened_values.begin(), flattened_values.end(), [](auto const& col) {
+    return cudf::is_fixed_width(col.type()) and not cudf::is_dictionary(col.type());
+  });
+}
+
+// make table that holds the per-block partial results of the shared-memory
+// pre-aggregation pass; all columns are nullable so untouched slots stay null
+// and are skipped during the merge
+auto create_partial_results_table(table_view const& flattened_values,
+                                  std::vector<aggregation::Kind> const& aggs,
+                                  size_type num_rows,
+                                  rmm::cuda_stream_view stream)
+{
+  std::vector<std::unique_ptr<column>> partial_columns;
+  std::transform(flattened_values.begin(),
+                 flattened_values.end(),
+                 aggs.begin(),
+                 std::back_inserter(partial_columns),
+                 [num_rows, stream](auto const& col, auto const& agg) {
+                   return make_fixed_width_column(
+                     cudf::detail::target_type(col.type(), agg), num_rows, mask_state::ALL_NULL, stream);
+                 });
+
+  table partial_table(std::move(partial_columns));
+  mutable_table_view table_view = partial_table.mutable_view();
+  cudf::detail::initialize_with_identity(table_view, aggs, stream);
+  return partial_table;
+}
+
 /**
  * @brief Computes all aggregations from `requests` that require a single pass
  * over the data and stores the results in `sparse_results`
@@ -512,18 +707,50 @@ void compute_single_pass_aggs(table_view const& keys,
   bool skip_key_rows_with_nulls = keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
 
   auto row_bitmask =
-    skip_key_rows_with_nulls ? cudf::detail::bitmask_and(keys, stream) : rmm::device_buffer{};
-  thrust::for_each_n(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator(0),
-    keys.num_rows(),
-    hash::compute_single_pass_aggs_fn<Map>{map,
-                                           keys.num_rows(),
-                                           *d_values,
-                                           *d_sparse_table,
-                                           d_aggs.data(),
-                                           static_cast<bitmask_type*>(row_bitmask.data()),
-                                           skip_key_rows_with_nulls});
+    skip_key_rows_with_nulls ? cudf::detail::bitmask_and(keys, stream).first : rmm::device_buffer{};
+
+  if (can_use_shmem_prepass(flattened_values, agg_kinds, keys.num_rows())) {
+    // Two-level mode: each block aggregates into a block-private partial table
+    // tracked by a shared-memory key table and merges once at the end, so
+    // low-cardinality keys do not hammer the same global output rows.
+    constexpr size_type block_size = 256;
+    auto const num_blocks          = std::min<size_type>(
+      1024, cudf::util::div_rounding_up_safe<size_type>(keys.num_rows(), block_size));
+    table partial_table = create_partial_results_table(
+      flattened_values, agg_kinds, num_blocks * hash::shmem_prepass_capacity, stream);
+    auto d_partial_table  = mutable_table_device_view::create(partial_table.mutable_view(), stream);
+    auto d_partial_source = table_device_view::create(partial_table.view(), stream);
+
+    auto d_keys = table_device_view::create(keys, stream);
+    row_hasher<default_hash, keys_have_nulls> hasher{*d_keys};
+    row_equality_comparator<keys_have_nulls> rows_equal{
+      *d_keys, *d_keys, include_null_keys == null_policy::INCLUDE};
+
+    hash::compute_single_pass_shmem_aggs<<<num_blocks, block_size, 0, stream.value()>>>(
+      map,
+      keys.num_rows(),
+      hasher,
+      rows_equal,
+      *d_values,
+      *d_partial_table,
+      *d_partial_source,
+      *d_sparse_table,
+      d_aggs.data(),
+      static_cast<bitmask_type*>(row_bitmask.data()),
+      skip_key_rows_with_nulls);
+  } else {
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator(0),
+      keys.num_rows(),
+      hash::compute_single_pass_aggs_fn<Map>{map,
+                                             keys.num_rows(),
+                                             *d_values,
+                                             *d_sparse_table,
+                                             d_aggs.data(),
+                                             static_cast<bitmask_type*>(row_bitmask.data()),
+                                             skip_key_rows_with_nulls});
+  }
   // Add results back to sparse_results cache
   auto sparse_result_cols = sparse_table.release();
   for (size_t i = 0; i < aggs.size(); i++) {
@@ -115,6 +115,99 @@ struct compute_single_pass_aggs_fn {
   }
 };
 
+/// Number of key slots in each block's shared-memory pre-aggregation table.
+constexpr size_type shmem_prepass_capacity = 1024;
+/// Probe length after which a row falls back to the global hash map directly.
+constexpr size_type shmem_prepass_max_probe = 128;
+/// Sentinel marking an unoccupied slot in the shared-memory key table.
+constexpr size_type shmem_prepass_empty_key = -1;
+
+/**
+ * @brief Compute single-pass aggregations with per-block pre-aggregation.
+ *
+ * Works like `compute_single_pass_aggs_fn`, but each block first aggregates
+ * into a block-private region of `partial_values` tracked by a small
+ * shared-memory key table, and only merges those partial results into `map`
+ * and `output_values` once at the end. For low-cardinality keys this turns
+ * the per-row atomic traffic on the globally shared output rows into
+ * block-local updates, with a single merge per (block, group) pair.
+ *
+ * Block `b` owns rows `[b * shmem_prepass_capacity, (b + 1) *
+ * shmem_prepass_capacity)` of `partial_values`, which must be initialized
+ * with the aggregation identities and an all-null mask so that untouched
+ * slots are skipped during the merge. The merge aggregates the partial rows
+ * with the same aggregation kinds, so this kernel only supports aggregations
+ * whose partial results merge with the same operation (e.g. SUM, MIN, MAX).
+ * Rows whose key probes more than `shmem_prepass_max_probe` slots bypass the
+ * shared table and update the global output directly. `partial_source` must
+ * view the same table as `partial_values`; it is read during the merge.
+ *
+ * @tparam Map The type of the hash map
+ * @tparam RowHasher The type of the row hasher for the keys table
+ * @tparam RowEquality The type of the row equality comparator for the keys
+ */
+template <typename Map, typename RowHasher, typename RowEquality>
+__global__ void compute_single_pass_shmem_aggs(Map map,
+                                               size_type num_keys,
+                                               RowHasher row_hash,
+                                               RowEquality rows_equal,
+                                               table_device_view input_values,
+                                               mutable_table_device_view partial_values,
+                                               table_device_view partial_source,
+                                               mutable_table_device_view output_values,
+                                               aggregation::Kind const* __restrict__ aggs,
+                                               bitmask_type const* __restrict__ row_bitmask,
+                                               bool skip_rows_with_nulls)
+{
+  __shared__ size_type block_keys[shmem_prepass_capacity];
+
+  for (size_type slot = threadIdx.x; slot < shmem_prepass_capacity; slot += blockDim.x) {
+    block_keys[slot] = shmem_prepass_empty_key;
+  }
+  __syncthreads();
+
+  auto const partial_base = static_cast<size_type>(blockIdx.x) * shmem_prepass_capacity;
+
+  for (size_type i = threadIdx.x + blockIdx.x * blockDim.x; i < num_keys;
+       i += blockDim.x * gridDim.x) {
+    if (skip_rows_with_nulls and not cudf::bit_is_set(row_bitmask, i)) { continue; }
+
+    size_type slot        = row_hash(i) % shmem_prepass_capacity;
+    size_type local_slot  = shmem_prepass_empty_key;
+    size_type probe_count = 0;
+    while (probe_count < shmem_prepass_max_probe) {
+      auto const existing = atomicCAS(&block_keys[slot], shmem_prepass_empty_key, i);
+      if (existing == shmem_prepass_empty_key or existing == i or rows_equal(existing, i)) {
+        local_slot = slot;
+        break;
+      }
+      slot = (slot + 1) % shmem_prepass_capacity;
+      ++probe_count;
+    }
+
+    if (local_slot != shmem_prepass_empty_key) {
+      cudf::detail::aggregate_row<true, true>(
+        partial_values, partial_base + local_slot, input_values, i, aggs);
+    } else {
+      // The shared table is (nearly) full; aggregate into the global output
+      // directly, exactly as the single-level path does.
+      auto result = map.insert(thrust::make_pair(i, i));
+      cudf::detail::aggregate_row<true, true>(
+        output_values, result.first->second, input_values, i, aggs);
+    }
+  }
+  __syncthreads();
+
+  // Merge this block's partial results into the global map and output
+  for (size_type slot = threadIdx.x; slot < shmem_prepass_capacity; slot += blockDim.x) {
+    auto const key = block_keys[slot];
+    if (key == shmem_prepass_empty_key) { continue; }
+    auto result = map.insert(thrust::make_pair(key, key));
+    cudf::detail::aggregate_row<true, true>(
+      output_values, result.first->second, partial_source, partial_base + slot, aggs);
+  }
+}
+
 }  // namespace hash
 }  // namespace detail
 }  // namespace groupby
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/types.hpp>
+
+#include <cmath>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace hash {
+
+/**
+ * @brief Updates per-group HyperLogLog sketches with one input row.
+ *
+ * Each group owns `1 << precision` one-byte registers in `registers`, indexed
+ * by the dense group index obtained through `group_lookup` (which maps sparse
+ * hash map values to `[0, num_groups)`). The top `precision` bits of the
+ * element hash select a register; the register keeps the maximum rank (number
+ * of leading zero bits of the remaining hash, plus one) seen for it.
+ */
+template <typename Map>
+struct hll_update_functor {
+  Map const map;
+  bitmask_type const* __restrict__ row_bitmask;
+  size_type const* __restrict__ group_lookup;
+  column_device_view source;
+  int8_t* registers;
+  size_type precision;
+  bool skip_nulls;
+
+  __device__ void operator()(size_type row_index)
+  {
+    if (row_bitmask != nullptr and not cudf::bit_is_set(row_bitmask, row_index)) return;
+
+    auto col          = source;
+    auto source_index = row_index;
+    if (source.type().id() == type_id::DICTIONARY32) {
+      if (source.is_null(row_index)) {
+        if (skip_nulls) return;
+      } else {
+        col          = source.child(cudf::dictionary_column_view::keys_column_index);
+        source_index = static_cast<size_type>(source.element<dictionary32>(row_index));
+      }
+    } else if (skip_nulls and source.is_null(row_index)) {
+      return;
+    }
+
+    auto const group =
+      group_lookup[map.find(row_index)->second];  // dense index of this row's group
+
+    // Nulls (only reachable with INCLUDE) hash to a fixed value in
+    // element_hasher and therefore count as one distinct element
+    auto const hash = cudf::type_dispatcher(
+      col.type(), cudf::element_hasher<cudf::detail::default_hash, true>{}, col, source_index);
+
+    auto const num_registers = size_type{1} << precision;
+    auto const bucket        = static_cast<size_type>(hash >> (32 - precision));
+    // Rank of the remaining bits; all zero means every bit beyond the bucket
+    // was zero, giving the maximum possible rank
+    auto const rest = hash << precision;
+    auto const rank =
+      static_cast<int8_t>(rest == 0 ? 32 - precision + 1 : __clz(static_cast<int>(rest)) + 1);
+
+    cudf::genericAtomicOperation(
+      &registers[group * num_registers + bucket], rank, DeviceMax{});
+  }
+};
+
+/**
+ * @brief Converts one group's HyperLogLog registers into a cardinality
+ * estimate.
+ *
+ * Applies the standard bias correction and the linear-counting small-range
+ * correction from the HyperLogLog paper.
+ */
+struct hll_estimate_functor {
+  int8_t const* __restrict__ registers;
+  size_type precision;
+  size_type* estimates;
+
+  __device__ void operator()(size_type group)
+  {
+    auto const num_registers = size_type{1} << precision;
+    auto const* group_registers = registers + group * num_registers;
+
+    double sum   = 0;
+    size_type zeros = 0;
+    for (size_type r = 0; r < num_registers; ++r) {
+      sum += exp2(static_cast<double>(-group_registers[r]));
+      if (group_registers[r] == 0) { ++zeros; }
+    }
+
+    double const m        = static_cast<double>(num_registers);
+    double const alpha    = 0.7213 / (1.0 + 1.079 / m);
+    double estimate       = alpha * m * m / sum;
+    if (estimate <= 2.5 * m and zeros > 0) { estimate = m * log(m / zeros); }
+    estimates[group] = static_cast<size_type>(estimate + 0.5);
+  }
+};
+
+}  // namespace hash
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
@@ -23,6 +23,7 @@
 #include <cudf/detail/utilities/assert.cuh>
 #include <cudf/detail/utilities/device_atomics.cuh>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/span.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 namespace cudf {
@@ -108,5 +109,96 @@ struct var_hash_functor {
   }
 };
 
+/**
+ * @brief One variance aggregation processed by `fused_var_hash_functor`.
+ */
+struct var_target {
+  mutable_column_device_view target;
+  column_device_view source;
+  column_device_view sum;
+  column_device_view count;
+  size_type ddof;
+};
+
+/**
+ * @brief Computes several variance aggregations in a single pass.
+ *
+ * Equivalent to applying `var_hash_functor` once per entry of `targets`, but
+ * each input row is read and looked up in `map` only once for all of them.
+ */
+template <typename Map, bool target_has_nulls = true, bool source_has_nulls = true>
+struct fused_var_hash_functor {
+  Map const map;
+  bitmask_type const* __restrict__ row_bitmask;
+  device_span<var_target const> targets;
+
+  fused_var_hash_functor(Map const map,
+                         bitmask_type const* row_bitmask,
+                         device_span<var_target const> targets)
+    : map(map), row_bitmask(row_bitmask), targets(targets)
+  {
+  }
+
+  template <typename Source>
+  constexpr static bool is_supported()
+  {
+    return is_numeric<Source>() && !is_fixed_point<Source>();
+  }
+
+  template <typename Source>
+  __device__ std::enable_if_t<!is_supported<Source>()> operator()(var_target const& t,
+                                                                  column_device_view const& source,
+                                                                  size_type source_index,
+                                                                  size_type target_index) noexcept
+  {
+    cudf_assert(false and "Invalid source type for std, var aggregation combination.");
+  }
+
+  template <typename Source>
+  __device__ std::enable_if_t<is_supported<Source>()> operator()(var_target const& t,
+                                                                 column_device_view const& source,
+                                                                 size_type source_index,
+                                                                 size_type target_index) noexcept
+  {
+    using Target    = target_type_t<Source, aggregation::VARIANCE>;
+    using SumType   = target_type_t<Source, aggregation::SUM>;
+    using CountType = target_type_t<Source, aggregation::COUNT_VALID>;
+
+    if (source_has_nulls and source.is_null(source_index)) return;
+    CountType group_size = t.count.element<CountType>(target_index);
+    if (group_size == 0 or group_size - t.ddof <= 0) return;
+
+    auto x        = static_cast<Target>(source.element<Source>(source_index));
+    auto mean     = static_cast<Target>(t.sum.element<SumType>(target_index)) / group_size;
+    Target result = (x - mean) * (x - mean) / (group_size - t.ddof);
+    auto target   = t.target;
+    atomicAdd(&target.element<Target>(target_index), result);
+    // STD sqrt is applied in finalize()
+
+    if (target_has_nulls and target.is_null(target_index)) { target.set_valid(target_index); }
+  }
+
+  __device__ inline void operator()(size_type row_index)
+  {
+    if (row_bitmask == nullptr or cudf::bit_is_set(row_bitmask, row_index)) {
+      auto result       = map.find(row_index);
+      auto target_index = result->second;
+
+      for (auto const& t : targets) {
+        auto col          = t.source;
+        auto source_type  = t.source.type();
+        auto source_index = row_index;
+        if (source_type.id() == type_id::DICTIONARY32) {
+          col          = t.source.child(cudf::dictionary_column_view::keys_column_index);
+          source_type  = col.type();
+          source_index = static_cast<size_type>(t.source.element<dictionary32>(source_index));
+        }
+
+        type_dispatcher(source_type, *this, t, col, source_index, target_index);
+      }
+    }
+  }
+};
+
 }  // namespace detail
 }  // namespace cudf
@@ -33,9 +33,11 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -59,6 +61,49 @@ struct aggregate_result_functor final : store_result_functor {
   {
     CUDF_FAIL("Unsupported aggregation.");
   }
+
+  /**
+   * @brief Computes all fusable simple reductions of one request in a single
+   * pass over the group labels.
+   *
+   * SUM, PRODUCT, MIN and MAX of numeric values are computed together by
+   * `group_fused_reductions` and stored in the cache, so the per-aggregation
+   * dispatch below finds them already present instead of launching one
+   * segmented reduction each.
+   */
+  void fuse_simple_reductions(std::vector<std::unique_ptr<groupby_aggregation>> const& aggs)
+  {
+    if (cudf::is_dictionary(values.type()) or not cudf::is_numeric(values.type()) or
+        cudf::is_fixed_point(values.type())) {
+      return;
+    }
+
+    std::vector<aggregation const*> fusable;
+    std::vector<aggregation::Kind> kinds;
+    for (auto const& agg : aggs) {
+      auto const kind = agg->kind;
+      if ((kind == aggregation::SUM or kind == aggregation::PRODUCT or
+           kind == aggregation::MIN or kind == aggregation::MAX) and
+          not cache.has_result(col_idx, *agg) and
+          std::none_of(
+            kinds.begin(), kinds.end(), [kind](auto const k) { return k == kind; })) {
+        fusable.push_back(agg.get());
+        kinds.push_back(kind);
+      }
+    }
+    // A single reduction is already a single pass
+    if (kinds.size() < 2) { return; }
+
+    auto results = detail::group_fused_reductions(get_grouped_values(),
+                                                  helper.num_groups(stream),
+                                                  helper.group_labels(stream),
+                                                  kinds,
+                                                  stream,
+                                                  mr);
+    for (size_t i = 0; i < kinds.size(); ++i) {
+      cache.add_result(col_idx, *fusable[i], std::move(results[i]));
+    }
+  }
 };
 
 template <>
@@ -355,6 +400,83 @@ void aggregate_result_functor::operator()<aggregation::NUNIQUE>(aggregation cons
   cache.add_result(col_idx, agg, std::move(result));
 };
 
+template <>
+void aggregate_result_functor::operator()<aggregation::APPROX_NUNIQUE>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto& approx_agg = dynamic_cast<cudf::detail::approx_nunique_aggregation const&>(agg);
+
+  // The groups are already formed here, so the exact count is no more
+  // expensive than a sketch estimate would be. The sketches only pay off in
+  // the hash implementation, which computes them without sorting.
+  auto result = detail::group_nunique(get_sorted_values(),
+                                      helper.group_labels(stream),
+                                      helper.num_groups(stream),
+                                      helper.group_offsets(stream),
+                                      approx_agg._null_handling,
+                                      stream,
+                                      mr);
+  cache.add_result(col_idx, agg, std::move(result));
+};
+
+template <>
+void aggregate_result_functor::operator()<aggregation::TOP_K>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto& top_k_agg = dynamic_cast<cudf::detail::top_k_aggregation const&>(agg);
+
+  // The per-group heap selection only needs values gathered by group, not
+  // sorted within groups
+  auto result = detail::group_top_k(get_grouped_values(),
+                                    helper.group_offsets(stream),
+                                    helper.num_groups(stream),
+                                    top_k_agg._k,
+                                    top_k_agg._order,
+                                    stream,
+                                    mr);
+  cache.add_result(col_idx, agg, std::move(result));
+};
+
+template <>
+void aggregate_result_functor::operator()<aggregation::TDIGEST>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto count_agg = make_count_aggregation();
+  operator()<aggregation::COUNT_VALID>(*count_agg);
+  column_view group_sizes = cache.get_result(col_idx, *count_agg);
+  auto& tdigest_agg       = dynamic_cast<cudf::detail::tdigest_aggregation const&>(agg);
+
+  auto result = detail::group_tdigest(get_sorted_values(),
+                                      group_sizes,
+                                      helper.group_offsets(stream),
+                                      helper.num_groups(stream),
+                                      tdigest_agg._max_centroids,
+                                      stream,
+                                      mr);
+  cache.add_result(col_idx, agg, std::move(result));
+};
+
+template <>
+void aggregate_result_functor::operator()<aggregation::MERGE_TDIGEST>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto& merge_agg = dynamic_cast<cudf::detail::merge_tdigest_aggregation const&>(agg);
+
+  // Pooled centroids are re-sorted by mean inside the merge, so the digest
+  // rows only need to be gathered by group
+  auto result = detail::group_merge_tdigest(get_grouped_values(),
+                                            helper.group_offsets(stream),
+                                            helper.num_groups(stream),
+                                            merge_agg._max_centroids,
+                                            stream,
+                                            mr);
+  cache.add_result(col_idx, agg, std::move(result));
+};
+
 template <>
 void aggregate_result_functor::operator()<aggregation::NTH_ELEMENT>(aggregation const& agg)
 {
@@ -525,7 +647,28 @@ void aggregate_result_functor::operator()<aggregation::MERGE_M2>(aggregation con
       get_grouped_values(), helper.group_offsets(stream), helper.num_groups(stream), stream, mr));
 };
 
-}  // namespace detail
+namespace {
+
+/**
+ * @brief Indicates if two column views refer to the same physical column.
+ *
+ * Compares the views shallowly (data pointers, type, size, offset, and null
+ * mask, recursing into children) rather than comparing elements.
+ */
+bool is_same_column(column_view const& lhs, column_view const& rhs)
+{
+  if (lhs.type() != rhs.type() or lhs.size() != rhs.size() or lhs.head() != rhs.head() or
+      lhs.offset() != rhs.offset() or lhs.null_mask() != rhs.null_mask() or
+      lhs.num_children() != rhs.num_children()) {
+    return false;
+  }
+  for (size_type i = 0; i < lhs.num_children(); ++i) {
+    if (not is_same_column(lhs.child(i), rhs.child(i))) { return false; }
+  }
+  return true;
+}
+
+}  // namespace
 
 // Sort-based groupby
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::sort_aggregate(
@@ -538,13 +681,43 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::sort
   // sum and count. std depends on mean and count
   cudf::detail::result_cache cache(requests.size());
 
+  // Requests that view the same values column share one cache slot and one
+  // functor, so their memoized grouped/sorted values and any aggregations they
+  // have in common are computed only once.
+  std::vector<size_t> cache_idx(requests.size());
+  for (size_t i = 0; i < requests.size(); i++) {
+    cache_idx[i] = i;
+    for (size_t j = 0; j < i; j++) {
+      if (is_same_column(requests[j].values, requests[i].values)) {
+        cache_idx[i] = cache_idx[j];
+        break;
+      }
+    }
+  }
+
+  std::unordered_map<size_t, detail::aggregate_result_functor> functors;
   for (size_t i = 0; i < requests.size(); i++) {
-    auto store_functor =
-      detail::aggregate_result_functor(i, requests[i].values, helper(), cache, stream, mr);
+    auto const slot = cache_idx[i];
+    auto it         = functors.find(slot);
+    if (it == functors.end()) {
+      it = functors
+             .emplace(slot,
+                      detail::aggregate_result_functor(
+                        slot, requests[i].values, helper(), cache, stream, mr))
+             .first;
+    }
+    // Batch the simple reductions of this request into one pass; the
+    // dispatch below then finds their results already cached
+    it->second.fuse_simple_reductions(requests[i].aggregations);
     for (size_t j = 0; j < requests[i].aggregations.size(); j++) {
-      // TODO (dm): single pass compute all supported reductions
-      cudf::detail::aggregation_dispatcher(
-        requests[i].aggregations[j]->kind, store_functor, *requests[i].aggregations[j]);
+      auto const& agg = *requests[i].aggregations[j];
+      cudf::detail::aggregation_dispatcher(agg.kind, it->second, agg);
+      if (slot != i) {
+        // Deep-copy the shared result into this request's slot so
+        // extract_results can release one column per request.
+        cache.add_result(
+          i, agg, std::make_unique<column>(cache.get_result(slot, agg), stream, mr));
+      }
     }
   }
 
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <groupby/sort/group_reductions.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+
+/**
+ * @brief Applies every requested reduction of one input row to its group's
+ * output row.
+ *
+ * Column `i` of `source` views the input values and column `i` of `targets`
+ * the result column of `aggs[i]`, so a single `aggregate_row` call updates
+ * all reductions from one read of the row.
+ */
+struct fused_reduction_fn {
+  mutable_table_device_view targets;
+  table_device_view source;
+  size_type const* __restrict__ group_labels;
+  aggregation::Kind const* __restrict__ aggs;
+
+  __device__ void operator()(size_type i)
+  {
+    cudf::detail::aggregate_row<true, true>(targets, group_labels[i], source, i, aggs);
+  }
+};
+
+}  // namespace
+
+std::vector<std::unique_ptr<column>> group_fused_reductions(
+  column_view const& values,
+  size_type num_groups,
+  cudf::device_span<size_type const> group_labels,
+  std::vector<aggregation::Kind> const& aggs,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  // Result validity mirrors the dedicated reductions: a group's result is
+  // null until a valid value aggregates into it
+  auto const mask = values.has_nulls() ? mask_state::ALL_NULL : mask_state::UNALLOCATED;
+
+  std::vector<std::unique_ptr<column>> results;
+  std::vector<mutable_column_view> target_views;
+  results.reserve(aggs.size());
+  for (auto const kind : aggs) {
+    results.push_back(make_fixed_width_column(
+      cudf::detail::target_type(values.type(), kind), num_groups, mask, stream, mr));
+    target_views.push_back(results.back()->mutable_view());
+  }
+  mutable_table_view target_table(target_views);
+  cudf::detail::initialize_with_identity(target_table, aggs, stream);
+
+  if (values.is_empty()) { return results; }
+
+  auto const d_targets = mutable_table_device_view::create(target_table, stream);
+  auto const d_source  = table_device_view::create(
+    table_view(std::vector<column_view>(aggs.size(), values)), stream);
+  auto const d_aggs = cudf::detail::make_device_uvector_async(aggs, stream);
+
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     static_cast<size_type>(group_labels.size()),
+                     fused_reduction_fn{*d_targets, *d_source, group_labels.data(), d_aggs.data()});
+
+  for (auto& result : results) {
+    if (result->nullable()) { result->set_null_count(cudf::UNKNOWN_NULL_COUNT); }
+  }
+  return results;
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
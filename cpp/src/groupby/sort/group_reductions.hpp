@@ -23,6 +23,7 @@
 #include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
+#include <vector>
 
 /** @internal @file Internal API in this file are mostly segmented reduction operations on column,
  * which are used in sort-based groupby aggregations.
@@ -54,6 +55,34 @@ std::unique_ptr<column> group_sum(column_view const& values,
                                   rmm::cuda_stream_view stream,
                                   rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Internal API to calculate several groupwise simple reductions in one
+ * pass
+ *
+ * Computes one result column per entry of `aggs` while reading `values` and
+ * `group_labels` only once, instead of launching an independent segmented
+ * reduction per aggregation.
+ *
+ * Only SUM, PRODUCT, MIN and MAX over non-dictionary numeric values are
+ * supported; the caller is responsible for falling back to the dedicated
+ * per-aggregation reductions otherwise.
+ *
+ * @param values Grouped values to reduce
+ * @param num_groups Number of groups
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param aggs The reduction to compute for each result column
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return One result column per requested aggregation, in `aggs` order
+ */
+std::vector<std::unique_ptr<column>> group_fused_reductions(
+  column_view const& values,
+  size_type num_groups,
+  cudf::device_span<size_type const> group_labels,
+  std::vector<aggregation::Kind> const& aggs,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
 /**
  * @brief Internal API to calculate groupwise product
  *
@@ -393,6 +422,87 @@ std::unique_ptr<column> group_collect(column_view const& values,
                                       rmm::cuda_stream_view stream,
                                       rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Internal API to collect the k greatest (or least) values of each group.
+ *
+ * Each input element is inspected exactly once; per-group heaps of size @p k
+ * perform the selection, so the grouped values need not be sorted. Null
+ * elements are excluded. Each output list is ordered best first and holds
+ * `min(k, non-null group size)` elements.
+ *
+ * @code{.pseudo}
+ * values        = [2, 1, 4, -1, -2, <NA>, 4, <NA>]
+ * group_offsets = [0,        3,        5,       7, 8]
+ * num_groups    = 4
+ *
+ * group_top_k(k=2, order::DESCENDING) = [[4, 2], [-1, -2], [4], []]
+ * group_top_k(k=2, order::ASCENDING)  = [[1, 2], [-2, -1], [4], []]
+ * @endcode
+ *
+ * @param values Grouped values to select from. Must be of a fixed-width, relationally
+ *        comparable type.
+ * @param group_offsets Offsets of groups' starting points within @p values.
+ * @param num_groups Number of groups.
+ * @param k Number of elements to keep per group. Must be in `[1, 32]`.
+ * @param ord DESCENDING keeps the greatest elements, ASCENDING the least.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ */
+std::unique_ptr<column> group_top_k(column_view const& values,
+                                    cudf::device_span<size_type const> group_offsets,
+                                    size_type num_groups,
+                                    size_type k,
+                                    order ord,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Internal API to build a t-digest sketch of each group's values.
+ *
+ * Centroid boundaries follow the t-digest k1 scale function, which bounds the
+ * number of centroids by @p max_centroids while concentrating resolution at
+ * the distribution tails. Null elements are excluded; an empty group produces
+ * empty centroid lists.
+ *
+ * The result is a structs column with one row per group and two equal-length
+ * `LIST<double>` children holding centroid means and weights, ordered by
+ * ascending mean. Digests built with the same @p max_centroids can be merged
+ * with `group_merge_tdigest`.
+ *
+ * @param values Grouped and sorted (within group) values to sketch.
+ * @param group_sizes Number of valid elements per group.
+ * @param group_offsets Offsets of groups' starting points within @p values.
+ * @param num_groups Number of groups.
+ * @param max_centroids Upper bound on the number of centroids per digest.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ */
+std::unique_ptr<column> group_tdigest(column_view const& values,
+                                      column_view const& group_sizes,
+                                      cudf::device_span<size_type const> group_offsets,
+                                      size_type num_groups,
+                                      size_type max_centroids,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Internal API to merge grouped t-digest sketches into one digest per group.
+ *
+ * @param values Grouped digest rows in the `STRUCT<LIST<double>, LIST<double>>`
+ *        layout produced by `group_tdigest`.
+ * @param group_offsets Offsets of groups' starting points within @p values.
+ * @param num_groups Number of groups.
+ * @param max_centroids Upper bound on the number of centroids in each merged digest.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ */
+std::unique_ptr<column> group_merge_tdigest(column_view const& values,
+                                            cudf::device_span<size_type const> group_offsets,
+                                            size_type num_groups,
+                                            size_type max_centroids,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr);
+
 /**
  * @brief Internal API to merge grouped lists into one list.
  *
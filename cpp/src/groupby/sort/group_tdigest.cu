@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <groupby/sort/group_reductions.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/transform.h>
+
+#include <memory>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+
+/// One thread per group; no shared memory so the block can be full-sized.
+constexpr size_type tdigest_block_size = 256;
+
+constexpr double pi = 3.141592653589793238462643383279502884;
+
+/**
+ * @brief The t-digest k1 scale function, shifted so `k(0) == 0`.
+ *
+ * With `delta = 2 * max_centroids` the range of `k` over `q` in `[0, 1]` is
+ * exactly `max_centroids`, so closing a centroid whenever `k` advances by one
+ * bounds the centroid count while concentrating resolution at the tails.
+ */
+__device__ inline double scale_k(double q, double delta)
+{
+  q = q < 0.0 ? 0.0 : (q > 1.0 ? 1.0 : q);
+  return delta * (asin(2.0 * q - 1.0) / pi + 0.5) / 2.0;
+}
+
+/**
+ * @brief Builds one t-digest per group from weighted values sorted by value.
+ *
+ * Each thread owns one group and scans its elements once, accumulating a
+ * running centroid and closing it when the k1 scale function advances past
+ * one unit. The same kernel serves both building from raw values (unit
+ * weights) and merging digests (centroid means with their weights); only the
+ * iterators differ. Results are written at stride `max_centroids` with the
+ * per-group centroid count in `counts`.
+ */
+template <typename ValueIter, typename WeightIter, typename SizeIter>
+__global__ void build_tdigest_kernel(ValueIter values,
+                                     WeightIter weights,
+                                     size_type const* group_begin,
+                                     SizeIter group_sizes,
+                                     size_type num_groups,
+                                     size_type max_centroids,
+                                     double* centroid_means,
+                                     double* centroid_weights,
+                                     size_type* counts)
+{
+  auto const stride = static_cast<size_type>(blockDim.x * gridDim.x);
+  for (auto group = static_cast<size_type>(blockIdx.x * blockDim.x + threadIdx.x);
+       group < num_groups;
+       group += stride) {
+    auto const begin = group_begin[group];
+    auto const size  = group_sizes[group];
+    auto const out   = static_cast<std::size_t>(group) * max_centroids;
+
+    size_type count = 0;
+    if (size > 0) {
+      double total_weight = 0;
+      for (auto i = begin; i < begin + size; ++i) {
+        total_weight += static_cast<double>(weights[i]);
+      }
+
+      auto const delta  = 2.0 * max_centroids;
+      double cumulative = 0;  // weight of all closed centroids
+      double c_sum      = 0;  // weighted value sum of the open centroid
+      double c_weight   = 0;  // weight of the open centroid
+      double k_begin    = scale_k(0.0, delta);
+      for (auto i = begin; i < begin + size; ++i) {
+        auto const w      = static_cast<double>(weights[i]);
+        auto const q_next = (cumulative + c_weight + w) / total_weight;
+        // Close the open centroid before it would span more than one k unit;
+        // the last permitted centroid absorbs everything that remains.
+        if (c_weight > 0 and count + 1 < max_centroids and
+            scale_k(q_next, delta) - k_begin > 1.0) {
+          centroid_means[out + count]   = c_sum / c_weight;
+          centroid_weights[out + count] = c_weight;
+          ++count;
+          cumulative += c_weight;
+          c_sum = c_weight = 0;
+          k_begin          = scale_k(cumulative / total_weight, delta);
+        }
+        c_sum += static_cast<double>(values[i]) * w;
+        c_weight += w;
+      }
+      centroid_means[out + count]   = c_sum / c_weight;
+      centroid_weights[out + count] = c_weight;
+      ++count;
+    }
+    counts[group] = count;
+  }
+}
+
+/// Reads the flattened centroid position where a group's digest rows begin.
+struct digest_segment_begin_fn {
+  offset_type const* d_list_offsets;
+  size_type const* d_group_offsets;
+  __device__ size_type operator()(size_type group) const
+  {
+    return d_list_offsets[d_group_offsets[group]] - d_list_offsets[0];
+  }
+};
+
+struct segment_size_fn {
+  size_type const* d_offsets;
+  __device__ size_type operator()(size_type group) const
+  {
+    return d_offsets[group + 1] - d_offsets[group];
+  }
+};
+
+template <typename T>
+struct value_as_double_fn {
+  __device__ double operator()(T value) const { return static_cast<double>(value); }
+};
+
+std::unique_ptr<column> make_empty_digest_column(rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  auto make_empty_list = [&] {
+    return make_lists_column(0,
+                             make_empty_column(data_type{type_to_id<offset_type>()}),
+                             make_empty_column(data_type{type_id::FLOAT64}),
+                             0,
+                             rmm::device_buffer{0, stream, mr},
+                             stream,
+                             mr);
+  };
+  std::vector<std::unique_ptr<column>> children;
+  children.push_back(make_empty_list());
+  children.push_back(make_empty_list());
+  return make_structs_column(
+    0, std::move(children), 0, rmm::device_buffer{0, stream, mr}, stream, mr);
+}
+
+/**
+ * @brief Compacts stride-`max_centroids` centroid buffers into the digest
+ * structs column `STRUCT<LIST<double> means, LIST<double> weights>`.
+ */
+std::unique_ptr<column> make_digest_column(rmm::device_uvector<double> const& dense_means,
+                                           rmm::device_uvector<double> const& dense_weights,
+                                           rmm::device_uvector<size_type> const& counts,
+                                           size_type num_groups,
+                                           size_type max_centroids,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  auto offsets_column =
+    strings::detail::make_offsets_child_column(counts.cbegin(), counts.cend(), stream, mr);
+  auto const num_centroids =
+    cudf::detail::get_value<offset_type>(offsets_column->view(), num_groups, stream);
+
+  auto means_child = make_numeric_column(
+    data_type{type_id::FLOAT64}, num_centroids, mask_state::UNALLOCATED, stream, mr);
+  auto weights_child = make_numeric_column(
+    data_type{type_id::FLOAT64}, num_centroids, mask_state::UNALLOCATED, stream, mr);
+
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_groups,
+                     [d_offsets = offsets_column->view().begin<offset_type>(),
+                      d_means   = dense_means.data(),
+                      d_weights = dense_weights.data(),
+                      d_counts  = counts.data(),
+                      d_out_m   = means_child->mutable_view().begin<double>(),
+                      d_out_w   = weights_child->mutable_view().begin<double>(),
+                      max_centroids] __device__(size_type group) {
+                       auto const in = static_cast<std::size_t>(group) * max_centroids;
+                       thrust::copy(thrust::seq,
+                                    d_means + in,
+                                    d_means + in + d_counts[group],
+                                    d_out_m + d_offsets[group]);
+                       thrust::copy(thrust::seq,
+                                    d_weights + in,
+                                    d_weights + in + d_counts[group],
+                                    d_out_w + d_offsets[group]);
+                     });
+
+  // Both lists share the same row structure; each needs its own offsets column
+  auto offsets_copy = std::make_unique<column>(offsets_column->view(), stream, mr);
+
+  std::vector<std::unique_ptr<column>> children;
+  children.push_back(make_lists_column(num_groups,
+                                       std::move(offsets_column),
+                                       std::move(means_child),
+                                       0,
+                                       rmm::device_buffer{0, stream, mr},
+                                       stream,
+                                       mr));
+  children.push_back(make_lists_column(num_groups,
+                                       std::move(offsets_copy),
+                                       std::move(weights_child),
+                                       0,
+                                       rmm::device_buffer{0, stream, mr},
+                                       stream,
+                                       mr));
+  return make_structs_column(
+    num_groups, std::move(children), 0, rmm::device_buffer{0, stream, mr}, stream, mr);
+}
+
+struct tdigest_functor {
+  template <typename T, std::enable_if_t<std::is_arithmetic_v<T>>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& values,
+                                     column_view const& group_sizes,
+                                     cudf::device_span<size_type const> group_offsets,
+                                     size_type num_groups,
+                                     size_type max_centroids,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    // Values are sorted within each group with nulls last, so the first
+    // `group_sizes[i]` elements from each group offset are the valid ones
+    auto const values_iter =
+      thrust::make_transform_iterator(values.data<T>(), value_as_double_fn<T>{});
+
+    auto const buffer_size = static_cast<std::size_t>(num_groups) * max_centroids;
+    rmm::device_uvector<double> dense_means(buffer_size, stream);
+    rmm::device_uvector<double> dense_weights(buffer_size, stream);
+    rmm::device_uvector<size_type> counts(num_groups, stream);
+
+    cudf::detail::grid_1d grid(num_groups, tdigest_block_size);
+    build_tdigest_kernel<<<grid.num_blocks, tdigest_block_size, 0, stream.value()>>>(
+      values_iter,
+      thrust::make_constant_iterator(1.0),
+      group_offsets.data(),
+      group_sizes.data<size_type>(),
+      num_groups,
+      max_centroids,
+      dense_means.data(),
+      dense_weights.data(),
+      counts.data());
+
+    return make_digest_column(
+      dense_means, dense_weights, counts, num_groups, max_centroids, stream, mr);
+  }
+
+  template <typename T, std::enable_if_t<not std::is_arithmetic_v<T>>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     column_view const&,
+                                     cudf::device_span<size_type const>,
+                                     size_type,
+                                     size_type,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Unsupported type for TDIGEST aggregation");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> group_tdigest(column_view const& values,
+                                      column_view const& group_sizes,
+                                      cudf::device_span<size_type const> group_offsets,
+                                      size_type num_groups,
+                                      size_type max_centroids,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(max_centroids >= 1, "TDIGEST max_centroids must be at least 1");
+  if (num_groups == 0) { return make_empty_digest_column(stream, mr); }
+  return type_dispatcher(values.type(),
+                         tdigest_functor{},
+                         values,
+                         group_sizes,
+                         group_offsets,
+                         num_groups,
+                         max_centroids,
+                         stream,
+                         mr);
+}
+
+std::unique_ptr<column> group_merge_tdigest(column_view const& values,
+                                            cudf::device_span<size_type const> group_offsets,
+                                            size_type num_groups,
+                                            size_type max_centroids,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(max_centroids >= 1, "MERGE_TDIGEST max_centroids must be at least 1");
+  CUDF_EXPECTS(values.type().id() == type_id::STRUCT and values.num_children() == 2,
+               "MERGE_TDIGEST expects a digest structs column of two lists");
+  structs_column_view const structs(values);
+  auto const means_lists   = lists_column_view(structs.get_sliced_child(0));
+  auto const weights_lists = lists_column_view(structs.get_sliced_child(1));
+  CUDF_EXPECTS(means_lists.child().type().id() == type_id::FLOAT64 and
+                 weights_lists.child().type().id() == type_id::FLOAT64,
+               "MERGE_TDIGEST digest centroids must be FLOAT64");
+
+  if (num_groups == 0) { return make_empty_digest_column(stream, mr); }
+
+  auto const means   = means_lists.get_sliced_child(stream);
+  auto const weights = weights_lists.get_sliced_child(stream);
+  CUDF_EXPECTS(means.size() == weights.size() and not means.has_nulls() and
+                 not weights.has_nulls(),
+               "MERGE_TDIGEST centroid means and weights must be non-null and of equal length");
+
+  // Flattened centroid ranges of each group's digest rows. The groups
+  // partition the digest rows, so these segments tile the centroid children.
+  rmm::device_uvector<size_type> segment_offsets(num_groups + 1, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_groups + 1),
+                    segment_offsets.begin(),
+                    digest_segment_begin_fn{means_lists.offsets_begin(), group_offsets.data()});
+
+  // Cluster boundaries assume values sorted ascending, so order each group's
+  // pooled centroids by mean before re-clustering them with their weights
+  auto const segments_view = column_view(
+    data_type{type_to_id<offset_type>()}, num_groups + 1, segment_offsets.data());
+  auto const sorted_order = cudf::detail::segmented_sorted_order(
+    table_view{{means}}, segments_view, {}, {}, stream);
+  auto const d_order = sorted_order->view().begin<size_type>();
+
+  auto const values_iter  = thrust::make_permutation_iterator(means.begin<double>(), d_order);
+  auto const weights_iter = thrust::make_permutation_iterator(weights.begin<double>(), d_order);
+  auto const sizes_iter   = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0), segment_size_fn{segment_offsets.data()});
+
+  auto const buffer_size = static_cast<std::size_t>(num_groups) * max_centroids;
+  rmm::device_uvector<double> dense_means(buffer_size, stream);
+  rmm::device_uvector<double> dense_weights(buffer_size, stream);
+  rmm::device_uvector<size_type> counts(num_groups, stream);
+
+  cudf::detail::grid_1d grid(num_groups, tdigest_block_size);
+  build_tdigest_kernel<<<grid.num_blocks, tdigest_block_size, 0, stream.value()>>>(
+    values_iter,
+    weights_iter,
+    segment_offsets.data(),
+    sizes_iter,
+    num_groups,
+    max_centroids,
+    dense_means.data(),
+    dense_weights.data(),
+    counts.data());
+
+  return make_digest_column(
+    dense_means, dense_weights, counts, num_groups, max_centroids, stream, mr);
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <groupby/sort/group_reductions.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/swap.h>
+
+#include <memory>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+
+/// One thread per group keeps its heap in shared memory; limits k * block_size
+/// * sizeof(largest fixed-width type) to well under the shared memory budget.
+constexpr size_type topk_block_size = 64;
+
+/**
+ * @brief Heap ordering predicate: does `lhs` belong closer to the root than `rhs`?
+ *
+ * The root holds the weakest element kept so far: the least when keeping the
+ * greatest elements, and the greatest when keeping the least.
+ */
+template <typename T>
+__device__ bool heap_before(T const& lhs, T const& rhs, bool keep_greatest)
+{
+  return keep_greatest ? (lhs < rhs) : (rhs < lhs);
+}
+
+template <typename T>
+__device__ void heap_sift_down(T* heap, size_type size, bool keep_greatest)
+{
+  size_type node = 0;
+  while (true) {
+    auto child = 2 * node + 1;
+    if (child >= size) { break; }
+    if (child + 1 < size and heap_before(heap[child + 1], heap[child], keep_greatest)) { ++child; }
+    if (not heap_before(heap[child], heap[node], keep_greatest)) { break; }
+    thrust::swap(heap[node], heap[child]);
+    node = child;
+  }
+}
+
+template <typename T>
+__device__ void heap_push(T* heap, size_type size, T const& value, bool keep_greatest)
+{
+  heap[size] = value;
+  auto node  = size;
+  while (node > 0) {
+    auto const parent = (node - 1) / 2;
+    if (not heap_before(heap[node], heap[parent], keep_greatest)) { break; }
+    thrust::swap(heap[node], heap[parent]);
+    node = parent;
+  }
+}
+
+/**
+ * @brief Selects the k best non-null values of each group in a single pass.
+ *
+ * Each thread owns one group and a k-element heap in shared memory whose root
+ * is the weakest value kept so far, so every input element costs one
+ * comparison plus `O(log k)` work only when it displaces a kept value.
+ * Results are written best first at stride `k`; `group_sizes` receives
+ * `min(k, non-null group size)`.
+ */
+template <typename T>
+__global__ void top_k_kernel(column_device_view values,
+                             size_type const* group_offsets,
+                             size_type num_groups,
+                             size_type k,
+                             bool keep_greatest,
+                             T* group_results,
+                             size_type* group_sizes)
+{
+  extern __shared__ __align__(sizeof(int64_t)) char shared_memory[];
+  auto const heap = reinterpret_cast<T*>(shared_memory) + threadIdx.x * k;
+
+  auto const stride = static_cast<size_type>(blockDim.x * gridDim.x);
+  for (auto group = static_cast<size_type>(blockIdx.x * blockDim.x + threadIdx.x);
+       group < num_groups;
+       group += stride) {
+    size_type size = 0;
+    for (auto i = group_offsets[group]; i < group_offsets[group + 1]; ++i) {
+      if (values.is_null(i)) { continue; }
+      auto const value = values.element<T>(i);
+      if (size < k) {
+        heap_push(heap, size++, value, keep_greatest);
+      } else if (heap_before(heap[0], value, keep_greatest)) {
+        heap[0] = value;
+        heap_sift_down(heap, k, keep_greatest);
+      }
+    }
+    group_sizes[group] = size;
+
+    // Pop weakest first, filling the output from the back so each group's
+    // result ends up ordered best first
+    auto const out = group_results + static_cast<std::size_t>(group) * k;
+    auto remaining = size;
+    for (auto j = size; j > 0; --j) {
+      out[j - 1] = heap[0];
+      heap[0]    = heap[--remaining];
+      heap_sift_down(heap, remaining, keep_greatest);
+    }
+  }
+}
+
+struct top_k_functor {
+  template <typename T,
+            std::enable_if_t<cudf::is_fixed_width<T>() and
+                             cudf::is_relationally_comparable<T, T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& values,
+                                     cudf::device_span<size_type const> group_offsets,
+                                     size_type num_groups,
+                                     size_type k,
+                                     order ord,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    auto const d_values = column_device_view::create(values, stream);
+    rmm::device_uvector<T> group_results(static_cast<std::size_t>(num_groups) * k, stream);
+    rmm::device_uvector<size_type> group_sizes(num_groups, stream);
+
+    auto const keep_greatest = ord == order::DESCENDING;
+    cudf::detail::grid_1d grid(num_groups, topk_block_size);
+    auto const shared_size = topk_block_size * k * sizeof(T);
+    top_k_kernel<T><<<grid.num_blocks, topk_block_size, shared_size, stream.value()>>>(
+      *d_values,
+      group_offsets.data(),
+      num_groups,
+      k,
+      keep_greatest,
+      group_results.data(),
+      group_sizes.data());
+
+    auto offsets_column = strings::detail::make_offsets_child_column(
+      group_sizes.cbegin(), group_sizes.cend(), stream, mr);
+    auto const num_child_rows =
+      cudf::detail::get_value<offset_type>(offsets_column->view(), num_groups, stream);
+
+    auto child = make_fixed_width_column(
+      values.type(), num_child_rows, mask_state::UNALLOCATED, stream, mr);
+
+    // Compact the stride-k per-group results into the lists child column
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       num_groups,
+                       [d_offsets = offsets_column->view().template begin<offset_type>(),
+                        d_results = group_results.data(),
+                        d_sizes   = group_sizes.data(),
+                        d_child   = child->mutable_view().template head<T>(),
+                        k] __device__(size_type group) {
+                         auto const begin = d_results + static_cast<std::size_t>(group) * k;
+                         thrust::copy(
+                           thrust::seq, begin, begin + d_sizes[group], d_child + d_offsets[group]);
+                       });
+
+    return make_lists_column(num_groups,
+                             std::move(offsets_column),
+                             std::move(child),
+                             0,
+                             rmm::device_buffer{0, stream, mr},
+                             stream,
+                             mr);
+  }
+
+  template <typename T,
+            std::enable_if_t<not(cudf::is_fixed_width<T>() and
+                                 cudf::is_relationally_comparable<T, T>())>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     cudf::device_span<size_type const>,
+                                     size_type,
+                                     size_type,
+                                     order,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Unsupported type for TOP_K aggregation");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> group_top_k(column_view const& values,
+                                    cudf::device_span<size_type const> group_offsets,
+                                    size_type num_groups,
+                                    size_type k,
+                                    order ord,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(k >= 1 and k <= 32, "TOP_K k must be in [1, 32]");
+  if (num_groups == 0) {
+    return make_lists_column(0,
+                             make_empty_column(data_type{type_to_id<offset_type>()}),
+                             empty_like(values),
+                             0,
+                             rmm::device_buffer{0, stream, mr},
+                             stream,
+                             mr);
+  }
+  return type_dispatcher(
+    values.type(), top_k_functor{}, values, group_offsets, num_groups, k, ord, stream, mr);
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BLOCKED_BLOOM_FILTER_CUH
+#define BLOCKED_BLOOM_FILTER_CUH
+
+#include <hash/hash_allocator.cuh>
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+/**
+ * @brief Blocked Bloom filter over precomputed hash values.
+ *
+ * All membership bits of a value are confined to a single cache-line sized
+ * block, so an insert or query touches exactly one line of memory. Queries may
+ * return false positives but never false negatives, which makes the filter
+ * suitable as a cheap pre-filter in front of an exact hash table probe.
+ *
+ * A default-constructed filter owns no storage and reports every query as a
+ * potential hit, so it can be passed to kernels as a no-op when filtering is
+ * disabled.
+ *
+ * Supports concurrent insert, but not concurrent insert and querying.
+ */
+template <typename hash_value_type, typename Allocator = default_allocator<char>>
+class blocked_bloom_filter {
+ public:
+  using allocator_type = Allocator;
+
+  /// Number of 64-bit words per block; 16 words make a 128-byte cache line
+  static constexpr int words_per_block = 16;
+  /// Number of bits set and tested per value
+  static constexpr int bits_per_value = 4;
+  /// Filter bits allocated per expected key
+  static constexpr int bits_per_key = 16;
+
+  /**
+   * @brief Factory to construct a new Bloom filter sized for `num_keys` keys.
+   *
+   * Returns a `std::unique_ptr` to a new filter object. The filter is
+   * non-owning and trivially copyable and should be passed by value into
+   * kernels. The `unique_ptr` contains a custom deleter that will free the
+   * filter's storage.
+   *
+   * @note All allocations and copies in the constructor take place on stream
+   * but the constructor does not synchronize the stream. It is the user's
+   * responsibility to synchronize or use the same stream to access the filter.
+   *
+   * @param num_keys The expected number of distinct keys to be inserted
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param allocator The allocator to use for allocation of the filter's storage
+   */
+  static auto create(std::size_t num_keys,
+                     rmm::cuda_stream_view stream    = rmm::cuda_stream_default,
+                     const allocator_type& allocator = allocator_type())
+  {
+    CUDF_FUNC_RANGE();
+    using Self = blocked_bloom_filter<hash_value_type, Allocator>;
+
+    // Note: need `(*p).destroy` instead of `p->destroy` here
+    // due to compiler bug: https://github.com/rapidsai/cudf/pull/5692
+    auto deleter = [stream](Self* p) { (*p).destroy(stream); };
+
+    return std::unique_ptr<Self, std::function<void(Self*)>>{new Self(num_keys, allocator, stream),
+                                                             deleter};
+  }
+
+  /**
+   * @brief Frees the storage of the filter and destroys the filter object.
+   *
+   * This function is invoked as the deleter of the `std::unique_ptr` returned
+   * from the `create()` factory function.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void destroy(rmm::cuda_stream_view stream = rmm::cuda_stream_default)
+  {
+    m_allocator.deallocate(reinterpret_cast<char*>(m_words), storage_bytes(m_num_blocks), stream);
+    delete this;
+  }
+
+  /// Constructs a storage-less pass-through filter whose queries always hit
+  blocked_bloom_filter() : m_allocator{}, m_num_blocks{0}, m_words{nullptr} {}
+
+  blocked_bloom_filter(blocked_bloom_filter const&) = default;
+  blocked_bloom_filter(blocked_bloom_filter&&)      = default;
+  blocked_bloom_filter& operator=(blocked_bloom_filter const&) = default;
+  blocked_bloom_filter& operator=(blocked_bloom_filter&&) = default;
+  ~blocked_bloom_filter()                                 = default;
+
+  /// Number of blocks in the filter
+  __host__ __device__ std::size_t num_blocks() const { return m_num_blocks; }
+
+  /**
+   * @brief Inserts a hash value into the filter.
+   *
+   * @param[in] hash_value The hash value of the key to insert
+   */
+  __forceinline__ __device__ void insert(hash_value_type hash_value)
+  {
+    if (nullptr == m_words) { return; }
+    auto* const block = m_words + block_index(hash_value) * words_per_block;
+    auto probe        = mix(hash_value);
+    for (int i = 0; i < bits_per_value; ++i) {
+      auto const bit = probe & (block_bits - 1);
+      atomicOr(block + (bit / 64), 1ull << (bit % 64));
+      probe >>= bits_per_position;
+    }
+  }
+
+  /**
+   * @brief Queries the filter for a hash value.
+   *
+   * @param[in] hash_value The hash value of the key to query
+   *
+   * @returns true if the value may have been inserted (false positives are
+   * possible), false if it definitely has not been
+   */
+  __forceinline__ __device__ bool contains(hash_value_type hash_value) const
+  {
+    if (nullptr == m_words) { return true; }
+    auto const* const block = m_words + block_index(hash_value) * words_per_block;
+    auto probe              = mix(hash_value);
+    for (int i = 0; i < bits_per_value; ++i) {
+      auto const bit = probe & (block_bits - 1);
+      if (0 == (block[bit / 64] & (1ull << (bit % 64)))) { return false; }
+      probe >>= bits_per_position;
+    }
+    return true;
+  }
+
+ private:
+  /// Bits per block and the number of probe bits consumed per position
+  static constexpr int block_bits        = words_per_block * 64;
+  static constexpr int bits_per_position = 10;  // log2(block_bits)
+
+  static_assert((1 << bits_per_position) == block_bits,
+                "bits_per_position must address every bit of a block");
+  static_assert(bits_per_value * bits_per_position <= 64,
+                "the mixed probe must supply enough bits for every position");
+
+  static constexpr std::size_t storage_bytes(std::size_t num_blocks)
+  {
+    return num_blocks * words_per_block * sizeof(unsigned long long);
+  }
+
+  /// Maps a hash value to a block using the fast range reduction
+  __forceinline__ __device__ std::size_t block_index(hash_value_type hash_value) const
+  {
+    return (static_cast<std::size_t>(static_cast<uint32_t>(hash_value)) * m_num_blocks) >> 32;
+  }
+
+  /// Expands a 32-bit hash value into 64 well-mixed probe bits
+  __forceinline__ __device__ static uint64_t mix(hash_value_type hash_value)
+  {
+    uint64_t x = static_cast<uint32_t>(hash_value);
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdull;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ull;
+    x ^= x >> 33;
+    return x;
+  }
+
+  /**
+   * @brief Private constructor used by the `create` factory function.
+   *
+   * Allocates one cache-line sized block per `block_bits / bits_per_key`
+   * expected keys and zero-fills the storage.
+   *
+   * @param[in] num_keys The expected number of distinct keys
+   * @param[in] a An optional functor for allocating the filter's storage
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+   */
+  explicit blocked_bloom_filter(std::size_t num_keys,
+                                const allocator_type& a      = allocator_type(),
+                                rmm::cuda_stream_view stream = rmm::cuda_stream_default)
+    : m_allocator(a),
+      m_num_blocks(std::max<std::size_t>(1, (num_keys * bits_per_key + block_bits - 1) / block_bits))
+  {
+    m_words =
+      reinterpret_cast<unsigned long long*>(m_allocator.allocate(storage_bytes(m_num_blocks), stream));
+    CUDA_TRY(
+      cudaMemsetAsync(m_words, 0, storage_bytes(m_num_blocks), stream.value()));
+  }
+
+  allocator_type m_allocator;
+  std::size_t m_num_blocks;
+  unsigned long long* m_words;
+};
+
+#endif  // BLOCKED_BLOOM_FILTER_CUH
@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLAT_MULTIMAP_CUH
+#define FLAT_MULTIMAP_CUH
+
+#include <hash/hash_allocator.cuh>
+#include <hash/helper_functions.cuh>
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+template <typename Key, typename size_type>
+__global__ void init_flat_multimap_keys(Key* __restrict__ const keys,
+                                        const size_type n,
+                                        const Key key_val)
+{
+  const size_type idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (idx < n) { keys[idx] = key_val; }
+}
+
+/**
+ * @brief Open-addressing multimap with separate (SoA) key and value storage.
+ *
+ * Unlike `concurrent_unordered_multimap`, which stores `thrust::pair` entries,
+ * this map keeps keys and values in separate arrays. Probing a slot therefore
+ * only touches the key array, halving the traffic of the probe loop, and keys
+ * are read through aligned vectorized loads of `window_size` slots at a time.
+ * The value of a slot is only loaded once its key has matched.
+ *
+ * Supports concurrent insert, but not concurrent insert and probing.
+ *
+ * @note The user is responsible for the following stream semantics:
+ * - Either the same stream should be used to create the map as is used by the kernels that access
+ * it, or
+ * - the stream used to create the map should be synchronized before it is accessed from a different
+ * stream or from host code.
+ */
+template <typename Key,
+          typename Element,
+          typename size_type,
+          Key unused_key,
+          Element unused_element,
+          typename Hasher    = default_hash<Key>,
+          typename Equality  = equal_to<Key>,
+          typename Allocator = default_allocator<char>>
+class flat_multimap {
+ public:
+  using hasher          = Hasher;
+  using key_equal       = Equality;
+  using allocator_type  = Allocator;
+  using key_type        = Key;
+  using mapped_type     = Element;
+  using hash_value_type = typename Hasher::result_type;
+
+  /// Number of keys fetched by a single probe load
+  static constexpr size_type window_size = 4;
+
+  static_assert(std::is_integral<Key>::value and
+                  (sizeof(Key) == sizeof(uint32_t) or sizeof(Key) == sizeof(uint64_t)),
+                "flat_multimap requires an integral key supported by atomicCAS");
+
+ private:
+  /// Aligned group of keys so that probing reads one vector load per window
+  struct alignas(window_size * sizeof(Key)) key_window {
+    Key keys[window_size];
+  };
+
+ public:
+  /**
+   * @brief Device-side sequence of slots visited when probing for a key.
+   *
+   * Probing proceeds in windows of `window_size` slots: the keys of the current
+   * window are loaded with a single vectorized load and scanned from registers,
+   * so stepping within a window touches no memory. The sequence wraps around
+   * the table and `exhausted()` reports when every slot has been visited.
+   */
+  class probe_sequence {
+   public:
+    __device__ probe_sequence(Key const* keys,
+                              Element const* values,
+                              size_type num_windows,
+                              hash_value_type hash_value)
+      : m_keys{keys},
+        m_values{values},
+        m_num_windows{num_windows},
+        m_window_idx{static_cast<size_type>(hash_value % num_windows)},
+        m_lane{0},
+        m_probed{0}
+    {
+      load_window();
+    }
+
+    /// Key stored in the current slot (register read)
+    __device__ Key key() const { return m_window.keys[m_lane]; }
+
+    /// Value stored in the current slot (loaded from the value array)
+    __device__ Element value() const { return m_values[m_window_idx * window_size + m_lane]; }
+
+    /// Advances to the next slot, loading the next window when needed
+    __device__ void advance()
+    {
+      ++m_probed;
+      if (++m_lane == window_size) {
+        m_lane       = 0;
+        m_window_idx = (m_window_idx + 1 == m_num_windows) ? 0 : m_window_idx + 1;
+        load_window();
+      }
+    }
+
+    /// True if every slot of the table has been visited
+    __device__ bool exhausted() const { return m_probed >= m_num_windows * window_size; }
+
+   private:
+    __device__ void load_window()
+    {
+      m_window = *reinterpret_cast<key_window const*>(m_keys + m_window_idx * window_size);
+    }
+
+    Key const* m_keys;
+    Element const* m_values;
+    size_type m_num_windows;
+    size_type m_window_idx;
+    size_type m_lane;
+    size_type m_probed;
+    key_window m_window;
+  };
+
+  /**
+   * @brief Factory to construct a new flat multimap.
+   *
+   * Returns a `std::unique_ptr` to a new flat multimap object. The map is
+   * non-owning and trivially copyable and should be passed by value into
+   * kernels. The `unique_ptr` contains a custom deleter that will free the
+   * map's contents.
+   *
+   * @note A slot whose key equals `unused_key` is empty; attempting to insert
+   * a key equal to `unused_key` results in undefined behavior.
+   *
+   * @note All allocations, kernels and copies in the constructor take place
+   * on stream but the constructor does not synchronize the stream. It is the user's
+   * responsibility to synchronize or use the same stream to access the map.
+   *
+   * @param capacity The maximum number of pairs the map may hold; rounded up
+   * to a multiple of `window_size`
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param init Indicates if the map should be initialized with the unused key
+   * @param hash_function The hash function to use for hashing keys
+   * @param equal The equality comparison function for comparing if two keys are
+   * equal
+   * @param allocator The allocator to use for allocation of the map's storage
+   */
+  static auto create(size_type capacity,
+                     rmm::cuda_stream_view stream    = rmm::cuda_stream_default,
+                     const bool init                 = true,
+                     const Hasher& hash_function     = hasher(),
+                     const Equality& equal           = key_equal(),
+                     const allocator_type& allocator = allocator_type())
+  {
+    CUDF_FUNC_RANGE();
+    using Self = flat_multimap<Key,
+                               Element,
+                               size_type,
+                               unused_key,
+                               unused_element,
+                               Hasher,
+                               Equality,
+                               Allocator>;
+
+    // Note: need `(*p).destroy` instead of `p->destroy` here
+    // due to compiler bug: https://github.com/rapidsai/cudf/pull/5692
+    auto deleter = [stream](Self* p) { (*p).destroy(stream); };
+
+    return std::unique_ptr<Self, std::function<void(Self*)>>{
+      new Self(capacity, init, hash_function, equal, allocator, stream), deleter};
+  }
+
+  /**
+   * @brief Frees the contents of the map and destroys the map object.
+   *
+   * This function is invoked as the deleter of the `std::unique_ptr` returned
+   * from the `create()` factory function.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void destroy(rmm::cuda_stream_view stream = rmm::cuda_stream_default)
+  {
+    m_allocator.deallocate(reinterpret_cast<char*>(m_keys), storage_bytes(m_capacity), stream);
+    delete this;
+  }
+
+  __forceinline__ static constexpr __host__ __device__ key_type get_unused_key()
+  {
+    return unused_key;
+  }
+
+  /// Number of slots in the map
+  __host__ __device__ size_type capacity() const { return m_capacity; }
+
+  /// Device pointer to the map's storage (keys followed by values)
+  void const* storage_data() const { return m_keys; }
+
+  /// Size in bytes of the map's storage
+  size_t storage_size() const { return storage_bytes(m_capacity); }
+
+  /**
+   * @brief Reconstructs a map from storage previously obtained through
+   * `storage_data()`/`storage_size()`.
+   *
+   * The storage may have been serialized on a different device; the copy is
+   * performed with `cudaMemcpyDefault`.
+   *
+   * @throw cudf::logic_error if `size` is not a valid storage size for this map type
+   *
+   * @param data Device (or host) pointer to the serialized storage
+   * @param size Size of the serialized storage in bytes
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param hash_function The hash function to use for hashing keys
+   * @param equal The equality comparison function for comparing if two keys are
+   * equal
+   * @param allocator The allocator to use for allocation of the map's storage
+   */
+  static auto import_storage(void const* data,
+                             size_t size,
+                             rmm::cuda_stream_view stream    = rmm::cuda_stream_default,
+                             const Hasher& hash_function     = hasher(),
+                             const Equality& equal           = key_equal(),
+                             const allocator_type& allocator = allocator_type())
+  {
+    constexpr size_t slot_bytes = sizeof(key_type) + sizeof(mapped_type);
+    CUDF_EXPECTS(size % (slot_bytes * window_size) == 0, "Invalid flat_multimap storage size");
+    auto map =
+      create(static_cast<size_type>(size / slot_bytes), stream, false, hash_function, equal, allocator);
+    CUDA_TRY(cudaMemcpyAsync(map->m_keys, data, size, cudaMemcpyDefault, stream.value()));
+    return map;
+  }
+
+  /**
+   * @brief Inserts a (key, value) pair into the map.
+   *
+   * The key is claimed with an `atomicCAS` on the key array alone; the value
+   * is stored non-atomically afterwards, which is safe because values are only
+   * read by probes in subsequent kernels.
+   *
+   * @param[in] key The key to insert
+   * @param[in] value The value to insert
+   * @param[in] hash_value The precomputed hash value of `key`, used to
+   * determine the insert location
+   *
+   * @returns true if the pair was inserted, false if the map is full
+   */
+  __forceinline__ __device__ bool insert(key_type key,
+                                         mapped_type value,
+                                         hash_value_type hash_value)
+  {
+    size_type slot = static_cast<size_type>(hash_value % m_num_windows) * window_size;
+    for (size_type attempt = 0; attempt < m_capacity; ++attempt) {
+      key_type const old = atomicCAS(m_keys + slot, unused_key, key);
+      if (m_equal(old, unused_key)) {
+        m_values[slot] = value;
+        return true;
+      }
+      slot = (slot + 1 == m_capacity) ? 0 : slot + 1;
+    }
+    return false;
+  }
+
+  /**
+   * @brief Returns the sequence of slots to visit when probing for `hash_value`.
+   *
+   * The sequence enumerates slots in the same order as `insert()`, so walking
+   * it until an empty slot visits every entry stored under `hash_value`.
+   *
+   * @param[in] hash_value The hash value of the key being probed for
+   */
+  __forceinline__ __device__ probe_sequence probe(hash_value_type hash_value) const
+  {
+    return probe_sequence{m_keys, m_values, m_num_windows, hash_value};
+  }
+
+  flat_multimap()                     = delete;
+  flat_multimap(flat_multimap const&) = default;
+  flat_multimap(flat_multimap&&)      = default;
+  flat_multimap& operator=(flat_multimap const&) = default;
+  flat_multimap& operator=(flat_multimap&&) = default;
+  ~flat_multimap()                          = default;
+
+ private:
+  hasher m_hf;
+  key_equal m_equal;
+  allocator_type m_allocator;
+  size_type m_capacity;
+  size_type m_num_windows;
+  key_type* m_keys;
+  mapped_type* m_values;
+
+  static constexpr size_type round_up_capacity(size_type n)
+  {
+    return ((n + window_size - 1) / window_size) * window_size;
+  }
+
+  static constexpr size_t storage_bytes(size_type capacity)
+  {
+    return capacity * (sizeof(key_type) + sizeof(mapped_type));
+  }
+
+  /**
+   * @brief Private constructor used by `create` factory function.
+   *
+   * Allocates the key and value arrays from a single buffer and optionally
+   * fills the key array with the unused key. The value array is left
+   * uninitialized since a value is only read once its key has been inserted.
+   *
+   * @param[in] n The number of slots in the map
+   * @param[in] init Initialize the key array with the unused key
+   * @param[in] hash_function An optional hashing function
+   * @param[in] equal An optional functor for comparing if two keys are equal
+   * @param[in] a An optional functor for allocating the map's storage
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+   */
+  explicit flat_multimap(size_type n,
+                         const bool init              = true,
+                         const Hasher& hash_function  = hasher(),
+                         const Equality& equal        = key_equal(),
+                         const allocator_type& a      = allocator_type(),
+                         rmm::cuda_stream_view stream = rmm::cuda_stream_default)
+    : m_hf(hash_function),
+      m_equal(equal),
+      m_allocator(a),
+      m_capacity(round_up_capacity(n)),
+      m_num_windows(round_up_capacity(n) / window_size)
+  {
+    auto* const storage = m_allocator.allocate(storage_bytes(m_capacity), stream);
+    m_keys              = reinterpret_cast<key_type*>(storage);
+    m_values = reinterpret_cast<mapped_type*>(storage + m_capacity * sizeof(key_type));
+
+    if (init) {
+      constexpr int block_size = 128;
+      init_flat_multimap_keys<<<((m_capacity - 1) / block_size) + 1,
+                                block_size,
+                                0,
+                                stream.value()>>>(m_keys, m_capacity, unused_key);
+      CUDA_TRY(cudaGetLastError());
+    }
+  }
+};
+
+#endif  // FLAT_MULTIMAP_CUH
@@ -119,6 +119,7 @@ std::unique_ptr<column> hash(table_view const& input,
       return serial_murmur_hash3_32<MurmurHash3_32>(input, seed, stream, mr);
     case (hash_id::HASH_SPARK_MURMUR3):
       return serial_murmur_hash3_32<SparkMurmurHash3_32>(input, seed, stream, mr);
+    case (hash_id::HASH_XXHASH64): return xxhash_64(input, seed, stream, mr);
     default: return nullptr;
   }
 }
@@ -135,4 +136,10 @@ std::unique_ptr<column> hash(table_view const& input,
   return detail::hash(input, hash_function, initial_hash, seed, rmm::cuda_stream_default, mr);
 }
 
+uint64_t table_checksum(table_view const& input, uint64_t seed)
+{
+  CUDF_FUNC_RANGE();
+  return detail::table_checksum(input, seed, rmm::cuda_stream_default);
+}
+
 }  // namespace cudf
@@ -64,17 +64,20 @@ std::unique_ptr<column> murmur_hash3_32(table_view const& input,
                          *device_input, device_initial_hash.data()));
     }
   } else {
-    if (nullable) {
-      thrust::tabulate(rmm::exec_policy(stream),
-                       output_view.begin<int32_t>(),
-                       output_view.end<int32_t>(),
-                       row_hasher<MurmurHash3_32, true>(*device_input));
-    } else {
+    auto const tabulate_hashes = [&](auto hasher) {
       thrust::tabulate(rmm::exec_policy(stream),
                        output_view.begin<int32_t>(),
                        output_view.end<int32_t>(),
-                       row_hasher<MurmurHash3_32, false>(*device_input));
-    }
+                       hasher);
+    };
+    // Fix the column count at compile time for narrow tables to unroll the per-row column loop
+    column_count_dispatcher(input.num_columns(), [&](auto num_columns) {
+      if (nullable) {
+        tabulate_hashes(row_hasher<MurmurHash3_32, true, num_columns()>(*device_input));
+      } else {
+        tabulate_hashes(row_hasher<MurmurHash3_32, false, num_columns()>(*device_input));
+      }
+    });
   }
 
   return output;
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/hashing.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+
+namespace {
+
+/**
+ * @brief Computes the xxhash64 value of an element, using the running row hash as the seed.
+ */
+template <bool has_nulls>
+class element_hasher_xxhash64 {
+ public:
+  __device__ element_hasher_xxhash64(uint64_t seed) : _seed{seed} {}
+
+  template <typename T, CUDF_ENABLE_IF(column_device_view::has_element_accessor<T>())>
+  __device__ uint64_t operator()(column_device_view col, size_type row_index) const
+  {
+    if (has_nulls && col.is_null(row_index)) { return std::numeric_limits<uint64_t>::max(); }
+    return XXHash_64<T>{_seed}(col.element<T>(row_index));
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>())>
+  __device__ uint64_t operator()(column_device_view col, size_type row_index) const
+  {
+    cudf_assert(false && "Unsupported type in hash.");
+    return {};
+  }
+
+ private:
+  uint64_t _seed;
+};
+
+/**
+ * @brief Row hasher chaining the running hash as the seed for each column's element hash.
+ *
+ * @tparam num_columns Compile-time number of columns in the table, or `-1` when the column count
+ * is only known at run time. See `column_count_dispatcher`.
+ */
+template <bool has_nulls, size_type num_columns>
+struct row_hasher_xxhash64 {
+  table_device_view input;
+  uint64_t seed;
+
+  __device__ uint64_t operator()(size_type row_index) const
+  {
+    // A compile-time trip count lets the compiler fully unroll this loop
+    auto const num_cols = (num_columns < 0) ? input.num_columns() : num_columns;
+    auto hash           = seed;
+    for (size_type i = 0; i < num_cols; ++i) {
+      auto const col = input.column(i);
+      hash           = cudf::type_dispatcher(
+        col.type(), element_hasher_xxhash64<has_nulls>{hash}, col, row_index);
+    }
+    return hash;
+  }
+};
+
+/**
+ * @brief Re-hashes a row hash seeded by its row index.
+ *
+ * The per-row digests are then safe to combine with a commutative XOR reduction: the index
+ * seed makes the result order-sensitive, and two equal rows no longer cancel each other out.
+ */
+struct index_seeded_hash {
+  int64_t const* row_hashes;
+
+  __device__ uint64_t operator()(size_type row_index) const
+  {
+    return XXHash_64<uint64_t>{static_cast<uint64_t>(row_index)}(
+      static_cast<uint64_t>(row_hashes[row_index]));
+  }
+};
+
+template <bool has_nulls>
+void tabulate_xxhash64(table_device_view const& device_input,
+                       mutable_column_view& output_view,
+                       uint64_t seed,
+                       rmm::cuda_stream_view stream)
+{
+  column_count_dispatcher(device_input.num_columns(), [&](auto num_columns) {
+    thrust::tabulate(rmm::exec_policy(stream),
+                     output_view.begin<int64_t>(),
+                     output_view.end<int64_t>(),
+                     row_hasher_xxhash64<has_nulls, num_columns()>{device_input, seed});
+  });
+}
+
+}  // namespace
+
+std::unique_ptr<column> xxhash_64(table_view const& input,
+                                  uint64_t seed,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  auto output = make_numeric_column(
+    data_type(type_id::INT64), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
+
+  if (input.num_columns() == 0 || input.num_rows() == 0) { return output; }
+
+  CUDF_EXPECTS(
+    std::all_of(
+      input.begin(), input.end(), [](column_view const& col) { return !is_nested(col.type()); }),
+    "Nested columns are not supported in xxhash64");
+
+  auto const device_input = table_device_view::create(input, stream);
+  auto output_view        = output->mutable_view();
+
+  if (has_nulls(input)) {
+    tabulate_xxhash64<true>(*device_input, output_view, seed, stream);
+  } else {
+    tabulate_xxhash64<false>(*device_input, output_view, seed, stream);
+  }
+
+  return output;
+}
+
+uint64_t table_checksum(table_view const& input, uint64_t seed, rmm::cuda_stream_view stream)
+{
+  // Fold the table's shape into the digest on the host; two tables with
+  // different schemas must not collide just because both are empty.
+  auto digest = hash_combine(seed, static_cast<std::size_t>(input.num_columns()));
+  digest      = hash_combine(digest, static_cast<std::size_t>(input.num_rows()));
+  for (auto const& col : input) {
+    digest = hash_combine(digest, static_cast<std::size_t>(col.type().id()));
+    digest = hash_combine(digest, static_cast<std::size_t>(col.type().scale()));
+  }
+  if (input.num_columns() == 0 || input.num_rows() == 0) { return digest; }
+
+  auto const row_hashes = xxhash_64(input, seed, stream, rmm::mr::get_current_device_resource());
+  auto const content =
+    thrust::transform_reduce(rmm::exec_policy(stream),
+                             thrust::make_counting_iterator<size_type>(0),
+                             thrust::make_counting_iterator<size_type>(input.num_rows()),
+                             index_seeded_hash{row_hashes->view().data<int64_t>()},
+                             uint64_t{0},
+                             thrust::bit_xor<uint64_t>());
+  return hash_combine(digest, content);
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/histogram.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sequence.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/groupby.hpp>
+#include <cudf/histogram.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/distance.h>
+#include <thrust/execution_policy.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+// Defined in reductions/minmax.cu; it is not declared in any detail header.
+std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>> minmax(
+  column_view const& col, rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr);
+
+namespace {
+
+constexpr size_type histogram_block_size{256};
+
+// Bin counts small enough to keep one counter set per block in shared memory use the
+// shared path; larger bin counts fall back to global atomics.
+constexpr size_type max_shared_bins{4096};
+
+/**
+ * @brief Accumulates the histogram of `input` over the `num_bins + 1` sorted `bin_edges`.
+ *
+ * Each block accumulates into shared memory counters (when `use_shared`) and flushes them
+ * to `global_counts` once, so global atomics are only issued per block per bin instead of
+ * per element. Bin `i` covers `[bin_edges[i], bin_edges[i + 1])`; the last bin also
+ * includes its right edge. Values outside the edges, nulls, and NaNs are not counted.
+ */
+template <typename T, bool has_nulls>
+__global__ void histogram_kernel(column_device_view const input,
+                                 T const* const bin_edges,
+                                 size_type const num_bins,
+                                 bool const use_shared,
+                                 size_type* const global_counts)
+{
+  extern __shared__ size_type shared_counts[];
+
+  auto const counts = use_shared ? shared_counts : global_counts;
+  if (use_shared) {
+    for (size_type bin = threadIdx.x; bin < num_bins; bin += blockDim.x) {
+      shared_counts[bin] = 0;
+    }
+    __syncthreads();
+  }
+
+  auto const stride = static_cast<size_type>(blockDim.x) * gridDim.x;
+  for (size_type i = threadIdx.x + blockIdx.x * blockDim.x; i < input.size(); i += stride) {
+    if (has_nulls and input.is_null_nocheck(i)) { continue; }
+    auto const value = input.element<T>(i);
+
+    auto const edge_end = bin_edges + num_bins + 1;
+    auto const bound    = thrust::upper_bound(thrust::seq, bin_edges, edge_end, value);
+    if (bound == bin_edges) { continue; }
+    auto bin = static_cast<size_type>(thrust::distance(bin_edges, bound)) - 1;
+    if (bin == num_bins) {
+      // the last bin includes its right edge; this comparison also rejects NaN
+      if (not(value == bin_edges[num_bins])) { continue; }
+      bin = num_bins - 1;
+    }
+    atomicAdd(&counts[bin], size_type{1});
+  }
+
+  if (use_shared) {
+    __syncthreads();
+    for (size_type bin = threadIdx.x; bin < num_bins; bin += blockDim.x) {
+      if (shared_counts[bin] > 0) { atomicAdd(&global_counts[bin], shared_counts[bin]); }
+    }
+  }
+}
+
+/**
+ * @brief Functor called by the `type_dispatcher` to launch the histogram kernel.
+ */
+struct histogram_dispatcher {
+  template <typename T,
+            typename std::enable_if_t<cudf::is_numeric<T>() or cudf::is_chrono<T>()>* = nullptr>
+  void operator()(column_view const& input,
+                  column_view const& bin_edges,
+                  mutable_column_view const& counts,
+                  rmm::cuda_stream_view stream)
+  {
+    auto const num_bins   = bin_edges.size() - 1;
+    auto const use_shared = num_bins <= max_shared_bins;
+    auto const d_input    = column_device_view::create(input, stream);
+
+    cudf::detail::grid_1d grid(input.size(), histogram_block_size, 32);
+    auto const shared_size = use_shared ? num_bins * sizeof(size_type) : 0;
+    if (input.has_nulls()) {
+      histogram_kernel<T, true>
+        <<<grid.num_blocks, grid.num_threads_per_block, shared_size, stream.value()>>>(
+          *d_input, bin_edges.data<T>(), num_bins, use_shared, counts.data<size_type>());
+    } else {
+      histogram_kernel<T, false>
+        <<<grid.num_blocks, grid.num_threads_per_block, shared_size, stream.value()>>>(
+          *d_input, bin_edges.data<T>(), num_bins, use_shared, counts.data<size_type>());
+    }
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not(cudf::is_numeric<T>() or cudf::is_chrono<T>()), void> operator()(Args&&...)
+  {
+    CUDF_FAIL("histogram only supports numeric, timestamp, and duration types");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> histogram(column_view const& input,
+                                  column_view const& bin_edges,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(input.type() == bin_edges.type(), "input and bin_edges must be of the same type");
+  CUDF_EXPECTS(bin_edges.size() >= 2, "bin_edges must contain at least two elements");
+  CUDF_EXPECTS(not bin_edges.has_nulls(), "bin_edges cannot contain nulls");
+
+  auto const num_bins = bin_edges.size() - 1;
+  auto counts         = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_bins, mask_state::UNALLOCATED, stream, mr);
+  auto counts_view = counts->mutable_view();
+  CUDA_TRY(cudaMemsetAsync(
+    counts_view.data<size_type>(), 0, num_bins * sizeof(size_type), stream.value()));
+
+  if (input.size() > 0) {
+    type_dispatcher(input.type(), histogram_dispatcher{}, input, bin_edges, counts_view, stream);
+  }
+  return counts;
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> histogram(
+  column_view const& input,
+  size_type num_bins,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(num_bins > 0, "num_bins must be positive");
+  CUDF_EXPECTS(is_numeric(input.type()),
+               "histogram with computed edges requires a numeric column");
+
+  // The edges are computed in double precision so that one set of equal-width edges
+  // works for every numeric input type.
+  auto const values = cast(input, data_type{type_id::FLOAT64}, stream);
+  auto const minmax_result =
+    minmax(values->view(), stream, rmm::mr::get_current_device_resource());
+
+  double minimum = 0.0;
+  double maximum = 1.0;
+  if (minmax_result.first->is_valid(stream)) {
+    minimum = static_cast<numeric_scalar<double>*>(minmax_result.first.get())->value(stream);
+    maximum = static_cast<numeric_scalar<double>*>(minmax_result.second.get())->value(stream);
+    // an empty range (constant column) would otherwise count nothing
+    if (not(minimum < maximum)) { maximum = minimum + 1; }
+  }
+
+  auto const init = numeric_scalar<double>(minimum, true, stream);
+  auto const step = numeric_scalar<double>((maximum - minimum) / num_bins, true, stream);
+  auto edges      = sequence(num_bins + 1, init, step, stream, mr);
+
+  auto counts = histogram(values->view(), edges->view(), stream, mr);
+  return std::make_pair(std::move(edges), std::move(counts));
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> histogram(column_view const& input,
+                                  column_view const& bin_edges,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::histogram(input, bin_edges, rmm::cuda_stream_default, mr);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> histogram(
+  column_view const& input, size_type num_bins, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::histogram(input, num_bins, rmm::cuda_stream_default, mr);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> value_counts(
+  column_view const& input, null_policy null_handling, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = input;
+  requests[0].aggregations.push_back(
+    cudf::make_count_aggregation<groupby_aggregation>(null_policy::INCLUDE));
+
+  groupby::groupby gb_obj(table_view({input}), null_handling);
+  auto [keys, results] = gb_obj.aggregate(requests, mr);
+
+  return std::make_pair(std::move(keys->release().front()),
+                        std::move(results.front().results.front()));
+}
+
+}  // namespace cudf
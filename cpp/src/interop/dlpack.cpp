@@ -274,6 +274,101 @@ DLManagedTensor* to_dlpack(table_view const& input,
   return managed_tensor.release();
 }
 
+DLManagedTensor* to_dlpack_view(column_view const& input)
+{
+  if (input.size() == 0) { return nullptr; }
+
+  // Ensure that type is convertible to DLDataType
+  DLDataType const dltype = data_type_to_DLDataType(input.type());
+
+  CUDF_EXPECTS(not input.has_nulls(), "Input required to have null count zero");
+
+  auto managed_tensor = std::make_unique<DLManagedTensor>();
+  auto context        = std::make_unique<dltensor_context>();
+
+  DLTensor& tensor = managed_tensor->dl_tensor;
+  tensor.dtype     = dltype;
+  tensor.ndim      = 1;
+  tensor.shape     = context->shape;
+  tensor.shape[0]  = input.size();
+
+  CUDA_TRY(cudaGetDevice(&tensor.device.device_id));
+  tensor.device.device_type = kDLCUDA;
+
+  // The tensor is a view: it shares the column's device buffer instead of
+  // copying it, so the caller must keep the column alive for the lifetime of
+  // the tensor. The deleter only frees the tensor metadata.
+  tensor.data = const_cast<void*>(get_column_data(input));
+
+  managed_tensor->deleter     = dltensor_context::deleter;
+  managed_tensor->manager_ctx = context.release();
+
+  return managed_tensor.release();
+}
+
+DLManagedTensor* to_dlpack_view(table_view const& input)
+{
+  auto const num_rows = input.num_rows();
+  auto const num_cols = input.num_columns();
+  if (num_rows == 0 || num_cols == 0) { return nullptr; }
+  if (num_cols == 1) { return to_dlpack_view(input.column(0)); }
+
+  // Ensure that type is convertible to DLDataType
+  data_type const type    = input.column(0).type();
+  DLDataType const dltype = data_type_to_DLDataType(type);
+
+  // Ensure all columns are the same type
+  CUDF_EXPECTS(
+    std::all_of(input.begin(), input.end(), [type](auto const& col) { return col.type() == type; }),
+    "All columns required to have same data type");
+
+  // Ensure none of the columns have nulls
+  CUDF_EXPECTS(
+    std::none_of(input.begin(), input.end(), [](auto const& col) { return col.has_nulls(); }),
+    "Input required to have null count zero");
+
+  // A single strided tensor can only view columns that are equally spaced in
+  // device memory, e.g. a table that was imported with from_dlpack or unpacked
+  // from a contiguous buffer. Columns allocated independently will not satisfy
+  // this and callers must fall back to the copying to_dlpack.
+  int64_t const byte_width = size_of(type);
+  auto const base          = reinterpret_cast<uintptr_t>(get_column_data(input.column(0)));
+  auto const col_stride =
+    static_cast<int64_t>(reinterpret_cast<uintptr_t>(get_column_data(input.column(1))) - base);
+  CUDF_EXPECTS(col_stride >= num_rows * byte_width && col_stride % byte_width == 0,
+               "Columns are not uniformly strided in device memory");
+  for (size_type i = 2; i < num_cols; ++i) {
+    CUDF_EXPECTS(reinterpret_cast<uintptr_t>(get_column_data(input.column(i))) ==
+                   base + static_cast<uintptr_t>(i * col_stride),
+                 "Columns are not uniformly strided in device memory");
+  }
+
+  auto managed_tensor = std::make_unique<DLManagedTensor>();
+  auto context        = std::make_unique<dltensor_context>();
+
+  DLTensor& tensor  = managed_tensor->dl_tensor;
+  tensor.dtype      = dltype;
+  tensor.ndim       = 2;
+  tensor.shape      = context->shape;
+  tensor.shape[0]   = num_rows;
+  tensor.shape[1]   = num_cols;
+  tensor.strides    = context->strides;
+  tensor.strides[0] = 1;
+  tensor.strides[1] = col_stride / byte_width;
+
+  CUDA_TRY(cudaGetDevice(&tensor.device.device_id));
+  tensor.device.device_type = kDLCUDA;
+
+  // As with the column overload, the tensor shares the table's device memory
+  // and the caller must keep the table alive for the lifetime of the tensor
+  tensor.data = reinterpret_cast<void*>(base);
+
+  managed_tensor->deleter     = dltensor_context::deleter;
+  managed_tensor->manager_ctx = context.release();
+
+  return managed_tensor.release();
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
@@ -287,4 +382,14 @@ DLManagedTensor* to_dlpack(table_view const& input, rmm::mr::device_memory_resou
   return detail::to_dlpack(input, rmm::cuda_stream_default, mr);
 }
 
+DLManagedTensor* to_dlpack_view(column_view const& input)
+{
+  return detail::to_dlpack_view(input);
+}
+
+DLManagedTensor* to_dlpack_view(table_view const& input)
+{
+  return detail::to_dlpack_view(input);
+}
+
 }  // namespace cudf
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/interop.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/interop.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+column_view make_device_column_view(arrow::Array const& array)
+{
+  auto const type   = arrow_to_cudf_type(*array.type());
+  auto const length = static_cast<size_type>(array.length());
+  if (length == 0) { return column_view{type, 0, nullptr}; }
+
+  auto const& data = *array.data();
+  // Avoid arrow::Array::null_count() here: it walks the validity bitmap on the
+  // host when the count is unknown, and these buffers live in device memory.
+  // Arrow's kUnknownNullCount and cudf::UNKNOWN_NULL_COUNT are both -1, so the
+  // value passes through unchanged.
+  auto const null_count = static_cast<size_type>(static_cast<int64_t>(data.null_count));
+  auto const null_mask  = reinterpret_cast<bitmask_type const*>(
+    data.buffers[0] != nullptr ? data.buffers[0]->data() : nullptr);
+
+  if (type.id() == type_id::STRING) {
+    CUDF_EXPECTS(array.offset() == 0,
+                 "String arrays with a non-zero offset cannot be shared without conversion");
+    CUDF_EXPECTS(data.buffers.size() > 2 and data.buffers[1] != nullptr and
+                   data.buffers[2] != nullptr,
+                 "String array is missing its offsets or data buffer");
+    column_view offsets{
+      data_type{type_id::INT32}, length + 1, data.buffers[1]->data()};
+    column_view chars{data_type{type_id::INT8},
+                      static_cast<size_type>(data.buffers[2]->size()),
+                      data.buffers[2]->data()};
+    return column_view{
+      data_type{type_id::STRING}, length, nullptr, null_mask, null_count, 0, {offsets, chars}};
+  }
+
+  // BOOL8 cannot be shared because arrow represents booleans as packed bits, and
+  // fixed-point cannot be shared because arrow decimals are 128-bit
+  CUDF_EXPECTS(type.id() != type_id::BOOL8, "BOOL8 columns cannot be shared without conversion");
+  CUDF_EXPECTS(cudf::is_fixed_width(type) and not cudf::is_fixed_point(type),
+               "Only fixed-width and string types can be shared without conversion");
+  CUDF_EXPECTS(data.buffers.size() > 1 and data.buffers[1] != nullptr,
+               "Array is missing its data buffer");
+
+  return column_view{type,
+                     length,
+                     data.buffers[1]->data(),
+                     null_mask,
+                     null_count,
+                     static_cast<size_type>(array.offset())};
+}
+
+}  // namespace
+
+table_view from_arrow_device(arrow::Table const& input_table)
+{
+  std::vector<column_view> columns;
+  columns.reserve(input_table.num_columns());
+  for (auto const& chunked_array : input_table.columns()) {
+    CUDF_EXPECTS(chunked_array->num_chunks() == 1,
+                 "Only single-chunk arrow columns can be shared without conversion");
+    columns.push_back(make_device_column_view(*chunked_array->chunk(0)));
+  }
+  return table_view{columns};
+}
+
+}  // namespace detail
+
+table_view from_arrow_device(arrow::Table const& input_table)
+{
+  CUDF_FUNC_RANGE();
+
+  return detail::from_arrow_device(input_table);
+}
+
+}  // namespace cudf
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/interop.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/interop.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief An arrow Buffer that wraps device memory owned by a cudf table.
+ *
+ * The buffer shares ownership of the table so the device memory stays valid for
+ * as long as any arrow consumer holds a reference to it, mirroring how the
+ * allocations from `arrow_allocator` are tied to the arrow memory pool.
+ */
+class device_table_buffer : public arrow::Buffer {
+ public:
+  device_table_buffer(uint8_t const* data, int64_t size, std::shared_ptr<cudf::table> owner)
+    : arrow::Buffer(data, size), _owner(std::move(owner))
+  {
+  }
+
+ private:
+  std::shared_ptr<cudf::table> _owner;
+};
+
+std::shared_ptr<arrow::Buffer> wrap_device_buffer(void const* data,
+                                                  int64_t size,
+                                                  std::shared_ptr<cudf::table> const& owner)
+{
+  if (data == nullptr) { return nullptr; }
+  return std::make_shared<device_table_buffer>(static_cast<uint8_t const*>(data), size, owner);
+}
+
+std::shared_ptr<arrow::Buffer> wrap_mask_buffer(column_view view,
+                                                std::shared_ptr<cudf::table> const& owner)
+{
+  if (not view.nullable()) { return nullptr; }
+  auto const mask_size = cudf::bitmask_allocation_size_bytes(view.offset() + view.size());
+  return wrap_device_buffer(view.null_mask(), static_cast<int64_t>(mask_size), owner);
+}
+
+std::shared_ptr<arrow::Array> make_device_array(column_view view,
+                                                std::shared_ptr<cudf::table> const& owner)
+{
+  auto const id = view.type().id();
+  if (id == type_id::STRING) {
+    if (view.size() == 0 or view.num_children() == 0) {
+      // no device memory to share for an empty column
+      return std::make_shared<arrow::StringArray>(0, nullptr, nullptr);
+    }
+    auto const strings_view   = strings_column_view(view);
+    auto const offsets        = strings_view.offsets();
+    auto const chars          = strings_view.chars();
+    auto const offsets_buffer = wrap_device_buffer(
+      offsets.head<uint8_t>(), sizeof(int32_t) * static_cast<int64_t>(offsets.size()), owner);
+    auto const chars_buffer =
+      wrap_device_buffer(chars.head<uint8_t>(), static_cast<int64_t>(chars.size()), owner);
+    return std::make_shared<arrow::StringArray>(static_cast<int64_t>(view.size()),
+                                                offsets_buffer,
+                                                chars_buffer,
+                                                wrap_mask_buffer(view, owner),
+                                                static_cast<int64_t>(view.null_count()),
+                                                static_cast<int64_t>(view.offset()));
+  }
+
+  // BOOL8 cannot be shared because arrow represents booleans as packed bits, and
+  // fixed-point cannot be shared because arrow decimals are 128-bit. Repacking
+  // either of them would defeat the purpose of a zero-copy export.
+  CUDF_EXPECTS(id != type_id::BOOL8, "BOOL8 columns cannot be shared without conversion");
+  CUDF_EXPECTS(cudf::is_fixed_width(view.type()) and not cudf::is_fixed_point(view.type()),
+               "Only fixed-width and string types can be shared without conversion");
+
+  auto const data_size =
+    static_cast<int64_t>(cudf::size_of(view.type())) * (view.offset() + view.size());
+  auto const data_buffer = wrap_device_buffer(view.head<uint8_t>(), data_size, owner);
+  return to_arrow_array(id,
+                        static_cast<int64_t>(view.size()),
+                        data_buffer,
+                        wrap_mask_buffer(view, owner),
+                        static_cast<int64_t>(view.null_count()),
+                        static_cast<int64_t>(view.offset()));
+}
+
+}  // namespace
+
+std::shared_ptr<arrow::Table> to_arrow_device(std::shared_ptr<table> input,
+                                              std::vector<column_metadata> const& metadata)
+{
+  CUDF_EXPECTS(input != nullptr, "Input table must not be null");
+  auto const input_view = input->view();
+  CUDF_EXPECTS((metadata.size() == static_cast<std::size_t>(input_view.num_columns())),
+               "columns' metadata should be equal to number of columns in table");
+
+  std::vector<std::shared_ptr<arrow::Array>> arrays;
+  std::vector<std::shared_ptr<arrow::Field>> fields;
+
+  std::transform(input_view.begin(),
+                 input_view.end(),
+                 std::back_inserter(arrays),
+                 [&input](auto const& c) { return make_device_array(c, input); });
+
+  std::transform(
+    arrays.begin(),
+    arrays.end(),
+    metadata.begin(),
+    std::back_inserter(fields),
+    [](auto const& array, auto const& meta) { return arrow::field(meta.name, array->type()); });
+
+  return arrow::Table::Make(arrow::schema(fields), arrays);
+}
+
+}  // namespace detail
+
+std::shared_ptr<arrow::Table> to_arrow_device(std::shared_ptr<table> input,
+                                              std::vector<column_metadata> const& metadata)
+{
+  CUDF_FUNC_RANGE();
+
+  return detail::to_arrow_device(std::move(input), metadata);
+}
+
+}  // namespace cudf
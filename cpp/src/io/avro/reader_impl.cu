@@ -20,6 +20,7 @@
 #include <io/comp/gpuinflate.h>
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/pinned_pool.hpp>
 
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
@@ -28,6 +29,7 @@
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 #include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -146,8 +148,7 @@ class metadata : public file_metadata {
   datasource* const source;
 };
 
-rmm::device_buffer decompress_data(datasource& source,
-                                   metadata& meta,
+rmm::device_buffer decompress_data(metadata& meta,
                                    rmm::device_buffer const& comp_block_data,
                                    rmm::cuda_stream_view stream)
 {
@@ -164,10 +165,23 @@ rmm::device_buffer decompress_data(datasource& source,
       inflate_in[i].dstSize = initial_blk_len;
     }
   } else if (meta.codec == "snappy") {
-    // Extract the uncompressed length from the snappy stream
-    for (size_t i = 0; i < meta.block_list.size(); i++) {
-      auto const buffer  = source.host_read(meta.block_list[i].offset, 4);
-      uint8_t const* blk = buffer->data();
+    // Extract the uncompressed length prefix of each snappy stream. The prefixes are gathered
+    // from the device data in one batch of async copies instead of a scattered 4-byte source
+    // read per block
+    auto const num_blocks  = meta.block_list.size();
+    auto const comp_base   = static_cast<uint8_t const*>(comp_block_data.data());
+    auto const base_offset = meta.block_list[0].offset;
+    pinned_buffer blk_len_prefixes(num_blocks * 4, stream);
+    for (size_t i = 0; i < num_blocks; i++) {
+      CUDA_TRY(cudaMemcpyAsync(blk_len_prefixes.data() + i * 4,
+                               comp_base + meta.block_list[i].offset - base_offset,
+                               4,
+                               cudaMemcpyDeviceToHost,
+                               stream.value()));
+    }
+    stream.synchronize();
+    for (size_t i = 0; i < num_blocks; i++) {
+      uint8_t const* blk = blk_len_prefixes.data() + i * 4;
       uint32_t blk_len   = blk[0];
       if (blk_len > 0x7f) {
         blk_len = (blk_len & 0x7f) | (blk[1] << 7);
@@ -183,7 +197,8 @@ rmm::device_buffer decompress_data(datasource& source,
     CUDF_FAIL("Unsupported compression codec\n");
   }
 
-  rmm::device_buffer decomp_block_data(uncompressed_data_size, stream);
+  // Short-lived decompression scratch goes through the temporary resource
+  rmm::device_buffer decomp_block_data(uncompressed_data_size, stream, get_temp_memory_resource());
 
   auto const base_offset = meta.block_list[0].offset;
   for (size_t i = 0, dst_pos = 0; i < meta.block_list.size(); i++) {
@@ -399,12 +414,18 @@ table_with_metadata read_avro(std::unique_ptr<cudf::io::datasource>&& source,
                                               stream);
         block_data.resize(read_bytes, stream);
       } else {
-        auto const buffer = source->host_read(meta.block_list[0].offset, meta.total_data_size);
-        block_data        = rmm::device_buffer{buffer->data(), buffer->size(), stream};
+        // Stage through pooled pinned memory so host_read writes straight into the staging buffer
+        block_data = rmm::device_buffer{meta.total_data_size, stream};
+        pinned_buffer staging(meta.total_data_size, stream);
+        auto const bytes_read =
+          source->host_read(meta.block_list[0].offset, meta.total_data_size, staging.data());
+        CUDA_TRY(cudaMemcpyAsync(
+          block_data.data(), staging.data(), bytes_read, cudaMemcpyHostToDevice, stream.value()));
+        block_data.resize(bytes_read, stream);
       }
 
       if (meta.codec != "" && meta.codec != "null") {
-        auto decomp_block_data = decompress_data(*source, meta, block_data, stream);
+        auto decomp_block_data = decompress_data(meta, block_data, stream);
         block_data             = std::move(decomp_block_data);
       } else {
         auto dst_ofs = meta.block_list[0].offset;
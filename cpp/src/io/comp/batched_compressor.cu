@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "batched_compressor.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform.h>
+
+#include <nvcomp/snappy.h>
+
+#include <cstdlib>
+
+namespace cudf {
+namespace io {
+
+namespace {
+
+template <typename T>
+device_span<T> grow_scratch(rmm::device_uvector<T>& scratch,
+                            size_t num_elements,
+                            rmm::cuda_stream_view stream)
+{
+  if (scratch.size() < num_elements) { scratch.resize(num_elements, stream); }
+  return {scratch.data(), num_elements};
+}
+
+bool nvcomp_is_enabled()
+{
+  auto env_use_nvcomp = std::getenv("LIBCUDF_USE_NVCOMP");
+  return env_use_nvcomp != nullptr ? std::atoi(env_use_nvcomp) : false;
+}
+
+}  // namespace
+
+device_span<gpu_inflate_input_s> batched_compressor::get_inputs(size_t num_chunks,
+                                                                rmm::cuda_stream_view stream)
+{
+  return grow_scratch(inputs_, num_chunks, stream);
+}
+
+device_span<gpu_inflate_status_s> batched_compressor::get_statuses(size_t num_chunks,
+                                                                   rmm::cuda_stream_view stream)
+{
+  return grow_scratch(statuses_, num_chunks, stream);
+}
+
+void batched_compressor::compress(device_span<gpu_inflate_input_s> inputs,
+                                  device_span<gpu_inflate_status_s> statuses,
+                                  size_t max_uncomp_chunk_size,
+                                  rmm::cuda_stream_view stream)
+{
+  auto const num_chunks = inputs.size();
+  if (num_chunks == 0 or compression_ != compression_type::SNAPPY) { return; }
+
+  if (not nvcomp_is_enabled()) {
+    CUDA_TRY(gpu_snap(inputs.data(), statuses.data(), static_cast<int>(num_chunks), stream));
+    return;
+  }
+
+  try {
+    size_t temp_size;
+    nvcompStatus_t nvcomp_status = nvcompBatchedSnappyCompressGetTempSize(
+      num_chunks, max_uncomp_chunk_size, nvcompBatchedSnappyDefaultOpts, &temp_size);
+
+    CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
+                 "Error in getting snappy compression scratch size");
+
+    // Not needed now but nvcomp API makes no promises about future
+    if (nvcomp_scratch_.size() < temp_size) { nvcomp_scratch_.resize(temp_size, stream); }
+    // Analogous to inputs.srcDevice
+    auto uncompressed_data_ptrs = grow_scratch(uncomp_data_ptrs_, num_chunks, stream);
+    // Analogous to inputs.srcSize
+    auto uncompressed_data_sizes = grow_scratch(uncomp_data_sizes_, num_chunks, stream);
+    // Analogous to inputs.dstDevice
+    auto compressed_data_ptrs = grow_scratch(comp_data_ptrs_, num_chunks, stream);
+    // Analogous to statuses.bytes_written
+    auto compressed_bytes_written = grow_scratch(comp_bytes_written_, num_chunks, stream);
+    // nvcomp does not currently use inputs.dstSize. Cannot assume that the output will fit in
+    // the space allocated unless one uses the API nvcompBatchedSnappyCompressGetOutputSize()
+
+    // Prepare the vectors
+    auto comp_it = thrust::make_zip_iterator(uncompressed_data_ptrs.begin(),
+                                             uncompressed_data_sizes.begin(),
+                                             compressed_data_ptrs.begin());
+    thrust::transform(rmm::exec_policy(stream),
+                      inputs.begin(),
+                      inputs.end(),
+                      comp_it,
+                      [] __device__(gpu_inflate_input_s in) {
+                        return thrust::make_tuple(in.srcDevice, in.srcSize, in.dstDevice);
+                      });
+    nvcomp_status = nvcompBatchedSnappyCompressAsync(uncompressed_data_ptrs.data(),
+                                                     uncompressed_data_sizes.data(),
+                                                     max_uncomp_chunk_size,
+                                                     num_chunks,
+                                                     nvcomp_scratch_.data(),
+                                                     nvcomp_scratch_.size(),
+                                                     compressed_data_ptrs.data(),
+                                                     compressed_bytes_written.data(),
+                                                     nvcompBatchedSnappyDefaultOpts,
+                                                     stream.value());
+
+    CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess, "Error in snappy compression");
+
+    // nvcomp also doesn't use the status fields other than `bytes_written`. It guarantees that
+    // given enough output space, compression will succeed.
+    thrust::transform(rmm::exec_policy(stream),
+                      compressed_bytes_written.begin(),
+                      compressed_bytes_written.end(),
+                      statuses.begin(),
+                      [] __device__(size_t size) {
+                        gpu_inflate_status_s status{};
+                        status.bytes_written = size;
+                        return status;
+                      });
+  } catch (...) {
+    // If we reach this then there was an error in compressing so set an error status for each
+    // chunk
+    thrust::for_each(rmm::exec_policy(stream),
+                     statuses.begin(),
+                     statuses.end(),
+                     [] __device__(gpu_inflate_status_s & stat) { stat.status = 1; });
+  }
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "gpuinflate.h"
+
+#include <cudf/io/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Batched device compression with reusable scratch memory.
+ *
+ * Owns the chunk descriptor arrays and the codec scratch space, growing them on demand and reusing
+ * them across calls, so that writers do not reallocate compression temporaries for every batch or
+ * table write. Codec selection happens once, at construction; additional device codecs plug into
+ * the dispatch in `compress`.
+ */
+class batched_compressor {
+ public:
+  batched_compressor() = default;
+
+  /**
+   * @brief Constructs a compressor for the given codec.
+   *
+   * @param compression Codec to use for all subsequent `compress` calls
+   */
+  explicit batched_compressor(compression_type compression) : compression_(compression) {}
+
+  // Scratch buffers cannot be shared
+  batched_compressor(batched_compressor const&) = delete;
+  batched_compressor& operator=(batched_compressor const&) = delete;
+
+  /**
+   * @brief Returns the input descriptor array for a batch of `num_chunks` chunks.
+   *
+   * The returned span is backed by memory owned by this object; it is only valid until the next
+   * `get_inputs` call.
+   *
+   * @param num_chunks Number of chunks in the batch
+   * @param stream CUDA stream used for device memory operations
+   */
+  device_span<gpu_inflate_input_s> get_inputs(size_t num_chunks, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns the status array for a batch of `num_chunks` chunks.
+   *
+   * The returned span is backed by memory owned by this object; it is only valid until the next
+   * `get_statuses` call.
+   *
+   * @param num_chunks Number of chunks in the batch
+   * @param stream CUDA stream used for device memory operations
+   */
+  device_span<gpu_inflate_status_s> get_statuses(size_t num_chunks, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Compresses a batch of independent chunks.
+   *
+   * Chunks whose codec has no device implementation are left uncompressed, with the corresponding
+   * statuses untouched; callers detect this through the per-chunk status the same way they detect
+   * incompressible chunks.
+   *
+   * @param inputs Chunk source/destination descriptors
+   * @param statuses Per-chunk compression results
+   * @param max_uncomp_chunk_size Size of the largest uncompressed chunk in the batch
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void compress(device_span<gpu_inflate_input_s> inputs,
+                device_span<gpu_inflate_status_s> statuses,
+                size_t max_uncomp_chunk_size,
+                rmm::cuda_stream_view stream);
+
+ private:
+  compression_type compression_ = compression_type::NONE;
+
+  rmm::device_uvector<gpu_inflate_input_s> inputs_{0, rmm::cuda_stream_default};
+  rmm::device_uvector<gpu_inflate_status_s> statuses_{0, rmm::cuda_stream_default};
+
+  // nvcomp scratch; only allocated when the nvcomp code path is enabled
+  rmm::device_buffer nvcomp_scratch_;
+  rmm::device_uvector<void const*> uncomp_data_ptrs_{0, rmm::cuda_stream_default};
+  rmm::device_uvector<size_t> uncomp_data_sizes_{0, rmm::cuda_stream_default};
+  rmm::device_uvector<void*> comp_data_ptrs_{0, rmm::cuda_stream_default};
+  rmm::device_uvector<size_t> comp_bytes_written_{0, rmm::cuda_stream_default};
+};
+
+}  // namespace io
+}  // namespace cudf
@@ -635,6 +635,94 @@ __global__ void __launch_bounds__(csvparse_block_dim)
   }
 }
 
+/**
+ * @brief CUDA kernel that parses and converts CSV data where all columns share one output type.
+ *
+ * The output type is a template parameter, so the per-field runtime type dispatch of
+ * `convert_csv_to_cudf` is resolved at compile time and the hot parse loop is branch-free.
+ *
+ * @tparam T The output type shared by all enabled columns
+ * @param[in] options A set of parsing options
+ * @param[in] data The entire CSV data to read
+ * @param[in] column_flags Per-column parsing behavior flags
+ * @param[in] row_offsets The start the CSV data of interest
+ * @param[in] dtype The data type of all the columns
+ * @param[out] columns The output column data
+ * @param[out] valids The bitmaps indicating whether column fields are valid
+ */
+template <typename T>
+__global__ void __launch_bounds__(csvparse_block_dim)
+  convert_csv_to_cudf_uniform(cudf::io::parse_options_view options,
+                              device_span<char const> data,
+                              device_span<column_parse::flags const> column_flags,
+                              device_span<uint64_t const> row_offsets,
+                              cudf::data_type dtype,
+                              device_span<void* const> columns,
+                              device_span<cudf::bitmask_type* const> valids)
+{
+  constexpr bool is_string_column = std::is_same_v<T, cudf::string_view>;
+
+  auto const raw_csv     = data.data();
+  long const rec_id      = threadIdx.x + (blockDim.x * blockIdx.x);
+  long const rec_id_next = rec_id + 1;
+  if (rec_id_next >= row_offsets.size()) return;
+
+  auto field_start   = raw_csv + row_offsets[rec_id];
+  auto const row_end = raw_csv + row_offsets[rec_id_next];
+
+  auto next_field = field_start;
+  int col         = 0;
+  int actual_col  = 0;
+
+  while (col < column_flags.size() && field_start < row_end) {
+    auto next_delimiter = cudf::io::gpu::seek_field_end(next_field, row_end, options);
+
+    if (column_flags[col] & column_parse::enabled) {
+      // check if the entire field is a NaN string - consistent with pandas
+      auto const is_valid = !serialized_trie_contains(
+        options.trie_na, {field_start, static_cast<size_t>(next_delimiter - field_start)});
+
+      if constexpr (is_string_column) {
+        auto str_list = static_cast<std::pair<const char*, size_t>*>(columns[actual_col]);
+        if (is_valid) {
+          auto end = next_delimiter;
+          if (options.keepquotes == false) {
+            if ((*field_start == options.quotechar) && (*(end - 1) == options.quotechar)) {
+              ++field_start;
+              --end;
+            }
+          }
+          str_list[rec_id].first  = field_start;
+          str_list[rec_id].second = end - field_start;
+        } else {
+          str_list[rec_id].first  = nullptr;
+          str_list[rec_id].second = 0;
+        }
+      } else {
+        if (is_valid) {
+          // Modify field_start & end to ignore whitespace and quotechars
+          auto const trimmed_field =
+            trim_whitespaces_quotes(field_start, next_delimiter, options.quotechar);
+          if (decode_op{}.template operator()<T>(columns[actual_col],
+                                                 rec_id,
+                                                 dtype,
+                                                 trimmed_field.first,
+                                                 trimmed_field.second,
+                                                 options,
+                                                 column_flags[col])) {
+            // set the valid bitmap - all bits were set to 0 to start
+            set_bit(valids[actual_col], rec_id);
+          }
+        }
+      }
+      ++actual_col;
+    }
+    next_field  = next_delimiter + 1;
+    field_start = next_field;
+    ++col;
+  }
+}
+
 /*
  * @brief Merge two packed row contexts (each corresponding to a block of characters)
  * and return the packed row context corresponding to the merged character block
@@ -1071,6 +1159,54 @@ void __host__ decode_row_column_data(cudf::io::parse_options_view const& options
     options, data, column_flags, row_offsets, dtypes, columns, valids);
 }
 
+namespace {
+
+/**
+ * @brief Functor that launches the type-specialized decode kernel.
+ */
+struct uniform_decode_launcher {
+  template <typename T>
+  void operator()(cudf::io::parse_options_view const& options,
+                  device_span<char const> data,
+                  device_span<column_parse::flags const> column_flags,
+                  device_span<uint64_t const> row_offsets,
+                  cudf::data_type dtype,
+                  device_span<void* const> columns,
+                  device_span<cudf::bitmask_type* const> valids,
+                  rmm::cuda_stream_view stream)
+  {
+    auto const block_size = csvparse_block_dim;
+    auto const num_rows   = row_offsets.size() - 1;
+    auto const grid_size  = (num_rows + block_size - 1) / block_size;
+
+    convert_csv_to_cudf_uniform<T><<<grid_size, block_size, 0, stream.value()>>>(
+      options, data, column_flags, row_offsets, dtype, columns, valids);
+  }
+};
+
+}  // namespace
+
+void __host__ decode_row_column_data(cudf::io::parse_options_view const& options,
+                                     device_span<char const> data,
+                                     device_span<column_parse::flags const> column_flags,
+                                     device_span<uint64_t const> row_offsets,
+                                     cudf::data_type dtype,
+                                     device_span<void* const> columns,
+                                     device_span<cudf::bitmask_type* const> valids,
+                                     rmm::cuda_stream_view stream)
+{
+  cudf::type_dispatcher(dtype,
+                        uniform_decode_launcher{},
+                        options,
+                        data,
+                        column_flags,
+                        row_offsets,
+                        dtype,
+                        columns,
+                        valids,
+                        stream);
+}
+
 uint32_t __host__ gather_row_offsets(const parse_options_view& options,
                                      uint64_t* row_ctx,
                                      device_span<uint64_t> const offsets_out,
@@ -228,6 +228,30 @@ void decode_row_column_data(cudf::io::parse_options_view const& options,
                             device_span<cudf::bitmask_type* const> valids,
                             rmm::cuda_stream_view stream);
 
+/**
+ * @brief Launches kernel for decoding row-column data where all columns share one output type
+ *
+ * The kernel is specialized for the output type at launch, so the hot parse loop avoids the
+ * per-field runtime type dispatch of the mixed-type kernel.
+ *
+ * @param[in] options Options that control individual field data conversion
+ * @param[in] data The row-column data
+ * @param[in] column_flags Flags that control individual column parsing
+ * @param[in] row_offsets List of row data start positions (offsets)
+ * @param[in] dtype The dtype shared by all enabled columns
+ * @param[out] columns Device memory output of column data
+ * @param[out] valids Device memory output of column valids bitmap data
+ * @param[in] stream CUDA stream to use, default 0
+ */
+void decode_row_column_data(cudf::io::parse_options_view const& options,
+                            device_span<char const> data,
+                            device_span<column_parse::flags const> column_flags,
+                            device_span<uint64_t const> row_offsets,
+                            cudf::data_type dtype,
+                            device_span<void* const> columns,
+                            device_span<cudf::bitmask_type* const> valids,
+                            rmm::cuda_stream_view stream);
+
 }  // namespace gpu
 }  // namespace csv
 }  // namespace io
@@ -36,6 +36,7 @@
 #include <rmm/cuda_stream_view.hpp>
 
 #include <algorithm>
+#include <functional>
 #include <iostream>
 #include <numeric>
 #include <tuple>
@@ -275,6 +276,75 @@ table_with_metadata reader::impl::read(rmm::cuda_stream_view stream)
   // Exclude the end-of-data row from number of rows with actual data
   num_records_ = std::max(row_offsets.size(), 1ul) - 1;
 
+  setup_column_info();
+
+  // Return empty table rather than exception if nothing to load
+  if (num_active_cols_ == 0) { return {std::make_unique<table>(), {}}; }
+
+  bool has_to_infer_column_types =
+    std::visit([](const auto& dtypes) { return dtypes.empty(); }, opts_.get_dtypes());
+
+  std::vector<data_type> column_types;
+  if (has_to_infer_column_types) {
+    column_types = infer_column_types(data, row_offsets, stream);
+  } else {
+    column_types = std::visit([&](auto const& data_types) { return select_data_types(data_types); },
+                              opts_.get_dtypes());
+  }
+
+  return make_output_table(data, row_offsets, column_types, stream);
+}
+
+void reader::impl::init_chunking(size_type rows_per_chunk, rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(rows_per_chunk > 0, "Invalid number of rows per chunk");
+  rows_per_chunk_ = rows_per_chunk;
+
+  // Load and tokenize the input once; chunks reuse the cached device data, the row-offset index
+  // and the column types
+  auto data_row_offsets = select_data_and_row_offsets(stream);
+  chunk_data_           = std::move(data_row_offsets.first);
+  chunk_row_offsets_    = std::move(data_row_offsets.second);
+
+  // Exclude the end-of-data row from number of rows with actual data
+  num_records_ = std::max(chunk_row_offsets_->size(), 1ul) - 1;
+
+  setup_column_info();
+  if (num_active_cols_ == 0) { return; }
+  chunk_num_records_ = num_records_;
+
+  bool has_to_infer_column_types =
+    std::visit([](const auto& dtypes) { return dtypes.empty(); }, opts_.get_dtypes());
+
+  if (has_to_infer_column_types) {
+    chunk_column_types_ = infer_column_types(*chunk_data_, *chunk_row_offsets_, stream);
+  } else {
+    chunk_column_types_ = std::visit(
+      [&](auto const& data_types) { return select_data_types(data_types); }, opts_.get_dtypes());
+  }
+}
+
+table_with_metadata reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  // Return empty table rather than exception if nothing to load
+  if (num_active_cols_ == 0) { return {std::make_unique<table>(), {}}; }
+
+  auto const num_rows = std::min<size_t>(rows_per_chunk_, chunk_num_records_ - next_row_);
+  // `decode_data` and `make_output_table` size the output from the number of rows with actual data
+  num_records_ = num_rows;
+
+  // A row is the data between two adjacent offsets, so a chunk needs one offset past its last row
+  auto const row_offsets =
+    (num_rows != 0)
+      ? device_span<uint64_t const>{chunk_row_offsets_->data() + next_row_, num_rows + 1}
+      : device_span<uint64_t const>{};
+  next_row_ += num_rows;
+
+  return make_output_table(*chunk_data_, row_offsets, chunk_column_types_, stream);
+}
+
+void reader::impl::setup_column_info()
+{
   // Check if the user gave us a list of column names
   if (not opts_.get_names().empty()) {
     column_flags_.resize(opts_.get_names().size(), column_parse::enabled);
@@ -368,24 +438,16 @@ table_with_metadata reader::impl::read(rmm::cuda_stream_view stream)
       }
     }
   }
+}
 
-  // Return empty table rather than exception if nothing to load
-  if (num_active_cols_ == 0) { return {std::make_unique<table>(), {}}; }
-
+table_with_metadata reader::impl::make_output_table(device_span<char const> data,
+                                                    device_span<uint64_t const> row_offsets,
+                                                    host_span<data_type const> column_types,
+                                                    rmm::cuda_stream_view stream)
+{
   auto metadata    = table_metadata{};
   auto out_columns = std::vector<std::unique_ptr<cudf::column>>();
 
-  bool has_to_infer_column_types =
-    std::visit([](const auto& dtypes) { return dtypes.empty(); }, opts_.get_dtypes());
-
-  std::vector<data_type> column_types;
-  if (has_to_infer_column_types) {
-    column_types = infer_column_types(data, row_offsets, stream);
-  } else {
-    column_types = std::visit([&](auto const& data_types) { return select_data_types(data_types); },
-                              opts_.get_dtypes());
-  }
-
   out_columns.reserve(column_types.size());
 
   if (num_records_ != 0) {
@@ -606,13 +668,57 @@ std::vector<data_type> reader::impl::infer_column_types(device_span<char const>
   if (num_records_ == 0) {
     dtypes.resize(num_active_cols_, data_type{type_id::EMPTY});
   } else {
-    auto column_stats =
-      cudf::io::csv::gpu::detect_column_types(opts.view(),
-                                              data,
-                                              make_device_uvector_async(column_flags_, stream),
-                                              row_offsets,
-                                              num_active_cols_,
-                                              stream);
+    auto const d_column_flags = make_device_uvector_async(column_flags_, stream);
+
+    std::vector<column_type_histogram> column_stats;
+    // Number of rows the histograms were built from; used for the all-null check below
+    auto inference_rows = static_cast<size_t>(num_records_);
+
+    auto const num_inference_rows = opts_.get_num_inference_rows();
+    if (num_inference_rows < 0 || static_cast<size_t>(num_inference_rows) >= inference_rows) {
+      column_stats = cudf::io::csv::gpu::detect_column_types(
+        opts.view(), data, d_column_flags, row_offsets, num_active_cols_, stream);
+    } else {
+      // Sample the requested number of rows as contiguous blocks spread evenly across the input;
+      // rows within a block must stay contiguous since a row is only bounded by two adjacent
+      // entries of `row_offsets`. The per-block histograms are summed, so a type mix across
+      // blocks resolves the same way it would within the full pass
+      constexpr size_t max_inference_blocks = 16;
+
+      auto const sample_rows = static_cast<size_t>(num_inference_rows);
+      auto const num_blocks =
+        std::min(max_inference_blocks, std::max<size_t>(sample_rows / 1024, 1));
+      auto const rows_per_block = (sample_rows + num_blocks - 1) / num_blocks;
+
+      column_stats.resize(num_active_cols_);
+      size_t rows_sampled = 0;
+      size_t next_start   = 0;
+      for (size_t i = 0; i < num_blocks && rows_sampled < sample_rows; ++i) {
+        auto const block_rows = std::min(rows_per_block, sample_rows - rows_sampled);
+        // Not enough unsampled rows left for another whole block
+        if (next_start + block_rows > static_cast<size_t>(num_records_)) break;
+        auto const spaced_start =
+          (num_blocks == 1) ? size_t{0}
+                            : i * (num_records_ - block_rows) / (num_blocks - 1);
+        auto const start = std::max(spaced_start, next_start);
+
+        auto const block_stats =
+          cudf::io::csv::gpu::detect_column_types(opts.view(),
+                                                  data,
+                                                  d_column_flags,
+                                                  row_offsets.subspan(start, block_rows + 1),
+                                                  num_active_cols_,
+                                                  stream);
+        std::transform(column_stats.begin(),
+                       column_stats.end(),
+                       block_stats.begin(),
+                       column_stats.begin(),
+                       std::plus<>{});
+        rows_sampled += block_rows;
+        next_start = start + block_rows;
+      }
+      inference_rows = rows_sampled;
+    }
 
     stream.synchronize();
 
@@ -621,7 +727,7 @@ std::vector<data_type> reader::impl::infer_column_types(device_span<char const>
                                            column_stats[col].negative_small_int_count +
                                            column_stats[col].positive_small_int_count;
 
-      if (column_stats[col].null_count == num_records_) {
+      if (static_cast<size_t>(column_stats[col].null_count) == inference_rows) {
         // Entire column is NULL; allocate the smallest amount of memory
         dtypes.emplace_back(cudf::type_id::INT8);
       } else if (column_stats[col].string_count > 0L) {
@@ -697,14 +803,31 @@ std::vector<column_buffer> reader::impl::decode_data(device_span<char const> dat
     h_valid[i] = out_buffers[i].null_mask();
   }
 
-  cudf::io::csv::gpu::decode_row_column_data(opts.view(),
-                                             data,
-                                             make_device_uvector_async(column_flags_, stream),
-                                             row_offsets,
-                                             make_device_uvector_async(column_types, stream),
-                                             make_device_uvector_async(h_data, stream),
-                                             make_device_uvector_async(h_valid, stream),
-                                             stream);
+  auto const is_uniform_type =
+    not column_types.empty() and
+    std::all_of(column_types.begin(), column_types.end(), [&](auto const& type) {
+      return type == column_types.front();
+    });
+  if (is_uniform_type) {
+    // All columns share one output type; the specialized kernel skips the per-field type dispatch
+    cudf::io::csv::gpu::decode_row_column_data(opts.view(),
+                                               data,
+                                               make_device_uvector_async(column_flags_, stream),
+                                               row_offsets,
+                                               column_types.front(),
+                                               make_device_uvector_async(h_data, stream),
+                                               make_device_uvector_async(h_valid, stream),
+                                               stream);
+  } else {
+    cudf::io::csv::gpu::decode_row_column_data(opts.view(),
+                                               data,
+                                               make_device_uvector_async(column_flags_, stream),
+                                               row_offsets,
+                                               make_device_uvector_async(column_types, stream),
+                                               make_device_uvector_async(h_data, stream),
+                                               make_device_uvector_async(h_valid, stream),
+                                               stream);
+  }
 
   return out_buffers;
 }
@@ -835,6 +958,25 @@ reader::~reader() = default;
 // Forward to implementation
 table_with_metadata reader::read(rmm::cuda_stream_view stream) { return _impl->read(stream); }
 
+chunked_reader::chunked_reader(size_type rows_per_chunk,
+                               std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                               csv_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+  : reader(std::move(sources), options, stream, mr)
+{
+  _impl->init_chunking(rows_per_chunk, stream);
+}
+
+chunked_reader::~chunked_reader() = default;
+
+bool chunked_reader::has_next() const { return _impl->has_next_chunk(); }
+
+table_with_metadata chunked_reader::read_chunk() const
+{
+  return _impl->read_chunk(rmm::cuda_stream_default);
+}
+
 }  // namespace csv
 }  // namespace detail
 }  // namespace io
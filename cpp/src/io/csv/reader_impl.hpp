@@ -31,6 +31,7 @@
 #include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -90,6 +91,31 @@ class reader::impl {
    */
   table_with_metadata read(rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Load and tokenize the input once to set up iterative reading.
+   *
+   * The selected data is kept on the GPU along with the gathered row offsets and the column
+   * types; subsequent `read_chunk()` calls only repeat the row-to-column conversion.
+   *
+   * @param rows_per_chunk Number of rows to return per read
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void init_chunking(size_type rows_per_chunk, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Check if there are rows that have not yet been read.
+   */
+  bool has_next_chunk() const { return next_row_ < chunk_num_records_; }
+
+  /**
+   * @brief Read the next batch of rows and return it as a table.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
+
  private:
   /**
    * @brief Offsets of CSV rows in device memory, accessed through a shrinkable span.
@@ -208,6 +234,32 @@ class reader::impl {
                                          host_span<data_type const> column_types,
                                          rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Sets up the column names, parsing flags and the number of active columns.
+   *
+   * Uses the column names from the options when given, the parsed header otherwise. Applies the
+   * column selection and the per-column parsing options (dates, hexadecimals).
+   */
+  void setup_column_info();
+
+  /**
+   * @brief Decodes the given rows and assembles them into a table.
+   *
+   * Expects `num_records_` to hold the number of rows to decode; returns a table of empty columns
+   * when it is zero.
+   *
+   * @param data Device buffer with the CSV data
+   * @param row_offsets Offsets of the rows to decode, including the end-of-data offset
+   * @param column_types Column types
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata make_output_table(device_span<char const> data,
+                                        device_span<uint64_t const> row_offsets,
+                                        host_span<data_type const> column_types,
+                                        rmm::cuda_stream_view stream);
+
  private:
   rmm::mr::device_memory_resource* mr_ = nullptr;
   std::unique_ptr<datasource> source_;
@@ -224,6 +276,14 @@ class reader::impl {
   // Intermediate data
   std::vector<std::string> col_names_;
   std::vector<char> header_;
+
+  // State for iterative (chunked) reading; unused by the single-shot `read()` path
+  size_type rows_per_chunk_ = 0;
+  std::optional<rmm::device_uvector<char>> chunk_data_;
+  std::optional<selected_rows_offsets> chunk_row_offsets_;
+  std::vector<data_type> chunk_column_types_;
+  size_t chunk_num_records_ = 0;  // Number of data rows in the tokenized input
+  size_t next_row_          = 0;  // Index of the first row of the next chunk
 };
 
 }  // namespace csv
@@ -217,6 +217,52 @@ table_with_metadata read_csv(csv_reader_options options, rmm::mr::device_memory_
   return reader->read();
 }
 
+/**
+ * @copydoc cudf::io::chunked_csv_reader::chunked_csv_reader
+ */
+chunked_csv_reader::chunked_csv_reader(size_type rows_per_chunk,
+                                       csv_reader_options const& options,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  namespace csv = cudf::io::detail::csv;
+
+  auto chunk_options = options;
+  chunk_options.set_compression(
+    infer_compression_type(chunk_options.get_compression(), chunk_options.get_source()));
+
+  auto datasources = make_datasources(chunk_options.get_source(),
+                                      chunk_options.get_byte_range_offset(),
+                                      chunk_options.get_byte_range_size_with_padding());
+
+  reader = std::make_unique<csv::chunked_reader>(
+    rows_per_chunk, std::move(datasources), chunk_options, rmm::cuda_stream_default, mr);
+}
+
+/**
+ * @copydoc cudf::io::chunked_csv_reader::~chunked_csv_reader
+ */
+chunked_csv_reader::~chunked_csv_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_csv_reader::has_next
+ */
+bool chunked_csv_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_csv_reader::read_chunk
+ */
+table_with_metadata chunked_csv_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 // Freeform API wraps the detail writer class API
 void write_csv(csv_writer_options const& options, rmm::mr::device_memory_resource* mr)
 {
@@ -341,6 +387,45 @@ table_with_metadata read_orc(orc_reader_options const& options, rmm::mr::device_
   return reader->read(options);
 }
 
+/**
+ * @copydoc cudf::io::chunked_orc_reader::chunked_orc_reader
+ */
+chunked_orc_reader::chunked_orc_reader(size_type stripes_per_chunk,
+                                       orc_reader_options const& options,
+                                       rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<detail_orc::chunked_reader>(stripes_per_chunk,
+                                                        make_datasources(options.get_source()),
+                                                        options,
+                                                        rmm::cuda_stream_default,
+                                                        mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::~chunked_orc_reader
+ */
+chunked_orc_reader::~chunked_orc_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::has_next
+ */
+bool chunked_orc_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::read_chunk
+ */
+table_with_metadata chunked_orc_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 /**
  * @copydoc cudf::io::write_orc
  */
@@ -408,6 +493,45 @@ table_with_metadata read_parquet(parquet_reader_options const& options,
   return reader->read(options);
 }
 
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::chunked_parquet_reader
+ */
+chunked_parquet_reader::chunked_parquet_reader(std::size_t chunk_read_limit,
+                                               parquet_reader_options const& options,
+                                               rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<detail_parquet::chunked_reader>(chunk_read_limit,
+                                                            make_datasources(options.get_source()),
+                                                            options,
+                                                            rmm::cuda_stream_default,
+                                                            mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::~chunked_parquet_reader
+ */
+chunked_parquet_reader::~chunked_parquet_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::has_next
+ */
+bool chunked_parquet_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::read_chunk
+ */
+table_with_metadata chunked_parquet_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 /**
  * @copydoc cudf::io::merge_rowgroup_metadata
  */
@@ -400,6 +400,44 @@ __device__ __inline__ bool is_like_float(
   return true;
 }
 
+/**
+ * @brief Finds the end of a nested value that starts with an opening brace/bracket.
+ *
+ * Tracks the quotation and escape state so that brackets within string values are ignored.
+ *
+ * @param[in] begin Pointer to the opening character of the nested value ('{' or '[')
+ * @param[in] end Pointer to the first character after the parsing range
+ * @param[in] quotechar The character used to denote quotes
+ *
+ * @return Pointer to the first character after the matching closing bracket; `end` if the value
+ * is not terminated within the range
+ */
+__device__ char const* seek_nested_value_end(char const* begin, char const* end, char quotechar)
+{
+  auto const open  = *begin;
+  auto const close = (open == '{') ? '}' : ']';
+  int depth        = 0;
+  bool quotation   = false;
+  for (auto current = begin; current < end; ++current) {
+    if (*current == '\\') {
+      ++current;
+    } else if (*current == quotechar) {
+      quotation = !quotation;
+    } else if (!quotation) {
+      if (*current == open) {
+        ++depth;
+      } else if (*current == close && --depth == 0) {
+        return current + 1;
+      }
+    }
+  }
+  return end;
+}
+
+// Column index returned for fields whose key is not in the column map, when such fields are to be
+// skipped rather than matched to the column at the field's position
+constexpr cudf::size_type unmatched_field_sentinel = -1;
+
 /**
  * @brief Contains information on a JSON file field.
  */
@@ -407,48 +445,152 @@ struct field_descriptor {
   cudf::size_type column;
   char const* value_begin;
   char const* value_end;
+  // Key name range; both `nullptr` when the row contains anonymous (array) fields
+  char const* key_begin;
+  char const* key_end;
+  // Key name range of the enclosing object when the field comes from a flattened nested object;
+  // both `nullptr` for top-level fields
+  char const* parent_key_begin;
+  char const* parent_key_end;
+  // Hash of the full key path; zero for anonymous fields
+  uint32_t key_hash;
 };
 
 /**
- * @brief Parse the first field in the given range and return its descriptor.
+ * @brief Stateful parser that iterates over the fields of a single row.
  *
- * @param[in] begin Pointer to the first character in the parsing range
- * @param[in] end pointer to the first character after the parsing range
- * @param[in] opts The global parsing behavior options
- * @param[in] field_idx Index of the current field in the input row
- * @param[in] col_map Pointer to the (column name hash -> column index) map in device memory.
- * nullptr is passed when the input file does not consist of objects.
- * @return Descriptor of the parsed field
+ * When the flattening of nested objects is enabled and a field value is an object, the parser
+ * steps into it and returns its fields as if they were top-level fields. The column index of such
+ * fields is looked up with the hash of the combined "parent.child" key path. Only one level is
+ * flattened this way; values nested deeper are returned whole, including the enclosing brackets.
  */
-__device__ field_descriptor next_field_descriptor(const char* begin,
-                                                  const char* end,
-                                                  parse_options_view const& opts,
-                                                  cudf::size_type field_idx,
-                                                  col_map_type* col_map)
-{
-  auto const desc_pre_trim =
-    col_map == nullptr
+class json_row_parser {
+ public:
+  __device__ json_row_parser(char const* begin,
+                             char const* end,
+                             parse_options_view const& opts,
+                             bool are_rows_objects,
+                             col_map_type* col_map,
+                             bool flatten_nested_objects,
+                             bool skip_unmatched_fields = false)
+    : pos_(begin),
+      end_(end),
+      opts_(opts),
+      are_rows_objects_(are_rows_objects),
+      col_map_(col_map),
+      flatten_(flatten_nested_objects),
+      skip_unmatched_(skip_unmatched_fields)
+  {
+  }
+
+  __device__ bool has_next() const { return pos_ < end_; }
+
+  /**
+   * @brief Parse the next field and return its descriptor.
+   *
+   * @param[in] field_idx Index of the field in the input row; used as the column index when the
+   * column cannot be looked up by name
+   * @return Descriptor of the parsed field, with the value trimmed of whitespace and quotechars
+   */
+  __device__ field_descriptor next(cudf::size_type field_idx)
+  {
+    if (!are_rows_objects_) {
       // No key - column and begin are trivial
-      ? field_descriptor{field_idx, begin, cudf::io::gpu::seek_field_end(begin, end, opts, true)}
-      : [&]() {
-          auto const key_range = get_next_key(begin, end, opts.quotechar);
-          auto const key_hash  = MurmurHash3_32<cudf::string_view>{}(
-            cudf::string_view(key_range.first, key_range.second - key_range.first));
-          auto const hash_col = col_map->find(key_hash);
-          // Fall back to field index if not found (parsing error)
-          auto const column = (hash_col != col_map->end()) ? (*hash_col).second : field_idx;
-
-          // Skip the colon between the key and the value
-          auto const value_begin = thrust::find(thrust::seq, key_range.second, end, ':') + 1;
-          return field_descriptor{
-            column, value_begin, cudf::io::gpu::seek_field_end(value_begin, end, opts, true)};
-        }();
-
-  // Modify start & end to ignore whitespace and quotechars
-  auto const trimmed_value_range =
-    trim_whitespaces_quotes(desc_pre_trim.value_begin, desc_pre_trim.value_end, opts.quotechar);
-  return {desc_pre_trim.column, trimmed_value_range.first, trimmed_value_range.second};
-}
+      auto const value_end = cudf::io::gpu::seek_field_end(pos_, end_, opts_, true);
+      auto const trimmed   = trim_whitespaces_quotes(pos_, value_end, opts_.quotechar);
+      pos_                 = value_end + 1;
+      return {field_idx, trimmed.first, trimmed.second, nullptr, nullptr, nullptr, nullptr, 0};
+    }
+    while (true) {
+      auto const limit     = (parent_end_ != nullptr) ? parent_end_ : end_;
+      auto const key_range = get_next_key(pos_, limit, opts_.quotechar);
+      if (key_range.first == limit) {
+        // No more keys in the current range
+        if (parent_end_ != nullptr) {
+          step_out_of_nested();
+          continue;
+        }
+        pos_ = end_;
+        return {field_idx, end_, end_, end_, end_, nullptr, nullptr, 0};
+      }
+      auto key_hash = MurmurHash3_32<cudf::string_view>{}(
+        cudf::string_view(key_range.first, key_range.second - key_range.first));
+      if (parent_end_ != nullptr) {
+        key_hash = MurmurHash3_32<cudf::string_view>{}.hash_combine(parent_hash_, key_hash);
+      }
+
+      // Skip the colon between the key and the value
+      auto value_begin = thrust::find(thrust::seq, key_range.second, limit, ':') + 1;
+      while (value_begin < limit && *value_begin == ' ') {
+        ++value_begin;
+      }
+
+      auto const is_nested =
+        flatten_ && value_begin < limit && (*value_begin == '{' || *value_begin == '[');
+      if (is_nested && *value_begin == '{' && parent_end_ == nullptr) {
+        // Step into the nested object; its fields are returned as if they were top-level
+        parent_key_begin_ = key_range.first;
+        parent_key_end_   = key_range.second;
+        parent_hash_      = key_hash;
+        parent_end_       = seek_nested_value_end(value_begin, end_, opts_.quotechar) - 1;
+        pos_              = value_begin + 1;
+        if (pos_ >= parent_end_) { step_out_of_nested(); }  // empty object
+        continue;
+      }
+
+      auto const value_end =
+        is_nested
+          // Deeper levels are not flattened; the whole nested value is a single field
+          ? seek_nested_value_end(value_begin, limit, opts_.quotechar)
+          : cudf::io::gpu::seek_field_end(value_begin, limit, opts_, true);
+
+      // Fall back to field index if the key is not found in the map (parsing error), unless
+      // unmatched fields are to be skipped (column selection)
+      auto const column = [&]() -> cudf::size_type {
+        if (col_map_ == nullptr) return field_idx;
+        auto const hash_col = col_map_->find(key_hash);
+        if (hash_col != col_map_->end()) return (*hash_col).second;
+        return skip_unmatched_ ? unmatched_field_sentinel : field_idx;
+      }();
+
+      // Modify start & end to ignore whitespace and quotechars
+      auto const trimmed = trim_whitespaces_quotes(value_begin, value_end, opts_.quotechar);
+      auto const desc    = field_descriptor{column,
+                                         trimmed.first,
+                                         trimmed.second,
+                                         key_range.first,
+                                         key_range.second,
+                                         parent_key_begin_,
+                                         parent_key_end_,
+                                         key_hash};
+      pos_               = value_end + 1;
+      if (parent_end_ != nullptr && pos_ > parent_end_) { step_out_of_nested(); }
+      return desc;
+    }
+  }
+
+ private:
+  __device__ void step_out_of_nested()
+  {
+    pos_              = parent_end_ + 1;
+    parent_end_       = nullptr;
+    parent_key_begin_ = nullptr;
+    parent_key_end_   = nullptr;
+  }
+
+  char const* pos_;
+  char const* end_;
+  parse_options_view const& opts_;
+  bool are_rows_objects_;
+  col_map_type* col_map_;
+  bool flatten_;
+  bool skip_unmatched_;
+  // Closing brace of the nested object the parser is currently in; nullptr at the top level
+  char const* parent_end_       = nullptr;
+  char const* parent_key_begin_ = nullptr;
+  char const* parent_key_end_   = nullptr;
+  uint32_t parent_hash_         = 0;
+};
 
 /**
  * @brief Returns the range that contains the data in a given row.
@@ -483,6 +625,8 @@ __device__ std::pair<char const*, char const*> get_row_data_range(
  * @param[in] column_types The data type of each column
  * @param[in] col_map Pointer to the (column name hash -> column index) map in device memory.
  * nullptr is passed when the input file does not consist of objects.
+ * @param[in] flatten_nested_objects Whether to read fields of nested objects as separate columns
+ * @param[in] skip_unmatched_fields Whether to skip fields whose key is not in the column map
  * @param[out] output_columns The output column data
  * @param[out] valid_fields The bitmaps indicating whether column fields are valid
  * @param[out] num_valid_fields The numbers of valid fields in columns
@@ -492,6 +636,8 @@ __global__ void convert_data_to_columns_kernel(parse_options_view opts,
                                                device_span<uint64_t const> const row_offsets,
                                                device_span<data_type const> const column_types,
                                                col_map_type* col_map,
+                                               bool flatten_nested_objects,
+                                               bool skip_unmatched_fields,
                                                device_span<void* const> const output_columns,
                                                device_span<bitmask_type* const> const valid_fields,
                                                device_span<cudf::size_type> const num_valid_fields)
@@ -501,16 +647,21 @@ __global__ void convert_data_to_columns_kernel(parse_options_view opts,
 
   auto const row_data_range = get_row_data_range(data, row_offsets, rec_id);
 
-  auto current = row_data_range.first;
+  json_row_parser fields(row_data_range.first,
+                         row_data_range.second,
+                         opts,
+                         col_map != nullptr,
+                         col_map,
+                         flatten_nested_objects,
+                         skip_unmatched_fields);
   for (size_type input_field_index = 0;
-       input_field_index < column_types.size() && current < row_data_range.second;
-       input_field_index++) {
-    auto const desc =
-      next_field_descriptor(current, row_data_range.second, opts, input_field_index, col_map);
+       input_field_index < column_types.size() && fields.has_next();) {
+    auto const desc = fields.next(input_field_index);
+    // Skip the values of keys that do not belong to any of the selected columns
+    if (desc.column == unmatched_field_sentinel) continue;
+    input_field_index++;
     auto const value_len = static_cast<size_t>(std::max(desc.value_end - desc.value_begin, 0L));
 
-    current = desc.value_end + 1;
-
     // Empty fields are not legal values
     if (!serialized_trie_contains(opts.trie_na, {desc.value_begin, value_len})) {
       // Type dispatcher does not handle strings
@@ -555,6 +706,8 @@ __global__ void convert_data_to_columns_kernel(parse_options_view opts,
  * @param[in] rec_starts The offset of each row in the input
  * @param[in] col_map Pointer to the (column name hash -> column index) map in device memory.
  * nullptr is passed when the input file does not consist of objects.
+ * @param[in] flatten_nested_objects Whether to read fields of nested objects as separate columns
+ * @param[in] skip_unmatched_fields Whether to skip fields whose key is not in the column map
  * @param[in] num_columns The number of columns of input data
  * @param[out] column_infos The count for each column data type
  */
@@ -563,6 +716,8 @@ __global__ void detect_data_types_kernel(
   device_span<char const> const data,
   device_span<uint64_t const> const row_offsets,
   col_map_type* col_map,
+  bool flatten_nested_objects,
+  bool skip_unmatched_fields,
   int num_columns,
   device_span<cudf::io::column_type_histogram> const column_infos)
 {
@@ -572,17 +727,21 @@ __global__ void detect_data_types_kernel(
   auto const are_rows_objects = col_map != nullptr;
   auto const row_data_range   = get_row_data_range(data, row_offsets, rec_id);
 
+  json_row_parser fields(row_data_range.first,
+                         row_data_range.second,
+                         opts,
+                         are_rows_objects,
+                         col_map,
+                         flatten_nested_objects,
+                         skip_unmatched_fields);
   size_type input_field_index = 0;
-  for (auto current = row_data_range.first;
-       input_field_index < num_columns && current < row_data_range.second;
-       input_field_index++) {
-    auto const desc =
-      next_field_descriptor(current, row_data_range.second, opts, input_field_index, col_map);
+  while (input_field_index < num_columns && fields.has_next()) {
+    auto const desc = fields.next(input_field_index);
+    // Skip the values of keys that do not belong to any of the selected columns
+    if (desc.column == unmatched_field_sentinel) continue;
+    input_field_index++;
     auto const value_len = static_cast<size_t>(std::max(desc.value_end - desc.value_begin, 0L));
 
-    // Advance to the next field; +1 to skip the delimiter
-    current = desc.value_end + 1;
-
     // Checking if the field is empty/valid
     if (serialized_trie_contains(opts.trie_na, {desc.value_begin, value_len})) {
       // Increase the null count for array rows, where the null count is initialized to zero.
@@ -681,46 +840,21 @@ __global__ void detect_data_types_kernel(
   }
 }
 
-/**
- * @brief Input data range that contains a field in key:value format.
- */
-struct key_value_range {
-  char const* key_begin;
-  char const* key_end;
-  char const* value_begin;
-  char const* value_end;
-};
-
-/**
- * @brief Parse the next field in key:value format and return ranges of its parts.
- */
-__device__ key_value_range get_next_key_value_range(char const* begin,
-                                                    char const* end,
-                                                    parse_options_view const& opts)
-{
-  auto const key_range = get_next_key(begin, end, opts.quotechar);
-
-  // Colon between the key and the value
-  auto const colon = thrust::find(thrust::seq, key_range.second, end, ':');
-  if (colon == end) return {end, end, end};
-
-  // Field value (including delimiters)
-  auto const value_end = cudf::io::gpu::seek_field_end(colon + 1, end, opts, true);
-  return {key_range.first, key_range.second, colon + 1, value_end};
-}
-
 /**
  * @brief Cuda kernel that collects information about JSON object keys in the file.
  *
  * @param[in] options A set of parsing options
  * @param[in] data Input data buffer
  * @param[in] row_offsets The offset of each row in the input
+ * @param[in] flatten_nested_objects Whether to collect keys of nested objects, with the path hash
  * @param[out] keys_cnt Number of keys found in the file
- * @param[out] keys_info optional, information (offset, length, hash) for each found key
+ * @param[out] keys_info optional, information (offset, length, hash, parent key offset, parent
+ * key length) for each found key
  */
 __global__ void collect_keys_info_kernel(parse_options_view const options,
                                          device_span<char const> const data,
                                          device_span<uint64_t const> const row_offsets,
+                                         bool flatten_nested_objects,
                                          unsigned long long int* keys_cnt,
                                          thrust::optional<mutable_table_device_view> keys_info)
 {
@@ -729,19 +863,22 @@ __global__ void collect_keys_info_kernel(parse_options_view const options,
 
   auto const row_data_range = get_row_data_range(data, row_offsets, rec_id);
 
-  auto advance = [&](const char* begin) {
-    return get_next_key_value_range(begin, row_data_range.second, options);
-  };
-  for (auto field_range = advance(row_data_range.first);
-       field_range.key_begin < row_data_range.second;
-       field_range = advance(field_range.value_end)) {
+  // The (hash -> column index) map does not exist yet at this point
+  json_row_parser fields(
+    row_data_range.first, row_data_range.second, options, true, nullptr, flatten_nested_objects);
+  while (fields.has_next()) {
+    auto const field = fields.next(0);
+    if (field.key_begin >= row_data_range.second) break;
     auto const idx = atomicAdd(keys_cnt, 1);
     if (keys_info.has_value()) {
-      auto const len                              = field_range.key_end - field_range.key_begin;
-      keys_info->column(0).element<uint64_t>(idx) = field_range.key_begin - data.begin();
+      auto const len                              = field.key_end - field.key_begin;
+      keys_info->column(0).element<uint64_t>(idx) = field.key_begin - data.begin();
       keys_info->column(1).element<uint16_t>(idx) = len;
-      keys_info->column(2).element<uint32_t>(idx) =
-        MurmurHash3_32<cudf::string_view>{}(cudf::string_view(field_range.key_begin, len));
+      keys_info->column(2).element<uint32_t>(idx) = field.key_hash;
+      keys_info->column(3).element<uint64_t>(idx) =
+        (field.parent_key_begin != nullptr) ? field.parent_key_begin - data.begin() : 0;
+      keys_info->column(4).element<uint16_t>(idx) =
+        (field.parent_key_begin != nullptr) ? field.parent_key_end - field.parent_key_begin : 0;
     }
   }
 }
@@ -756,6 +893,8 @@ void convert_json_to_columns(parse_options_view const& opts,
                              device_span<uint64_t const> const row_offsets,
                              device_span<data_type const> const column_types,
                              col_map_type* col_map,
+                             bool flatten_nested_objects,
+                             bool skip_unmatched_fields,
                              device_span<void* const> const output_columns,
                              device_span<bitmask_type* const> const valid_fields,
                              device_span<cudf::size_type> num_valid_fields,
@@ -768,8 +907,16 @@ void convert_json_to_columns(parse_options_view const& opts,
 
   const int grid_size = (row_offsets.size() + block_size - 1) / block_size;
 
-  convert_data_to_columns_kernel<<<grid_size, block_size, 0, stream.value()>>>(
-    opts, data, row_offsets, column_types, col_map, output_columns, valid_fields, num_valid_fields);
+  convert_data_to_columns_kernel<<<grid_size, block_size, 0, stream.value()>>>(opts,
+                                                                               data,
+                                                                               row_offsets,
+                                                                               column_types,
+                                                                               col_map,
+                                                                               flatten_nested_objects,
+                                                                               skip_unmatched_fields,
+                                                                               output_columns,
+                                                                               valid_fields,
+                                                                               num_valid_fields);
 
   CUDA_TRY(cudaGetLastError());
 }
@@ -785,6 +932,8 @@ std::vector<cudf::io::column_type_histogram> detect_data_types(
   bool do_set_null_count,
   int num_columns,
   col_map_type* col_map,
+  bool flatten_nested_objects,
+  bool skip_unmatched_fields,
   rmm::cuda_stream_view stream)
 {
   int block_size;
@@ -813,8 +962,14 @@ std::vector<cudf::io::column_type_histogram> detect_data_types(
   // Calculate actual block count to use based on records count
   const int grid_size = (row_offsets.size() + block_size - 1) / block_size;
 
-  detect_data_types_kernel<<<grid_size, block_size, 0, stream.value()>>>(
-    options, data, row_offsets, col_map, num_columns, d_column_infos);
+  detect_data_types_kernel<<<grid_size, block_size, 0, stream.value()>>>(options,
+                                                                         data,
+                                                                         row_offsets,
+                                                                         col_map,
+                                                                         flatten_nested_objects,
+                                                                         skip_unmatched_fields,
+                                                                         num_columns,
+                                                                         d_column_infos);
 
   return cudf::detail::make_std_vector_sync(d_column_infos, stream);
 }
@@ -825,6 +980,7 @@ std::vector<cudf::io::column_type_histogram> detect_data_types(
 void collect_keys_info(parse_options_view const& options,
                        device_span<char const> const data,
                        device_span<uint64_t const> const row_offsets,
+                       bool flatten_nested_objects,
                        unsigned long long int* keys_cnt,
                        thrust::optional<mutable_table_device_view> keys_info,
                        rmm::cuda_stream_view stream)
@@ -838,7 +994,7 @@ void collect_keys_info(parse_options_view const& options,
   const int grid_size = (row_offsets.size() + block_size - 1) / block_size;
 
   collect_keys_info_kernel<<<grid_size, block_size, 0, stream.value()>>>(
-    options, data, row_offsets, keys_cnt, keys_info);
+    options, data, row_offsets, flatten_nested_objects, keys_cnt, keys_info);
 
   CUDA_TRY(cudaGetLastError());
 }
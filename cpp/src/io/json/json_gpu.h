@@ -46,6 +46,9 @@ using col_map_type = concurrent_unordered_map<uint32_t, cudf::size_type>;
  * @param[in] dtypes The data type of each column
  * @param[in] col_map Pointer to the (column name hash -> column index) map in device memory.
  * nullptr is passed when the input file does not consist of objects.
+ * @param[in] flatten_nested_objects Whether to read fields of nested objects as separate columns
+ * @param[in] skip_unmatched_fields Whether to skip fields whose key is not in the column map,
+ * instead of matching them to the column at the field's position
  * @param[out] output_columns The output column data
  * @param[out] valid_fields The bitmaps indicating whether column fields are valid
  * @param[out] num_valid_fields The numbers of valid fields in columns
@@ -56,6 +59,8 @@ void convert_json_to_columns(parse_options_view const& options,
                              device_span<uint64_t const> row_offsets,
                              device_span<data_type const> column_types,
                              col_map_type* col_map,
+                             bool flatten_nested_objects,
+                             bool skip_unmatched_fields,
                              device_span<void* const> output_columns,
                              device_span<bitmask_type* const> valid_fields,
                              device_span<cudf::size_type> num_valid_fields,
@@ -70,6 +75,9 @@ void convert_json_to_columns(parse_options_view const& options,
  * @param[in] num_columns The number of columns of input data
  * @param[in] col_map Pointer to the (column name hash -> column index) map in device memory.
  * nullptr is passed when the input file does not consist of objects.
+ * @param[in] flatten_nested_objects Whether to read fields of nested objects as separate columns
+ * @param[in] skip_unmatched_fields Whether to skip fields whose key is not in the column map,
+ * instead of matching them to the column at the field's position
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  *
  * @returns The count for each column data type
@@ -81,6 +89,8 @@ std::vector<cudf::io::column_type_histogram> detect_data_types(
   bool do_set_null_count,
   int num_columns,
   col_map_type* col_map,
+  bool flatten_nested_objects,
+  bool skip_unmatched_fields,
   rmm::cuda_stream_view stream);
 
 /**
@@ -89,13 +99,16 @@ std::vector<cudf::io::column_type_histogram> detect_data_types(
  * @param[in] options A set of parsing options
  * @param[in] data Input data buffer
  * @param[in] row_offsets The offset of each row in the input
+ * @param[in] flatten_nested_objects Whether to collect keys of nested objects, with the path hash
  * @param[out] keys_cnt Number of keys found in the file
- * @param[out] keys_info optional, information (offset, length, hash) for each found key
+ * @param[out] keys_info optional, information (offset, length, hash, parent key offset, parent key
+ * length) for each found key
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  */
 void collect_keys_info(parse_options_view const& options,
                        device_span<char const> data,
                        device_span<uint64_t const> row_offsets,
+                       bool flatten_nested_objects,
                        unsigned long long int* keys_cnt,
                        thrust::optional<mutable_table_device_view> keys_info,
                        rmm::cuda_stream_view stream);
@@ -53,7 +53,8 @@ using namespace cudf::io;
 /**
  * @brief Aggregate the table containing keys info by their hash values.
  *
- * @param[in] info Table with columns containing key offsets, lengths and hashes, respectively
+ * @param[in] info Table with columns containing key offsets, lengths, hashes, parent key offsets
+ * and parent key lengths, respectively
  *
  * @return Table with data aggregated by key hash values
  */
@@ -61,13 +62,11 @@ std::unique_ptr<table> aggregate_keys_info(std::unique_ptr<table> info)
 {
   auto const info_view = info->view();
   std::vector<groupby::aggregation_request> requests;
-  requests.emplace_back(groupby::aggregation_request{info_view.column(0)});
-  requests.back().aggregations.emplace_back(make_min_aggregation<groupby_aggregation>());
-  requests.back().aggregations.emplace_back(make_nth_element_aggregation<groupby_aggregation>(0));
-
-  requests.emplace_back(groupby::aggregation_request{info_view.column(1)});
-  requests.back().aggregations.emplace_back(make_min_aggregation<groupby_aggregation>());
-  requests.back().aggregations.emplace_back(make_nth_element_aggregation<groupby_aggregation>(0));
+  for (auto const col_idx : {0, 1, 3, 4}) {
+    requests.emplace_back(groupby::aggregation_request{info_view.column(col_idx)});
+    requests.back().aggregations.emplace_back(make_min_aggregation<groupby_aggregation>());
+    requests.back().aggregations.emplace_back(make_nth_element_aggregation<groupby_aggregation>(0));
+  }
 
   // Aggregate by hash values
   groupby::groupby gb_obj(
@@ -79,6 +78,8 @@ std::unique_ptr<table> aggregate_keys_info(std::unique_ptr<table> info)
   out_columns.emplace_back(std::move(result.second[0].results[0]));  // offsets
   out_columns.emplace_back(std::move(result.second[1].results[0]));  // lengths
   out_columns.emplace_back(std::move(result.first->release()[0]));   // hashes
+  out_columns.emplace_back(std::move(result.second[2].results[0]));  // parent key offsets
+  out_columns.emplace_back(std::move(result.second[3].results[0]));  // parent key lengths
   return std::make_unique<table>(std::move(out_columns));
 }
 
@@ -102,24 +103,28 @@ col_map_ptr_type create_col_names_hash_map(column_view column_name_hashes,
 /**
  * @brief Create a table whose columns contain the information on JSON objects' keys.
  *
- * The columns contain name offsets in the file, name lengths and name hashes, respectively.
+ * The columns contain name offsets in the file, name lengths, name hashes, and the offsets and
+ * lengths of the enclosing object's name (zero for top-level keys), respectively.
  *
  * @param[in] options Parsing options (e.g. delimiter and quotation character)
  * @param[in] data Input JSON device data
  * @param[in] row_offsets Device array of row start locations in the input buffer
+ * @param[in] flatten_nested_objects Whether to collect keys of nested objects
  * @param[in] stream CUDA stream used for device memory operations and kernel launches
  *
- * @return std::unique_ptr<table> cudf table with three columns (offsets, lengths, hashes)
+ * @return std::unique_ptr<table> cudf table with five columns (offsets, lengths, hashes, parent
+ * key offsets, parent key lengths)
  */
 std::unique_ptr<table> create_json_keys_info_table(const parse_options_view& options,
                                                    device_span<char const> const data,
                                                    device_span<uint64_t const> const row_offsets,
+                                                   bool flatten_nested_objects,
                                                    rmm::cuda_stream_view stream)
 {
   // Count keys
   rmm::device_scalar<unsigned long long int> key_counter(0, stream);
   cudf::io::json::gpu::collect_keys_info(
-    options, data, row_offsets, key_counter.data(), {}, stream);
+    options, data, row_offsets, flatten_nested_objects, key_counter.data(), {}, stream);
 
   // Allocate columns to store hash value, length, and offset of each JSON object key in the input
   auto const num_keys = key_counter.value(stream);
@@ -127,6 +132,8 @@ std::unique_ptr<table> create_json_keys_info_table(const parse_options_view& opt
   info_columns.emplace_back(make_numeric_column(data_type(type_id::UINT64), num_keys));
   info_columns.emplace_back(make_numeric_column(data_type(type_id::UINT16), num_keys));
   info_columns.emplace_back(make_numeric_column(data_type(type_id::UINT32), num_keys));
+  info_columns.emplace_back(make_numeric_column(data_type(type_id::UINT64), num_keys));
+  info_columns.emplace_back(make_numeric_column(data_type(type_id::UINT16), num_keys));
   // Create a table out of these columns to pass them around more easily
   auto info_table           = std::make_unique<table>(std::move(info_columns));
   auto const info_table_mdv = mutable_table_device_view::create(info_table->mutable_view(), stream);
@@ -134,13 +141,21 @@ std::unique_ptr<table> create_json_keys_info_table(const parse_options_view& opt
   // Reset the key counter - now used for indexing
   key_counter.set_value_to_zero_async(stream);
   // Fill the allocated columns
-  cudf::io::json::gpu::collect_keys_info(
-    options, data, row_offsets, key_counter.data(), {*info_table_mdv}, stream);
+  cudf::io::json::gpu::collect_keys_info(options,
+                                         data,
+                                         row_offsets,
+                                         flatten_nested_objects,
+                                         key_counter.data(),
+                                         {*info_table_mdv},
+                                         stream);
   return info_table;
 }
 
 /**
  * @brief Extract the keys from the JSON file the name offsets/lengths.
+ *
+ * Keys of flattened nested objects are prefixed with the enclosing object's key, with a period as
+ * the separator.
  */
 std::vector<std::string> create_key_strings(char const* h_data,
                                             table_view sorted_info,
@@ -161,12 +176,27 @@ std::vector<std::string> create_key_strings(char const* h_data,
                   cudaMemcpyDefault,
                   stream.value());
 
+  std::vector<uint64_t> h_parent_offsets(num_cols);
+  cudaMemcpyAsync(h_parent_offsets.data(),
+                  sorted_info.column(3).data<uint64_t>(),
+                  sizeof(uint64_t) * num_cols,
+                  cudaMemcpyDefault,
+                  stream.value());
+
+  std::vector<uint16_t> h_parent_lens(num_cols);
+  cudaMemcpyAsync(h_parent_lens.data(),
+                  sorted_info.column(4).data<uint16_t>(),
+                  sizeof(uint16_t) * num_cols,
+                  cudaMemcpyDefault,
+                  stream.value());
+
   std::vector<std::string> names(num_cols);
-  std::transform(h_offsets.cbegin(),
-                 h_offsets.cend(),
-                 h_lens.cbegin(),
-                 names.begin(),
-                 [&](auto offset, auto len) { return std::string(h_data + offset, len); });
+  for (cudf::size_type i = 0; i < num_cols; ++i) {
+    names[i] = std::string(h_data + h_offsets[i], h_lens[i]);
+    if (h_parent_lens[i] != 0) {
+      names[i] = std::string(h_data + h_parent_offsets[i], h_parent_lens[i]) + '.' + names[i];
+    }
+  }
   return names;
 }
 
@@ -190,13 +220,41 @@ std::pair<std::vector<std::string>, col_map_ptr_type> reader::impl::get_json_obj
     opts_.view(),
     device_span<char const>(static_cast<char const*>(data_.data()), data_.size()),
     rec_starts,
+    options_.is_enabled_flatten_nested_objects(),
     stream);
 
   auto aggregated_info = aggregate_keys_info(std::move(info));
   auto sorted_info     = sort_keys_info_by_offset(std::move(aggregated_info));
 
-  return {create_key_strings(uncomp_data_, sorted_info->view(), stream),
-          create_col_names_hash_map(sorted_info->get_column(2).view(), stream)};
+  auto names = create_key_strings(uncomp_data_, sorted_info->view(), stream);
+
+  auto const& use_cols = options_.get_use_cols_names();
+  if (use_cols.empty()) {
+    return {std::move(names), create_col_names_hash_map(sorted_info->get_column(2).view(), stream)};
+  }
+
+  // Keep only the selected columns; keys that are left out of the hash map are skipped during
+  // parsing
+  auto const hashes_view = sorted_info->get_column(2).view();
+  auto const h_hashes    = cudf::detail::make_std_vector_sync(
+    device_span<uint32_t const>(hashes_view.data<uint32_t>(), hashes_view.size()), stream);
+  std::vector<std::string> selected_names;
+  std::vector<uint32_t> selected_hashes;
+  for (size_t idx = 0; idx < names.size(); ++idx) {
+    if (std::find(use_cols.cbegin(), use_cols.cend(), names[idx]) != use_cols.cend()) {
+      selected_names.emplace_back(std::move(names[idx]));
+      selected_hashes.push_back(h_hashes[idx]);
+    }
+  }
+  CUDF_EXPECTS(!selected_names.empty(), "None of the selected columns are present in the input");
+
+  auto const d_hashes = cudf::detail::make_device_uvector_async(selected_hashes, stream);
+  return {std::move(selected_names),
+          create_col_names_hash_map(
+            column_view(data_type{type_id::UINT32},
+                        static_cast<size_type>(selected_hashes.size()),
+                        d_hashes.data()),
+            stream)};
 }
 
 /**
@@ -409,6 +467,8 @@ void reader::impl::set_column_names(device_span<uint64_t const> rec_starts,
     metadata_.column_names = keys_desc.first;
     set_column_map(std::move(keys_desc.second), stream);
   } else {
+    CUDF_EXPECTS(options_.get_use_cols_names().empty(),
+                 "Column selection is only supported when rows are JSON objects");
     int cols_found = 0;
     bool quotation = false;
     for (size_t pos = 0; pos < first_row.size(); ++pos) {
@@ -462,6 +522,8 @@ void reader::impl::set_data_types(device_span<uint64_t const> rec_starts,
       do_set_null_count,
       num_columns,
       get_column_map_device_ptr(),
+      options_.is_enabled_flatten_nested_objects(),
+      !options_.get_use_cols_names().empty(),
       stream);
 
     auto get_type_id = [&](auto const& cinfo) {
@@ -530,6 +592,8 @@ table_with_metadata reader::impl::convert_data_to_table(device_span<uint64_t con
     rec_starts,
     d_dtypes,
     get_column_map_device_ptr(),
+    options_.is_enabled_flatten_nested_objects(),
+    !options_.get_use_cols_names().empty(),
     d_data,
     d_valid,
     d_valid_counts,
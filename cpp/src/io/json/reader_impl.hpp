@@ -116,6 +116,8 @@ class reader::impl {
   /**
    * @brief Extract the JSON objects keys from the input file with object rows.
    *
+   * When column selection is used, only the keys of the selected columns are returned.
+   *
    * @return Array of keys and a map that maps their hash values to column indices
    */
   std::pair<std::vector<std::string>, col_map_ptr_type> get_json_object_keys_hashes(
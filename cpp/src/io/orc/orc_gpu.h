@@ -18,6 +18,7 @@
 
 #include "timezone.cuh"
 
+#include <io/comp/batched_compressor.hpp>
 #include <io/comp/gpuinflate.h>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
@@ -211,13 +212,15 @@ constexpr uint32_t encode_block_size = 512;
  * @param[in] num_streams Number of compressed streams
  * @param[in] compression_block_size maximum size of compressed blocks (up to 16M)
  * @param[in] log2maxcr log2 of maximum compression ratio (used to infer max uncompressed size from
- * compressed size)
+ * compressed size when the codec does not store the exact size)
+ * @param[in] compression The compression kind of the stripe data
  * @param[in] stream CUDA stream used for device memory operations and kernel launches
  */
 void ParseCompressedStripeData(CompressedStreamInfo* strm_info,
                                int32_t num_streams,
                                uint32_t compression_block_size,
                                uint32_t log2maxcr,
+                               CompressionKind compression,
                                rmm::cuda_stream_view stream);
 
 /**
@@ -343,8 +346,7 @@ void CompactOrcDataStreams(device_2dspan<StripeStream> strm_desc,
  * @brief Launches kernel(s) for compressing data streams
  *
  * @param[in] compressed_data Output compressed blocks
- * @param[in] num_compressed_blocks Total number of compressed blocks
- * @param[in] compression Type of compression
+ * @param[in] compressor Block compressor holding the codec and reusable scratch memory
  * @param[in] comp_blk_size Compression block size
  * @param[in] max_comp_blk_size Max size of any block after compression
  * @param[in,out] strm_desc StripeStream device array [stripe][stream]
@@ -354,8 +356,7 @@ void CompactOrcDataStreams(device_2dspan<StripeStream> strm_desc,
  * @param[in] stream CUDA stream used for device memory operations and kernel launches
  */
 void CompressOrcDataStreams(uint8_t* compressed_data,
-                            uint32_t num_compressed_blocks,
-                            CompressionKind compression,
+                            batched_compressor& compressor,
                             uint32_t comp_blk_size,
                             uint32_t max_comp_blk_size,
                             device_2dspan<StripeStream> strm_desc,
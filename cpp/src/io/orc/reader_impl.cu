@@ -26,11 +26,15 @@
 #include <io/comp/gpuinflate.h>
 #include "orc.h"
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <iterator>
 #include <rmm/cuda_stream_view.hpp>
@@ -42,6 +46,8 @@
 
 #include <algorithm>
 #include <array>
+#include <functional>
+#include <optional>
 
 namespace cudf {
 namespace io {
@@ -257,6 +263,166 @@ bool should_convert_decimal_column_to_float(const std::vector<std::string>& colu
                     metadata.get_column_name(column_index)) != columns_to_convert.end());
 }
 
+/**
+ * @brief Compares a min/max statistics range against a literal, all in the statistics' domain.
+ *
+ * Returns true/false when the range proves that some/no value can satisfy `value_in_range op
+ * literal`, and `std::nullopt` for operators that cannot be decided from a range.
+ */
+template <typename T>
+std::optional<bool> compare_stats_range(T stat_min, T stat_max, T value, ast::ast_operator op)
+{
+  switch (op) {
+    case ast::ast_operator::EQUAL: return not(value < stat_min or stat_max < value);
+    case ast::ast_operator::NOT_EQUAL: return not(stat_min == stat_max and stat_min == value);
+    case ast::ast_operator::LESS: return stat_min < value;
+    case ast::ast_operator::LESS_EQUAL: return not(value < stat_min);
+    case ast::ast_operator::GREATER: return value < stat_max;
+    case ast::ast_operator::GREATER_EQUAL: return not(stat_max < value);
+    default: return std::nullopt;
+  }
+}
+
+/**
+ * @brief Functor that compares one stripe's decoded min/max statistics against a literal.
+ *
+ * Returns true/false when the statistics prove that some/no row in the stripe can satisfy
+ * `column op literal`, and `std::nullopt` when the statistics are unusable for the given type.
+ */
+struct stripe_stats_comparator {
+  cudf::io::orc::column_statistics const& stats;
+
+  template <typename T>
+  static std::optional<T> literal_value(cudf::scalar const& literal)
+  {
+    auto const& typed_scalar = static_cast<cudf::scalar_type_t<T> const&>(literal);
+    if (not typed_scalar.is_valid()) { return std::nullopt; }
+    return typed_scalar.value();
+  }
+
+  template <typename T,
+            std::enable_if_t<std::is_integral_v<T> and not std::is_same_v<T, bool>>* = nullptr>
+  std::optional<bool> operator()(cudf::scalar const& literal, ast::ast_operator op) const
+  {
+    if (not stats.int_stats or not stats.int_stats->minimum or not stats.int_stats->maximum) {
+      return std::nullopt;
+    }
+    auto const value = literal_value<T>(literal);
+    if (not value) { return std::nullopt; }
+    // Integer statistics are stored as int64 regardless of the column's width
+    return compare_stats_range<int64_t>(
+      *stats.int_stats->minimum, *stats.int_stats->maximum, static_cast<int64_t>(*value), op);
+  }
+
+  template <typename T, std::enable_if_t<std::is_floating_point_v<T>>* = nullptr>
+  std::optional<bool> operator()(cudf::scalar const& literal, ast::ast_operator op) const
+  {
+    if (not stats.double_stats or not stats.double_stats->minimum or
+        not stats.double_stats->maximum) {
+      return std::nullopt;
+    }
+    auto const value = literal_value<T>(literal);
+    if (not value) { return std::nullopt; }
+    return compare_stats_range<double>(
+      *stats.double_stats->minimum, *stats.double_stats->maximum, *value, op);
+  }
+
+  template <typename T, std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
+  std::optional<bool> operator()(cudf::scalar const& literal, ast::ast_operator op) const
+  {
+    // Only the UTC min/max are comparable without applying the writer timezone
+    if (not stats.timestamp_stats or not stats.timestamp_stats->minimum_utc or
+        not stats.timestamp_stats->maximum_utc) {
+      return std::nullopt;
+    }
+    auto const value = literal_value<T>(literal);
+    if (not value) { return std::nullopt; }
+    auto const value_ms =
+      cuda::std::chrono::duration_cast<cuda::std::chrono::milliseconds>(value->time_since_epoch())
+        .count();
+    // Statistics are truncated to millisecond precision; widen the range by one unit on both
+    // ends so the comparison stays conservative
+    return compare_stats_range<int64_t>(*stats.timestamp_stats->minimum_utc - 1,
+                                        *stats.timestamp_stats->maximum_utc + 1,
+                                        value_ms,
+                                        op);
+  }
+
+  template <typename T,
+            std::enable_if_t<not((std::is_integral_v<T> and not std::is_same_v<T, bool>) or
+                                 std::is_floating_point_v<T> or cudf::is_timestamp<T>())>* = nullptr,
+            typename... Args>
+  std::optional<bool> operator()(Args&&...) const
+  {
+    return std::nullopt;
+  }
+};
+
+/**
+ * @brief Evaluates an AST (sub)expression against one stripe's column statistics.
+ *
+ * The result is tri-state: `true`/`false` when the statistics prove that the stripe may/cannot
+ * contain matching rows, and `std::nullopt` when they are inconclusive (unsupported operator,
+ * missing statistics, or mismatched types), in which case the caller must keep the stripe.
+ *
+ * @param expr (Sub)expression to evaluate
+ * @param get_stats Callback returning the decoded statistics of a given output column
+ * @param column_types cudf types of the output columns, indexed by column reference
+ */
+std::optional<bool> evaluate_stats_expression(
+  ast::expression const& expr,
+  std::function<std::optional<cudf::io::orc::column_statistics>(size_type)> const& get_stats,
+  std::vector<data_type> const& column_types)
+{
+  auto const* op_expr = dynamic_cast<ast::operation const*>(&expr);
+  if (op_expr == nullptr) { return std::nullopt; }
+  auto const op       = op_expr->get_operator();
+  auto const operands = op_expr->get_operands();
+
+  if (op == ast::ast_operator::LOGICAL_AND or op == ast::ast_operator::NULL_LOGICAL_AND) {
+    auto const lhs = evaluate_stats_expression(operands[0], get_stats, column_types);
+    auto const rhs = evaluate_stats_expression(operands[1], get_stats, column_types);
+    if ((lhs and not *lhs) or (rhs and not *rhs)) { return false; }
+    if (lhs and rhs) { return true; }
+    return std::nullopt;
+  }
+  if (op == ast::ast_operator::LOGICAL_OR or op == ast::ast_operator::NULL_LOGICAL_OR) {
+    auto const lhs = evaluate_stats_expression(operands[0], get_stats, column_types);
+    auto const rhs = evaluate_stats_expression(operands[1], get_stats, column_types);
+    if ((lhs and *lhs) or (rhs and *rhs)) { return true; }
+    if (lhs and rhs) { return false; }
+    return std::nullopt;
+  }
+
+  // Remaining supported shapes compare a column reference with a literal, in either order
+  if (operands.size() != 2) { return std::nullopt; }
+  auto const* col = dynamic_cast<ast::column_reference const*>(&operands[0].get());
+  auto const* lit = dynamic_cast<ast::literal const*>(&operands[1].get());
+  auto cmp_op     = op;
+  if (col == nullptr) {
+    col = dynamic_cast<ast::column_reference const*>(&operands[1].get());
+    lit = dynamic_cast<ast::literal const*>(&operands[0].get());
+    // Mirror the operator so that the column reference is always on the left
+    switch (op) {
+      case ast::ast_operator::LESS: cmp_op = ast::ast_operator::GREATER; break;
+      case ast::ast_operator::LESS_EQUAL: cmp_op = ast::ast_operator::GREATER_EQUAL; break;
+      case ast::ast_operator::GREATER: cmp_op = ast::ast_operator::LESS; break;
+      case ast::ast_operator::GREATER_EQUAL: cmp_op = ast::ast_operator::LESS_EQUAL; break;
+      default: break;
+    }
+  }
+  if (col == nullptr or lit == nullptr) { return std::nullopt; }
+
+  auto const col_type = column_types[col->get_column_index()];
+  if (lit->get_data_type() != col_type) { return std::nullopt; }
+
+  auto const stats = get_stats(col->get_column_index());
+  if (not stats) { return std::nullopt; }
+
+  return cudf::type_dispatcher(
+    col_type, stripe_stats_comparator{*stats}, lit->get_scalar(), cmp_op);
+}
+
 }  // namespace
 
 /**
@@ -471,6 +637,54 @@ class aggregate_orc_metadata {
     return selected_stripes_mapping;
   }
 
+  /**
+   * @brief Prunes a stripe selection using stripe-level column statistics.
+   *
+   * Evaluates `filter` against the decoded min/max statistics of each selected stripe and drops
+   * the stripes that provably contain no matching rows. Statistics that are missing or
+   * inconclusive conservatively keep the stripe.
+   *
+   * @param selection Stripes selected so far, one mapping per source
+   * @param filter AST expression to evaluate against the statistics
+   * @param output_columns Metadata of the top-level output columns
+   * @param column_types cudf types of the top-level output columns
+   * @param row_count Total number of rows across the surviving stripes
+   *
+   * @return Pruned stripe selection
+   */
+  std::vector<cudf::io::orc::metadata::stripe_source_mapping> filter_stripes(
+    std::vector<cudf::io::orc::metadata::stripe_source_mapping>&& selection,
+    ast::expression const& filter,
+    std::vector<orc_column_meta> const& output_columns,
+    std::vector<data_type> const& column_types,
+    size_type& row_count) const
+  {
+    row_count = 0;
+    for (auto& mapping : selection) {
+      auto const& pfm = per_file_metadata[mapping.source_idx];
+      auto const removed =
+        std::remove_if(mapping.stripe_info.begin(), mapping.stripe_info.end(), [&](auto const& stripe) {
+          auto const stripe_idx = static_cast<size_t>(stripe.first - pfm.ff.stripes.data());
+          auto const get_stats =
+            [&](size_type col_idx) -> std::optional<cudf::io::orc::column_statistics> {
+            if (stripe_idx >= pfm.md.stripeStats.size()) { return std::nullopt; }
+            auto const& blobs  = pfm.md.stripeStats[stripe_idx].colStats;
+            auto const col_id = output_columns[col_idx].id;
+            if (col_id >= blobs.size() or blobs[col_id].empty()) { return std::nullopt; }
+            cudf::io::orc::column_statistics stats;
+            ProtobufReader(blobs[col_id].data(), blobs[col_id].size()).read(stats);
+            return stats;
+          };
+          return not evaluate_stats_expression(filter, get_stats, column_types).value_or(true);
+        });
+      mapping.stripe_info.erase(removed, mapping.stripe_info.end());
+      for (auto const& stripe : mapping.stripe_info) {
+        row_count += stripe.first->numberOfRows;
+      }
+    }
+    return std::move(selection);
+  }
+
   /**
    * @brief Adds column as per the request and saves metadata about children.
    *        Children of a column will be added to the next level.
@@ -636,6 +850,7 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
                                  compinfo.size(),
                                  decompressor->GetBlockSize(),
                                  decompressor->GetLog2MaxCompressionRatio(),
+                                 decompressor->GetKind(),
                                  stream);
   compinfo.device_to_host(stream, true);
 
@@ -650,10 +865,13 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
   }
   CUDF_EXPECTS(total_decomp_size > 0, "No decompressible data found");
 
-  rmm::device_buffer decomp_data(total_decomp_size, stream);
+  // Scratch lives only for the duration of the read; keep it out of the pool
+  // that backs column allocations
+  auto* temp_mr = get_temp_memory_resource();
+  rmm::device_buffer decomp_data(total_decomp_size, stream, temp_mr);
   rmm::device_uvector<gpu_inflate_input_s> inflate_in(
-    num_compressed_blocks + num_uncompressed_blocks, stream);
-  rmm::device_uvector<gpu_inflate_status_s> inflate_out(num_compressed_blocks, stream);
+    num_compressed_blocks + num_uncompressed_blocks, stream, temp_mr);
+  rmm::device_uvector<gpu_inflate_status_s> inflate_out(num_compressed_blocks, stream, temp_mr);
 
   // Parse again to populate the decompression input/output buffers
   size_t decomp_offset           = 0;
@@ -679,6 +897,7 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
                                  compinfo.size(),
                                  decompressor->GetBlockSize(),
                                  decompressor->GetLog2MaxCompressionRatio(),
+                                 decompressor->GetKind(),
                                  stream);
 
   // Dispatch batches of blocks to decompress
@@ -1193,6 +1412,9 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
 
   // Control decimals conversion (float64 or int64 with optional scale)
   _decimal_cols_as_float = options.get_decimal_cols_as_float();
+
+  // Optional AST filter used to prune stripes via their statistics
+  _filter = options.get_filter();
 }
 
 table_with_metadata reader::impl::read(size_type skip_rows,
@@ -1215,7 +1437,29 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   if (_selected_columns.size() == 0) return {std::make_unique<table>(), std::move(out_metadata)};
 
   // Select only stripes required (aka row groups)
-  const auto selected_stripes = _metadata->select_stripes(stripes, skip_rows, num_rows);
+  auto selected_stripes = _metadata->select_stripes(stripes, skip_rows, num_rows);
+
+  // Prune stripes whose statistics prove that no row can satisfy the filter
+  if (_filter.has_value()) {
+    CUDF_EXPECTS(skip_rows == 0, "Stripe pruning does not support skip_rows trimming");
+    std::vector<data_type> toplevel_types;
+    std::transform(_selected_columns[0].cbegin(),
+                   _selected_columns[0].cend(),
+                   std::back_inserter(toplevel_types),
+                   [&](auto const& col) {
+                     auto const decimal_as_float64 = should_convert_decimal_column_to_float(
+                       _decimal_cols_as_float, _metadata->per_file_metadata[0], col.id);
+                     return data_type{to_type_id(_metadata->get_col_type(col.id),
+                                                 _use_np_dtypes,
+                                                 _timestamp_type.id(),
+                                                 decimal_as_float64)};
+                   });
+    selected_stripes = _metadata->filter_stripes(std::move(selected_stripes),
+                                                 _filter.value().get(),
+                                                 _selected_columns[0],
+                                                 toplevel_types,
+                                                 num_rows);
+  }
 
   // Iterates through levels of nested columns, child column will be one level down
   // compared to parent column.
@@ -1492,12 +1736,13 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           }
         }
 
-        // Setup table for converting timestamp columns from local to UTC time
+        // Setup table for converting timestamp columns from local to UTC time; built tables are
+        // cached and shared across reads of files written in the same timezone
         auto const tz_table =
           _has_timestamp_column
-            ? build_timezone_transition_table(
+            ? get_cached_timezone_transition_table(
                 selected_stripes[0].stripe_info[0].second->writerTimezone, stream)
-            : timezone_table{};
+            : std::make_shared<timezone_table const>();
 
         for (size_t i = 0; i < column_types.size(); ++i) {
           bool is_nullable = false;
@@ -1518,7 +1763,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           decode_stream_data(chunks,
                              num_dict_entries,
                              skip_rows,
-                             tz_table.view(),
+                             tz_table->view(),
                              row_groups,
                              _metadata->get_row_index_stride(),
                              out_buffers[level],
@@ -1578,6 +1823,50 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
 }
 
+void reader::impl::init_chunking(size_type stripes_per_chunk, orc_reader_options const& options)
+{
+  CUDF_EXPECTS(stripes_per_chunk > 0, "Number of stripes per chunk must be positive");
+  CUDF_EXPECTS(options.get_skip_rows() == 0 && options.get_num_rows() == -1,
+               "Chunked reading does not support skip_rows/num_rows trimming");
+
+  _chunk_options = options;
+
+  // Pack the selected stripes into chunks, honoring an explicit stripe selection when given
+  auto const& user_stripes = options.get_stripes();
+  CUDF_EXPECTS(user_stripes.empty() || user_stripes.size() == _sources.size(),
+               "Must specify stripes for each source");
+  size_type stripes_in_chunk = 0;
+  for (std::size_t src_idx = 0; src_idx < _sources.size(); ++src_idx) {
+    auto const num_stripes =
+      user_stripes.empty()
+        ? static_cast<size_type>(_metadata->per_file_metadata[src_idx].get_num_stripes())
+        : static_cast<size_type>(user_stripes[src_idx].size());
+    for (size_type i = 0; i < num_stripes; ++i) {
+      if (_chunk_stripes.empty() || stripes_in_chunk == stripes_per_chunk) {
+        _chunk_stripes.emplace_back(_sources.size());
+        stripes_in_chunk = 0;
+      }
+      _chunk_stripes.back()[src_idx].push_back(user_stripes.empty() ? i
+                                                                    : user_stripes[src_idx][i]);
+      ++stripes_in_chunk;
+    }
+  }
+}
+
+table_with_metadata reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  // The per-read column mapping state accumulates across reads; reset it so every chunk starts
+  // from a clean slate while the parsed file footers and stripe metadata are reused
+  _col_meta = reader_column_meta{};
+
+  // Once exhausted, keep returning empty tables with the same schema
+  if (!has_next_chunk()) {
+    return read(0, -1, std::vector<std::vector<size_type>>(_sources.size()), stream);
+  }
+
+  return read(0, -1, _chunk_stripes[_current_chunk++], stream);
+}
+
 // Forward to implementation
 reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
                orc_reader_options const& options,
@@ -1596,6 +1885,29 @@ table_with_metadata reader::read(orc_reader_options const& options, rmm::cuda_st
   return _impl->read(
     options.get_skip_rows(), options.get_num_rows(), options.get_stripes(), stream);
 }
+
+// Forward to implementation
+chunked_reader::chunked_reader(size_type stripes_per_chunk,
+                               std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                               orc_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+  : reader(std::move(sources), options, stream, mr)
+{
+  _impl->init_chunking(stripes_per_chunk, options);
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next_chunk(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk() const
+{
+  return _impl->read_chunk(rmm::cuda_stream_default);
+}
 }  // namespace orc
 }  // namespace detail
 }  // namespace io
@@ -29,6 +29,7 @@
 #include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -102,6 +103,31 @@ class reader::impl {
                            const std::vector<std::vector<size_type>>& stripes,
                            rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Split the selected stripes into chunks for iterative reading.
+   *
+   * Stripes are packed into chunks of (at most) `stripes_per_chunk` stripes each, in selection
+   * order, honoring an explicit stripe selection from the options when given.
+   *
+   * @param stripes_per_chunk Number of stripes to return per read
+   * @param options Settings for controlling reading behavior
+   */
+  void init_chunking(size_type stripes_per_chunk, orc_reader_options const& options);
+
+  /**
+   * @brief Check if there is any chunk that has not yet been read.
+   */
+  bool has_next_chunk() const { return _current_chunk < _chunk_stripes.size(); }
+
+  /**
+   * @brief Read the next chunk of stripes and return it as a table.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
+
  private:
   /**
    * @brief Decompresses the stripe data, at stream granularity
@@ -219,6 +245,15 @@ class reader::impl {
   std::vector<std::string> _decimal_cols_as_float;
   data_type _timestamp_type{type_id::EMPTY};
   reader_column_meta _col_meta;
+
+  // Optional AST filter used to prune stripes via their statistics
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+
+  // State for iterative (chunked) reading; unused by the single-shot `read()` path
+  orc_reader_options _chunk_options;
+  // Per-chunk lists of stripe indices, one inner list per source
+  std::vector<std::vector<std::vector<size_type>>> _chunk_stripes;
+  std::size_t _current_chunk = 0;
 };
 
 }  // namespace orc
@@ -31,9 +31,31 @@ struct compressed_stream_s {
   gpu_inflate_input_s ctl;
 };
 
+/**
+ * @brief Reads the uncompressed length varint stored at the start of a snappy stream.
+ *
+ * @return The uncompressed length, or 0 if the header is malformed
+ */
+static __device__ uint32_t snappy_uncompressed_length(const uint8_t* cur, const uint8_t* end)
+{
+  uint32_t len   = 0;
+  uint32_t shift = 0;
+  while (cur < end && shift < 32) {
+    uint32_t const byte = *cur++;
+    len |= (byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) { return len; }
+    shift += 7;
+  }
+  return 0;
+}
+
 // blockDim {128,1,1}
-extern "C" __global__ void __launch_bounds__(128, 8) gpuParseCompressedStripeData(
-  CompressedStreamInfo* strm_info, int32_t num_streams, uint32_t block_size, uint32_t log2maxcr)
+extern "C" __global__ void __launch_bounds__(128, 8)
+  gpuParseCompressedStripeData(CompressedStreamInfo* strm_info,
+                               int32_t num_streams,
+                               uint32_t block_size,
+                               uint32_t log2maxcr,
+                               CompressionKind compression)
 {
   __shared__ compressed_stream_s strm_g[4];
 
@@ -67,12 +89,22 @@ extern "C" __global__ void __launch_bounds__(128, 8) gpuParseCompressedStripeDat
         max_uncompressed_block_size = 0;
         break;
       }
-      // TBD: For some codecs like snappy, it wouldn't be too difficult to get the actual
-      // uncompressed size and avoid waste due to block size alignment For now, rely on the max
-      // compression ratio to limit waste for the most extreme cases (small single-block streams)
-      uncompressed_size = (is_uncompressed)                         ? block_len
-                          : (block_len < (block_size >> log2maxcr)) ? block_len << log2maxcr
-                                                                    : block_size;
+      if (is_uncompressed) {
+        uncompressed_size = block_len;
+      } else if (compression == SNAPPY) {
+        // Snappy stores the uncompressed length as a varint ahead of the data, so the exact
+        // output size is known without decompressing; avoids the block-size worst case below
+        uint32_t exact_size = shuffle(
+          (lane_id == 0) ? snappy_uncompressed_length(cur, min(cur + block_len, end)) : 0);
+        uncompressed_size = (exact_size > 0 && exact_size <= block_size)
+                              ? exact_size
+                              : block_size;  // Malformed header; fall back to the worst case
+      } else {
+        // The exact size is not stored for this codec; rely on the max compression ratio to
+        // limit waste for the most extreme cases (small single-block streams)
+        uncompressed_size =
+          (block_len < (block_size >> log2maxcr)) ? block_len << log2maxcr : block_size;
+      }
       if (is_uncompressed) {
         if (uncompressed_size <= 32) {
           // For short blocks, copy the uncompressed data to output
@@ -517,12 +549,13 @@ void __host__ ParseCompressedStripeData(CompressedStreamInfo* strm_info,
                                         int32_t num_streams,
                                         uint32_t compression_block_size,
                                         uint32_t log2maxcr,
+                                        CompressionKind compression,
                                         rmm::cuda_stream_view stream)
 {
   dim3 dim_block(128, 1);
   dim3 dim_grid((num_streams + 3) >> 2, 1);  // 1 stream per warp, 4 warps per block
   gpuParseCompressedStripeData<<<dim_grid, dim_block, 0, stream.value()>>>(
-    strm_info, num_streams, compression_block_size, log2maxcr);
+    strm_info, num_streams, compression_block_size, log2maxcr, compression);
 }
 
 void __host__ PostDecompressionReassemble(CompressedStreamInfo* strm_info,
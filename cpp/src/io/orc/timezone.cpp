@@ -17,6 +17,8 @@
 
 #include <algorithm>
 #include <fstream>
+#include <mutex>
+#include <unordered_map>
 
 namespace cudf {
 namespace io {
@@ -482,5 +484,23 @@ timezone_table build_timezone_transition_table(std::string const& timezone_name,
   return {gmt_offset, std::move(d_ttimes), std::move(d_offsets)};
 }
 
+std::shared_ptr<timezone_table const> get_cached_timezone_transition_table(
+  std::string const& timezone_name, rmm::cuda_stream_view stream)
+{
+  static std::unordered_map<std::string, std::shared_ptr<timezone_table const>> cache;
+  static std::mutex cache_mutex;
+
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  auto const it = cache.find(timezone_name);
+  if (it != cache.end()) { return it->second; }
+
+  // `build_timezone_transition_table` synchronizes the stream after the device upload, so the
+  // cached table is safe to share with readers running on other streams
+  auto table = std::make_shared<timezone_table const>(
+    build_timezone_transition_table(timezone_name, stream));
+  cache.emplace(timezone_name, table);
+  return table;
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -24,6 +24,7 @@
 #include <rmm/device_uvector.hpp>
 
 #include <stdint.h>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -133,5 +134,19 @@ struct timezone_table {
 timezone_table build_timezone_transition_table(std::string const& timezone_name,
                                                rmm::cuda_stream_view stream);
 
+/**
+ * @brief Returns the transition table for the given timezone, building it on first use.
+ *
+ * Tables are kept in a process-level cache keyed by timezone name, so the TZif file parsing and
+ * the device upload happen only once per timezone; subsequent calls share the same device memory.
+ *
+ * @param timezone_name standard timezone name (for example, "US/Pacific")
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return The transition table for the given timezone
+ */
+std::shared_ptr<timezone_table const> get_cached_timezone_transition_table(
+  std::string const& timezone_name, rmm::cuda_stream_view stream);
+
 }  // namespace io
 }  // namespace cudf
@@ -39,7 +39,9 @@
 #include <nvcomp/snappy.h>
 
 #include <algorithm>
+#include <array>
 #include <cstring>
+#include <future>
 #include <numeric>
 #include <utility>
 
@@ -548,13 +550,11 @@ orc_streams writer::impl::create_streams(host_span<orc_column_view> columns,
       case TypeKind::STRING: {
         bool enable_dict           = enable_dictionary_;
         size_t dict_data_size      = 0;
-        size_t dict_strings        = 0;
         size_t dict_lengths_div512 = 0;
         for (auto const& stripe : segmentation.stripes) {
           const auto sd = column.host_stripe_dict(stripe.id);
           enable_dict   = (enable_dict && sd->dict_data != nullptr);
           if (enable_dict) {
-            dict_strings += sd->num_strings;
             dict_lengths_div512 += (sd->num_strings + 0x1ff) >> 9;
             dict_data_size += sd->dict_char_count;
           }
@@ -568,12 +568,23 @@ orc_streams writer::impl::create_streams(host_span<orc_column_view> columns,
                             return data_size + column.host_dict_chunk(rg_idx)->string_char_count;
                           });
         if (enable_dict) {
-          uint32_t dict_bits = 0;
-          for (dict_bits = 1; dict_bits < 32; dict_bits <<= 1) {
-            if (dict_strings <= (1ull << dict_bits)) break;
+          // Cost the index stream per stripe: each stripe carries its own dictionary, so the
+          // index width is set by the stripe's dictionary size, not the column-wide total.
+          // Using the exact bit width (instead of rounding up to a power of two) keeps large
+          // dictionaries from being costed at 32 bits per row, which used to force large
+          // stripes into direct encoding even when the dictionary was smaller on disk.
+          for (auto const& stripe : segmentation.stripes) {
+            auto const sd      = column.host_stripe_dict(stripe.id);
+            uint32_t dict_bits = 1;
+            while (dict_bits < 32 && sd->num_strings > (1ull << dict_bits)) {
+              ++dict_bits;
+            }
+            auto const stripe_valid_count = std::accumulate(
+              stripe.cbegin(), stripe.cend(), size_t{0}, [&](auto count, auto rg_idx) {
+                return count + column.host_dict_chunk(rg_idx)->num_strings;
+              });
+            dict_data_size += (dict_bits * stripe_valid_count + 7) >> 3;
           }
-          const auto valid_count = column.size() - column.null_count();
-          dict_data_size += (dict_bits * valid_count + 7) >> 3;
         }
 
         // Decide between direct or dictionary encoding
@@ -1223,30 +1234,33 @@ void writer::impl::write_index_stream(int32_t stripe_id,
   stripe->indexLength += buffer_.size();
 }
 
-void writer::impl::write_data_stream(gpu::StripeStream const& strm_desc,
-                                     gpu::encoder_chunk_streams const& enc_stream,
-                                     uint8_t const* compressed_data,
-                                     uint8_t* stream_out,
-                                     StripeInformation* stripe,
-                                     orc_streams* streams)
+std::future<bool> writer::impl::write_data_stream(gpu::StripeStream const& strm_desc,
+                                                  gpu::encoder_chunk_streams const& enc_stream,
+                                                  uint8_t const* compressed_data,
+                                                  uint8_t* stream_out,
+                                                  StripeInformation* stripe,
+                                                  orc_streams* streams)
 {
   const auto length                                        = strm_desc.stream_size;
   (*streams)[enc_stream.ids[strm_desc.stream_type]].length = length;
-  if (length == 0) { return; }
+  if (length == 0) { return std::future<bool>{}; }
 
   const auto* stream_in = (compression_kind_ == NONE) ? enc_stream.data_ptrs[strm_desc.stream_type]
                                                       : (compressed_data + strm_desc.bfr_offset);
 
+  stripe->dataLength += length;
   if (out_sink_->is_device_write_preferred(length)) {
     out_sink_->device_write(stream_in, length, stream);
-  } else {
-    CUDA_TRY(
-      cudaMemcpyAsync(stream_out, stream_in, length, cudaMemcpyDeviceToHost, stream.value()));
-    stream.synchronize();
-
-    out_sink_->host_write(stream_out, length);
+    return std::future<bool>{};
   }
-  stripe->dataLength += length;
+  CUDA_TRY(cudaMemcpyAsync(stream_out, stream_in, length, cudaMemcpyDeviceToHost, stream.value()));
+  stream.synchronize();
+
+  // Queue the sink write so it overlaps the staging of the next stream
+  return write_pool_.submit(
+    [this](uint8_t const* data, size_t size) { out_sink_->host_write(data, size); },
+    static_cast<uint8_t const*>(stream_out),
+    static_cast<size_t>(length));
 }
 
 void writer::impl::add_uncompressed_block_headers(std::vector<uint8_t>& v)
@@ -1277,6 +1291,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
   : _mr(mr),
     stream(stream),
     compression_kind_(to_orc_compression(options.get_compression())),
+    compressor_(options.get_compression()),
     enable_statistics_(options.enable_statistics()),
     single_write_mode(mode == SingleWriteMode::YES),
     out_sink_(std::move(sink))
@@ -1295,6 +1310,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
   : _mr(mr),
     stream(stream),
     compression_kind_(to_orc_compression(options.get_compression())),
+    compressor_(options.get_compression()),
     enable_statistics_(options.enable_statistics()),
     single_write_mode(mode == SingleWriteMode::YES),
     out_sink_(std::move(sink))
@@ -1815,16 +1831,20 @@ void writer::impl::write(table_view const& table)
       max_stream_size = std::max(max_stream_size, stream_size);
     }
 
-    if (all_device_write) {
-      return pinned_buffer<uint8_t>{nullptr, cudaFreeHost};
-    } else {
-      return pinned_buffer<uint8_t>{[](size_t size) {
-                                      uint8_t* ptr = nullptr;
-                                      CUDA_TRY(cudaMallocHost(&ptr, size));
-                                      return ptr;
-                                    }(max_stream_size),
-                                    cudaFreeHost};
+    // Two staging buffers so the sink flush of one stream overlaps the staging of the next
+    std::array<pinned_buffer<uint8_t>, 2> bufs = {pinned_buffer<uint8_t>{nullptr, cudaFreeHost},
+                                                  pinned_buffer<uint8_t>{nullptr, cudaFreeHost}};
+    if (not all_device_write) {
+      for (auto& buf : bufs) {
+        buf = pinned_buffer<uint8_t>{[](size_t size) {
+                                       uint8_t* ptr = nullptr;
+                                       CUDA_TRY(cudaMallocHost(&ptr, size));
+                                       return ptr;
+                                     }(max_stream_size),
+                                     cudaFreeHost};
+      }
     }
+    return bufs;
   }();
 
   // Compress the data streams
@@ -1834,8 +1854,7 @@ void writer::impl::write(table_view const& table)
   if (compression_kind_ != NONE) {
     strm_descs.host_to_device(stream);
     gpu::CompressOrcDataStreams(static_cast<uint8_t*>(compressed_data.data()),
-                                num_compressed_blocks,
-                                compression_kind_,
+                                compressor_,
                                 compression_blocksize_,
                                 max_compressed_block_size,
                                 strm_descs,
@@ -1850,6 +1869,8 @@ void writer::impl::write(table_view const& table)
   ProtobufWriter pbw_(&buffer_);
 
   // Write stripes
+  std::array<std::future<bool>, 2> write_tasks;
+  size_t write_slot = 0;
   for (size_t stripe_id = 0; stripe_id < stripes.size(); ++stripe_id) {
     auto const& rowgroups_range = segmentation.stripes[stripe_id];
     auto& stripe                = stripes[stripe_id];
@@ -1872,12 +1893,31 @@ void writer::impl::write(table_view const& table)
 
     // Column data consisting one or more separate streams
     for (auto const& strm_desc : strm_descs[stripe_id]) {
-      write_data_stream(strm_desc,
-                        enc_data.streams[strm_desc.column_id][rowgroups_range.first],
-                        static_cast<uint8_t*>(compressed_data.data()),
-                        stream_output.get(),
-                        &stripe,
-                        &streams);
+      auto& task = write_tasks[write_slot % 2];
+      // The flush previously queued from this staging slot must finish before reuse; device
+      // writes additionally need all queued host writes drained to keep the sink in file order
+      if (out_sink_->is_device_write_preferred(strm_desc.stream_size)) {
+        for (auto& t : write_tasks) {
+          if (t.valid()) { t.wait(); }
+        }
+      } else if (task.valid()) {
+        task.wait();
+      }
+      auto new_task =
+        write_data_stream(strm_desc,
+                          enc_data.streams[strm_desc.column_id][rowgroups_range.first],
+                          static_cast<uint8_t*>(compressed_data.data()),
+                          stream_output[write_slot % 2].get(),
+                          &stripe,
+                          &streams);
+      if (new_task.valid()) {
+        task = std::move(new_task);
+        write_slot++;
+      }
+    }
+    // Queued data streams must reach the sink before the stripe footer is written
+    for (auto& task : write_tasks) {
+      if (task.valid()) { task.wait(); }
     }
 
     // Write stripefooter consisting of stream information
@@ -20,6 +20,7 @@
 #include "orc_gpu.h"
 
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/thread_pool.hpp>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/io/data_sink.hpp>
@@ -319,19 +320,24 @@ class writer::impl {
   /**
    * @brief Write the specified column's data streams
    *
+   * Host-path writes are staged into `stream_out` and handed to the writer thread; the returned
+   * future becomes valid in that case so the caller can drain before reusing the staging buffer.
+   *
    * @param[in] strm_desc Stream's descriptor
    * @param[in] enc_stream Chunk's streams
    * @param[in] compressed_data Compressed stream data
    * @param[in,out] stream_out Temporary host output buffer
    * @param[in,out] stripe Stream's parent stripe
    * @param[in,out] streams List of all streams
+   *
+   * @return A future for the queued host write, or an invalid future for device-path writes
    */
-  void write_data_stream(gpu::StripeStream const& strm_desc,
-                         gpu::encoder_chunk_streams const& enc_stream,
-                         uint8_t const* compressed_data,
-                         uint8_t* stream_out,
-                         StripeInformation* stripe,
-                         orc_streams* streams);
+  std::future<bool> write_data_stream(gpu::StripeStream const& strm_desc,
+                                      gpu::encoder_chunk_streams const& enc_stream,
+                                      uint8_t const* compressed_data,
+                                      uint8_t* stream_out,
+                                      StripeInformation* stripe,
+                                      orc_streams* streams);
 
   /**
    * @brief Insert 3-byte uncompressed block headers in a byte vector
@@ -349,6 +355,8 @@ class writer::impl {
   size_t row_index_stride_          = default_row_index_stride;
   size_t compression_blocksize_     = DEFAULT_COMPRESSION_BLOCKSIZE;
   CompressionKind compression_kind_ = CompressionKind::NONE;
+  // Block compressor with reusable scratch, shared by all stripes and table writes
+  batched_compressor compressor_;
 
   bool enable_dictionary_ = true;
   bool enable_statistics_ = true;
@@ -368,6 +376,8 @@ class writer::impl {
 
   std::vector<uint8_t> buffer_;
   std::unique_ptr<data_sink> out_sink_;
+  // Dedicated writer thread so stripe flushes overlap encoding without reordering the sink
+  cudf::detail::thread_pool write_pool_{1};
 };
 
 }  // namespace orc
@@ -74,6 +74,18 @@ struct page_state_s {
   uint32_t dict_idx[non_zero_buffer_size];  // Dictionary index, boolean, or string offset values
   uint32_t str_len[non_zero_buffer_size];   // String length for plain encoding of strings
 
+  // DELTA_BINARY_PACKED decoding
+  int32_t delta_block_size;       // values per block
+  int32_t delta_mini_count;       // miniblocks per block
+  int32_t delta_values_per_mini;  // values per miniblock
+  int32_t delta_mini_idx;         // current miniblock within the block
+  int32_t delta_pos_in_mini;      // values consumed from the current miniblock
+  int32_t delta_bitwidth;         // bit width of the current miniblock
+  int64_t delta_min_delta;        // minimum delta of the current block
+  int64_t delta_last_value;       // last decoded value (running base)
+  const uint8_t* delta_bw;        // current block's miniblock bit widths
+  int64_t delta_value[non_zero_buffer_size];  // circular buffer of decoded values
+
   // repetition/definition level decoding
   int32_t input_value_count;                  // how many values of the input we've processed
   int32_t input_row_count;                    // how many rows of the input we've processed
@@ -167,6 +179,33 @@ inline __device__ uint32_t get_vlq32(const uint8_t*& cur, const uint8_t* end)
   return v;
 }
 
+/**
+ * @brief Read a 64-bit varint integer
+ *
+ * @param[in,out] cur The current data position, updated after the read
+ * @param[in] end The end data position
+ *
+ * @return The 64-bit value read
+ */
+inline __device__ uint64_t get_vlq64(const uint8_t*& cur, const uint8_t* end)
+{
+  uint64_t v = 0;
+  for (uint32_t l = 0; l < 64 && cur < end; l += 7) {
+    uint64_t const c = *cur++;
+    v |= (c & 0x7f) << l;
+    if (c < 0x80) { break; }
+  }
+  return v;
+}
+
+/**
+ * @brief Convert a zigzag-encoded unsigned 64-bit value to a signed 64-bit value
+ */
+inline __device__ int64_t zigzag64(uint64_t v)
+{
+  return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1);
+}
+
 /**
  * @brief Parse the beginning of the level section (definition or repetition),
  * initializes the initial RLE run & value, and returns the section length
@@ -467,6 +506,98 @@ __device__ int gpuDecodeRleBooleans(volatile page_state_s* s, int target_pos, in
   return pos;
 }
 
+/**
+ * @brief Decode DELTA_BINARY_PACKED values into the delta_value circular buffer
+ *
+ * One warp cooperatively decodes batches of up to 32 values: thread 0 maintains the
+ * block/miniblock read state, every thread unpacks one delta, and a warp-wide inclusive
+ * scan turns the deltas into absolute values. The first value of the page comes from the
+ * page header and consumes no deltas.
+ *
+ * @param[in,out] s Page state input/output
+ * @param[in] target_pos Target write position
+ * @param[in] t Warp1 thread ID (0..31)
+ *
+ * @return The new output position
+ */
+__device__ int gpuDecodeDeltaBinary(volatile page_state_s* s, int target_pos, int t)
+{
+  const uint8_t* end = s->data_end;
+  int pos            = s->dict_pos;
+
+  if (pos == 0 && target_pos > 0) {
+    if (!t) { s->delta_value[0] = s->delta_last_value; }
+    pos = 1;
+  }
+
+  while (pos < target_pos && !s->error) {
+    if (!t) {
+      if (s->delta_pos_in_mini >= s->delta_values_per_mini) {
+        // Finished the current miniblock; skip past its packed data
+        s->data_start += (s->delta_values_per_mini * s->delta_bitwidth + 7) >> 3;
+        s->delta_mini_idx++;
+        if (s->delta_mini_idx >= s->delta_mini_count) {
+          // Block header: <min delta> <miniblock bit widths>
+          const uint8_t* cur = s->data_start;
+          if (cur < end) {
+            s->delta_min_delta = zigzag64(get_vlq64(cur, end));
+            s->delta_bw        = cur;
+            s->data_start      = cur + s->delta_mini_count;
+            s->delta_mini_idx  = 0;
+          } else {
+            s->error = 2;
+          }
+        }
+        if (!s->error) {
+          s->delta_bitwidth    = s->delta_bw[s->delta_mini_idx];
+          s->delta_pos_in_mini = 0;
+          if (s->delta_bitwidth > 64 || s->data_start > end) {
+            s->error = (10 << 8) | s->delta_bitwidth;
+          }
+        }
+      }
+      __threadfence_block();
+    }
+    __syncwarp();
+    if (s->error) { break; }
+
+    int const bitwidth  = s->delta_bitwidth;
+    int const in_mini   = s->delta_pos_in_mini;
+    int const batch_len = min(min(32, s->delta_values_per_mini - in_mini), target_pos - pos);
+
+    // Each thread unpacks the delta at its position within the miniblock
+    int64_t delta = 0;
+    if (t < batch_len && bitwidth > 0) {
+      int64_t ofs      = static_cast<int64_t>(in_mini + t) * bitwidth;
+      const uint8_t* p = s->data_start + (ofs >> 3);
+      ofs &= 7;
+      if (p < end) {
+        uint64_t v = (*p++) >> ofs;
+        for (int c = 8 - ofs; c < bitwidth && p < end; c += 8) {
+          v |= static_cast<uint64_t>(*p++) << c;
+        }
+        if (bitwidth < 64) { v &= (1ul << bitwidth) - 1; }
+        delta = static_cast<int64_t>(v);
+      }
+    }
+    if (t < batch_len) { delta += s->delta_min_delta; }
+
+    // Warp inclusive scan turns the deltas into offsets from the running base
+    for (int d = 1; d < 32; d <<= 1) {
+      int64_t const n = __shfl_up_sync(0xffffffff, delta, d);
+      if (t >= d) { delta += n; }
+    }
+    int64_t const value = s->delta_last_value + delta;
+    if (t < batch_len) { s->delta_value[rolling_index(pos + t)] = value; }
+    __syncwarp();
+    if (t == batch_len - 1) { s->delta_last_value = value; }
+    __syncwarp();
+    if (!t) { s->delta_pos_in_mini = in_mini + batch_len; }
+    pos += batch_len;
+  }
+  return pos;
+}
+
 /**
  * @brief Parses the length and position of strings
  *
@@ -516,6 +647,13 @@ inline __device__ void gpuOutputString(volatile page_state_s* s, int src_pos, vo
   const char* ptr = NULL;
   size_t len      = 0;
 
+  if (s->dtype_len == 4 && s->col.output_string_index) {
+    // Preserve the raw dictionary index so the host can assemble a dictionary column
+    *static_cast<uint32_t*>(dstv) =
+      (s->dict_bits > 0) ? s->dict_idx[src_pos & (non_zero_buffer_size - 1)] : 0;
+    return;
+  }
+
   if (s->dict_base) {
     // String dictionary
     uint32_t dict_pos = (s->dict_bits > 0) ? s->dict_idx[src_pos & (non_zero_buffer_size - 1)] *
@@ -817,15 +955,17 @@ inline __device__ void gpuOutputDecimalAsFloat(volatile page_state_s* s,
 }
 
 /**
- * @brief Output a fixed-length byte array(len <= 8) as a 64-bit int
+ * @brief Output a fixed-length byte array (len <= sizeof(T)) as an integer of type T
  *
+ * @tparam T Output integer type (int64_t for DECIMAL64, __int128_t for DECIMAL128)
  * @param[in,out] s Page state input/output
  * @param[in] src_pos Source position
  * @param[in] dst Pointer to row output data
  */
-inline __device__ void gpuOutputFixedLenByteArrayAsInt64(volatile page_state_s* s,
-                                                         int src_pos,
-                                                         int64_t* dst)
+template <typename T>
+inline __device__ void gpuOutputFixedLenByteArrayAsInt(volatile page_state_s* s,
+                                                       int src_pos,
+                                                       T* dst)
 {
   uint32_t const dtype_len_in = s->dtype_len_in;
   uint8_t const* data         = s->dict_base ? s->dict_base : s->data_start;
@@ -835,18 +975,52 @@ inline __device__ void gpuOutputFixedLenByteArrayAsInt64(volatile page_state_s*
     dtype_len_in;
   uint32_t const dict_size = s->dict_size;
 
-  int64_t unscaled64 = 0;
+  T unscaled = 0;
   for (unsigned int i = 0; i < dtype_len_in; i++) {
     uint32_t v = (pos + i < dict_size) ? data[pos + i] : 0;
-    unscaled64 = (unscaled64 << 8) | v;
+    unscaled   = (unscaled << 8) | v;
   }
-  // Shift the unscaled value up and back down when it isn't all 8 bytes,
+  // Shift the unscaled value up and back down when it isn't all sizeof(T) bytes,
   // which sign extend the value for correctly representing negative numbers.
-  if (dtype_len_in < 8) {
-    unscaled64 <<= 64 - dtype_len_in * 8;
-    unscaled64 >>= 64 - dtype_len_in * 8;
+  if (dtype_len_in < sizeof(T)) {
+    unscaled <<= (sizeof(T) - dtype_len_in) * 8;
+    unscaled >>= (sizeof(T) - dtype_len_in) * 8;
+  }
+  *dst = unscaled;
+}
+
+/**
+ * @brief Output a decoded DELTA_BINARY_PACKED value
+ *
+ * @param[in,out] s Page state input/output
+ * @param[in] src_pos Source position
+ * @param[in] dst Pointer to row output data
+ * @param[in] dtype_len Output data type length
+ */
+inline __device__ void gpuOutputDelta(volatile page_state_s* s,
+                                      int src_pos,
+                                      void* dst,
+                                      uint32_t dtype_len)
+{
+  int64_t const value = s->delta_value[src_pos & (non_zero_buffer_size - 1)];
+  if (dtype_len == 8) {
+    int64_t ts = value;
+    // Output timestamps at the desired clock rate
+    if (s->ts_scale < 0) {
+      // round towards negative infinity
+      int const sign = (ts < 0);
+      ts             = ((ts + sign) / -s->ts_scale) + sign;
+    } else if (s->ts_scale > 0) {
+      ts = ts * s->ts_scale;
+    }
+    *static_cast<int64_t*>(dst) = ts;
+  } else if (dtype_len == 4) {
+    *static_cast<int32_t*>(dst) = static_cast<int32_t>(value);
+  } else if (dtype_len == 2) {
+    *static_cast<int16_t*>(dst) = static_cast<int16_t>(value);
+  } else {
+    *static_cast<int8_t*>(dst) = static_cast<int8_t>(value);
   }
-  *dst = unscaled64;
 }
 
 /**
@@ -1021,7 +1195,9 @@ static __device__ bool setupLocalPageInfo(page_state_s* const s,
       s->dtype_len_in          = s->dtype_len;
       uint16_t const data_type = s->col.data_type & 7;
       if (s->col.converted_type == DECIMAL && data_type != INT32 && data_type != INT64) {
-        s->dtype_len = 8;  // FLOAT output
+        // Fixed-length byte arrays decode to DECIMAL64 (<= 8 bytes), DECIMAL128 (<= 16 bytes)
+        // or, beyond that, FLOAT64
+        s->dtype_len = (s->dtype_len_in > 8 && s->dtype_len_in <= 16) ? 16 : 8;
       } else if (data_type == INT32) {
         if (dtype_len_out == 1) s->dtype_len = 1;  // INT8 output
         if (dtype_len_out == 2) s->dtype_len = 2;  // INT16 output
@@ -1112,6 +1288,30 @@ static __device__ bool setupLocalPageInfo(page_state_s* const s,
           if ((s->col.data_type & 7) == BOOLEAN) { s->dict_run = s->dict_size * 2 + 1; }
           break;
         case Encoding::RLE: s->dict_run = 0; break;
+        case Encoding::DELTA_BINARY_PACKED: {
+          if ((s->col.data_type & 7) != INT32 && (s->col.data_type & 7) != INT64) {
+            s->error = 1;  // Delta binary packing is only defined for INT32/INT64
+            break;
+          }
+          // Header: <block size> <miniblocks per block> <total value count> <first value>
+          const uint8_t* hdr  = cur;
+          s->delta_block_size = get_vlq32(hdr, end);
+          s->delta_mini_count = get_vlq32(hdr, end);
+          get_vlq32(hdr, end);  // total value count; the page header already carries it
+          s->delta_last_value = zigzag64(get_vlq64(hdr, end));
+          if (hdr > end || s->delta_mini_count <= 0 ||
+              s->delta_block_size % s->delta_mini_count != 0) {
+            s->error = 1;
+            break;
+          }
+          s->delta_values_per_mini = s->delta_block_size / s->delta_mini_count;
+          // Force a block header read on the first decoded batch
+          s->delta_mini_idx    = s->delta_mini_count;
+          s->delta_pos_in_mini = s->delta_values_per_mini;
+          s->delta_bitwidth    = 0;
+          cur                  = const_cast<uint8_t*>(hdr);
+          break;
+        }
         default:
           s->error = 1;  // Unsupported encoding
           break;
@@ -1627,6 +1827,23 @@ extern "C" __global__ void __launch_bounds__(block_size)
 
   bool has_repetition = s->col.max_level[level_type::REPETITION] > 0;
 
+  // Non-repeated (flat or struct-only) pages carry exactly one level entry per row, so their
+  // sizes are derivable directly from the value count without decoding any level streams. In
+  // particular this covers dictionary-encoded string pages, whose actual byte sizes come from
+  // the dictionary entry lengths at decode time.
+  if (!has_repetition) {
+    if (!t) {
+      int const page_rows = trim_pass ? s->num_rows : s->page.num_input_values;
+      for (int idx = 0; idx < s->page.num_nesting_levels; idx++) {
+        s->page.nesting[idx].size = page_rows;
+      }
+      pp->num_rows            = page_rows;
+      pp->skipped_values      = trim_pass ? s->first_row : -1;
+      pp->skipped_leaf_values = trim_pass ? s->first_row : -1;
+    }
+    return;
+  }
+
   // optimization : it might be useful to have a version of gpuDecodeStream that could go
   // wider than 1 warp.  Currently it only only uses 1 warp so that it can overlap work
   // with the value decoding step when in the actual value decoding kernel.  however during
@@ -1696,8 +1913,10 @@ extern "C" __global__ void __launch_bounds__(block_size)
   if (s->dict_base) {
     out_thread0 = (s->dict_bits > 0) ? 64 : 32;
   } else {
-    out_thread0 =
-      ((s->col.data_type & 7) == BOOLEAN || (s->col.data_type & 7) == BYTE_ARRAY) ? 64 : 32;
+    out_thread0 = ((s->col.data_type & 7) == BOOLEAN || (s->col.data_type & 7) == BYTE_ARRAY ||
+                   s->page.encoding == Encoding::DELTA_BINARY_PACKED)
+                    ? 64
+                    : 32;
   }
 
   // skipped_leaf_values will always be 0 for flat hierarchies.
@@ -1727,6 +1946,8 @@ extern "C" __global__ void __launch_bounds__(block_size)
       // WARP1: Decode dictionary indices, booleans or string positions
       if (s->dict_base) {
         src_target_pos = gpuDecodeDictionaryIndices(s, src_target_pos, t & 0x1f);
+      } else if (s->page.encoding == Encoding::DELTA_BINARY_PACKED) {
+        src_target_pos = gpuDecodeDeltaBinary(s, src_target_pos, t & 0x1f);
       } else if ((s->col.data_type & 7) == BOOLEAN) {
         src_target_pos = gpuDecodeRleBooleans(s, src_target_pos, t & 0x1f);
       } else if ((s->col.data_type & 7) == BYTE_ARRAY) {
@@ -1769,7 +1990,9 @@ extern "C" __global__ void __launch_bounds__(block_size)
         uint32_t dtype_len = s->dtype_len;
         void* dst =
           s->page.nesting[leaf_level_index].data_out + static_cast<size_t>(dst_pos) * dtype_len;
-        if (dtype == BYTE_ARRAY) {
+        if (s->page.encoding == Encoding::DELTA_BINARY_PACKED) {
+          gpuOutputDelta(s, val_src_pos, dst, dtype_len);
+        } else if (dtype == BYTE_ARRAY) {
           gpuOutputString(s, val_src_pos, dst);
         } else if (dtype == BOOLEAN) {
           gpuOutputBoolean(s, val_src_pos, static_cast<uint8_t*>(dst));
@@ -1778,9 +2001,11 @@ extern "C" __global__ void __launch_bounds__(block_size)
             case INT32: gpuOutputFast(s, val_src_pos, static_cast<uint32_t*>(dst)); break;
             case INT64: gpuOutputFast(s, val_src_pos, static_cast<uint2*>(dst)); break;
             default:
-              // we currently do not support reading byte arrays larger than DECIMAL64
+              // byte arrays larger than DECIMAL128 are read as doubles
               if (s->dtype_len_in <= 8) {
-                gpuOutputFixedLenByteArrayAsInt64(s, val_src_pos, static_cast<int64_t*>(dst));
+                gpuOutputFixedLenByteArrayAsInt(s, val_src_pos, static_cast<int64_t*>(dst));
+              } else if (s->dtype_len_in <= 16) {
+                gpuOutputFixedLenByteArrayAsInt(s, val_src_pos, static_cast<__int128_t*>(dst));
               } else {
                 gpuOutputDecimalAsFloat(s, val_src_pos, static_cast<double*>(dst), dtype);
               }
@@ -1869,6 +2094,7 @@ void PreprocessColumnData(hostdevice_vector<PageInfo>& pages,
                           std::vector<cudf::io::detail::column_buffer>& output_columns,
                           size_t num_rows,
                           size_t min_row,
+                          std::vector<int32_t>* page_row_counts,
                           rmm::cuda_stream_view stream,
                           rmm::mr::device_memory_resource* mr)
 {
@@ -1878,9 +2104,26 @@ void PreprocessColumnData(hostdevice_vector<PageInfo>& pages,
   // computes:
   // PageNestingInfo::size for each level of nesting, for each page.
   // The output from this does not take row bounds (num_rows, min_row) into account
-  gpuComputePageSizes<<<dim_grid, dim_block, 0, stream.value()>>>(
-    pages.device_ptr(), chunks.device_ptr(), min_row, num_rows, chunks.size(), false);
-  stream.synchronize();
+  if (page_row_counts != nullptr && page_row_counts->size() == pages.size()) {
+    // the caller supplied the untrimmed per-page row counts from a previous read of the
+    // same file, which is the only output of this pass consumed downstream
+    for (size_t idx = 0; idx < pages.size(); idx++) {
+      pages[idx].num_rows = (*page_row_counts)[idx];
+    }
+    pages.host_to_device(stream);
+  } else {
+    gpuComputePageSizes<<<dim_grid, dim_block, 0, stream.value()>>>(
+      pages.device_ptr(), chunks.device_ptr(), min_row, num_rows, chunks.size(), false);
+    stream.synchronize();
+    if (page_row_counts != nullptr) {
+      // harvest the untrimmed row counts so the caller can reuse them on later reads
+      pages.device_to_host(stream, true);
+      page_row_counts->resize(pages.size());
+      for (size_t idx = 0; idx < pages.size(); idx++) {
+        (*page_row_counts)[idx] = pages[idx].num_rows;
+      }
+    }
+  }
 
   // computes:
   // PageInfo::chunk_row for all pages
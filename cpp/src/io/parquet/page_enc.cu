@@ -175,10 +175,12 @@ __global__ void __launch_bounds__(block_size)
       s->frag.num_values = s->frag.num_rows;
     }
   }
-  dtype     = s->col.physical_type;
+  dtype = s->col.physical_type;
+  // The only FIXED_LEN_BYTE_ARRAY the writer produces is a 16-byte DECIMAL128
   dtype_len = (dtype == INT96)                      ? 12
               : (dtype == INT64 || dtype == DOUBLE) ? 8
               : (dtype == BOOLEAN)                  ? 1
+              : (dtype == FIXED_LEN_BYTE_ARRAY)     ? 16
                                                     : 4;
   __syncthreads();
 
@@ -875,6 +877,7 @@ __global__ void __launch_bounds__(128, 8)
   dtype_len_out = (dtype == INT96)                      ? 12
                   : (dtype == INT64 || dtype == DOUBLE) ? 8
                   : (dtype == BOOLEAN)                  ? 1
+                  : (dtype == FIXED_LEN_BYTE_ARRAY)     ? 16
                                                         : 4;
   if (dtype == INT32) {
     dtype_len_in = GetDtypeLogicalLen(s->col.leaf_column);
@@ -1083,6 +1086,13 @@ __global__ void __launch_bounds__(128, 8)
             dst[pos + 3] = v >> 24;
             if (v != 0) memcpy(dst + pos + 4, str.data(), v);
           } break;
+          case FIXED_LEN_BYTE_ARRAY: {
+            // DECIMAL128: big-endian two's complement of the unscaled value
+            auto v = s->col.leaf_column->element<__int128_t>(val_idx);
+            for (uint32_t i = 0; i < sizeof(__int128_t); i++) {
+              dst[pos + i] = static_cast<uint8_t>(v >> (8 * (sizeof(__int128_t) - 1 - i)));
+            }
+          } break;
         }
       }
       __syncthreads();
@@ -1294,7 +1304,9 @@ __device__ uint8_t* EncodeStatistics(uint8_t* start,
   }
   header_encoder encoder(start);
   encoder.field_int64(3, s->null_count);
-  if (s->has_minmax) {
+  // Gathered extrema are 64-bit values; omit min/max rather than emit truncated
+  // statistics for 16-byte DECIMAL128 columns
+  if (s->has_minmax && dtype != dtype_decimal128) {
     const void *vmin, *vmax;
     uint32_t lmin, lmax;
 
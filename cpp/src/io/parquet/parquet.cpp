@@ -244,6 +244,17 @@ bool CompactProtocolReader::read(ColumnChunkMetaData* c)
   return function_builder(this, op);
 }
 
+bool CompactProtocolReader::read(Statistics* s)
+{
+  auto op = std::make_tuple(ParquetFieldBinary(1, s->max),
+                            ParquetFieldBinary(2, s->min),
+                            ParquetFieldInt64(3, s->null_count),
+                            ParquetFieldInt64(4, s->distinct_count),
+                            ParquetFieldBinary(5, s->max_value),
+                            ParquetFieldBinary(6, s->min_value));
+  return function_builder(this, op);
+}
+
 bool CompactProtocolReader::read(PageHeader* p)
 {
   auto op = std::make_tuple(ParquetFieldEnum<PageType>(1, p->type),
@@ -228,6 +228,55 @@ struct ColumnChunkMetaData {
   std::vector<uint8_t> statistics_blob;  // Encoded chunk-level statistics as binary blob
 };
 
+/**
+ * @brief Thrift-derived struct describing column chunk statistics
+ *
+ * `min`/`max` are the deprecated fields (signed comparison order); `min_value`/`max_value` use
+ * the logical-type defined sort order and take precedence when present. Values are plain-encoded
+ * in the column's physical type.
+ */
+struct Statistics {
+  std::vector<uint8_t> max;        // deprecated max value in signed comparison order
+  std::vector<uint8_t> min;        // deprecated min value in signed comparison order
+  int64_t null_count     = -1;     // count of null values in the column
+  int64_t distinct_count = -1;     // count of distinct values occurring
+  std::vector<uint8_t> max_value;  // max value for column determined by ColumnOrder
+  std::vector<uint8_t> min_value;  // min value for column determined by ColumnOrder
+};
+
+/**
+ * @brief Thrift-derived struct describing the location of a data page within a file
+ */
+struct PageLocation {
+  int64_t offset               = 0;  // Offset of the page in the file
+  int32_t compressed_page_size = 0;  // Size of the page, including header
+  int64_t first_row_index      = 0;  // Index of the first row of the page within the row group
+};
+
+/**
+ * @brief Thrift-derived struct describing the location of all data pages of a column chunk
+ *
+ * Stored separately from the footer so that readers can locate pages without decoding any
+ * page headers.
+ */
+struct OffsetIndex {
+  std::vector<PageLocation> page_locations;
+};
+
+/**
+ * @brief Thrift-derived struct describing per-page statistics of a column chunk
+ *
+ * Together with the OffsetIndex this allows readers to skip individual pages based on
+ * min/max bounds. `min_values`/`max_values` are plain-encoded in the column's physical type.
+ */
+struct ColumnIndex {
+  std::vector<bool> null_pages;                 // Whether a page contains only null values
+  std::vector<std::vector<uint8_t>> min_values;  // Lower bound of values per page
+  std::vector<std::vector<uint8_t>> max_values;  // Upper bound of values per page
+  int32_t boundary_order = 0;                    // BoundaryOrder::UNORDERED
+  std::vector<int64_t> null_counts;              // Number of null values per page
+};
+
 /**
  * @brief Thrift-derived struct describing a chunk of data for a particular
  * column
@@ -428,6 +477,7 @@ class CompactProtocolReader {
   bool read(DataPageHeader* d);
   bool read(DictionaryPageHeader* d);
   bool read(KeyValue* k);
+  bool read(Statistics* s);
 
  public:
   static int NumRequiredBits(uint32_t max_level) noexcept
@@ -455,6 +505,7 @@ class CompactProtocolReader {
   template <typename T>
   friend class ParquetFieldStructListFunctor;
   friend class ParquetFieldString;
+  friend class ParquetFieldBinary;
   template <typename T>
   friend class ParquetFieldStructFunctor;
   template <typename T, bool>
@@ -619,6 +670,35 @@ class ParquetFieldString {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to read a binary value from CompactProtocolReader
+ *
+ * @return True if field type mismatches or if size of binary exceeds bounds
+ * of the CompactProtocolReader
+ */
+class ParquetFieldBinary {
+  int field_val;
+  std::vector<uint8_t>& val;
+
+ public:
+  ParquetFieldBinary(int f, std::vector<uint8_t>& v) : field_val(f), val(v) {}
+
+  inline bool operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    if (field_type != ST_FLD_BINARY) return true;
+    uint32_t n = cpr->get_u32();
+    if (n < (size_t)(cpr->m_end - cpr->m_cur)) {
+      val.assign(cpr->m_cur, cpr->m_cur + n);
+      cpr->m_cur += n;
+      return false;
+    } else {
+      return true;
+    }
+  }
+
+  int field() { return field_val; }
+};
+
 /**
  * @brief Functor to read a structure from CompactProtocolReader
  *
@@ -190,6 +190,7 @@ struct ColumnChunkDesc {
       max_num_pages(0),
       page_info(nullptr),
       str_dict_index(nullptr),
+      output_string_index(0),
       valid_map_base{nullptr},
       column_data_base{nullptr},
       codec(codec_),
@@ -218,6 +219,8 @@ struct ColumnChunkDesc {
   PageInfo* page_info;                        // output page info for up to num_dict_pages +
                                               // num_data_pages (dictionary pages first)
   string_index_pair* str_dict_index;          // index for string dictionary
+  uint8_t output_string_index;                // nonzero: 32-bit string output is the raw
+                                              // dictionary index rather than a hash
   uint32_t** valid_map_base;                  // base pointers of valid bit map for this column
   void** column_data_base;                    // base pointers of column data
   int8_t codec;                               // compressed codec enum
@@ -390,6 +393,9 @@ void BuildStringDictionaryIndex(ColumnChunkDesc* chunks,
  * @param[in,out] output_columns Output column information
  * @param[in] num_rows Maximum number of rows to read
  * @param[in] min_rows crop all rows below min_row
+ * @param[in,out] page_row_counts Optional untrimmed per-page row counts. If its size matches
+ * `pages`, the full (untrimmed) sizing pass is skipped and the counts are applied directly;
+ * otherwise it is filled with the computed counts for reuse on later reads of the same file
  * @param[in] stream Cuda stream
  */
 void PreprocessColumnData(hostdevice_vector<PageInfo>& pages,
@@ -398,6 +404,7 @@ void PreprocessColumnData(hostdevice_vector<PageInfo>& pages,
                           std::vector<cudf::io::detail::column_buffer>& output_columns,
                           size_t num_rows,
                           size_t min_row,
+                          std::vector<int32_t>* page_row_counts,
                           rmm::cuda_stream_view stream,
                           rmm::mr::device_memory_resource* mr);
 
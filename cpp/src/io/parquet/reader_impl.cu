@@ -22,11 +22,21 @@
 #include "reader_impl.hpp"
 
 #include <io/comp/gpuinflate.h>
+#include <io/utilities/pinned_pool.hpp>
 
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
@@ -34,10 +44,18 @@
 #include <rmm/exec_policy.hpp>
 
 #include <nvcomp/snappy.h>
+#include <nvcomp/zstd.h>
+
+#include <sys/stat.h>
 
 #include <algorithm>
 #include <array>
+#include <cstring>
+#include <functional>
+#include <mutex>
 #include <numeric>
+#include <optional>
+#include <unordered_map>
 #include <regex>
 
 namespace cudf {
@@ -142,6 +160,8 @@ type_id to_type_id(SchemaElement const& schema,
         return type_id::DECIMAL64;
       else if (physical == parquet::FIXED_LEN_BYTE_ARRAY && schema.type_length <= 8) {
         return type_id::DECIMAL64;
+      } else if (physical == parquet::FIXED_LEN_BYTE_ARRAY && schema.type_length <= 16) {
+        return type_id::DECIMAL128;
       } else {
         CUDF_EXPECTS(strict_decimal_types == false, "Unsupported decimal type read!");
         return type_id::FLOAT64;
@@ -227,7 +247,8 @@ std::tuple<int32_t, int32_t, int8_t> conversion_info(type_id column_type_id,
 
   int8_t converted_type = converted;
   if (converted_type == parquet::DECIMAL && column_type_id != type_id::FLOAT64 &&
-      column_type_id != type_id::DECIMAL32 && column_type_id != type_id::DECIMAL64) {
+      column_type_id != type_id::DECIMAL32 && column_type_id != type_id::DECIMAL64 &&
+      column_type_id != type_id::DECIMAL128) {
     converted_type = parquet::UNKNOWN;  // Not converting to float64 or decimal
   }
   return std::make_tuple(type_width, clock_rate, converted_type);
@@ -276,6 +297,9 @@ std::string name_from_path(const std::vector<std::string>& path_in_schema)
  * @brief Class for parsing dataset metadata
  */
 struct metadata : public FileMetaData {
+  // Construct from a cached footer that has already been parsed and schema-initialized
+  explicit metadata(FileMetaData const& cached) : FileMetaData(cached) {}
+
   explicit metadata(datasource* source)
   {
     constexpr auto header_len = sizeof(file_header_s);
@@ -299,6 +323,173 @@ struct metadata : public FileMetaData {
   }
 };
 
+namespace {
+
+/**
+ * @brief Process-wide cache of parsed footers for repeatedly scanned files.
+ *
+ * Guarded by `footer_cache_mutex()`. Entries are keyed on the file's path, modification time
+ * and size (see `footer_cache_key`), so files rewritten in place are parsed again.
+ */
+std::unordered_map<std::string, FileMetaData>& footer_cache()
+{
+  static std::unordered_map<std::string, FileMetaData> cache;
+  return cache;
+}
+
+std::mutex& footer_cache_mutex()
+{
+  static std::mutex mtx;
+  return mtx;
+}
+
+/**
+ * @brief Build a footer cache key identifying the file's current contents, or an empty string
+ * if the file cannot be stat'd.
+ */
+std::string footer_cache_key(std::string const& path)
+{
+  struct stat st;
+  if (stat(path.c_str(), &st) != 0) { return std::string{}; }
+  return path + ":" + std::to_string(st.st_mtime) + ":" + std::to_string(st.st_size);
+}
+
+/**
+ * @brief Process-wide cache of the untrimmed per-page row counts computed by the page sizing
+ * pass of nested reads.
+ *
+ * Guarded by `page_row_counts_cache_mutex()`. Entries are keyed on the footer cache keys of
+ * the sources plus the chunk selection, so a different column or row group selection over the
+ * same file computes its own entry.
+ */
+std::unordered_map<std::string, std::vector<int32_t>>& page_row_counts_cache()
+{
+  static std::unordered_map<std::string, std::vector<int32_t>> cache;
+  return cache;
+}
+
+std::mutex& page_row_counts_cache_mutex()
+{
+  static std::mutex mtx;
+  return mtx;
+}
+
+/**
+ * @brief Functor that compares one column chunk's min/max statistics against a literal.
+ *
+ * Returns true/false when the statistics prove that some/no row in the chunk can satisfy
+ * `stat op literal`, and `std::nullopt` when the statistics are unusable for the given type.
+ */
+struct stats_comparator {
+  template <typename T,
+            std::enable_if_t<cudf::is_fixed_width<T>() and not cudf::is_fixed_point<T>()>* = nullptr>
+  std::optional<bool> operator()(std::vector<uint8_t> const& min_bytes,
+                                 std::vector<uint8_t> const& max_bytes,
+                                 cudf::scalar const& literal,
+                                 ast::ast_operator op) const
+  {
+    // Plain-encoded statistics of a fixed-width physical type match the in-memory representation
+    if (min_bytes.size() != sizeof(T) or max_bytes.size() != sizeof(T)) { return std::nullopt; }
+    T stat_min{};
+    T stat_max{};
+    std::memcpy(&stat_min, min_bytes.data(), sizeof(T));
+    std::memcpy(&stat_max, max_bytes.data(), sizeof(T));
+
+    auto const& typed_scalar = static_cast<cudf::scalar_type_t<T> const&>(literal);
+    if (not typed_scalar.is_valid()) { return std::nullopt; }
+    auto const value = typed_scalar.value();
+
+    switch (op) {
+      case ast::ast_operator::EQUAL: return not(value < stat_min or stat_max < value);
+      case ast::ast_operator::NOT_EQUAL: return not(stat_min == stat_max and stat_min == value);
+      case ast::ast_operator::LESS: return stat_min < value;
+      case ast::ast_operator::LESS_EQUAL: return not(value < stat_min);
+      case ast::ast_operator::GREATER: return value < stat_max;
+      case ast::ast_operator::GREATER_EQUAL: return not(stat_max < value);
+      default: return std::nullopt;
+    }
+  }
+
+  template <typename T,
+            std::enable_if_t<not(cudf::is_fixed_width<T>() and not cudf::is_fixed_point<T>())>* =
+              nullptr,
+            typename... Args>
+  std::optional<bool> operator()(Args&&...) const
+  {
+    return std::nullopt;
+  }
+};
+
+/**
+ * @brief Evaluates an AST (sub)expression against one row group's column chunk statistics.
+ *
+ * The result is tri-state: `true`/`false` when the statistics prove that the row group may/cannot
+ * contain matching rows, and `std::nullopt` when they are inconclusive (unsupported operator,
+ * missing statistics, or mismatched types), in which case the caller must keep the row group.
+ *
+ * @param expr (Sub)expression to evaluate
+ * @param get_stats Callback returning the decoded statistics of the chunk of a given output column
+ * @param column_types cudf types of the output columns, indexed by column reference
+ */
+std::optional<bool> evaluate_stats_expression(
+  ast::expression const& expr,
+  std::function<std::optional<Statistics>(size_type)> const& get_stats,
+  std::vector<data_type> const& column_types)
+{
+  auto const* op_expr = dynamic_cast<ast::operation const*>(&expr);
+  if (op_expr == nullptr) { return std::nullopt; }
+  auto const op       = op_expr->get_operator();
+  auto const operands = op_expr->get_operands();
+
+  if (op == ast::ast_operator::LOGICAL_AND or op == ast::ast_operator::NULL_LOGICAL_AND) {
+    auto const lhs = evaluate_stats_expression(operands[0], get_stats, column_types);
+    auto const rhs = evaluate_stats_expression(operands[1], get_stats, column_types);
+    if ((lhs and not *lhs) or (rhs and not *rhs)) { return false; }
+    if (lhs and rhs) { return true; }
+    return std::nullopt;
+  }
+  if (op == ast::ast_operator::LOGICAL_OR or op == ast::ast_operator::NULL_LOGICAL_OR) {
+    auto const lhs = evaluate_stats_expression(operands[0], get_stats, column_types);
+    auto const rhs = evaluate_stats_expression(operands[1], get_stats, column_types);
+    if ((lhs and *lhs) or (rhs and *rhs)) { return true; }
+    if (lhs and rhs) { return false; }
+    return std::nullopt;
+  }
+
+  // Remaining supported shapes compare a column reference with a literal, in either order
+  if (operands.size() != 2) { return std::nullopt; }
+  auto const* col = dynamic_cast<ast::column_reference const*>(&operands[0].get());
+  auto const* lit = dynamic_cast<ast::literal const*>(&operands[1].get());
+  auto cmp_op     = op;
+  if (col == nullptr) {
+    col = dynamic_cast<ast::column_reference const*>(&operands[1].get());
+    lit = dynamic_cast<ast::literal const*>(&operands[0].get());
+    // Mirror the operator so that the column reference is always on the left
+    switch (op) {
+      case ast::ast_operator::LESS: cmp_op = ast::ast_operator::GREATER; break;
+      case ast::ast_operator::LESS_EQUAL: cmp_op = ast::ast_operator::GREATER_EQUAL; break;
+      case ast::ast_operator::GREATER: cmp_op = ast::ast_operator::LESS; break;
+      case ast::ast_operator::GREATER_EQUAL: cmp_op = ast::ast_operator::LESS_EQUAL; break;
+      default: break;
+    }
+  }
+  if (col == nullptr or lit == nullptr) { return std::nullopt; }
+
+  auto const col_type = column_types[col->get_column_index()];
+  if (lit->get_data_type() != col_type) { return std::nullopt; }
+
+  auto const stats = get_stats(col->get_column_index());
+  if (not stats) { return std::nullopt; }
+  auto const& min_bytes = stats->min_value.empty() ? stats->min : stats->min_value;
+  auto const& max_bytes = stats->max_value.empty() ? stats->max : stats->max_value;
+  if (min_bytes.empty() or max_bytes.empty()) { return std::nullopt; }
+
+  return cudf::type_dispatcher(
+    col_type, stats_comparator{}, min_bytes, max_bytes, lit->get_scalar(), cmp_op);
+}
+
+}  // namespace
+
 class aggregate_metadata {
   std::vector<metadata> const per_file_metadata;
   std::map<std::string, std::string> const agg_keyval_map;
@@ -306,14 +497,39 @@ class aggregate_metadata {
   size_type const num_row_groups;
   /**
    * @brief Create a metadata object from each element in the source vector
+   *
+   * Sources with a non-empty entry in `cache_keys` consult (and populate) the process-wide
+   * footer cache instead of re-reading and re-parsing the footer.
    */
-  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const& sources)
+  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const& sources,
+                              std::vector<std::string> const& cache_keys)
   {
+    // Footer reads and thrift parsing are independent per source; for datasets made of many
+    // files, parse them concurrently on a worker pool
+    cudf::detail::thread_pool pool(std::min<unsigned int>(
+      std::max<unsigned int>(sources.size(), 1), std::thread::hardware_concurrency()));
+    std::vector<std::future<metadata>> tasks;
+    for (size_t src_idx = 0; src_idx < sources.size(); src_idx++) {
+      auto const& source = sources[src_idx];
+      auto const key = (src_idx < cache_keys.size()) ? cache_keys[src_idx] : std::string{};
+      tasks.push_back(pool.submit([&source, key] {
+        if (not key.empty()) {
+          std::lock_guard<std::mutex> lock(footer_cache_mutex());
+          auto const it = footer_cache().find(key);
+          if (it != footer_cache().end()) { return metadata(it->second); }
+        }
+        auto md = metadata(source.get());
+        if (not key.empty()) {
+          std::lock_guard<std::mutex> lock(footer_cache_mutex());
+          footer_cache().emplace(key, md);
+        }
+        return md;
+      }));
+    }
     std::vector<metadata> metadatas;
-    std::transform(
-      sources.cbegin(), sources.cend(), std::back_inserter(metadatas), [](auto const& source) {
-        return metadata(source.get());
-      });
+    std::transform(tasks.begin(), tasks.end(), std::back_inserter(metadatas), [](auto& task) {
+      return task.get();
+    });
     return metadatas;
   }
 
@@ -355,8 +571,9 @@ class aggregate_metadata {
   }
 
  public:
-  aggregate_metadata(std::vector<std::unique_ptr<datasource>> const& sources)
-    : per_file_metadata(metadatas_from_sources(sources)),
+  aggregate_metadata(std::vector<std::unique_ptr<datasource>> const& sources,
+                     std::vector<std::string> const& cache_keys = {})
+    : per_file_metadata(metadatas_from_sources(sources, cache_keys)),
       agg_keyval_map(merge_keyval_metadata()),
       num_rows(calc_num_rows()),
       num_row_groups(calc_num_row_groups())
@@ -554,6 +771,49 @@ class aggregate_metadata {
     return selection;
   }
 
+  /**
+   * @brief Prunes a row group selection using column chunk statistics.
+   *
+   * Evaluates `filter` against the decoded min/max statistics of each selected row group and
+   * drops the groups that provably contain no matching rows. Statistics that are missing or
+   * inconclusive conservatively keep the row group. Start rows are recomputed so that the
+   * surviving selection remains contiguous.
+   *
+   * @param selection Row groups selected so far
+   * @param filter AST expression to evaluate against the statistics
+   * @param output_column_schemas Schema indices of the output columns
+   * @param output_column_types cudf types of the output columns
+   * @param row_count Total number of rows across the surviving row groups
+   *
+   * @return Pruned list of row group indexes and their starting rows
+   */
+  std::vector<row_group_info> filter_row_groups(std::vector<row_group_info> const& selection,
+                                                ast::expression const& filter,
+                                                std::vector<int> const& output_column_schemas,
+                                                std::vector<data_type> const& output_column_types,
+                                                size_type& row_count) const
+  {
+    std::vector<row_group_info> pruned;
+    row_count = 0;
+    for (auto const& rg : selection) {
+      auto const get_stats = [&](size_type col_idx) -> std::optional<Statistics> {
+        auto const& col_meta =
+          get_column_metadata(rg.index, rg.source_index, output_column_schemas[col_idx]);
+        if (col_meta.statistics_blob.empty()) { return std::nullopt; }
+        Statistics stats;
+        CompactProtocolReader cp(col_meta.statistics_blob.data(), col_meta.statistics_blob.size());
+        if (not cp.read(&stats)) { return std::nullopt; }
+        return stats;
+      };
+      auto const result = evaluate_stats_expression(filter, get_stats, output_column_types);
+      if (result.value_or(true)) {
+        pruned.emplace_back(rg.index, row_count, rg.source_index);
+        row_count += get_row_group(rg.index, rg.source_index).num_rows;
+      }
+    }
+    return pruned;
+  }
+
   /**
    * @brief Filters and reduces down to a selection of columns
    *
@@ -608,7 +868,8 @@ class aggregate_metadata {
         // if we're at the root, this is a new output column
         auto const col_type =
           to_type_id(schema_elem, strings_to_categorical, timestamp_type_id, strict_decimal_types);
-        auto const dtype = col_type == type_id::DECIMAL32 || col_type == type_id::DECIMAL64
+        auto const dtype = col_type == type_id::DECIMAL32 || col_type == type_id::DECIMAL64 ||
+                               col_type == type_id::DECIMAL128
                              ? data_type{col_type, numeric::scale_type{-schema_elem.decimal_scale}}
                              : data_type{col_type};
 
@@ -948,9 +1209,21 @@ std::future<void> reader::impl::read_column_chunks(
         read_tasks.emplace_back(std::move(fut_read_size));
         page_data[chunk] = datasource::buffer::create(std::move(buffer));
       } else {
-        auto const buffer = source->host_read(io_offset, io_size);
-        page_data[chunk] =
-          datasource::buffer::create(rmm::device_buffer(buffer->data(), buffer->size(), stream));
+        // Stage through a host read on the worker pool so that reads for subsequent row groups
+        // overlap the reads and H2D copies already in flight
+        auto buffer        = rmm::device_buffer(io_size, stream);
+        auto const dst     = static_cast<uint8_t*>(buffer.data());
+        auto read_and_copy = [&source, io_offset, io_size, dst, stream]() -> size_t {
+          // Stage through pooled pinned memory; release is stream-ordered, so the buffer can be
+          // returned with the copy still in flight
+          pinned_buffer staging(io_size, stream);
+          auto const bytes_read = source->host_read(io_offset, io_size, staging.data());
+          CUDA_TRY(cudaMemcpyAsync(
+            dst, staging.data(), bytes_read, cudaMemcpyHostToDevice, stream.value()));
+          return bytes_read;
+        };
+        read_tasks.emplace_back(_read_pool.submit(read_and_copy));
+        page_data[chunk] = datasource::buffer::create(std::move(buffer));
       }
       auto d_compdata = page_data[chunk]->data();
       do {
@@ -1008,7 +1281,16 @@ void reader::impl::decode_page_headers(hostdevice_vector<gpu::ColumnChunkDesc>&
   pages.device_to_host(stream, true);
 }
 
-void snappy_decompress(device_span<gpu_inflate_input_s> comp_in,
+/**
+ * @brief Batched page decompression through one of nvcomp's decompressors
+ *
+ * `get_temp_size`/`decompress_async` are the pair of nvcomp entry points for the codec
+ * (e.g. `nvcompBatchedSnappyDecompressGetTempSize`/`nvcompBatchedSnappyDecompressAsync`).
+ */
+template <typename GetTempSize, typename DecompressAsync>
+void nvcomp_decompress(GetTempSize get_temp_size,
+                       DecompressAsync decompress_async,
+                       device_span<gpu_inflate_input_s> comp_in,
                        device_span<gpu_inflate_status_s> comp_stat,
                        size_t max_uncomp_page_size,
                        rmm::cuda_stream_view stream)
@@ -1017,9 +1299,9 @@ void snappy_decompress(device_span<gpu_inflate_input_s> comp_in,
   size_t temp_size;
 
   nvcompStatus_t nvcomp_status =
-    nvcompBatchedSnappyDecompressGetTempSize(num_comp_pages, max_uncomp_page_size, &temp_size);
+    get_temp_size(num_comp_pages, max_uncomp_page_size, &temp_size);
   CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
-               "Unable to get scratch size for snappy decompression");
+               "Unable to get scratch size for decompression");
 
   // Not needed now but nvcomp API makes no promises about future
   rmm::device_buffer scratch(temp_size, stream);
@@ -1050,29 +1332,54 @@ void snappy_decompress(device_span<gpu_inflate_input_s> comp_in,
                       return thrust::make_tuple(in.srcDevice, in.srcSize, in.dstDevice, in.dstSize);
                     });
 
-  nvcomp_status = nvcompBatchedSnappyDecompressAsync(compressed_data_ptrs.data(),
-                                                     compressed_data_sizes.data(),
-                                                     uncompressed_data_sizes.data(),
-                                                     actual_uncompressed_data_sizes.data(),
-                                                     num_comp_pages,
-                                                     scratch.data(),
-                                                     scratch.size(),
-                                                     uncompressed_data_ptrs.data(),
-                                                     statuses.data(),
-                                                     stream.value());
-  CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
-               "unable to perform snappy decompression");
+  nvcomp_status = decompress_async(compressed_data_ptrs.data(),
+                                   compressed_data_sizes.data(),
+                                   uncompressed_data_sizes.data(),
+                                   actual_uncompressed_data_sizes.data(),
+                                   num_comp_pages,
+                                   scratch.data(),
+                                   scratch.size(),
+                                   uncompressed_data_ptrs.data(),
+                                   statuses.data(),
+                                   stream.value());
+  CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess, "unable to perform decompression");
 
   CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
                              uncompressed_data_sizes.begin(),
                              uncompressed_data_sizes.end(),
                              actual_uncompressed_data_sizes.begin()),
-               "Mismatch in expected and actual decompressed size during snappy decompression");
+               "Mismatch in expected and actual decompressed size during decompression");
   CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
                              statuses.begin(),
                              statuses.end(),
                              thrust::make_constant_iterator(nvcompStatus_t::nvcompSuccess)),
-               "Error during snappy decompression");
+               "Error during decompression");
+}
+
+void snappy_decompress(device_span<gpu_inflate_input_s> comp_in,
+                       device_span<gpu_inflate_status_s> comp_stat,
+                       size_t max_uncomp_page_size,
+                       rmm::cuda_stream_view stream)
+{
+  nvcomp_decompress(nvcompBatchedSnappyDecompressGetTempSize,
+                    nvcompBatchedSnappyDecompressAsync,
+                    comp_in,
+                    comp_stat,
+                    max_uncomp_page_size,
+                    stream);
+}
+
+void zstd_decompress(device_span<gpu_inflate_input_s> comp_in,
+                     device_span<gpu_inflate_status_s> comp_stat,
+                     size_t max_uncomp_page_size,
+                     rmm::cuda_stream_view stream)
+{
+  nvcomp_decompress(nvcompBatchedZstdDecompressGetTempSize,
+                    nvcompBatchedZstdDecompressAsync,
+                    comp_in,
+                    comp_stat,
+                    max_uncomp_page_size,
+                    stream);
 }
 
 /**
@@ -1108,9 +1415,10 @@ rmm::device_buffer reader::impl::decompress_page_data(
     int32_t max_decompressed_size;
   };
 
-  std::array<codec_stats, 3> codecs{codec_stats{parquet::GZIP, 0, 0},
+  std::array<codec_stats, 4> codecs{codec_stats{parquet::GZIP, 0, 0},
                                     codec_stats{parquet::SNAPPY, 0, 0},
-                                    codec_stats{parquet::BROTLI, 0, 0}};
+                                    codec_stats{parquet::BROTLI, 0, 0},
+                                    codec_stats{parquet::ZSTD, 0, 0}};
 
   for (auto& codec : codecs) {
     for_each_codec_page(codec.compression_type, [&](size_t page) {
@@ -1125,8 +1433,10 @@ rmm::device_buffer reader::impl::decompress_page_data(
     }
   }
 
-  // Dispatch batches of pages to decompress for each codec
-  rmm::device_buffer decomp_pages(total_decomp_size, stream);
+  // Dispatch batches of pages to decompress for each codec. Decompressed
+  // pages live only for the duration of the read, so allocate them from the
+  // temporary resource rather than the pool that backs column allocations.
+  rmm::device_buffer decomp_pages(total_decomp_size, stream, get_temp_memory_resource());
   hostdevice_vector<gpu_inflate_input_s> inflate_in(0, num_comp_pages, stream);
   hostdevice_vector<gpu_inflate_status_s> inflate_out(0, num_comp_pages, stream);
 
@@ -1198,6 +1508,13 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                 argc - start_pos,
                                 stream));
           break;
+        case parquet::ZSTD:
+          // No in-house kernel for zstd; always decompress through nvcomp
+          zstd_decompress(inflate_in_view.subspan(start_pos, argc - start_pos),
+                          inflate_out_view.subspan(start_pos, argc - start_pos),
+                          codec.max_decompressed_size,
+                          stream);
+          break;
         default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
       }
       CUDA_TRY(cudaMemcpyAsync(inflate_out.host_ptr(start_pos),
@@ -1360,10 +1677,42 @@ void reader::impl::preprocess_columns(hostdevice_vector<gpu::ColumnChunkDesc>& c
       };
     create_columns(_output_columns);
   } else {
+    // Key the untrimmed sizing results on the file identity plus the chunk selection, so
+    // repeated hot-file reads skip the full sizing kernel pass
+    std::string sizing_key;
+    if (!_sizing_cache_key.empty()) {
+      sizing_key = _sizing_cache_key;
+      for (size_t idx = 0; idx < chunks.size(); idx++) {
+        sizing_key += std::to_string(chunks[idx].src_col_schema) + ':' +
+                      std::to_string(chunks[idx].start_row) + ':' +
+                      std::to_string(chunks[idx].max_num_pages) + ';';
+      }
+    }
+
+    std::vector<int32_t> page_row_counts;
+    if (!sizing_key.empty()) {
+      std::lock_guard<std::mutex> lock(page_row_counts_cache_mutex());
+      auto const it = page_row_counts_cache().find(sizing_key);
+      if (it != page_row_counts_cache().end()) { page_row_counts = it->second; }
+    }
+    bool const was_cached = page_row_counts.size() == pages.size();
+
     // preprocess per-nesting level sizes by page
-    gpu::PreprocessColumnData(
-      pages, chunks, _input_columns, _output_columns, total_rows, min_row, stream, _mr);
+    gpu::PreprocessColumnData(pages,
+                              chunks,
+                              _input_columns,
+                              _output_columns,
+                              total_rows,
+                              min_row,
+                              sizing_key.empty() ? nullptr : &page_row_counts,
+                              stream,
+                              _mr);
     stream.synchronize();
+
+    if (!sizing_key.empty() && !was_cached) {
+      std::lock_guard<std::mutex> lock(page_row_counts_cache_mutex());
+      page_row_counts_cache().emplace(sizing_key, std::move(page_row_counts));
+    }
   }
 }
 
@@ -1501,6 +1850,24 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc>& chu
   page_nesting.device_to_host(stream);
   stream.synchronize();
 
+  // Materialize the dictionary keys for dictionary-preserving reads while the string
+  // dictionary index built above is still alive
+  if (_strings_to_dictionary) {
+    _dict_keys.clear();
+    _dict_keys.resize(_input_columns.size());
+    for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+      if (is_dict_chunk(chunks[c])) {
+        auto const num_entries = pages[page_count].num_input_values;
+        _dict_keys[chunks[c].src_col_index] =
+          make_strings_column(device_span<string_index_pair const>{
+                                chunks[c].str_dict_index, static_cast<size_t>(num_entries)},
+                              stream,
+                              _mr);
+      }
+      page_count += chunks[c].max_num_pages;
+    }
+  }
+
   // for list columns, add the final offset to every offset buffer.
   // TODO : make this happen in more efficiently. Maybe use thrust::for_each
   // on each buffer.  Or potentially do it in PreprocessColumnData
@@ -1565,8 +1932,29 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
                    rmm::mr::device_memory_resource* mr)
   : _mr(mr), _sources(std::move(sources))
 {
-  // Open and parse the source dataset metadata
-  _metadata = std::make_unique<aggregate_metadata>(_sources);
+  // Open and parse the source dataset metadata; repeatedly scanned files can opt into the
+  // process-wide footer cache, which is only keyable for filepath sources
+  std::vector<std::string> footer_cache_keys;
+  if (options.is_enabled_use_footer_cache() &&
+      options.get_source().type == io_type::FILEPATH) {
+    std::transform(options.get_source().filepaths.cbegin(),
+                   options.get_source().filepaths.cend(),
+                   std::back_inserter(footer_cache_keys),
+                   [](auto const& path) { return footer_cache_key(path); });
+  }
+  _metadata = std::make_unique<aggregate_metadata>(_sources, footer_cache_keys);
+
+  // The same keys also identify the file contents for the page sizing cache; any source
+  // without a key leaves the read uncacheable
+  if (!footer_cache_keys.empty() &&
+      std::none_of(footer_cache_keys.cbegin(), footer_cache_keys.cend(), [](auto const& key) {
+        return key.empty();
+      })) {
+    for (auto const& key : footer_cache_keys) {
+      _sizing_cache_key += key;
+      _sizing_cache_key += '|';
+    }
+  }
 
   // Override output timestamp resolution if requested
   if (options.get_timestamp_type().id() != type_id::EMPTY) {
@@ -1575,26 +1963,117 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
 
   _strict_decimal_types = options.is_enabled_strict_decimal_types();
 
-  // Strings may be returned as either string or categorical columns
+  // Predicate to prune row groups with, based on column chunk statistics
+  _filter = options.get_filter();
+
+  // Strings may be returned as string, categorical or dictionary columns
   _strings_to_categorical = options.is_enabled_convert_strings_to_categories();
+  _strings_to_dictionary  = options.is_enabled_convert_strings_to_dictionaries();
+  CUDF_EXPECTS(not(_strings_to_categorical and _strings_to_dictionary),
+               "Strings can be read as categories or as dictionary columns, not both");
 
-  // Select only columns required by the options
+  // Select only columns required by the options; dictionary reads decode the indices into
+  // INT32 buffers like the categorical path does
   std::tie(_input_columns, _output_columns, _output_column_schemas) =
     _metadata->select_columns(options.get_columns(),
                               options.is_enabled_use_pandas_metadata(),
-                              _strings_to_categorical,
+                              _strings_to_categorical || _strings_to_dictionary,
                               _timestamp_type.id(),
                               _strict_decimal_types);
 }
 
+void reader::impl::init_chunking(std::size_t chunk_read_limit,
+                                 parquet_reader_options const& options)
+{
+  CUDF_EXPECTS(options.get_skip_rows() == 0 && options.get_num_rows() == -1,
+               "Chunked reading does not support skip_rows/num_rows trimming");
+
+  _chunk_options = options;
+
+  auto skip_rows = options.get_skip_rows();
+  auto num_rows  = options.get_num_rows();
+  auto const selected_row_groups =
+    _metadata->select_row_groups(options.get_row_groups(), skip_rows, num_rows);
+
+  // Greedily pack whole row groups into chunks under the byte budget
+  std::size_t chunk_bytes = 0;
+  for (auto const& rg : selected_row_groups) {
+    auto const rg_bytes = static_cast<std::size_t>(
+      _metadata->get_row_group(rg.index, rg.source_index).total_byte_size);
+    if (_chunk_row_groups.empty() ||
+        (chunk_read_limit > 0 && chunk_bytes + rg_bytes > chunk_read_limit)) {
+      _chunk_row_groups.emplace_back(_sources.size());
+      chunk_bytes = 0;
+    }
+    _chunk_row_groups.back()[rg.source_index].push_back(rg.index);
+    chunk_bytes += rg_bytes;
+  }
+}
+
+table_with_metadata reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  // The output column buffers are consumed by each read; rebuild them so that every chunk gets
+  // freshly allocated output while the parsed metadata and sources are reused
+  std::tie(_input_columns, _output_columns, _output_column_schemas) =
+    _metadata->select_columns(_chunk_options.get_columns(),
+                              _chunk_options.is_enabled_use_pandas_metadata(),
+                              _strings_to_categorical || _strings_to_dictionary,
+                              _timestamp_type.id(),
+                              _strict_decimal_types);
+
+  // Once exhausted, keep returning empty tables with the same schema
+  if (!has_next_chunk()) {
+    return read(0, -1, std::vector<std::vector<size_type>>(_sources.size()), stream);
+  }
+
+  return read(0, -1, _chunk_row_groups[_current_chunk++], stream);
+}
+
+/**
+ * @brief Assemble a dictionary column from decoded indices and the file's dictionary keys
+ *
+ * Parquet dictionaries are unique but unordered while cudf dictionary keys must be sorted,
+ * so the column is rebuilt around the sorted key set with the indices remapped accordingly.
+ */
+std::unique_ptr<column> make_dictionary_from_parquet(std::unique_ptr<column> indices,
+                                                     std::unique_ptr<column> keys,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  auto const order = cudf::detail::sorted_order(table_view{{keys->view()}}, {}, {}, stream);
+  auto sorted_keys = std::move(cudf::detail::gather(table_view{{keys->view()}},
+                                                    order->view(),
+                                                    out_of_bounds_policy::DONT_CHECK,
+                                                    cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                                    stream,
+                                                    mr)
+                                 ->release()
+                                 .front());
+  auto const unordered =
+    make_dictionary_column(std::move(keys), std::move(indices), stream, mr);
+  return cudf::dictionary::detail::set_keys(
+    dictionary_column_view(unordered->view()), sorted_keys->view(), stream, mr);
+}
+
 table_with_metadata reader::impl::read(size_type skip_rows,
                                        size_type num_rows,
                                        std::vector<std::vector<size_type>> const& row_group_list,
                                        rmm::cuda_stream_view stream)
 {
   // Select only row groups required
-  const auto selected_row_groups =
-    _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
+  auto selected_row_groups = _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
+
+  // Prune row groups whose statistics prove that no row can satisfy the filter
+  if (_filter.has_value()) {
+    CUDF_EXPECTS(skip_rows == 0, "Row group pruning does not support skip_rows trimming");
+    std::vector<data_type> output_column_types;
+    std::transform(_output_columns.cbegin(),
+                   _output_columns.cend(),
+                   std::back_inserter(output_column_types),
+                   [](auto const& col) { return col.type; });
+    selected_row_groups = _metadata->filter_row_groups(
+      selected_row_groups, _filter.value().get(), _output_column_schemas, output_column_types, num_rows);
+  }
 
   table_metadata out_metadata;
 
@@ -1653,7 +2132,10 @@ table_with_metadata reader::impl::read(size_type skip_rows,
         int8_t converted_type;
 
         std::tie(type_width, clock_rate, converted_type) = conversion_info(
-          to_type_id(schema, _strings_to_categorical, _timestamp_type.id(), _strict_decimal_types),
+          to_type_id(schema,
+                     _strings_to_categorical || _strings_to_dictionary,
+                     _timestamp_type.id(),
+                     _strict_decimal_types),
           _timestamp_type.id(),
           schema.type,
           schema.converted_type,
@@ -1683,6 +2165,8 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                                            i,
                                            col.schema_idx));
 
+        chunks[chunks.size() - 1].output_string_index = _strings_to_dictionary;
+
         // Map each column chunk to its column index and its source index
         chunk_source_map[chunks.size() - 1] = row_group_source;
 
@@ -1714,6 +2198,34 @@ table_with_metadata reader::impl::read(size_type skip_rows,
 
       // decoding of column/page information
       decode_page_headers(chunks, pages, stream);
+
+      // Dictionary-preserving reads only work when each string column's indices refer to a
+      // single dictionary: one row group, flat string columns, fully dictionary-encoded pages
+      if (_strings_to_dictionary) {
+        CUDF_EXPECTS(selected_row_groups.size() == 1,
+                     "Dictionary-preserving reads require a single row group selection");
+        for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+          if ((chunks[c].data_type & 7) == BYTE_ARRAY &&
+              chunks[c].converted_type != parquet::DECIMAL) {
+            CUDF_EXPECTS(
+              _metadata->get_output_nesting_depth(chunks[c].src_col_schema) == 1,
+              "Dictionary-preserving reads do not support nested string columns");
+            CUDF_EXPECTS(
+              chunks[c].num_dict_pages > 0,
+              "Dictionary-preserving reads require dictionary-encoded string columns");
+            for (int k = 0; k < chunks[c].max_num_pages; k++) {
+              auto const& page = pages[page_count + k];
+              if (page.flags & gpu::PAGEINFO_FLAGS_DICTIONARY) { continue; }
+              CUDF_EXPECTS(
+                page.encoding == Encoding::PLAIN_DICTIONARY ||
+                  page.encoding == Encoding::RLE_DICTIONARY,
+                "Dictionary-preserving reads require dictionary-encoded string columns");
+            }
+          }
+          page_count += chunks[c].max_num_pages;
+        }
+      }
+
       if (total_decompressed_size > 0) {
         decomp_page_data = decompress_page_data(chunks, pages, stream);
         // Free compressed data
@@ -1759,7 +2271,24 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       // create the final output cudf columns
       for (size_t i = 0; i < _output_columns.size(); ++i) {
         column_name_info& col_name = out_metadata.schema_info.emplace_back("");
-        out_columns.emplace_back(make_column(_output_columns[i], &col_name, stream, _mr));
+        auto out_col               = make_column(_output_columns[i], &col_name, stream, _mr);
+        if (_strings_to_dictionary) {
+          // wrap the decoded indices and their keys into a dictionary column
+          auto const input = std::find_if(
+            _input_columns.cbegin(),
+            _input_columns.cend(),
+            [schema = _output_column_schemas[i]](auto const& in) {
+              return in.schema_idx == schema;
+            });
+          if (input != _input_columns.cend()) {
+            auto& keys = _dict_keys[std::distance(_input_columns.cbegin(), input)];
+            if (keys != nullptr) {
+              out_col = make_dictionary_from_parquet(
+                std::move(out_col), std::move(keys), stream, _mr);
+            }
+          }
+        }
+        out_columns.emplace_back(std::move(out_col));
       }
     }
   }
@@ -1803,6 +2332,29 @@ table_with_metadata reader::read(parquet_reader_options const& options,
     options.get_skip_rows(), options.get_num_rows(), options.get_row_groups(), stream);
 }
 
+// Forward to implementation
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                               parquet_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+  : reader(std::move(sources), options, stream, mr)
+{
+  _impl->init_chunking(chunk_read_limit, options);
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next_chunk(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk() const
+{
+  return _impl->read_chunk(rmm::cuda_stream_default);
+}
+
 }  // namespace parquet
 }  // namespace detail
 }  // namespace io
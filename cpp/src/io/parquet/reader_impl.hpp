@@ -26,6 +26,7 @@
 
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/thread_pool.hpp>
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/detail/parquet.hpp>
@@ -33,7 +34,9 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -79,6 +82,33 @@ class reader::impl {
                            std::vector<std::vector<size_type>> const& row_group_indices,
                            rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Split the selected row groups into chunks for iterative reading.
+   *
+   * Row groups are greedily packed into chunks, in selection order, such that the sum of their
+   * total (uncompressed) byte sizes stays below `chunk_read_limit`. A chunk always contains at
+   * least one row group, so a single row group larger than the limit forms a chunk by itself.
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   *        or `0` if there is no limit
+   * @param options Settings for controlling reading behavior
+   */
+  void init_chunking(std::size_t chunk_read_limit, parquet_reader_options const& options);
+
+  /**
+   * @brief Check if there is any chunk that has not yet been read.
+   */
+  bool has_next_chunk() const { return _current_chunk < _chunk_row_groups.size(); }
+
+  /**
+   * @brief Read the next chunk of row groups and return it as a table.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
+
  private:
   /**
    * @brief Reads compressed page data to device memory
@@ -209,8 +239,27 @@ class reader::impl {
   std::vector<int> _output_column_schemas;
 
   bool _strings_to_categorical = false;
+  bool _strings_to_dictionary  = false;
+  // Dictionary keys per input column, built from the dictionary pages during decode
+  std::vector<std::unique_ptr<column>> _dict_keys;
   data_type _timestamp_type{type_id::EMPTY};
   bool _strict_decimal_types = false;
+
+  // Optional AST filter used to prune row groups via column chunk statistics
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+
+  // Footer-derived identity of the sources; keys the page sizing cache when non-empty
+  std::string _sizing_cache_key;
+
+  // Worker pool that overlaps host-side column chunk reads across row groups
+  cudf::detail::thread_pool _read_pool{
+    std::min<unsigned int>(16, std::thread::hardware_concurrency())};
+
+  // State for iterative (chunked) reading; unused by the single-shot `read()` path
+  parquet_reader_options _chunk_options;
+  // Per-chunk lists of row group indices, one inner list per source
+  std::vector<std::vector<std::vector<size_type>>> _chunk_row_groups;
+  std::size_t _current_chunk = 0;
 };
 
 }  // namespace parquet
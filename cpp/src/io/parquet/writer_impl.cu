@@ -40,6 +40,7 @@
 #include <nvcomp/snappy.h>
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <numeric>
 #include <utility>
@@ -73,6 +74,47 @@ parquet::Compression to_parquet_compression(compression_type compression)
   }
 }
 
+/**
+ * @brief Plain-encode a min/max statistics value in the column's physical type
+ *
+ * String values live in device memory and are copied back; types whose page-level min/max
+ * cannot be represented this way (INT96, FIXED_LEN_BYTE_ARRAY) yield an empty result.
+ */
+std::vector<uint8_t> encode_statistic_value(statistics_val const& val,
+                                            Type physical_type,
+                                            rmm::cuda_stream_view stream)
+{
+  auto const copy_host = [](void const* src, size_t len) {
+    std::vector<uint8_t> out(len);
+    memcpy(out.data(), src, len);
+    return out;
+  };
+  switch (physical_type) {
+    case Type::BOOLEAN: {
+      uint8_t const v = (val.i_val != 0);
+      return {v};
+    }
+    case Type::INT32: {
+      auto const v = static_cast<int32_t>(val.i_val);
+      return copy_host(&v, sizeof(v));
+    }
+    case Type::INT64: return copy_host(&val.i_val, sizeof(val.i_val));
+    case Type::FLOAT: {
+      auto const v = static_cast<float>(val.fp_val);
+      return copy_host(&v, sizeof(v));
+    }
+    case Type::DOUBLE: return copy_host(&val.fp_val, sizeof(val.fp_val));
+    case Type::BYTE_ARRAY: {
+      std::vector<uint8_t> out(val.str_val.length);
+      CUDA_TRY(cudaMemcpyAsync(
+        out.data(), val.str_val.ptr, val.str_val.length, cudaMemcpyDeviceToHost, stream.value()));
+      stream.synchronize();
+      return out;
+    }
+    default: return {};
+  }
+}
+
 }  // namespace
 
 struct linked_column_view;
@@ -341,6 +383,10 @@ struct leaf_schema_fn {
     } else if (std::is_same_v<T, numeric::decimal64>) {
       col_schema.type        = Type::INT64;
       col_schema.stats_dtype = statistics_dtype::dtype_decimal64;
+    } else if (std::is_same_v<T, numeric::decimal128>) {
+      col_schema.type        = Type::FIXED_LEN_BYTE_ARRAY;
+      col_schema.type_length = sizeof(__int128_t);
+      col_schema.stats_dtype = statistics_dtype::dtype_decimal128;
     } else {
       CUDF_FAIL("Unsupported fixed point type for parquet writer");
     }
@@ -788,7 +834,8 @@ auto build_chunk_dictionaries(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
   std::vector<rmm::device_uvector<gpu::slot_type>> hash_maps_storage;
   hash_maps_storage.reserve(h_chunks.size());
   for (auto& chunk : h_chunks) {
-    if (col_desc[chunk.col_desc_id].physical_type == Type::BOOLEAN) {
+    if (col_desc[chunk.col_desc_id].physical_type == Type::BOOLEAN ||
+        col_desc[chunk.col_desc_id].physical_type == Type::FIXED_LEN_BYTE_ARRAY) {
       chunk.use_dictionary = false;
     } else {
       chunk.use_dictionary = true;
@@ -890,79 +937,6 @@ void writer::impl::init_encoder_pages(hostdevice_2dvector<gpu::EncColumnChunk>&
   stream.synchronize();
 }
 
-void snappy_compress(device_span<gpu_inflate_input_s const> comp_in,
-                     device_span<gpu_inflate_status_s> comp_stat,
-                     size_t max_page_uncomp_data_size,
-                     rmm::cuda_stream_view stream)
-{
-  size_t num_comp_pages = comp_in.size();
-  try {
-    size_t temp_size;
-    nvcompStatus_t nvcomp_status = nvcompBatchedSnappyCompressGetTempSize(
-      num_comp_pages, max_page_uncomp_data_size, nvcompBatchedSnappyDefaultOpts, &temp_size);
-
-    CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
-                 "Error in getting snappy compression scratch size");
-
-    // Not needed now but nvcomp API makes no promises about future
-    rmm::device_buffer scratch(temp_size, stream);
-    // Analogous to comp_in.srcDevice
-    rmm::device_uvector<void const*> uncompressed_data_ptrs(num_comp_pages, stream);
-    // Analogous to comp_in.srcSize
-    rmm::device_uvector<size_t> uncompressed_data_sizes(num_comp_pages, stream);
-    // Analogous to comp_in.dstDevice
-    rmm::device_uvector<void*> compressed_data_ptrs(num_comp_pages, stream);
-    // Analogous to comp_stat.bytes_written
-    rmm::device_uvector<size_t> compressed_bytes_written(num_comp_pages, stream);
-    // nvcomp does not currently use comp_in.dstSize. Cannot assume that the output will fit in
-    // the space allocated unless one uses the API nvcompBatchedSnappyCompressGetOutputSize()
-
-    // Prepare the vectors
-    auto comp_it = thrust::make_zip_iterator(uncompressed_data_ptrs.begin(),
-                                             uncompressed_data_sizes.begin(),
-                                             compressed_data_ptrs.begin());
-    thrust::transform(rmm::exec_policy(stream),
-                      comp_in.begin(),
-                      comp_in.end(),
-                      comp_it,
-                      [] __device__(gpu_inflate_input_s in) {
-                        return thrust::make_tuple(in.srcDevice, in.srcSize, in.dstDevice);
-                      });
-    nvcomp_status = nvcompBatchedSnappyCompressAsync(uncompressed_data_ptrs.data(),
-                                                     uncompressed_data_sizes.data(),
-                                                     max_page_uncomp_data_size,
-                                                     num_comp_pages,
-                                                     scratch.data(),  // Not needed rn but future
-                                                     scratch.size(),
-                                                     compressed_data_ptrs.data(),
-                                                     compressed_bytes_written.data(),
-                                                     nvcompBatchedSnappyDefaultOpts,
-                                                     stream.value());
-
-    CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess, "Error in snappy compression");
-
-    // nvcomp also doesn't use comp_out.status . It guarantees that given enough output space,
-    // compression will succeed.
-    // The other `comp_out` field is `reserved` which is for internal cuIO debugging and can be 0.
-    thrust::transform(rmm::exec_policy(stream),
-                      compressed_bytes_written.begin(),
-                      compressed_bytes_written.end(),
-                      comp_stat.begin(),
-                      [] __device__(size_t size) {
-                        gpu_inflate_status_s status{};
-                        status.bytes_written = size;
-                        return status;
-                      });
-    return;
-  } catch (...) {
-    // If we reach this then there was an error in compressing so set an error status for each page
-    thrust::for_each(rmm::exec_policy(stream),
-                     comp_stat.begin(),
-                     comp_stat.end(),
-                     [] __device__(gpu_inflate_status_s & stat) { stat.status = 1; });
-  };
-}
-
 void writer::impl::encode_pages(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
                                 device_span<gpu::EncPage> pages,
                                 size_t max_page_uncomp_data_size,
@@ -983,25 +957,11 @@ void writer::impl::encode_pages(hostdevice_2dvector<gpu::EncColumnChunk>& chunks
   uint32_t max_comp_pages =
     (compression_ != parquet::Compression::UNCOMPRESSED) ? pages_in_batch : 0;
 
-  rmm::device_uvector<gpu_inflate_input_s> compression_input(max_comp_pages, stream);
-  rmm::device_uvector<gpu_inflate_status_s> compression_status(max_comp_pages, stream);
-
-  device_span<gpu_inflate_input_s> comp_in{compression_input.data(), compression_input.size()};
-  device_span<gpu_inflate_status_s> comp_stat{compression_status.data(), compression_status.size()};
+  auto comp_in   = compressor_.get_inputs(max_comp_pages, stream);
+  auto comp_stat = compressor_.get_statuses(max_comp_pages, stream);
 
   gpu::EncodePages(batch_pages, comp_in, comp_stat, stream);
-  auto env_use_nvcomp = std::getenv("LIBCUDF_USE_NVCOMP");
-  bool use_nvcomp     = env_use_nvcomp != nullptr ? std::atoi(env_use_nvcomp) : 0;
-  switch (compression_) {
-    case parquet::Compression::SNAPPY:
-      if (use_nvcomp) {
-        snappy_compress(comp_in, comp_stat, max_page_uncomp_data_size, stream);
-      } else {
-        CUDA_TRY(gpu_snap(comp_in.data(), comp_stat.data(), pages_in_batch, stream));
-      }
-      break;
-    default: break;
-  }
+  compressor_.compress(comp_in, comp_stat, max_page_uncomp_data_size, stream);
   // TBD: Not clear if the official spec actually allows dynamically turning off compression at the
   // chunk-level
   auto d_chunks_in_batch = chunks.device_view().subspan(first_rowgroup, rowgroups_in_batch);
@@ -1018,6 +978,42 @@ void writer::impl::encode_pages(hostdevice_2dvector<gpu::EncColumnChunk>& chunks
   stream.synchronize();
 }
 
+void writer::impl::append_page_index(gpu::EncColumnChunk const& ck,
+                                     std::vector<gpu::EncPage> const& h_pages,
+                                     std::vector<statistics_chunk> const& h_page_stats,
+                                     uint32_t first_page_in_batch,
+                                     Type physical_type,
+                                     size_t chunk_offset)
+{
+  OffsetIndex offset_index;
+  ColumnIndex column_index;
+  size_t page_offset = chunk_offset;
+  for (uint32_t p = ck.first_page; p < ck.first_page + ck.num_pages; p++) {
+    auto const& page = h_pages[p - first_page_in_batch];
+    // After header encoding, hdr_size/max_data_size hold the actual on-disk sizes
+    size_t const page_size = page.hdr_size + page.max_data_size;
+    if (page.page_type == PageType::DATA_PAGE) {
+      offset_index.page_locations.push_back(
+        PageLocation{static_cast<int64_t>(page_offset),
+                     static_cast<int32_t>(page_size),
+                     static_cast<int64_t>(page.start_row - ck.start_row)});
+      auto const& stats        = h_page_stats[p - first_page_in_batch];
+      bool const is_null_page  = (stats.non_nulls == 0);
+      column_index.null_pages.push_back(is_null_page);
+      column_index.null_counts.push_back(stats.null_count);
+      column_index.min_values.push_back(
+        is_null_page ? std::vector<uint8_t>{}
+                     : encode_statistic_value(stats.min_value, physical_type, stream));
+      column_index.max_values.push_back(
+        is_null_page ? std::vector<uint8_t>{}
+                     : encode_statistic_value(stats.max_value, physical_type, stream));
+    }
+    page_offset += page_size;
+  }
+  offset_indexes_.push_back(std::move(offset_index));
+  column_indexes_.push_back(std::move(column_index));
+}
+
 writer::impl::impl(std::unique_ptr<data_sink> sink,
                    parquet_writer_options const& options,
                    SingleWriteMode mode,
@@ -1026,6 +1022,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
   : _mr(mr),
     stream(stream),
     compression_(to_parquet_compression(options.get_compression())),
+    compressor_(options.get_compression()),
     stats_granularity_(options.get_stats_level()),
     int96_timestamps(options.is_enabled_int96_timestamps()),
     out_sink_(std::move(sink)),
@@ -1045,6 +1042,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
   : _mr(mr),
     stream(stream),
     compression_(to_parquet_compression(options.get_compression())),
+    compressor_(options.get_compression()),
     stats_granularity_(options.get_stats_level()),
     int96_timestamps(options.is_enabled_int96_timestamps()),
     single_write_mode(mode == SingleWriteMode::YES),
@@ -1356,7 +1354,12 @@ void writer::impl::write(table_view const& table)
                        num_stats_bfr);
   }
 
-  pinned_buffer<uint8_t> host_bfr{nullptr, cudaFreeHost};
+  // Double-buffered pinned staging plus the writer thread let the sink flush of one chunk
+  // overlap the D2H copy of the next
+  std::array<pinned_buffer<uint8_t>, 2> host_bfr = {
+    pinned_buffer<uint8_t>{nullptr, cudaFreeHost}, pinned_buffer<uint8_t>{nullptr, cudaFreeHost}};
+  std::array<std::future<bool>, 2> write_tasks;
+  size_t write_slot = 0;
 
   // Encode row groups in batches
   for (uint32_t b = 0, r = 0, global_r = global_rowgroup_base; b < (uint32_t)batch_list.size();
@@ -1379,6 +1382,25 @@ void writer::impl::write(table_view const& table)
       (stats_granularity_ == statistics_freq::STATISTICS_PAGE) ? page_stats.data() : nullptr,
       (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? page_stats.data() + num_pages
                                                                : nullptr);
+    // Page-level stats also produce a ColumnIndex/OffsetIndex per chunk, built on the host
+    // from the encoded page descriptors and per-page statistics
+    std::vector<gpu::EncPage> h_pages;
+    std::vector<statistics_chunk> h_page_stats;
+    if (stats_granularity_ == statistics_freq::STATISTICS_PAGE and pages_in_batch != 0) {
+      h_pages.resize(pages_in_batch);
+      CUDA_TRY(cudaMemcpyAsync(h_pages.data(),
+                               pages.data() + first_page_in_batch,
+                               pages_in_batch * sizeof(gpu::EncPage),
+                               cudaMemcpyDeviceToHost,
+                               stream.value()));
+      h_page_stats.resize(pages_in_batch);
+      CUDA_TRY(cudaMemcpyAsync(h_page_stats.data(),
+                               page_stats.data() + first_page_in_batch,
+                               pages_in_batch * sizeof(statistics_chunk),
+                               cudaMemcpyDeviceToHost,
+                               stream.value()));
+      stream.synchronize();
+    }
     for (; r < rnext; r++, global_r++) {
       for (auto i = 0; i < num_columns; i++) {
         gpu::EncColumnChunk* ck = &chunks[r][i];
@@ -1391,6 +1413,10 @@ void writer::impl::write(table_view const& table)
         }
 
         if (out_sink_->is_device_write_preferred(ck->compressed_size)) {
+          // Drain queued host writes first so the sink sees chunks in file order
+          for (auto& task : write_tasks) {
+            if (task.valid()) { task.wait(); }
+          }
           // let the writer do what it wants to retrieve the data from the gpu.
           out_sink_->device_write(dev_bfr + ck->ck_stat_size, ck->compressed_size, stream);
           // we still need to do a (much smaller) memcpy for the statistics.
@@ -1405,28 +1431,44 @@ void writer::impl::write(table_view const& table)
             stream.synchronize();
           }
         } else {
-          if (!host_bfr) {
-            host_bfr = pinned_buffer<uint8_t>{[](size_t size) {
-                                                uint8_t* ptr = nullptr;
-                                                CUDA_TRY(cudaMallocHost(&ptr, size));
-                                                return ptr;
-                                              }(max_chunk_bfr_size),
-                                              cudaFreeHost};
+          auto& bfr  = host_bfr[write_slot % 2];
+          auto& task = write_tasks[write_slot % 2];
+          // The previous flush from this staging slot must complete before reuse
+          if (task.valid()) { task.wait(); }
+          if (!bfr) {
+            bfr = pinned_buffer<uint8_t>{[](size_t size) {
+                                           uint8_t* ptr = nullptr;
+                                           CUDA_TRY(cudaMallocHost(&ptr, size));
+                                           return ptr;
+                                         }(max_chunk_bfr_size),
+                                         cudaFreeHost};
           }
           // copy the full data
-          CUDA_TRY(cudaMemcpyAsync(host_bfr.get(),
+          CUDA_TRY(cudaMemcpyAsync(bfr.get(),
                                    dev_bfr,
                                    ck->ck_stat_size + ck->compressed_size,
                                    cudaMemcpyDeviceToHost,
                                    stream.value()));
           stream.synchronize();
-          out_sink_->host_write(host_bfr.get() + ck->ck_stat_size, ck->compressed_size);
+          task = write_pool_.submit(
+            [this](uint8_t const* data, size_t size) { out_sink_->host_write(data, size); },
+            static_cast<uint8_t const*>(bfr.get() + ck->ck_stat_size),
+            static_cast<size_t>(ck->compressed_size));
           if (ck->ck_stat_size != 0) {
             md.row_groups[global_r].columns[i].meta_data.statistics_blob.resize(ck->ck_stat_size);
             memcpy(md.row_groups[global_r].columns[i].meta_data.statistics_blob.data(),
-                   host_bfr.get(),
+                   bfr.get(),
                    ck->ck_stat_size);
           }
+          write_slot++;
+        }
+        if (stats_granularity_ == statistics_freq::STATISTICS_PAGE) {
+          append_page_index(*ck,
+                            h_pages,
+                            h_page_stats,
+                            first_page_in_batch,
+                            md.row_groups[global_r].columns[i].meta_data.type,
+                            current_chunk_offset);
         }
         md.row_groups[global_r].total_byte_size += ck->compressed_size;
         md.row_groups[global_r].columns[i].meta_data.data_page_offset =
@@ -1439,6 +1481,11 @@ void writer::impl::write(table_view const& table)
       }
     }
   }
+
+  // Drain pending sink writes before declaring the chunks flushed
+  for (auto& task : write_tasks) {
+    if (task.valid()) { task.wait(); }
+  }
 }
 
 std::unique_ptr<std::vector<uint8_t>> writer::impl::close(
@@ -1448,6 +1495,33 @@ std::unique_ptr<std::vector<uint8_t>> writer::impl::close(
   closed = true;
   CompactProtocolWriter cpw(&buffer_);
   file_ender_s fendr;
+  // Serialize the page indexes between the last data page and the footer: all ColumnIndex
+  // structures first, then all OffsetIndex structures, recording their locations in the
+  // corresponding column chunk metadata
+  auto const num_chunks = std::accumulate(
+    md.row_groups.begin(), md.row_groups.end(), size_t{0}, [](size_t sum, auto const& rg) {
+      return sum + rg.columns.size();
+    });
+  if (column_indexes_.size() == num_chunks && num_chunks != 0) {
+    size_t chunk_idx = 0;
+    for (auto& rowgroup : md.row_groups) {
+      for (auto& col : rowgroup.columns) {
+        buffer_.resize(0);
+        col.column_index_offset = out_sink_->bytes_written();
+        col.column_index_length = static_cast<int32_t>(cpw.write(column_indexes_[chunk_idx++]));
+        out_sink_->host_write(buffer_.data(), buffer_.size());
+      }
+    }
+    chunk_idx = 0;
+    for (auto& rowgroup : md.row_groups) {
+      for (auto& col : rowgroup.columns) {
+        buffer_.resize(0);
+        col.offset_index_offset = out_sink_->bytes_written();
+        col.offset_index_length = static_cast<int32_t>(cpw.write(offset_indexes_[chunk_idx++]));
+        out_sink_->host_write(buffer_.data(), buffer_.size());
+      }
+    }
+  }
   buffer_.resize(0);
   fendr.footer_len = static_cast<uint32_t>(cpw.write(md));
   fendr.magic      = parquet_magic;
@@ -25,7 +25,9 @@
 #include "parquet_gpu.hpp"
 
 #include <cudf/io/data_sink.hpp>
+#include <io/comp/batched_compressor.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/thread_pool.hpp>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/io/detail/parquet.hpp>
@@ -203,6 +205,23 @@ class writer::impl {
                     const statistics_chunk* page_stats,
                     const statistics_chunk* chunk_stats);
 
+  /**
+   * @brief Build the ColumnIndex/OffsetIndex entries for a flushed column chunk
+   *
+   * @param ck column chunk descriptor
+   * @param h_pages host copy of the batch's encoder pages
+   * @param h_page_stats host copy of the batch's page-level statistics
+   * @param first_page_in_batch first page in batch (index bias for `ck.first_page`)
+   * @param physical_type Parquet physical type of the column
+   * @param chunk_offset File offset at which the chunk's first page was written
+   */
+  void append_page_index(gpu::EncColumnChunk const& ck,
+                         std::vector<gpu::EncPage> const& h_pages,
+                         std::vector<statistics_chunk> const& h_page_stats,
+                         uint32_t first_page_in_batch,
+                         Type physical_type,
+                         size_t chunk_offset);
+
  private:
   // TODO : figure out if we want to keep this. It is currently unused.
   rmm::mr::device_memory_resource* _mr = nullptr;
@@ -213,6 +232,8 @@ class writer::impl {
   size_t max_rowgroup_rows_          = DEFAULT_ROWGROUP_MAXROWS;
   size_t target_page_size_           = DEFAULT_TARGET_PAGE_SIZE;
   Compression compression_           = Compression::UNCOMPRESSED;
+  // Page compressor with reusable scratch, shared by all batches and table writes
+  batched_compressor compressor_;
   statistics_freq stats_granularity_ = statistics_freq::STATISTICS_NONE;
   bool int96_timestamps              = false;
   // Overall file metadata.  Filled in during the process and written during write_chunked_end()
@@ -229,6 +250,12 @@ class writer::impl {
 
   std::vector<uint8_t> buffer_;
   std::unique_ptr<data_sink> out_sink_;
+  // Per-chunk page indexes in file order (row group major); serialized before the footer when
+  // page-level statistics are enabled
+  std::vector<ColumnIndex> column_indexes_;
+  std::vector<OffsetIndex> offset_indexes_;
+  // Single writer thread preserving sink order while overlapping flushes with D2H staging
+  cudf::detail::thread_pool write_pool_{1};
 };
 
 }  // namespace parquet
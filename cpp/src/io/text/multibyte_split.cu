@@ -26,8 +26,11 @@
 
 #include <rmm/cuda_stream_pool.hpp>
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/mr/device/device_memory_resource.hpp>
 
+#include <thrust/binary_search.h>
+
 #include <cub/block/block_load.cuh>
 #include <cub/block/block_scan.cuh>
 
@@ -128,6 +131,8 @@ __global__ void multibyte_split_kernel(
   cudf::io::text::detail::trie_device_view trie,
   int32_t chunk_input_offset,
   cudf::device_span<char const> chunk_input_chars,
+  cudf::size_type output_delimiter_base,
+  int32_t output_char_base,
   cudf::device_span<int32_t> abs_output_delimiter_offsets,
   cudf::device_span<char> abs_output_chars)
 {
@@ -184,15 +189,22 @@ __global__ void multibyte_split_kernel(
 
   if (abs_output_chars.size() > 0) {
     for (int32_t i = 0; i < ITEMS_PER_THREAD and i < thread_input_size; i++) {
-      abs_output_chars[chunk_input_offset + thread_input_offset + i] = thread_chars[i];
+      auto const char_idx = chunk_input_offset + thread_input_offset + i - output_char_base;
+      if (char_idx >= 0 and char_idx < static_cast<int32_t>(abs_output_chars.size())) {
+        abs_output_chars[char_idx] = thread_chars[i];
+      }
     }
   }
 
   if (abs_output_delimiter_offsets.size() > 0) {
     for (int32_t i = 0; i < ITEMS_PER_THREAD and i < thread_input_size; i++) {
       if (trie.is_match(thread_states[i])) {
-        auto const match_end = base_tile_idx * ITEMS_PER_TILE + thread_input_offset + i + 1;
-        abs_output_delimiter_offsets[thread_offsets[i]] = match_end;
+        auto const match_end  = base_tile_idx * ITEMS_PER_TILE + thread_input_offset + i + 1;
+        auto const offset_idx = static_cast<int32_t>(thread_offsets[i]) - output_delimiter_base;
+        if (offset_idx >= 0 and
+            offset_idx < static_cast<int32_t>(abs_output_delimiter_offsets.size())) {
+          abs_output_delimiter_offsets[offset_idx] = match_end - output_char_base;
+        }
       }
     }
   }
@@ -242,6 +254,8 @@ cudf::size_type multibyte_split_scan_full_source(cudf::io::text::data_chunk_sour
                                                  scan_tile_state<uint32_t>& tile_offsets,
                                                  device_span<cudf::size_type> output_buffer,
                                                  device_span<char> output_char_buffer,
+                                                 cudf::size_type output_delimiter_base,
+                                                 int32_t output_char_base,
                                                  rmm::cuda_stream_view stream,
                                                  std::vector<rmm::cuda_stream_view> const& streams)
 {
@@ -300,6 +314,8 @@ cudf::size_type multibyte_split_scan_full_source(cudf::io::text::data_chunk_sour
       trie.view(),
       chunk_offset,
       *chunk,
+      output_delimiter_base,
+      output_char_base,
       output_buffer,
       output_char_buffer);
 
@@ -347,6 +363,8 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
                                      tile_offsets,
                                      cudf::device_span<int32_t>(static_cast<int32_t*>(nullptr), 0),
                                      cudf::device_span<char>(static_cast<char*>(nullptr), 0),
+                                     0,
+                                     0,
                                      stream,
                                      streams);
 
@@ -369,6 +387,8 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
     tile_offsets,
     cudf::device_span<int32_t>(string_offsets).subspan(1, num_results),
     string_chars,
+    0,
+    0,
     stream,
     streams);
 
@@ -376,6 +396,135 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
     string_count, std::move(string_offsets), std::move(string_chars));
 }
 
+std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
+                                              std::string const& delimiter,
+                                              std::size_t byte_range_offset,
+                                              std::size_t byte_range_size,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr,
+                                              rmm::cuda_stream_pool& stream_pool)
+{
+  CUDF_FUNC_RANGE();
+  auto const trie = cudf::io::text::detail::trie::create({delimiter}, stream);
+
+  CUDF_EXPECTS(trie.max_duplicate_tokens() < multistate::max_segment_count,
+               "delimiter contains too many duplicate tokens to produce a deterministic result.");
+
+  CUDF_EXPECTS(trie.size() < multistate::max_segment_value,
+               "delimiter contains too many total tokens to produce a deterministic result.");
+
+  auto concurrency = 2;
+  // must be at least 32 when using warp-reduce on partials
+  // must be at least 1 more than max possible concurrent tiles
+  // best when at least 32 more than max possible concurrent tiles, due to rolling `invalid`s
+  auto num_tile_states  = std::max(32, TILES_PER_CHUNK * concurrency + 32);
+  auto tile_multistates = scan_tile_state<multistate>(num_tile_states, stream);
+  auto tile_offsets     = scan_tile_state<uint32_t>(num_tile_states, stream);
+
+  auto streams = get_streams(concurrency, stream_pool);
+
+  auto bytes_total =
+    multibyte_split_scan_full_source(source,
+                                     trie,
+                                     tile_multistates,
+                                     tile_offsets,
+                                     cudf::device_span<int32_t>(static_cast<int32_t*>(nullptr), 0),
+                                     cudf::device_span<char>(static_cast<char*>(nullptr), 0),
+                                     0,
+                                     0,
+                                     stream,
+                                     streams);
+
+  auto num_tiles   = cudf::util::div_rounding_up_safe(bytes_total, ITEMS_PER_TILE);
+  auto num_matches = tile_offsets.get_inclusive_prefix(num_tiles - 1, stream);
+
+  // the row boundaries within the byte range can only be known once all delimiter offsets are
+  // known, since the pattern-matching state at any byte depends on all preceding bytes. scan the
+  // full source once more to materialize every delimiter offset, then binary-search for the rows
+  // owned by the byte range.
+  auto all_offsets = rmm::device_uvector<int32_t>(num_matches, stream);
+
+  multibyte_split_scan_full_source(source,
+                                   trie,
+                                   tile_multistates,
+                                   tile_offsets,
+                                   cudf::device_span<int32_t>(all_offsets),
+                                   cudf::device_span<char>(static_cast<char*>(nullptr), 0),
+                                   0,
+                                   0,
+                                   stream,
+                                   streams);
+
+  auto const range_begin = static_cast<int32_t>(
+    std::min(byte_range_offset, static_cast<std::size_t>(bytes_total)));
+  auto const range_end = byte_range_size == 0
+                           ? bytes_total
+                           : static_cast<int32_t>(std::min(byte_range_offset + byte_range_size,
+                                                           static_cast<std::size_t>(bytes_total)));
+
+  if (range_begin >= range_end) { return cudf::make_empty_column(data_type{type_id::STRING}); }
+
+  // a row is owned by the byte range which contains the row's first byte. rows which begin within
+  // the range but end past it are still produced in full, which is why each range must also scan
+  // past its end to the next delimiter. the empty row which follows a delimiter at the very end of
+  // the input begins at `bytes_total`, so it is owned by the range which reaches the end of the
+  // input - that way, concatenating the output of contiguous ranges matches a whole-source split.
+  auto const first_match =
+    thrust::distance(all_offsets.begin(),
+                     thrust::lower_bound(
+                       rmm::exec_policy(stream), all_offsets.begin(), all_offsets.end(), range_begin));
+  auto const last_match =
+    range_end == bytes_total
+      ? static_cast<int64_t>(num_matches)
+      : thrust::distance(all_offsets.begin(),
+                         thrust::lower_bound(
+                           rmm::exec_policy(stream), all_offsets.begin(), all_offsets.end(), range_end));
+
+  auto const includes_first_row = range_begin == 0;
+  auto const string_count =
+    static_cast<cudf::size_type>(last_match - first_match) + (includes_first_row ? 1 : 0);
+
+  if (string_count == 0) { return cudf::make_empty_column(data_type{type_id::STRING}); }
+
+  auto const first_byte =
+    includes_first_row ? 0 : all_offsets.element(first_match, stream);
+  auto const last_byte = last_match < static_cast<int64_t>(num_matches)
+                           ? all_offsets.element(last_match, stream)
+                           : bytes_total;
+
+  auto string_offsets = rmm::device_uvector<int32_t>(string_count + 1, stream, mr);
+  auto string_chars   = rmm::device_uvector<char>(last_byte - first_byte, stream, mr);
+
+  // first and last element are set manually; the kernel only writes the offsets of delimiters it
+  // finds, rebased to the first owned byte.
+  auto const chars_size = static_cast<int32_t>(string_chars.size());
+  string_offsets.set_element_to_zero_async(0, stream);
+  string_offsets.set_element_async(string_count, chars_size, stream);
+
+  // when the range includes row zero, the offsets span excludes the manually-set leading zero and
+  // delimiter `i` lands in slot `i + 1`; otherwise, the first owned row begins at a delimiter and
+  // slot zero holds that delimiter's (rebased, therefore zero) offset.
+  auto const delimiter_base =
+    includes_first_row ? 0 : static_cast<cudf::size_type>(first_match);
+  auto output_offsets = includes_first_row
+                          ? cudf::device_span<int32_t>(string_offsets).subspan(1, string_count)
+                          : cudf::device_span<int32_t>(string_offsets);
+
+  multibyte_split_scan_full_source(source,
+                                   trie,
+                                   tile_multistates,
+                                   tile_offsets,
+                                   output_offsets,
+                                   string_chars,
+                                   delimiter_base,
+                                   first_byte,
+                                   stream,
+                                   streams);
+
+  return cudf::make_strings_column(
+    string_count, std::move(string_offsets), std::move(string_chars));
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
@@ -391,6 +540,22 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
   return result;
 }
 
+std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
+                                              std::string const& delimiter,
+                                              std::size_t byte_range_offset,
+                                              std::size_t byte_range_size,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  auto stream      = rmm::cuda_stream_default;
+  auto stream_pool = rmm::cuda_stream_pool(2);
+  auto result      = detail::multibyte_split(
+    source, delimiter, byte_range_offset, byte_range_size, stream, mr, stream_pool);
+
+  stream.synchronize();
+
+  return result;
+}
+
 }  // namespace text
 }  // namespace io
 }  // namespace cudf
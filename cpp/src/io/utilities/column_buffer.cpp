@@ -63,6 +63,13 @@ std::unique_ptr<column> make_column(column_buffer& buffer,
 {
   if (schema_info != nullptr) { schema_info->name = buffer.name; }
 
+  // Masks are allocated before decoding; a null count of exactly zero here proves the mask is
+  // all valid, so release it instead of attaching it to the output column. An unknown null
+  // count (e.g. from the CSV reader) keeps the mask.
+  if (buffer._null_count == 0 and buffer._null_mask.size() > 0) {
+    buffer._null_mask = rmm::device_buffer{};
+  }
+
   switch (buffer.type.id()) {
     case type_id::STRING:
       if (schema_info != nullptr) {
@@ -33,6 +33,18 @@ struct column_type_histogram {
   cudf::size_type positive_small_int_count;
   cudf::size_type big_int_count;
   cudf::size_type bool_count;
+
+  constexpr column_type_histogram operator+(column_type_histogram const& other) const
+  {
+    return {null_count + other.null_count,
+            float_count + other.float_count,
+            datetime_count + other.datetime_count,
+            string_count + other.string_count,
+            negative_small_int_count + other.negative_small_int_count,
+            positive_small_int_count + other.positive_small_int_count,
+            big_int_count + other.big_int_count,
+            bool_count + other.bool_count};
+  }
 };
 
 }  // namespace io
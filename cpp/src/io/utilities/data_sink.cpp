@@ -14,11 +14,15 @@
  * limitations under the License.
  */
 
+#include <condition_variable>
 #include <fstream>
+#include <memory>
+#include <mutex>
 
 #include <cudf/io/data_sink.hpp>
 #include <cudf/utilities/error.hpp>
 #include "file_io_utilities.hpp"
+#include "thread_pool.hpp"
 
 #include <rmm/cuda_stream_view.hpp>
 
@@ -119,6 +123,96 @@ class void_sink : public data_sink {
   size_t _bytes_written;
 };
 
+/**
+ * @brief Wrapper that services the writes of another sink from a background thread.
+ *
+ * `host_write` copies the data into an owned buffer and returns as soon as it is queued; a single
+ * worker thread performs the actual writes in order, so encoding overlaps the transfer. The queue
+ * is bounded to cap memory usage; writes block while the backlog is at the limit. `flush` acts as
+ * a barrier that drains the queue before flushing the wrapped sink.
+ */
+class write_behind_sink : public data_sink {
+ public:
+  explicit write_behind_sink(std::unique_ptr<data_sink> sink, size_t max_queued_bytes)
+    : _sink(std::move(sink)), _max_queued_bytes(max_queued_bytes)
+  {
+  }
+
+  virtual ~write_behind_sink()
+  {
+    try {
+      flush();
+    } catch (...) {
+      // Destructors must not throw; the error was likely already surfaced by an earlier write
+    }
+  }
+
+  void host_write(void const* data, size_t size) override
+  {
+    rethrow_pending_error();
+    {
+      std::unique_lock<std::mutex> lock(_lock);
+      _queue_not_full.wait(lock, [&] { return _queued_bytes < _max_queued_bytes; });
+      _queued_bytes += size;
+    }
+    auto const char_array = static_cast<char const*>(data);
+    auto buffer = std::make_shared<std::vector<char>>(char_array, char_array + size);
+    _pool.push_task([this, buffer]() {
+      try {
+        _sink->host_write(buffer->data(), buffer->size());
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(_lock);
+        if (not _pending_error) { _pending_error = std::current_exception(); }
+      }
+      {
+        std::lock_guard<std::mutex> lock(_lock);
+        _queued_bytes -= buffer->size();
+      }
+      _queue_not_full.notify_one();
+    });
+    _bytes_written += size;
+  }
+
+  void flush() override
+  {
+    _pool.wait_for_tasks();
+    _sink->flush();
+    rethrow_pending_error();
+  }
+
+  size_t bytes_written() override { return _bytes_written; }
+
+  // Device writes bypass the queue and would reorder with the pending host writes
+  bool supports_device_write() const override { return false; }
+
+ private:
+  /**
+   * @brief Surfaces errors from the worker thread on the next write or flush.
+   */
+  void rethrow_pending_error()
+  {
+    std::lock_guard<std::mutex> lock(_lock);
+    if (_pending_error) {
+      auto error     = _pending_error;
+      _pending_error = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+  std::unique_ptr<data_sink> _sink;
+  size_t const _max_queued_bytes;
+  size_t _bytes_written = 0;
+
+  std::mutex _lock;
+  std::condition_variable _queue_not_full;
+  size_t _queued_bytes = 0;
+  std::exception_ptr _pending_error;
+
+  // Single worker thread, so the queued writes are performed in order. Last member, so the
+  // remaining tasks complete before the other members are destroyed
+  cudf::detail::thread_pool _pool{1};
+};
+
 class user_sink_wrapper : public data_sink {
  public:
   explicit user_sink_wrapper(cudf::io::data_sink* const user_sink_) : user_sink(user_sink_) {}
@@ -146,7 +240,14 @@ class user_sink_wrapper : public data_sink {
 
 std::unique_ptr<data_sink> data_sink::create(const std::string& filepath)
 {
-  return std::make_unique<file_sink>(filepath);
+  auto sink = std::make_unique<file_sink>(filepath);
+  // Write-behind mode overlaps encoding with the file writes; most useful on slow (e.g. network)
+  // storage. Opt-in as it holds up to the queue limit of extra host memory
+  if (detail::getenv_or("LIBCUDF_WRITE_BEHIND", "OFF") == "ON") {
+    constexpr size_t max_queued_bytes = 64 << 20;
+    return std::make_unique<write_behind_sink>(std::move(sink), max_queued_bytes);
+  }
+  return sink;
 }
 
 std::unique_ptr<data_sink> data_sink::create(std::vector<char>* buffer)
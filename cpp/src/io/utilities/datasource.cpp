@@ -23,6 +23,19 @@
 #include <cudf/utilities/error.hpp>
 #include "file_io_utilities.hpp"
 
+#ifdef CUDF_CURL_FOUND
+#include "thread_pool.hpp"
+
+#include <curl/curl.h>
+#endif
+
+#include <rmm/device_buffer.hpp>
+
+#include <list>
+#include <mutex>
+#include <numeric>
+#include <unordered_map>
+
 namespace cudf {
 namespace io {
 namespace {
@@ -39,21 +52,23 @@ class file_source : public datasource {
 
   virtual ~file_source() = default;
 
-  bool supports_device_read() const override { return _cufile_in != nullptr; }
+  bool supports_device_read() const override { return true; }
 
   bool is_device_read_preferred(size_t size) const override
   {
-    return _cufile_in != nullptr && _cufile_in->is_cufile_io_preferred(size);
+    // The threaded pread fallback also beats a host read + single H2D copy above the threshold
+    return detail::cufile_io_base::is_cufile_io_preferred(size);
   }
 
   std::unique_ptr<datasource::buffer> device_read(size_t offset,
                                                   size_t size,
                                                   rmm::cuda_stream_view stream) override
   {
-    CUDF_EXPECTS(supports_device_read(), "Device reads are not supported for this file.");
-
-    auto const read_size = std::min(size, _file.size() - offset);
-    return _cufile_in->read(offset, read_size, stream);
+    rmm::device_buffer out_data(std::min(size, _file.size() - offset), stream);
+    auto const read_size =
+      device_read(offset, out_data.size(), static_cast<uint8_t*>(out_data.data()), stream);
+    out_data.resize(read_size, stream);
+    return buffer::create(std::move(out_data));
   }
 
   size_t device_read(size_t offset,
@@ -61,10 +76,7 @@ class file_source : public datasource {
                      uint8_t* dst,
                      rmm::cuda_stream_view stream) override
   {
-    CUDF_EXPECTS(supports_device_read(), "Device reads are not supported for this file.");
-
-    auto const read_size = std::min(size, _file.size() - offset);
-    return _cufile_in->read(offset, read_size, dst, stream);
+    return device_read_async(offset, size, dst, stream).get();
   }
 
   std::future<size_t> device_read_async(size_t offset,
@@ -72,10 +84,9 @@ class file_source : public datasource {
                                         uint8_t* dst,
                                         rmm::cuda_stream_view stream) override
   {
-    CUDF_EXPECTS(supports_device_read(), "Device reads are not supported for this file.");
-
     auto const read_size = std::min(size, _file.size() - offset);
-    return _cufile_in->read_async(offset, read_size, dst, stream);
+    if (_cufile_in != nullptr) { return _cufile_in->read_async(offset, read_size, dst, stream); }
+    return fallback_input().read_async(offset, read_size, dst, stream);
   }
 
   size_t size() const override { return _file.size(); }
@@ -84,7 +95,23 @@ class file_source : public datasource {
   detail::file_wrapper _file;
 
  private:
+  /**
+   * @brief Returns the threaded pread reader, created on the first device read without GDS.
+   *
+   * Created lazily so that sources that never read into device memory do not pay for the thread
+   * pool.
+   */
+  detail::threaded_device_input& fallback_input()
+  {
+    std::call_once(_fallback_init, [this]() {
+      _fallback_in = std::make_unique<detail::threaded_device_input>(_file.desc());
+    });
+    return *_fallback_in;
+  }
+
   std::unique_ptr<detail::cufile_input_impl> _cufile_in;
+  std::unique_ptr<detail::threaded_device_input> _fallback_in;
+  std::once_flag _fallback_init;
 };
 
 /**
@@ -188,6 +215,258 @@ class direct_read_source : public file_source {
   }
 };
 
+/**
+ * @brief Implementation class for reading from a file using batched io_uring reads
+ *
+ * Each read is split into multiple submission queue entries that the kernel serves in parallel,
+ * which speeds up the many small scattered reads issued for column chunks. The file's ring is
+ * shared, so concurrent chunk reads are batched into the same submission queue.
+ */
+class uring_read_source : public file_source {
+ public:
+  explicit uring_read_source(const char* filepath,
+                             std::unique_ptr<detail::uring_input_impl> uring_in)
+    : file_source(filepath), _uring_in(std::move(uring_in))
+  {
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    // Clamp length to available data
+    auto const read_size = std::min(size, _file.size() - offset);
+
+    std::vector<uint8_t> v(read_size);
+    v.resize(_uring_in->read(offset, read_size, v.data()));
+    return buffer::create(std::move(v));
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    // Clamp length to available data
+    auto const read_size = std::min(size, _file.size() - offset);
+
+    return _uring_in->read(offset, read_size, dst);
+  }
+
+ private:
+  std::unique_ptr<detail::uring_input_impl> _uring_in;
+};
+
+/**
+ * @brief Returns true for URIs that name a remote object instead of a local file.
+ */
+bool is_remote_uri(std::string const& path)
+{
+  return path.rfind("s3://", 0) == 0 or path.rfind("gs://", 0) == 0 or
+         path.rfind("http://", 0) == 0 or path.rfind("https://", 0) == 0;
+}
+
+#ifdef CUDF_CURL_FOUND
+
+/**
+ * @brief Rewrites object store URIs to the corresponding HTTPS endpoints.
+ */
+std::string to_https_url(std::string const& uri)
+{
+  auto const scheme_end = uri.find("://");
+  auto const scheme     = uri.substr(0, scheme_end);
+  auto const path       = uri.substr(scheme_end + 3);
+  if (scheme == "s3") {
+    // Virtual-hosted style addressing; bucket name becomes part of the host
+    auto const bucket_end = path.find('/');
+    return "https://" + path.substr(0, bucket_end) + ".s3.amazonaws.com" +
+           path.substr(bucket_end);
+  }
+  if (scheme == "gs") { return "https://storage.googleapis.com/" + path; }
+  return uri;
+}
+
+struct curl_write_dest {
+  uint8_t* data;
+  size_t capacity;
+  size_t written;
+};
+
+size_t curl_write_to_buffer(char* src, size_t size, size_t nmemb, void* userdata)
+{
+  auto* const dest  = static_cast<curl_write_dest*>(userdata);
+  auto const nbytes = std::min(size * nmemb, dest->capacity - dest->written);
+  std::memcpy(dest->data + dest->written, src, nbytes);
+  dest->written += nbytes;
+  // Always report the full size as consumed; returning less aborts the transfer
+  return size * nmemb;
+}
+
+using curl_handle = std::unique_ptr<CURL, decltype(&curl_easy_cleanup)>;
+
+curl_handle make_curl_handle(std::string const& url)
+{
+  static std::once_flag curl_global_flag;
+  std::call_once(curl_global_flag, []() { curl_global_init(CURL_GLOBAL_DEFAULT); });
+
+  curl_handle curl{curl_easy_init(), curl_easy_cleanup};
+  CUDF_EXPECTS(curl != nullptr, "Cannot create curl handle");
+  curl_easy_setopt(curl.get(), CURLOPT_URL, url.c_str());
+  curl_easy_setopt(curl.get(), CURLOPT_FOLLOWLOCATION, 1L);
+  curl_easy_setopt(curl.get(), CURLOPT_FAILONERROR, 1L);
+  return curl;
+}
+
+/**
+ * @brief Implementation class for reading a remote object through ranged HTTP GET requests.
+ *
+ * Ranged requests are issued concurrently from a thread pool, so the scattered column chunk reads
+ * of a single file overlap on the network instead of being serialized. Device reads stage each
+ * range through a pinned host buffer and overlap the download with the H2D copies.
+ */
+class remote_source : public datasource {
+ public:
+  explicit remote_source(std::string const& uri)
+    : _url(to_https_url(uri)),
+      _pool(16),  // Throughput from concurrent ranged requests plateaus around 16 connections
+      _size(query_size(_url))
+  {
+  }
+
+  size_t size() const override { return _size; }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    auto const read_size = std::min(size, _size - offset);
+
+    std::vector<std::future<size_t>> slice_tasks;
+    for_each_slice(offset, read_size, [&](size_t slice_offset, size_t slice_size, size_t dst_pos) {
+      slice_tasks.push_back(_pool.submit(
+        [this](size_t offset, size_t size, uint8_t* dst) { return read_range(offset, size, dst); },
+        slice_offset,
+        slice_size,
+        dst + dst_pos));
+    });
+    return std::accumulate(
+      slice_tasks.begin(), slice_tasks.end(), size_t{0}, [](auto sum, auto& task) {
+        return sum + task.get();
+      });
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    auto const read_size = std::min(size, _size - offset);
+
+    std::vector<uint8_t> v(read_size);
+    v.resize(host_read(offset, read_size, v.data()));
+    return buffer::create(std::move(v));
+  }
+
+  bool supports_device_read() const override { return true; }
+
+  // Staging through pinned memory is faster than going through a host buffer read
+  bool is_device_read_preferred(size_t size) const override { return true; }
+
+  std::future<size_t> device_read_async(size_t offset,
+                                        size_t size,
+                                        uint8_t* dst,
+                                        rmm::cuda_stream_view stream) override
+  {
+    auto const read_size = std::min(size, _size - offset);
+
+    // Each slice downloads into its own pinned buffer and copies to the device as soon as the
+    // download completes, overlapping the network transfers with the H2D copies
+    auto read_slice = [this, stream](size_t offset, size_t size, uint8_t* dst) -> size_t {
+      uint8_t* staging = nullptr;
+      CUDA_TRY(cudaMallocHost(reinterpret_cast<void**>(&staging), size));
+      auto const bytes_read = read_range(offset, size, staging);
+      CUDA_TRY(cudaMemcpyAsync(dst, staging, bytes_read, cudaMemcpyHostToDevice, stream.value()));
+      stream.synchronize();
+      CUDA_TRY(cudaFreeHost(staging));
+      return bytes_read;
+    };
+
+    std::vector<std::future<size_t>> slice_tasks;
+    for_each_slice(offset, read_size, [&](size_t slice_offset, size_t slice_size, size_t dst_pos) {
+      slice_tasks.push_back(_pool.submit(read_slice, slice_offset, slice_size, dst + dst_pos));
+    });
+    auto waiter = [](decltype(slice_tasks) slice_tasks) -> size_t {
+      return std::accumulate(
+        slice_tasks.begin(), slice_tasks.end(), size_t{0}, [](auto sum, auto& task) {
+          return sum + task.get();
+        });
+    };
+    // Deferred to avoid creating a thread per read; the pool does the actual work
+    return std::async(std::launch::deferred, waiter, std::move(slice_tasks));
+  }
+
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override
+  {
+    return device_read_async(offset, size, dst, stream).get();
+  }
+
+  std::unique_ptr<buffer> device_read(size_t offset,
+                                      size_t size,
+                                      rmm::cuda_stream_view stream) override
+  {
+    rmm::device_buffer out_data(std::min(size, _size - offset), stream);
+    auto const read_size =
+      device_read(offset, out_data.size(), static_cast<uint8_t*>(out_data.data()), stream);
+    out_data.resize(read_size, stream);
+    return buffer::create(std::move(out_data));
+  }
+
+ private:
+  // Matches the typical Parquet column chunk size; larger reads are split to keep requests
+  // parallel, smaller reads go out as a single request
+  static constexpr size_t max_slice_bytes = 8 * 1024 * 1024;
+
+  /**
+   * @brief Invokes `slice_fn(slice_offset, slice_size, dst_pos)` for each slice of a read.
+   */
+  template <typename SliceFn>
+  void for_each_slice(size_t offset, size_t size, SliceFn&& slice_fn)
+  {
+    for (size_t pos = 0; pos < size; pos += max_slice_bytes) {
+      slice_fn(offset + pos, std::min(size - pos, max_slice_bytes), pos);
+    }
+  }
+
+  /**
+   * @brief Downloads a byte range of the remote object into host memory.
+   */
+  size_t read_range(size_t offset, size_t size, uint8_t* dst) const
+  {
+    auto curl = make_curl_handle(_url);
+    auto const range =
+      std::to_string(offset) + "-" + std::to_string(offset + size - 1);
+    curl_write_dest dest{dst, size, 0};
+    curl_easy_setopt(curl.get(), CURLOPT_RANGE, range.c_str());
+    curl_easy_setopt(curl.get(), CURLOPT_WRITEFUNCTION, curl_write_to_buffer);
+    curl_easy_setopt(curl.get(), CURLOPT_WRITEDATA, &dest);
+    auto const res = curl_easy_perform(curl.get());
+    CUDF_EXPECTS(res == CURLE_OK,
+                 "Cannot read from remote source: " + std::string(curl_easy_strerror(res)));
+    return dest.written;
+  }
+
+  static size_t query_size(std::string const& url)
+  {
+    auto curl = make_curl_handle(url);
+    curl_easy_setopt(curl.get(), CURLOPT_NOBODY, 1L);
+    auto const res = curl_easy_perform(curl.get());
+    CUDF_EXPECTS(res == CURLE_OK,
+                 "Cannot access remote source: " + std::string(curl_easy_strerror(res)));
+    curl_off_t content_length = -1;
+    curl_easy_getinfo(curl.get(), CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &content_length);
+    CUDF_EXPECTS(content_length >= 0, "Cannot query size of remote source");
+    return static_cast<size_t>(content_length);
+  }
+
+  std::string const _url;
+  cudf::detail::thread_pool _pool;
+  size_t const _size;
+};
+#endif
+
 /**
  * @brief Wrapper class for user implemented data sources
  *
@@ -232,18 +511,240 @@ class user_datasource_wrapper : public datasource {
   datasource* const source;  ///< A non-owning pointer to the user-implemented datasource
 };
 
+/**
+ * @brief Wrapper that serves reads of another datasource from an LRU cache of pinned memory
+ * blocks.
+ *
+ * The source is read in `block_size`-sized blocks; blocks stay cached until evicted to make room
+ * for more recently used ones. Cached blocks are handed out with shared ownership, so buffers
+ * returned from `host_read` and in-flight device copies stay valid across eviction.
+ */
+class block_cache_source : public datasource {
+  struct pinned_deleter {
+    void operator()(uint8_t* ptr) const { cudaFreeHost(ptr); }
+  };
+  using pinned_ptr = std::shared_ptr<uint8_t>;
+
+  /**
+   * @brief Buffer that shares ownership of the cache block it points into.
+   */
+  class cached_buffer : public buffer {
+   public:
+    cached_buffer(pinned_ptr block, size_t offset, size_t size)
+      : _block(std::move(block)), _offset(offset), _size(size)
+    {
+    }
+
+    size_t size() const override { return _size; }
+
+    uint8_t const* data() const override { return _block.get() + _offset; }
+
+   private:
+    pinned_ptr _block;
+    size_t const _offset;
+    size_t const _size;
+  };
+
+  struct cache_block {
+    size_t index;       // block index; first byte of the block is at `index * block_size`
+    pinned_ptr data;    // pinned memory holding the block contents
+    size_t valid_size;  // bytes read from the source; only smaller than the block size at EOF
+  };
+
+ public:
+  explicit block_cache_source(std::unique_ptr<datasource> source,
+                              size_t max_cache_size,
+                              size_t block_size)
+    : _source(std::move(source)),
+      _block_size(block_size),
+      _max_blocks(std::max<size_t>(max_cache_size / block_size, 1)),
+      _size(_source->size())
+  {
+    CUDF_EXPECTS(block_size != 0, "Cache block size cannot be zero");
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    auto const read_size = clamped_read_size(offset, size);
+    if (read_size == 0) { return std::make_unique<non_owning_buffer>(); }
+
+    if (offset / _block_size == (offset + read_size - 1) / _block_size) {
+      // Request fits in a single block; share the cached block instead of copying
+      size_t valid_size = 0;
+      auto block        = fetch_block(offset / _block_size, valid_size);
+      auto const block_offset = offset % _block_size;
+      auto const len = block_offset < valid_size ? std::min(read_size, valid_size - block_offset)
+                                                 : size_t{0};
+      return std::make_unique<cached_buffer>(std::move(block), block_offset, len);
+    }
+
+    std::vector<uint8_t> v(read_size);
+    v.resize(host_read(offset, read_size, v.data()));
+    return buffer::create(std::move(v));
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    return for_each_block(
+      offset, size, [dst](pinned_ptr const& block, size_t src_offset, size_t dst_offset, size_t len) {
+        std::memcpy(dst + dst_offset, block.get() + src_offset, len);
+      });
+  }
+
+  // Copies from the pinned cache blocks always beat a cold read of the wrapped source
+  bool supports_device_read() const override { return true; }
+
+  std::unique_ptr<buffer> device_read(size_t offset,
+                                      size_t size,
+                                      rmm::cuda_stream_view stream) override
+  {
+    rmm::device_buffer out(clamped_read_size(offset, size), stream);
+    auto const bytes_read = device_read(offset, size, static_cast<uint8_t*>(out.data()), stream);
+    out.resize(bytes_read, stream);
+    return buffer::create(std::move(out));
+  }
+
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override
+  {
+    auto const read_size = enqueue_device_copies(offset, size, dst, stream).first;
+    stream.synchronize();
+    return read_size;
+  }
+
+  std::future<size_t> device_read_async(size_t offset,
+                                        size_t size,
+                                        uint8_t* dst,
+                                        rmm::cuda_stream_view stream) override
+  {
+    auto copies = enqueue_device_copies(offset, size, dst, stream);
+    // Keep the source blocks alive until the copies are synchronized
+    return std::async(std::launch::deferred,
+                      [stream, read_size = copies.first, blocks = std::move(copies.second)]() {
+                        stream.synchronize();
+                        return read_size;
+                      });
+  }
+
+  size_t size() const override { return _size; }
+
+ private:
+  size_t clamped_read_size(size_t offset, size_t size) const
+  {
+    return std::min(size, _size - std::min(offset, _size));
+  }
+
+  /**
+   * @brief Returns the cached block with the given index, reading it from the source on a miss.
+   *
+   * The evicted block's pinned memory is reused for the new block when no outstanding buffer
+   * references it.
+   */
+  pinned_ptr fetch_block(size_t block_index, size_t& valid_size)
+  {
+    std::lock_guard<std::mutex> lock(_lock);
+    auto const it = _block_map.find(block_index);
+    if (it != _block_map.end()) {
+      _lru.splice(_lru.begin(), _lru, it->second);
+      valid_size = it->second->valid_size;
+      return it->second->data;
+    }
+
+    auto data = [&]() -> pinned_ptr {
+      if (_block_map.size() >= _max_blocks) {
+        auto evicted = std::move(_lru.back());
+        _block_map.erase(evicted.index);
+        _lru.pop_back();
+        if (evicted.data.use_count() == 1) { return std::move(evicted.data); }
+      }
+      uint8_t* ptr = nullptr;
+      CUDA_TRY(cudaMallocHost(reinterpret_cast<void**>(&ptr), _block_size));
+      return {ptr, pinned_deleter{}};
+    }();
+
+    valid_size = _source->host_read(block_index * _block_size, _block_size, data.get());
+    _lru.push_front(cache_block{block_index, data, valid_size});
+    _block_map[block_index] = _lru.begin();
+    return data;
+  }
+
+  /**
+   * @brief Applies `copy_fn` to the cached span of each block that overlaps the requested range.
+   *
+   * @return The number of bytes covered (can be smaller than `size` at EOF)
+   */
+  template <typename CopyFn>
+  size_t for_each_block(size_t offset, size_t size, CopyFn copy_fn)
+  {
+    auto const read_size = clamped_read_size(offset, size);
+    size_t bytes_read    = 0;
+    while (bytes_read < read_size) {
+      auto const pos          = offset + bytes_read;
+      auto const block_offset = pos % _block_size;
+      size_t valid_size       = 0;
+      auto block              = fetch_block(pos / _block_size, valid_size);
+      if (block_offset >= valid_size) break;
+      auto const len = std::min(read_size - bytes_read, valid_size - block_offset);
+      copy_fn(block, block_offset, bytes_read, len);
+      bytes_read += len;
+    }
+    return bytes_read;
+  }
+
+  std::pair<size_t, std::vector<pinned_ptr>> enqueue_device_copies(size_t offset,
+                                                                   size_t size,
+                                                                   uint8_t* dst,
+                                                                   rmm::cuda_stream_view stream)
+  {
+    std::vector<pinned_ptr> blocks;
+    auto const read_size = for_each_block(
+      offset,
+      size,
+      [&, dst, stream](pinned_ptr const& block, size_t src_offset, size_t dst_offset, size_t len) {
+        CUDA_TRY(cudaMemcpyAsync(
+          dst + dst_offset, block.get() + src_offset, len, cudaMemcpyHostToDevice, stream.value()));
+        blocks.push_back(block);
+      });
+    return {read_size, std::move(blocks)};
+  }
+
+  std::unique_ptr<datasource> const _source;
+  size_t const _block_size;
+  size_t const _max_blocks;
+  size_t const _size;
+
+  std::mutex _lock;
+  std::list<cache_block> _lru;  // most recently used block at the front
+  std::unordered_map<size_t, std::list<cache_block>::iterator> _block_map;
+};
+
 }  // namespace
 
 std::unique_ptr<datasource> datasource::create(const std::string& filepath,
                                                size_t offset,
                                                size_t size)
 {
+  if (is_remote_uri(filepath)) {
+#ifdef CUDF_CURL_FOUND
+    // Native ranged GETs avoid Arrow's extra copy and serialized requests
+    if (detail::getenv_or("LIBCUDF_REMOTE_IO_POLICY", "CURL") != "ARROW") {
+      return std::make_unique<remote_source>(filepath);
+    }
+#endif
+    return std::make_unique<arrow_io_source>(filepath);
+  }
 #ifdef CUFILE_FOUND
   if (detail::cufile_config::instance()->is_required()) {
     // avoid mmap as GDS is expected to be used for most reads
     return std::make_unique<direct_read_source>(filepath.c_str());
   }
 #endif
+  // Batched reads through io_uring, when enabled via LIBCUDF_IO_URING_POLICY
+  if (auto uring_in = detail::make_uring_input(filepath)) {
+    return std::make_unique<uring_read_source>(filepath.c_str(), std::move(uring_in));
+  }
   // Use our own memory mapping implementation for direct file reads
   return std::make_unique<memory_mapped_source>(filepath.c_str(), offset, size);
 }
@@ -261,5 +762,12 @@ std::unique_ptr<datasource> datasource::create(datasource* source)
   return std::make_unique<user_datasource_wrapper>(source);
 }
 
+std::unique_ptr<datasource> datasource::create_cached(std::unique_ptr<datasource> source,
+                                                      size_t max_cache_size,
+                                                      size_t block_size)
+{
+  return std::make_unique<block_cache_source>(std::move(source), max_cache_size, block_size);
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -16,13 +16,19 @@
 
 #pragma once
 
-#ifdef CUFILE_FOUND
 #include "thread_pool.hpp"
 
+#ifdef CUFILE_FOUND
 #include <cufile.h>
 #include <cudf_test/file_utilities.hpp>
 #endif
 
+#ifdef CUDF_IO_URING_FOUND
+#include <liburing.h>
+
+#include <mutex>
+#endif
+
 #include <rmm/cuda_stream_view.hpp>
 
 #include <cudf/io/datasource.hpp>
@@ -49,6 +55,12 @@ class file_wrapper {
   auto desc() const { return fd; }
 };
 
+/**
+ * @brief Returns the value of the environment variable, or a default value if the variable is not
+ * present.
+ */
+std::string getenv_or(std::string const& env_var_name, std::string const& default_val);
+
 /**
  * @brief Base class for cuFile input/output.
  *
@@ -273,6 +285,103 @@ class cufile_output_impl final : public cufile_output {
 };
 #endif
 
+/**
+ * @brief Device file input for systems without GDS.
+ *
+ * Reads are sharded into slices over a thread pool; each slice is read with `pread` into a pooled
+ * pinned staging buffer and copied to the device on the caller's stream. Keeps multi-threaded
+ * device reads available when the cuFile path is disabled or not installed.
+ */
+class threaded_device_input {
+ public:
+  explicit threaded_device_input(int fd);
+
+  /**
+   * @brief Asynchronously reads a file region into existing device memory.
+   *
+   *  @throws cudf::logic_error on read failure
+   *
+   * @param offset Number of bytes from the start
+   * @param size Number of bytes to read
+   * @param dst Address of the existing device memory
+   * @param stream CUDA stream to use
+   *
+   * @return The number of bytes read as an std::future
+   */
+  std::future<size_t> read_async(size_t offset,
+                                 size_t size,
+                                 uint8_t* dst,
+                                 rmm::cuda_stream_view stream);
+
+ private:
+  int _fd = -1;
+  cudf::detail::thread_pool _pool;
+};
+
+/**
+ * @brief Interface class for batched host file input.
+ *
+ * Splits each read into multiple requests that the kernel can serve in parallel. This speeds up
+ * the many small scattered reads issued for column chunks, compared to sequential `pread` calls.
+ */
+class uring_input {
+ public:
+  virtual ~uring_input() = default;
+
+  /**
+   * @brief Reads into existing host memory.
+   *
+   *  @throws cudf::logic_error on io_uring error
+   *
+   * @param offset Number of bytes from the start
+   * @param size Number of bytes to read
+   * @param dst Address of the existing host memory
+   *
+   * @return The number of bytes read
+   */
+  virtual size_t read(size_t offset, size_t size, uint8_t* dst) = 0;
+};
+
+#ifdef CUDF_IO_URING_FOUND
+
+/**
+ * @brief Adapter for the liburing read APIs.
+ *
+ * All slices of a read are placed in the submission queue together, so concurrent chunk reads of
+ * the same file share a single ring. The ring is protected by a mutex; the kernel side of the
+ * requests still overlaps across callers.
+ */
+class uring_input_impl final : public uring_input {
+ public:
+  explicit uring_input_impl(std::string const& filepath);
+  ~uring_input_impl() override;
+
+  size_t read(size_t offset, size_t size, uint8_t* dst) override;
+
+ private:
+  file_wrapper const _file;
+  io_uring _ring;
+  std::mutex _ring_lock;
+};
+#else
+
+class uring_input_impl final : public uring_input {
+ public:
+  size_t read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    CUDF_FAIL("Only used to compile without liburing, should not be called");
+  }
+};
+#endif
+
+/**
+ * @brief Creates a `uring_input_impl` object
+ *
+ * Returns a null pointer if io_uring use is not enabled, if an exception occurs in the
+ * `uring_input_impl` constructor, or if liburing is not installed.
+ */
+std::unique_ptr<uring_input_impl> make_uring_input(std::string const& filepath);
+
 /**
  * @brief Creates a `cufile_input_impl` object
  *
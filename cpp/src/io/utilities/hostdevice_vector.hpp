@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "pinned_pool.hpp"
+
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
 
@@ -54,10 +56,11 @@ class hostdevice_vector {
   explicit hostdevice_vector(size_t initial_size,
                              size_t max_size,
                              rmm::cuda_stream_view stream = rmm::cuda_stream_default)
-    : num_elements(initial_size), max_elements(max_size)
+    : stream(stream), max_elements(max_size), num_elements(initial_size)
   {
     if (max_elements != 0) {
-      CUDA_TRY(cudaMallocHost(&h_data, sizeof(T) * max_elements));
+      h_data = static_cast<T*>(
+        cudf::io::detail::pinned_host_pool::instance()->allocate(sizeof(T) * max_elements));
       d_data.resize(sizeof(T) * max_elements, stream);
     }
   }
@@ -65,8 +68,8 @@ class hostdevice_vector {
   ~hostdevice_vector()
   {
     if (max_elements != 0) {
-      auto const free_result = cudaFreeHost(h_data);
-      assert(free_result == cudaSuccess);
+      cudf::io::detail::pinned_host_pool::instance()->deallocate(
+        h_data, sizeof(T) * max_elements, stream);
     }
   }
 
@@ -100,6 +103,8 @@ class hostdevice_vector {
 
   void host_to_device(rmm::cuda_stream_view stream, bool synchronize = false)
   {
+    // Remember the stream so the pinned memory is released in stream order
+    this->stream = stream;
     CUDA_TRY(cudaMemcpyAsync(
       d_data.data(), h_data, memory_size(), cudaMemcpyHostToDevice, stream.value()));
     if (synchronize) { stream.synchronize(); }
@@ -107,6 +112,8 @@ class hostdevice_vector {
 
   void device_to_host(rmm::cuda_stream_view stream, bool synchronize = false)
   {
+    // Remember the stream so the pinned memory is released in stream order
+    this->stream = stream;
     CUDA_TRY(cudaMemcpyAsync(
       h_data, d_data.data(), memory_size(), cudaMemcpyDeviceToHost, stream.value()));
     if (synchronize) { stream.synchronize(); }
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "pinned_pool.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+namespace {
+
+// Smallest pooled block; smaller requests are rounded up
+constexpr size_t min_block_bytes = 256;
+// Larger allocations are not pooled; they are rare enough that the allocation cost is amortized
+// and pooling them would hold on to large amounts of pinned memory
+constexpr size_t max_block_bytes = 16 << 20;
+
+// Rounds the allocation size up to the next power-of-two bucket
+size_t block_bytes_for(size_t bytes)
+{
+  auto block_bytes = min_block_bytes;
+  while (block_bytes < bytes) {
+    block_bytes *= 2;
+  }
+  return block_bytes;
+}
+
+}  // namespace
+
+pinned_host_pool* pinned_host_pool::instance()
+{
+  static pinned_host_pool _instance;
+  return &_instance;
+}
+
+void* pinned_host_pool::allocate(size_t bytes)
+{
+  if (bytes == 0) { return nullptr; }
+
+  void* ptr = nullptr;
+  if (bytes > max_block_bytes) {
+    CUDA_TRY(cudaMallocHost(&ptr, bytes));
+    return ptr;
+  }
+
+  auto const block_bytes = block_bytes_for(bytes);
+  {
+    std::lock_guard<std::mutex> lock(_lock);
+    auto& free_blocks = _free_blocks[block_bytes];
+    // Only reuse a block once the releasing stream has passed the release point
+    auto const reusable =
+      std::find_if(free_blocks.begin(), free_blocks.end(), [](pooled_block const& block) {
+        return cudaEventQuery(block.event) == cudaSuccess;
+      });
+    if (reusable != free_blocks.end()) {
+      ptr = reusable->ptr;
+      _event_cache.push_back(reusable->event);
+      free_blocks.erase(reusable);
+      return ptr;
+    }
+  }
+  CUDA_TRY(cudaMallocHost(&ptr, block_bytes));
+  return ptr;
+}
+
+void pinned_host_pool::deallocate(void* ptr, size_t bytes, rmm::cuda_stream_view stream)
+{
+  if (ptr == nullptr) { return; }
+
+  if (bytes > max_block_bytes) {
+    auto const free_result = cudaFreeHost(ptr);
+    assert(free_result == cudaSuccess);
+    return;
+  }
+
+  cudaEvent_t event = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(_lock);
+    if (not _event_cache.empty()) {
+      event = _event_cache.back();
+      _event_cache.pop_back();
+    }
+  }
+  if (event == nullptr) { CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming)); }
+  CUDA_TRY(cudaEventRecord(event, stream.value()));
+
+  std::lock_guard<std::mutex> lock(_lock);
+  _free_blocks[block_bytes_for(bytes)].push_back({ptr, event});
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Process-wide pool of pinned host memory for I/O staging buffers.
+ *
+ * `cudaMallocHost` serializes the device and takes on the order of a millisecond, so allocating
+ * staging buffers per read can dominate cold reads of many-column files. The pool recycles
+ * size-bucketed pinned blocks instead. Release is stream-ordered: a returned block only becomes
+ * reusable once the releasing stream has passed the release point, so copies still in flight can
+ * safely use it.
+ *
+ * The pool holds its peak working set; pinned memory is returned to the OS only at process exit.
+ */
+class pinned_host_pool {
+ public:
+  static pinned_host_pool* instance();
+
+  /**
+   * @brief Allocates pinned host memory of at least `bytes` bytes.
+   *
+   * @throws cudf::cuda_error on allocation failure
+   */
+  void* allocate(size_t bytes);
+
+  /**
+   * @brief Returns memory to the pool.
+   *
+   * The block is not reused until `stream` reaches the point of the release, so it is safe to
+   * release a buffer with copies still in flight on `stream`.
+   */
+  void deallocate(void* ptr, size_t bytes, rmm::cuda_stream_view stream);
+
+  pinned_host_pool(pinned_host_pool const&) = delete;
+  pinned_host_pool& operator=(pinned_host_pool const&) = delete;
+
+ private:
+  pinned_host_pool() = default;
+  // Pooled blocks are deliberately not freed at destruction; CUDA calls are not safe during
+  // static teardown and the process is exiting anyway
+  ~pinned_host_pool() = default;
+
+  struct pooled_block {
+    void* ptr;
+    cudaEvent_t event;  ///< Recorded at release; the block is reusable once the event completes
+  };
+
+  std::mutex _lock;
+  std::unordered_map<size_t, std::vector<pooled_block>> _free_blocks;
+  std::vector<cudaEvent_t> _event_cache;
+};
+
+/**
+ * @brief RAII wrapper for a pinned staging buffer drawn from the pinned memory pool.
+ *
+ * The buffer is released in the order of `stream`, so it can be destroyed with H2D/D2H copies
+ * still in flight on that stream.
+ */
+class pinned_buffer {
+ public:
+  pinned_buffer(size_t size, rmm::cuda_stream_view stream)
+    : _data{static_cast<uint8_t*>(pinned_host_pool::instance()->allocate(size))},
+      _size{size},
+      _stream{stream}
+  {
+  }
+
+  ~pinned_buffer() { pinned_host_pool::instance()->deallocate(_data, _size, _stream); }
+
+  pinned_buffer(pinned_buffer const&) = delete;
+  pinned_buffer& operator=(pinned_buffer const&) = delete;
+
+  uint8_t* data() const { return _data; }
+  size_t size() const { return _size; }
+
+ private:
+  uint8_t* _data;
+  size_t _size;
+  rmm::cuda_stream_view _stream;
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
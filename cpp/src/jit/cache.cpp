@@ -16,11 +16,18 @@
 
 #include <cudf/utilities/error.hpp>
 
+#include <io/utilities/thread_pool.hpp>
+
 #include <cuda.h>
 #include <jitify2.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <future>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 namespace jit {
@@ -72,6 +79,13 @@ std::filesystem::path get_cache_dir()
   if (not kernel_cache_path.empty()) {
     kernel_cache_path /= std::string{CUDF_STRINGIFY(CUDF_VERSION)};
 
+    // Make the cache directory specific to the CUDA runtime version. Compiled output depends on
+    // the NVRTC version, so this allows a cache directory to be shared between processes (or
+    // hosts) running the same software stack without clashes after a toolkit upgrade.
+    int runtime_version;
+    CUDA_TRY(cudaRuntimeGetVersion(&runtime_version));
+    kernel_cache_path /= std::to_string(runtime_version);
+
     // Make per device cache based on compute capability. This is to avoid multiple devices of
     // different compute capability to access the same kernel cache.
     int device;
@@ -150,5 +164,44 @@ jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData prep
   return *(existing_cache->second);
 }
 
+namespace {
+
+/**
+ * @brief The thread pool used for asynchronous kernel precompilation.
+ *
+ * Constructed lazily so processes that never precompile do not pay for the threads.
+ */
+cudf::detail::thread_pool& get_precompile_pool()
+{
+  static cudf::detail::thread_pool pool{[] {
+    std::size_t num_threads = 4;
+    try_parse_numeric_env_var(num_threads, "LIBCUDF_PRECOMPILE_THREADS");
+    return static_cast<std::uint32_t>(num_threads);
+  }()};
+  return pool;
+}
+
+}  // namespace
+
+std::vector<std::future<bool>> precompile_kernels(jitify2::PreprocessedProgramData preprog,
+                                                  std::vector<std::string> kernel_names,
+                                                  jitify2::StringMap header_sources)
+{
+  std::vector<std::future<bool>> futures;
+  futures.reserve(kernel_names.size());
+  for (auto& kernel_name : kernel_names) {
+    futures.push_back(get_precompile_pool().submit(
+      [preprog, header_sources, kernel_name = std::move(kernel_name)] {
+        try {
+          get_program_cache(preprog).get_kernel(kernel_name, {}, header_sources, {"-arch=sm_."});
+        } catch (...) {
+          // Warm-up is best effort: any compilation error will resurface with full context on the
+          // first real use of the kernel.
+        }
+      }));
+  }
+  return futures;
+}
+
 }  // namespace jit
 }  // namespace cudf
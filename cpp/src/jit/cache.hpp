@@ -17,12 +17,38 @@
 #pragma once
 
 #include <jitify2.hpp>
+
+#include <future>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace cudf {
 namespace jit {
 
 jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData preprog);
 
+/**
+ * @brief Asynchronously compiles kernel instantiations ahead of their first use.
+ *
+ * Submits one compilation task per kernel name to a background thread pool and
+ * returns immediately. Compiled kernels are stored in the same in-memory and
+ * on-disk caches used by `get_program_cache`, so a later `get_kernel` call for
+ * the same instantiation is a cache hit instead of a compilation stall on the
+ * calling thread. Compilation failures are swallowed here and resurface on the
+ * first real use of the kernel.
+ *
+ * The size of the thread pool can be set with the environment variable
+ * `LIBCUDF_PRECOMPILE_THREADS` (default 4).
+ *
+ * @param preprog Preprocessed program data the kernels belong to.
+ * @param kernel_names Fully instantiated kernel names to compile.
+ * @param header_sources Runtime header overrides, as passed to `get_kernel`.
+ * @return One future per kernel name, ready when its compilation has finished.
+ */
+std::vector<std::future<bool>> precompile_kernels(jitify2::PreprocessedProgramData preprog,
+                                                  std::vector<std::string> kernel_names,
+                                                  jitify2::StringMap header_sources = {});
+
 }  // namespace jit
 }  // namespace cudf
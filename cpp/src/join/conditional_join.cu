@@ -16,12 +16,16 @@
 
 #include <cudf/ast/detail/expression_parser.hpp>
 #include <cudf/ast/expressions.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/detail/search.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <join/conditional_join.hpp>
 #include <join/conditional_join_kernels.cuh>
 #include <join/join_common_utils.cuh>
@@ -29,11 +33,128 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
 #include <optional>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 namespace detail {
 
+namespace {
+
+/**
+ * @brief Per-left-row bounds of the right-table rows that can satisfy the join predicate.
+ *
+ * Either column may be null, in which case the corresponding bound is trivial (the first or
+ * one past the last right row).
+ */
+struct predicate_band {
+  std::unique_ptr<column> begin;
+  std::unique_ptr<column> end;
+};
+
+/**
+ * @brief Collects the top-level conjuncts (operands of nested LOGICAL_ANDs) of an expression.
+ */
+void collect_conjuncts(ast::expression const& expr, std::vector<ast::operation const*>& conjuncts)
+{
+  auto const* op = dynamic_cast<ast::operation const*>(&expr);
+  if (op == nullptr) { return; }
+  if (op->get_operator() == ast::ast_operator::LOGICAL_AND) {
+    for (auto const& operand : op->get_operands()) {
+      collect_conjuncts(operand.get(), conjuncts);
+    }
+  } else {
+    conjuncts.push_back(op);
+  }
+}
+
+/**
+ * @brief Returns the equivalent comparison with the operands swapped, e.g. a < b becomes b > a.
+ */
+ast::ast_operator flip_comparison(ast::ast_operator op)
+{
+  switch (op) {
+    case ast::ast_operator::LESS: return ast::ast_operator::GREATER;
+    case ast::ast_operator::GREATER: return ast::ast_operator::LESS;
+    case ast::ast_operator::LESS_EQUAL: return ast::ast_operator::GREATER_EQUAL;
+    case ast::ast_operator::GREATER_EQUAL: return ast::ast_operator::LESS_EQUAL;
+    default: return op;
+  }
+}
+
+/**
+ * @brief Computes per-left-row bounds on the right rows that can satisfy the join predicate.
+ *
+ * When the predicate contains a top-level conjunct that is an ordered comparison between a left
+ * and a right column, and the right column is sorted ascending and has no nulls, the rows
+ * satisfying that comparison form a contiguous band in the right table that can be found by
+ * binary search. Rows outside the band fail the conjunct (and therefore the whole predicate),
+ * so the nested-loop kernels can skip them without changing the join result.
+ *
+ * @return The band bounds, or `std::nullopt` if no suitable conjunct was found
+ */
+std::optional<predicate_band> compute_predicate_band(table_view const& left,
+                                                     table_view const& right,
+                                                     ast::expression const& predicate,
+                                                     rmm::cuda_stream_view stream)
+{
+  std::vector<ast::operation const*> conjuncts;
+  collect_conjuncts(predicate, conjuncts);
+
+  for (auto const* conjunct : conjuncts) {
+    auto op = conjunct->get_operator();
+    if (op != ast::ast_operator::LESS and op != ast::ast_operator::GREATER and
+        op != ast::ast_operator::LESS_EQUAL and op != ast::ast_operator::GREATER_EQUAL and
+        op != ast::ast_operator::EQUAL) {
+      continue;
+    }
+    auto const operands = conjunct->get_operands();
+    if (operands.size() != 2) { continue; }
+    auto const* left_ref  = dynamic_cast<ast::column_reference const*>(&operands[0].get());
+    auto const* right_ref = dynamic_cast<ast::column_reference const*>(&operands[1].get());
+    if (left_ref == nullptr or right_ref == nullptr) { continue; }
+
+    // Normalize to a comparison of the form "left column <op> right column"
+    if (left_ref->get_table_source() == ast::table_reference::RIGHT and
+        right_ref->get_table_source() == ast::table_reference::LEFT) {
+      op = flip_comparison(op);
+      std::swap(left_ref, right_ref);
+    } else if (not(left_ref->get_table_source() == ast::table_reference::LEFT and
+                   right_ref->get_table_source() == ast::table_reference::RIGHT)) {
+      continue;
+    }
+
+    auto const left_col  = left.column(left_ref->get_column_index());
+    auto const right_col = right.column(right_ref->get_column_index());
+    // Only prune on comparisons whose band is well defined: same-type, non-nested operands and
+    // a null-free right column
+    if (left_col.type() != right_col.type()) { continue; }
+    if (is_nested(right_col.type())) { continue; }
+    if (right_col.has_nulls()) { continue; }
+    // The band is only valid if the right column is actually sorted ascending
+    if (not cudf::is_sorted(table_view{{right_col}}, {order::ASCENDING}, {})) { continue; }
+
+    auto const haystack = table_view{{right_col}};
+    auto const needles  = table_view{{left_col}};
+    auto lower = [&]() { return detail::lower_bound(haystack, needles, {}, {}, stream); };
+    auto upper = [&]() { return detail::upper_bound(haystack, needles, {}, {}, stream); };
+
+    switch (op) {
+      case ast::ast_operator::LESS: return predicate_band{upper(), nullptr};
+      case ast::ast_operator::LESS_EQUAL: return predicate_band{lower(), nullptr};
+      case ast::ast_operator::GREATER: return predicate_band{nullptr, lower()};
+      case ast::ast_operator::GREATER_EQUAL: return predicate_band{nullptr, upper()};
+      case ast::ast_operator::EQUAL: return predicate_band{lower(), upper()};
+      default: break;
+    }
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 conditional_join(table_view const& left,
@@ -92,29 +213,80 @@ conditional_join(table_view const& left,
   auto left_table  = table_device_view::create(left, stream);
   auto right_table = table_device_view::create(right, stream);
 
+  // Restrict the nested loop to the band of right rows that can satisfy an ordered comparison
+  // against a sorted right column, when the predicate contains one
+  auto const band = compute_predicate_band(left, right, binary_predicate, stream);
+  auto const band_begin =
+    band.has_value() and band->begin ? band->begin->view().data<size_type>() : nullptr;
+  auto const band_end =
+    band.has_value() and band->end ? band->end->view().data<size_type>() : nullptr;
+
   // Allocate storage for the counter used to get the size of the join output
   detail::grid_1d config(left_table->num_rows(), DEFAULT_JOIN_BLOCK_SIZE);
   auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
   join_kind kernel_join_type = join_type == join_kind::FULL_JOIN ? join_kind::LEFT_JOIN : join_type;
 
-  // If the join size was not provided as an input, compute it here.
+  // If the join size was not provided as an input, estimate it here from a
+  // strided sample of the left rows rather than counting every match up front.
+  // The join kernel below tracks the true output size as it writes, so an
+  // undersized estimate is detected afterwards and the kernel is rerun once
+  // with the exact size, while an oversized one is trimmed away. Small inputs
+  // are counted exactly since sampling them is both noisy and unnecessary.
+  constexpr cudf::size_type sample_stride   = 32;
+  constexpr cudf::size_type min_sample_rows = 1 << 15;
+
   std::size_t join_size;
+  bool join_size_is_estimate = false;
   if (output_size.has_value()) {
     join_size = *output_size;
   } else {
+    auto const size_stride =
+      left.num_rows() >= min_sample_rows ? sample_stride : cudf::size_type{1};
+    detail::grid_1d size_config((left.num_rows() + size_stride - 1) / size_stride,
+                                DEFAULT_JOIN_BLOCK_SIZE);
     rmm::device_scalar<std::size_t> size(0, stream, mr);
     CHECK_CUDA(stream.value());
     if (has_nulls) {
       compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, true>
-        <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-          *left_table, *right_table, kernel_join_type, parser.device_expression_data, size.data());
+        <<<size_config.num_blocks,
+           size_config.num_threads_per_block,
+           shmem_size_per_block,
+           stream.value()>>>(*left_table,
+                             *right_table,
+                             kernel_join_type,
+                             band_begin,
+                             band_end,
+                             size_stride,
+                             parser.device_expression_data,
+                             size.data());
     } else {
       compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, false>
-        <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-          *left_table, *right_table, kernel_join_type, parser.device_expression_data, size.data());
+        <<<size_config.num_blocks,
+           size_config.num_threads_per_block,
+           shmem_size_per_block,
+           stream.value()>>>(*left_table,
+                             *right_table,
+                             kernel_join_type,
+                             band_begin,
+                             band_end,
+                             size_stride,
+                             parser.device_expression_data,
+                             size.data());
     }
     CHECK_CUDA(stream.value());
     join_size = size.value(stream);
+    if (size_stride > 1) {
+      // Scale the sampled count up with some headroom for under-represented
+      // regions, and clamp to the bounds implied by the join kind.
+      join_size = (join_size * size_stride * 5) / 4;
+      if (kernel_join_type == join_kind::LEFT_JOIN) {
+        join_size = std::max(join_size, static_cast<std::size_t>(left.num_rows()));
+      }
+      if (join_type == join_kind::LEFT_SEMI_JOIN || join_type == join_kind::LEFT_ANTI_JOIN) {
+        join_size = std::min(join_size, static_cast<std::size_t>(left.num_rows()));
+      }
+      join_size_is_estimate = true;
+    }
   }
 
   // The initial early exit clauses guarantee that we will not reach this point
@@ -122,8 +294,10 @@ conditional_join(table_view const& left,
   // constraint, neither left nor full joins can return an empty result since
   // at minimum we are guaranteed null matches for all non-matching rows. In
   // all other cases (inner, left semi, and left anti joins) if we reach this
-  // point we can safely return an empty result.
-  if (join_size == 0) {
+  // point we can safely return an empty result. An estimated size of zero is
+  // inconclusive, so in that case we fall through and let the join kernel
+  // report the true size.
+  if (join_size == 0 && !join_size_is_estimate) {
     return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
                           std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
   }
@@ -133,34 +307,58 @@ conditional_join(table_view const& left,
   auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
   auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
 
-  auto const& join_output_l = left_indices->data();
-  auto const& join_output_r = right_indices->data();
-  if (has_nulls) {
-    conditional_join<DEFAULT_JOIN_BLOCK_SIZE, DEFAULT_JOIN_CACHE_SIZE, true>
-      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-        *left_table,
-        *right_table,
-        kernel_join_type,
-        join_output_l,
-        join_output_r,
-        write_index.data(),
-        parser.device_expression_data,
-        join_size);
-  } else {
-    conditional_join<DEFAULT_JOIN_BLOCK_SIZE, DEFAULT_JOIN_CACHE_SIZE, false>
-      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-        *left_table,
-        *right_table,
-        kernel_join_type,
-        join_output_l,
-        join_output_r,
-        write_index.data(),
-        parser.device_expression_data,
-        join_size);
-  }
+  auto launch_join_kernel = [&]() {
+    if (has_nulls) {
+      conditional_join<DEFAULT_JOIN_BLOCK_SIZE, DEFAULT_JOIN_CACHE_SIZE, true>
+        <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+          *left_table,
+          *right_table,
+          kernel_join_type,
+          band_begin,
+          band_end,
+          left_indices->data(),
+          right_indices->data(),
+          write_index.data(),
+          parser.device_expression_data,
+          join_size);
+    } else {
+      conditional_join<DEFAULT_JOIN_BLOCK_SIZE, DEFAULT_JOIN_CACHE_SIZE, false>
+        <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+          *left_table,
+          *right_table,
+          kernel_join_type,
+          band_begin,
+          band_end,
+          left_indices->data(),
+          right_indices->data(),
+          write_index.data(),
+          parser.device_expression_data,
+          join_size);
+    }
+  };
+  launch_join_kernel();
 
   CHECK_CUDA(stream.value());
 
+  if (join_size_is_estimate) {
+    // The join kernel clamps its writes to the allocated size but keeps
+    // counting, so write_index holds the exact output size regardless of
+    // whether the estimate was large enough.
+    auto const actual_size = static_cast<std::size_t>(write_index.value(stream));
+    if (actual_size > join_size) {
+      // The estimate was too small; rerun the join with the exact size.
+      join_size     = actual_size;
+      left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+      right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+      write_index.set_value_to_zero_async(stream);
+      launch_join_kernel();
+      CHECK_CUDA(stream.value());
+    } else if (actual_size < join_size) {
+      left_indices->resize(actual_size, stream);
+      right_indices->resize(actual_size, stream);
+    }
+  }
+
   auto join_indices = std::make_pair(std::move(left_indices), std::move(right_indices));
 
   // For full joins, get the indices in the right table that were not joined to
@@ -224,6 +422,14 @@ std::size_t compute_conditional_join_output_size(table_view const& left,
   auto left_table  = table_device_view::create(left, stream);
   auto right_table = table_device_view::create(right, stream);
 
+  // Restrict the nested loop to the band of right rows that can satisfy an ordered comparison
+  // against a sorted right column, when the predicate contains one
+  auto const band = compute_predicate_band(left, right, binary_predicate, stream);
+  auto const band_begin =
+    band.has_value() and band->begin ? band->begin->view().data<size_type>() : nullptr;
+  auto const band_end =
+    band.has_value() and band->end ? band->end->view().data<size_type>() : nullptr;
+
   // Allocate storage for the counter used to get the size of the join output
   rmm::device_scalar<std::size_t> size(0, stream, mr);
   CHECK_CUDA(stream.value());
@@ -236,11 +442,25 @@ std::size_t compute_conditional_join_output_size(table_view const& left,
   if (has_nulls) {
     compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, true>
       <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-        *left_table, *right_table, join_type, parser.device_expression_data, size.data());
+        *left_table,
+        *right_table,
+        join_type,
+        band_begin,
+        band_end,
+        cudf::size_type{1},
+        parser.device_expression_data,
+        size.data());
   } else {
     compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, false>
       <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-        *left_table, *right_table, join_type, parser.device_expression_data, size.data());
+        *left_table,
+        *right_table,
+        join_type,
+        band_begin,
+        band_end,
+        cudf::size_type{1},
+        parser.device_expression_data,
+        size.data());
   }
   CHECK_CUDA(stream.value());
 
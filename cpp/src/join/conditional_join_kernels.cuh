@@ -33,7 +33,8 @@ namespace detail {
  * @brief Computes the output size of joining the left table to the right table.
  *
  * This method uses a nested loop to iterate over the left and right tables and count the number of
- * matches according to a boolean expression.
+ * matches according to a boolean expression. A stride greater than one restricts the count to a
+ * strided sample of the left rows, which callers may scale up to estimate the full output size.
  *
  * @tparam block_size The number of threads per block for this kernel
  * @tparam has_nulls Whether or not the inputs may contain nulls.
@@ -41,6 +42,12 @@ namespace detail {
  * @param[in] left_table The left table
  * @param[in] right_table The right table
  * @param[in] join_type The type of join to be performed
+ * @param[in] band_begin Per-left-row first right row that can satisfy the predicate, or nullptr
+ * if the search starts at row 0
+ * @param[in] band_end Per-left-row one past the last right row that can satisfy the predicate,
+ * or nullptr if the search ends at the last right row
+ * @param[in] sample_stride Count matches for every sample_stride-th left row only; pass 1 to
+ * count every left row
  * @param[in] device_expression_data Container of device data required to evaluate the desired
  * expression.
  * @param[out] output_size The resulting output size
@@ -50,6 +57,9 @@ __global__ void compute_conditional_join_output_size(
   table_device_view left_table,
   table_device_view right_table,
   join_kind join_type,
+  cudf::size_type const* band_begin,
+  cudf::size_type const* band_end,
+  cudf::size_type const sample_stride,
   ast::detail::expression_device_view device_expression_data,
   std::size_t* output_size)
 {
@@ -72,10 +82,18 @@ __global__ void compute_conditional_join_output_size(
   auto evaluator = cudf::ast::detail::expression_evaluator<has_nulls>(
     left_table, right_table, device_expression_data);
 
-  for (cudf::size_type left_row_index = left_start_idx; left_row_index < left_num_rows;
-       left_row_index += left_stride) {
-    bool found_match = false;
-    for (cudf::size_type right_row_index = 0; right_row_index < right_num_rows; right_row_index++) {
+  cudf::size_type const num_sampled_rows = (left_num_rows + sample_stride - 1) / sample_stride;
+
+  for (cudf::size_type sample_index = left_start_idx; sample_index < num_sampled_rows;
+       sample_index += left_stride) {
+    cudf::size_type const left_row_index = sample_index * sample_stride;
+    bool found_match                     = false;
+    // Rows outside the band cannot satisfy the predicate, so skip evaluating them
+    cudf::size_type const row_band_begin = band_begin == nullptr ? 0 : band_begin[left_row_index];
+    cudf::size_type const row_band_end =
+      band_end == nullptr ? right_num_rows : band_end[left_row_index];
+    for (cudf::size_type right_row_index = row_band_begin; right_row_index < row_band_end;
+         right_row_index++) {
       auto output_dest = cudf::ast::detail::value_expression_result<bool, has_nulls>();
       evaluator.evaluate(
         output_dest, left_row_index, right_row_index, 0, thread_intermediate_storage);
@@ -115,6 +133,10 @@ __global__ void compute_conditional_join_output_size(
  * @param[in] left_table The left table
  * @param[in] right_table The right table
  * @param[in] join_type The type of join to be performed
+ * @param[in] band_begin Per-left-row first right row that can satisfy the predicate, or nullptr
+ * if the search starts at row 0
+ * @param[in] band_end Per-left-row one past the last right row that can satisfy the predicate,
+ * or nullptr if the search ends at the last right row
  * @param[out] join_output_l The left result of the join operation
  * @param[out] join_output_r The right result of the join operation
  * @param[in,out] current_idx A global counter used by threads to coordinate
@@ -127,6 +149,8 @@ template <cudf::size_type block_size, cudf::size_type output_cache_size, bool ha
 __global__ void conditional_join(table_device_view left_table,
                                  table_device_view right_table,
                                  join_kind join_type,
+                                 cudf::size_type const* band_begin,
+                                 cudf::size_type const* band_end,
                                  cudf::size_type* join_output_l,
                                  cudf::size_type* join_output_r,
                                  cudf::size_type* current_idx,
@@ -166,29 +190,40 @@ __global__ void conditional_join(table_device_view left_table,
 
   if (left_row_index < left_num_rows) {
     bool found_match = false;
-    for (size_type right_row_index(0); right_row_index < right_num_rows; ++right_row_index) {
-      auto output_dest = cudf::ast::detail::value_expression_result<bool, has_nulls>();
-      evaluator.evaluate(
-        output_dest, left_row_index, right_row_index, 0, thread_intermediate_storage);
+    // Rows outside the band cannot satisfy the predicate, so skip evaluating
+    // them. Threads of a warp may have bands of different lengths, so the loop
+    // runs while any thread is within its band to keep the cache flushes below
+    // warp-synchronous.
+    cudf::size_type const row_band_begin = band_begin == nullptr ? 0 : band_begin[left_row_index];
+    cudf::size_type const row_band_end =
+      band_end == nullptr ? right_num_rows : band_end[left_row_index];
+    for (size_type right_row_index(row_band_begin);
+         __any_sync(activemask, right_row_index < row_band_end);
+         ++right_row_index) {
+      if (right_row_index < row_band_end) {
+        auto output_dest = cudf::ast::detail::value_expression_result<bool, has_nulls>();
+        evaluator.evaluate(
+          output_dest, left_row_index, right_row_index, 0, thread_intermediate_storage);
 
-      if (output_dest.is_valid() && output_dest.value()) {
-        // If the rows are equal, then we have found a true match
-        // In the case of left anti joins we only add indices from left after
-        // the loop if we have found _no_ matches from the right.
-        // In the case of left semi joins we only add the first match (note
-        // that the current logic relies on the fact that we process all right
-        // table rows for a single left table row on a single thread so that no
-        // synchronization of found_match is required).
-        if ((join_type != join_kind::LEFT_ANTI_JOIN) &&
-            !(join_type == join_kind::LEFT_SEMI_JOIN && found_match)) {
-          add_pair_to_cache(left_row_index,
-                            right_row_index,
-                            current_idx_shared,
-                            warp_id,
-                            join_shared_l[warp_id],
-                            join_shared_r[warp_id]);
+        if (output_dest.is_valid() && output_dest.value()) {
+          // If the rows are equal, then we have found a true match
+          // In the case of left anti joins we only add indices from left after
+          // the loop if we have found _no_ matches from the right.
+          // In the case of left semi joins we only add the first match (note
+          // that the current logic relies on the fact that we process all right
+          // table rows for a single left table row on a single thread so that no
+          // synchronization of found_match is required).
+          if ((join_type != join_kind::LEFT_ANTI_JOIN) &&
+              !(join_type == join_kind::LEFT_SEMI_JOIN && found_match)) {
+            add_pair_to_cache(left_row_index,
+                              right_row_index,
+                              current_idx_shared,
+                              warp_id,
+                              join_shared_l[warp_id],
+                              join_shared_r[warp_id]);
+          }
+          found_match = true;
         }
-        found_match = true;
       }
 
       __syncwarp(activemask);
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <hash/concurrent_unordered_map.cuh>
+#include <join/join_common_utils.cuh>
+#include <join/join_common_utils.hpp>
+#include <structs/utilities.hpp>
+
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Performs an inner or left join assuming the right table keys are unique.
+ *
+ * Because every key occurs at most once in the right table, a plain unordered map with the
+ * build row index as the mapped value suffices: each probe is a single lookup with no
+ * duplicate chain to walk, and the output is at most one row per probe row so no
+ * output-size counting pass is needed. If the right table does contain duplicate keys only
+ * one of them is ever returned.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+distinct_join(join_kind const kind,
+              table_view const& left_keys,
+              table_view const& right_keys,
+              null_equality compare_nulls,
+              rmm::cuda_stream_view stream,
+              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(0 != left_keys.num_columns(), "Left table is empty");
+  CUDF_EXPECTS(0 != right_keys.num_columns(), "Right table is empty");
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+
+  auto const left_num_rows  = left_keys.num_rows();
+  auto const right_num_rows = right_keys.num_rows();
+
+  if (0 == left_num_rows) {
+    return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                          std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+  if (0 == right_num_rows) {
+    if (join_kind::LEFT_JOIN == kind) {
+      return get_trivial_left_join_indices(left_keys, stream, mr);
+    }
+    return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                          std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  // flatten structs for the right and left and use that for the hash table
+  auto right_flattened_tables = structs::detail::flatten_nested_columns(
+    right_keys, {}, {}, structs::detail::column_nullability::FORCE);
+  auto left_flattened_tables = structs::detail::flatten_nested_columns(
+    left_keys, {}, {}, structs::detail::column_nullability::FORCE);
+
+  auto right_flattened_keys = std::get<0>(right_flattened_tables);
+  auto left_flattened_keys  = std::get<0>(left_flattened_tables);
+
+  // Each key is unique, so a single mapped row index per key suffices (other
+  // joins need a multimap)
+  using hash_table_type =
+    concurrent_unordered_map<cudf::size_type, cudf::size_type, row_hash, row_equality>;
+
+  // Create hash table mapping each key found in the right table to its row index
+  auto right_rows_d            = table_device_view::create(right_flattened_keys, stream);
+  size_t const hash_table_size = compute_hash_table_size(right_num_rows);
+  row_hash hash_build{*right_rows_d};
+  row_equality equality_build{*right_rows_d, *right_rows_d, compare_nulls == null_equality::EQUAL};
+
+  // Going to join it with left table
+  auto left_rows_d = table_device_view::create(left_flattened_keys, stream);
+  row_hash hash_probe{*left_rows_d};
+  row_equality equality_probe{*left_rows_d, *right_rows_d, compare_nulls == null_equality::EQUAL};
+
+  auto hash_table_ptr = hash_table_type::create(hash_table_size,
+                                                stream,
+                                                std::numeric_limits<cudf::size_type>::max(),
+                                                std::numeric_limits<cudf::size_type>::max(),
+                                                hash_build,
+                                                equality_build);
+  auto hash_table     = *hash_table_ptr;
+
+  // if compare_nulls == UNEQUAL, we can simply ignore any rows that
+  // contain a NULL in any column as they will never compare to equal.
+  auto const row_bitmask = (compare_nulls == null_equality::EQUAL)
+                             ? rmm::device_buffer{}
+                             : cudf::detail::bitmask_and(right_flattened_keys, stream).first;
+  // skip rows that are null here.
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    right_num_rows,
+    [hash_table, row_bitmask = static_cast<bitmask_type const*>(row_bitmask.data())] __device__(
+      size_type idx) mutable {
+      if (!row_bitmask || cudf::bit_is_set(row_bitmask, idx)) {
+        hash_table.insert(thrust::make_pair(idx, idx));
+      }
+    });
+
+  // Probe the hash table with the left rows. Each left row yields at most one
+  // output row, so the output buffers are sized to the probe size up front.
+  auto left_indices =
+    std::make_unique<rmm::device_uvector<cudf::size_type>>(left_num_rows, stream, mr);
+  auto right_indices =
+    std::make_unique<rmm::device_uvector<cudf::size_type>>(left_num_rows, stream, mr);
+
+  thrust::sequence(rmm::exec_policy(stream), left_indices->begin(), left_indices->end());
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(left_num_rows),
+                    right_indices->begin(),
+                    [hash_table, hash_probe, equality_probe] __device__(size_type idx) {
+                      auto pos = hash_table.find(idx, hash_probe, equality_probe);
+                      return (pos != hash_table.end()) ? pos->second : JoinNoneValue;
+                    });
+
+  // For left joins the output size equals the probe size; inner joins drop the
+  // unmatched rows.
+  if (join_kind::INNER_JOIN == kind) {
+    auto paired_begin =
+      thrust::make_zip_iterator(thrust::make_tuple(left_indices->begin(), right_indices->begin()));
+    auto paired_end = thrust::remove_if(
+      rmm::exec_policy(stream),
+      paired_begin,
+      paired_begin + left_num_rows,
+      [] __device__(thrust::tuple<size_type, size_type> const& pair) {
+        return thrust::get<1>(pair) == JoinNoneValue;
+      });
+    auto const join_size = thrust::distance(paired_begin, paired_end);
+    left_indices->resize(join_size, stream);
+    right_indices->resize(join_size, stream);
+  }
+
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+distinct_inner_join(cudf::table_view const& left_keys,
+                    cudf::table_view const& right_keys,
+                    null_equality compare_nulls,
+                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::distinct_join(detail::join_kind::INNER_JOIN,
+                               left_keys,
+                               right_keys,
+                               compare_nulls,
+                               rmm::cuda_stream_default,
+                               mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+distinct_left_join(cudf::table_view const& left_keys,
+                   cudf::table_view const& right_keys,
+                   null_equality compare_nulls,
+                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::distinct_join(detail::join_kind::LEFT_JOIN,
+                               left_keys,
+                               right_keys,
+                               compare_nulls,
+                               rmm::cuda_stream_default,
+                               mr);
+}
+
+}  // namespace cudf
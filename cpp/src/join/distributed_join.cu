@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/join.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace distributed {
+
+namespace {
+
+/**
+ * @brief RAII helper that makes a device current and restores the previous
+ * device on destruction.
+ */
+class device_scope {
+ public:
+  explicit device_scope(int device)
+  {
+    CUDA_TRY(cudaGetDevice(&previous_));
+    CUDA_TRY(cudaSetDevice(device));
+  }
+  ~device_scope() { cudaSetDevice(previous_); }
+
+  device_scope(device_scope const&) = delete;
+  device_scope& operator=(device_scope const&) = delete;
+
+ private:
+  int previous_;
+};
+
+/**
+ * @brief Enables peer access between every pair of participating devices.
+ *
+ * Devices without a peer link (e.g. across PCIe root complexes) are left
+ * as-is; `cudaMemcpyAsync` with `cudaMemcpyDefault` then stages the
+ * exchange through host memory instead of going over NVLink.
+ */
+void enable_peer_access(int num_devices)
+{
+  for (int device = 0; device < num_devices; ++device) {
+    device_scope scope(device);
+    for (int peer = 0; peer < num_devices; ++peer) {
+      if (peer == device) { continue; }
+      int can_access_peer = 0;
+      CUDA_TRY(cudaDeviceCanAccessPeer(&can_access_peer, device, peer));
+      if (!can_access_peer) { continue; }
+      auto const status = cudaDeviceEnablePeerAccess(peer, 0);
+      if (status == cudaErrorPeerAccessAlreadyEnabled) {
+        cudaGetLastError();  // clear the sticky error
+        continue;
+      }
+      CUDA_TRY(status);
+    }
+  }
+}
+
+/**
+ * @brief Hash-partitions a table into one slice per device.
+ *
+ * All devices partition with the same hash function, seed, and partition
+ * count, so rows with equal keys always map to the same destination device.
+ */
+std::pair<std::unique_ptr<table>, std::vector<table_view>> partition_for_devices(
+  table_view const& input, std::vector<size_type> const& columns_to_hash, int num_devices)
+{
+  auto [partitioned, offsets] = cudf::hash_partition(input, columns_to_hash, num_devices);
+
+  std::vector<table_view> slices;
+  slices.reserve(num_devices);
+  auto const num_rows = partitioned->num_rows();
+  for (int p = 0; p < num_devices; ++p) {
+    auto const begin = offsets[p];
+    auto const end   = p + 1 < num_devices ? offsets[p + 1] : num_rows;
+    slices.push_back(cudf::slice(partitioned->view(), {begin, end}).front());
+  }
+  return std::make_pair(std::move(partitioned), std::move(slices));
+}
+
+}  // namespace
+
+std::vector<std::unique_ptr<table>> inner_join(std::vector<table_view> const& left,
+                                               std::vector<table_view> const& right,
+                                               std::vector<size_type> const& left_on,
+                                               std::vector<size_type> const& right_on,
+                                               null_equality compare_nulls)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(left.size() == right.size(),
+               "The left and right sides must provide the same number of per-device tables");
+  CUDF_EXPECTS(not left.empty(), "At least one per-device table pair is required");
+
+  auto const num_devices = static_cast<int>(left.size());
+  int device_count       = 0;
+  CUDA_TRY(cudaGetDeviceCount(&device_count));
+  CUDF_EXPECTS(num_devices <= device_count,
+               "More per-device tables were provided than there are visible devices");
+
+  if (num_devices == 1) {
+    device_scope scope(0);
+    std::vector<std::unique_ptr<table>> result;
+    result.push_back(cudf::inner_join(left[0], right[0], left_on, right_on, compare_nulls));
+    return result;
+  }
+
+  enable_peer_access(num_devices);
+
+  // Phase 1: each device hash-partitions its local tables into one slice per
+  // destination device and packs the remote slices into contiguous buffers so
+  // the exchange is a single copy per (source, destination) pair.
+  std::vector<std::unique_ptr<table>> left_parts(num_devices);
+  std::vector<std::unique_ptr<table>> right_parts(num_devices);
+  std::vector<std::vector<table_view>> left_slices(num_devices);
+  std::vector<std::vector<table_view>> right_slices(num_devices);
+  std::vector<std::vector<packed_columns>> left_packed(num_devices);
+  std::vector<std::vector<packed_columns>> right_packed(num_devices);
+  for (int src = 0; src < num_devices; ++src) {
+    device_scope scope(src);
+    std::tie(left_parts[src], left_slices[src]) =
+      partition_for_devices(left[src], left_on, num_devices);
+    std::tie(right_parts[src], right_slices[src]) =
+      partition_for_devices(right[src], right_on, num_devices);
+
+    left_packed[src].resize(num_devices);
+    right_packed[src].resize(num_devices);
+    for (int dst = 0; dst < num_devices; ++dst) {
+      if (dst == src) { continue; }
+      if (left_slices[src][dst].num_rows() > 0) {
+        left_packed[src][dst] = cudf::pack(left_slices[src][dst]);
+      }
+      if (right_slices[src][dst].num_rows() > 0) {
+        right_packed[src][dst] = cudf::pack(right_slices[src][dst]);
+      }
+    }
+    CUDA_TRY(cudaDeviceSynchronize());
+  }
+
+  // Phase 2: all-to-all exchange of the packed buffers. The copies are issued
+  // on each destination device's stream with `cudaMemcpyDefault`, which goes
+  // peer-to-peer over NVLink where peer access was enabled above.
+  std::vector<std::vector<rmm::device_buffer>> left_received(num_devices);
+  std::vector<std::vector<rmm::device_buffer>> right_received(num_devices);
+  for (int dst = 0; dst < num_devices; ++dst) {
+    device_scope scope(dst);
+    left_received[dst].resize(num_devices);
+    right_received[dst].resize(num_devices);
+    for (int src = 0; src < num_devices; ++src) {
+      if (src == dst) { continue; }
+      auto receive = [](packed_columns const& packed, rmm::device_buffer& buffer) {
+        if (packed.gpu_data == nullptr or packed.gpu_data->size() == 0) { return; }
+        buffer = rmm::device_buffer(packed.gpu_data->size(), rmm::cuda_stream_default);
+        CUDA_TRY(cudaMemcpyAsync(buffer.data(),
+                                 packed.gpu_data->data(),
+                                 packed.gpu_data->size(),
+                                 cudaMemcpyDefault,
+                                 rmm::cuda_stream_default.value()));
+      };
+      receive(left_packed[src][dst], left_received[dst][src]);
+      receive(right_packed[src][dst], right_received[dst][src]);
+    }
+  }
+
+  // Phase 3: each device concatenates its local slice with the received
+  // partitions and joins them locally. The subsequent work is ordered after
+  // the copies on each device's stream, so no extra synchronization is needed.
+  std::vector<std::unique_ptr<table>> result(num_devices);
+  for (int dst = 0; dst < num_devices; ++dst) {
+    device_scope scope(dst);
+    auto gather_views = [&](std::vector<std::vector<table_view>> const& slices,
+                            std::vector<std::vector<packed_columns>> const& packed,
+                            std::vector<rmm::device_buffer> const& received) {
+      std::vector<table_view> views{slices[dst][dst]};
+      for (int src = 0; src < num_devices; ++src) {
+        if (src == dst or received[src].size() == 0) { continue; }
+        views.push_back(cudf::unpack(packed[src][dst].metadata_->data(),
+                                     static_cast<uint8_t const*>(received[src].data())));
+      }
+      return views;
+    };
+    auto const left_shuffled =
+      cudf::concatenate(gather_views(left_slices, left_packed, left_received[dst]));
+    auto const right_shuffled =
+      cudf::concatenate(gather_views(right_slices, right_packed, right_received[dst]));
+    result[dst] = cudf::inner_join(
+      left_shuffled->view(), right_shuffled->view(), left_on, right_on, compare_nulls);
+    CUDA_TRY(cudaDeviceSynchronize());
+  }
+
+  return result;
+}
+
+}  // namespace distributed
+}  // namespace cudf
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <join/join_common_utils.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/join.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream.hpp>
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+#include <thrust/system/cuda/experimental/pinned_allocator.h>
+#include <thrust/transform.h>
+
+#include <numeric>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+namespace {
+
+using pinned_vector =
+  thrust::host_vector<uint8_t, thrust::system::cuda::experimental::pinned_allocator<uint8_t>>;
+
+/**
+ * @brief A hash partition of one join input, packed and spilled to pinned host memory.
+ */
+struct spilled_partition {
+  std::unique_ptr<packed_columns::metadata> metadata;
+  pinned_vector data;
+  size_type num_rows;
+};
+
+/**
+ * @brief Hash-partitions the key table and spills each partition to pinned host memory.
+ *
+ * An extra column holding the original row index is appended before partitioning so that
+ * per-partition join results can be mapped back to the input table. Only one packed device
+ * copy of a partition is alive at a time, so the device footprint beyond the input itself
+ * is the partitioned copy plus a single partition.
+ */
+std::vector<spilled_partition> partition_and_spill(table_view const& keys,
+                                                   int num_partitions,
+                                                   rmm::cuda_stream_view stream)
+{
+  auto row_index = make_numeric_column(
+    data_type{type_to_id<size_type>()}, keys.num_rows(), mask_state::UNALLOCATED, stream);
+  thrust::sequence(rmm::exec_policy(stream),
+                   row_index->mutable_view().begin<size_type>(),
+                   row_index->mutable_view().end<size_type>());
+
+  std::vector<column_view> augmented_cols(keys.begin(), keys.end());
+  augmented_cols.push_back(row_index->view());
+
+  // Hash on the key columns only; both inputs use the same hash function, seed, and
+  // partition count, so matching keys always land in the same partition pair.
+  std::vector<size_type> columns_to_hash(keys.num_columns());
+  std::iota(columns_to_hash.begin(), columns_to_hash.end(), 0);
+
+  auto [partitioned, offsets] = cudf::hash_partition(table_view{augmented_cols},
+                                                     columns_to_hash,
+                                                     num_partitions,
+                                                     hash_id::HASH_MURMUR3,
+                                                     DEFAULT_HASH_SEED,
+                                                     stream);
+
+  std::vector<spilled_partition> spilled;
+  spilled.reserve(num_partitions);
+  auto const num_rows = partitioned->num_rows();
+  for (int p = 0; p < num_partitions; ++p) {
+    auto const begin = offsets[p];
+    auto const end   = p + 1 < num_partitions ? offsets[p + 1] : num_rows;
+    auto const part  = cudf::slice(partitioned->view(), {begin, end}).front();
+
+    auto packed = detail::pack(part, stream, rmm::mr::get_current_device_resource());
+    pinned_vector host_data(packed.gpu_data->size());
+    if (not host_data.empty()) {
+      CUDA_TRY(cudaMemcpyAsync(host_data.data(),
+                               packed.gpu_data->data(),
+                               host_data.size(),
+                               cudaMemcpyDeviceToHost,
+                               stream.value()));
+    }
+    // The packed device copy must outlive the copy above, and is dropped before packing
+    // the next partition to keep the device footprint at one partition.
+    stream.synchronize();
+    spilled.push_back({std::move(packed.metadata_), std::move(host_data), part.num_rows()});
+  }
+  return spilled;
+}
+
+}  // namespace
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+grace_hash_inner_join(table_view const& left_keys,
+                      table_view const& right_keys,
+                      int num_partitions,
+                      null_equality compare_nulls,
+                      rmm::cuda_stream_view stream,
+                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(num_partitions > 0, "Number of partitions must be positive");
+  CUDF_EXPECTS(0 != left_keys.num_columns(), "Left table is empty");
+  CUDF_EXPECTS(0 != right_keys.num_columns(), "Right table is empty");
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+
+  if (0 == left_keys.num_rows() or 0 == right_keys.num_rows()) {
+    return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                          std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  auto left_spilled  = partition_and_spill(left_keys, num_partitions, stream);
+  auto right_spilled = partition_and_spill(right_keys, num_partitions, stream);
+
+  auto restore = [](spilled_partition const& sp, rmm::cuda_stream_view s) {
+    rmm::device_buffer buf(sp.data.size(), s);
+    if (not sp.data.empty()) {
+      CUDA_TRY(cudaMemcpyAsync(
+        buf.data(), sp.data.data(), sp.data.size(), cudaMemcpyHostToDevice, s.value()));
+    }
+    return buf;
+  };
+
+  std::vector<std::unique_ptr<rmm::device_uvector<size_type>>> left_pieces;
+  std::vector<std::unique_ptr<rmm::device_uvector<size_type>>> right_pieces;
+  std::size_t total_size = 0;
+
+  auto const num_key_columns = left_keys.num_columns();
+  std::vector<size_type> key_column_indices(num_key_columns);
+  std::iota(key_column_indices.begin(), key_column_indices.end(), 0);
+
+  // Double buffer the partition transfers: the next partition pair is copied back to the
+  // device on a dedicated stream while the current pair is joined.
+  rmm::cuda_stream prefetch_stream;
+  auto next_left  = restore(left_spilled.front(), prefetch_stream);
+  auto next_right = restore(right_spilled.front(), prefetch_stream);
+
+  for (int p = 0; p < num_partitions; ++p) {
+    prefetch_stream.synchronize();
+    auto left_buf  = std::move(next_left);
+    auto right_buf = std::move(next_right);
+    left_buf.set_stream(stream);
+    right_buf.set_stream(stream);
+
+    if (p + 1 < num_partitions) {
+      next_left  = restore(left_spilled[p + 1], prefetch_stream);
+      next_right = restore(right_spilled[p + 1], prefetch_stream);
+    }
+
+    if (0 == left_spilled[p].num_rows or 0 == right_spilled[p].num_rows) { continue; }
+
+    auto const left_part = cudf::unpack(left_spilled[p].metadata->data(),
+                                        static_cast<uint8_t const*>(left_buf.data()));
+    auto const right_part = cudf::unpack(right_spilled[p].metadata->data(),
+                                         static_cast<uint8_t const*>(right_buf.data()));
+
+    cudf::hash_join hj(right_part.select(key_column_indices), compare_nulls, stream);
+    auto local_indices =
+      hj.inner_join(left_part.select(key_column_indices), compare_nulls, std::nullopt, stream, mr);
+
+    // The last column of each partition holds the original row indices; translate the
+    // partition-local join result back to input-table row indices.
+    auto const left_row_indices  = left_part.column(num_key_columns).data<size_type>();
+    auto const right_row_indices = right_part.column(num_key_columns).data<size_type>();
+    thrust::transform(rmm::exec_policy(stream),
+                      local_indices.first->begin(),
+                      local_indices.first->end(),
+                      local_indices.first->begin(),
+                      [left_row_indices] __device__(size_type i) { return left_row_indices[i]; });
+    thrust::transform(rmm::exec_policy(stream),
+                      local_indices.second->begin(),
+                      local_indices.second->end(),
+                      local_indices.second->begin(),
+                      [right_row_indices] __device__(size_type i) { return right_row_indices[i]; });
+
+    // The partition buffers released at the end of this iteration were moved onto the main
+    // stream above, so their deallocation is ordered after the translation kernels.
+    total_size += local_indices.first->size();
+    left_pieces.push_back(std::move(local_indices.first));
+    right_pieces.push_back(std::move(local_indices.second));
+  }
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(total_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(total_size, stream, mr);
+  std::size_t offset = 0;
+  for (std::size_t i = 0; i < left_pieces.size(); ++i) {
+    thrust::copy(rmm::exec_policy(stream),
+                 left_pieces[i]->begin(),
+                 left_pieces[i]->end(),
+                 left_indices->begin() + offset);
+    thrust::copy(rmm::exec_policy(stream),
+                 right_pieces[i]->begin(),
+                 right_pieces[i]->end(),
+                 right_indices->begin() + offset);
+    offset += left_pieces[i]->size();
+  }
+
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+grace_hash_inner_join(table_view const& left_keys,
+                      table_view const& right_keys,
+                      int num_partitions,
+                      null_equality compare_nulls,
+                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::grace_hash_inner_join(
+    left_keys, right_keys, num_partitions, compare_nulls, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -77,7 +77,7 @@ std::unique_ptr<multimap_type, std::function<void(multimap_type*)>> build_join_h
   detail::grid_1d config(build_table_num_rows, block_size);
   auto const row_bitmask = (compare_nulls == null_equality::EQUAL)
                              ? rmm::device_buffer{0, stream}
-                             : cudf::detail::bitmask_and(build, stream);
+                             : cudf::detail::bitmask_and(build, stream).first;
   build_hash_table<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
     *hash_table,
     hash_build,
@@ -303,6 +303,49 @@ hash_join::hash_join_impl::hash_join_impl(cudf::table_view const& build,
   _hash_table = build_join_hash_table(_build, compare_nulls, stream);
 }
 
+hash_join::hash_join_impl::hash_join_impl(cudf::table_view const& build,
+                                          device_span<uint8_t const> serialized_hash_table,
+                                          rmm::cuda_stream_view stream)
+  : _hash_table(nullptr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(0 != build.num_columns(), "Hash join build table is empty");
+  CUDF_EXPECTS(build.num_rows() < cudf::detail::MAX_JOIN_SIZE,
+               "Build column size is too big for hash join");
+
+  auto flattened_build = structs::detail::flatten_nested_columns(
+    build, {}, {}, structs::detail::column_nullability::FORCE);
+  _build = std::get<0>(flattened_build);
+  // need to store off the owning structures for some of the views in _build
+  _created_null_columns = std::move(std::get<3>(flattened_build));
+
+  if (serialized_hash_table.empty()) {
+    CUDF_EXPECTS(0 == build.num_rows(),
+                 "Serialized hash table is empty but the build table has rows");
+    return;
+  }
+
+  _hash_table = cudf::detail::multimap_type::import_storage(
+    serialized_hash_table.data(), serialized_hash_table.size(), stream);
+}
+
+rmm::device_buffer hash_join::hash_join_impl::serialize_hash_table(
+  rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+
+  // An empty build table has no hash table; represented by an empty buffer
+  if (_hash_table == nullptr) { return rmm::device_buffer{}; }
+
+  rmm::device_buffer serialized{_hash_table->storage_size(), stream, mr};
+  CUDA_TRY(cudaMemcpyAsync(serialized.data(),
+                           _hash_table->storage_data(),
+                           _hash_table->storage_size(),
+                           cudaMemcpyDefault,
+                           stream.value()));
+  return serialized;
+}
+
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::hash_join_impl::inner_join(cudf::table_view const& probe,
@@ -351,7 +394,7 @@ std::size_t hash_join::hash_join_impl::inner_join_size(cudf::table_view const& p
   // Return directly if build table is empty
   if (_hash_table == nullptr) { return 0; }
 
-  auto flattened_probe = structs::detail::flatten_nested_columns(
+  auto flattened_probe = _probe_flatten_cache.flatten(
     probe, {}, {}, structs::detail::column_nullability::FORCE);
   auto const flattened_probe_table = std::get<0>(flattened_probe);
 
@@ -371,7 +414,7 @@ std::size_t hash_join::hash_join_impl::left_join_size(cudf::table_view const& pr
   // Trivial left join case - exit early
   if (_hash_table == nullptr) { return probe.num_rows(); }
 
-  auto flattened_probe = structs::detail::flatten_nested_columns(
+  auto flattened_probe = _probe_flatten_cache.flatten(
     probe, {}, {}, structs::detail::column_nullability::FORCE);
   auto const flattened_probe_table = std::get<0>(flattened_probe);
 
@@ -392,7 +435,7 @@ std::size_t hash_join::hash_join_impl::full_join_size(cudf::table_view const& pr
   // Trivial left join case - exit early
   if (_hash_table == nullptr) { return probe.num_rows(); }
 
-  auto flattened_probe = structs::detail::flatten_nested_columns(
+  auto flattened_probe = _probe_flatten_cache.flatten(
     probe, {}, {}, structs::detail::column_nullability::FORCE);
   auto const flattened_probe_table = std::get<0>(flattened_probe);
 
@@ -416,7 +459,7 @@ hash_join::hash_join_impl::compute_hash_join(cudf::table_view const& probe,
   CUDF_EXPECTS(probe.num_rows() < cudf::detail::MAX_JOIN_SIZE,
                "Probe column size is too big for hash join");
 
-  auto flattened_probe = structs::detail::flatten_nested_columns(
+  auto flattened_probe = _probe_flatten_cache.flatten(
     probe, {}, {}, structs::detail::column_nullability::FORCE);
   auto const flattened_probe_table = std::get<0>(flattened_probe);
 
@@ -21,6 +21,7 @@
 #include <join/join_common_utils.cuh>
 #include <join/join_common_utils.hpp>
 #include <join/join_kernels.cuh>
+#include <structs/utilities.hpp>
 
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/join.hpp>
@@ -140,6 +141,10 @@ struct hash_join::hash_join_impl {
  private:
   cudf::table_view _build;
   std::vector<std::unique_ptr<cudf::column>> _created_null_columns;
+  // caches the flattened probe table across the size and join calls;
+  // mutable since probing is logically const (not thread-safe, like the rest
+  // of this object)
+  mutable cudf::structs::detail::flattened_table_cache _probe_flatten_cache;
   std::unique_ptr<cudf::detail::multimap_type, std::function<void(cudf::detail::multimap_type*)>>
     _hash_table;
 
@@ -157,6 +162,24 @@ struct hash_join::hash_join_impl {
                  null_equality compare_nulls,
                  rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
+  /**
+   * @brief Constructor that adopts a previously serialized hash table instead of building one.
+   *
+   * @throw cudf::logic_error if the number of columns in `build` table is 0.
+   * @throw cudf::logic_error if `serialized_hash_table` is empty while `build` has rows, or is
+   * not a valid serialized hash table.
+   *
+   * @param build The build table the serialized hash table was built from.
+   * @param serialized_hash_table The serialized hash table, as returned by
+   * `serialize_hash_table()`.
+   */
+  hash_join_impl(cudf::table_view const& build,
+                 device_span<uint8_t const> serialized_hash_table,
+                 rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  rmm::device_buffer serialize_hash_table(rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr) const;
+
   std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
             std::unique_ptr<rmm::device_uvector<size_type>>>
   inner_join(cudf::table_view const& probe,
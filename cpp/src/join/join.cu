@@ -230,6 +230,19 @@ hash_join::hash_join(cudf::table_view const& build,
 {
 }
 
+hash_join::hash_join(cudf::table_view const& build,
+                     device_span<uint8_t const> serialized_hash_table,
+                     rmm::cuda_stream_view stream)
+  : impl{std::make_unique<const hash_join::hash_join_impl>(build, serialized_hash_table, stream)}
+{
+}
+
+rmm::device_buffer hash_join::serialize_hash_table(rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr) const
+{
+  return impl->serialize_hash_table(stream, mr);
+}
+
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::inner_join(cudf::table_view const& probe,
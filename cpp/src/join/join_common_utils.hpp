@@ -19,7 +19,7 @@
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_view.hpp>
 
-#include <hash/concurrent_unordered_multimap.cuh>
+#include <hash/flat_multimap.cuh>
 
 #include <limits>
 
@@ -31,15 +31,14 @@ constexpr int DEFAULT_JOIN_BLOCK_SIZE = 128;
 constexpr int DEFAULT_JOIN_CACHE_SIZE = 128;
 constexpr size_type JoinNoneValue     = std::numeric_limits<size_type>::min();
 
-using multimap_type =
-  concurrent_unordered_multimap<hash_value_type,
-                                size_type,
-                                size_t,
-                                std::numeric_limits<hash_value_type>::max(),
-                                std::numeric_limits<size_type>::max(),
-                                default_hash<hash_value_type>,
-                                equal_to<hash_value_type>,
-                                default_allocator<thrust::pair<hash_value_type, size_type>>>;
+using multimap_type = flat_multimap<hash_value_type,
+                                    size_type,
+                                    size_t,
+                                    std::numeric_limits<hash_value_type>::max(),
+                                    std::numeric_limits<size_type>::max(),
+                                    default_hash<hash_value_type>,
+                                    equal_to<hash_value_type>,
+                                    default_allocator<char>>;
 
 using row_hash = cudf::row_hasher<default_hash>;
 
@@ -69,11 +69,10 @@ __global__ void build_hash_table(multimap_type multi_map,
       // Insert the (row hash value, row index) into the map
       // using the row hash value to determine the location in the
       // hash map where the new pair should be inserted
-      auto const insert_location =
-        multi_map.insert(thrust::make_pair(row_hash_value, i), true, row_hash_value);
+      bool const inserted = multi_map.insert(row_hash_value, i, row_hash_value);
 
       // If the insert failed, set the error code accordingly
-      if (multi_map.end() == insert_location) { *error = 1; }
+      if (not inserted) { *error = 1; }
     }
     i += blockDim.x * gridDim.x;
   }
@@ -114,7 +113,6 @@ __global__ void compute_join_output_size(multimap_type multi_map,
   const cudf::size_type start_idx = threadIdx.x + blockIdx.x * blockDim.x;
   const cudf::size_type stride    = blockDim.x * gridDim.x;
   const auto unused_key           = multi_map.get_unused_key();
-  const auto end                  = multi_map.end();
 
   for (cudf::size_type probe_row_index = start_idx; probe_row_index < probe_table_num_rows;
        probe_row_index += stride) {
@@ -122,48 +120,34 @@ __global__ void compute_join_output_size(multimap_type multi_map,
     // hash value to determine the location where to search for the row in the hash map
     auto const probe_row_hash_value = remap_sentinel_hash(hash_probe(probe_row_index), unused_key);
 
-    auto found = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
+    auto probe = multi_map.probe(probe_row_hash_value);
 
-    // for left-joins we always need to add an output
-    bool running     = (JoinKind == join_kind::LEFT_JOIN) || (end != found);
+    bool running     = true;
     bool found_match = false;
 
     while (running) {
-      // TODO Simplify this logic...
+      auto const current_key = probe.key();
 
-      // Left joins always have an entry in the output
-      if (JoinKind == join_kind::LEFT_JOIN && (end == found)) {
-        running = false;
-      }
       // Stop searching after encountering an empty hash table entry
-      else if (unused_key == found->first) {
+      if (unused_key == current_key || probe.exhausted()) {
         running = false;
       }
       // First check that the hash values of the two rows match
-      else if (found->first == probe_row_hash_value) {
-        // If the hash values are equal, check that the rows are equal
-        if (check_row_equality(probe_row_index, found->second)) {
-          // If the rows are equal, then we have found a true match
-          found_match = true;
-          ++thread_counter;
+      else {
+        if (current_key == probe_row_hash_value) {
+          // If the hash values are equal, check that the rows are equal
+          if (check_row_equality(probe_row_index, probe.value())) {
+            // If the rows are equal, then we have found a true match
+            found_match = true;
+            ++thread_counter;
+          }
         }
         // Continue searching for matching rows until you hit an empty hash map entry
-        ++found;
-        // If you hit the end of the hash map, wrap around to the beginning
-        if (end == found) found = multi_map.begin();
-        // Next entry is empty, stop searching
-        if (unused_key == found->first) running = false;
-      } else {
-        // Continue searching for matching rows until you hit an empty hash table entry
-        ++found;
-        // If you hit the end of the hash map, wrap around to the beginning
-        if (end == found) found = multi_map.begin();
-        // Next entry is empty, stop searching
-        if (unused_key == found->first) running = false;
+        probe.advance();
       }
-
-      if ((JoinKind == join_kind::LEFT_JOIN) && (!running) && (!found_match)) { ++thread_counter; }
     }
+
+    if ((JoinKind == join_kind::LEFT_JOIN) && (!found_match)) { ++thread_counter; }
   }
 
   using BlockReduce = cub::BlockReduce<std::size_t, block_size>;
@@ -227,56 +211,41 @@ __global__ void probe_hash_table(multimap_type multi_map,
   const unsigned int activemask = __ballot_sync(0xffffffff, probe_row_index < probe_table_num_rows);
   if (probe_row_index < probe_table_num_rows) {
     const auto unused_key = multi_map.get_unused_key();
-    const auto end        = multi_map.end();
 
     // Search the hash map for the hash value of the probe row using the row's
     // hash value to determine the location where to search for the row in the hash map
     auto const probe_row_hash_value = remap_sentinel_hash(hash_probe(probe_row_index), unused_key);
 
-    auto found = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
+    auto probe = multi_map.probe(probe_row_hash_value);
 
-    bool running = (JoinKind == join_kind::LEFT_JOIN) ||
-                   (end != found);  // for left-joins we always need to add an output
+    bool running     = true;
     bool found_match = false;
     while (__any_sync(activemask, running)) {
       if (running) {
-        // TODO Simplify this logic...
+        auto const current_key = probe.key();
 
-        // Left joins always have an entry in the output
-        if ((JoinKind == join_kind::LEFT_JOIN) && (end == found)) {
-          running = false;
-        }
         // Stop searching after encountering an empty hash table entry
-        else if (unused_key == found->first) {
+        if (unused_key == current_key || probe.exhausted()) {
           running = false;
         }
         // First check that the hash values of the two rows match
-        else if (found->first == probe_row_hash_value) {
-          // If the hash values are equal, check that the rows are equal
-          // TODO : REMOVE : if(row_equal{probe_table, build_table}(probe_row_index, found->second))
-          if (check_row_equality(probe_row_index, found->second)) {
-            // If the rows are equal, then we have found a true match
-            found_match = true;
-            add_pair_to_cache(probe_row_index,
-                              found->second,
-                              current_idx_shared,
-                              warp_id,
-                              join_shared_l[warp_id],
-                              join_shared_r[warp_id]);
+        else {
+          if (current_key == probe_row_hash_value) {
+            // If the hash values are equal, check that the rows are equal
+            auto const build_row_index = probe.value();
+            if (check_row_equality(probe_row_index, build_row_index)) {
+              // If the rows are equal, then we have found a true match
+              found_match = true;
+              add_pair_to_cache(probe_row_index,
+                                build_row_index,
+                                current_idx_shared,
+                                warp_id,
+                                join_shared_l[warp_id],
+                                join_shared_r[warp_id]);
+            }
           }
           // Continue searching for matching rows until you hit an empty hash map entry
-          ++found;
-          // If you hit the end of the hash map, wrap around to the beginning
-          if (end == found) found = multi_map.begin();
-          // Next entry is empty, stop searching
-          if (unused_key == found->first) running = false;
-        } else {
-          // Continue searching for matching rows until you hit an empty hash table entry
-          ++found;
-          // If you hit the end of the hash map, wrap around to the beginning
-          if (end == found) found = multi_map.begin();
-          // Next entry is empty, stop searching
-          if (unused_key == found->first) running = false;
+          probe.advance();
         }
 
         // If performing a LEFT join and no match was found, insert a Null into the output
@@ -16,6 +16,8 @@
 
 #include <join/join_common_utils.cuh>
 
+#include <cudf/utilities/temp_memory_resource.hpp>
+
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/copy.h>
@@ -109,9 +111,10 @@ get_left_join_indices_complement(std::unique_ptr<rmm::device_uvector<size_type>>
                      right_indices_complement->end(),
                      0);
   } else {
-    // Assume all the indices in invalid_index_map are invalid
-    auto invalid_index_map =
-      std::make_unique<rmm::device_uvector<size_type>>(right_table_row_count, stream);
+    // Assume all the indices in invalid_index_map are invalid. The map is
+    // operator-scoped scratch, so allocate it from the temporary resource.
+    auto invalid_index_map = std::make_unique<rmm::device_uvector<size_type>>(
+      right_table_row_count, stream, get_temp_memory_resource());
     thrust::uninitialized_fill(
       rmm::exec_policy(stream), invalid_index_map->begin(), invalid_index_map->end(), int32_t{1});
 
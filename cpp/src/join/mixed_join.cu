@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <join/join_common_utils.cuh>
+#include <join/join_common_utils.hpp>
+#include <join/join_kernels.cuh>
+#include <join/mixed_join_kernels.cuh>
+#include <structs/utilities.hpp>
+
+#include <cudf/ast/detail/expression_parser.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/join.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
+
+#include <utility>
+
+namespace cudf {
+namespace detail {
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_join(table_view const& left_equality,
+           table_view const& right_equality,
+           table_view const& left_conditional,
+           table_view const& right_conditional,
+           ast::expression const& binary_predicate,
+           join_kind join_type,
+           null_equality compare_nulls,
+           rmm::cuda_stream_view stream,
+           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(join_type == join_kind::INNER_JOIN or join_type == join_kind::LEFT_JOIN,
+               "Mixed joins only support inner and left joins.");
+  CUDF_EXPECTS(0 != left_equality.num_columns(), "Left equality table is empty");
+  CUDF_EXPECTS(0 != right_equality.num_columns(), "Right equality table is empty");
+  CUDF_EXPECTS(left_equality.num_columns() == right_equality.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(left_equality.num_rows() == left_conditional.num_rows(),
+               "The left equality and conditional tables must have the same number of rows");
+  CUDF_EXPECTS(right_equality.num_rows() == right_conditional.num_rows(),
+               "The right equality and conditional tables must have the same number of rows");
+
+  auto const left_num_rows  = left_equality.num_rows();
+  auto const right_num_rows = right_equality.num_rows();
+
+  // Handle empty inputs the same way as the other join paths: left joins
+  // return all left rows with null matches, everything else is empty.
+  if (right_num_rows == 0) {
+    if (join_type == join_kind::LEFT_JOIN) {
+      return get_trivial_left_join_indices(left_conditional, stream);
+    }
+    return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                          std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  } else if (left_num_rows == 0) {
+    return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                          std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  // If evaluating the expression may produce null outputs we create a nullable
+  // output column and follow the null-supporting expression evaluation code
+  // path.
+  auto const has_nulls =
+    binary_predicate.may_evaluate_null(left_conditional, right_conditional, stream);
+
+  auto const parser = ast::detail::expression_parser{
+    binary_predicate, left_conditional, right_conditional, has_nulls, stream, mr};
+  CUDF_EXPECTS(parser.output_type().id() == type_id::BOOL8,
+               "The expression must produce a boolean output.");
+
+  // flatten structs for the equality tables and use those for the hash table
+  auto right_flattened_tables = structs::detail::flatten_nested_columns(
+    right_equality, {}, {}, structs::detail::column_nullability::FORCE);
+  auto left_flattened_tables = structs::detail::flatten_nested_columns(
+    left_equality, {}, {}, structs::detail::column_nullability::FORCE);
+
+  auto right_flattened_keys = std::get<0>(right_flattened_tables);
+  auto left_flattened_keys  = std::get<0>(left_flattened_tables);
+
+  // Build the hash table from the right equality keys, exactly as the pure
+  // equality hash join does.
+  auto build_device_table = table_device_view::create(right_flattened_keys, stream);
+  auto probe_device_table = table_device_view::create(left_flattened_keys, stream);
+
+  std::size_t const hash_table_size = compute_hash_table_size(right_num_rows);
+  auto hash_table                   = multimap_type::create(hash_table_size,
+                                          stream,
+                                          true,
+                                          multimap_type::hasher(),
+                                          multimap_type::key_equal(),
+                                          multimap_type::allocator_type());
+
+  row_hash hash_build{*build_device_table};
+  rmm::device_scalar<int> failure(0, stream);
+  constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+  detail::grid_1d build_config(right_num_rows, block_size);
+  auto const row_bitmask = (compare_nulls == null_equality::EQUAL)
+                             ? rmm::device_buffer{0, stream}
+                             : cudf::detail::bitmask_and(right_flattened_keys, stream).first;
+  build_hash_table<<<build_config.num_blocks,
+                     build_config.num_threads_per_block,
+                     0,
+                     stream.value()>>>(*hash_table,
+                                       hash_build,
+                                       right_num_rows,
+                                       static_cast<bitmask_type const*>(row_bitmask.data()),
+                                       failure.data());
+  if (failure.value(stream) == 1) { CUDF_FAIL("Hash Table insert failure."); }
+
+  auto left_conditional_table  = table_device_view::create(left_conditional, stream);
+  auto right_conditional_table = table_device_view::create(right_conditional, stream);
+
+  row_hash hash_probe{*probe_device_table};
+  row_equality equality_probe{
+    *probe_device_table, *build_device_table, compare_nulls == null_equality::EQUAL};
+
+  detail::grid_1d config(left_num_rows, block_size);
+  auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
+
+  // Compute the exact output size; the conditional expression is only
+  // evaluated on hash matches, so this pass is proportional to the number of
+  // equality matches rather than the full cross product.
+  std::size_t join_size;
+  {
+    rmm::device_scalar<std::size_t> size(0, stream, mr);
+    if (has_nulls) {
+      compute_mixed_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, true>
+        <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+          *hash_table,
+          *left_conditional_table,
+          *right_conditional_table,
+          join_type,
+          hash_probe,
+          equality_probe,
+          parser.device_expression_data,
+          size.data());
+    } else {
+      compute_mixed_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, false>
+        <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+          *hash_table,
+          *left_conditional_table,
+          *right_conditional_table,
+          join_type,
+          hash_probe,
+          equality_probe,
+          parser.device_expression_data,
+          size.data());
+    }
+    CHECK_CUDA(stream.value());
+    join_size = size.value(stream);
+  }
+
+  if (join_size == 0) {
+    return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                          std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  rmm::device_scalar<size_type> write_index(0, stream);
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+
+  if (has_nulls) {
+    mixed_join<DEFAULT_JOIN_BLOCK_SIZE, DEFAULT_JOIN_CACHE_SIZE, true>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+        *hash_table,
+        *left_conditional_table,
+        *right_conditional_table,
+        join_type,
+        hash_probe,
+        equality_probe,
+        left_indices->data(),
+        right_indices->data(),
+        write_index.data(),
+        parser.device_expression_data,
+        join_size);
+  } else {
+    mixed_join<DEFAULT_JOIN_BLOCK_SIZE, DEFAULT_JOIN_CACHE_SIZE, false>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+        *hash_table,
+        *left_conditional_table,
+        *right_conditional_table,
+        join_type,
+        hash_probe,
+        equality_probe,
+        left_indices->data(),
+        right_indices->data(),
+        write_index.data(),
+        parser.device_expression_data,
+        join_size);
+  }
+
+  CHECK_CUDA(stream.value());
+
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_inner_join(table_view const& left_equality,
+                 table_view const& right_equality,
+                 table_view const& left_conditional,
+                 table_view const& right_conditional,
+                 ast::expression const& binary_predicate,
+                 null_equality compare_nulls,
+                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::mixed_join(left_equality,
+                            right_equality,
+                            left_conditional,
+                            right_conditional,
+                            binary_predicate,
+                            detail::join_kind::INNER_JOIN,
+                            compare_nulls,
+                            rmm::cuda_stream_default,
+                            mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_left_join(table_view const& left_equality,
+                table_view const& right_equality,
+                table_view const& left_conditional,
+                table_view const& right_conditional,
+                ast::expression const& binary_predicate,
+                null_equality compare_nulls,
+                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::mixed_join(left_equality,
+                            right_equality,
+                            left_conditional,
+                            right_conditional,
+                            binary_predicate,
+                            detail::join_kind::LEFT_JOIN,
+                            compare_nulls,
+                            rmm::cuda_stream_default,
+                            mr);
+}
+
+}  // namespace cudf
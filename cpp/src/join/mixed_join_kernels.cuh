@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <join/join_common_utils.cuh>
+#include <join/join_common_utils.hpp>
+#include <join/join_kernels.cuh>
+
+#include <cudf/ast/detail/expression_evaluator.cuh>
+#include <cudf/ast/detail/expression_parser.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/table/table_device_view.cuh>
+
+#include <cub/cub.cuh>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Computes the output size of a mixed equality/conditional join.
+ *
+ * Each probe row is looked up in the hash table built from the build equality
+ * keys; the conditional expression is evaluated only on rows whose equality
+ * keys match, so the candidate set is the hash matches rather than the full
+ * cross product.
+ *
+ * @tparam block_size The number of threads per block for this kernel
+ * @tparam has_nulls Whether or not the conditional tables may contain nulls
+ * @tparam multimap_type The type of the hash table
+ *
+ * @param[in] multi_map The hash table built from the build equality table
+ * @param[in] left_table The left (probe) conditional table
+ * @param[in] right_table The right (build) conditional table
+ * @param[in] join_type The type of join to be performed
+ * @param[in] hash_probe Row hasher for the probe equality table
+ * @param[in] check_row_equality Row equality comparator for the equality tables
+ * @param[in] device_expression_data Container of device data required to evaluate the desired
+ * expression.
+ * @param[out] output_size The resulting output size
+ */
+template <int block_size, bool has_nulls, typename multimap_type>
+__global__ void compute_mixed_join_output_size(
+  multimap_type multi_map,
+  table_device_view left_table,
+  table_device_view right_table,
+  join_kind join_type,
+  row_hash hash_probe,
+  row_equality check_row_equality,
+  ast::detail::expression_device_view device_expression_data,
+  std::size_t* output_size)
+{
+  extern __shared__ char raw_intermediate_storage[];
+  cudf::ast::detail::IntermediateDataType<has_nulls>* intermediate_storage =
+    reinterpret_cast<cudf::ast::detail::IntermediateDataType<has_nulls>*>(raw_intermediate_storage);
+  auto thread_intermediate_storage =
+    &intermediate_storage[threadIdx.x * device_expression_data.num_intermediates];
+
+  std::size_t thread_counter{0};
+  cudf::size_type const start_idx             = threadIdx.x + blockIdx.x * blockDim.x;
+  cudf::size_type const stride                = blockDim.x * gridDim.x;
+  cudf::size_type const probe_table_num_rows  = left_table.num_rows();
+  auto const unused_key                       = multi_map.get_unused_key();
+
+  auto evaluator = cudf::ast::detail::expression_evaluator<has_nulls>(
+    left_table, right_table, device_expression_data);
+
+  for (cudf::size_type probe_row_index = start_idx; probe_row_index < probe_table_num_rows;
+       probe_row_index += stride) {
+    auto const probe_row_hash_value = remap_sentinel_hash(hash_probe(probe_row_index), unused_key);
+
+    auto probe = multi_map.probe(probe_row_hash_value);
+
+    bool running     = true;
+    bool found_match = false;
+
+    while (running) {
+      auto const current_key = probe.key();
+
+      if (unused_key == current_key || probe.exhausted()) {
+        running = false;
+      } else {
+        if (current_key == probe_row_hash_value) {
+          auto const build_row_index = probe.value();
+          if (check_row_equality(probe_row_index, build_row_index)) {
+            // The expression is only evaluated on rows whose equality keys match
+            auto output_dest = cudf::ast::detail::value_expression_result<bool, has_nulls>();
+            evaluator.evaluate(
+              output_dest, probe_row_index, build_row_index, 0, thread_intermediate_storage);
+            if (output_dest.is_valid() && output_dest.value()) {
+              found_match = true;
+              ++thread_counter;
+            }
+          }
+        }
+        probe.advance();
+      }
+    }
+
+    if ((join_type == join_kind::LEFT_JOIN) && (!found_match)) { ++thread_counter; }
+  }
+
+  using BlockReduce = cub::BlockReduce<std::size_t, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  std::size_t block_counter = BlockReduce(temp_storage).Sum(thread_counter);
+
+  // Add block counter to global counter
+  if (threadIdx.x == 0) atomicAdd(output_size, block_counter);
+}
+
+/**
+ * @brief Performs a mixed equality/conditional join and generates the output
+ * for the desired join operation.
+ *
+ * @tparam block_size The number of threads per block for this kernel
+ * @tparam output_cache_size The size of the shared memory buffer to cache join
+ * output results
+ * @tparam has_nulls Whether or not the conditional tables may contain nulls
+ * @tparam multimap_type The type of the hash table
+ *
+ * @param[in] multi_map The hash table built from the build equality table
+ * @param[in] left_table The left (probe) conditional table
+ * @param[in] right_table The right (build) conditional table
+ * @param[in] join_type The type of join to be performed
+ * @param[in] hash_probe Row hasher for the probe equality table
+ * @param[in] check_row_equality Row equality comparator for the equality tables
+ * @param[out] join_output_l The left result of the join operation
+ * @param[out] join_output_r The right result of the join operation
+ * @param[in,out] current_idx A global counter used by threads to coordinate
+ * writes to the global output
+ * @param device_expression_data Container of device data required to evaluate the desired
+ * expression.
+ * @param[in] max_size The maximum size of the output
+ */
+template <cudf::size_type block_size,
+          cudf::size_type output_cache_size,
+          bool has_nulls,
+          typename multimap_type>
+__global__ void mixed_join(multimap_type multi_map,
+                           table_device_view left_table,
+                           table_device_view right_table,
+                           join_kind join_type,
+                           row_hash hash_probe,
+                           row_equality check_row_equality,
+                           cudf::size_type* join_output_l,
+                           cudf::size_type* join_output_r,
+                           cudf::size_type* current_idx,
+                           cudf::ast::detail::expression_device_view device_expression_data,
+                           cudf::size_type const max_size)
+{
+  constexpr int num_warps = block_size / detail::warp_size;
+  __shared__ cudf::size_type current_idx_shared[num_warps];
+  __shared__ cudf::size_type join_shared_l[num_warps][output_cache_size];
+  __shared__ cudf::size_type join_shared_r[num_warps][output_cache_size];
+
+  extern __shared__ char raw_intermediate_storage[];
+  cudf::ast::detail::IntermediateDataType<has_nulls>* intermediate_storage =
+    reinterpret_cast<cudf::ast::detail::IntermediateDataType<has_nulls>*>(raw_intermediate_storage);
+  auto thread_intermediate_storage =
+    &intermediate_storage[threadIdx.x * device_expression_data.num_intermediates];
+
+  int const warp_id                          = threadIdx.x / detail::warp_size;
+  int const lane_id                          = threadIdx.x % detail::warp_size;
+  cudf::size_type const probe_table_num_rows = left_table.num_rows();
+
+  if (0 == lane_id) { current_idx_shared[warp_id] = 0; }
+
+  __syncwarp();
+
+  cudf::size_type probe_row_index = threadIdx.x + blockIdx.x * blockDim.x;
+
+  unsigned int const activemask = __ballot_sync(0xffffffff, probe_row_index < probe_table_num_rows);
+
+  auto evaluator = cudf::ast::detail::expression_evaluator<has_nulls>(
+    left_table, right_table, device_expression_data);
+
+  if (probe_row_index < probe_table_num_rows) {
+    auto const unused_key = multi_map.get_unused_key();
+
+    auto const probe_row_hash_value = remap_sentinel_hash(hash_probe(probe_row_index), unused_key);
+
+    auto probe = multi_map.probe(probe_row_hash_value);
+
+    bool running     = true;
+    bool found_match = false;
+    while (__any_sync(activemask, running)) {
+      if (running) {
+        auto const current_key = probe.key();
+
+        if (unused_key == current_key || probe.exhausted()) {
+          running = false;
+        } else {
+          if (current_key == probe_row_hash_value) {
+            auto const build_row_index = probe.value();
+            if (check_row_equality(probe_row_index, build_row_index)) {
+              // The expression is only evaluated on rows whose equality keys match
+              auto output_dest = cudf::ast::detail::value_expression_result<bool, has_nulls>();
+              evaluator.evaluate(
+                output_dest, probe_row_index, build_row_index, 0, thread_intermediate_storage);
+              if (output_dest.is_valid() && output_dest.value()) {
+                found_match = true;
+                add_pair_to_cache(probe_row_index,
+                                  build_row_index,
+                                  current_idx_shared,
+                                  warp_id,
+                                  join_shared_l[warp_id],
+                                  join_shared_r[warp_id]);
+              }
+            }
+          }
+          probe.advance();
+        }
+
+        // If performing a LEFT join and no match was found, insert a Null into the output
+        if ((join_type == join_kind::LEFT_JOIN) && (!running) && (!found_match)) {
+          add_pair_to_cache(probe_row_index,
+                            static_cast<cudf::size_type>(JoinNoneValue),
+                            current_idx_shared,
+                            warp_id,
+                            join_shared_l[warp_id],
+                            join_shared_r[warp_id]);
+        }
+      }
+
+      __syncwarp(activemask);
+      // flush output cache if next iteration does not fit
+      if (current_idx_shared[warp_id] + detail::warp_size >= output_cache_size) {
+        flush_output_cache<num_warps, output_cache_size>(activemask,
+                                                         max_size,
+                                                         warp_id,
+                                                         lane_id,
+                                                         current_idx,
+                                                         current_idx_shared,
+                                                         join_shared_l,
+                                                         join_shared_r,
+                                                         join_output_l,
+                                                         join_output_r);
+        __syncwarp(activemask);
+        if (0 == lane_id) { current_idx_shared[warp_id] = 0; }
+        __syncwarp(activemask);
+      }
+    }
+
+    // final flush of output cache
+    if (current_idx_shared[warp_id] > 0) {
+      flush_output_cache<num_warps, output_cache_size>(activemask,
+                                                       max_size,
+                                                       warp_id,
+                                                       lane_id,
+                                                       current_idx,
+                                                       current_idx_shared,
+                                                       join_shared_l,
+                                                       join_shared_r,
+                                                       join_output_l,
+                                                       join_output_r);
+    }
+  }
+}
+
+}  // namespace detail
+
+}  // namespace cudf
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <hash/blocked_bloom_filter.cuh>
 #include <hash/concurrent_unordered_map.cuh>
 #include <join/join_common_utils.hpp>
 #include <structs/utilities.hpp>
@@ -93,20 +94,36 @@ std::unique_ptr<rmm::device_uvector<cudf::size_type>> left_semi_anti_join(
                                                 equality_build);
   auto hash_table     = *hash_table_ptr;
 
+  // When the left table dwarfs the right one the probe dominates, so a Bloom
+  // filter over the right keys is built alongside the hash table; it rejects
+  // most non-matching left rows with a single cache line read before the
+  // exact probe. A default-constructed filter passes everything through.
+  auto const use_bloom_filter = left_num_rows > 2 * right_num_rows;
+  blocked_bloom_filter<hash_value_type> bloom_filter{};
+  decltype(blocked_bloom_filter<hash_value_type>::create(0, stream)) bloom_filter_ptr{};
+  if (use_bloom_filter) {
+    bloom_filter_ptr = blocked_bloom_filter<hash_value_type>::create(right_num_rows, stream);
+    bloom_filter     = *bloom_filter_ptr;
+  }
+
   // if compare_nulls == UNEQUAL, we can simply ignore any rows that
   // contain a NULL in any column as they will never compare to equal.
   auto const row_bitmask = (compare_nulls == null_equality::EQUAL)
                              ? rmm::device_buffer{}
-                             : cudf::detail::bitmask_and(right_flattened_keys, stream);
+                             : cudf::detail::bitmask_and(right_flattened_keys, stream).first;
   // skip rows that are null here.
   thrust::for_each_n(
     rmm::exec_policy(stream),
     thrust::make_counting_iterator<size_type>(0),
     right_num_rows,
-    [hash_table, row_bitmask = static_cast<bitmask_type const*>(row_bitmask.data())] __device__(
+    [hash_table,
+     bloom_filter,
+     hash_build,
+     row_bitmask = static_cast<bitmask_type const*>(row_bitmask.data())] __device__(
       size_type idx) mutable {
       if (!row_bitmask || cudf::bit_is_set(row_bitmask, idx)) {
         hash_table.insert(thrust::make_pair(idx, true));
+        bloom_filter.insert(hash_build(idx));
       }
     });
 
@@ -127,7 +144,10 @@ std::unique_ptr<rmm::device_uvector<cudf::size_type>> left_semi_anti_join(
     thrust::make_counting_iterator<size_type>(0),
     thrust::make_counting_iterator<size_type>(left_num_rows),
     gather_map->begin(),
-    [hash_table, join_type_boolean, hash_probe, equality_probe] __device__(size_type idx) {
+    [hash_table, bloom_filter, join_type_boolean, hash_probe, equality_probe] __device__(
+      size_type idx) {
+      // A Bloom filter miss proves the row has no match, skipping the exact probe
+      if (not bloom_filter.contains(hash_probe(idx))) { return not join_type_boolean; }
       auto pos = hash_table.find(idx, hash_probe, equality_probe);
       return (pos != hash_table.end()) == join_type_boolean;
     });
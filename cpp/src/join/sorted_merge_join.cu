@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <join/join_common_utils.hpp>
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @copydoc cudf::sorted_merge_inner_join
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sorted_merge_inner_join(table_view const& left_keys,
+                        table_view const& right_keys,
+                        std::vector<order> const& column_order,
+                        std::vector<null_order> const& null_precedence,
+                        rmm::cuda_stream_view stream,
+                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(0 != left_keys.num_columns(), "Sorted merge join left keys table is empty");
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(std::equal(std::cbegin(left_keys),
+                          std::cend(left_keys),
+                          std::cbegin(right_keys),
+                          std::cend(right_keys),
+                          [](const auto& l, const auto& r) { return l.type() == r.type(); }),
+               "Mismatch in joining column data types");
+
+  auto const left_num_rows = left_keys.num_rows();
+  if (left_num_rows == 0 or right_keys.num_rows() == 0) {
+    return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                          std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  // Since both inputs are sorted, the matches of each left row form a contiguous
+  // run in the right table bounded by the row's lower and upper bound
+  auto const match_begin =
+    lower_bound(right_keys, left_keys, column_order, null_precedence, stream);
+  auto const match_end = upper_bound(right_keys, left_keys, column_order, null_precedence, stream);
+  auto const* match_begin_ptr = match_begin->view().data<size_type>();
+  auto const* match_end_ptr   = match_end->view().data<size_type>();
+
+  // Offset of each left row's matches in the join output
+  rmm::device_uvector<std::size_t> offsets(left_num_rows + 1, stream);
+  offsets.set_element_to_zero_async(0, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    match_end_ptr,
+                    match_end_ptr + left_num_rows,
+                    match_begin_ptr,
+                    offsets.begin() + 1,
+                    thrust::minus<std::size_t>());
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), offsets.begin() + 1, offsets.end(), offsets.begin() + 1);
+
+  auto const join_size = offsets.back_element(stream);
+  CUDF_EXPECTS(join_size < static_cast<std::size_t>(MAX_JOIN_SIZE),
+               "Sorted merge join output size has exceeded MAX_JOIN_SIZE");
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+
+  thrust::for_each(rmm::exec_policy(stream),
+                   thrust::make_counting_iterator<size_type>(0),
+                   thrust::make_counting_iterator<size_type>(left_num_rows),
+                   [match_begin_ptr,
+                    offsets   = offsets.data(),
+                    left_out  = left_indices->data(),
+                    right_out = right_indices->data()] __device__(size_type i) {
+                     auto out        = offsets[i];
+                     auto match      = match_begin_ptr[i];
+                     auto const last = offsets[i + 1];
+                     for (; out < last; ++out, ++match) {
+                       left_out[out]  = i;
+                       right_out[out] = match;
+                     }
+                   });
+
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sorted_merge_inner_join(table_view const& left_keys,
+                        table_view const& right_keys,
+                        std::vector<order> const& column_order,
+                        std::vector<null_order> const& null_precedence,
+                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sorted_merge_inner_join(
+    left_keys, right_keys, column_order, null_precedence, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
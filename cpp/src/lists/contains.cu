@@ -14,9 +14,12 @@
  * limitations under the License.
  */
 
+#include <thrust/binary_search.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/logical.h>
+#include <thrust/uninitialized_fill.h>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/lists/contains.hpp>
@@ -26,8 +29,11 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/row_operators.cuh>
+#include <cudf/utilities/temp_memory_resource.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
+#include <limits>
 #include <type_traits>
 
 namespace cudf {
@@ -46,11 +52,28 @@ auto get_search_keys_device_iterable_view(cudf::scalar const& search_key, rmm::c
   return &search_key;
 }
 
+/**
+ * @brief Sentinel used in the match-position scratch buffer for "no match yet".
+ */
+auto constexpr position_sentinel = std::numeric_limits<size_type>::max();
+
 /**
  * @brief Functor to search each list row for the specified search keys.
+ *
+ * The search runs one thread per list *element* rather than one thread per
+ * list: each child element is labeled with its list row (vectorized
+ * upper_bound over the offsets), compared against that row's search key, and
+ * matches race benignly through an atomicMin on the row's match position.
+ * This keeps heavily skewed list lengths from serializing whole rows onto
+ * single threads. A second, O(1)-per-row pass turns the match positions into
+ * the requested result.
  */
 template <bool search_keys_have_nulls>
 struct lookup_functor {
+  // When true, produce the INT32 index of the first match (or -1) instead of
+  // a BOOL8 "found" flag.
+  bool return_index = false;
+
   template <typename ElementType>
   struct is_supported {
     static constexpr bool value =
@@ -63,7 +86,7 @@ struct lookup_functor {
     Args&&...) const
   {
     CUDF_FAIL(
-      "lists::contains() is only supported on numeric types, decimals, chrono types, and strings.");
+      "List search is only supported on numeric types, decimals, chrono types, and strings.");
   }
 
   std::pair<rmm::device_buffer, size_type> construct_null_mask(lists_column_view const& input_lists,
@@ -82,53 +105,44 @@ struct lookup_functor {
     }
   }
 
-  template <typename ElementType, typename SearchKeyPairIter>
-  void search_each_list_row(cudf::detail::lists_column_device_view const& d_lists,
-                            SearchKeyPairIter search_key_pair_iter,
-                            cudf::mutable_column_device_view mutable_ret_bools,
-                            cudf::mutable_column_device_view mutable_ret_validity,
-                            rmm::cuda_stream_view stream,
-                            rmm::mr::device_memory_resource*)
+  template <typename ElementType, bool child_has_nulls, typename SearchKeyPairIter>
+  void search_each_list_element(cudf::column_device_view const& d_child,
+                                size_type const* d_labels,
+                                size_type const* d_offsets,
+                                size_type first_offset,
+                                size_type num_elements,
+                                SearchKeyPairIter search_key_pair_iter,
+                                size_type* d_positions,
+                                bool* d_found_null,
+                                rmm::cuda_stream_view stream)
   {
+    auto const element_pair_iter =
+      cudf::detail::make_pair_rep_iterator<ElementType, child_has_nulls>(d_child);
     thrust::for_each(
       rmm::exec_policy(stream),
-      thrust::make_counting_iterator(0),
-      thrust::make_counting_iterator(d_lists.size()),
-      [d_lists,
+      thrust::make_counting_iterator(size_type{0}),
+      thrust::make_counting_iterator(num_elements),
+      [element_pair_iter,
        search_key_pair_iter,
-       d_bools    = mutable_ret_bools.data<bool>(),
-       d_validity = mutable_ret_validity.data<bool>()] __device__(auto row_index) {
-        auto search_key_and_validity    = search_key_pair_iter[row_index];
-        auto const& search_key_is_valid = search_key_and_validity.second;
-
-        if (search_keys_have_nulls && !search_key_is_valid) {
-          d_bools[row_index]    = false;
-          d_validity[row_index] = false;
-          return;
-        }
+       d_labels,
+       d_offsets,
+       first_offset,
+       d_positions,
+       d_found_null] __device__(size_type element_index) {
+        auto const row_index = d_labels[element_index];
+        if (search_keys_have_nulls && !search_key_pair_iter[row_index].second) { return; }
 
-        auto list = cudf::list_device_view(d_lists, row_index);
-        if (list.is_null()) {
-          d_bools[row_index]    = false;
-          d_validity[row_index] = false;
+        auto const element_and_validity = element_pair_iter[element_index];
+        if (child_has_nulls && !element_and_validity.second) {
+          d_found_null[row_index] = true;
           return;
         }
 
-        auto search_key = search_key_and_validity.first;
-        d_bools[row_index] =
-          thrust::find_if(thrust::seq,
-                          list.pair_rep_begin<ElementType>(),
-                          list.pair_rep_end<ElementType>(),
-                          [search_key] __device__(auto element_and_validity) {
-                            return element_and_validity.second &&
-                                   cudf::equality_compare(element_and_validity.first, search_key);
-                          }) != list.pair_rep_end<ElementType>();
-        d_validity[row_index] =
-          d_bools[row_index] ||
-          thrust::none_of(thrust::seq,
-                          thrust::make_counting_iterator(size_type{0}),
-                          thrust::make_counting_iterator(list.size()),
-                          [&list] __device__(auto const& i) { return list.is_null(i); });
+        if (cudf::equality_compare(element_and_validity.first,
+                                   search_key_pair_iter[row_index].first)) {
+          atomicMin(&d_positions[row_index],
+                    element_index + first_offset - d_offsets[row_index]);
+        }
       });
   }
 
@@ -143,15 +157,18 @@ struct lookup_functor {
     using namespace cudf::detail;
 
     CUDF_EXPECTS(!cudf::is_nested(lists.child().type()),
-                 "Nested types not supported in lists::contains()");
+                 "Nested types not supported in list search operations");
     CUDF_EXPECTS(lists.child().type() == search_key.type(),
                  "Type/Scale of search key does not match list column element type.");
     CUDF_EXPECTS(search_key.type().id() != type_id::EMPTY, "Type cannot be empty.");
 
     auto constexpr search_key_is_scalar = std::is_same_v<SearchKeyType, cudf::scalar>;
 
+    auto const output_type =
+      return_index ? data_type{type_to_id<size_type>()} : data_type{type_id::BOOL8};
+
     if (search_keys_have_nulls && search_key_is_scalar) {
-      return make_fixed_width_column(data_type(type_id::BOOL8),
+      return make_fixed_width_column(output_type,
                                      lists.size(),
                                      cudf::create_null_mask(lists.size(), mask_state::ALL_NULL, mr),
                                      lists.size(),
@@ -159,32 +176,130 @@ struct lookup_functor {
                                      mr);
     }
 
-    auto const device_view = column_device_view::create(lists.parent(), stream);
-    auto const d_lists     = lists_column_device_view(*device_view);
-    auto const d_skeys     = get_search_keys_device_iterable_view(search_key, stream);
+    auto const device_view  = column_device_view::create(lists.parent(), stream);
+    auto const d_lists      = lists_column_device_view(*device_view);
+    auto const d_skeys      = get_search_keys_device_iterable_view(search_key, stream);
+    auto const sliced_child = lists.get_sliced_child(stream);
+    auto const d_child      = column_device_view::create(sliced_child, stream);
+    auto const num_elements = sliced_child.size();
+    auto const first_offset =
+      lists.size() == 0
+        ? size_type{0}
+        : cudf::detail::get_value<size_type>(lists.offsets(), lists.offset(), stream);
 
-    auto result_validity = make_fixed_width_column(
-      data_type{type_id::BOOL8}, lists.size(), cudf::mask_state::UNALLOCATED, stream, mr);
-    auto result_bools = make_fixed_width_column(
-      data_type{type_id::BOOL8}, lists.size(), cudf::mask_state::UNALLOCATED, stream, mr);
-    auto mutable_result_bools =
-      mutable_column_device_view::create(result_bools->mutable_view(), stream);
-    auto mutable_result_validity =
-      mutable_column_device_view::create(result_validity->mutable_view(), stream);
-    auto search_key_iter =
+    // Label each child element with the list row it belongs to.
+    auto* temp_mr = get_temp_memory_resource();
+    rmm::device_uvector<size_type> labels(num_elements, stream, temp_mr);
+    thrust::upper_bound(rmm::exec_policy(stream),
+                        lists.offsets_begin() + 1,
+                        lists.offsets_end(),
+                        thrust::make_counting_iterator<size_type>(first_offset),
+                        thrust::make_counting_iterator<size_type>(first_offset + num_elements),
+                        labels.begin());
+
+    rmm::device_uvector<size_type> match_positions(lists.size(), stream, temp_mr);
+    rmm::device_uvector<bool> found_null(lists.size(), stream, temp_mr);
+    thrust::uninitialized_fill(
+      rmm::exec_policy(stream), match_positions.begin(), match_positions.end(), position_sentinel);
+    thrust::uninitialized_fill(
+      rmm::exec_policy(stream), found_null.begin(), found_null.end(), false);
+
+    auto const search_key_iter =
       cudf::detail::make_pair_rep_iterator<ElementType, search_keys_have_nulls>(*d_skeys);
 
-    search_each_list_row<ElementType>(
-      d_lists, search_key_iter, *mutable_result_bools, *mutable_result_validity, stream, mr);
+    if (sliced_child.has_nulls()) {
+      search_each_list_element<ElementType, true>(*d_child,
+                                                  labels.data(),
+                                                  lists.offsets_begin(),
+                                                  first_offset,
+                                                  num_elements,
+                                                  search_key_iter,
+                                                  match_positions.data(),
+                                                  found_null.data(),
+                                                  stream);
+    } else {
+      search_each_list_element<ElementType, false>(*d_child,
+                                                   labels.data(),
+                                                   lists.offsets_begin(),
+                                                   first_offset,
+                                                   num_elements,
+                                                   search_key_iter,
+                                                   match_positions.data(),
+                                                   found_null.data(),
+                                                   stream);
+    }
+
+    auto result = make_fixed_width_column(
+      output_type, lists.size(), cudf::mask_state::UNALLOCATED, stream, mr);
+    auto result_validity = make_fixed_width_column(
+      data_type{type_id::BOOL8}, lists.size(), cudf::mask_state::UNALLOCATED, stream, temp_mr);
+
+    auto const row_indices = thrust::make_counting_iterator(size_type{0});
+    if (return_index) {
+      thrust::for_each(rmm::exec_policy(stream),
+                       row_indices,
+                       row_indices + lists.size(),
+                       [d_lists,
+                        search_key_iter,
+                        d_positions = match_positions.data(),
+                        d_indices   = result->mutable_view().data<size_type>(),
+                        d_validity  = result_validity->mutable_view().data<bool>()] __device__(
+                         size_type row_index) {
+                         if ((search_keys_have_nulls && !search_key_iter[row_index].second) ||
+                             cudf::list_device_view(d_lists, row_index).is_null()) {
+                           d_indices[row_index]  = 0;
+                           d_validity[row_index] = false;
+                           return;
+                         }
+                         auto const position   = d_positions[row_index];
+                         d_indices[row_index]  = position == position_sentinel ? -1 : position;
+                         d_validity[row_index] = true;
+                       });
+    } else {
+      thrust::for_each(rmm::exec_policy(stream),
+                       row_indices,
+                       row_indices + lists.size(),
+                       [d_lists,
+                        search_key_iter,
+                        d_positions   = match_positions.data(),
+                        d_found_null  = found_null.data(),
+                        d_bools       = result->mutable_view().data<bool>(),
+                        d_validity    = result_validity->mutable_view().data<bool>()] __device__(
+                         size_type row_index) {
+                         if ((search_keys_have_nulls && !search_key_iter[row_index].second) ||
+                             cudf::list_device_view(d_lists, row_index).is_null()) {
+                           d_bools[row_index]    = false;
+                           d_validity[row_index] = false;
+                           return;
+                         }
+                         auto const found      = d_positions[row_index] != position_sentinel;
+                         d_bools[row_index]    = found;
+                         d_validity[row_index] = found || !d_found_null[row_index];
+                       });
+    }
 
     rmm::device_buffer null_mask;
     size_type num_nulls;
 
-    std::tie(null_mask, num_nulls) =
-      construct_null_mask(lists, result_validity->view(), stream, mr);
-    result_bools->set_null_mask(std::move(null_mask), num_nulls);
+    if (return_index) {
+      // index_of is null only for null rows and null search keys; a key that
+      // is simply absent yields -1, regardless of nulls among the elements.
+      if (!search_keys_have_nulls && !lists.has_nulls()) {
+        std::tie(null_mask, num_nulls) = std::pair{rmm::device_buffer{0, stream, mr}, size_type{0}};
+      } else {
+        std::tie(null_mask, num_nulls) =
+          cudf::detail::valid_if(result_validity->view().begin<bool>(),
+                                 result_validity->view().end<bool>(),
+                                 thrust::identity<bool>{},
+                                 stream,
+                                 mr);
+      }
+    } else {
+      std::tie(null_mask, num_nulls) = construct_null_mask(lists, result_validity->view(), stream, mr);
+    }
+    result->set_null_mask(std::move(null_mask), num_nulls);
 
-    return result_bools;
+    return result;
   }
 };
 
@@ -219,6 +334,33 @@ std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
                search_keys.type(), lookup_functor<false>{}, lists, search_keys, stream, mr);
 }
 
+std::unique_ptr<column> index_of(cudf::lists_column_view const& lists,
+                                 cudf::scalar const& search_key,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  return search_key.is_valid(stream)
+           ? cudf::type_dispatcher(
+               search_key.type(), lookup_functor<false>{true}, lists, search_key, stream, mr)
+           : cudf::type_dispatcher(
+               search_key.type(), lookup_functor<true>{true}, lists, search_key, stream, mr);
+}
+
+std::unique_ptr<column> index_of(cudf::lists_column_view const& lists,
+                                 cudf::column_view const& search_keys,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(search_keys.size() == lists.size(),
+               "Number of search keys must match list column size.");
+
+  return search_keys.has_nulls()
+           ? cudf::type_dispatcher(
+               search_keys.type(), lookup_functor<true>{true}, lists, search_keys, stream, mr)
+           : cudf::type_dispatcher(
+               search_keys.type(), lookup_functor<false>{true}, lists, search_keys, stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
@@ -237,5 +379,21 @@ std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
   return detail::contains(lists, search_keys, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> index_of(cudf::lists_column_view const& lists,
+                                 cudf::scalar const& search_key,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::index_of(lists, search_key, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> index_of(cudf::lists_column_view const& lists,
+                                 cudf::column_view const& search_keys,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::index_of(lists, search_keys, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace lists
 }  // namespace cudf
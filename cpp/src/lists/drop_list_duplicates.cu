@@ -19,13 +19,17 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/lists/detail/sorting.hpp>
 #include <cudf/lists/drop_list_duplicates.hpp>
 #include <cudf/structs/struct_view.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -33,7 +37,10 @@
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/functional.h>
+#include <thrust/scan.h>
 #include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
 
 namespace cudf {
 namespace lists {
@@ -615,6 +622,192 @@ void generate_offsets(size_type num_entries,
                     });
 }
 
+// Upper bound on list size for the fused short-lists kernel; a warp sorts and
+// dedupes one list entirely in shared memory.
+auto constexpr max_short_list_size = size_type{128};
+auto constexpr warps_per_block     = size_type{8};
+
+/**
+ * @brief Sorts and dedupes each short list with one warp, entirely in shared memory.
+ *
+ * Each warp copies its list into a shared-memory buffer, runs an odd-even
+ * transposition sort, then compacts the unique entries (ballot + popcount) to
+ * the start position of its list in `out_entries` and records the unique count.
+ * This produces the same sorted-unique entries as the segmented-sort path but
+ * in a single fused kernel, skipping the radix-sort machinery and the separate
+ * unique-copy and gather passes.
+ *
+ * @param entries All list entries (no nulls)
+ * @param offsets 0-based list offsets (`num_lists + 1` entries)
+ * @param num_lists Number of lists
+ * @param out_entries Scratch output; unique entries of list `i` start at `offsets[i]`
+ * @param out_counts Number of unique entries per list
+ */
+template <typename T>
+__global__ void sorted_unique_short_lists_kernel(T const* entries,
+                                                 offset_type const* offsets,
+                                                 size_type num_lists,
+                                                 T* out_entries,
+                                                 size_type* out_counts)
+{
+  __shared__ T buffer[warps_per_block][max_short_list_size];
+
+  auto const warp_index = static_cast<size_type>(
+    (blockIdx.x * static_cast<std::size_t>(blockDim.x) + threadIdx.x) / cudf::detail::warp_size);
+  if (warp_index >= num_lists) { return; }
+
+  auto const lane       = static_cast<size_type>(threadIdx.x % cudf::detail::warp_size);
+  auto const local_warp = threadIdx.x / cudf::detail::warp_size;
+  auto const begin      = offsets[warp_index];
+  auto const size       = offsets[warp_index + 1] - begin;
+  T* buf                = buffer[local_warp];
+
+  for (auto i = lane; i < size; i += cudf::detail::warp_size) { buf[i] = entries[begin + i]; }
+  __syncwarp();
+
+  for (size_type phase = 0; phase < size; ++phase) {
+    for (auto i = (phase & 1) + 2 * lane; i + 1 < size; i += 2 * cudf::detail::warp_size) {
+      if (buf[i + 1] < buf[i]) {
+        T const tmp = buf[i];
+        buf[i]      = buf[i + 1];
+        buf[i + 1]  = tmp;
+      }
+    }
+    __syncwarp();
+  }
+
+  size_type count = 0;
+  for (size_type base = 0; base < size; base += cudf::detail::warp_size) {
+    auto const i    = base + lane;
+    bool const keep = i < size && (i == 0 || buf[i - 1] < buf[i]);
+    auto const mask = __ballot_sync(0xffffffffu, keep);
+    if (keep) {
+      out_entries[begin + count + __popc(mask & ((1u << lane) - 1))] = buf[i];
+    }
+    count += __popc(mask);
+  }
+  if (lane == 0) { out_counts[warp_index] = count; }
+}
+
+/**
+ * @brief Struct used in type_dispatcher to run the short-lists kernel on the
+ * storage representation of fixed-width entries.
+ */
+struct short_lists_drop_duplicates_dispatch {
+  template <typename Type, std::enable_if_t<!cudf::is_fixed_width<Type>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     column_view const&,
+                                     lists_column_view const&,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*) const
+  {
+    CUDF_FAIL("The short-lists path only operates on fixed-width entries.");
+  }
+
+  template <typename Type, std::enable_if_t<cudf::is_fixed_width<Type>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& entries,
+                                     column_view const& offsets,
+                                     lists_column_view const& lists_column,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr) const
+  {
+    auto const num_lists = lists_column.size();
+    auto* temp_mr        = get_temp_memory_resource();
+
+    auto scratch_entries = rmm::device_uvector<Type>(entries.size(), stream, temp_mr);
+    auto unique_counts   = rmm::device_uvector<size_type>(num_lists, stream, temp_mr);
+
+    auto const num_blocks = cudf::util::div_rounding_up_safe(num_lists, warps_per_block);
+    sorted_unique_short_lists_kernel<Type>
+      <<<num_blocks, warps_per_block * cudf::detail::warp_size, 0, stream.value()>>>(
+        entries.data<Type>(),
+        offsets.begin<offset_type>(),
+        num_lists,
+        scratch_entries.data(),
+        unique_counts.data());
+    CHECK_CUDA(stream.value());
+
+    auto out_offsets = make_numeric_column(
+      data_type{type_to_id<offset_type>()}, num_lists + 1, mask_state::UNALLOCATED, stream, mr);
+    auto const d_out_offsets = out_offsets->mutable_view().begin<offset_type>();
+    thrust::fill_n(rmm::exec_policy(stream), d_out_offsets, 1, offset_type{0});
+    thrust::inclusive_scan(
+      rmm::exec_policy(stream), unique_counts.begin(), unique_counts.end(), d_out_offsets + 1);
+
+    auto const num_unique_entries =
+      cudf::detail::get_value<offset_type>(out_offsets->view(), num_lists, stream);
+    auto out_entries =
+      make_fixed_width_column(entries.type(), num_unique_entries, mask_state::UNALLOCATED, stream, mr);
+
+    // Compact the per-list unique entries from the input layout to the output layout.
+    auto labels = rmm::device_uvector<size_type>(num_unique_entries, stream, temp_mr);
+    thrust::upper_bound(rmm::exec_policy(stream),
+                        d_out_offsets + 1,
+                        d_out_offsets + num_lists + 1,
+                        thrust::make_counting_iterator<offset_type>(0),
+                        thrust::make_counting_iterator<offset_type>(num_unique_entries),
+                        labels.begin());
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_unique_entries),
+                      out_entries->mutable_view().begin<Type>(),
+                      [d_labels      = labels.data(),
+                       d_out_offsets = static_cast<offset_type const*>(d_out_offsets),
+                       d_in_offsets  = offsets.begin<offset_type>(),
+                       d_scratch     = scratch_entries.data()] __device__(size_type i) {
+                        auto const row = d_labels[i];
+                        return d_scratch[d_in_offsets[row] + i - d_out_offsets[row]];
+                      });
+
+    return make_lists_column(num_lists,
+                             std::move(out_offsets),
+                             std::move(out_entries),
+                             lists_column.null_count(),
+                             cudf::detail::copy_bitmask(lists_column.parent(), stream, mr));
+  }
+};
+
+/**
+ * @brief Attempts the fused short-lists path; returns nullptr when ineligible.
+ *
+ * Eligible inputs have non-nullable, non-floating-point fixed-width entries and
+ * no list longer than `max_short_list_size`. Floating-point entries are
+ * excluded so the NaN/-NaN equality rules stay in one place (the sort path);
+ * nullable entries are excluded to keep the kernel's comparator trivial.
+ */
+std::unique_ptr<column> try_drop_duplicates_short_lists(lists_column_view const& lists_column,
+                                                        column_view const& lists_entries,
+                                                        rmm::cuda_stream_view stream,
+                                                        rmm::mr::device_memory_resource* mr)
+{
+  if (!cudf::is_fixed_width(lists_entries.type()) || cudf::is_floating_point(lists_entries.type()) ||
+      lists_entries.has_nulls()) {
+    return nullptr;
+  }
+
+  auto const num_lists     = lists_column.size();
+  auto const max_list_size = thrust::transform_reduce(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_lists),
+    [offsets = lists_column.offsets_begin()] __device__(size_type i) {
+      return offsets[i + 1] - offsets[i];
+    },
+    size_type{0},
+    thrust::maximum<size_type>{});
+  if (max_list_size > max_short_list_size) { return nullptr; }
+
+  auto const clean_offsets =
+    generate_clean_offsets(lists_column, stream, rmm::mr::get_current_device_resource());
+  return type_dispatcher<dispatch_storage_type>(lists_entries.type(),
+                                                short_lists_drop_duplicates_dispatch{},
+                                                lists_entries,
+                                                clean_offsets->view(),
+                                                lists_column,
+                                                stream,
+                                                mr);
+}
+
 }  // anonymous namespace
 
 /**
@@ -637,6 +830,14 @@ std::unique_ptr<column> drop_list_duplicates(lists_column_view const& lists_colu
   // Flatten all entries (depth = 1) of the lists column.
   auto const lists_entries = lists_column.get_sliced_child(stream);
 
+  // Fast path: short fixed-width lists are sorted and deduped in one fused
+  // warp-per-list kernel instead of paying for the full segmented-sort
+  // machinery below.
+  if (auto result =
+        detail::try_drop_duplicates_short_lists(lists_column, lists_entries, stream, mr)) {
+    return result;
+  }
+
   // sorted_lists will store the results of the original lists after calling segmented_sort.
   auto const sorted_lists = [&]() {
     // If nans_equal == ALL_EQUAL and the column contains lists of floating-point data type,
@@ -17,6 +17,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/explode.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/table/table.hpp>
@@ -31,6 +32,7 @@
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/optional.h>
 
+#include <algorithm>
 #include <memory>
 #include <type_traits>
 
@@ -43,6 +45,65 @@ constexpr size_type InvalidIndex = -1;
 
 namespace {
 
+/**
+ * @brief Checks if a passthrough column can be expanded by the fused kernel.
+ *
+ * The fused expansion copies raw fixed-width values and produces columns
+ * without null masks, so it is restricted to non-nullable leaf columns.
+ */
+bool is_fused_expandable(column_view const& col)
+{
+  return cudf::is_fixed_width(col.type()) && !col.nullable() && col.num_children() == 0;
+}
+
+/**
+ * @brief Expands a set of fixed-width passthrough columns in a single kernel.
+ *
+ * All columns are replicated in one launch of `fused_leaf_gather_kernel`
+ * instead of one gather per column. `gather_map_begin` may be a transform
+ * iterator computing source rows on the fly, in which case no gather map is
+ * materialized in global memory at all.
+ */
+template <typename MapIterator>
+std::vector<std::unique_ptr<column>> expand_fixed_width_columns(
+  std::vector<column_view> const& columns,
+  MapIterator gather_map_begin,
+  size_type output_size,
+  size_type input_size,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  std::vector<std::unique_ptr<column>> output(columns.size());
+  std::vector<fused_gather_leaf> leaves;
+  leaves.reserve(columns.size());
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    auto const& col         = columns[i];
+    auto const element_size = cudf::size_of(col.type());
+    output[i] = make_fixed_width_column(col.type(), output_size, mask_state::UNALLOCATED, stream, mr);
+    leaves.push_back(
+      fused_gather_leaf{col.head<uint8_t>() + static_cast<int64_t>(col.offset()) * element_size,
+                        output[i]->mutable_view().head<uint8_t>(),
+                        static_cast<int32_t>(element_size)});
+  }
+
+  auto const d_leaves     = cudf::detail::make_device_uvector_async(leaves, stream);
+  auto const num_elements = static_cast<int64_t>(output_size) * columns.size();
+  if (num_elements > 0) {
+    constexpr size_type block_size = 256;
+    auto const num_blocks          = static_cast<size_type>(
+      std::min<int64_t>(65535, (num_elements + block_size - 1) / block_size));
+    fused_leaf_gather_kernel<<<num_blocks, block_size, 0, stream.value()>>>(
+      d_leaves.data(),
+      static_cast<size_type>(columns.size()),
+      output_size,
+      input_size,
+      gather_map_begin,
+      false);
+    CHECK_CUDA(stream.value());
+  }
+  return output;
+}
+
 std::unique_ptr<table> build_table(
   table_view const& input_table,
   size_type const explode_column_idx,
@@ -53,19 +114,48 @@ std::unique_ptr<table> build_table(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
-  auto select_iter = thrust::make_transform_iterator(
-    thrust::make_counting_iterator(0),
-    [explode_column_idx](size_type i) { return i >= explode_column_idx ? i + 1 : i; });
-
-  auto gathered_table =
-    detail::gather(input_table.select(select_iter, select_iter + input_table.num_columns() - 1),
-                   gather_map.begin(),
-                   gather_map.end(),
-                   cudf::out_of_bounds_policy::DONT_CHECK,
-                   stream,
-                   mr);
+  // Split the passthrough columns: fixed-width non-nullable leaves are all
+  // expanded by one fused kernel; everything else goes through the generic
+  // per-column gather.
+  std::vector<size_type> fused_positions;
+  std::vector<size_type> generic_positions;
+  std::vector<column_view> fused_columns;
+  std::vector<column_view> generic_columns;
+  for (size_type i = 0; i < input_table.num_columns() - 1; ++i) {
+    auto const& col = input_table.column(i >= explode_column_idx ? i + 1 : i);
+    if (is_fused_expandable(col)) {
+      fused_positions.push_back(i);
+      fused_columns.push_back(col);
+    } else {
+      generic_positions.push_back(i);
+      generic_columns.push_back(col);
+    }
+  }
 
-  std::vector<std::unique_ptr<column>> columns = gathered_table.release()->release();
+  std::vector<std::unique_ptr<column>> columns(input_table.num_columns() - 1);
+  if (!fused_columns.empty()) {
+    auto expanded = expand_fixed_width_columns(fused_columns,
+                                               gather_map.begin(),
+                                               static_cast<size_type>(gather_map.size()),
+                                               input_table.num_rows(),
+                                               stream,
+                                               mr);
+    for (std::size_t i = 0; i < expanded.size(); ++i) {
+      columns[fused_positions[i]] = std::move(expanded[i]);
+    }
+  }
+  if (!generic_columns.empty()) {
+    auto gathered = detail::gather(table_view{generic_columns},
+                                   gather_map.begin(),
+                                   gather_map.end(),
+                                   cudf::out_of_bounds_policy::DONT_CHECK,
+                                   stream,
+                                   mr)
+                      ->release();
+    for (std::size_t i = 0; i < gathered.size(); ++i) {
+      columns[generic_positions[i]] = std::move(gathered[i]);
+    }
+  }
 
   columns.insert(columns.begin() + explode_column_idx,
                  explode_col_gather_map
@@ -109,7 +199,6 @@ std::unique_ptr<table> explode(table_view const& input_table,
 {
   lists_column_view explode_col{input_table.column(explode_column_idx)};
   auto sliced_child = explode_col.get_sliced_child(stream);
-  rmm::device_uvector<size_type> gather_map(sliced_child.size(), stream);
 
   // Sliced columns may require rebasing of the offsets.
   auto offsets = explode_col.offsets_begin();
@@ -118,6 +207,37 @@ std::unique_ptr<table> explode(table_view const& input_table,
     thrust::next(offsets), [offsets] __device__(auto i) { return (i - offsets[0]) - 1; });
   auto counting_iter = thrust::make_counting_iterator(0);
 
+  // If every passthrough column can be expanded by the fused kernel, the
+  // gather map never needs to be materialized: each output row's source is
+  // recomputed from the offsets on the fly inside the single expansion kernel.
+  auto const all_passthrough_fused = [&] {
+    for (size_type i = 0; i < input_table.num_columns(); ++i) {
+      if (i != explode_column_idx && !is_fused_expandable(input_table.column(i))) { return false; }
+    }
+    return true;
+  }();
+  if (all_passthrough_fused) {
+    auto const map_iter = thrust::make_transform_iterator(
+      counting_iter,
+      [offsets_minus_one, offset_size = explode_col.size()] __device__(size_type idx) -> size_type {
+        return thrust::distance(
+          offsets_minus_one,
+          thrust::lower_bound(thrust::seq, offsets_minus_one, offsets_minus_one + offset_size, idx));
+      });
+
+    std::vector<column_view> passthrough_columns;
+    for (size_type i = 0; i < input_table.num_columns(); ++i) {
+      if (i != explode_column_idx) { passthrough_columns.push_back(input_table.column(i)); }
+    }
+    auto columns = expand_fixed_width_columns(
+      passthrough_columns, map_iter, sliced_child.size(), input_table.num_rows(), stream, mr);
+    columns.insert(columns.begin() + explode_column_idx,
+                   std::make_unique<column>(sliced_child, stream, mr));
+    return std::make_unique<table>(std::move(columns));
+  }
+
+  rmm::device_uvector<size_type> gather_map(sliced_child.size(), stream);
+
   // This looks like an off-by-one bug, but what is going on here is that we need to reduce each
   // result from `lower_bound` by 1 to build the correct gather map. This can be accomplished by
   // skipping the first entry and using the result of `lower_bound` directly.
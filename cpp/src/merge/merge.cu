@@ -14,7 +14,9 @@
  * limitations under the License.
  */
 #include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/merge.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
@@ -31,11 +33,15 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/distance.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/merge.h>
 #include <thrust/pair.h>
+#include <thrust/sequence.h>
 
+#include <algorithm>
 #include <queue>
 #include <vector>
 #include "cudf/utilities/traits.hpp"
@@ -243,7 +249,7 @@ struct column_merger {
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const
   {
     auto lsz         = lcol.size();
-    auto merged_size = lsz + rcol.size();
+    auto merged_size = static_cast<size_type>(row_order_.size());
     auto merged_col  = cudf::detail::allocate_like(lcol.has_nulls() ? lcol : rcol,
                                                   merged_size,
                                                   cudf::mask_allocation_policy::RETAIN,
@@ -266,9 +272,12 @@ struct column_merger {
     //
     cudf::detail::set_null_mask(merged_view.null_mask(), 0, merged_view.size(), true, stream);
 
-    // set the null count:
+    // set the null count; a row order covering only a subset of the input rows
+    // (e.g. merge_upsert) makes the exact count unknowable up front:
     //
-    merged_col->set_null_count(lcol.null_count() + rcol.null_count());
+    merged_col->set_null_count(merged_size == lsz + rcol.size()
+                                 ? lcol.null_count() + rcol.null_count()
+                                 : cudf::UNKNOWN_NULL_COUNT);
 
     // to resolve view.data()'s types use: Element
     //
@@ -367,7 +376,7 @@ std::unique_ptr<column> column_merger::operator()<cudf::struct_view>(
     });
 
   auto merged_children   = std::vector<std::unique_ptr<column>>(it, it + lhs.num_children());
-  auto const merged_size = lcol.size() + rcol.size();
+  auto const merged_size = static_cast<size_type>(row_order_.size());
 
   // materialize the output buffer
   rmm::device_buffer validity =
@@ -385,7 +394,9 @@ std::unique_ptr<column> column_merger::operator()<cudf::struct_view>(
 
   return make_structs_column(merged_size,
                              std::move(merged_children),
-                             lcol.null_count() + rcol.null_count(),
+                             merged_size == lcol.size() + rcol.size()
+                               ? lcol.null_count() + rcol.null_count()
+                               : cudf::UNKNOWN_NULL_COUNT,
                              std::move(validity),
                              stream,
                              mr);
@@ -431,6 +442,90 @@ table_ptr_type merge(cudf::table_view const& left_table,
   return std::make_unique<cudf::table>(std::move(merged_cols));
 }
 
+/**
+ * @brief Merges more than two sorted tables with a single materialization pass.
+ *
+ * The inputs are concatenated once so that every row is addressed by a single
+ * index into the concatenated table and each input occupies one sorted index
+ * run. The runs are then pairwise-merged as plain indices — only the key
+ * columns are re-read for comparisons — and the payload columns are
+ * materialized by one gather at the end, instead of being rewritten on every
+ * level of the pairwise merge tree.
+ */
+table_ptr_type k_way_merge(std::vector<table_view> const& tables_to_merge,
+                           std::vector<cudf::size_type> const& key_cols,
+                           std::vector<cudf::order> const& column_order,
+                           std::vector<cudf::null_order> const& null_precedence,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr)
+{
+  auto const concatenated =
+    cudf::detail::concatenate(tables_to_merge, stream, rmm::mr::get_current_device_resource());
+  auto const keys     = concatenated->view().select(key_cols);
+  auto const num_rows = concatenated->num_rows();
+
+  // Each input table forms one sorted run of row indices in the concatenated table.
+  std::vector<size_type> run_offsets{0};
+  for (auto const& table : tables_to_merge) {
+    run_offsets.push_back(run_offsets.back() + table.num_rows());
+  }
+
+  rmm::device_uvector<size_type> cur(num_rows, stream);
+  rmm::device_uvector<size_type> alt(num_rows, stream);
+  thrust::sequence(rmm::exec_policy(stream), cur.begin(), cur.end(), 0);
+
+  auto const keys_device    = table_device_view::create(keys, stream);
+  auto const d_column_order = cudf::detail::make_device_uvector_async(column_order, stream);
+  auto const null_prec      = null_precedence.empty()
+                           ? std::vector<null_order>(key_cols.size(), null_order::BEFORE)
+                           : null_precedence;
+  auto const d_null_precedence = cudf::detail::make_device_uvector_async(null_prec, stream);
+
+  auto merge_runs = [&](auto const& comparator) {
+    while (run_offsets.size() > 2) {
+      std::vector<size_type> next_offsets{0};
+      std::size_t r = 0;
+      for (; r + 2 < run_offsets.size(); r += 2) {
+        thrust::merge(rmm::exec_policy(stream),
+                      cur.begin() + run_offsets[r],
+                      cur.begin() + run_offsets[r + 1],
+                      cur.begin() + run_offsets[r + 1],
+                      cur.begin() + run_offsets[r + 2],
+                      alt.begin() + run_offsets[r],
+                      comparator);
+        next_offsets.push_back(run_offsets[r + 2]);
+      }
+      // carry a leftover odd run over to the next round
+      if (r + 2 == run_offsets.size()) {
+        thrust::copy(rmm::exec_policy(stream),
+                     cur.begin() + run_offsets[r],
+                     cur.begin() + run_offsets[r + 1],
+                     alt.begin() + run_offsets[r]);
+        next_offsets.push_back(run_offsets[r + 1]);
+      }
+      std::swap(cur, alt);
+      run_offsets = std::move(next_offsets);
+    }
+  };
+
+  if (cudf::has_nulls(keys)) {
+    merge_runs(row_lexicographic_comparator<true>(
+      *keys_device, *keys_device, d_column_order.data(), d_null_precedence.data()));
+  } else {
+    merge_runs(
+      row_lexicographic_comparator<false>(*keys_device, *keys_device, d_column_order.data()));
+  }
+
+  auto const gather_map =
+    column_view{data_type{type_to_id<size_type>()}, num_rows, cur.data()};
+  return cudf::detail::gather(concatenated->view(),
+                              gather_map,
+                              out_of_bounds_policy::DONT_CHECK,
+                              negative_index_policy::NOT_ALLOWED,
+                              stream,
+                              mr);
+}
+
 struct merge_queue_item {
   table_view view;
   table_ptr_type table;
@@ -491,6 +586,17 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
     tables_to_merge, stream, rmm::mr::get_current_device_resource());
   auto merge_tables = matched.second;
 
+  // More than two non-empty inputs: merge them all at once instead of folding
+  // pairwise, which would rewrite every column log(N) times.
+  std::vector<table_view> non_empty_tables;
+  std::copy_if(merge_tables.begin(),
+               merge_tables.end(),
+               std::back_inserter(non_empty_tables),
+               [](auto const& table) { return table.num_rows() > 0; });
+  if (non_empty_tables.size() > 2) {
+    return k_way_merge(non_empty_tables, key_cols, column_order, null_precedence, stream, mr);
+  }
+
   // A queue of (table view, table) pairs
   std::priority_queue<merge_queue_item> merge_queue;
   // The table pointer is null if we do not own the table (input tables)
@@ -528,6 +634,107 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
   return std::move(top_and_pop(merge_queue).table);
 }
 
+namespace {
+
+/**
+ * @brief Predicate keeping the merged-index positions that survive an upsert.
+ *
+ * Update rows enter the merge as the left range, so the stability of `thrust::merge`
+ * places each update row immediately before any target row with an equal key. A target
+ * (right side) row is dropped exactly when the preceding merged row is an update row
+ * with equal keys.
+ */
+template <bool has_nulls>
+struct upsert_row_filter {
+  index_type const* merged;
+  row_lexicographic_tagged_comparator<has_nulls> comp;
+
+  __device__ bool operator()(size_type pos) const
+  {
+    if (pos == 0 or thrust::get<0>(merged[pos]) != side::RIGHT) { return true; }
+    auto const prev = merged[pos - 1];
+    if (thrust::get<0>(prev) != side::LEFT) { return true; }
+    // keep the target row only if its key differs from the preceding update row
+    return comp(prev, merged[pos]) or comp(merged[pos], prev);
+  }
+};
+
+}  // anonymous namespace
+
+table_ptr_type merge_upsert(table_view const& target,
+                            table_view const& updates,
+                            std::vector<cudf::size_type> const& key_cols,
+                            std::vector<cudf::order> const& column_order,
+                            std::vector<cudf::null_order> const& null_precedence,
+                            rmm::cuda_stream_view stream,
+                            rmm::mr::device_memory_resource* mr)
+{
+  auto const n_cols = target.num_columns();
+  CUDF_EXPECTS(n_cols == updates.num_columns(), "Mismatched number of columns");
+  CUDF_EXPECTS(cudf::have_same_types(target, updates), "Mismatched column types");
+  CUDF_EXPECTS(!key_cols.empty(), "Empty key_cols");
+  CUDF_EXPECTS(key_cols.size() <= static_cast<size_t>(n_cols), "Too many values in key_cols");
+  CUDF_EXPECTS(key_cols.size() == column_order.size(),
+               "Mismatched size between key_cols and column_order");
+
+  if (updates.num_rows() == 0) { return std::make_unique<cudf::table>(target, stream, mr); }
+  if (target.num_rows() == 0) { return std::make_unique<cudf::table>(updates, stream, mr); }
+
+  auto matched = cudf::dictionary::detail::match_dictionaries(
+    {updates, target}, stream, rmm::mr::get_current_device_resource());
+  auto const updates_matched = matched.second.front();
+  auto const target_matched  = matched.second.back();
+
+  auto const index_updates_view = updates_matched.select(key_cols);
+  auto const index_target_view  = target_matched.select(key_cols);
+  bool const nullable = cudf::has_nulls(index_updates_view) || cudf::has_nulls(index_target_view);
+
+  // updates enter as the left range so ties resolve in their favor (see upsert_row_filter)
+  auto const merged_indices = generate_merged_indices(
+    index_updates_view, index_target_view, column_order, null_precedence, nullable, stream);
+
+  auto lhs_device_view = table_device_view::create(index_updates_view, stream);
+  auto rhs_device_view = table_device_view::create(index_target_view, stream);
+  auto d_column_order  = cudf::detail::make_device_uvector_async(column_order, stream);
+
+  index_vector upsert_indices(merged_indices.size(), stream);
+  auto filter_indices = [&](auto filter) {
+    auto const end = thrust::copy_if(rmm::exec_policy(stream),
+                                     merged_indices.begin(),
+                                     merged_indices.end(),
+                                     thrust::make_counting_iterator<size_type>(0),
+                                     upsert_indices.begin(),
+                                     filter);
+    upsert_indices.resize(thrust::distance(upsert_indices.begin(), end), stream);
+  };
+
+  if (nullable) {
+    auto d_null_precedence = cudf::detail::make_device_uvector_async(null_precedence, stream);
+    auto ineq_op           = detail::row_lexicographic_tagged_comparator<true>(
+      *lhs_device_view, *rhs_device_view, d_column_order.data(), d_null_precedence.data());
+    filter_indices(upsert_row_filter<true>{merged_indices.data(), ineq_op});
+  } else {
+    auto ineq_op = detail::row_lexicographic_tagged_comparator<false>(
+      *lhs_device_view, *rhs_device_view, d_column_order.data());
+    filter_indices(upsert_row_filter<false>{merged_indices.data(), ineq_op});
+  }
+
+  // materialize the surviving rows in one pass
+  std::vector<std::unique_ptr<column>> merged_cols;
+  merged_cols.reserve(n_cols);
+  column_merger merger{upsert_indices};
+  transform(updates_matched.begin(),
+            updates_matched.end(),
+            target_matched.begin(),
+            std::back_inserter(merged_cols),
+            [&](auto const& left_col, auto const& right_col) {
+              return cudf::type_dispatcher<dispatch_storage_type>(
+                left_col.type(), merger, left_col, right_col, stream, mr);
+            });
+
+  return std::make_unique<cudf::table>(std::move(merged_cols));
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::table> merge(std::vector<table_view> const& tables_to_merge,
@@ -541,4 +748,16 @@ std::unique_ptr<cudf::table> merge(std::vector<table_view> const& tables_to_merg
     tables_to_merge, key_cols, column_order, null_precedence, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<cudf::table> merge_upsert(table_view const& target,
+                                          table_view const& updates,
+                                          std::vector<cudf::size_type> const& key_cols,
+                                          std::vector<cudf::order> const& column_order,
+                                          std::vector<cudf::null_order> const& null_precedence,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::merge_upsert(
+    target, updates, key_cols, column_order, null_precedence, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
@@ -19,6 +19,7 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/partitioning.hpp>
 #include <cudf/detail/scatter.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
@@ -392,6 +393,7 @@ struct copy_block_partitions_dispatcher {
                                      size_type const* block_partition_sizes,
                                      size_type const* scanned_block_partition_sizes,
                                      size_type grid_size,
+                                     rmm::device_uvector<size_type>& gather_map,
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
   {
@@ -419,20 +421,26 @@ struct copy_block_partitions_dispatcher {
                                      size_type const* block_partition_sizes,
                                      size_type const* scanned_block_partition_sizes,
                                      size_type grid_size,
+                                     rmm::device_uvector<size_type>& gather_map,
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
   {
-    // Use move_to_output_buffer to create an equivalent gather map
-    auto gather_map = compute_gather_map(input.size(),
-                                         num_partitions,
-                                         row_partition_numbers,
-                                         row_partition_offset,
-                                         block_partition_sizes,
-                                         scanned_block_partition_sizes,
-                                         grid_size,
-                                         stream);
-
-    // Use gather instead for non-fixed width types
+    // Use move_to_output_buffer to create an equivalent gather map. The map is
+    // shared by every column that needs one (and by the bitmask gather), so it
+    // is only computed on the first use.
+    if (gather_map.is_empty() and input.size() > 0) {
+      gather_map = compute_gather_map(input.size(),
+                                      num_partitions,
+                                      row_partition_numbers,
+                                      row_partition_offset,
+                                      block_partition_sizes,
+                                      scanned_block_partition_sizes,
+                                      grid_size,
+                                      stream);
+    }
+
+    // Use gather instead for non-fixed width types; strings take the
+    // char-level bulk copy path inside strings::detail::gather
     return type_dispatcher(input.type(),
                            detail::column_gatherer{},
                            input,
@@ -559,6 +567,10 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   if (use_optimization) {
     std::vector<std::unique_ptr<column>> output_cols(input.num_columns());
 
+    // Gather map shared by all variable-width columns and the bitmask gather;
+    // computed at most once instead of once per consumer
+    rmm::device_uvector<size_type> gather_map(0, stream);
+
     // Copy input to output by partition per column
     std::transform(input.begin(), input.end(), output_cols.begin(), [&](auto const& col) {
       return cudf::type_dispatcher<dispatch_storage_type>(col.type(),
@@ -570,20 +582,24 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
                                                           block_partition_sizes.data(),
                                                           scanned_block_partition_sizes.data(),
                                                           grid_size,
+                                                          gather_map,
                                                           stream,
                                                           mr);
     });
 
     if (has_nulls(input)) {
-      // Use copy_block_partitions to compute a gather map
-      auto gather_map = compute_gather_map(num_rows,
-                                           num_partitions,
-                                           row_partition_numbers.data(),
-                                           row_partition_offset.data(),
-                                           block_partition_sizes.data(),
-                                           scanned_block_partition_sizes.data(),
-                                           grid_size,
-                                           stream);
+      // Use copy_block_partitions to compute a gather map, unless a
+      // variable-width column already did
+      if (gather_map.is_empty() and num_rows > 0) {
+        gather_map = compute_gather_map(num_rows,
+                                        num_partitions,
+                                        row_partition_numbers.data(),
+                                        row_partition_offset.data(),
+                                        block_partition_sizes.data(),
+                                        scanned_block_partition_sizes.data(),
+                                        grid_size,
+                                        stream);
+      }
 
       // Handle bitmask using gather to take advantage of ballot_sync
       detail::gather_bitmask(
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/partitioning.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/tabulate.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// Sample size per output partition used when computing splitters. Larger
+// values give more balanced partitions on skewed keys at the cost of a bigger
+// sample sort; 128 keeps the p99 partition size within a few percent of the
+// mean while the sample stays tiny relative to typical inputs.
+constexpr size_type oversampling_factor = 128;
+
+}  // namespace
+
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& keys,
+  table_view const& splitters,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const keys_view = input.select(keys);
+  CUDF_EXPECTS(splitters.num_columns() == keys_view.num_columns(),
+               "Mismatch in number of splitter columns and key columns.");
+
+  auto const num_partitions = splitters.num_rows() + 1;
+  if (input.num_rows() == 0) {
+    return std::make_pair(empty_like(input), std::vector<size_type>(num_partitions + 1, 0));
+  }
+
+  // The partition map for row `r` is the number of splitters <= row `r`,
+  // i.e. a vectorized binary search over the splitter table. The map is
+  // scratch and comes from the temporary resource.
+  auto const partition_map = cudf::detail::upper_bound(
+    splitters, keys_view, column_order, null_precedence, stream, get_temp_memory_resource());
+
+  return detail::partition(input, partition_map->view(), num_partitions, stream, mr);
+}
+
+std::unique_ptr<table> compute_range_splitters(table_view const& keys,
+                                               size_type num_partitions,
+                                               std::vector<order> const& column_order,
+                                               std::vector<null_order> const& null_precedence,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(num_partitions > 0, "Number of partitions must be positive.");
+
+  if (num_partitions == 1 or keys.num_rows() == 0) {
+    return empty_like(keys);  // no splitters needed for a single partition
+  }
+
+  auto const num_rows = keys.num_rows();
+  auto const num_samples =
+    std::min<size_type>(num_rows, num_partitions * oversampling_factor);
+
+  auto const sample  = cudf::detail::sample(keys,
+                                           num_samples,
+                                           sample_with_replacement::FALSE,
+                                           0,
+                                           stream,
+                                           get_temp_memory_resource());
+  auto const sorted  = cudf::detail::sort_by_key(sample->view(),
+                                                sample->view(),
+                                                column_order,
+                                                null_precedence,
+                                                stream,
+                                                get_temp_memory_resource());
+
+  // Pick evenly spaced rows of the sorted sample as splitters. Using the last
+  // row of each sample quantile keeps every key strictly less than splitter
+  // `i` out of partitions greater than `i`.
+  rmm::device_uvector<size_type> splitter_indices(num_partitions - 1, stream);
+  thrust::tabulate(rmm::exec_policy(stream),
+                   splitter_indices.begin(),
+                   splitter_indices.end(),
+                   [num_samples, num_partitions] __device__(size_type i) {
+                     return static_cast<size_type>(
+                       (static_cast<int64_t>(i + 1) * num_samples) / num_partitions - 1);
+                   });
+
+  return cudf::detail::gather(
+    sorted->view(),
+    column_view{data_type{type_id::INT32},
+                static_cast<size_type>(splitter_indices.size()),
+                splitter_indices.data()},
+    out_of_bounds_policy::DONT_CHECK,
+    detail::negative_index_policy::NOT_ALLOWED,
+    stream,
+    mr);
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& keys,
+  table_view const& splitters,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::range_partition(
+    input, keys, splitters, column_order, null_precedence, stream, mr);
+}
+
+std::unique_ptr<table> compute_range_splitters(table_view const& keys,
+                                               size_type num_partitions,
+                                               std::vector<order> const& column_order,
+                                               std::vector<null_order> const& null_precedence,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_range_splitters(
+    keys, num_partitions, column_order, null_precedence, stream, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+constexpr size_type fused_block_size = 256;
+constexpr size_type max_grid_chunks  = 64;
+
+/**
+ * @brief One fused reduction over one column: which column of the group table
+ * to read, which operation to apply, and where the resulting scalar lives.
+ */
+template <typename T>
+struct fused_reduce_task {
+  using SumType = cudf::detail::target_type_t<T, aggregation::SUM>;
+
+  size_type source;        ///< column position within the group table
+  aggregation::Kind kind;  ///< MIN, MAX, SUM or COUNT_VALID
+  T init;                  ///< identity value for MIN/MAX
+  T* result;               ///< MIN/MAX result location
+  SumType* sum_result;     ///< SUM result location
+  size_type* valid_count;  ///< valid-element count; the result itself for COUNT_VALID
+  bool* validity;          ///< scalar validity flag
+};
+
+/**
+ * @brief Seed every task's result with its identity value and mark the
+ * scalar invalid (valid for COUNT_VALID: a count over zero rows is zero).
+ */
+template <typename T>
+__global__ void fused_reduce_init_kernel(fused_reduce_task<T>* tasks, size_type num_tasks)
+{
+  auto const idx = static_cast<size_type>(blockIdx.x * blockDim.x + threadIdx.x);
+  if (idx >= num_tasks) return;
+  auto const task = tasks[idx];
+  switch (task.kind) {
+    case aggregation::MIN:
+    case aggregation::MAX: *task.result = task.init; break;
+    case aggregation::SUM: *task.sum_result = typename fused_reduce_task<T>::SumType{}; break;
+    default: break;
+  }
+  *task.valid_count = 0;
+  *task.validity    = task.kind == aggregation::COUNT_VALID;
+}
+
+/**
+ * @brief Compute one task per grid x-slot: threads accumulate a strided
+ * partial over the task's column, reduce it within the block in shared
+ * memory, and merge the block result into the output scalar atomically.
+ */
+template <typename T>
+__global__ void fused_reduce_kernel(table_device_view group,
+                                    fused_reduce_task<T> const* tasks,
+                                    size_type num_tasks)
+{
+  using SumType = typename fused_reduce_task<T>::SumType;
+  __shared__ T block_values[fused_block_size];
+  __shared__ SumType block_sums[fused_block_size];
+  __shared__ size_type block_counts[fused_block_size];
+
+  auto const task     = tasks[blockIdx.x];
+  auto const col      = group.column(task.source);
+  auto const num_rows = col.size();
+
+  T local               = task.init;
+  SumType local_sum     = SumType{};
+  size_type local_count = 0;
+  for (auto idx = static_cast<size_type>(blockIdx.y * blockDim.x + threadIdx.x); idx < num_rows;
+       idx += static_cast<size_type>(blockDim.x * gridDim.y)) {
+    if (!col.is_valid(idx)) continue;
+    ++local_count;
+    auto const value = col.element<T>(idx);
+    switch (task.kind) {
+      case aggregation::MIN: local = DeviceMin{}(local, value); break;
+      case aggregation::MAX: local = DeviceMax{}(local, value); break;
+      case aggregation::SUM: local_sum += static_cast<SumType>(value); break;
+      default: break;  // COUNT_VALID only needs the count
+    }
+  }
+
+  block_values[threadIdx.x] = local;
+  block_sums[threadIdx.x]   = local_sum;
+  block_counts[threadIdx.x] = local_count;
+  __syncthreads();
+  for (size_type offset = blockDim.x / 2; offset > 0; offset /= 2) {
+    if (threadIdx.x < static_cast<unsigned>(offset)) {
+      block_counts[threadIdx.x] += block_counts[threadIdx.x + offset];
+      switch (task.kind) {
+        case aggregation::MIN:
+          block_values[threadIdx.x] =
+            DeviceMin{}(block_values[threadIdx.x], block_values[threadIdx.x + offset]);
+          break;
+        case aggregation::MAX:
+          block_values[threadIdx.x] =
+            DeviceMax{}(block_values[threadIdx.x], block_values[threadIdx.x + offset]);
+          break;
+        case aggregation::SUM:
+          block_sums[threadIdx.x] += block_sums[threadIdx.x + offset];
+          break;
+        default: break;
+      }
+    }
+    __syncthreads();
+  }
+
+  if (threadIdx.x == 0) {
+    atomicAdd(task.valid_count, block_counts[0]);
+    switch (task.kind) {
+      case aggregation::MIN:
+        genericAtomicOperation(task.result, block_values[0], DeviceMin{});
+        break;
+      case aggregation::MAX:
+        genericAtomicOperation(task.result, block_values[0], DeviceMax{});
+        break;
+      case aggregation::SUM:
+        genericAtomicOperation(task.sum_result, block_sums[0], DeviceSum{});
+        break;
+      default: break;
+    }
+  }
+}
+
+/**
+ * @brief A reduction over zero valid rows stays invalid; everything else
+ * becomes a valid scalar once all blocks have contributed.
+ */
+template <typename T>
+__global__ void fused_reduce_finalize_kernel(fused_reduce_task<T> const* tasks,
+                                             size_type num_tasks)
+{
+  auto const idx = static_cast<size_type>(blockIdx.x * blockDim.x + threadIdx.x);
+  if (idx >= num_tasks) return;
+  auto const task = tasks[idx];
+  if (task.kind != aggregation::COUNT_VALID && *task.valid_count > 0) { *task.validity = true; }
+}
+
+/**
+ * @brief Per-type group of fused reductions: the columns of one type plus the
+ * (column, aggregation, result slot) tasks against them.
+ */
+struct fused_reduce_group {
+  std::vector<column_view> columns;
+  std::vector<size_type> source;        // per task: index into columns
+  std::vector<aggregation::Kind> kinds;  // per task: operation
+  std::vector<std::size_t> slots;        // per task: position in the result vector
+};
+
+constexpr bool is_fusible_kind(aggregation::Kind k)
+{
+  return k == aggregation::MIN || k == aggregation::MAX || k == aggregation::SUM ||
+         k == aggregation::COUNT_VALID;
+}
+
+/**
+ * @brief Type-dispatch functor launching the fused kernels for one group.
+ */
+struct fused_reduce_dispatch {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  void operator()(fused_reduce_group const& group,
+                  std::vector<std::unique_ptr<scalar>>& results,
+                  rmm::cuda_stream_view stream,
+                  rmm::mr::device_memory_resource* mr)
+  {
+    using SumType = typename fused_reduce_task<T>::SumType;
+
+    auto const num_tasks = static_cast<size_type>(group.kinds.size());
+    auto temp_mr         = cudf::get_temp_memory_resource();
+
+    auto const group_table = table_view{group.columns};
+    auto const d_group     = table_device_view::create(group_table, stream);
+
+    rmm::device_uvector<size_type> valid_counts(num_tasks, stream, temp_mr);
+
+    std::vector<fused_reduce_task<T>> tasks(num_tasks);
+    for (size_type i = 0; i < num_tasks; ++i) {
+      auto& task       = tasks[i];
+      task.source      = group.source[i];
+      task.kind        = group.kinds[i];
+      task.init        = task.kind == aggregation::MAX ? DeviceMax::identity<T>()
+                                                       : DeviceMin::identity<T>();
+      task.result      = nullptr;
+      task.sum_result  = nullptr;
+      task.valid_count = valid_counts.data() + i;
+
+      auto result = [&]() -> std::unique_ptr<scalar> {
+        switch (task.kind) {
+          case aggregation::SUM: {
+            auto s = make_default_constructed_scalar(
+              data_type{type_to_id<SumType>()}, stream, mr);
+            task.sum_result = static_cast<numeric_scalar<SumType>*>(s.get())->data();
+            return s;
+          }
+          case aggregation::COUNT_VALID: {
+            auto s = make_default_constructed_scalar(
+              data_type{type_to_id<size_type>()}, stream, mr);
+            // the running count is the result; write it in place
+            task.valid_count = static_cast<numeric_scalar<size_type>*>(s.get())->data();
+            return s;
+          }
+          default: {  // MIN or MAX
+            auto s      = make_default_constructed_scalar(data_type{type_to_id<T>()}, stream, mr);
+            task.result = static_cast<numeric_scalar<T>*>(s.get())->data();
+            return s;
+          }
+        }
+      }();
+      task.validity          = result->validity_data();
+      results[group.slots[i]] = std::move(result);
+    }
+    auto d_tasks = cudf::detail::make_device_uvector_async(tasks, stream, temp_mr);
+
+    auto const max_rows = std::max_element(group.columns.begin(),
+                                           group.columns.end(),
+                                           [](auto const& lhs, auto const& rhs) {
+                                             return lhs.size() < rhs.size();
+                                           })
+                            ->size();
+    auto const chunks =
+      std::max(size_type{1},
+               std::min(max_grid_chunks,
+                        util::div_rounding_up_safe<size_type>(max_rows, fused_block_size * 32)));
+
+    auto const init_blocks = util::div_rounding_up_safe(num_tasks, fused_block_size);
+    fused_reduce_init_kernel<T>
+      <<<init_blocks, fused_block_size, 0, stream.value()>>>(d_tasks.data(), num_tasks);
+    fused_reduce_kernel<T><<<dim3(num_tasks, chunks), fused_block_size, 0, stream.value()>>>(
+      *d_group, d_tasks.data(), num_tasks);
+    fused_reduce_finalize_kernel<T>
+      <<<init_blocks, fused_block_size, 0, stream.value()>>>(d_tasks.data(), num_tasks);
+    CHECK_CUDA(stream.value());
+  }
+
+  template <typename T, std::enable_if_t<!std::is_arithmetic<T>::value>* = nullptr>
+  void operator()(fused_reduce_group const&,
+                  std::vector<std::unique_ptr<scalar>>&,
+                  rmm::cuda_stream_view,
+                  rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Unexpected column type for fused reduction");
+  }
+};
+
+/**
+ * @brief True if the (column, aggregation) pair can go through the fused kernel.
+ */
+bool is_fusible(column_view const& col, aggregation::Kind k)
+{
+  return is_fusible_kind(k) && cudf::is_numeric(col.type()) &&
+         col.type().id() != type_id::BOOL8;
+}
+
+}  // namespace
+
+std::vector<std::unique_ptr<scalar>> reduce_multi(table_view const& input,
+                                                  std::vector<std::unique_ptr<aggregation>> const& aggs,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(not aggs.empty(), "reduce_multi requires at least one aggregation");
+
+  std::vector<std::unique_ptr<scalar>> results(input.num_columns() * aggs.size());
+  std::map<type_id, fused_reduce_group> groups;
+
+  for (size_type col_idx = 0; col_idx < input.num_columns(); ++col_idx) {
+    auto const col        = input.column(col_idx);
+    size_type group_source = -1;  // lazily add the column to its type's group
+    for (std::size_t agg_idx = 0; agg_idx < aggs.size(); ++agg_idx) {
+      auto const& agg = aggs[agg_idx];
+      auto const slot = static_cast<std::size_t>(col_idx) * aggs.size() + agg_idx;
+      if (is_fusible(col, agg->kind)) {
+        auto& group = groups[col.type().id()];
+        if (group_source < 0) {
+          group_source = static_cast<size_type>(group.columns.size());
+          group.columns.push_back(col);
+        }
+        group.source.push_back(group_source);
+        group.kinds.push_back(agg->kind);
+        group.slots.push_back(slot);
+      } else if (agg->kind == aggregation::COUNT_VALID) {
+        results[slot] =
+          make_fixed_width_scalar<size_type>(col.size() - col.null_count(), stream, mr);
+      } else if (agg->kind == aggregation::COUNT_ALL) {
+        results[slot] = make_fixed_width_scalar<size_type>(col.size(), stream, mr);
+      } else {
+        auto const output_dtype = cudf::detail::target_type(col.type(), agg->kind);
+        results[slot]           = cudf::detail::reduce(col, agg, output_dtype, stream, mr);
+      }
+    }
+  }
+
+  // one fused launch per distinct column type
+  for (auto& [type, group] : groups) {
+    type_dispatcher(data_type{type}, fused_reduce_dispatch{}, group, results, stream, mr);
+  }
+
+  return results;
+}
+
+}  // namespace detail
+
+std::vector<std::unique_ptr<scalar>> reduce_multi(table_view const& input,
+                                                  std::vector<std::unique_ptr<aggregation>> const& aggs,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce_multi(input, aggs, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
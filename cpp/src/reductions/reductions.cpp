@@ -14,14 +14,19 @@
  * limitations under the License.
  */
 
+#include <groupby/sort/group_reductions.hpp>
+
 #include <cudf/column/column.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/quantiles.hpp>
+#include <cudf/detail/reduction.hpp>
 #include <cudf/detail/reduction_functions.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/reduction.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 
@@ -97,6 +102,42 @@ struct reduce_dispatch_functor {
           stream,
           mr);
       } break;
+      case aggregation::TDIGEST: {
+        auto tdigest_agg = dynamic_cast<tdigest_aggregation const*>(agg.get());
+        // The whole column forms a single group: sort it (nulls last) and
+        // sketch the valid prefix. The result is a struct scalar holding the
+        // digest's centroid mean and weight lists.
+        auto sorted_indices = sorted_order(table_view{{col}}, {}, {null_order::AFTER}, stream, mr);
+        auto sorted         = detail::gather(table_view{{col}},
+                                     *sorted_indices,
+                                     out_of_bounds_policy::DONT_CHECK,
+                                     negative_index_policy::NOT_ALLOWED,
+                                     stream);
+        auto const valid_count   = col.size() - col.null_count();
+        auto const host_offsets  = std::vector<size_type>{0, col.size()};
+        auto const host_sizes    = std::vector<size_type>{valid_count};
+        auto const group_offsets = make_device_uvector_async(host_offsets, stream);
+        auto const group_sizes   = make_device_uvector_async(host_sizes, stream);
+        auto const sizes_view =
+          column_view(data_type{type_to_id<size_type>()}, 1, group_sizes.data());
+        auto digest = groupby::detail::group_tdigest(sorted->get_column(0).view(),
+                                                     sizes_view,
+                                                     group_offsets,
+                                                     1,
+                                                     tdigest_agg->_max_centroids,
+                                                     stream,
+                                                     mr);
+        return get_element(*digest, 0, stream, mr);
+      } break;
+      case aggregation::MERGE_TDIGEST: {
+        auto merge_agg = dynamic_cast<merge_tdigest_aggregation const*>(agg.get());
+        CUDF_EXPECTS(not col.has_nulls(), "MERGE_TDIGEST input digests must not be null");
+        auto const host_offsets  = std::vector<size_type>{0, col.size()};
+        auto const group_offsets = make_device_uvector_async(host_offsets, stream);
+        auto digest              = groupby::detail::group_merge_tdigest(
+          col, group_offsets, 1, merge_agg->_max_centroids, stream, mr);
+        return get_element(*digest, 0, stream, mr);
+      } break;
       case aggregation::NTH_ELEMENT: {
         auto nth_agg = dynamic_cast<nth_element_aggregation const*>(agg.get());
         return reduction::nth_element(col, nth_agg->_n, nth_agg->_null_handling, stream, mr);
@@ -106,12 +147,11 @@ struct reduce_dispatch_functor {
   }
 };
 
-std::unique_ptr<scalar> reduce(
-  column_view const& col,
-  std::unique_ptr<aggregation> const& agg,
-  data_type output_dtype,
-  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+std::unique_ptr<scalar> reduce(column_view const& col,
+                               std::unique_ptr<aggregation> const& agg,
+                               data_type output_dtype,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
 {
   // Returns default scalar if input column is non-valid. In terms of nested columns, we need to
   // handcraft the default scalar with input column.
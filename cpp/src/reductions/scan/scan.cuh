@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/utilities/device_operators.cuh>
 #include <cudf/reduction.hpp>
@@ -24,9 +25,48 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <thrust/tuple.h>
+
 namespace cudf {
 namespace detail {
 
+/**
+ * @brief Reads a scan element together with its validity.
+ *
+ * Null elements are replaced by the operator identity so they do not affect
+ * the scanned values; the validity travels alongside the value so the null
+ * mask can be produced by the same scan pass instead of separate mask passes.
+ */
+template <typename T>
+struct null_aware_value_accessor {
+  column_device_view const col;
+  T const identity;
+  bool const has_nulls;
+
+  __device__ thrust::tuple<T, bool> operator()(size_type i) const
+  {
+    bool const valid = !has_nulls || col.is_valid_nocheck(i);
+    return thrust::make_tuple(valid ? col.element<T>(i) : identity, valid);
+  }
+};
+
+/**
+ * @brief Scan operator over (value, validity) pairs.
+ *
+ * The value channel applies `Op` while the validity channel applies a
+ * logical-and, so the scanned validity of element `i` is true only while no
+ * null has been seen yet -- the `null_policy::INCLUDE` mask semantics.
+ */
+template <typename T, typename Op>
+struct null_aware_scan_op {
+  __device__ thrust::tuple<T, bool> operator()(thrust::tuple<T, bool> const& lhs,
+                                               thrust::tuple<T, bool> const& rhs) const
+  {
+    return thrust::make_tuple(Op{}(thrust::get<0>(lhs), thrust::get<0>(rhs)),
+                              thrust::get<1>(lhs) && thrust::get<1>(rhs));
+  }
+};
+
 // logical-and scan of the null mask of the input view
 rmm::device_buffer mask_scan(column_view const& input_view,
                              scan_type inclusive,
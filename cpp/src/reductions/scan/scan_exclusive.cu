@@ -21,11 +21,17 @@
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/null_mask.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/scan.h>
 
 namespace cudf {
@@ -78,6 +84,57 @@ struct scan_dispatcher {
   }
 };
 
+/**
+ * @brief Dispatcher for an exclusive scan fused with the `null_policy::INCLUDE` mask
+ *
+ * One scan pass over (value, validity) pairs produces both the scanned values
+ * and the scanned validity, replacing the separate mask passes of `mask_scan`
+ * (and its host synchronization on the first null position).
+ *
+ * @tparam Op device binary operator
+ */
+template <typename Op>
+struct null_aware_scan_dispatcher {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     null_policy,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    auto output_column =
+      detail::allocate_like(input, input.size(), mask_allocation_policy::NEVER, stream, mr);
+    mutable_column_view output = output_column->mutable_view();
+
+    auto d_input        = column_device_view::create(input, stream);
+    auto const identity = Op::template identity<T>();
+    rmm::device_uvector<bool> valids(input.size(), stream, cudf::get_temp_memory_resource());
+
+    auto const begin = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      null_aware_value_accessor<T>{*d_input, identity, input.has_nulls()});
+    auto const out = thrust::make_zip_iterator(thrust::make_tuple(output.data<T>(), valids.begin()));
+    thrust::exclusive_scan(rmm::exec_policy(stream),
+                           begin,
+                           begin + input.size(),
+                           out,
+                           thrust::make_tuple(identity, true),
+                           null_aware_scan_op<T, Op>{});
+
+    auto [null_mask, null_count] =
+      detail::valid_if(valids.begin(), valids.end(), thrust::identity<bool>{}, stream, mr);
+    if (null_count > 0) { output_column->set_null_mask(std::move(null_mask), null_count); }
+
+    CHECK_CUDA(stream.value());
+    return output_column;
+  }
+
+  template <typename T, typename... Args, std::enable_if_t<!std::is_arithmetic<T>::value>* = nullptr>
+  std::unique_ptr<column> operator()(Args&&...)
+  {
+    CUDF_FAIL("Non-arithmetic types not supported for null-aware exclusive scan");
+  }
+};
+
 }  // namespace
 
 std::unique_ptr<column> scan_exclusive(const column_view& input,
@@ -88,6 +145,13 @@ std::unique_ptr<column> scan_exclusive(const column_view& input,
 {
   CUDF_EXPECTS(agg->kind != aggregation::RANK && agg->kind != aggregation::DENSE_RANK,
                "Unsupported rank aggregation operator for exclusive scan");
+
+  // fused single-pass path: the scan carries validity through its state, so the
+  // INCLUDE null mask needs no separate mask passes over the input
+  if (null_handling == null_policy::INCLUDE && input.has_nulls() && is_numeric(input.type())) {
+    return scan_agg_dispatch<null_aware_scan_dispatcher>(input, agg, null_handling, stream, mr);
+  }
+
   auto output = scan_agg_dispatch<scan_dispatcher>(input, agg, null_handling, stream, mr);
 
   if (null_handling == null_policy::EXCLUDE) {
@@ -21,10 +21,12 @@
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/null_mask.hpp>
 #include <cudf/reduction.hpp>
 #include <cudf/strings/detail/gather.cuh>
 #include <cudf/table/row_operators.cuh>
+#include <cudf/utilities/temp_memory_resource.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
@@ -32,6 +34,9 @@
 
 #include <structs/utilities.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/scan.h>
 
 namespace cudf {
@@ -197,6 +202,52 @@ struct scan_dispatcher {
   }
 };
 
+/**
+ * @brief Dispatcher for a scan fused with the `null_policy::INCLUDE` mask
+ *
+ * One scan pass over (value, validity) pairs produces both the scanned values
+ * and the scanned validity, replacing the separate mask passes of `mask_scan`
+ * (and its host synchronization on the first null position).
+ *
+ * @tparam Op device binary operator
+ */
+template <typename Op>
+struct null_aware_scan_dispatcher {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     null_policy,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    auto output_column =
+      detail::allocate_like(input, input.size(), mask_allocation_policy::NEVER, stream, mr);
+    mutable_column_view result = output_column->mutable_view();
+
+    auto d_input = column_device_view::create(input, stream);
+    rmm::device_uvector<bool> valids(input.size(), stream, cudf::get_temp_memory_resource());
+
+    auto const begin = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      null_aware_value_accessor<T>{*d_input, Op::template identity<T>(), input.has_nulls()});
+    auto const out = thrust::make_zip_iterator(thrust::make_tuple(result.data<T>(), valids.begin()));
+    thrust::inclusive_scan(
+      rmm::exec_policy(stream), begin, begin + input.size(), out, null_aware_scan_op<T, Op>{});
+
+    auto [null_mask, null_count] =
+      detail::valid_if(valids.begin(), valids.end(), thrust::identity<bool>{}, stream, mr);
+    if (null_count > 0) { output_column->set_null_mask(std::move(null_mask), null_count); }
+
+    CHECK_CUDA(stream.value());
+    return output_column;
+  }
+
+  template <typename T, typename... Args, std::enable_if_t<!std::is_arithmetic<T>::value>* = nullptr>
+  std::unique_ptr<column> operator()(Args&&...)
+  {
+    CUDF_FAIL("Non-arithmetic types not supported for null-aware inclusive scan");
+  }
+};
+
 /**
  * @brief generate row ranks or dense ranks using a row comparison then scan the results
  *
@@ -299,6 +350,13 @@ std::unique_ptr<column> scan_inclusive(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
+  // fused single-pass path: the scan carries validity through its state, so the
+  // INCLUDE null mask needs no separate mask passes over the input
+  if (null_handling == null_policy::INCLUDE && input.has_nulls() && is_numeric(input.type()) &&
+      agg->kind != aggregation::RANK && agg->kind != aggregation::DENSE_RANK) {
+    return scan_agg_dispatch<null_aware_scan_dispatcher>(input, agg, null_handling, stream, mr);
+  }
+
   auto output = scan_agg_dispatch<scan_dispatcher>(input, agg, null_handling, stream, mr);
 
   if (agg->kind == aggregation::RANK || agg->kind == aggregation::DENSE_RANK) {
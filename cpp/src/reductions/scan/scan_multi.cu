@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "scan.cuh"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/scan.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/temp_memory_resource.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+
+#include <map>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Maps an element of the batched scan domain to its column.
+ *
+ * The domain concatenates the columns of one type group, so element `idx`
+ * belongs to column `idx / num_rows`. Used as the scan_by_key key so each
+ * column is scanned independently within a single launch.
+ */
+struct column_label_functor {
+  size_type num_rows;
+
+  __device__ size_type operator()(size_type idx) const { return idx / num_rows; }
+};
+
+/**
+ * @brief Reads an element of the batched scan domain with its validity.
+ *
+ * Null elements are replaced by the operator identity; the validity travels
+ * through the scan state to produce the `null_policy::INCLUDE` mask.
+ */
+template <typename T>
+struct multi_value_accessor {
+  table_device_view const d_table;
+  size_type num_rows;
+  T const identity;
+
+  __device__ thrust::tuple<T, bool> operator()(size_type idx) const
+  {
+    auto const col   = d_table.column(idx / num_rows);
+    auto const row   = idx % num_rows;
+    bool const valid = col.is_valid(row);
+    return thrust::make_tuple(valid ? col.element<T>(row) : identity, valid);
+  }
+};
+
+/**
+ * @brief Scans all columns of one type group through a single keyed scan.
+ *
+ * The group columns are laid out back to back in the scan domain with the
+ * column index as the key, so one scan_by_key launch computes every column's
+ * scan; the per-column results are then sliced out of the contiguous scratch.
+ */
+template <typename T, typename Op>
+std::vector<std::unique_ptr<column>> scan_group(table_view const& cols,
+                                                scan_type inclusive,
+                                                null_policy null_handling,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = cols.num_rows();
+  auto const num_cols = cols.num_columns();
+  auto temp_mr        = cudf::get_temp_memory_resource();
+
+  std::vector<std::unique_ptr<column>> results;
+  results.reserve(num_cols);
+  for (auto const& col : cols) {
+    results.push_back(detail::allocate_like(col, num_rows, mask_allocation_policy::NEVER, stream, mr));
+  }
+  if (num_rows == 0) { return results; }
+
+  auto const total    = num_cols * num_rows;
+  auto const identity = Op::template identity<T>();
+  auto const d_table  = table_device_view::create(cols, stream);
+
+  rmm::device_uvector<T> values(total, stream, temp_mr);
+  rmm::device_uvector<bool> valids(total, stream, temp_mr);
+
+  auto const keys = thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                    column_label_functor{num_rows});
+  auto const vals = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    multi_value_accessor<T>{*d_table, num_rows, identity});
+  auto const out = thrust::make_zip_iterator(thrust::make_tuple(values.begin(), valids.begin()));
+
+  if (inclusive == scan_type::INCLUSIVE) {
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                  keys,
+                                  keys + total,
+                                  vals,
+                                  out,
+                                  thrust::equal_to<size_type>{},
+                                  null_aware_scan_op<T, Op>{});
+  } else {
+    thrust::exclusive_scan_by_key(rmm::exec_policy(stream),
+                                  keys,
+                                  keys + total,
+                                  vals,
+                                  out,
+                                  thrust::make_tuple(identity, true),
+                                  thrust::equal_to<size_type>{},
+                                  null_aware_scan_op<T, Op>{});
+  }
+
+  for (size_type j = 0; j < num_cols; ++j) {
+    auto const col = cols.column(j);
+    CUDA_TRY(cudaMemcpyAsync(results[j]->mutable_view().data<T>(),
+                             values.data() + j * num_rows,
+                             num_rows * sizeof(T),
+                             cudaMemcpyDeviceToDevice,
+                             stream.value()));
+    if (null_handling == null_policy::EXCLUDE) {
+      if (col.nullable()) {
+        results[j]->set_null_mask(detail::copy_bitmask(col, stream, mr), col.null_count());
+      }
+    } else if (col.has_nulls()) {
+      auto [null_mask, null_count] = detail::valid_if(valids.begin() + j * num_rows,
+                                                      valids.begin() + (j + 1) * num_rows,
+                                                      thrust::identity<bool>{},
+                                                      stream,
+                                                      mr);
+      if (null_count > 0) { results[j]->set_null_mask(std::move(null_mask), null_count); }
+    }
+  }
+
+  CHECK_CUDA(stream.value());
+  return results;
+}
+
+/**
+ * @brief Type-dispatch functor selecting the operator for the aggregation kind.
+ */
+struct scan_multi_dispatch {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  std::vector<std::unique_ptr<column>> operator()(table_view const& cols,
+                                                  aggregation::Kind kind,
+                                                  scan_type inclusive,
+                                                  null_policy null_handling,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+  {
+    switch (kind) {
+      case aggregation::SUM:
+        return scan_group<T, DeviceSum>(cols, inclusive, null_handling, stream, mr);
+      case aggregation::PRODUCT:
+        return scan_group<T, DeviceProduct>(cols, inclusive, null_handling, stream, mr);
+      case aggregation::MIN:
+        return scan_group<T, DeviceMin>(cols, inclusive, null_handling, stream, mr);
+      case aggregation::MAX:
+        return scan_group<T, DeviceMax>(cols, inclusive, null_handling, stream, mr);
+      default: CUDF_FAIL("Unsupported aggregation operator for batched scan");
+    }
+  }
+
+  template <typename T, typename... Args, std::enable_if_t<!std::is_arithmetic<T>::value>* = nullptr>
+  std::vector<std::unique_ptr<column>> operator()(Args&&...)
+  {
+    CUDF_FAIL("Non-arithmetic types not supported for batched scan");
+  }
+};
+
+}  // namespace
+
+std::vector<std::unique_ptr<column>> scan_multi(table_view const& input,
+                                                std::unique_ptr<aggregation> const& agg,
+                                                scan_type inclusive,
+                                                null_policy null_handling,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  std::vector<std::unique_ptr<column>> results(input.num_columns());
+
+  // only these kinds have a keyed-scan operator; other kinds (e.g. rank scans)
+  // go through the regular per-column paths below
+  auto const batchable_kind = agg->kind == aggregation::SUM || agg->kind == aggregation::PRODUCT ||
+                              agg->kind == aggregation::MIN || agg->kind == aggregation::MAX;
+
+  // batch the numeric columns by type; everything else falls back per column
+  std::map<type_id, std::vector<size_type>> groups;
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const& col = input.column(i);
+    if (batchable_kind && is_numeric(col.type())) {
+      groups[col.type().id()].push_back(i);
+    } else {
+      results[i] = inclusive == scan_type::INCLUSIVE
+                     ? detail::scan_inclusive(col, agg, null_handling, stream, mr)
+                     : detail::scan_exclusive(col, agg, null_handling, stream, mr);
+    }
+  }
+
+  for (auto const& [type, indices] : groups) {
+    auto group_results = type_dispatcher(data_type{type},
+                                         scan_multi_dispatch{},
+                                         input.select(indices),
+                                         agg->kind,
+                                         inclusive,
+                                         null_handling,
+                                         stream,
+                                         mr);
+    for (std::size_t j = 0; j < indices.size(); ++j) {
+      results[indices[j]] = std::move(group_results[j]);
+    }
+  }
+
+  return results;
+}
+
+}  // namespace detail
+
+std::vector<std::unique_ptr<column>> scan_multi(table_view const& input,
+                                                std::unique_ptr<aggregation> const& agg,
+                                                scan_type inclusive,
+                                                null_policy null_handling,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::scan_multi(input, agg, inclusive, null_handling, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scatter.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Maps an element index to its segment through the offsets.
+ *
+ * Element `i` belongs to segment `s` where `offsets[s] <= i < offsets[s+1]`.
+ * The labels produced over ascending element indices are non-decreasing, as
+ * reduce_by_key requires; empty segments simply produce no labels.
+ */
+struct segment_label_functor {
+  size_type const* d_offsets;
+  size_type num_segments;
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    return static_cast<size_type>(thrust::distance(
+      d_offsets + 1,
+      thrust::upper_bound(thrust::seq, d_offsets + 1, d_offsets + num_segments + 1, idx)));
+  }
+};
+
+/**
+ * @brief Reads an element cast to the accumulation type, substituting the
+ * operator identity for nulls so they do not affect the reduction.
+ */
+template <typename InputType, typename AccType>
+struct null_replaced_cast_accessor {
+  column_device_view const col;
+  AccType const init;
+  bool const has_nulls;
+
+  __device__ AccType operator()(size_type i) const
+  {
+    return has_nulls && col.is_null_nocheck(i) ? init
+                                               : static_cast<AccType>(col.element<InputType>(i));
+  }
+};
+
+/**
+ * @brief Counts an element as 1 when valid, 0 when null.
+ */
+struct validity_accessor {
+  column_device_view const col;
+  bool const has_nulls;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    return has_nulls && col.is_null_nocheck(i) ? 0 : 1;
+  }
+};
+
+/**
+ * @brief Performs the segmented reduction for one input type and operator.
+ *
+ * One reduce_by_key pass computes the per-segment values and another the
+ * per-segment valid-element counts; both are scattered into `num_segments`
+ * slots since empty segments produce no reduce_by_key output.
+ */
+template <typename InputType, aggregation::Kind K, typename Op>
+std::unique_ptr<column> segmented_reduce_impl(column_view const& col,
+                                              column_view const& offsets,
+                                              data_type output_dtype,
+                                              null_policy null_handling,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  using AccType = cudf::detail::target_type_t<InputType, K>;
+
+  auto const num_segments = offsets.size() - 1;
+  auto const acc_type     = data_type{type_to_id<AccType>()};
+  auto temp_mr            = cudf::get_temp_memory_resource();
+
+  auto result =
+    make_fixed_width_column(acc_type, num_segments, mask_state::UNALLOCATED, stream, mr);
+  if (num_segments == 0) {
+    return output_dtype == acc_type ? std::move(result)
+                                    : cudf::detail::cast(result->view(), output_dtype, stream, mr);
+  }
+
+  auto const d_col     = column_device_view::create(col, stream);
+  auto const d_offsets = offsets.data<size_type>();
+  auto const identity  = Op::template identity<AccType>();
+  auto const labels    = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0), segment_label_functor{d_offsets, num_segments});
+
+  // reduce the segment values; empty segments yield no entry
+  rmm::device_uvector<size_type> out_labels(num_segments, stream, temp_mr);
+  rmm::device_uvector<AccType> out_values(num_segments, stream, temp_mr);
+  auto const values = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    null_replaced_cast_accessor<InputType, AccType>{*d_col, identity, col.has_nulls()});
+  auto const num_filled = thrust::distance(out_labels.begin(),
+                                           thrust::reduce_by_key(rmm::exec_policy(stream),
+                                                                 labels,
+                                                                 labels + col.size(),
+                                                                 values,
+                                                                 out_labels.begin(),
+                                                                 out_values.begin(),
+                                                                 thrust::equal_to<size_type>{},
+                                                                 Op{})
+                                             .first);
+
+  // reduce the per-segment valid-element counts for the null policy
+  rmm::device_uvector<size_type> counts(num_segments, stream, temp_mr);
+  thrust::fill(rmm::exec_policy(stream), counts.begin(), counts.end(), size_type{0});
+  rmm::device_uvector<size_type> out_counts(num_segments, stream, temp_mr);
+  auto const valids = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0), validity_accessor{*d_col, col.has_nulls()});
+  thrust::reduce_by_key(rmm::exec_policy(stream),
+                        labels,
+                        labels + col.size(),
+                        valids,
+                        thrust::make_discard_iterator(),
+                        out_counts.begin());
+
+  auto d_result = result->mutable_view().data<AccType>();
+  thrust::fill(rmm::exec_policy(stream), d_result, d_result + num_segments, identity);
+  thrust::scatter(rmm::exec_policy(stream),
+                  out_values.begin(),
+                  out_values.begin() + num_filled,
+                  out_labels.begin(),
+                  d_result);
+  thrust::scatter(rmm::exec_policy(stream),
+                  out_counts.begin(),
+                  out_counts.begin() + num_filled,
+                  out_labels.begin(),
+                  counts.begin());
+
+  auto const d_counts = counts.data();
+  auto const include  = null_handling == null_policy::INCLUDE;
+  auto [null_mask, null_count] =
+    cudf::detail::valid_if(thrust::make_counting_iterator<size_type>(0),
+                           thrust::make_counting_iterator<size_type>(num_segments),
+                           [d_counts, d_offsets, include] __device__(size_type i) {
+                             auto const segment_size = d_offsets[i + 1] - d_offsets[i];
+                             return include ? segment_size > 0 && d_counts[i] == segment_size
+                                            : d_counts[i] > 0;
+                           },
+                           stream,
+                           mr);
+  if (null_count > 0) { result->set_null_mask(std::move(null_mask), null_count); }
+
+  return output_dtype == acc_type ? std::move(result)
+                                  : cudf::detail::cast(result->view(), output_dtype, stream, mr);
+}
+
+/**
+ * @brief Type-dispatch functor selecting the operator for the aggregation kind.
+ */
+struct segmented_reduce_dispatch {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& col,
+                                     column_view const& offsets,
+                                     aggregation::Kind kind,
+                                     data_type output_dtype,
+                                     null_policy null_handling,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    switch (kind) {
+      case aggregation::SUM:
+        return segmented_reduce_impl<T, aggregation::SUM, DeviceSum>(
+          col, offsets, output_dtype, null_handling, stream, mr);
+      case aggregation::PRODUCT:
+        return segmented_reduce_impl<T, aggregation::PRODUCT, DeviceProduct>(
+          col, offsets, output_dtype, null_handling, stream, mr);
+      case aggregation::MIN:
+        return segmented_reduce_impl<T, aggregation::MIN, DeviceMin>(
+          col, offsets, output_dtype, null_handling, stream, mr);
+      case aggregation::MAX:
+        return segmented_reduce_impl<T, aggregation::MAX, DeviceMax>(
+          col, offsets, output_dtype, null_handling, stream, mr);
+      case aggregation::ANY:
+        return segmented_reduce_impl<T, aggregation::ANY, DeviceMax>(
+          col, offsets, output_dtype, null_handling, stream, mr);
+      case aggregation::ALL:
+        return segmented_reduce_impl<T, aggregation::ALL, DeviceMin>(
+          col, offsets, output_dtype, null_handling, stream, mr);
+      default: CUDF_FAIL("Unsupported aggregation for segmented reduction");
+    }
+  }
+
+  template <typename T, typename... Args, std::enable_if_t<!std::is_arithmetic<T>::value>* = nullptr>
+  std::unique_ptr<column> operator()(Args&&...)
+  {
+    CUDF_FAIL("Segmented reduction is only supported for numeric column types");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> segmented_reduce(column_view const& segmented_values,
+                                         column_view const& offsets,
+                                         std::unique_ptr<aggregation> const& agg,
+                                         data_type output_dtype,
+                                         null_policy null_handling,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(offsets.type() == data_type{type_to_id<size_type>()},
+               "Segment offsets must be of type INT32");
+  CUDF_EXPECTS(!offsets.has_nulls(), "Segment offsets must not have nulls");
+  CUDF_EXPECTS(offsets.size() >= 1, "Segment offsets must hold at least one value");
+
+  return type_dispatcher(segmented_values.type(),
+                         segmented_reduce_dispatch{},
+                         segmented_values,
+                         offsets,
+                         agg->kind,
+                         output_dtype,
+                         null_handling,
+                         stream,
+                         mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> segmented_reduce(column_view const& segmented_values,
+                                         column_view const& offsets,
+                                         std::unique_ptr<aggregation> const& agg,
+                                         data_type output_dtype,
+                                         null_policy null_handling,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_reduce(
+    segmented_values, offsets, agg, output_dtype, null_handling, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
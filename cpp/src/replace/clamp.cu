@@ -191,6 +191,71 @@ std::enable_if_t<cudf::is_fixed_width<T>(), std::unique_ptr<cudf::column>> clamp
   return output;
 }
 
+struct dispatch_normalize {
+  template <typename T, std::enable_if_t<cudf::is_numeric<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     scalar const& lo,
+                                     scalar const& hi,
+                                     scalar const& shift,
+                                     scalar const& scale,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    auto output =
+      detail::allocate_like(input, input.size(), mask_allocation_policy::NEVER, stream, mr);
+    // mask will not change
+    if (input.nullable()) { output->set_null_mask(copy_bitmask(input), input.null_count()); }
+
+    auto output_device_view =
+      cudf::mutable_column_device_view::create(output->mutable_view(), stream);
+    auto input_device_view = cudf::column_device_view::create(input, stream);
+
+    auto lo_itr    = make_optional_iterator<T>(lo, contains_nulls::YES{});
+    auto hi_itr    = make_optional_iterator<T>(hi, contains_nulls::YES{});
+    auto shift_itr = make_optional_iterator<T>(shift, contains_nulls::NO{});
+    auto scale_itr = make_optional_iterator<T>(scale, contains_nulls::NO{});
+    auto scalar_zip_itr =
+      thrust::make_zip_iterator(thrust::make_tuple(lo_itr, hi_itr, shift_itr, scale_itr));
+
+    auto trans = [] __device__(auto element_optional, auto scalar_tuple) {
+      auto element = element_optional.value_or(T{});
+      auto lo_optional = thrust::get<0>(scalar_tuple);
+      auto hi_optional = thrust::get<1>(scalar_tuple);
+      if (lo_optional.has_value() and (element < *lo_optional)) {
+        element = *lo_optional;
+      } else if (hi_optional.has_value() and (element > *hi_optional)) {
+        element = *hi_optional;
+      }
+
+      return static_cast<T>((element - *(thrust::get<2>(scalar_tuple))) /
+                            *(thrust::get<3>(scalar_tuple)));
+    };
+
+    auto input_pair_iterator =
+      make_optional_iterator<T>(*input_device_view, contains_nulls::DYNAMIC{}, input.has_nulls());
+    thrust::transform(rmm::exec_policy(stream),
+                      input_pair_iterator,
+                      input_pair_iterator + input.size(),
+                      scalar_zip_itr,
+                      output_device_view->begin<T>(),
+                      trans);
+
+    return output;
+  }
+
+  template <typename T, std::enable_if_t<not cudf::is_numeric<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     scalar const&,
+                                     scalar const&,
+                                     scalar const&,
+                                     scalar const&,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("normalize only supports numeric types");
+  }
+};
+
 template <typename T, typename OptionalScalarIterator, typename ReplaceScalarIterator>
 std::enable_if_t<std::is_same_v<T, string_view>, std::unique_ptr<cudf::column>> clamper(
   column_view const& input,
@@ -372,6 +437,38 @@ std::unique_ptr<column> clamp(
     input.type(), dispatch_clamp{}, input, lo, lo_replace, hi, hi_replace, stream, mr);
 }
 
+/**
+ * @copydoc cudf::normalize(column_view const& input,
+                                      scalar const& lo,
+                                      scalar const& hi,
+                                      scalar const& shift,
+                                      scalar const& scale,
+                                      rmm::mr::device_memory_resource* mr);
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> normalize(
+  column_view const& input,
+  scalar const& lo,
+  scalar const& hi,
+  scalar const& shift,
+  scalar const& scale,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  CUDF_EXPECTS(cudf::is_numeric(input.type()), "normalize only supports numeric types");
+  CUDF_EXPECTS(lo.type() == input.type() and hi.type() == input.type() and
+                 shift.type() == input.type() and scale.type() == input.type(),
+               "mismatching types of scalar and input");
+  CUDF_EXPECTS(shift.is_valid(stream), "shift can't be null");
+  CUDF_EXPECTS(scale.is_valid(stream), "scale can't be null");
+
+  if (input.is_empty()) { return std::make_unique<column>(input, stream, mr); }
+
+  return cudf::type_dispatcher(
+    input.type(), dispatch_normalize{}, input, lo, hi, shift, scale, stream, mr);
+}
+
 }  // namespace detail
 
 // clamp input at lo and hi with lo_replace and hi_replace
@@ -395,4 +492,16 @@ std::unique_ptr<column> clamp(column_view const& input,
   CUDF_FUNC_RANGE();
   return detail::clamp(input, lo, lo, hi, hi, rmm::cuda_stream_default, mr);
 }
+
+// fused clamp, shift, and scale of input
+std::unique_ptr<column> normalize(column_view const& input,
+                                  scalar const& lo,
+                                  scalar const& hi,
+                                  scalar const& shift,
+                                  scalar const& scale,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::normalize(input, lo, hi, shift, scale, rmm::cuda_stream_default, mr);
+}
 }  // namespace cudf
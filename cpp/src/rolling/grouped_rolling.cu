@@ -297,21 +297,19 @@ std::unique_ptr<column> expand_to_column(Calculator const& calc,
   return window_column;
 }
 
-/// Range window computation, with
+/// Per-row window-bounds columns for range windows, with
 ///   1. no grouping keys specified
 ///   2. rows in ASCENDING order.
 /// Treat as one single group.
 template <typename T>
-std::unique_ptr<column> range_window_ASC(column_view const& input,
-                                         column_view const& orderby_column,
-                                         T preceding_window,
-                                         bool preceding_window_is_unbounded,
-                                         T following_window,
-                                         bool following_window_is_unbounded,
-                                         size_type min_periods,
-                                         rolling_aggregation const& aggr,
-                                         rmm::cuda_stream_view stream,
-                                         rmm::mr::device_memory_resource* mr)
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> range_window_ASC(
+  column_view const& orderby_column,
+  T preceding_window,
+  bool preceding_window_is_unbounded,
+  T following_window,
+  bool following_window_is_unbounded,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
 {
   auto [h_nulls_begin_idx, h_nulls_end_idx] = get_null_bounds_for_orderby_column(orderby_column);
 
@@ -347,12 +345,12 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
            1;  // Add 1, for `preceding` to account for current row.
   };
 
-  auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
+  auto preceding_column = expand_to_column(preceding_calculator, orderby_column.size(), stream, mr);
 
   auto following_calculator =
     [nulls_begin_idx = h_nulls_begin_idx,
      nulls_end_idx   = h_nulls_end_idx,
-     num_rows        = input.size(),
+     num_rows        = orderby_column.size(),
      d_orderby       = orderby_column.data<T>(),
      following_window,
      following_window_is_unbounded] __device__(size_type idx) -> size_type {
@@ -378,10 +376,9 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
            1;
   };
 
-  auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
+  auto following_column = expand_to_column(following_calculator, orderby_column.size(), stream, mr);
 
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
 // Given an orderby column grouped as specified in group_offsets,
@@ -462,20 +459,18 @@ get_null_bounds_for_orderby_column(column_view const& orderby_column,
   }
 }
 
-// Range window computation, for orderby column in ASCENDING order.
+// Per-row window-bounds columns for range windows, for orderby column in ASCENDING order.
 template <typename T>
-std::unique_ptr<column> range_window_ASC(column_view const& input,
-                                         column_view const& orderby_column,
-                                         rmm::device_uvector<cudf::size_type> const& group_offsets,
-                                         rmm::device_uvector<cudf::size_type> const& group_labels,
-                                         T preceding_window,
-                                         bool preceding_window_is_unbounded,
-                                         T following_window,
-                                         bool following_window_is_unbounded,
-                                         size_type min_periods,
-                                         rolling_aggregation const& aggr,
-                                         rmm::cuda_stream_view stream,
-                                         rmm::mr::device_memory_resource* mr)
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> range_window_ASC(
+  column_view const& orderby_column,
+  rmm::device_uvector<cudf::size_type> const& group_offsets,
+  rmm::device_uvector<cudf::size_type> const& group_labels,
+  T preceding_window,
+  bool preceding_window_is_unbounded,
+  T following_window,
+  bool following_window_is_unbounded,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
 {
   auto [null_start, null_end] =
     get_null_bounds_for_orderby_column(orderby_column, group_offsets, stream);
@@ -518,7 +513,7 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
            1;  // Add 1, for `preceding` to account for current row.
   };
 
-  auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
+  auto preceding_column = expand_to_column(preceding_calculator, orderby_column.size(), stream, mr);
 
   auto following_calculator =
     [d_group_offsets = group_offsets.data(),
@@ -531,7 +526,7 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
     auto group_label = d_group_labels[idx];
     auto group_start = d_group_offsets[group_label];
     auto group_end   = d_group_offsets[group_label + 1];  // Cannot fall off the end, since offsets
-                                                          // is capped with `input.size()`.
+                                                          // is capped with the number of rows.
     auto nulls_begin = d_nulls_begin[group_label];
     auto nulls_end   = d_nulls_end[group_label];
 
@@ -559,27 +554,24 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
            1;
   };
 
-  auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
+  auto following_column = expand_to_column(following_calculator, orderby_column.size(), stream, mr);
 
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
-/// Range window computation, with
+/// Per-row window-bounds columns for range windows, with
 ///   1. no grouping keys specified
 ///   2. rows in DESCENDING order.
 /// Treat as one single group.
 template <typename T>
-std::unique_ptr<column> range_window_DESC(column_view const& input,
-                                          column_view const& orderby_column,
-                                          T preceding_window,
-                                          bool preceding_window_is_unbounded,
-                                          T following_window,
-                                          bool following_window_is_unbounded,
-                                          size_type min_periods,
-                                          rolling_aggregation const& aggr,
-                                          rmm::cuda_stream_view stream,
-                                          rmm::mr::device_memory_resource* mr)
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> range_window_DESC(
+  column_view const& orderby_column,
+  T preceding_window,
+  bool preceding_window_is_unbounded,
+  T following_window,
+  bool following_window_is_unbounded,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
 {
   auto [h_nulls_begin_idx, h_nulls_end_idx] = get_null_bounds_for_orderby_column(orderby_column);
 
@@ -617,12 +609,12 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
            1;  // Add 1, for `preceding` to account for current row.
   };
 
-  auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
+  auto preceding_column = expand_to_column(preceding_calculator, orderby_column.size(), stream, mr);
 
   auto following_calculator =
     [nulls_begin_idx = h_nulls_begin_idx,
      nulls_end_idx   = h_nulls_end_idx,
-     num_rows        = input.size(),
+     num_rows        = orderby_column.size(),
      d_orderby       = orderby_column.data<T>(),
      following_window,
      following_window_is_unbounded] __device__(size_type idx) -> size_type {
@@ -651,26 +643,23 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
            1;
   };
 
-  auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
+  auto following_column = expand_to_column(following_calculator, orderby_column.size(), stream, mr);
 
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
-// Range window computation, for rows in DESCENDING order.
+// Per-row window-bounds columns for range windows, for rows in DESCENDING order.
 template <typename T>
-std::unique_ptr<column> range_window_DESC(column_view const& input,
-                                          column_view const& orderby_column,
-                                          rmm::device_uvector<cudf::size_type> const& group_offsets,
-                                          rmm::device_uvector<cudf::size_type> const& group_labels,
-                                          T preceding_window,
-                                          bool preceding_window_is_unbounded,
-                                          T following_window,
-                                          bool following_window_is_unbounded,
-                                          size_type min_periods,
-                                          rolling_aggregation const& aggr,
-                                          rmm::cuda_stream_view stream,
-                                          rmm::mr::device_memory_resource* mr)
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> range_window_DESC(
+  column_view const& orderby_column,
+  rmm::device_uvector<cudf::size_type> const& group_offsets,
+  rmm::device_uvector<cudf::size_type> const& group_labels,
+  T preceding_window,
+  bool preceding_window_is_unbounded,
+  T following_window,
+  bool following_window_is_unbounded,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
 {
   auto [null_start, null_end] =
     get_null_bounds_for_orderby_column(orderby_column, group_offsets, stream);
@@ -715,7 +704,7 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
            1;  // Add 1, for `preceding` to account for current row.
   };
 
-  auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
+  auto preceding_column = expand_to_column(preceding_calculator, orderby_column.size(), stream, mr);
 
   auto following_calculator =
     [d_group_offsets = group_offsets.data(),
@@ -758,27 +747,19 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
            1;
   };
 
-  auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
+  auto following_column = expand_to_column(following_calculator, orderby_column.size(), stream, mr);
 
-  if (aggr.kind == aggregation::CUDA || aggr.kind == aggregation::PTX) {
-    CUDF_FAIL("Ranged rolling window does NOT (yet) support UDF.");
-  } else {
-    return cudf::detail::rolling_window(
-      input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
-  }
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
 template <typename OrderByT>
-std::unique_ptr<column> grouped_range_rolling_window_impl(
-  column_view const& input,
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> grouped_range_window_bounds_impl(
   column_view const& orderby_column,
   cudf::order const& timestamp_ordering,
   rmm::device_uvector<cudf::size_type> const& group_offsets,
   rmm::device_uvector<cudf::size_type> const& group_labels,
   range_window_bounds const& preceding_window,
   range_window_bounds const& following_window,
-  size_type min_periods,
-  rolling_aggregation const& aggr,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
@@ -786,58 +767,46 @@ std::unique_ptr<column> grouped_range_rolling_window_impl(
   auto following_value = detail::range_comparable_value<OrderByT>(following_window);
 
   if (timestamp_ordering == cudf::order::ASCENDING) {
-    return group_offsets.is_empty() ? range_window_ASC(input,
-                                                       orderby_column,
+    return group_offsets.is_empty() ? range_window_ASC(orderby_column,
                                                        preceding_value,
                                                        preceding_window.is_unbounded(),
                                                        following_value,
                                                        following_window.is_unbounded(),
-                                                       min_periods,
-                                                       aggr,
                                                        stream,
                                                        mr)
-                                    : range_window_ASC(input,
-                                                       orderby_column,
+                                    : range_window_ASC(orderby_column,
                                                        group_offsets,
                                                        group_labels,
                                                        preceding_value,
                                                        preceding_window.is_unbounded(),
                                                        following_value,
                                                        following_window.is_unbounded(),
-                                                       min_periods,
-                                                       aggr,
                                                        stream,
                                                        mr);
   } else {
-    return group_offsets.is_empty() ? range_window_DESC(input,
-                                                        orderby_column,
+    return group_offsets.is_empty() ? range_window_DESC(orderby_column,
                                                         preceding_value,
                                                         preceding_window.is_unbounded(),
                                                         following_value,
                                                         following_window.is_unbounded(),
-                                                        min_periods,
-                                                        aggr,
                                                         stream,
                                                         mr)
-                                    : range_window_DESC(input,
-                                                        orderby_column,
+                                    : range_window_DESC(orderby_column,
                                                         group_offsets,
                                                         group_labels,
                                                         preceding_value,
                                                         preceding_window.is_unbounded(),
                                                         following_value,
                                                         following_window.is_unbounded(),
-                                                        min_periods,
-                                                        aggr,
                                                         stream,
                                                         mr);
   }
 }
 
-struct dispatch_grouped_range_rolling_window {
+struct dispatch_grouped_range_window_bounds {
   template <typename OrderByColumnType, typename... Args>
   std::enable_if_t<!detail::is_supported_order_by_column_type<OrderByColumnType>(),
-                   std::unique_ptr<column>>
+                   std::pair<std::unique_ptr<column>, std::unique_ptr<column>>>
   operator()(Args&&...) const
   {
     CUDF_FAIL("Unsupported OrderBy column type.");
@@ -845,33 +814,67 @@ struct dispatch_grouped_range_rolling_window {
 
   template <typename OrderByColumnType>
   std::enable_if_t<detail::is_supported_order_by_column_type<OrderByColumnType>(),
-                   std::unique_ptr<column>>
-  operator()(column_view const& input,
-             column_view const& orderby_column,
+                   std::pair<std::unique_ptr<column>, std::unique_ptr<column>>>
+  operator()(column_view const& orderby_column,
              cudf::order const& timestamp_ordering,
              rmm::device_uvector<cudf::size_type> const& group_offsets,
              rmm::device_uvector<cudf::size_type> const& group_labels,
              range_window_bounds const& preceding_window,
              range_window_bounds const& following_window,
-             size_type min_periods,
-             rolling_aggregation const& aggr,
              rmm::cuda_stream_view stream,
              rmm::mr::device_memory_resource* mr) const
   {
-    return grouped_range_rolling_window_impl<OrderByColumnType>(input,
-                                                                orderby_column,
-                                                                timestamp_ordering,
-                                                                group_offsets,
-                                                                group_labels,
-                                                                preceding_window,
-                                                                following_window,
-                                                                min_periods,
-                                                                aggr,
-                                                                stream,
-                                                                mr);
+    return grouped_range_window_bounds_impl<OrderByColumnType>(orderby_column,
+                                                               timestamp_ordering,
+                                                               group_offsets,
+                                                               group_labels,
+                                                               preceding_window,
+                                                               following_window,
+                                                               stream,
+                                                               mr);
   }
 };
 
+/**
+ * @brief Computes the per-row preceding/following window-bounds columns for a
+ * grouped range-rolling query.
+ *
+ * Groups the keys, locates per-group null ranges in the order-by column and
+ * runs the per-row bound searches — all the window work that is independent
+ * of the aggregated values, so callers applying several aggregations over the
+ * same windows need pay for it only once.
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> make_grouped_range_window_bounds(
+  table_view const& group_keys,
+  column_view const& order_by_column,
+  cudf::order const& order,
+  range_window_bounds const& preceding,
+  range_window_bounds const& following,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
+  using index_vector        = sort_groupby_helper::index_vector;
+
+  index_vector group_offsets(0, stream), group_labels(0, stream);
+  if (group_keys.num_columns() > 0) {
+    sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES};
+    group_offsets = index_vector(helper.group_offsets(stream), stream);
+    group_labels  = index_vector(helper.group_labels(stream), stream);
+  }
+
+  return cudf::type_dispatcher(order_by_column.type(),
+                               dispatch_grouped_range_window_bounds{},
+                               order_by_column,
+                               order,
+                               group_offsets,
+                               group_labels,
+                               preceding,
+                               following,
+                               stream,
+                               mr);
+}
+
 /**
  * @brief Functor to convert from size_type (number of days) to appropriate duration type.
  */
@@ -976,29 +979,13 @@ std::unique_ptr<column> grouped_range_rolling_window(table_view const& group_key
 
   CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
 
-  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
-  using index_vector        = sort_groupby_helper::index_vector;
+  // The bounds columns are intermediates of this one call; allocate them with
+  // the default resource
+  auto [preceding_column, following_column] = make_grouped_range_window_bounds(
+    group_keys, order_by_column, order, preceding, following, stream, rmm::mr::get_current_device_resource());
 
-  index_vector group_offsets(0, stream), group_labels(0, stream);
-  if (group_keys.num_columns() > 0) {
-    sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES};
-    group_offsets = index_vector(helper.group_offsets(stream), stream);
-    group_labels  = index_vector(helper.group_labels(stream), stream);
-  }
-
-  return cudf::type_dispatcher(order_by_column.type(),
-                               dispatch_grouped_range_rolling_window{},
-                               input,
-                               order_by_column,
-                               order,
-                               group_offsets,
-                               group_labels,
-                               preceding,
-                               following,
-                               min_periods,
-                               aggr,
-                               stream,
-                               mr);
+  return cudf::detail::rolling_window(
+    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
 }
 
 }  // namespace detail
@@ -1112,4 +1099,53 @@ std::unique_ptr<column> grouped_range_rolling_window(table_view const& group_key
                                               mr);
 }
 
+grouped_range_rolling::grouped_range_rolling(table_view const& group_keys,
+                                             column_view const& orderby_column,
+                                             cudf::order const& order,
+                                             range_window_bounds const& preceding,
+                                             range_window_bounds const& following,
+                                             size_type min_periods)
+  : _min_periods{min_periods}, _num_rows{orderby_column.size()}
+{
+  CUDF_FUNC_RANGE();
+
+  CUDF_EXPECTS((group_keys.num_columns() == 0 || group_keys.num_rows() == orderby_column.size()),
+               "Size mismatch between group_keys and order-by column.");
+
+  CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
+
+  if (_num_rows == 0) { return; }
+
+  // The bounds columns are internal state; allocate them with the default resource
+  std::tie(_preceding, _following) = make_grouped_range_window_bounds(group_keys,
+                                                                      orderby_column,
+                                                                      order,
+                                                                      preceding,
+                                                                      following,
+                                                                      rmm::cuda_stream_default,
+                                                                      rmm::mr::get_current_device_resource());
+}
+
+grouped_range_rolling::~grouped_range_rolling() = default;
+
+std::unique_ptr<column> grouped_range_rolling::aggregate(column_view const& input,
+                                                         rolling_aggregation const& aggr,
+                                                         rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+
+  if (input.is_empty()) { return cudf::detail::empty_output_for_rolling_aggregation(input, aggr); }
+
+  CUDF_EXPECTS(input.size() == _num_rows,
+               "Size mismatch between input and the order-by column used at construction.");
+
+  return cudf::detail::rolling_window(input,
+                                      _preceding->view(),
+                                      _following->view(),
+                                      _min_periods,
+                                      aggr,
+                                      rmm::cuda_stream_default,
+                                      mr);
+}
+
 }  // namespace cudf
@@ -103,6 +103,77 @@ __global__ void gpu_rolling_new(cudf::size_type nrows,
   if (0 == cudf::intra_word_index(threadIdx.x)) { atomicAdd(output_valid_count, warp_valid_count); }
 }
 
+/**
+ * @brief Rolling UDF kernel specialized for a fixed window known at compile time.
+ *
+ * The window bounds are template arguments, so the kernel name embeds them and
+ * every distinct window size gets its own entry in the JIT program cache. The
+ * window elements are staged into a fixed-size local array with an unrolled
+ * loop; for the small windows this kernel is selected for (size <= 32 after
+ * inlining the UDF) the array stays in registers instead of re-reading global
+ * memory inside the aggregation loop.
+ */
+template <typename InType,
+          typename OutType,
+          class agg_op,
+          cudf::size_type preceding_window,
+          cudf::size_type following_window>
+__global__ void gpu_rolling_fixed_window(cudf::size_type nrows,
+                                         InType const* const __restrict__ in_col,
+                                         cudf::bitmask_type const* const __restrict__ in_col_valid,
+                                         OutType* __restrict__ out_col,
+                                         cudf::bitmask_type* __restrict__ out_col_valid,
+                                         cudf::size_type* __restrict__ output_valid_count,
+                                         cudf::size_type min_periods)
+{
+  constexpr cudf::size_type window_size = preceding_window + following_window;
+
+  cudf::size_type i      = blockIdx.x * blockDim.x + threadIdx.x;
+  cudf::size_type stride = blockDim.x * gridDim.x;
+
+  cudf::size_type warp_valid_count{0};
+
+  auto active_threads = __ballot_sync(0xffffffff, i < nrows);
+  while (i < nrows) {
+    // compute bounds; the window extent itself is a compile-time constant
+    cudf::size_type start       = min(nrows, max(0, i - preceding_window + 1));
+    cudf::size_type end         = min(nrows, max(0, i + following_window + 1));
+    cudf::size_type start_index = min(start, end);
+    cudf::size_type end_index   = max(start, end);
+    cudf::size_type count       = end_index - start_index;
+
+    // stage the window into registers with an unrolled, bounds-checked copy
+    InType window_data[window_size];
+#pragma unroll
+    for (cudf::size_type j = 0; j < window_size; ++j) {
+      window_data[j] = (j < count) ? in_col[start_index + j] : InType{};
+    }
+
+    OutType val = agg_op::template operate<OutType, InType>(window_data, 0, count);
+
+    // check if we have enough input samples
+    bool output_is_valid = (count >= min_periods);
+
+    // set the mask
+    const unsigned int result_mask = __ballot_sync(active_threads, output_is_valid);
+
+    // store the output value, one per thread
+    if (output_is_valid) { out_col[i] = val; }
+
+    // only one thread writes the mask
+    if (0 == cudf::intra_word_index(i)) {
+      out_col_valid[cudf::word_index(i)] = result_mask;
+      warp_valid_count += __popc(result_mask);
+    }
+
+    // process next element
+    i += stride;
+    active_threads = __ballot_sync(active_threads, i < nrows);
+  }
+
+  if (0 == cudf::intra_word_index(threadIdx.x)) { atomicAdd(output_valid_count, warp_valid_count); }
+}
+
 }  // namespace jit
 }  // namespace rolling
 }  // namespace cudf
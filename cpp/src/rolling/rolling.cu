@@ -16,6 +16,7 @@
 
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include "rolling_detail.cuh"
+#include "rolling_scan_detail.cuh"
 
 namespace cudf {
 namespace detail {
@@ -50,6 +51,19 @@ std::unique_ptr<column> rolling_window(column_view const& input,
                                             stream,
                                             mr);
   } else {
+    // Wide fixed windows of supported aggregations are answered from prefix
+    // scans in O(n) instead of iterating every window in full
+    if (default_outputs.is_empty() and
+        can_use_scan_rolling(input, preceding_window, following_window, agg)) {
+      return cudf::detail::scan_based_rolling_window(input,
+                                                     preceding_window,
+                                                     following_window,
+                                                     std::max(min_periods, 0),
+                                                     agg,
+                                                     stream,
+                                                     mr);
+    }
+
     auto preceding_window_begin = thrust::make_constant_iterator(preceding_window);
     auto following_window_begin = thrust::make_constant_iterator(following_window);
 
@@ -1180,6 +1180,46 @@ std::unique_ptr<column> rolling_window_udf(column_view const& input,
   auto output_view = output->mutable_view();
   rmm::device_scalar<size_type> device_valid_count{0, stream};
 
+  // Small fixed windows get a kernel specialized on the window extent: the
+  // sizes are template arguments, so they are part of the kernel name and each
+  // distinct window is compiled once and then served from the program cache,
+  // while the staged window stays in registers instead of re-reading global
+  // memory inside the UDF loop.
+  constexpr bool is_fixed_window = std::is_same_v<PrecedingWindowIterator, size_type> and
+                                   std::is_same_v<FollowingWindowIterator, size_type>;
+  if constexpr (is_fixed_window) {
+    constexpr size_type max_register_window = 32;
+    if (preceding_window >= 0 and following_window >= 0 and
+        preceding_window + following_window > 0 and
+        preceding_window + following_window <= max_register_window) {
+      std::string fixed_kernel_name =
+        jitify2::reflection::Template("cudf::rolling::jit::gpu_rolling_fixed_window")  //
+          .instantiate(cudf::jit::get_type_name(input.type()),  // list of template arguments
+                       cudf::jit::get_type_name(output->type()),
+                       udf_agg._operator_name,
+                       std::to_string(preceding_window),
+                       std::to_string(following_window));
+
+      cudf::jit::get_program_cache(*rolling_jit_kernel_cu_jit)
+        .get_kernel(
+          fixed_kernel_name, {}, {{"rolling/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})  //
+        ->configure_1d_max_occupancy(0, 0, 0, stream.value())                                       //
+        ->launch(input.size(),
+                 cudf::jit::get_data_ptr(input),
+                 input.null_mask(),
+                 cudf::jit::get_data_ptr(output_view),
+                 output_view.null_mask(),
+                 device_valid_count.data(),
+                 min_periods);
+
+      output->set_null_count(output->size() - device_valid_count.value(stream));
+
+      CHECK_CUDA(stream.value());
+
+      return output;
+    }
+  }
+
   std::string kernel_name =
     jitify2::reflection::Template("cudf::rolling::jit::gpu_rolling_new")  //
       .instantiate(cudf::jit::get_type_name(input.type()),  // list of template arguments
@@ -0,0 +1,501 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/tabulate.h>
+
+#include <memory>
+
+namespace cudf {
+
+namespace detail {
+
+namespace {  // anonymous
+
+/**
+ * @file rolling_scan_detail.cuh
+ * @brief Prefix-scan based fast paths for fixed-size rolling windows.
+ *
+ * The generic rolling kernel iterates every window in full, `O(n * w)` work
+ * for window width `w`. For wide windows the aggregations below can instead
+ * be answered from `O(n)` precomputed running state:
+ *  - COUNT_VALID/COUNT_ALL and integral SUM/MEAN from prefix sums, each
+ *    window being the difference of two prefix values
+ *  - MIN/MAX from per-block forward/backward running extrema (the
+ *    van Herk/Gil-Werman transform), each full-width window being the
+ *    combination of one suffix and one prefix value
+ */
+
+/// Window width below which the generic kernel's direct iteration is cheaper
+/// than materializing prefix state.
+constexpr size_type scan_rolling_minimum_window = 64;
+
+struct window_range {
+  size_type start;
+  size_type end;
+};
+
+/// Computes a row's window bounds exactly as the generic `gpu_rolling` kernel.
+struct window_bounds_fn {
+  size_type num_rows;
+  size_type preceding;
+  size_type following;
+
+  __device__ window_range operator()(size_type i) const
+  {
+    auto const start = min(num_rows, max(0, i - preceding + 1));
+    auto const end   = min(num_rows, max(0, i + following + 1));
+    return {min(start, end), max(start, end)};
+  }
+};
+
+/// Number of valid observations in a row's window; `valid_prefix` may be null
+/// when the input has no nulls.
+struct window_valid_count_fn {
+  window_bounds_fn bounds;
+  size_type const* __restrict__ valid_prefix;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    auto const window = bounds(i);
+    return valid_prefix == nullptr ? window.end - window.start
+                                   : valid_prefix[window.end] - valid_prefix[window.start];
+  }
+};
+
+struct count_at_least_fn {
+  window_valid_count_fn count;
+  size_type min_periods;
+
+  __device__ bool operator()(size_type i) const { return count(i) >= min_periods; }
+};
+
+/// Reads element `i` as `SumType`, substituting 0 for nulls
+template <typename InputType, typename SumType>
+struct null_as_zero_fn {
+  column_device_view input;
+  bool has_nulls;
+
+  __device__ SumType operator()(size_type i) const
+  {
+    return (has_nulls and input.is_null_nocheck(i))
+             ? SumType{0}
+             : static_cast<SumType>(input.element<device_storage_type_t<InputType>>(i));
+  }
+};
+
+struct valid_one_fn {
+  column_device_view input;
+
+  __device__ size_type operator()(size_type i) const { return input.is_valid_nocheck(i); }
+};
+
+/**
+ * @brief Builds the `n + 1` element prefix array of per-row valid counts.
+ */
+inline rmm::device_uvector<size_type> make_valid_count_prefix(column_device_view const& d_input,
+                                                              size_type num_rows,
+                                                              rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<size_type> prefix(num_rows + 1, stream);
+  prefix.set_element_to_zero_async(0, stream);
+  auto const valid_it = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0), valid_one_fn{d_input});
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), valid_it, valid_it + num_rows, prefix.begin() + 1);
+  return prefix;
+}
+
+/// Attaches the `count >= min_periods` null mask the generic kernel would produce
+inline void set_count_validity(column& output,
+                               window_valid_count_fn count,
+                               size_type min_periods,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  auto [mask, null_count] =
+    cudf::detail::valid_if(thrust::make_counting_iterator<size_type>(0),
+                           thrust::make_counting_iterator<size_type>(output.size()),
+                           count_at_least_fn{count, min_periods},
+                           stream,
+                           mr);
+  output.set_null_mask(std::move(mask), null_count);
+}
+
+template <aggregation::Kind op, typename SumType, typename OutputType>
+struct sum_window_fn {
+  window_bounds_fn bounds;
+  SumType const* __restrict__ sum_prefix;
+  size_type const* __restrict__ valid_prefix;
+
+  __device__ OutputType operator()(size_type i) const
+  {
+    auto const window = bounds(i);
+    auto const sum    = sum_prefix[window.end] - sum_prefix[window.start];
+    if (op == aggregation::MEAN) {
+      auto const count = valid_prefix == nullptr
+                           ? window.end - window.start
+                           : valid_prefix[window.end] - valid_prefix[window.start];
+      return static_cast<OutputType>(sum) / count;
+    }
+    return static_cast<OutputType>(sum);
+  }
+};
+
+/**
+ * @brief Launches scan-based SUM/MEAN. Restricted to integral inputs, where
+ * the prefix-difference is exact; floating point inputs keep the generic
+ * kernel's per-window summation order.
+ */
+template <aggregation::Kind op>
+struct scan_sum_launcher {
+  template <typename InputType,
+            std::enable_if_t<std::is_integral<InputType>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     size_type preceding,
+                                     size_type following,
+                                     size_type min_periods,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    using SumType    = cudf::detail::target_type_t<InputType, aggregation::SUM>;
+    using OutputType = cudf::detail::target_type_t<InputType, op>;
+
+    auto const num_rows = input.size();
+    auto const d_input  = column_device_view::create(input, stream);
+    auto const bounds   = window_bounds_fn{num_rows, preceding, following};
+
+    rmm::device_uvector<SumType> sum_prefix(num_rows + 1, stream);
+    sum_prefix.set_element_to_zero_async(0, stream);
+    auto const value_it =
+      thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                      null_as_zero_fn<InputType, SumType>{*d_input, input.has_nulls()});
+    thrust::inclusive_scan(
+      rmm::exec_policy(stream), value_it, value_it + num_rows, sum_prefix.begin() + 1);
+
+    auto valid_prefix = input.has_nulls() ? make_valid_count_prefix(*d_input, num_rows, stream)
+                                          : rmm::device_uvector<size_type>(0, stream);
+    auto const d_valid_prefix = input.has_nulls() ? valid_prefix.data() : nullptr;
+
+    auto output = make_fixed_width_column(cudf::detail::target_type(input.type(), op),
+                                          num_rows,
+                                          mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+    thrust::tabulate(rmm::exec_policy(stream),
+                     output->mutable_view().template begin<OutputType>(),
+                     output->mutable_view().template end<OutputType>(),
+                     sum_window_fn<op, SumType, OutputType>{bounds, sum_prefix.data(), d_valid_prefix});
+
+    set_count_validity(
+      *output, window_valid_count_fn{bounds, d_valid_prefix}, min_periods, stream, mr);
+    return output;
+  }
+
+  template <typename InputType,
+            std::enable_if_t<not std::is_integral<InputType>::value>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     size_type,
+                                     size_type,
+                                     size_type,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Scan-based rolling SUM/MEAN supports only integral types");
+  }
+};
+
+/**
+ * @brief Fills per-block forward and backward running extrema with block size
+ * equal to the window width; any full-width window is then the combination of
+ * one `suffix` and one `prefix` entry. Nulls contribute the identity.
+ */
+template <typename StorageType, typename AggOp>
+struct block_extrema_fn {
+  column_device_view input;
+  bool has_nulls;
+  StorageType* __restrict__ prefix;
+  StorageType* __restrict__ suffix;
+  size_type width;
+  size_type num_rows;
+
+  __device__ StorageType value_or_identity(size_type i) const
+  {
+    return (has_nulls and input.is_null_nocheck(i)) ? AggOp::template identity<StorageType>()
+                                                    : input.element<StorageType>(i);
+  }
+
+  __device__ void operator()(size_type block) const
+  {
+    auto const begin = block * width;
+    auto const end   = min(num_rows, begin + width);
+    auto running     = AggOp::template identity<StorageType>();
+    for (auto i = begin; i < end; ++i) {
+      running   = AggOp{}(running, value_or_identity(i));
+      prefix[i] = running;
+    }
+    running = AggOp::template identity<StorageType>();
+    for (auto i = end - 1; i >= begin; --i) {
+      running   = AggOp{}(running, value_or_identity(i));
+      suffix[i] = running;
+    }
+  }
+};
+
+template <typename StorageType, typename AggOp>
+struct extrema_window_fn {
+  column_device_view input;
+  bool has_nulls;
+  window_bounds_fn bounds;
+  StorageType const* __restrict__ prefix;
+  StorageType const* __restrict__ suffix;
+  size_type width;
+
+  __device__ StorageType operator()(size_type i) const
+  {
+    auto const window = bounds(i);
+    auto const start  = window.start;
+    auto const end    = window.end;
+    if (end - start == width) { return AggOp{}(suffix[start], prefix[end - 1]); }
+    if (end == 0) { return AggOp::template identity<StorageType>(); }
+    // windows clamped at the front stay within the first block, so the
+    // forward running extrema already answer them
+    if (start == 0 and end <= width) { return prefix[end - 1]; }
+    // the few windows clamped at the back may straddle a block boundary;
+    // iterate them directly
+    auto running = AggOp::template identity<StorageType>();
+    for (auto j = start; j < end; ++j) {
+      if (not has_nulls or input.is_valid_nocheck(j)) {
+        running = AggOp{}(running, input.element<StorageType>(j));
+      }
+    }
+    return running;
+  }
+};
+
+template <aggregation::Kind op>
+struct scan_minmax_launcher {
+  template <typename InputType, std::enable_if_t<cudf::is_fixed_width<InputType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     size_type preceding,
+                                     size_type following,
+                                     size_type min_periods,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    using StorageType = device_storage_type_t<InputType>;
+    using AggOp       = typename corresponding_operator<op>::type;
+
+    auto const num_rows = input.size();
+    auto const width    = preceding + following;
+    auto const d_input  = column_device_view::create(input, stream);
+    auto const bounds   = window_bounds_fn{num_rows, preceding, following};
+
+    rmm::device_uvector<StorageType> prefix(num_rows, stream);
+    rmm::device_uvector<StorageType> suffix(num_rows, stream);
+    auto const num_blocks = util::div_rounding_up_safe(num_rows, width);
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       num_blocks,
+                       block_extrema_fn<StorageType, AggOp>{*d_input,
+                                                            input.has_nulls(),
+                                                            prefix.data(),
+                                                            suffix.data(),
+                                                            width,
+                                                            num_rows});
+
+    auto output = make_fixed_width_column(cudf::detail::target_type(input.type(), op),
+                                          num_rows,
+                                          mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+    auto const d_output = output->mutable_view().template head<StorageType>();
+    thrust::tabulate(rmm::exec_policy(stream),
+                     d_output,
+                     d_output + num_rows,
+                     extrema_window_fn<StorageType, AggOp>{
+                       *d_input, input.has_nulls(), bounds, prefix.data(), suffix.data(), width});
+
+    auto valid_prefix = input.has_nulls() ? make_valid_count_prefix(*d_input, num_rows, stream)
+                                          : rmm::device_uvector<size_type>(0, stream);
+    set_count_validity(
+      *output,
+      window_valid_count_fn{bounds, input.has_nulls() ? valid_prefix.data() : nullptr},
+      min_periods,
+      stream,
+      mr);
+    return output;
+  }
+
+  template <typename InputType,
+            std::enable_if_t<not cudf::is_fixed_width<InputType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     size_type,
+                                     size_type,
+                                     size_type,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Scan-based rolling MIN/MAX supports only fixed-width types");
+  }
+};
+
+struct count_window_fn {
+  window_valid_count_fn count;
+
+  __device__ size_type operator()(size_type i) const { return count(i); }
+};
+
+/// COUNT_VALID/COUNT_ALL; the generic kernel validates both against the
+/// unfiltered window size, so the mask predicate ignores `valid_prefix`.
+inline std::unique_ptr<column> scan_count_rolling_window(column_view const& input,
+                                                         size_type preceding,
+                                                         size_type following,
+                                                         size_type min_periods,
+                                                         bool count_valid_only,
+                                                         rmm::cuda_stream_view stream,
+                                                         rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = input.size();
+  auto const d_input  = column_device_view::create(input, stream);
+  auto const bounds   = window_bounds_fn{num_rows, preceding, following};
+
+  auto valid_prefix = (count_valid_only and input.has_nulls())
+                        ? make_valid_count_prefix(*d_input, num_rows, stream)
+                        : rmm::device_uvector<size_type>(0, stream);
+  auto const d_valid_prefix = valid_prefix.is_empty() ? nullptr : valid_prefix.data();
+
+  auto output = make_fixed_width_column(
+    data_type{type_to_id<size_type>()}, num_rows, mask_state::UNALLOCATED, stream, mr);
+  thrust::tabulate(rmm::exec_policy(stream),
+                   output->mutable_view().template begin<size_type>(),
+                   output->mutable_view().template end<size_type>(),
+                   count_window_fn{window_valid_count_fn{bounds, d_valid_prefix}});
+
+  set_count_validity(*output, window_valid_count_fn{bounds, nullptr}, min_periods, stream, mr);
+  return output;
+}
+
+/**
+ * @brief Is the scan-based fast path applicable and worthwhile?
+ */
+inline bool can_use_scan_rolling(column_view const& input,
+                                 size_type preceding,
+                                 size_type following,
+                                 rolling_aggregation const& agg)
+{
+  if (preceding < 1 or following < 0) { return false; }
+  if (preceding + following < scan_rolling_minimum_window) { return false; }
+  switch (agg.kind) {
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL: return true;
+    case aggregation::SUM:
+    case aggregation::MEAN:
+      return cudf::is_numeric(input.type()) and not cudf::is_floating_point(input.type());
+    case aggregation::MIN:
+    case aggregation::MAX: return cudf::is_fixed_width(input.type());
+    default: return false;
+  }
+}
+
+/**
+ * @brief Applies a fixed-size rolling aggregation using prefix-scan state.
+ *
+ * Must only be called when `can_use_scan_rolling` returns true. Produces the
+ * same values and null mask as the generic kernel in `O(n)` work regardless
+ * of the window width.
+ */
+std::unique_ptr<column> scan_based_rolling_window(column_view const& input,
+                                                  size_type preceding,
+                                                  size_type following,
+                                                  size_type min_periods,
+                                                  rolling_aggregation const& agg,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  switch (agg.kind) {
+    case aggregation::COUNT_VALID:
+      return scan_count_rolling_window(input, preceding, following, min_periods, true, stream, mr);
+    case aggregation::COUNT_ALL:
+      return scan_count_rolling_window(input, preceding, following, min_periods, false, stream, mr);
+    case aggregation::SUM:
+      return type_dispatcher(input.type(),
+                             scan_sum_launcher<aggregation::SUM>{},
+                             input,
+                             preceding,
+                             following,
+                             min_periods,
+                             stream,
+                             mr);
+    case aggregation::MEAN:
+      return type_dispatcher(input.type(),
+                             scan_sum_launcher<aggregation::MEAN>{},
+                             input,
+                             preceding,
+                             following,
+                             min_periods,
+                             stream,
+                             mr);
+    case aggregation::MIN:
+      return type_dispatcher(input.type(),
+                             scan_minmax_launcher<aggregation::MIN>{},
+                             input,
+                             preceding,
+                             following,
+                             min_periods,
+                             stream,
+                             mr);
+    case aggregation::MAX:
+      return type_dispatcher(input.type(),
+                             scan_minmax_launcher<aggregation::MAX>{},
+                             input,
+                             preceding,
+                             following,
+                             min_periods,
+                             stream,
+                             mr);
+    default: CUDF_FAIL("Aggregation is not supported by scan-based rolling");
+  }
+}
+
+}  // namespace
+
+}  // namespace detail
+
+}  // namespace cudf
@@ -18,6 +18,7 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/search.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/detail/search.hpp>
 #include <cudf/dictionary/detail/update_keys.hpp>
@@ -26,15 +27,18 @@
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <structs/utilities.hpp>
 
 #include <hash/unordered_multiset.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/tabulate.h>
 
 namespace cudf {
 namespace {
@@ -70,6 +74,201 @@ void launch_search(DataIterator it_data,
   }
 }
 
+/// Number of column samples each block caches in shared memory; the top of
+/// the search tree, so per-probe traffic to it never touches global memory.
+constexpr size_type search_num_pivots = 512;
+constexpr size_type search_block_size = 256;
+
+/// Position of the i-th pivot sample within a sorted column of n elements
+__device__ inline size_type search_pivot_pos(size_type i, size_type n, size_type num_pivots)
+{
+  return static_cast<size_type>((static_cast<std::size_t>(i) + 1) * n / (num_pivots + 1));
+}
+
+template <typename T, std::enable_if_t<std::is_arithmetic_v<T>>* = nullptr>
+__device__ inline double search_key_as_double(T value)
+{
+  return static_cast<double>(value);
+}
+template <typename Rep, typename Period>
+__device__ inline double search_key_as_double(cuda::std::chrono::duration<Rep, Period> value)
+{
+  return static_cast<double>(value.count());
+}
+template <typename Clock, typename Duration>
+__device__ inline double search_key_as_double(
+  cuda::std::chrono::time_point<Clock, Duration> value)
+{
+  return static_cast<double>(value.time_since_epoch().count());
+}
+
+/**
+ * @brief Single-column lower/upper bound over an ascending sorted column.
+ *
+ * Each block first caches uniformly sampled pivots in shared memory and every
+ * probe binary-searches those to narrow its range without global traffic.
+ * Within the narrowed range a bounded number of interpolation probes exploit
+ * near-uniform key distributions (the common case for the timestamp indexes
+ * this targets) before plain binary search finishes the remainder, so skewed
+ * distributions cannot degrade past the generic bound.
+ */
+template <typename T, bool find_first>
+__global__ void fast_search_kernel(T const* data,
+                                   size_type n,
+                                   T const* precomputed_pivots,
+                                   T const* values,
+                                   size_type num_values,
+                                   size_type* out)
+{
+  __shared__ T pivots[search_num_pivots];
+  for (size_type i = threadIdx.x; i < search_num_pivots; i += blockDim.x) {
+    pivots[i] = precomputed_pivots != nullptr
+                  ? precomputed_pivots[i]
+                  : data[search_pivot_pos(i, n, search_num_pivots)];
+  }
+  __syncthreads();
+
+  // `true` when the bound lies strictly right of the probed element
+  auto const probe_right = [](T const& element, T const& value) {
+    return find_first ? (element < value) : not(value < element);
+  };
+
+  auto const stride = static_cast<size_type>(blockDim.x * gridDim.x);
+  for (auto tid = static_cast<size_type>(blockIdx.x * blockDim.x + threadIdx.x);
+       tid < num_values;
+       tid += stride) {
+    auto const value = values[tid];
+
+    // Top of the tree: locate the pivot interval holding the bound
+    size_type p_lo = 0;
+    size_type p_hi = search_num_pivots;
+    while (p_lo < p_hi) {
+      auto const mid = (p_lo + p_hi) / 2;
+      if (probe_right(pivots[mid], value)) {
+        p_lo = mid + 1;
+      } else {
+        p_hi = mid;
+      }
+    }
+    auto lo = p_lo == 0 ? size_type{0} : search_pivot_pos(p_lo - 1, n, search_num_pivots);
+    auto hi =
+      p_lo == search_num_pivots ? n : search_pivot_pos(p_lo, n, search_num_pivots) + 1;
+
+    // A few interpolation probes; each one either lands near the bound or
+    // hands a smaller range to the binary search below
+    for (int step = 0; step < 2 && hi - lo > 64; ++step) {
+      auto const d_lo = search_key_as_double(data[lo]);
+      auto const d_hi = search_key_as_double(data[hi - 1]);
+      if (not(d_hi > d_lo)) { break; }
+      auto frac = (search_key_as_double(value) - d_lo) / (d_hi - d_lo);
+      if (not(frac >= 0.0)) { frac = 0.0; }  // also catches NaN
+      if (frac > 1.0) { frac = 1.0; }
+      auto const guess = lo + static_cast<size_type>(frac * (hi - 1 - lo));
+      if (probe_right(data[guess], value)) {
+        lo = guess + 1;
+      } else {
+        hi = guess;
+      }
+    }
+
+    while (lo < hi) {
+      auto const mid = lo + (hi - lo) / 2;
+      if (probe_right(data[mid], value)) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    out[tid] = lo;
+  }
+}
+
+struct fast_search_fn {
+  template <typename T,
+            std::enable_if_t<cudf::is_numeric<T>() or cudf::is_chrono<T>()>* = nullptr>
+  void operator()(column_view const& t_col,
+                  column_view const& values_col,
+                  bool find_first,
+                  void const* precomputed_pivots,
+                  size_type* result_out,
+                  rmm::cuda_stream_view stream)
+  {
+    auto const pivots = static_cast<T const*>(precomputed_pivots);
+    cudf::detail::grid_1d grid(values_col.size(), search_block_size);
+    if (find_first) {
+      fast_search_kernel<T, true><<<grid.num_blocks, search_block_size, 0, stream.value()>>>(
+        t_col.data<T>(),
+        t_col.size(),
+        pivots,
+        values_col.data<T>(),
+        values_col.size(),
+        result_out);
+    } else {
+      fast_search_kernel<T, false><<<grid.num_blocks, search_block_size, 0, stream.value()>>>(
+        t_col.data<T>(),
+        t_col.size(),
+        pivots,
+        values_col.data<T>(),
+        values_col.size(),
+        result_out);
+    }
+  }
+
+  template <typename T,
+            std::enable_if_t<not(cudf::is_numeric<T>() or cudf::is_chrono<T>())>* = nullptr>
+  void operator()(
+    column_view const&, column_view const&, bool, void const*, size_type*, rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Unsupported type for fast search");
+  }
+};
+
+/// Samples one pivot from a sorted column for the precomputed pivot buffer
+template <typename T>
+struct sample_pivot_fn {
+  T const* data;
+  size_type n;
+  __device__ T operator()(size_type i) const
+  {
+    return data[search_pivot_pos(i, n, search_num_pivots)];
+  }
+};
+
+struct build_pivots_fn {
+  template <typename T,
+            std::enable_if_t<cudf::is_numeric<T>() or cudf::is_chrono<T>()>* = nullptr>
+  rmm::device_buffer operator()(column_view const& t_col, rmm::cuda_stream_view stream)
+  {
+    rmm::device_buffer pivots(search_num_pivots * sizeof(T), stream);
+    thrust::tabulate(rmm::exec_policy(stream),
+                     static_cast<T*>(pivots.data()),
+                     static_cast<T*>(pivots.data()) + search_num_pivots,
+                     sample_pivot_fn<T>{t_col.data<T>(), t_col.size()});
+    return pivots;
+  }
+
+  template <typename T,
+            std::enable_if_t<not(cudf::is_numeric<T>() or cudf::is_chrono<T>())>* = nullptr>
+  rmm::device_buffer operator()(column_view const&, rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Unsupported type for fast search");
+  }
+};
+
+/// The pivot-cached kernel handles single ascending numeric or timestamp
+/// columns without nulls; everything else uses the generic row comparator.
+bool can_use_fast_search(table_view const& t,
+                         table_view const& values,
+                         std::vector<order> const& column_order)
+{
+  if (t.num_columns() != 1 or values.num_rows() == 0) { return false; }
+  if (not column_order.empty() and column_order.front() != order::ASCENDING) { return false; }
+  auto const& t_col = t.column(0);
+  auto const& v_col = values.column(0);
+  return (cudf::is_numeric(t_col.type()) or cudf::is_chrono(t_col.type())) and
+         t_col.type() == v_col.type() and not t_col.has_nulls() and not v_col.has_nulls();
+}
+
 std::unique_ptr<column> search_ordered(table_view const& t,
                                        table_view const& values,
                                        bool find_first,
@@ -96,6 +295,18 @@ std::unique_ptr<column> search_ordered(table_view const& t,
     return result;
   }
 
+  if (can_use_fast_search(t, values, column_order)) {
+    type_dispatcher(t.column(0).type(),
+                    fast_search_fn{},
+                    t.column(0),
+                    values.column(0),
+                    find_first,
+                    nullptr,
+                    result_out,
+                    stream);
+    return result;
+  }
+
   // This utility will ensure all corresponding dictionary columns have matching keys.
   // It will return any new dictionary columns created as well as updated table_views.
   auto const matched = dictionary::detail::match_dictionaries({t, values}, stream);
@@ -345,6 +556,91 @@ std::unique_ptr<column> upper_bound(table_view const& t,
 
 }  // namespace detail
 
+struct sorted_index::sorted_index_impl {
+  sorted_index_impl(table_view const& t,
+                    std::vector<order> const& column_order,
+                    std::vector<null_order> const& null_precedence,
+                    rmm::cuda_stream_view stream)
+    : _table{t}, _column_order{column_order}, _null_precedence{null_precedence}
+  {
+    CUDF_EXPECTS(
+      column_order.empty() or static_cast<std::size_t>(t.num_columns()) == column_order.size(),
+      "Mismatch between number of columns and column order.");
+    CUDF_EXPECTS(null_precedence.empty() or
+                   static_cast<std::size_t>(t.num_columns()) == null_precedence.size(),
+                 "Mismatch between number of columns and null precedence.");
+
+    auto const ascending = column_order.empty() or column_order.front() == order::ASCENDING;
+    _has_pivots          = t.num_columns() == 1 and t.num_rows() > 0 and ascending and
+                  (cudf::is_numeric(t.column(0).type()) or cudf::is_chrono(t.column(0).type())) and
+                  not t.column(0).has_nulls();
+    if (_has_pivots) {
+      _pivots = type_dispatcher(t.column(0).type(), build_pivots_fn{}, t.column(0), stream);
+      stream.synchronize();
+    }
+  }
+
+  std::unique_ptr<column> search(table_view const& values,
+                                 bool find_first,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr) const
+  {
+    if (_has_pivots and values.num_columns() == 1 and
+        values.column(0).type() == _table.column(0).type() and
+        not values.column(0).has_nulls()) {
+      auto result = make_numeric_column(data_type{type_to_id<size_type>()},
+                                        values.num_rows(),
+                                        mask_state::UNALLOCATED,
+                                        stream,
+                                        mr);
+      if (values.num_rows() > 0) {
+        type_dispatcher(_table.column(0).type(),
+                        fast_search_fn{},
+                        _table.column(0),
+                        values.column(0),
+                        find_first,
+                        _pivots.data(),
+                        result->mutable_view().data<size_type>(),
+                        stream);
+      }
+      return result;
+    }
+    return find_first
+             ? detail::lower_bound(_table, values, _column_order, _null_precedence, stream, mr)
+             : detail::upper_bound(_table, values, _column_order, _null_precedence, stream, mr);
+  }
+
+  table_view _table;
+  std::vector<order> _column_order;
+  std::vector<null_order> _null_precedence;
+  rmm::device_buffer _pivots;  ///< precomputed pivot hierarchy, single-column fast path only
+  bool _has_pivots = false;
+};
+
+sorted_index::~sorted_index() = default;
+
+sorted_index::sorted_index(table_view const& t,
+                           std::vector<order> const& column_order,
+                           std::vector<null_order> const& null_precedence,
+                           rmm::cuda_stream_view stream)
+  : _impl{std::make_unique<sorted_index_impl>(t, column_order, null_precedence, stream)}
+{
+}
+
+std::unique_ptr<column> sorted_index::lower_bound(table_view const& values,
+                                                  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->search(values, true, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> sorted_index::upper_bound(table_view const& values,
+                                                  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->search(values, false, rmm::cuda_stream_default, mr);
+}
+
 // external APIs
 
 std::unique_ptr<column> lower_bound(table_view const& t,
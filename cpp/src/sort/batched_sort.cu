@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+
+std::vector<std::unique_ptr<table>> batched_sort(std::vector<table_view> const& inputs,
+                                                 std::vector<order> const& column_order,
+                                                 std::vector<null_order> const& null_precedence,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  std::vector<std::unique_ptr<table>> results;
+  if (inputs.empty()) { return results; }
+  if (inputs.size() == 1) {
+    results.push_back(
+      sort_by_key(inputs.front(), inputs.front(), column_order, null_precedence, stream, mr));
+    return results;
+  }
+
+  // Sort the whole batch with one set of kernels: concatenate the tables, sort each table's rows
+  // as a segment, then split the result back into per-table copies. Schema mismatches are
+  // detected by the concatenation.
+  auto const combined = concatenate(host_span<table_view const>{inputs}, stream);
+
+  std::vector<size_type> h_offsets(inputs.size() + 1, 0);
+  std::transform(inputs.begin(),
+                 inputs.end(),
+                 std::next(h_offsets.begin()),
+                 [sum = size_type{0}](table_view const& t) mutable { return sum += t.num_rows(); });
+  auto const d_offsets = make_device_uvector_async(h_offsets, stream);
+  column_view const offsets_view{data_type{type_to_id<size_type>()},
+                                 static_cast<size_type>(h_offsets.size()),
+                                 d_offsets.data()};
+
+  auto const sorted = segmented_sort_by_key(
+    combined->view(), combined->view(), offsets_view, column_order, null_precedence, stream);
+
+  std::vector<size_type> const splits(h_offsets.begin() + 1, h_offsets.end() - 1);
+  for (auto const& sorted_view : cudf::split(sorted->view(), splits)) {
+    results.push_back(std::make_unique<table>(sorted_view, stream, mr));
+  }
+  return results;
+}
+
+}  // namespace detail
+
+std::vector<std::unique_ptr<table>> batched_sort(std::vector<table_view> const& inputs,
+                                                 std::vector<order> const& column_order,
+                                                 std::vector<null_order> const& null_precedence,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::batched_sort(inputs, column_order, null_precedence, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
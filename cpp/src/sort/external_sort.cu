@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/merge.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <thrust/host_vector.h>
+#include <thrust/system/cuda/experimental/pinned_allocator.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+using pinned_vector =
+  thrust::host_vector<uint8_t, thrust::system::cuda::experimental::pinned_allocator<uint8_t>>;
+
+/**
+ * @brief A sorted run of rows, packed and spilled to pinned host memory.
+ */
+struct sort_spill_run {
+  std::unique_ptr<packed_columns::metadata> metadata;
+  pinned_vector data;
+  size_type num_rows;
+};
+
+namespace {
+
+// Number of spilled runs restored to the device per merge pass. Bounds the
+// device footprint of `external_sorter::sort` to one batch of runs plus the
+// merged result.
+constexpr std::size_t merge_width = 8;
+
+/**
+ * @brief Packs a table and copies it to pinned host memory.
+ *
+ * Only one packed device copy is alive at a time; it is dropped once the copy
+ * to the host completes.
+ */
+std::unique_ptr<sort_spill_run> spill_run(table_view const& input, rmm::cuda_stream_view stream)
+{
+  auto packed = detail::pack(input, stream, rmm::mr::get_current_device_resource());
+  pinned_vector host_data(packed.gpu_data->size());
+  if (not host_data.empty()) {
+    CUDA_TRY(cudaMemcpyAsync(host_data.data(),
+                             packed.gpu_data->data(),
+                             host_data.size(),
+                             cudaMemcpyDeviceToHost,
+                             stream.value()));
+  }
+  stream.synchronize();
+  return std::make_unique<sort_spill_run>(
+    sort_spill_run{std::move(packed.metadata_), std::move(host_data), input.num_rows()});
+}
+
+/**
+ * @brief Copies a spilled run's packed data back to the device.
+ */
+rmm::device_buffer restore_run(sort_spill_run const& run, rmm::cuda_stream_view stream)
+{
+  rmm::device_buffer buffer(run.data.size(), stream);
+  if (not run.data.empty()) {
+    CUDA_TRY(cudaMemcpyAsync(
+      buffer.data(), run.data.data(), run.data.size(), cudaMemcpyHostToDevice, stream.value()));
+  }
+  return buffer;
+}
+
+}  // namespace
+}  // namespace detail
+
+external_sorter::external_sorter(std::vector<order> column_order,
+                                 std::vector<null_order> null_precedence)
+  : _column_order{std::move(column_order)}, _null_precedence{std::move(null_precedence)}
+{
+}
+
+external_sorter::~external_sorter() = default;
+
+void external_sorter::add_chunk(table_view const& chunk)
+{
+  CUDF_FUNC_RANGE();
+  if (_types.empty()) {
+    CUDF_EXPECTS(_column_order.empty() or
+                   _column_order.size() == static_cast<std::size_t>(chunk.num_columns()),
+                 "Mismatch between number of columns and column order.");
+    CUDF_EXPECTS(_null_precedence.empty() or
+                   _null_precedence.size() == static_cast<std::size_t>(chunk.num_columns()),
+                 "Mismatch between number of columns and null_precedence size.");
+    std::transform(chunk.begin(), chunk.end(), std::back_inserter(_types), [](auto const& col) {
+      return col.type();
+    });
+  } else {
+    CUDF_EXPECTS(static_cast<std::size_t>(chunk.num_columns()) == _types.size() and
+                   std::equal(_types.begin(),
+                              _types.end(),
+                              chunk.begin(),
+                              [](auto const& type, auto const& col) { return type == col.type(); }),
+                 "Chunk schema does not match previous chunks.");
+  }
+
+  auto const stream = rmm::cuda_stream_default;
+  auto sorted       = cudf::detail::sort_by_key(chunk,
+                                          chunk,
+                                          _column_order,
+                                          _null_precedence,
+                                          stream,
+                                          rmm::mr::get_current_device_resource());
+  _runs.push_back(detail::spill_run(sorted->view(), stream));
+}
+
+std::unique_ptr<table> external_sorter::sort(rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  auto const stream = rmm::cuda_stream_default;
+  if (_runs.empty() or _types.empty()) { return std::make_unique<table>(); }
+
+  if (_runs.size() == 1) {
+    auto buffer     = detail::restore_run(*_runs.front(), stream);
+    auto const view = cudf::unpack(_runs.front()->metadata->data(),
+                                   static_cast<uint8_t const*>(buffer.data()));
+    auto result     = std::make_unique<table>(view, stream, mr);
+    _runs.clear();
+    return result;
+  }
+
+  std::vector<size_type> key_cols(_types.size());
+  std::iota(key_cols.begin(), key_cols.end(), 0);
+  auto const column_order = _column_order.empty()
+                              ? std::vector<order>(_types.size(), order::ASCENDING)
+                              : _column_order;
+
+  // Merge up to merge_width runs per pass, spilling intermediate merged runs
+  // back to host memory, until a single sorted table remains.
+  while (true) {
+    auto const batch = std::min(detail::merge_width, _runs.size());
+    std::vector<rmm::device_buffer> buffers;
+    std::vector<table_view> views;
+    buffers.reserve(batch);
+    views.reserve(batch);
+    for (std::size_t i = 0; i < batch; ++i) {
+      buffers.push_back(detail::restore_run(*_runs[i], stream));
+      views.push_back(cudf::unpack(_runs[i]->metadata->data(),
+                                   static_cast<uint8_t const*>(buffers[i].data())));
+    }
+
+    auto const is_final = batch == _runs.size();
+    auto merged         = cudf::merge(views,
+                              key_cols,
+                              column_order,
+                              _null_precedence,
+                              is_final ? mr : rmm::mr::get_current_device_resource());
+    _runs.erase(_runs.begin(), _runs.begin() + batch);
+    if (is_final) { return merged; }
+    _runs.push_back(detail::spill_run(merged->view(), stream));
+  }
+}
+
+}  // namespace cudf
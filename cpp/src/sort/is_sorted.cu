@@ -15,6 +15,7 @@
  */
 
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
@@ -24,11 +25,47 @@
 #include <structs/utilities.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 namespace cudf {
 namespace detail {
+namespace {
+
+constexpr size_type is_sorted_block_size = 256;
+
+/**
+ * @brief Checks all adjacent row pairs for order violations, aborting early
+ * once any block has found one.
+ *
+ * Defensive `is_sorted` calls mostly either pass (every pair must be checked
+ * anyway) or fail close to the front; a single device-wide flag lets all
+ * blocks stop scanning as soon as the first violation is published. The flag
+ * is polled once per grid-stride pass by one thread per block and shared
+ * through shared memory, so the sorted case pays one extra atomic per pass.
+ */
+template <typename Comparator>
+__global__ void is_sorted_kernel(Comparator comp, size_type num_pairs, int* d_violation)
+{
+  __shared__ int block_abort;
+
+  auto const stride = static_cast<size_type>(blockDim.x * gridDim.x);
+  // base is block-uniform so the __syncthreads below are reached by all
+  // threads of the block for the same number of iterations
+  for (auto base = static_cast<size_type>(blockIdx.x * blockDim.x); base < num_pairs;
+       base += stride) {
+    if (threadIdx.x == 0) { block_abort = atomicOr(d_violation, 0); }
+    __syncthreads();
+    if (block_abort) { return; }
+
+    auto const pair = base + static_cast<size_type>(threadIdx.x);
+    if (pair < num_pairs and comp(pair + 1, pair)) { atomicOr(d_violation, 1); }
+    __syncthreads();
+  }
+}
+
+}  // namespace
 
 template <bool has_nulls>
 auto is_sorted(cudf::table_view const& in,
@@ -36,6 +73,9 @@ auto is_sorted(cudf::table_view const& in,
                std::vector<null_order> const& null_precedence,
                rmm::cuda_stream_view stream)
 {
+  auto const num_pairs = in.num_rows() - 1;
+  if (num_pairs < 1) { return true; }
+
   // 0-table_view, 1-column_order, 2-null_precedence, 3-validity_columns
   auto flattened = structs::detail::flatten_nested_columns(in, column_order, null_precedence);
 
@@ -48,12 +88,12 @@ auto is_sorted(cudf::table_view const& in,
   auto comparator = row_lexicographic_comparator<has_nulls>(
     *d_input, *d_input, d_column_order.data(), d_null_precedence.data());
 
-  auto sorted = thrust::is_sorted(rmm::exec_policy(stream),
-                                  thrust::make_counting_iterator(0),
-                                  thrust::make_counting_iterator(in.num_rows()),
-                                  comparator);
+  rmm::device_scalar<int> violation(0, stream);
+  grid_1d grid(num_pairs, is_sorted_block_size);
+  is_sorted_kernel<<<grid.num_blocks, is_sorted_block_size, 0, stream.value()>>>(
+    comparator, num_pairs, violation.data());
 
-  return sorted;
+  return violation.value(stream) == 0;
 }
 
 }  // namespace detail
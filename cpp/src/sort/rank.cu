@@ -18,6 +18,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/row_operators.cuh>
@@ -33,6 +34,8 @@
 #include <thrust/iterator/permutation_iterator.h>
 #include <thrust/sequence.h>
 
+#include <algorithm>
+
 namespace cudf {
 namespace detail {
 namespace {
@@ -131,6 +134,27 @@ void tie_break_ranks_transform(cudf::device_span<size_type const> dense_rank_sor
                   rank_iter);
 }
 
+/// Scales a rank into the (0, 1] percentage range at scatter time, so percent
+/// ranks need no second pass over the output
+struct percent_rank_fn {
+  size_type count;
+  template <typename T>
+  __device__ double operator()(T rank) const
+  {
+    return static_cast<double>(rank) / count;
+  }
+};
+
+/// Dense percent ranks divide by the number of value groups, known only on the
+/// device as the last entry of the sorted dense ranks
+struct dense_percent_rank_fn {
+  size_type const* d_num_groups;
+  __device__ double operator()(size_type rank) const
+  {
+    return static_cast<double>(rank) / *d_num_groups;
+  }
+};
+
 template <typename outputType>
 void rank_first(column_view sorted_order_view,
                 mutable_column_view rank_mutable_view,
@@ -158,10 +182,11 @@ void rank_dense(cudf::device_span<size_type const> dense_rank_sorted,
                   rank_mutable_view.begin<outputType>());
 }
 
-template <typename outputType>
+template <typename outputType, typename Transformer>
 void rank_min(cudf::device_span<size_type const> group_keys,
               column_view sorted_order_view,
               mutable_column_view rank_mutable_view,
+              Transformer transformer,
               rmm::cuda_stream_view stream)
 {
   // min of first in the group
@@ -172,14 +197,15 @@ void rank_min(cudf::device_span<size_type const> group_keys,
                                        sorted_order_view,
                                        rank_mutable_view.begin<outputType>(),
                                        thrust::minimum<size_type>{},
-                                       thrust::identity<outputType>{},
+                                       transformer,
                                        stream);
 }
 
-template <typename outputType>
+template <typename outputType, typename Transformer>
 void rank_max(cudf::device_span<size_type const> group_keys,
               column_view sorted_order_view,
               mutable_column_view rank_mutable_view,
+              Transformer transformer,
               rmm::cuda_stream_view stream)
 {
   // max of first in the group
@@ -190,13 +216,15 @@ void rank_max(cudf::device_span<size_type const> group_keys,
                                        sorted_order_view,
                                        rank_mutable_view.begin<outputType>(),
                                        thrust::maximum<size_type>{},
-                                       thrust::identity<outputType>{},
+                                       transformer,
                                        stream);
 }
 
+template <typename Transformer>
 void rank_average(cudf::device_span<size_type const> group_keys,
                   column_view sorted_order_view,
                   mutable_column_view rank_mutable_view,
+                  Transformer transformer,
                   rmm::cuda_stream_view stream)
 {
   // k, k+1, .. k+n-1
@@ -218,13 +246,42 @@ void rank_average(cudf::device_span<size_type const> group_keys,
       return MinCount{std::min(rank_count1.first, rank_count2.first),
                       rank_count1.second + rank_count2.second};
     },
-    [] __device__(MinCount minrank_count) {  // min+(count-1)/2
-      return static_cast<double>(thrust::get<0>(minrank_count)) +
-             (static_cast<double>(thrust::get<1>(minrank_count)) - 1) / 2.0;
+    [transformer] __device__(MinCount minrank_count) {  // min+(count-1)/2
+      return transformer(static_cast<double>(thrust::get<0>(minrank_count)) +
+                         (static_cast<double>(thrust::get<1>(minrank_count)) - 1) / 2.0);
     },
     stream);
 }
 
+void rank_first_percent(column_view sorted_order_view,
+                        mutable_column_view rank_mutable_view,
+                        size_type count,
+                        rmm::cuda_stream_view stream)
+{
+  auto const rank_iter =
+    cudf::detail::make_counting_transform_iterator(1, percent_rank_fn{count});
+  thrust::scatter(rmm::exec_policy(stream),
+                  rank_iter,
+                  rank_iter + rank_mutable_view.size(),
+                  sorted_order_view.begin<size_type>(),
+                  rank_mutable_view.begin<double>());
+}
+
+void rank_dense_percent(cudf::device_span<size_type const> dense_rank_sorted,
+                        column_view sorted_order_view,
+                        mutable_column_view rank_mutable_view,
+                        size_type count,
+                        rmm::cuda_stream_view stream)
+{
+  auto const rank_iter = thrust::make_transform_iterator(
+    dense_rank_sorted.begin(), dense_percent_rank_fn{dense_rank_sorted.data() + count - 1});
+  thrust::scatter(rmm::exec_policy(stream),
+                  rank_iter,
+                  rank_iter + dense_rank_sorted.size(),
+                  sorted_order_view.begin<size_type>(),
+                  rank_mutable_view.begin<double>());
+}
+
 }  // anonymous namespace
 
 std::unique_ptr<column> rank(column_view const& input,
@@ -270,7 +327,34 @@ std::unique_ptr<column> rank(column_view const& input,
         return rmm::device_uvector<size_type>(0, stream);
     }();
 
-  if (output_type.id() == type_id::FLOAT64) {
+  // Percent ranks are scaled while scattering into the output, so they need
+  // no second pass over the rank column
+  size_type const count =
+    (null_handling == null_policy::EXCLUDE) ? input.size() - input.null_count() : input.size();
+
+  if (percentage) {
+    switch (method) {
+      case rank_method::FIRST:
+        rank_first_percent(sorted_order_view, rank_mutable_view, count, stream);
+        break;
+      case rank_method::DENSE:
+        rank_dense_percent(dense_rank_sorted, sorted_order_view, rank_mutable_view, count, stream);
+        break;
+      case rank_method::MIN:
+        rank_min<double>(
+          dense_rank_sorted, sorted_order_view, rank_mutable_view, percent_rank_fn{count}, stream);
+        break;
+      case rank_method::MAX:
+        rank_max<double>(
+          dense_rank_sorted, sorted_order_view, rank_mutable_view, percent_rank_fn{count}, stream);
+        break;
+      case rank_method::AVERAGE:
+        rank_average(
+          dense_rank_sorted, sorted_order_view, rank_mutable_view, percent_rank_fn{count}, stream);
+        break;
+      default: CUDF_FAIL("Unexpected rank_method for rank()");
+    }
+  } else if (output_type.id() == type_id::FLOAT64) {
     switch (method) {
       case rank_method::FIRST:
         rank_first<double>(sorted_order_view, rank_mutable_view, stream);
@@ -279,13 +363,25 @@ std::unique_ptr<column> rank(column_view const& input,
         rank_dense<double>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
         break;
       case rank_method::MIN:
-        rank_min<double>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
+        rank_min<double>(dense_rank_sorted,
+                         sorted_order_view,
+                         rank_mutable_view,
+                         thrust::identity<double>{},
+                         stream);
         break;
       case rank_method::MAX:
-        rank_max<double>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
+        rank_max<double>(dense_rank_sorted,
+                         sorted_order_view,
+                         rank_mutable_view,
+                         thrust::identity<double>{},
+                         stream);
         break;
       case rank_method::AVERAGE:
-        rank_average(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
+        rank_average(dense_rank_sorted,
+                     sorted_order_view,
+                     rank_mutable_view,
+                     thrust::identity<double>{},
+                     stream);
         break;
       default: CUDF_FAIL("Unexpected rank_method for rank()");
     }
@@ -298,35 +394,59 @@ std::unique_ptr<column> rank(column_view const& input,
         rank_dense<size_type>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
         break;
       case rank_method::MIN:
-        rank_min<size_type>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
+        rank_min<size_type>(dense_rank_sorted,
+                            sorted_order_view,
+                            rank_mutable_view,
+                            thrust::identity<size_type>{},
+                            stream);
         break;
       case rank_method::MAX:
-        rank_max<size_type>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
+        rank_max<size_type>(dense_rank_sorted,
+                            sorted_order_view,
+                            rank_mutable_view,
+                            thrust::identity<size_type>{},
+                            stream);
         break;
       case rank_method::AVERAGE:
-        rank_average(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
+        rank_average(dense_rank_sorted,
+                     sorted_order_view,
+                     rank_mutable_view,
+                     thrust::identity<double>{},
+                     stream);
         break;
       default: CUDF_FAIL("Unexpected rank_method for rank()");
     }
   }
 
-  // pct inplace transform
-  if (percentage) {
-    auto rank_iter = rank_mutable_view.begin<double>();
-    size_type const count =
-      (null_handling == null_policy::EXCLUDE) ? input.size() - input.null_count() : input.size();
-    auto drs            = dense_rank_sorted.data();
-    bool const is_dense = (method == rank_method::DENSE);
-    thrust::transform(rmm::exec_policy(stream),
-                      rank_iter,
-                      rank_iter + input.size(),
-                      rank_iter,
-                      [is_dense, drs, count] __device__(double r) -> double {
-                        return is_dense ? r / drs[count - 1] : r / count;
-                      });
-  }
   return rank_column;
 }
+
+std::unique_ptr<table> rank(table_view const& input,
+                            rank_method method,
+                            order column_order,
+                            null_policy null_handling,
+                            null_order null_precedence,
+                            bool percentage,
+                            rmm::cuda_stream_view stream,
+                            rmm::mr::device_memory_resource* mr)
+{
+  std::vector<std::unique_ptr<column>> ranks;
+  ranks.reserve(input.num_columns());
+  std::transform(input.begin(),
+                 input.end(),
+                 std::back_inserter(ranks),
+                 [&](column_view const& col) {
+                   return rank(col,
+                               method,
+                               column_order,
+                               null_handling,
+                               null_precedence,
+                               percentage,
+                               stream,
+                               mr);
+                 });
+  return std::make_unique<table>(std::move(ranks));
+}
 }  // namespace detail
 
 std::unique_ptr<column> rank(column_view const& input,
@@ -346,4 +466,18 @@ std::unique_ptr<column> rank(column_view const& input,
                       rmm::cuda_stream_default,
                       mr);
 }
+
+std::unique_ptr<table> rank(table_view const& input,
+                            rank_method method,
+                            order column_order,
+                            null_policy null_handling,
+                            null_order null_precedence,
+                            bool percentage,
+                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::rank(
+    input, method, column_order, null_handling, null_precedence, percentage,
+    rmm::cuda_stream_default, mr);
+}
 }  // namespace cudf
@@ -19,12 +19,16 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/list_device_view.cuh>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
@@ -32,9 +36,12 @@
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/logical.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
 
 #include <algorithm>
 #include <iterator>
@@ -43,6 +50,217 @@
 
 namespace cudf {
 namespace detail {
+namespace {
+
+// Largest segment handled by the in-block bitonic sort; longer segments are
+// sorted individually with a radix sort.
+constexpr size_type block_sort_capacity = 1024;
+
+/**
+ * @brief Sorts one small segment per block with a shared-memory bitonic sort.
+ *
+ * The segment's keys and row indices are staged in shared memory, padded to a
+ * power of two with entries that compare after every real element, sorted, and
+ * the permuted row indices written back.
+ */
+template <typename T>
+__global__ void block_segmented_sort_kernel(T const* keys,
+                                            size_type const* offsets,
+                                            size_type const* segment_ids,
+                                            size_type* out_indices,
+                                            bool ascending)
+{
+  __shared__ T s_keys[block_sort_capacity];
+  __shared__ size_type s_indices[block_sort_capacity];
+
+  auto const segment = segment_ids[blockIdx.x];
+  auto const begin   = offsets[segment];
+  auto const size    = offsets[segment + 1] - begin;
+
+  size_type padded = 1;
+  while (padded < size) {
+    padded <<= 1;
+  }
+
+  for (size_type i = threadIdx.x; i < padded; i += blockDim.x) {
+    if (i < size) {
+      s_keys[i]    = keys[begin + i];
+      s_indices[i] = begin + i;
+    } else {
+      s_indices[i] = -1;  // padding entry; compares after all real elements
+    }
+  }
+  __syncthreads();
+
+  auto const less = [&](size_type a, size_type b) {
+    bool const a_pad = s_indices[a] < 0;
+    bool const b_pad = s_indices[b] < 0;
+    if (a_pad or b_pad) { return not a_pad and b_pad; }
+    bool const a_less = ascending ? s_keys[a] < s_keys[b] : s_keys[b] < s_keys[a];
+    bool const b_less = ascending ? s_keys[b] < s_keys[a] : s_keys[a] < s_keys[b];
+    if (a_less) { return true; }
+    if (b_less) { return false; }
+    // break key ties by row index so equal keys keep their original order
+    return s_indices[a] < s_indices[b];
+  };
+
+  for (size_type k = 2; k <= padded; k <<= 1) {
+    for (size_type j = k >> 1; j > 0; j >>= 1) {
+      for (size_type i = threadIdx.x; i < padded; i += blockDim.x) {
+        auto const partner = i ^ j;
+        if (partner > i) {
+          // regions with the k-bit set sort in the reverse direction
+          bool const swap_needed = ((i & k) == 0) ? less(partner, i) : less(i, partner);
+          if (swap_needed) {
+            thrust::swap(s_keys[i], s_keys[partner]);
+            thrust::swap(s_indices[i], s_indices[partner]);
+          }
+        }
+      }
+      __syncthreads();
+    }
+  }
+
+  for (size_type i = threadIdx.x; i < size; i += blockDim.x) {
+    out_indices[begin + i] = s_indices[i];
+  }
+}
+
+/**
+ * @brief Predicate selecting segments at or below the block-sort capacity.
+ */
+struct small_segment_fn {
+  __device__ bool operator()(size_type segment) const
+  {
+    return offsets[segment + 1] - offsets[segment] <= block_sort_capacity;
+  }
+  size_type const* offsets;
+};
+
+struct large_segment_fn {
+  __device__ bool operator()(size_type segment) const
+  {
+    return offsets[segment + 1] - offsets[segment] > block_sort_capacity;
+  }
+  size_type const* offsets;
+};
+
+/**
+ * @brief Type-dispatched functor sorting each size bin of segments.
+ */
+struct segmented_fast_sort_fn {
+  template <typename T, typename std::enable_if_t<cudf::is_fixed_width<T>()>* = nullptr>
+  void operator()(column_view const& keys,
+                  column_view const& offsets,
+                  device_span<size_type const> small_segments,
+                  host_span<size_type const> large_segments,
+                  mutable_column_view& indices,
+                  bool ascending,
+                  rmm::cuda_stream_view stream)
+  {
+    if (not small_segments.empty()) {
+      constexpr size_type block_size = 256;
+      block_segmented_sort_kernel<T>
+        <<<small_segments.size(), block_size, 0, stream.value()>>>(keys.begin<T>(),
+                                                                   offsets.begin<size_type>(),
+                                                                   small_segments.data(),
+                                                                   indices.begin<size_type>(),
+                                                                   ascending);
+      CHECK_CUDA(stream.value());
+    }
+    // Segments too long for the block sort are rare; sort each with a radix
+    // sort over a copy of its keys.
+    for (auto const segment : large_segments) {
+      auto const begin = cudf::detail::get_value<size_type>(offsets, segment, stream);
+      auto const end   = cudf::detail::get_value<size_type>(offsets, segment + 1, stream);
+      rmm::device_uvector<T> segment_keys(end - begin, stream);
+      thrust::copy(rmm::exec_policy(stream),
+                   keys.begin<T>() + begin,
+                   keys.begin<T>() + end,
+                   segment_keys.begin());
+      thrust::sequence(rmm::exec_policy(stream),
+                       indices.begin<size_type>() + begin,
+                       indices.begin<size_type>() + end,
+                       begin);
+      if (ascending) {
+        thrust::sort_by_key(rmm::exec_policy(stream),
+                            segment_keys.begin(),
+                            segment_keys.end(),
+                            indices.begin<size_type>() + begin,
+                            thrust::less<T>());
+      } else {
+        thrust::sort_by_key(rmm::exec_policy(stream),
+                            segment_keys.begin(),
+                            segment_keys.end(),
+                            indices.begin<size_type>() + begin,
+                            thrust::greater<T>());
+      }
+    }
+  }
+  template <typename T, typename std::enable_if_t<!cudf::is_fixed_width<T>()>* = nullptr>
+  void operator()(column_view const&,
+                  column_view const&,
+                  device_span<size_type const>,
+                  host_span<size_type const>,
+                  mutable_column_view&,
+                  bool,
+                  rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Only fixed-width types are suitable for the segment-binned sort");
+  }
+};
+
+/**
+ * @brief Per-segment sorted order for a single fixed-width key column without nulls.
+ *
+ * Segments are binned by size: segments of up to `block_sort_capacity` rows
+ * are each sorted by one block in shared memory, while longer segments fall
+ * back to individual radix sorts.
+ */
+std::unique_ptr<column> fast_segmented_sorted_order(column_view const& keys,
+                                                    column_view const& segment_offsets,
+                                                    bool ascending,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  auto const num_segments = segment_offsets.size() - 1;
+  auto const d_offsets    = segment_offsets.begin<size_type>();
+
+  rmm::device_uvector<size_type> small_segments(num_segments, stream);
+  auto const small_end = thrust::copy_if(rmm::exec_policy(stream),
+                                         thrust::counting_iterator<size_type>(0),
+                                         thrust::counting_iterator<size_type>(num_segments),
+                                         small_segments.begin(),
+                                         small_segment_fn{d_offsets});
+  auto const num_small = static_cast<size_type>(small_end - small_segments.begin());
+
+  rmm::device_uvector<size_type> large_segments(num_segments - num_small, stream);
+  thrust::copy_if(rmm::exec_policy(stream),
+                  thrust::counting_iterator<size_type>(0),
+                  thrust::counting_iterator<size_type>(num_segments),
+                  large_segments.begin(),
+                  large_segment_fn{d_offsets});
+  auto const h_large_segments = cudf::detail::make_std_vector_sync(
+    device_span<size_type const>{large_segments.data(), large_segments.size()}, stream);
+
+  auto sorted_indices = cudf::make_numeric_column(
+    data_type(type_to_id<size_type>()), keys.size(), mask_state::UNALLOCATED, stream, mr);
+  auto indices_view = sorted_indices->mutable_view();
+
+  cudf::type_dispatcher<dispatch_storage_type>(
+    keys.type(),
+    segmented_fast_sort_fn{},
+    keys,
+    segment_offsets,
+    device_span<size_type const>{small_segments.data(), static_cast<std::size_t>(num_small)},
+    host_span<size_type const>{h_large_segments.data(), h_large_segments.size()},
+    indices_view,
+    ascending,
+    stream);
+  return sorted_indices;
+}
+
+}  // namespace
 
 // returns segment indices for each element for all segments.
 // first segment begin index = 0, last segment end index = num_rows.
@@ -74,6 +292,21 @@ std::unique_ptr<column> segmented_sorted_order(table_view const& keys,
 {
   CUDF_EXPECTS(segment_offsets.type() == data_type(type_to_id<size_type>()),
                "segment offsets should be size_type");
+
+  // fast path: a single fixed-width key column without nulls, with offsets
+  // spanning the whole table, can be sorted per segment binned by size
+  if (keys.num_columns() == 1 and segment_offsets.size() > 1 and
+      cudf::is_fixed_width(keys.column(0).type()) and
+      not cudf::is_floating_point(keys.column(0).type()) and not keys.column(0).has_nulls()) {
+    auto const front = cudf::detail::get_value<size_type>(segment_offsets, 0, stream);
+    auto const back =
+      cudf::detail::get_value<size_type>(segment_offsets, segment_offsets.size() - 1, stream);
+    if (front == 0 and back == keys.num_rows()) {
+      auto const ascending = column_order.empty() or column_order.front() == order::ASCENDING;
+      return fast_segmented_sorted_order(keys.column(0), segment_offsets, ascending, stream, mr);
+    }
+  }
+
   // Get segment id of each element in all segments.
   auto segment_ids = get_segment_indices(keys.num_rows(), segment_offsets, stream);
 
@@ -16,10 +16,34 @@
 
 #include <sort/sort_impl.cuh>
 
+#include <thrust/partition.h>
+#include <thrust/transform.h>
+
 namespace cudf {
 namespace detail {
 namespace {
 
+/**
+ * @brief Predicate for partitioning null rows to one end of the indices.
+ */
+struct null_partition_fn {
+  __device__ bool operator()(size_type index) const
+  {
+    return d_column.is_null(index) == nulls_at_front;
+  }
+  column_device_view const d_column;
+  bool nulls_at_front;
+};
+
+/**
+ * @brief Gathers key values for the given row indices.
+ */
+template <typename T>
+struct gather_key_fn {
+  __device__ T operator()(size_type index) const { return d_column.element<T>(index); }
+  column_device_view const d_column;
+};
+
 /**
  * @brief Type-dispatched functor for sorting a single column.
  */
@@ -74,6 +98,66 @@ struct column_sorted_order_fn {
     CUDF_FAIL("Only fixed-width types are suitable for faster sorting");
   }
 
+  /**
+   * @brief Sorts fixed-width columns with nulls using faster thrust sort.
+   *
+   * The null rows are first partitioned to the front or the back of the indices
+   * as dictated by the sort order and null precedence. The valid rows' keys are
+   * then gathered into a contiguous buffer and sorted with the radix sort.
+   *
+   * @param input Column to sort
+   * @param indices Output sorted indices
+   * @param ascending True if sort order is ascending
+   * @param null_precedence How null rows are to be ordered
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  template <typename T, typename std::enable_if_t<is_radix_sort_supported<T>()>* = nullptr>
+  void radix_sort_with_nulls(column_view const& input,
+                             mutable_column_view& indices,
+                             bool ascending,
+                             null_order null_precedence,
+                             rmm::cuda_stream_view stream)
+  {
+    auto keys  = column_device_view::create(input, stream);
+    auto d_col = *keys;
+    // Nulls land at the front for {ASCENDING, BEFORE} and {DESCENDING, AFTER}.
+    bool const nulls_at_front = (null_precedence == null_order::BEFORE) == ascending;
+    thrust::partition(rmm::exec_policy(stream),
+                      indices.begin<size_type>(),
+                      indices.end<size_type>(),
+                      null_partition_fn{d_col, nulls_at_front});
+    auto const valid_count = input.size() - input.null_count();
+    auto const valid_first =
+      nulls_at_front ? indices.begin<size_type>() + input.null_count() : indices.begin<size_type>();
+    rmm::device_uvector<T> valid_keys(valid_count, stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      valid_first,
+                      valid_first + valid_count,
+                      valid_keys.begin(),
+                      gather_key_fn<T>{d_col});
+    if (ascending) {
+      thrust::sort_by_key(rmm::exec_policy(stream),
+                          valid_keys.begin(),
+                          valid_keys.end(),
+                          valid_first,
+                          thrust::less<T>());
+    } else {
+      thrust::sort_by_key(rmm::exec_policy(stream),
+                          valid_keys.begin(),
+                          valid_keys.end(),
+                          valid_first,
+                          thrust::greater<T>());
+    }
+    // protection for the temporary device view
+    stream.synchronize();
+  }
+  template <typename T, typename std::enable_if_t<!is_radix_sort_supported<T>()>* = nullptr>
+  void radix_sort_with_nulls(
+    column_view const&, mutable_column_view&, bool, null_order, rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Only fixed-width types are suitable for faster sorting");
+  }
+
   /**
    * @brief Sorts a single column with a relationally comparable type.
    *
@@ -93,13 +177,15 @@ struct column_sorted_order_fn {
                   null_order null_precedence,
                   rmm::cuda_stream_view stream)
   {
-    // column with nulls or non-supported types will also use a comparator
-    if (input.has_nulls() || !is_radix_sort_supported<T>()) {
+    // non-supported types will use a comparator
+    if (!is_radix_sort_supported<T>()) {
       auto keys = column_device_view::create(input, stream);
       thrust::sort(rmm::exec_policy(stream),
                    indices.begin<size_type>(),
                    indices.end<size_type>(),
                    simple_comparator<T>{*keys, input.has_nulls(), ascending, null_precedence});
+    } else if (input.has_nulls()) {
+      radix_sort_with_nulls<T>(input, indices, ascending, null_precedence, stream);
     } else {
       radix_sort<T>(input, indices, ascending, stream);
     }
@@ -30,6 +30,9 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/sequence.h>
 #include <thrust/sort.h>
 
@@ -62,6 +65,141 @@ struct simple_comparator {
   null_order null_precedence{};
 };
 
+/**
+ * @brief Computes an order-preserving unsigned bit pattern for a packable key value.
+ *
+ * The returned bits compare with unsigned less-than exactly as the values
+ * compare with the type's natural less-than.
+ */
+template <typename T, typename std::enable_if_t<std::is_same_v<T, bool>>* = nullptr>
+__device__ uint64_t ordered_key_bits(T value)
+{
+  return value ? 1 : 0;
+}
+template <typename T,
+          typename std::enable_if_t<std::is_integral_v<T> and not std::is_same_v<T, bool>>* =
+            nullptr>
+__device__ uint64_t ordered_key_bits(T value)
+{
+  using U = std::make_unsigned_t<T>;
+  auto u  = static_cast<U>(value);
+  if (std::is_signed_v<T>) { u ^= U{1} << (sizeof(T) * 8 - 1); }
+  return static_cast<uint64_t>(u);
+}
+template <typename T, typename std::enable_if_t<cudf::is_duration<T>()>* = nullptr>
+__device__ uint64_t ordered_key_bits(T value)
+{
+  return ordered_key_bits(value.count());
+}
+template <typename T, typename std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
+__device__ uint64_t ordered_key_bits(T value)
+{
+  return ordered_key_bits(value.time_since_epoch().count());
+}
+
+/**
+ * @brief Shifts the packed composite keys up and ors in one column's key bits.
+ *
+ * @tparam Column element type.
+ */
+template <typename T>
+struct pack_key_column_fn {
+  __device__ void operator()(size_type index)
+  {
+    constexpr uint64_t width = sizeof(T) * 8;
+    constexpr uint64_t mask = (width >= 64) ? ~uint64_t{0} : ((uint64_t{1} << width) - uint64_t{1});
+    auto bits               = ordered_key_bits(values[index]);
+    if (not ascending) { bits = ~bits & mask; }
+    keys[index] = (keys[index] << width) | bits;
+  }
+  uint64_t* keys;
+  T const* values;
+  bool ascending;
+};
+
+/**
+ * @brief Type-dispatched functor for packing one key column into the composite keys.
+ */
+struct composite_key_fn {
+  /**
+   * @brief Compile time check for allowing a column type into a packed composite key.
+   *
+   * Floating point is excluded for special handling of NaNs and fixed-point for
+   * scale handling; both fall back to the lexicographic comparator.
+   */
+  template <typename T>
+  static constexpr bool is_packable_key()
+  {
+    return std::is_integral_v<T> or cudf::is_chrono<T>();
+  }
+
+  template <typename T, typename std::enable_if_t<is_packable_key<T>()>* = nullptr>
+  void operator()(column_view const& input,
+                  rmm::device_uvector<uint64_t>& keys,
+                  bool ascending,
+                  rmm::cuda_stream_view stream)
+  {
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::counting_iterator<size_type>(0),
+                       input.size(),
+                       pack_key_column_fn<T>{keys.data(), input.begin<T>(), ascending});
+  }
+  template <typename T, typename std::enable_if_t<!is_packable_key<T>()>* = nullptr>
+  void operator()(column_view const&,
+                  rmm::device_uvector<uint64_t>&,
+                  bool,
+                  rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Column type cannot be packed into a composite sort key");
+  }
+};
+
+/**
+ * @brief Indicates whether a table's key columns can be packed into single 64-bit keys.
+ *
+ * Requires multiple small fixed-width, non-floating-point, non-fixed-point
+ * columns without nulls whose widths total at most 64 bits.
+ */
+inline bool is_packable_key_table(table_view const& input)
+{
+  if (input.num_columns() < 2) { return false; }
+  std::size_t total_bytes = 0;
+  for (auto const& col : input) {
+    auto const type = col.type();
+    if (col.has_nulls() or not cudf::is_fixed_width(type) or cudf::is_floating_point(type) or
+        cudf::is_fixed_point(type)) {
+      return false;
+    }
+    total_bytes += cudf::size_of(type);
+  }
+  return total_bytes <= sizeof(uint64_t);
+}
+
+/**
+ * @brief Packs the key columns of a table into one radix-sortable 64-bit key per row.
+ *
+ * The first column occupies the most significant bits so that unsigned
+ * comparison of the packed keys matches lexicographic row comparison.
+ *
+ * @param input Table of key columns satisfying `is_packable_key_table`
+ * @param column_order Ascending or descending order for each column; empty means all ascending
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return One packed key per row.
+ */
+inline rmm::device_uvector<uint64_t> make_composite_key(table_view const& input,
+                                                        std::vector<order> const& column_order,
+                                                        rmm::cuda_stream_view stream)
+{
+  auto keys = rmm::device_uvector<uint64_t>(input.num_rows(), stream);
+  thrust::fill(rmm::exec_policy(stream), keys.begin(), keys.end(), uint64_t{0});
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const ascending = column_order.empty() or column_order[i] == order::ASCENDING;
+    cudf::type_dispatcher(
+      input.column(i).type(), composite_key_fn{}, input.column(i), keys, ascending, stream);
+  }
+  return keys;
+}
+
 /**
  * @brief Sort indices of a single column.
  *
@@ -124,15 +262,30 @@ std::unique_ptr<column> sorted_order(table_view input,
                    mutable_indices_view.end<size_type>(),
                    0);
 
+  // fast-path for multiple small fixed-width key columns without nulls: pack
+  // the keys into a single 64-bit key per row and use a radix sort
+  if (is_packable_key_table(input)) {
+    auto keys = make_composite_key(input, column_order, stream);
+    if (stable) {
+      thrust::stable_sort_by_key(rmm::exec_policy(stream),
+                                 keys.begin(),
+                                 keys.end(),
+                                 mutable_indices_view.begin<size_type>());
+    } else {
+      thrust::sort_by_key(rmm::exec_policy(stream),
+                          keys.begin(),
+                          keys.end(),
+                          mutable_indices_view.begin<size_type>());
+    }
+    return sorted_indices;
+  }
+
   auto flattened = structs::detail::flatten_nested_columns(input, column_order, null_precedence);
   auto& input_flattened     = std::get<0>(flattened);
   auto device_table         = table_device_view::create(input_flattened, stream);
   auto const d_column_order = make_device_uvector_async(std::get<1>(flattened), stream);
 
-  if (has_nulls(input_flattened)) {
-    auto const d_null_precedence = make_device_uvector_async(std::get<2>(flattened), stream);
-    auto const comparator        = row_lexicographic_comparator<true>(
-      *device_table, *device_table, d_column_order.data(), d_null_precedence.data());
+  auto const sort_indices = [&](auto comparator) {
     if (stable) {
       thrust::stable_sort(rmm::exec_policy(stream),
                           mutable_indices_view.begin<size_type>(),
@@ -144,22 +297,22 @@ std::unique_ptr<column> sorted_order(table_view input,
                    mutable_indices_view.end<size_type>(),
                    comparator);
     }
+  };
+
+  // Fix the column count at compile time for narrow key tables to unroll the per-row column loop
+  if (has_nulls(input_flattened)) {
+    auto const d_null_precedence = make_device_uvector_async(std::get<2>(flattened), stream);
+    column_count_dispatcher(input_flattened.num_columns(), [&](auto num_columns) {
+      sort_indices(row_lexicographic_comparator<true, num_columns()>(
+        *device_table, *device_table, d_column_order.data(), d_null_precedence.data()));
+    });
     // protection for temporary d_column_order and d_null_precedence
     stream.synchronize();
   } else {
-    auto const comparator =
-      row_lexicographic_comparator<false>(*device_table, *device_table, d_column_order.data());
-    if (stable) {
-      thrust::stable_sort(rmm::exec_policy(stream),
-                          mutable_indices_view.begin<size_type>(),
-                          mutable_indices_view.end<size_type>(),
-                          comparator);
-    } else {
-      thrust::sort(rmm::exec_policy(stream),
-                   mutable_indices_view.begin<size_type>(),
-                   mutable_indices_view.end<size_type>(),
-                   comparator);
-    }
+    column_count_dispatcher(input_flattened.num_columns(), [&](auto num_columns) {
+      sort_indices(row_lexicographic_comparator<false, num_columns()>(
+        *device_table, *device_table, d_column_order.data()));
+    });
     // protection for temporary d_column_order
     stream.synchronize();
   }
@@ -17,6 +17,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/copy_if.cuh>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/stream_compaction.hpp>
@@ -26,6 +27,12 @@
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
 
 #include <algorithm>
 
@@ -82,6 +89,101 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
   }
 }
 
+/*
+ * Converts a boolean mask into the gather map of the selected rows.
+ *
+ * A single copy_if over a counting sequence; this is the same scan apply_boolean_mask
+ * performs implicitly.
+ */
+std::unique_ptr<column> mask_to_indices(column_view const& boolean_mask,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(boolean_mask.is_empty() || boolean_mask.type().id() == type_id::BOOL8,
+               "Mask must be Boolean type");
+
+  rmm::device_uvector<size_type> indices(boolean_mask.size(), stream, mr);
+  auto const begin = thrust::make_counting_iterator<size_type>(0);
+
+  auto indices_end = indices.begin();
+  if (!boolean_mask.is_empty()) {
+    auto device_boolean_mask = cudf::column_device_view::create(boolean_mask, stream);
+    if (boolean_mask.has_nulls()) {
+      indices_end = thrust::copy_if(rmm::exec_policy(stream),
+                                    begin,
+                                    begin + boolean_mask.size(),
+                                    indices.begin(),
+                                    boolean_mask_filter<true>{*device_boolean_mask});
+    } else {
+      indices_end = thrust::copy_if(rmm::exec_policy(stream),
+                                    begin,
+                                    begin + boolean_mask.size(),
+                                    indices.begin(),
+                                    boolean_mask_filter<false>{*device_boolean_mask});
+    }
+  }
+  indices.resize(thrust::distance(indices.begin(), indices_end), stream);
+  indices.shrink_to_fit(stream);
+
+  auto const num_indices = static_cast<size_type>(indices.size());
+  return std::make_unique<column>(
+    data_type{type_to_id<size_type>()}, num_indices, indices.release());
+}
+
+/*
+ * Filters a table_view by a boolean mask, also returning the selected row indices.
+ *
+ * The mask is scanned once by mask_to_indices; the table is then materialized by a
+ * bounds-unchecked gather with the resulting map.
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> apply_boolean_mask_with_indices(
+  table_view const& input,
+  column_view const& boolean_mask,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  // zero-size inputs are OK, but otherwise input size must match mask size
+  CUDF_EXPECTS(input.num_rows() == 0 || input.num_rows() == boolean_mask.size(),
+               "Column size mismatch");
+
+  auto indices = mask_to_indices(boolean_mask, stream, mr);
+  if (input.num_rows() == 0 || indices->size() == 0) {
+    return {empty_like(input), std::move(indices)};
+  }
+
+  auto result = detail::gather(input,
+                               indices->view(),
+                               out_of_bounds_policy::DONT_CHECK,
+                               negative_index_policy::NOT_ALLOWED,
+                               stream,
+                               mr);
+  return {std::move(result), std::move(indices)};
+}
+
+/*
+ * Filters a table_view by a boolean mask into preallocated destination columns.
+ *
+ * The mask is scanned once by mask_to_indices; the selected rows are then written by an
+ * in-place gather with the resulting map. Only the indices are allocated per call.
+ */
+size_type apply_boolean_mask_in_place(table_view const& input,
+                                      column_view const& boolean_mask,
+                                      mutable_table_view& destination,
+                                      rmm::cuda_stream_view stream)
+{
+  // zero-size inputs are OK, but otherwise input size must match mask size
+  CUDF_EXPECTS(input.num_rows() == 0 || input.num_rows() == boolean_mask.size(),
+               "Column size mismatch");
+
+  auto indices = mask_to_indices(boolean_mask, stream, rmm::mr::get_current_device_resource());
+  auto const num_selected = indices->size();
+  CUDF_EXPECTS(num_selected <= destination.num_rows(),
+               "Destination does not have capacity for the selected rows.");
+
+  if (num_selected > 0) { gather_in_place(input, indices->view(), destination, stream); }
+  return num_selected;
+}
+
 }  // namespace detail
 
 /*
@@ -94,4 +196,27 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
   CUDF_FUNC_RANGE();
   return detail::apply_boolean_mask(input, boolean_mask, rmm::cuda_stream_default, mr);
 }
+
+std::unique_ptr<column> mask_to_indices(column_view const& boolean_mask,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::mask_to_indices(boolean_mask, rmm::cuda_stream_default, mr);
+}
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> apply_boolean_mask_with_indices(
+  table_view const& input, column_view const& boolean_mask, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::apply_boolean_mask_with_indices(input, boolean_mask, rmm::cuda_stream_default, mr);
+}
+
+size_type apply_boolean_mask_in_place(table_view const& input,
+                                      column_view const& boolean_mask,
+                                      mutable_table_view& destination)
+{
+  CUDF_FUNC_RANGE();
+  return detail::apply_boolean_mask_in_place(
+    input, boolean_mask, destination, rmm::cuda_stream_default);
+}
 }  // namespace cudf
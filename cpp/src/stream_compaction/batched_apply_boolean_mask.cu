@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/gather.h>
+#include <thrust/scan.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Converts a boolean mask element into a row count, treating nulls as false.
+ */
+struct mask_true_fn {
+  column_device_view d_mask;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    return (d_mask.is_valid(i) && d_mask.element<bool>(i)) ? 1 : 0;
+  }
+};
+
+}  // namespace
+
+std::vector<std::unique_ptr<table>> batched_apply_boolean_mask(
+  std::vector<table_view> const& inputs,
+  std::vector<column_view> const& boolean_masks,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(inputs.size() == boolean_masks.size(),
+               "Mismatched number of tables and boolean masks");
+  std::vector<std::unique_ptr<table>> results;
+  if (inputs.empty()) { return results; }
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    CUDF_EXPECTS(inputs[i].num_rows() == boolean_masks[i].size(),
+                 "Column size mismatch in apply_boolean_mask.");
+  }
+  if (inputs.size() == 1) {
+    results.push_back(apply_boolean_mask(inputs.front(), boolean_masks.front(), stream, mr));
+    return results;
+  }
+
+  // Filter the whole batch with one set of kernels: concatenate the tables and masks, apply the
+  // combined mask, then split the result back into per-table copies. Schema and mask type
+  // mismatches are detected by the concatenations.
+  auto const combined      = concatenate(host_span<table_view const>{inputs}, stream);
+  auto const combined_mask = concatenate(host_span<column_view const>{boolean_masks}, stream);
+  auto const total_rows    = combined_mask->size();
+
+  if (total_rows == 0) {
+    std::transform(
+      inputs.begin(), inputs.end(), std::back_inserter(results), [stream, mr](table_view const& t) {
+        return std::make_unique<table>(t, stream, mr);
+      });
+    return results;
+  }
+
+  auto const filtered = apply_boolean_mask(combined->view(), combined_mask->view(), stream);
+
+  std::vector<size_type> h_offsets(inputs.size() + 1, 0);
+  std::transform(inputs.begin(),
+                 inputs.end(),
+                 std::next(h_offsets.begin()),
+                 [sum = size_type{0}](table_view const& t) mutable { return sum += t.num_rows(); });
+
+  // Each table's result size is the cumulative count of mask rows kept up to its end offset
+  auto const d_mask = column_device_view::create(combined_mask->view(), stream);
+  rmm::device_uvector<size_type> d_scan(total_rows, stream);
+  auto const mask_rows = make_counting_transform_iterator(0, mask_true_fn{*d_mask});
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), mask_rows, mask_rows + total_rows, d_scan.begin());
+
+  std::vector<size_type> h_bound_positions(inputs.size() - 1);
+  std::transform(h_offsets.begin() + 1,
+                 h_offsets.end() - 1,
+                 h_bound_positions.begin(),
+                 [](size_type offset) { return std::max(offset, size_type{1}) - 1; });
+  auto const d_bound_positions = make_device_uvector_async(h_bound_positions, stream);
+  rmm::device_uvector<size_type> d_split_points(h_bound_positions.size(), stream);
+  thrust::gather(rmm::exec_policy(stream),
+                 d_bound_positions.begin(),
+                 d_bound_positions.end(),
+                 d_scan.begin(),
+                 d_split_points.begin());
+  auto splits = make_std_vector_sync(d_split_points, stream);
+  // tables at the front of the batch may be empty; their end offset precedes any mask row
+  for (std::size_t i = 0; i < splits.size(); ++i) {
+    if (h_offsets[i + 1] == 0) { splits[i] = 0; }
+  }
+
+  for (auto const& filtered_view : cudf::split(filtered->view(), splits)) {
+    results.push_back(std::make_unique<table>(filtered_view, stream, mr));
+  }
+  return results;
+}
+
+}  // namespace detail
+
+std::vector<std::unique_ptr<table>> batched_apply_boolean_mask(
+  std::vector<table_view> const& inputs,
+  std::vector<column_view> const& boolean_masks,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::batched_apply_boolean_mask(inputs, boolean_masks, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
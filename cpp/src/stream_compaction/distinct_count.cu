@@ -20,16 +20,28 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/count.h>
 #include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/transform.h>
+#include <thrust/uninitialized_fill.h>
+
+#include <cmath>
+#include <limits>
 #include <vector>
 
 namespace cudf {
@@ -149,6 +161,134 @@ struct has_nans {
   }
 };
 
+namespace {
+
+constexpr int32_t min_sketch_precision = 4;
+constexpr int32_t max_sketch_precision = 18;
+
+/**
+ * @brief Folds the row hashes of `input` into a set of HyperLogLog registers.
+ *
+ * Each 32-bit row hash is split into a `precision`-bit register index and a
+ * `32 - precision`-bit suffix; the register keeps the maximum leading-zero
+ * rank of the suffixes that map to it.
+ */
+template <bool has_nulls>
+void update_sketch_registers(table_view const& input,
+                             device_span<int32_t> registers,
+                             int32_t precision,
+                             rmm::cuda_stream_view stream)
+{
+  auto const device_input = table_device_view::create(input, stream);
+  auto const hasher       = row_hasher<default_hash, has_nulls>(*device_input);
+  auto const d_registers  = registers.data();
+  thrust::for_each(rmm::exec_policy(stream),
+                   thrust::counting_iterator<size_type>(0),
+                   thrust::counting_iterator<size_type>(input.num_rows()),
+                   [hasher, d_registers, precision] __device__(size_type row) {
+                     auto const hash   = hasher(row);
+                     auto const bucket = hash >> (32 - precision);
+                     auto const suffix = hash << precision;
+                     auto const rank =
+                       suffix == 0 ? 32 - precision + 1 : __clz(static_cast<int32_t>(suffix)) + 1;
+                     atomicMax(&d_registers[bucket], rank);
+                   });
+}
+
+/**
+ * @brief Standard HyperLogLog estimator with small- and large-range
+ * corrections for 32-bit hashes.
+ */
+double estimate_cardinality(std::vector<uint8_t> const& registers)
+{
+  auto const num_registers = static_cast<double>(registers.size());
+
+  double harmonic_sum = 0.0;
+  std::size_t zeros   = 0;
+  for (auto const r : registers) {
+    harmonic_sum += std::ldexp(1.0, -r);
+    if (r == 0) { ++zeros; }
+  }
+
+  auto const alpha = [&] {
+    switch (registers.size()) {
+      case 16: return 0.673;
+      case 32: return 0.697;
+      case 64: return 0.709;
+      default: return 0.7213 / (1.0 + 1.079 / num_registers);
+    }
+  }();
+
+  auto estimate = alpha * num_registers * num_registers / harmonic_sum;
+  if (estimate <= 2.5 * num_registers and zeros > 0) {
+    estimate = num_registers * std::log(num_registers / zeros);
+  } else if (auto constexpr two_pow_32 = 4294967296.0; estimate > two_pow_32 / 30.0) {
+    estimate = -two_pow_32 * std::log1p(-estimate / two_pow_32);
+  }
+  return estimate;
+}
+
+}  // namespace
+
+std::unique_ptr<column> distinct_count_sketch(table_view const& input,
+                                              int32_t precision,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(precision >= min_sketch_precision and precision <= max_sketch_precision,
+               "Sketch precision must be in [4, 18]");
+
+  auto const num_registers = size_type{1} << precision;
+
+  // atomicMax has no 8-bit overload, so accumulate into 32-bit scratch
+  // registers and narrow into the output sketch afterwards.
+  rmm::device_uvector<int32_t> registers(num_registers, stream, get_temp_memory_resource());
+  thrust::uninitialized_fill(rmm::exec_policy(stream), registers.begin(), registers.end(), 0);
+
+  if (input.num_rows() > 0 and input.num_columns() > 0) {
+    if (cudf::has_nulls(input)) {
+      update_sketch_registers<true>(input, registers, precision, stream);
+    } else {
+      update_sketch_registers<false>(input, registers, precision, stream);
+    }
+  }
+
+  auto sketch = make_numeric_column(
+    data_type{type_id::UINT8}, num_registers, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    registers.begin(),
+                    registers.end(),
+                    sketch->mutable_view().begin<uint8_t>(),
+                    [] __device__(int32_t r) { return static_cast<uint8_t>(r); });
+  return sketch;
+}
+
+cudf::size_type approx_distinct_count(column_view const& sketch, rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(sketch.type().id() == type_id::UINT8, "Sketch must be a UINT8 column");
+  CUDF_EXPECTS(not sketch.has_nulls(), "Sketch must not contain nulls");
+  CUDF_EXPECTS(sketch.size() >= (1 << min_sketch_precision) and
+                 sketch.size() <= (1 << max_sketch_precision) and
+                 (sketch.size() & (sketch.size() - 1)) == 0,
+               "Sketch size must be a power of two in [2^4, 2^18]");
+
+  auto const registers = cudf::detail::make_std_vector_sync(
+    device_span<uint8_t const>{sketch.data<uint8_t>(), static_cast<std::size_t>(sketch.size())},
+    stream);
+
+  auto const estimate = estimate_cardinality(registers);
+  return static_cast<size_type>(
+    std::min(estimate, static_cast<double>(std::numeric_limits<size_type>::max())));
+}
+
+cudf::size_type approx_distinct_count(table_view const& input,
+                                      int32_t precision,
+                                      rmm::cuda_stream_view stream)
+{
+  auto const sketch = distinct_count_sketch(input, precision, stream, get_temp_memory_resource());
+  return approx_distinct_count(sketch->view(), stream);
+}
+
 cudf::size_type distinct_count(column_view const& input,
                                null_policy null_handling,
                                nan_policy nan_handling,
@@ -195,4 +335,25 @@ cudf::size_type distinct_count(table_view const& input, null_equality nulls_equa
   return detail::distinct_count(input, nulls_equal);
 }
 
+std::unique_ptr<column> distinct_count_sketch(table_view const& input,
+                                              int32_t precision,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::distinct_count_sketch(input, precision, stream, mr);
+}
+
+cudf::size_type approx_distinct_count(table_view const& input, int32_t precision)
+{
+  CUDF_FUNC_RANGE();
+  return detail::approx_distinct_count(input, precision);
+}
+
+cudf::size_type approx_distinct_count(column_view const& sketch)
+{
+  CUDF_FUNC_RANGE();
+  return detail::approx_distinct_count(sketch);
+}
+
 }  // namespace cudf
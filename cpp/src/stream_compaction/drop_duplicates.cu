@@ -22,19 +22,25 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
+#include <hash/concurrent_unordered_map.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/copy.h>
 #include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/transform_iterator.h>
 
+#include <limits>
 #include <vector>
 
 namespace cudf {
@@ -80,6 +86,80 @@ struct unique_copy_fn {
   size_type const last_index;
 };
 
+/**
+ * @brief Inserts a row index into a hash map keyed on the row itself.
+ *
+ * The first row of each duplicate group wins the insert; later duplicates
+ * find the existing entry and leave it untouched.
+ */
+template <typename map_type>
+struct insert_row_fn {
+  map_type map;
+  __device__ void operator()(size_type i) { map.insert(thrust::make_pair(i, i)); }
+};
+
+/**
+ * @brief Hash-based drop_duplicates for KEEP_ANY semantics.
+ *
+ * Inserts every row of `keys` into a hash map keyed on the row and gathers the
+ * rows that won their slot, which avoids sorting the table entirely. Which
+ * duplicate survives and the order of the output rows are unspecified.
+ */
+template <bool has_nulls>
+std::unique_ptr<table> hash_drop_duplicates(table_view const& input,
+                                            table_view const& keys,
+                                            null_equality nulls_equal,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = keys.num_rows();
+  auto const d_keys   = table_device_view::create(keys, stream);
+
+  size_type constexpr unused_key{std::numeric_limits<size_type>::max()};
+  size_type constexpr unused_value{std::numeric_limits<size_type>::max()};
+  using map_type = concurrent_unordered_map<size_type,
+                                            size_type,
+                                            row_hasher<default_hash, has_nulls>,
+                                            row_equality_comparator<has_nulls>>;
+
+  row_hasher<default_hash, has_nulls> hasher{*d_keys};
+  row_equality_comparator<has_nulls> rows_equal{
+    *d_keys, *d_keys, nulls_equal == null_equality::EQUAL};
+  auto map = map_type::create(compute_hash_table_size(num_rows),
+                              stream,
+                              unused_key,
+                              unused_value,
+                              hasher,
+                              rows_equal,
+                              typename map_type::allocator_type());
+
+  thrust::for_each(rmm::exec_policy(stream),
+                   thrust::counting_iterator<size_type>(0),
+                   thrust::counting_iterator<size_type>(num_rows),
+                   insert_row_fn<map_type>{*map});
+
+  // Collect the surviving row index of each duplicate group
+  rmm::device_uvector<size_type> distinct_indices(num_rows, stream);
+  auto get_key    = [] __device__(auto const& element) { return element.first; };  // first = key
+  auto get_key_it = thrust::make_transform_iterator(map->data(), get_key);
+  auto key_used   = [unused_key] __device__(auto key) { return key != unused_key; };
+  auto end_it     = thrust::copy_if(rmm::exec_policy(stream),
+                                get_key_it,
+                                get_key_it + map->capacity(),
+                                distinct_indices.begin(),
+                                key_used);
+  distinct_indices.resize(thrust::distance(distinct_indices.begin(), end_it), stream);
+
+  return detail::gather(input,
+                        column_view{data_type{type_id::INT32},
+                                    static_cast<size_type>(distinct_indices.size()),
+                                    distinct_indices.data()},
+                        out_of_bounds_policy::DONT_CHECK,
+                        detail::negative_index_policy::NOT_ALLOWED,
+                        stream,
+                        mr);
+}
+
 }  // namespace
 
 /**
@@ -193,6 +273,12 @@ std::unique_ptr<table> drop_duplicates(table_view const& input,
 
   auto keys_view = input.select(keys);
 
+  if (keep == duplicate_keep_option::KEEP_ANY) {
+    return cudf::has_nulls(keys_view)
+             ? hash_drop_duplicates<true>(input, keys_view, nulls_equal, stream, mr)
+             : hash_drop_duplicates<false>(input, keys_view, nulls_equal, stream, mr);
+  }
+
   // The values will be filled into this column
   auto unique_indices = cudf::make_numeric_column(
     data_type{type_id::INT32}, keys_view.num_rows(), mask_state::UNALLOCATED, stream);
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/detail/instrumentation.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace detail {
+
+std::unique_ptr<table> filter(table_view const& input,
+                              ast::expression const& predicate,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  // The boolean column is operator-scoped scratch: it comes from the
+  // temporary resource and is dropped before returning, so callers never pay
+  // a pool allocation for it. Evaluating once and compacting with the
+  // block-scan copy_if beats folding the expression into the copy_if
+  // predicate, which would re-evaluate it in the counting kernel and again
+  // for every output column.
+  auto boolean_mask =
+    cudf::detail::compute_column(input, predicate, stream, get_temp_memory_resource());
+  CUDF_EXPECTS(boolean_mask->view().type().id() == type_id::BOOL8,
+               "Predicate expression must evaluate to a boolean");
+  return detail::apply_boolean_mask(input, boolean_mask->view(), stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> filter(table_view const& input,
+                              ast::expression const& predicate,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_OP_RANGE(input.num_rows());
+  return detail::filter(input, predicate, stream, mr);
+}
+
+}  // namespace cudf
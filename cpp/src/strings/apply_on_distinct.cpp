@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/strings/apply_on_distinct.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <utility>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+std::unique_ptr<column> apply_on_distinct(
+  strings_column_view const& input,
+  std::function<std::unique_ptr<column>(strings_column_view const&)> const& op,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  if (input.size() == 0) { return op(input); }
+
+  // encode into temporary memory; only the decoded result uses mr
+  auto dictionary =
+    cudf::dictionary::detail::encode(input.parent(), data_type{type_id::UINT32}, stream);
+  auto const d_view = dictionary_column_view(dictionary->view());
+
+  auto transformed = op(strings_column_view(d_view.keys()));
+  CUDF_EXPECTS(transformed != nullptr && transformed->type().id() == type_id::STRING,
+               "op must produce a strings column");
+  CUDF_EXPECTS(transformed->size() == d_view.keys_size(),
+               "op must produce one row per distinct value");
+  CUDF_EXPECTS(!transformed->has_nulls(), "op must not produce null rows");
+
+  auto contents         = dictionary->release();
+  auto indices          = std::move(contents.children.front());
+  auto const null_count = input.null_count();
+
+  // the transformed values may no longer be unique or ordered but decode only
+  // gathers them by index so that is of no consequence here
+  auto result_dictionary = make_dictionary_column(
+    std::move(transformed), std::move(indices), std::move(*contents.null_mask), null_count);
+  return cudf::dictionary::detail::decode(
+    dictionary_column_view(result_dictionary->view()), stream, mr);
+}
+
+}  // namespace detail
+
+// external API
+
+std::unique_ptr<column> apply_on_distinct(
+  strings_column_view const& input,
+  std::function<std::unique_ptr<column>(strings_column_view const&)> const& op,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::apply_on_distinct(input, op, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace strings
+}  // namespace cudf
@@ -20,10 +20,12 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/case.hpp>
 #include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/error.hpp>
@@ -34,6 +36,9 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/logical.h>
+#include <thrust/transform.h>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -110,6 +115,26 @@ struct upper_lower_fn {
   }
 };
 
+/**
+ * @brief Per byte case conversion for ASCII-only columns.
+ *
+ * When no byte requires the UTF-8 decode or a special (multi-character)
+ * mapping, the conversion is a 1:1 byte mapping and the kernel can process
+ * one byte per thread instead of walking each string serially per character.
+ */
+struct ascii_converter_fn {
+  character_flags_table_type case_flag;  // flag to check with on each character
+  const character_flags_table_type* d_flags;
+  const character_cases_table_type* d_case_table;
+
+  __device__ char operator()(char chr)
+  {
+    auto const code_point = static_cast<uint32_t>(static_cast<uint8_t>(chr));
+    auto const flag       = d_flags[code_point];
+    return (flag & case_flag) ? static_cast<char>(d_case_table[code_point]) : chr;
+  }
+};
+
 /**
  * @brief Utility method for converting upper and lower case characters
  * in a strings column.
@@ -127,15 +152,59 @@ std::unique_ptr<column> convert_case(strings_column_view const& strings,
 {
   if (strings.is_empty()) return make_empty_column(data_type{type_id::STRING});
 
+  auto const strings_count = strings.size();
+  auto const d_flags       = get_character_flags_table();
+
+  // ASCII fast path: if no byte needs the UTF-8 decode or a special mapping,
+  // the output bytes map 1:1 to the input bytes so the input offsets can be
+  // reused and the chars converted one byte per thread. The scan to detect
+  // this is a single coalesced read of the chars data.
+  auto const first_offset =
+    cudf::detail::get_value<int32_t>(strings.offsets(), strings.offset(), stream);
+  auto const last_offset =
+    cudf::detail::get_value<int32_t>(strings.offsets(), strings.offset() + strings_count, stream);
+  auto const chars_bytes = last_offset - first_offset;
+  auto const d_chars     = strings.chars().data<char>();
+  auto const ascii_only  = thrust::all_of(rmm::exec_policy(stream),
+                                         d_chars + first_offset,
+                                         d_chars + last_offset,
+                                         [d_flags] __device__(char chr) {
+                                           auto const code_point =
+                                             static_cast<uint32_t>(static_cast<uint8_t>(chr));
+                                           return (code_point < 0x0080) &&
+                                                  !IS_SPECIAL(d_flags[code_point]);
+                                         });
+  if (ascii_only) {
+    // copy the input offsets, rebasing them in case the column is sliced
+    auto offsets_column = make_numeric_column(
+      data_type{type_id::INT32}, strings_count + 1, mask_state::UNALLOCATED, stream, mr);
+    auto const d_in_offsets = strings.offsets().data<int32_t>() + strings.offset();
+    thrust::transform(rmm::exec_policy(stream),
+                      d_in_offsets,
+                      d_in_offsets + strings_count + 1,
+                      offsets_column->mutable_view().data<int32_t>(),
+                      [first_offset] __device__(int32_t offset) { return offset - first_offset; });
+    // convert the chars in parallel
+    auto chars_column = create_chars_child_column(chars_bytes, stream, mr);
+    thrust::transform(rmm::exec_policy(stream),
+                      d_chars + first_offset,
+                      d_chars + last_offset,
+                      chars_column->mutable_view().data<char>(),
+                      ascii_converter_fn{case_flag, d_flags, get_character_cases_table()});
+
+    return make_strings_column(strings_count,
+                               std::move(offsets_column),
+                               std::move(chars_column),
+                               strings.null_count(),
+                               cudf::detail::copy_bitmask(strings.parent(), stream, mr));
+  }
+
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_column       = *strings_column;
 
   // build functor with lookup tables used for case conversion
-  upper_lower_fn functor{d_column,
-                         case_flag,
-                         get_character_flags_table(),
-                         get_character_cases_table(),
-                         get_special_case_mapping_table()};
+  upper_lower_fn functor{
+    d_column, case_flag, d_flags, get_character_cases_table(), get_special_case_mapping_table()};
 
   // this utility calls the functor to build the offsets and chars columns
   auto children = cudf::strings::detail::make_strings_children(functor, strings.size(), stream, mr);
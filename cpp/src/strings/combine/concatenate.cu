@@ -17,6 +17,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/strings/combine.hpp>
@@ -161,6 +162,131 @@ std::unique_ptr<column> concatenate(table_view const& strings_columns,
 
 namespace {
 
+/**
+ * @brief Concatenate strings functor with a distinct separator per column gap.
+ *
+ * The separator written between two adjacent columns is selected by the
+ * position of the right-hand column, inlining distinct scalar separators
+ * into the same single pair of size/copy passes used by the
+ * single-separator concatenate.
+ */
+struct gap_separators_concat_fn : concat_strings_base {
+  char const* d_separator_chars;
+  offset_type const* d_separator_offsets;
+
+  gap_separators_concat_fn(table_device_view const& d_table,
+                           string_scalar_device_view const& d_narep,
+                           separator_on_nulls separate_nulls,
+                           char const* d_separator_chars,
+                           offset_type const* d_separator_offsets)
+    : concat_strings_base{d_table, d_narep, separate_nulls},
+      d_separator_chars(d_separator_chars),
+      d_separator_offsets(d_separator_offsets)
+  {
+  }
+
+  __device__ void operator()(size_type idx)
+  {
+    if (!d_narep.is_valid() &&
+        thrust::any_of(thrust::seq, d_table.begin(), d_table.end(), [idx](auto const& col) {
+          return col.is_null(idx);
+        })) {
+      if (!d_chars) d_offsets[idx] = 0;
+      return;
+    }
+
+    char* d_buffer       = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    offset_type bytes    = 0;
+    bool write_separator = false;
+
+    for (size_type col = 0; col < d_table.num_columns(); ++col) {
+      auto const d_column     = d_table.column(col);
+      bool const null_element = d_column.is_null(idx);
+
+      if (write_separator && (separate_nulls == separator_on_nulls::YES || !null_element)) {
+        // the separator preceding this column
+        auto const d_separator =
+          string_view(d_separator_chars + d_separator_offsets[col - 1],
+                      d_separator_offsets[col] - d_separator_offsets[col - 1]);
+        if (d_buffer) d_buffer = detail::copy_string(d_buffer, d_separator);
+        bytes += d_separator.size_bytes();
+        write_separator = false;
+      }
+
+      // write out column's row data (or narep if the row is null)
+      auto const d_str = null_element ? d_narep.value() : d_column.element<string_view>(idx);
+      if (d_buffer) d_buffer = detail::copy_string(d_buffer, d_str);
+      bytes += d_str.size_bytes();
+
+      write_separator =
+        write_separator || (separate_nulls == separator_on_nulls::YES) || !null_element;
+    }
+
+    if (!d_chars) d_offsets[idx] = bytes;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> concatenate(table_view const& strings_columns,
+                                    host_span<std::string const> separators,
+                                    string_scalar const& narep,
+                                    separator_on_nulls separate_nulls,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  auto const num_columns = strings_columns.num_columns();
+  CUDF_EXPECTS(num_columns > 1, "At least two columns must be specified");
+  CUDF_EXPECTS(static_cast<size_type>(separators.size()) == num_columns - 1,
+               "A separator is required between each pair of adjacent columns");
+  // check all columns are of type string
+  CUDF_EXPECTS(std::all_of(strings_columns.begin(),
+                           strings_columns.end(),
+                           [](auto c) { return c.type().id() == type_id::STRING; }),
+               "All columns must be of type string");
+  auto const strings_count = strings_columns.num_rows();
+  if (strings_count == 0)  // empty begets empty
+    return make_empty_column(data_type{type_id::STRING});
+
+  // pack the separators into a single device buffer
+  std::vector<offset_type> h_separator_offsets(1, 0);
+  std::vector<char> h_separator_chars;
+  for (auto const& separator : separators) {
+    h_separator_chars.insert(h_separator_chars.end(), separator.begin(), separator.end());
+    h_separator_offsets.push_back(static_cast<offset_type>(h_separator_chars.size()));
+  }
+  auto d_separator_chars   = cudf::detail::make_device_uvector_async(h_separator_chars, stream);
+  auto d_separator_offsets = cudf::detail::make_device_uvector_async(h_separator_offsets, stream);
+
+  auto d_narep = get_scalar_device_view(const_cast<string_scalar&>(narep));
+
+  // Create device views from the strings columns.
+  auto d_table = table_device_view::create(strings_columns, stream);
+  gap_separators_concat_fn fn{
+    *d_table, d_narep, separate_nulls, d_separator_chars.data(), d_separator_offsets.data()};
+  auto children = make_strings_children(fn, strings_count, stream, mr);
+
+  // create resulting null mask
+  auto [null_mask, null_count] = cudf::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(strings_count),
+    [d_table = *d_table, d_narep] __device__(size_type idx) {
+      if (d_narep.is_valid()) return true;
+      return !thrust::any_of(
+        thrust::seq, d_table.begin(), d_table.end(), [idx](auto col) { return col.is_null(idx); });
+    },
+    stream,
+    mr);
+
+  return make_strings_column(strings_count,
+                             std::move(children.first),
+                             std::move(children.second),
+                             null_count,
+                             std::move(null_mask));
+}
+
+namespace {
+
 /**
  * @brief Concatenate strings functor using multiple separators.
  *
@@ -270,6 +396,17 @@ std::unique_ptr<column> concatenate(table_view const& strings_columns,
     strings_columns, separator, narep, separate_nulls, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> concatenate(table_view const& strings_columns,
+                                    host_span<std::string const> separators,
+                                    string_scalar const& narep,
+                                    separator_on_nulls separate_nulls,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::concatenate(
+    strings_columns, separators, narep, separate_nulls, rmm::cuda_stream_default, mr);
+}
+
 std::unique_ptr<column> concatenate(table_view const& strings_columns,
                                     strings_column_view const& separators,
                                     string_scalar const& separator_narep,
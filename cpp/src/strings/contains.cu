@@ -19,20 +19,104 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/strings/contains.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <strings/jit/contains_jit.hpp>
 #include <strings/regex/regex.cuh>
 #include <strings/utilities.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/for_each.h>
+
+#include <algorithm>
+
 namespace cudf {
 namespace strings {
 namespace detail {
 namespace {
+
+/// Average string byte length above which the warp-parallel kernel is used
+constexpr size_type AVG_CHAR_BYTES_THRESHOLD = 64;
+
+constexpr size_type contains_block_size = 256;
+
+/**
+ * @brief Kernel evaluating contains_re with a full warp per string.
+ *
+ * Each lane owns an equal slice of the possible match starting positions and
+ * runs the regex engine over just that slice; the per-lane results are then
+ * combined with a warp vote. This keeps all 32 lanes busy on long strings
+ * where one-thread-per-string leaves most of the GPU idle.
+ *
+ * This is only valid for the unanchored contains case: any lane finding a
+ * match (regardless of which is leftmost) answers the predicate. It also
+ * requires the stack-based state memory since the global memory relists are
+ * allocated one set per string, not per lane.
+ */
+template <int stack_size>
+__global__ void contains_warp_parallel_kernel(reprog_device prog,
+                                              column_device_view d_strings,
+                                              bool* d_results)
+{
+  auto const tid  = static_cast<std::size_t>(threadIdx.x) + blockIdx.x * blockDim.x;
+  auto const idx  = static_cast<size_type>(tid / cudf::detail::warp_size);
+  auto const lane = static_cast<size_type>(tid % cudf::detail::warp_size);
+  if (idx >= d_strings.size()) { return; }
+
+  bool found = false;
+  if (!d_strings.is_null(idx)) {
+    auto const d_str  = d_strings.element<string_view>(idx);
+    auto const nchars = d_str.length();
+    // chunk size is chosen so the lane ranges tile [0, nchars] inclusive;
+    // position nchars is included so an empty match at end-of-string is found
+    auto const chunk = (nchars / cudf::detail::warp_size) + 1;
+    int32_t begin    = lane * chunk;
+    int32_t end      = min(begin + chunk, nchars + 1);
+    if (begin <= nchars) { found = prog.find<stack_size>(idx, d_str, begin, end) > 0; }
+  }
+  auto const any_found = __any_sync(0xffffffffu, found);
+  if (lane == 0) { d_results[idx] = static_cast<bool>(any_found); }
+}
+
+/**
+ * @brief This functor evaluates all the given regex programs against one string,
+ * writing into one output column per program.
+ *
+ * The string is resident in cache after the first program touches it so the
+ * remaining programs avoid re-reading it from device memory.
+ */
+template <int stack_size>
+struct contains_multiple_fn {
+  column_device_view d_strings;
+  reprog_device* d_progs;
+  size_type num_patterns;
+  bool* const* d_outputs;
+
+  __device__ void operator()(size_type idx)
+  {
+    bool const valid  = !d_strings.is_null(idx);
+    string_view d_str = valid ? d_strings.element<string_view>(idx) : string_view{};
+    for (size_type pattern_idx = 0; pattern_idx < num_patterns; ++pattern_idx) {
+      bool found = false;
+      if (valid) {
+        auto prog     = d_progs[pattern_idx];
+        int32_t begin = 0;
+        int32_t end   = -1;
+        found         = prog.find<stack_size>(idx, d_str, begin, end) > 0;
+      }
+      d_outputs[pattern_idx][idx] = found;
+    }
+  }
+};
+
 /**
  * @brief This functor handles both contains_re and match_re to minimize the number
  * of regex calls to find() to be inlined greatly reducing compile time.
@@ -70,6 +154,13 @@ std::unique_ptr<column> contains_util(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
+  // simple patterns (literals, character classes, anchors) are lowered to a
+  // specialized kernel compiled through the JIT program cache, skipping the
+  // interpreted regex engine entirely
+  if (is_jit_supported_pattern(pattern)) {
+    return contains_re_jit(strings, pattern, beginning_only, stream, mr);
+  }
+
   auto strings_count  = strings.size();
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_column       = *strings_column;
@@ -89,6 +180,30 @@ std::unique_ptr<column> contains_util(
 
   // fill the output column
   int regex_insts = d_prog.insts_counts();
+
+  // long strings are processed with a warp per string but only for the unanchored
+  // predicate (any lane's match answers it) and only when each lane can hold the
+  // regex state in its own stack memory
+  if (!beginning_only && (strings_count > 0) && (regex_insts <= RX_LARGE_INSTS) &&
+      ((strings.chars_size() / strings_count) > AVG_CHAR_BYTES_THRESHOLD)) {
+    // avg length > 64B bounds strings_count well below overflowing these threads
+    cudf::detail::grid_1d grid{strings_count * cudf::detail::warp_size, contains_block_size};
+    if (regex_insts <= RX_SMALL_INSTS)
+      contains_warp_parallel_kernel<RX_STACK_SMALL>
+        <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+          d_prog, d_column, d_results);
+    else if (regex_insts <= RX_MEDIUM_INSTS)
+      contains_warp_parallel_kernel<RX_STACK_MEDIUM>
+        <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+          d_prog, d_column, d_results);
+    else
+      contains_warp_parallel_kernel<RX_STACK_LARGE>
+        <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+          d_prog, d_column, d_results);
+    results->set_null_count(strings.null_count());
+    return results;
+  }
+
   if (regex_insts <= RX_SMALL_INSTS)
     thrust::transform(rmm::exec_policy(stream),
                       thrust::make_counting_iterator<size_type>(0),
@@ -138,6 +253,79 @@ std::unique_ptr<column> matches_re(
   return contains_util(strings, pattern, true, stream, mr);
 }
 
+std::unique_ptr<table> contains_multiple_re(
+  strings_column_view const& strings,
+  std::vector<std::string> const& patterns,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  CUDF_EXPECTS(!patterns.empty(), "Must specify at least one pattern");
+
+  auto const strings_count = strings.size();
+  auto const num_patterns  = static_cast<size_type>(patterns.size());
+  auto strings_column      = column_device_view::create(strings.parent(), stream);
+  auto d_column            = *strings_column;
+
+  // compile each pattern; the progs vector keeps the device allocations alive
+  std::vector<std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>> progs;
+  std::vector<reprog_device> h_progs;
+  int max_insts = 0;
+  for (auto const& pattern : patterns) {
+    auto prog = reprog_device::create(pattern, get_character_flags_table(), strings_count, stream);
+    max_insts = std::max(max_insts, prog->insts_counts());
+    h_progs.push_back(*prog);
+    progs.push_back(std::move(prog));
+  }
+  auto d_progs = cudf::detail::make_device_uvector_async(h_progs, stream);
+
+  // create one output column per pattern
+  std::vector<std::unique_ptr<column>> results;
+  std::vector<bool*> h_outputs;
+  for (size_type idx = 0; idx < num_patterns; ++idx) {
+    auto result = make_numeric_column(data_type{type_id::BOOL8},
+                                      strings_count,
+                                      cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                      strings.null_count(),
+                                      stream,
+                                      mr);
+    h_outputs.push_back(result->mutable_view().data<bool>());
+    results.push_back(std::move(result));
+  }
+  auto d_outputs = cudf::detail::make_device_uvector_async(h_outputs, stream);
+
+  // the stack size is chosen by the largest program; smaller programs simply
+  // use less of it
+  if (max_insts <= RX_SMALL_INSTS)
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      strings_count,
+      contains_multiple_fn<RX_STACK_SMALL>{d_column, d_progs.data(), num_patterns, d_outputs.data()});
+  else if (max_insts <= RX_MEDIUM_INSTS)
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       strings_count,
+                       contains_multiple_fn<RX_STACK_MEDIUM>{
+                         d_column, d_progs.data(), num_patterns, d_outputs.data()});
+  else if (max_insts <= RX_LARGE_INSTS)
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      strings_count,
+      contains_multiple_fn<RX_STACK_LARGE>{d_column, d_progs.data(), num_patterns, d_outputs.data()});
+  else
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      strings_count,
+      contains_multiple_fn<RX_STACK_ANY>{d_column, d_progs.data(), num_patterns, d_outputs.data()});
+
+  for (auto& result : results) {
+    result->set_null_count(strings.null_count());
+  }
+  return std::make_unique<table>(std::move(results));
+}
+
 }  // namespace detail
 
 // external APIs
@@ -150,6 +338,14 @@ std::unique_ptr<column> contains_re(strings_column_view const& strings,
   return detail::contains_re(strings, pattern, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<table> contains_multiple_re(strings_column_view const& strings,
+                                            std::vector<std::string> const& patterns,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains_multiple_re(strings, patterns, rmm::cuda_stream_default, mr);
+}
+
 std::unique_ptr<column> matches_re(strings_column_view const& strings,
                                    std::string const& pattern,
                                    rmm::mr::device_memory_resource* mr)
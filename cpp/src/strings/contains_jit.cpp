@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <strings/jit/contains_jit.hpp>
+
+#include <jit_preprocessed_files/strings/jit/kernel.cu.jit.hpp>
+
+#include <jit/cache.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cctype>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+
+// straight-line matcher code is generated per element; cap it so pathological
+// patterns do not produce huge kernels
+constexpr std::size_t MAX_JIT_PATTERN_ELEMENTS = 64;
+
+/**
+ * @brief A single-character element of a simple pattern.
+ *
+ * A character position matches if its byte equals any entry in `singles` or
+ * falls in any of the inclusive `ranges`.
+ */
+struct pattern_element {
+  std::string singles;
+  std::vector<std::pair<char, char>> ranges;
+};
+
+struct parsed_pattern {
+  std::vector<pattern_element> elements;
+  bool begin_anchor = false;  ///< `^`: matches at the start or after a newline
+  bool end_anchor   = false;  ///< `$`: matches at the end or before a newline
+  bool start_only   = false;  ///< matches_re: only start position 0 is tried
+};
+
+/**
+ * @brief Parses a pattern into single-character elements and anchors.
+ *
+ * Returns false for any construct that cannot be matched byte-wise with
+ * straight-line code: quantifiers, alternation, groups, `.`, negated classes
+ * and class shortcuts (`\w` etc.). Negated classes and `.` are excluded
+ * because they would incorrectly match UTF-8 continuation bytes; multi-byte
+ * literal characters are fine since each of their bytes becomes an element.
+ */
+bool try_parse(std::string const& pattern, parsed_pattern& result)
+{
+  std::size_t pos  = 0;
+  auto const size  = pattern.size();
+  auto const uchar = [](char ch) { return static_cast<unsigned char>(ch); };
+
+  if (pos < size && pattern[pos] == '^') {
+    result.begin_anchor = true;
+    ++pos;
+  }
+  while (pos < size) {
+    char const ch = pattern[pos];
+    if (ch == '$' && pos + 1 == size) {
+      result.end_anchor = true;
+      ++pos;
+      continue;
+    }
+    pattern_element element;
+    if (ch == '[') {
+      ++pos;
+      if (pos < size && pattern[pos] == '^') return false;  // negated class
+      while (pos < size && pattern[pos] != ']') {
+        char cc = pattern[pos];
+        if (cc == '\\') {
+          if (pos + 1 >= size) return false;
+          cc = pattern[pos + 1];
+          if (std::isalnum(uchar(cc))) return false;  // \w, \d, \s, ...
+          element.singles.push_back(cc);
+          pos += 2;
+          continue;
+        }
+        if (uchar(cc) >= 0x80) return false;  // byte ranges are not UTF-8 aware
+        if (pos + 2 < size && pattern[pos + 1] == '-' && pattern[pos + 2] != ']') {
+          char const hi = pattern[pos + 2];
+          if (hi == '\\' || uchar(hi) >= 0x80 || uchar(hi) < uchar(cc)) return false;
+          element.ranges.emplace_back(cc, hi);
+          pos += 3;
+          continue;
+        }
+        element.singles.push_back(cc);
+        ++pos;
+      }
+      if (pos >= size) return false;  // unterminated class
+      ++pos;                          // skip ']'
+      if (element.singles.empty() && element.ranges.empty()) return false;
+    } else if (ch == '\\') {
+      if (pos + 1 >= size) return false;
+      char const esc = pattern[pos + 1];
+      if (std::isalnum(uchar(esc))) return false;  // \w, \d, \s, \b, ...
+      element.singles.push_back(esc);
+      pos += 2;
+    } else if (ch == '.' || ch == '*' || ch == '+' || ch == '?' || ch == '|' || ch == '(' ||
+               ch == ')' || ch == '{' || ch == '}' || ch == '^' || ch == '$' || ch == ']') {
+      return false;
+    } else {
+      element.singles.push_back(ch);
+      ++pos;
+    }
+    result.elements.push_back(std::move(element));
+    if (result.elements.size() > MAX_JIT_PATTERN_ELEMENTS) return false;
+  }
+  return true;
+}
+
+std::string byte_literal(char ch)
+{
+  std::ostringstream out;
+  out << "0x" << std::hex << static_cast<unsigned int>(static_cast<unsigned char>(ch)) << "u";
+  return out.str();
+}
+
+/**
+ * @brief Generates the source for pattern_match() overriding pattern-udf.hpp.
+ */
+std::string make_pattern_source(parsed_pattern const& pattern)
+{
+  std::ostringstream cuda;
+  cuda << "#pragma once\n\n";
+  cuda << "__device__ inline bool pattern_match_at(char const* s)\n{\n";
+  if (!pattern.elements.empty()) { cuda << "  unsigned char c;\n"; }
+  for (std::size_t idx = 0; idx < pattern.elements.size(); ++idx) {
+    auto const& element = pattern.elements[idx];
+    cuda << "  c = static_cast<unsigned char>(s[" << idx << "]);\n";
+    cuda << "  if (!(";
+    bool first = true;
+    for (auto const single : element.singles) {
+      if (!first) cuda << " || ";
+      cuda << "c == " << byte_literal(single);
+      first = false;
+    }
+    for (auto const& range : element.ranges) {
+      if (!first) cuda << " || ";
+      cuda << "(c >= " << byte_literal(range.first) << " && c <= " << byte_literal(range.second)
+           << ")";
+      first = false;
+    }
+    cuda << ")) { return false; }\n";
+  }
+  cuda << "  return true;\n}\n\n";
+  cuda << "__device__ inline bool pattern_match(char const* begin, char const* end)\n{\n";
+  cuda << "  auto const len = static_cast<int>(end - begin);\n";
+  cuda << "  constexpr int pattern_len = " << pattern.elements.size() << ";\n";
+  cuda << "  if (len < pattern_len) { return false; }\n";
+  // mirror the interpreted engine: ^ also matches after a newline, $ also
+  // matches before one, and matches_re only ever tries start position 0
+  if (pattern.start_only) {
+    if (pattern.end_anchor) {
+      cuda << "  if (!(pattern_len == len || begin[pattern_len] == '\\n')) { return false; }\n";
+    }
+    cuda << "  return pattern_match_at(begin);\n";
+  } else {
+    cuda << "  for (int pos = 0; pos + pattern_len <= len; ++pos) {\n";
+    if (pattern.begin_anchor) {
+      cuda << "    if (!(pos == 0 || begin[pos - 1] == '\\n')) { continue; }\n";
+    }
+    if (pattern.end_anchor) {
+      cuda << "    if (!(pos + pattern_len == len || begin[pos + pattern_len] == '\\n')) { "
+              "continue; }\n";
+    }
+    cuda << "    if (pattern_match_at(begin + pos)) { return true; }\n";
+    cuda << "  }\n";
+    cuda << "  return false;\n";
+  }
+  cuda << "}\n";
+  return cuda.str();
+}
+
+}  // namespace
+
+bool is_jit_supported_pattern(std::string const& pattern)
+{
+  parsed_pattern parsed;
+  return try_parse(pattern, parsed);
+}
+
+std::unique_ptr<column> contains_re_jit(strings_column_view const& strings,
+                                        std::string const& pattern,
+                                        bool beginning_only,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  parsed_pattern parsed;
+  CUDF_EXPECTS(try_parse(pattern, parsed), "pattern is not supported by the JIT matcher");
+  parsed.start_only = beginning_only;
+
+  auto const strings_count = strings.size();
+  auto results             = make_numeric_column(data_type{type_id::BOOL8},
+                                     strings_count,
+                                     cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                     strings.null_count(),
+                                     stream,
+                                     mr);
+  if (strings_count == 0) { return results; }
+
+  auto const d_chars   = strings.chars().data<char>();
+  auto const d_offsets = strings.offsets().data<offset_type>() + strings.offset();
+  auto const d_results = results->mutable_view().data<bool>();
+
+  cudf::jit::get_program_cache(*strings_jit_kernel_cu_jit)
+    .get_kernel("cudf::strings::jit::contains_kernel",
+                {},
+                {{"strings/jit/pattern-udf.hpp", make_pattern_source(parsed)}},
+                {"-arch=sm_."})
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())
+    ->launch(strings_count,
+             d_chars,
+             d_offsets,
+             strings.parent().null_mask(),
+             strings.offset(),
+             d_results);
+
+  results->set_null_count(strings.null_count());
+  return results;
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -20,6 +20,7 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/strings/concatenate.hpp>
 #include <cudf/strings/detail/concatenate.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -108,17 +109,62 @@ auto create_strings_device_views(host_span<column_view const> views, rmm::cuda_s
                          output_chars_size);
 }
 
+/**
+ * @brief Concatenates offsets, validity and (optionally) chars in a single launch.
+ *
+ * The grid is partitioned by role: the first `offset_blocks` blocks copy the
+ * offsets column and gather the null mask, the remaining blocks copy character
+ * data. Splitting at block granularity keeps whole warps on one role so the
+ * validity ballots stay coherent. Launching with no chars blocks (and
+ * `chars_size` zero) turns this into an offsets/validity-only kernel for the
+ * memcpy-based chars path.
+ */
 template <size_type block_size, bool Nullable>
-__global__ void fused_concatenate_string_offset_kernel(column_device_view const* input_views,
-                                                       size_t const* input_offsets,
-                                                       size_t const* partition_offsets,
-                                                       size_type const num_input_views,
-                                                       size_type const output_size,
-                                                       int32_t* output_data,
-                                                       bitmask_type* output_mask,
-                                                       size_type* out_valid_count)
+__global__ void fused_concatenate_string_kernel(column_device_view const* input_views,
+                                                size_t const* input_offsets,
+                                                size_t const* partition_offsets,
+                                                size_type const num_input_views,
+                                                size_type const output_size,
+                                                int32_t* output_data,
+                                                size_type const offset_blocks,
+                                                size_type const chars_size,
+                                                char* output_chars,
+                                                bitmask_type* output_mask,
+                                                size_type* out_valid_count)
 {
+  if (blockIdx.x >= static_cast<unsigned>(offset_blocks)) {
+    // Chars half of the grid
+    size_type output_index  = threadIdx.x + (blockIdx.x - offset_blocks) * blockDim.x;
+    auto const chars_stride = (gridDim.x - offset_blocks) * blockDim.x;
+
+    while (output_index < chars_size) {
+      // Lookup input index by searching for output index in offsets
+      // thrust::prev isn't in CUDA 10.0, so subtracting 1 here instead
+      auto const offset_it =
+        -1 + thrust::upper_bound(
+               thrust::seq, partition_offsets, partition_offsets + num_input_views, output_index);
+      size_type const partition_index = offset_it - partition_offsets;
+
+      auto const offset_index = output_index - *offset_it;
+      auto const& input_view  = input_views[partition_index];
+
+      constexpr auto offsets_child   = strings_column_view::offsets_column_index;
+      auto const* input_offsets_data = input_view.child(offsets_child).data<int32_t>();
+
+      constexpr auto chars_child   = strings_column_view::chars_column_index;
+      auto const* input_chars_data = input_view.child(chars_child).data<char>();
+
+      auto const first_char       = input_offsets_data[input_view.offset()];
+      output_chars[output_index]  = input_chars_data[offset_index + first_char];
+
+      output_index += chars_stride;
+    }
+    return;
+  }
+
+  // Offsets and validity half of the grid
   size_type output_index     = threadIdx.x + blockIdx.x * blockDim.x;
+  auto const offsets_stride  = offset_blocks * blockDim.x;
   size_type warp_valid_count = 0;
 
   unsigned active_mask;
@@ -152,7 +198,7 @@ __global__ void fused_concatenate_string_offset_kernel(column_device_view const*
       warp_valid_count += __popc(new_word);
     }
 
-    output_index += blockDim.x * gridDim.x;
+    output_index += offsets_stride;
     if (Nullable) { active_mask = __ballot_sync(active_mask, output_index < output_size); }
   }
 
@@ -168,38 +214,6 @@ __global__ void fused_concatenate_string_offset_kernel(column_device_view const*
   }
 }
 
-__global__ void fused_concatenate_string_chars_kernel(column_device_view const* input_views,
-                                                      size_t const* partition_offsets,
-                                                      size_type const num_input_views,
-                                                      size_type const output_size,
-                                                      char* output_data)
-{
-  size_type output_index = threadIdx.x + blockIdx.x * blockDim.x;
-
-  while (output_index < output_size) {
-    // Lookup input index by searching for output index in offsets
-    // thrust::prev isn't in CUDA 10.0, so subtracting 1 here instead
-    auto const offset_it =
-      -1 + thrust::upper_bound(
-             thrust::seq, partition_offsets, partition_offsets + num_input_views, output_index);
-    size_type const partition_index = offset_it - partition_offsets;
-
-    auto const offset_index = output_index - *offset_it;
-    auto const& input_view  = input_views[partition_index];
-
-    constexpr auto offsets_child   = strings_column_view::offsets_column_index;
-    auto const* input_offsets_data = input_view.child(offsets_child).data<int32_t>();
-
-    constexpr auto chars_child   = strings_column_view::chars_column_index;
-    auto const* input_chars_data = input_view.child(chars_child).data<char>();
-
-    auto const first_char     = input_offsets_data[input_view.offset()];
-    output_data[output_index] = input_chars_data[offset_index + first_char];
-
-    output_index += blockDim.x * gridDim.x;
-  }
-}
-
 std::unique_ptr<column> concatenate(host_span<column_view const> columns,
                                     rmm::cuda_stream_view stream,
                                     rmm::mr::device_memory_resource* mr)
@@ -242,64 +256,59 @@ std::unique_ptr<column> concatenate(host_span<column_view const> columns,
       cudf::detail::create_null_mask(strings_count, mask_state::UNINITIALIZED, stream, mr);
   }
 
-  {  // Copy offsets columns with single kernel launch
+  // Use a heuristic to guess when the fused chars copy will be faster than memcpy
+  bool const fuse_chars =
+    total_bytes > 0 && use_fused_kernel_heuristic(has_nulls, total_bytes, columns.size());
+
+  {  // Copy offsets, validity and (when the heuristic holds) chars with a single kernel launch
     rmm::device_scalar<size_type> d_valid_count(0, stream);
 
     constexpr size_type block_size{256};
-    cudf::detail::grid_1d config(offsets_count, block_size);
-    auto const kernel = has_nulls ? fused_concatenate_string_offset_kernel<block_size, true>
-                                  : fused_concatenate_string_offset_kernel<block_size, false>;
-    kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+    auto const offset_blocks = cudf::detail::grid_1d(offsets_count, block_size).num_blocks;
+    auto const chars_blocks =
+      fuse_chars ? cudf::detail::grid_1d(total_bytes, block_size).num_blocks : 0;
+    auto const kernel = has_nulls ? fused_concatenate_string_kernel<block_size, true>
+                                  : fused_concatenate_string_kernel<block_size, false>;
+    kernel<<<offset_blocks + chars_blocks, block_size, 0, stream.value()>>>(
       d_views,
       d_input_offsets.data(),
       d_partition_offsets.data(),
       static_cast<size_type>(columns.size()),
       strings_count,
       d_new_offsets,
+      offset_blocks,
+      fuse_chars ? static_cast<size_type>(total_bytes) : size_type{0},
+      d_new_chars,
       reinterpret_cast<bitmask_type*>(null_mask.data()),
       d_valid_count.data());
 
     if (has_nulls) { null_count = strings_count - d_valid_count.value(stream); }
   }
 
-  if (total_bytes > 0) {
-    // Use a heuristic to guess when the fused kernel will be faster than memcpy
-    if (use_fused_kernel_heuristic(has_nulls, total_bytes, columns.size())) {
-      // Use single kernel launch to copy chars columns
-      constexpr size_type block_size{256};
-      cudf::detail::grid_1d config(total_bytes, block_size);
-      auto const kernel = fused_concatenate_string_chars_kernel;
-      kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
-        d_views,
-        d_partition_offsets.data(),
-        static_cast<size_type>(columns.size()),
-        total_bytes,
-        d_new_chars);
-    } else {
-      // Memcpy each input chars column (more efficient for very large strings)
-      for (auto column = columns.begin(); column != columns.end(); ++column) {
-        size_type column_size = column->size();
-        if (column_size == 0)  // nothing to do
-          continue;            // empty column may not have children
-        size_type column_offset   = column->offset();
-        column_view offsets_child = column->child(strings_column_view::offsets_column_index);
-        column_view chars_child   = column->child(strings_column_view::chars_column_index);
-
-        auto bytes_offset =
-          cudf::detail::get_value<offset_type>(offsets_child, column_offset, stream);
-
-        // copy the chars column data
-        auto d_chars = chars_child.data<char>() + bytes_offset;
-        auto const bytes =
-          cudf::detail::get_value<offset_type>(offsets_child, column_size + column_offset, stream) -
-          bytes_offset;
-
-        CUDA_TRY(
-          cudaMemcpyAsync(d_new_chars, d_chars, bytes, cudaMemcpyDeviceToDevice, stream.value()));
-
-        // get ready for the next column
-        d_new_chars += bytes;
-      }
+  if (total_bytes > 0 && not fuse_chars) {
+    // Memcpy each input chars column (more efficient for very large strings)
+    for (auto column = columns.begin(); column != columns.end(); ++column) {
+      size_type column_size = column->size();
+      if (column_size == 0)  // nothing to do
+        continue;            // empty column may not have children
+      size_type column_offset   = column->offset();
+      column_view offsets_child = column->child(strings_column_view::offsets_column_index);
+      column_view chars_child   = column->child(strings_column_view::chars_column_index);
+
+      auto bytes_offset =
+        cudf::detail::get_value<offset_type>(offsets_child, column_offset, stream);
+
+      // copy the chars column data
+      auto d_chars = chars_child.data<char>() + bytes_offset;
+      auto const bytes =
+        cudf::detail::get_value<offset_type>(offsets_child, column_size + column_offset, stream) -
+        bytes_offset;
+
+      CUDA_TRY(
+        cudaMemcpyAsync(d_new_chars, d_chars, bytes, cudaMemcpyDeviceToDevice, stream.value()));
+
+      // get ready for the next column
+      d_new_chars += bytes;
     }
   }
 
@@ -310,6 +319,70 @@ std::unique_ptr<column> concatenate(host_span<column_view const> columns,
                              std::move(null_mask));
 }
 
+std::vector<std::unique_ptr<column>> concatenate_into_batches(
+  host_span<column_view const> columns,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  std::vector<std::unique_ptr<column>> results;
+  if (columns.empty()) {
+    results.push_back(make_empty_column(data_type{type_id::STRING}));
+    return results;
+  }
+  CUDF_EXPECTS(std::all_of(columns.begin(),
+                           columns.end(),
+                           [](auto const& col) { return col.type().id() == type_id::STRING; }),
+               "concatenate_into_batches requires strings columns");
+
+  // Compute the chars size of each input column.
+  // Only the offsets endpoints of each column are read here so this costs a
+  // single metadata-sized pass no matter how large the character data is.
+  std::unique_ptr<rmm::device_buffer> device_view_owners;
+  column_device_view* device_views_ptr;
+  std::tie(device_view_owners, device_views_ptr) =
+    contiguous_copy_column_device_views<column_device_view>(columns, stream);
+  auto d_chars_sizes = rmm::device_uvector<size_t>(columns.size(), stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    device_views_ptr,
+                    device_views_ptr + columns.size(),
+                    d_chars_sizes.begin(),
+                    chars_size_transform{});
+  auto const h_chars_sizes = cudf::detail::make_std_vector_sync(d_chars_sizes, stream);
+
+  // Greedily group the columns so each batch stays within the 32-bit
+  // offsets limits; each input is a valid column so it fits in some batch.
+  auto const size_limit = static_cast<std::size_t>(std::numeric_limits<size_type>::max());
+  std::size_t batch_begin = 0;
+  std::size_t batch_rows  = 0;
+  std::size_t batch_bytes = 0;
+  for (std::size_t idx = 0; idx < columns.size(); ++idx) {
+    auto const rows  = static_cast<std::size_t>(columns[idx].size());
+    auto const bytes = h_chars_sizes[idx];
+    if ((idx > batch_begin) &&
+        ((batch_rows + rows + 1 > size_limit) || (batch_bytes + bytes > size_limit))) {
+      results.push_back(concatenate(columns.subspan(batch_begin, idx - batch_begin), stream, mr));
+      batch_begin = idx;
+      batch_rows  = 0;
+      batch_bytes = 0;
+    }
+    batch_rows += rows;
+    batch_bytes += bytes;
+  }
+  results.push_back(
+    concatenate(columns.subspan(batch_begin, columns.size() - batch_begin), stream, mr));
+  return results;
+}
+
 }  // namespace detail
+
+// external API
+
+std::vector<std::unique_ptr<column>> concatenate_into_batches(
+  host_span<column_view const> columns, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::concatenate_into_batches(columns, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
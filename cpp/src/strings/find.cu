@@ -18,6 +18,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/find.hpp>
@@ -30,6 +31,8 @@
 
 #include <thrust/transform.h>
 
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -290,6 +293,36 @@ std::unique_ptr<column> contains(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
+  // For multi-byte targets, use a Boyer-Moore-Horspool search instead of
+  // checking every position. The skip table is built once on the host: one
+  // entry per byte value holding how far the search window may jump when
+  // that byte appears last in the window. UTF-8 is self-synchronizing so a
+  // byte-wise match is exactly a substring match.
+  if (target.is_valid() && target.size() > 1) {
+    auto const h_target     = target.to_string(stream);
+    auto const target_bytes = static_cast<size_type>(h_target.size());
+    auto h_skip             = std::vector<size_type>(256, target_bytes);
+    for (size_type i = 0; i + 1 < target_bytes; ++i)
+      h_skip[static_cast<uint8_t>(h_target[i])] = target_bytes - 1 - i;
+    auto d_skip = cudf::detail::make_device_uvector_async(h_skip, stream);
+
+    auto pfn = [d_skip = d_skip.data()] __device__(string_view d_string, string_view d_target) {
+      char const* text  = d_string.data();
+      char const* tgt   = d_target.data();
+      auto const bytes  = d_string.size_bytes();
+      auto const tbytes = d_target.size_bytes();
+      size_type pos     = 0;
+      while (pos + tbytes <= bytes) {
+        auto k = tbytes - 1;  // compare from the last byte backward
+        while (k >= 0 && text[pos + k] == tgt[k]) --k;
+        if (k < 0) return true;
+        pos += d_skip[static_cast<uint8_t>(text[pos + tbytes - 1])];
+      }
+      return false;
+    };
+    return contains_fn(strings, target, pfn, stream, mr);
+  }
+
   auto pfn = [] __device__(string_view d_string, string_view d_target) {
     return d_string.find(d_target) >= 0;
   };
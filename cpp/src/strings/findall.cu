@@ -42,6 +42,10 @@ namespace {
 /**
  * @brief This functor handles extracting matched strings by applying the compiled regex pattern
  * and creating string_index_pairs for all the substrings.
+ *
+ * This stays one-thread-per-string even for long strings: each match must resume
+ * from the end of the previous (leftmost, non-overlapping) match, so the warp
+ * lanes cannot partition the start positions the way contains_re does.
  */
 template <int stack_size>
 struct findall_fn {
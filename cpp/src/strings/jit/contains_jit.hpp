@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <string>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief Returns true if the given regex pattern can be lowered to a
+ * JIT-compiled matcher.
+ *
+ * Supported patterns are sequences of literal characters, positive character
+ * classes of ASCII characters (e.g. `[a-z0-9_]`), and the `^`/`$` anchors.
+ * Quantifiers, alternation, groups, `.`, negated classes and the `\w`-style
+ * class shortcuts require the interpreted regex engine.
+ *
+ * @param pattern Regex pattern to inspect.
+ * @return true if contains_re_jit() can evaluate this pattern.
+ */
+bool is_jit_supported_pattern(std::string const& pattern);
+
+/**
+ * @brief Evaluates a simple regex pattern with a kernel specialized for it.
+ *
+ * The pattern is lowered to straight-line comparison code, compiled through
+ * the JIT program cache (keyed by the generated source so repeated calls with
+ * the same pattern reuse the compiled kernel), and run over the string bytes.
+ *
+ * @throw cudf::logic_error if the pattern is not supported;
+ * call is_jit_supported_pattern() first.
+ *
+ * @param strings Strings instance for this operation.
+ * @param pattern Regex pattern to match to each string.
+ * @param beginning_only Match only the beginning of each string.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New BOOL8 column.
+ */
+std::unique_ptr<column> contains_re_jit(strings_column_view const& strings,
+                                        std::string const& pattern,
+                                        bool beginning_only,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr);
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include Jitify's cstddef header first
+#include <cstddef>
+
+#include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
+
+#include <strings/jit/pattern-udf.hpp>
+
+namespace cudf {
+namespace strings {
+namespace jit {
+
+/**
+ * @brief Evaluates the generated pattern matcher against every string.
+ *
+ * The `pattern_match` function is supplied at runtime by overriding the
+ * pattern-udf.hpp header with source generated from the pattern string.
+ * Matching is done directly on the string bytes.
+ */
+__global__ void contains_kernel(cudf::size_type size,
+                                char const* d_chars,
+                                cudf::offset_type const* d_offsets,
+                                cudf::bitmask_type const* d_null_mask,
+                                cudf::size_type mask_offset,
+                                bool* d_results)
+{
+  int tid    = threadIdx.x;
+  int blkid  = blockIdx.x;
+  int blksz  = blockDim.x;
+  int gridsz = gridDim.x;
+
+  int start = tid + blkid * blksz;
+  int step  = blksz * gridsz;
+
+  for (cudf::size_type i = start; i < size; i += step) {
+    bool result = false;
+    if (d_null_mask == nullptr || cudf::bit_is_set(d_null_mask, mask_offset + i)) {
+      result = pattern_match(d_chars + d_offsets[i], d_chars + d_offsets[i + 1]);
+    }
+    d_results[i] = result;
+  }
+}
+
+}  // namespace jit
+}  // namespace strings
+}  // namespace cudf
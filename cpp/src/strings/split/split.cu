@@ -22,7 +22,9 @@
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/strings/detail/strings_column_factories.cuh>
+#include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/split/split.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
@@ -35,6 +37,7 @@
 #include <thrust/copy.h>           // copy_if()
 #include <thrust/count.h>          // count_if()
 #include <thrust/reduce.h>         // maximum()
+#include <thrust/scan.h>           // exclusive_scan()
 #include <thrust/transform.h>      // transform()
 
 namespace cudf {
@@ -356,6 +359,146 @@ struct rsplit_tokenizer_fn : base_split_tokenizer {
   }
 };
 
+/**
+ * @brief Builds all the output strings columns from the tokens vector at once.
+ *
+ * Creating each output column with the strings factory sizes, scans and
+ * copies that column's tokens separately, paying a stream synchronization
+ * per column for the null count and the chars size. Splitting wide records
+ * (dozens of output columns) is dominated by that per-column overhead, so
+ * this builds every column from the single tokens vector using one
+ * size-then-copy pair of passes over all the tokens and only two
+ * synchronizations in total.
+ *
+ * The tokens are expected in output-column-major order as produced by the
+ * tokenizers: `d_tokens[col * strings_count + row]` is the token at column
+ * `col` for string at `row`. A null entry is marked by a nullptr token.
+ *
+ * @param d_tokens All tokens for all output columns
+ * @param strings_count Number of rows in each output column
+ * @param columns_count Number of output columns
+ * @return table of columns for the output of the split
+ */
+std::unique_ptr<table> make_split_columns(string_index_pair const* d_tokens,
+                                          size_type strings_count,
+                                          size_type columns_count,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  auto const total_tokens = columns_count * strings_count;
+
+  // allocate all the offsets columns and collect their data pointers
+  std::vector<std::unique_ptr<column>> offsets_columns;
+  std::vector<int32_t*> h_offsets_ptrs;
+  for (size_type col = 0; col < columns_count; ++col) {
+    auto offsets = make_numeric_column(
+      data_type{type_id::INT32}, strings_count + 1, mask_state::UNALLOCATED, stream, mr);
+    h_offsets_ptrs.push_back(offsets->mutable_view().data<int32_t>());
+    offsets_columns.push_back(std::move(offsets));
+  }
+  auto d_offsets_ptrs = cudf::detail::make_device_uvector_async(h_offsets_ptrs, stream);
+
+  // size pass: write each token's byte size into its column's offsets
+  auto d_sizes_ptrs = d_offsets_ptrs.data();
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     total_tokens,
+                     [d_tokens, d_sizes_ptrs, strings_count] __device__(size_type idx) {
+                       auto const token = d_tokens[idx];
+                       d_sizes_ptrs[idx / strings_count][idx % strings_count] =
+                         token.first != nullptr ? token.second : 0;
+                     });
+  // convert the sizes into offsets; these scans allocate nothing
+  for (size_type col = 0; col < columns_count; ++col) {
+    thrust::exclusive_scan(rmm::exec_policy(stream),
+                           h_offsets_ptrs[col],
+                           h_offsets_ptrs[col] + strings_count + 1,
+                           h_offsets_ptrs[col]);
+  }
+
+  // retrieve all the chars sizes with a single copy
+  rmm::device_uvector<int32_t> d_total_bytes(columns_count, stream);
+  auto d_total_bytes_data = d_total_bytes.data();
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     columns_count,
+                     [d_sizes_ptrs, d_total_bytes_data, strings_count] __device__(size_type col) {
+                       d_total_bytes_data[col] = d_sizes_ptrs[col][strings_count];
+                     });
+  auto const h_total_bytes = cudf::detail::make_std_vector_sync(d_total_bytes, stream);
+
+  // allocate all the chars columns and the null masks
+  std::vector<std::unique_ptr<column>> chars_columns;
+  std::vector<char*> h_chars_ptrs;
+  std::vector<rmm::device_buffer> null_masks;
+  std::vector<bitmask_type*> h_mask_ptrs;
+  for (size_type col = 0; col < columns_count; ++col) {
+    auto chars = create_chars_child_column(h_total_bytes[col], stream, mr);
+    h_chars_ptrs.push_back(chars->mutable_view().data<char>());
+    chars_columns.push_back(std::move(chars));
+    null_masks.emplace_back(
+      cudf::detail::create_null_mask(strings_count, mask_state::UNINITIALIZED, stream, mr));
+    h_mask_ptrs.push_back(static_cast<bitmask_type*>(null_masks.back().data()));
+  }
+  auto d_chars_ptrs = cudf::detail::make_device_uvector_async(h_chars_ptrs, stream);
+  auto d_mask_ptrs  = cudf::detail::make_device_uvector_async(h_mask_ptrs, stream);
+
+  // copy pass: write every token's bytes into its column's chars
+  auto d_chars_data = d_chars_ptrs.data();
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    total_tokens,
+    [d_tokens, d_sizes_ptrs, d_chars_data, strings_count] __device__(size_type idx) {
+      auto const token = d_tokens[idx];
+      if (token.first == nullptr) return;
+      auto const col = idx / strings_count;
+      memcpy(d_chars_data[col] + d_sizes_ptrs[col][idx % strings_count],
+             token.first,
+             token.second);
+    });
+
+  // build all the null masks, accumulating each column's valid count
+  auto const mask_words = num_bitmask_words(strings_count);
+  rmm::device_uvector<size_type> d_valid_counts(columns_count, stream);
+  thrust::fill(rmm::exec_policy(stream), d_valid_counts.begin(), d_valid_counts.end(), 0);
+  auto d_valid_counts_data = d_valid_counts.data();
+  auto d_mask_data         = d_mask_ptrs.data();
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    columns_count * mask_words,
+    [d_tokens, d_mask_data, d_valid_counts_data, mask_words, strings_count] __device__(
+      size_type idx) {
+      auto const col      = idx / mask_words;
+      auto const word     = idx % mask_words;
+      auto const base_row = word * cudf::detail::size_in_bits<bitmask_type>();
+      bitmask_type bits   = 0;
+      for (size_type bit = 0; bit < static_cast<size_type>(cudf::detail::size_in_bits<bitmask_type>());
+           ++bit) {
+        auto const row = base_row + bit;
+        if ((row < strings_count) && (d_tokens[col * strings_count + row].first != nullptr))
+          bits |= bitmask_type{1} << bit;
+      }
+      d_mask_data[col][word] = bits;
+      atomicAdd(d_valid_counts_data + col, __popc(bits));
+    });
+  auto const h_valid_counts = cudf::detail::make_std_vector_sync(d_valid_counts, stream);
+
+  // assemble the columns from the pre-built children
+  std::vector<std::unique_ptr<column>> results;
+  for (size_type col = 0; col < columns_count; ++col) {
+    auto const null_count = strings_count - h_valid_counts[col];
+    results.emplace_back(make_strings_column(strings_count,
+                                             std::move(offsets_columns[col]),
+                                             std::move(chars_columns[col]),
+                                             null_count,
+                                             null_count > 0 ? std::move(null_masks[col])
+                                                            : rmm::device_buffer{}));
+  }
+  return std::make_unique<table>(std::move(results));
+}
+
 /**
  * @brief Generic split function called by split() and rsplit().
  *
@@ -504,6 +647,7 @@ std::unique_ptr<table> split_fn(strings_column_view const& strings_column,
       rmm::device_buffer{0, stream, mr},  // no data
       cudf::detail::create_null_mask(strings_count, mask_state::ALL_NULL, stream, mr),
       strings_count));
+    return std::make_unique<table>(std::move(results));
   }
 
   // create working area to hold all token positions
@@ -533,15 +677,8 @@ std::unique_ptr<table> split_fn(strings_column_view const& strings_column,
         idx, d_token_counts, d_positions, delimiter_count, d_string_indices, d_tokens);
     });
 
-  // Create each column.
-  // - Each pair points to the strings for that column for each row.
-  // - Create the strings column from the vector using the strings factory.
-  for (size_type col = 0; col < columns_count; ++col) {
-    auto column_tokens = d_tokens + (col * strings_count);
-    results.emplace_back(
-      make_strings_column(column_tokens, column_tokens + strings_count, stream, mr));
-  }
-  return std::make_unique<table>(std::move(results));
+  // create all the output columns from the tokens vector in one pass
+  return make_split_columns(d_tokens, strings_count, columns_count, stream, mr);
 }
 
 /**
@@ -764,6 +901,7 @@ std::unique_ptr<table> whitespace_split_fn(size_type strings_count,
       rmm::device_buffer{0, stream, mr},  // no data
       cudf::detail::create_null_mask(strings_count, mask_state::ALL_NULL, stream, mr),
       strings_count));
+    return std::make_unique<table>(std::move(results));
   }
 
   // get the positions for every token
@@ -780,15 +918,8 @@ std::unique_ptr<table> whitespace_split_fn(size_type strings_count,
                        tokenizer.process_tokens(idx, d_token_counts, d_tokens);
                      });
 
-  // Create each column.
-  // - Each pair points to a string for that column for each row.
-  // - Create the strings column from the vector using the strings factory.
-  for (size_type col = 0; col < columns_count; ++col) {
-    auto column_tokens = d_tokens + (col * strings_count);
-    results.emplace_back(
-      make_strings_column(column_tokens, column_tokens + strings_count, stream, mr));
-  }
-  return std::make_unique<table>(std::move(results));
+  // create all the output columns from the tokens vector in one pass
+  return make_split_columns(d_tokens, strings_count, columns_count, stream, mr);
 }
 
 }  // namespace
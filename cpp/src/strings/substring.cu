@@ -54,13 +54,47 @@ struct substring_fn {
       if (!d_chars) d_offsets[idx] = 0;
       return;
     }
-    auto const d_str  = d_column.template element<string_view>(idx);
+    auto const d_str     = d_column.template element<string_view>(idx);
+    size_type const step = d_step.is_valid() ? d_step.value() : 1;
+
+    // Fast path: unit step with non-negative positions never needs the string
+    // length. Computing the length decodes every character of the string, so
+    // for fixed-width prefixes (the common slice) walk only the bytes up to
+    // the stop position instead.
+    if (step == 1 && (!d_start.is_valid() || d_start.value() >= 0) &&
+        (!d_stop.is_valid() || d_stop.value() >= 0)) {
+      char const* sptr      = d_str.data();
+      auto const size_bytes = d_str.size_bytes();
+      size_type const start = d_start.is_valid() ? d_start.value() : 0;
+      size_type byte_pos    = 0;
+      size_type char_pos    = 0;
+      while (byte_pos < size_bytes && char_pos < start) {
+        byte_pos += bytes_in_utf8_byte(static_cast<uint8_t>(sptr[byte_pos]));
+        ++char_pos;
+      }
+      auto const first_byte = byte_pos;
+      if (d_stop.is_valid()) {
+        size_type const stop = d_stop.value();
+        while (byte_pos < size_bytes && char_pos < stop) {
+          byte_pos += bytes_in_utf8_byte(static_cast<uint8_t>(sptr[byte_pos]));
+          ++char_pos;
+        }
+      } else {
+        byte_pos = size_bytes;  // no stop means the remainder of the string
+      }
+      auto const bytes = min(byte_pos, size_bytes) - first_byte;
+      if (d_chars)
+        memcpy(d_chars + d_offsets[idx], sptr + first_byte, bytes);
+      else
+        d_offsets[idx] = bytes;
+      return;
+    }
+
     auto const length = d_str.length();
     if (length == 0) {
       if (!d_chars) d_offsets[idx] = 0;
       return;
     }
-    size_type const step = d_step.is_valid() ? d_step.value() : 1;
     auto const begin     = [&] {  // always inclusive
       // when invalid, default depends on step
       if (!d_start.is_valid()) return (step > 0) ? d_str.begin() : (d_str.end() - 1);
@@ -201,6 +201,47 @@ flatten_nested_columns(table_view const& input,
   return flattened_table{input, column_order, null_precedence, nullability}();
 }
 
+namespace {
+/**
+ * @brief Recursively record the identity of a column and its children.
+ */
+template <typename Identity>
+void collect_column_identities(column_view const& col, std::vector<Identity>& identities)
+{
+  identities.push_back(
+    Identity{col.type().id(), col.head(), col.null_mask(), col.size(), col.offset()});
+  std::for_each(col.child_begin(), col.child_end(), [&identities](column_view const& child) {
+    collect_column_identities(child, identities);
+  });
+}
+}  // namespace
+
+std::tuple<table_view, std::vector<order>, std::vector<null_order>> flattened_table_cache::flatten(
+  table_view const& input,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  column_nullability nullability)
+{
+  std::vector<column_identity> identities;
+  std::for_each(input.begin(), input.end(), [&identities](column_view const& col) {
+    collect_column_identities(col, identities);
+  });
+
+  auto const cache_hit = _valid && identities == _identities && column_order == _column_order &&
+                         null_precedence == _null_precedence && nullability == _nullability;
+  if (not cache_hit) {
+    _valid = false;  // do not reuse a stale result if flattening throws
+    _result          = flatten_nested_columns(input, column_order, null_precedence, nullability);
+    _identities      = std::move(identities);
+    _column_order    = column_order;
+    _null_precedence = null_precedence;
+    _nullability     = nullability;
+    _valid           = true;
+  }
+
+  return std::make_tuple(std::get<0>(_result), std::get<1>(_result), std::get<2>(_result));
+}
+
 namespace {
 using vector_of_columns = std::vector<std::unique_ptr<cudf::column>>;
 using column_index_t    = typename vector_of_columns::size_type;
@@ -315,14 +356,14 @@ void superimpose_parent_nulls(bitmask_type const* parent_null_mask,
       reinterpret_cast<bitmask_type const*>(parent_null_mask),
       reinterpret_cast<bitmask_type const*>(current_child_mask)};
     std::vector<size_type> begin_bits{0, 0};
-    cudf::detail::inplace_bitmask_and(
+    auto const null_count = cudf::detail::inplace_bitmask_and(
       device_span<bitmask_type>(current_child_mask, num_bitmask_words(child.size())),
       masks,
       begin_bits,
       child.size(),
       stream,
       mr);
-    child.set_null_count(UNKNOWN_NULL_COUNT);
+    child.set_null_count(null_count);
   }
 
   // If the child is also a struct, repeat for all grandchildren.
@@ -376,7 +417,8 @@ std::tuple<cudf::column_view, std::vector<rmm::device_buffer>> superimpose_paren
                                                                std::vector<size_type>{0, 0},
                                                                child.offset() + child.size(),
                                                                stream,
-                                                               mr));
+                                                               mr)
+                                       .first);
       return reinterpret_cast<bitmask_type const*>(ret_validity_buffers.back().data());
     }();
 
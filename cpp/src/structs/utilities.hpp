@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cudf/column/column.hpp>
 #include <cudf/structs/structs_column_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/span.hpp>
@@ -86,6 +87,68 @@ flatten_nested_columns(table_view const& input,
                        std::vector<null_order> const& null_precedence,
                        column_nullability nullability = column_nullability::MATCH_INCOMING);
 
+/**
+ * @brief Memoizes the result of `flatten_nested_columns()` across repeated calls.
+ *
+ * Flattening materializes a BOOL8 validity column for every struct level on
+ * each call; operations that repeatedly flatten the same struct key (e.g.
+ * probing a `hash_join` object batch after batch) pay that allocation and
+ * kernel cost every time. The cache keys on the identity of the input columns
+ * (type, data, null mask, size and offset, recursively) along with the flatten
+ * parameters. Column device data is immutable, so a matching identity means
+ * the cached result is still valid; a rebuilt or re-sliced input produces
+ * different views and misses the cache.
+ *
+ * The views in the returned tuple may reference columns owned by the cache
+ * and remain valid until the next `flatten()` call or until the cache is
+ * destroyed, whichever comes first.
+ *
+ * This class is not thread-safe.
+ */
+class flattened_table_cache {
+ public:
+  /**
+   * @copydoc cudf::structs::detail::flatten_nested_columns
+   *
+   * Returns the cached result when called again with the same input columns
+   * and parameters; the validity columns remain owned by the cache.
+   */
+  std::tuple<table_view, std::vector<order>, std::vector<null_order>> flatten(
+    table_view const& input,
+    std::vector<order> const& column_order,
+    std::vector<null_order> const& null_precedence,
+    column_nullability nullability = column_nullability::MATCH_INCOMING);
+
+ private:
+  /**
+   * @brief Identity of a single input column used for dirty tracking.
+   */
+  struct column_identity {
+    type_id type;
+    void const* data;
+    void const* null_mask;
+    size_type size;
+    size_type offset;
+
+    bool operator==(column_identity const& other) const
+    {
+      return type == other.type && data == other.data && null_mask == other.null_mask &&
+             size == other.size && offset == other.offset;
+    }
+  };
+
+  bool _valid = false;
+  std::vector<column_identity> _identities;
+  std::vector<order> _column_order;
+  std::vector<null_order> _null_precedence;
+  column_nullability _nullability = column_nullability::MATCH_INCOMING;
+  std::tuple<table_view,
+             std::vector<order>,
+             std::vector<null_order>,
+             std::vector<std::unique_ptr<column>>>
+    _result;
+};
+
 /**
  * @brief Unflatten columns flattened as by `flatten_nested_columns()`,
  *        based on the provided `blueprint`.
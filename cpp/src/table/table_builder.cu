@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table_builder.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/transform.h>
+
+#include <limits>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief Grows a buffer to hold at least `required` bytes, at least doubling
+ * its size so that repeated appends copy each byte O(1) times.
+ */
+void ensure_capacity(rmm::device_buffer& buffer, std::size_t required, rmm::cuda_stream_view stream)
+{
+  if (buffer.size() >= required) { return; }
+  buffer.resize(std::max(buffer.size() * 2, required), stream);
+}
+
+/**
+ * @brief Appends the validity of `col` to `d_mask` starting at bit `start_bit`.
+ *
+ * Each thread owns one destination word, merging any previously written bits in
+ * the first (partial) word and zeroing bits past the appended range.
+ */
+void append_validity(bitmask_type* d_mask,
+                     column_view const& col,
+                     size_type start_bit,
+                     rmm::cuda_stream_view stream)
+{
+  auto const end_bit    = start_bit + col.size();
+  auto const first_word = word_index(start_bit);
+  auto const num_words  = num_bitmask_words(end_bit) - first_word;
+  auto const d_col      = column_device_view::create(col, stream);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(first_word),
+    num_words,
+    [d_mask, d_col = *d_col, start_bit, end_bit] __device__(size_type word_idx) {
+      auto constexpr word_bits = detail::size_in_bits<bitmask_type>();
+      bitmask_type const current = d_mask[word_idx];
+      bitmask_type word          = 0;
+      auto const base            = word_idx * static_cast<size_type>(word_bits);
+      for (size_type bit = 0; bit < static_cast<size_type>(word_bits); ++bit) {
+        auto const bit_idx = base + bit;
+        if (bit_idx < start_bit) {
+          word |= current & (bitmask_type{1} << bit);
+        } else if (bit_idx < end_bit && d_col.is_valid(bit_idx - start_bit)) {
+          word |= bitmask_type{1} << bit;
+        }
+      }
+      d_mask[word_idx] = word;
+    });
+}
+
+}  // namespace
+
+struct table_builder::impl {
+  /**
+   * @brief Accumulated buffers for one output column.
+   */
+  struct column_state {
+    rmm::device_buffer data;     ///< fixed-width elements, or string characters
+    rmm::device_buffer offsets;  ///< string offsets; unused for fixed-width columns
+    rmm::device_buffer mask;     ///< null mask; allocated on the first null-bearing append
+    std::size_t data_bytes = 0;  ///< bytes of `data` in use
+    size_type null_count   = 0;
+    bool has_mask          = false;
+  };
+
+  impl(std::vector<data_type> types, rmm::mr::device_memory_resource* mr)
+    : types{std::move(types)}, mr{mr}
+  {
+    auto const stream = rmm::cuda_stream_default;
+    for (auto const& type : this->types) {
+      CUDF_EXPECTS(cudf::is_fixed_width(type) || type.id() == type_id::STRING,
+                   "table_builder supports only fixed-width and string columns");
+      columns.push_back(column_state{rmm::device_buffer{0, stream, mr},
+                                     rmm::device_buffer{0, stream, mr},
+                                     rmm::device_buffer{0, stream, mr}});
+    }
+  }
+
+  void append(table_view const& batch, rmm::cuda_stream_view stream)
+  {
+    CUDF_EXPECTS(static_cast<std::size_t>(batch.num_columns()) == types.size(),
+                 "Appended table has the wrong number of columns");
+    for (std::size_t idx = 0; idx < types.size(); ++idx) {
+      CUDF_EXPECTS(batch.column(idx).type() == types[idx], "Appended table has mismatched types");
+    }
+    auto const batch_rows = batch.num_rows();
+    if (batch_rows == 0) { return; }
+    CUDF_EXPECTS(batch_rows <= std::numeric_limits<size_type>::max() - rows,
+                 "Total size of appended rows exceeds the column size limit");
+
+    for (std::size_t idx = 0; idx < types.size(); ++idx) {
+      auto const col = batch.column(idx);
+      auto& state    = columns[idx];
+      if (types[idx].id() == type_id::STRING) {
+        append_strings(state, col, stream);
+      } else {
+        append_fixed_width(state, col, stream);
+      }
+      append_mask(state, col, stream);
+    }
+    rows += batch_rows;
+  }
+
+  void append_fixed_width(column_state& state, column_view const& col, rmm::cuda_stream_view stream)
+  {
+    auto const elem_size = cudf::size_of(col.type());
+    auto const bytes     = static_cast<std::size_t>(col.size()) * elem_size;
+    ensure_capacity(state.data, state.data_bytes + bytes, stream);
+    CUDA_TRY(cudaMemcpyAsync(static_cast<uint8_t*>(state.data.data()) + state.data_bytes,
+                             col.head<uint8_t>() + static_cast<std::size_t>(col.offset()) * elem_size,
+                             bytes,
+                             cudaMemcpyDeviceToDevice,
+                             stream.value()));
+    state.data_bytes += bytes;
+  }
+
+  void append_strings(column_state& state, column_view const& col, rmm::cuda_stream_view stream)
+  {
+    auto const strings    = strings_column_view(col);
+    auto const offsets    = strings.offsets();
+    auto const first_char = cudf::detail::get_value<offset_type>(offsets, strings.offset(), stream);
+    auto const last_char =
+      cudf::detail::get_value<offset_type>(offsets, strings.offset() + col.size(), stream);
+    auto const bytes = static_cast<std::size_t>(last_char - first_char);
+    CUDF_EXPECTS(bytes <= static_cast<std::size_t>(std::numeric_limits<size_type>::max()) -
+                            state.data_bytes,
+                 "Total size of appended characters exceeds the column size limit");
+
+    // append the batch offsets, rebased onto the accumulated character buffer
+    ensure_capacity(
+      state.offsets,
+      (static_cast<std::size_t>(rows) + col.size() + 1) * sizeof(offset_type),
+      stream);
+    auto d_offsets = static_cast<offset_type*>(state.offsets.data());
+    if (rows == 0) { CUDA_TRY(cudaMemsetAsync(d_offsets, 0, sizeof(offset_type), stream.value())); }
+    auto const d_batch_offsets = offsets.data<offset_type>() + strings.offset();
+    auto const shift           = static_cast<offset_type>(state.data_bytes) - first_char;
+    thrust::transform(rmm::exec_policy(stream),
+                      d_batch_offsets + 1,
+                      d_batch_offsets + col.size() + 1,
+                      d_offsets + rows + 1,
+                      [shift] __device__(offset_type offset) { return offset + shift; });
+
+    ensure_capacity(state.data, state.data_bytes + bytes, stream);
+    CUDA_TRY(cudaMemcpyAsync(static_cast<uint8_t*>(state.data.data()) + state.data_bytes,
+                             strings.chars().head<uint8_t>() + first_char,
+                             bytes,
+                             cudaMemcpyDeviceToDevice,
+                             stream.value()));
+    state.data_bytes += bytes;
+  }
+
+  void append_mask(column_state& state, column_view const& col, rmm::cuda_stream_view stream)
+  {
+    auto const batch_nulls = col.null_count();
+    if (!state.has_mask && batch_nulls == 0) { return; }
+    ensure_capacity(state.mask,
+                    static_cast<std::size_t>(num_bitmask_words(rows + col.size())) *
+                      sizeof(bitmask_type),
+                    stream);
+    auto d_mask = static_cast<bitmask_type*>(state.mask.data());
+    // backfill all-valid bits for rows appended before the first null arrived
+    if (!state.has_mask && rows > 0) { cudf::detail::set_null_mask(d_mask, 0, rows, true, stream); }
+    state.has_mask = true;
+    append_validity(d_mask, col, rows, stream);
+    state.null_count += batch_nulls;
+  }
+
+  std::unique_ptr<table> release(rmm::cuda_stream_view stream)
+  {
+    std::vector<std::unique_ptr<column>> result;
+    result.reserve(types.size());
+    for (std::size_t idx = 0; idx < types.size(); ++idx) {
+      auto& state = columns[idx];
+      if (rows == 0) {
+        result.push_back(make_empty_column(types[idx]));
+        continue;
+      }
+      // shrinking an rmm::device_buffer only adjusts its size; no copy is made
+      auto mask = std::move(state.mask);
+      if (state.has_mask) {
+        mask.resize(static_cast<std::size_t>(num_bitmask_words(rows)) * sizeof(bitmask_type),
+                    stream);
+      }
+      if (types[idx].id() == type_id::STRING) {
+        state.offsets.resize(static_cast<std::size_t>(rows + 1) * sizeof(offset_type), stream);
+        state.data.resize(state.data_bytes, stream);
+        auto offsets_column = std::make_unique<column>(
+          data_type{type_id::INT32}, rows + 1, std::move(state.offsets));
+        auto chars_column = std::make_unique<column>(data_type{type_id::INT8},
+                                                     static_cast<size_type>(state.data_bytes),
+                                                     std::move(state.data));
+        result.push_back(make_strings_column(rows,
+                                             std::move(offsets_column),
+                                             std::move(chars_column),
+                                             state.null_count,
+                                             std::move(mask)));
+      } else {
+        state.data.resize(state.data_bytes, stream);
+        result.push_back(std::make_unique<column>(
+          types[idx], rows, std::move(state.data), std::move(mask), state.null_count));
+      }
+      state = column_state{rmm::device_buffer{0, stream, mr},
+                           rmm::device_buffer{0, stream, mr},
+                           rmm::device_buffer{0, stream, mr}};
+    }
+    rows = 0;
+    return std::make_unique<table>(std::move(result));
+  }
+
+  std::vector<data_type> types;
+  rmm::mr::device_memory_resource* mr;
+  std::vector<column_state> columns;
+  size_type rows = 0;
+};
+
+table_builder::table_builder(std::vector<data_type> types, rmm::mr::device_memory_resource* mr)
+  : _impl{std::make_unique<impl>(std::move(types), mr)}
+{
+}
+
+table_builder::table_builder(table_builder&&) = default;
+table_builder& table_builder::operator=(table_builder&&) = default;
+table_builder::~table_builder()                          = default;
+
+void table_builder::append(table_view const& batch)
+{
+  CUDF_FUNC_RANGE();
+  _impl->append(batch, rmm::cuda_stream_default);
+}
+
+size_type table_builder::num_rows() const { return _impl->rows; }
+
+std::unique_ptr<table> table_builder::release()
+{
+  CUDF_FUNC_RANGE();
+  return _impl->release(rmm::cuda_stream_default);
+}
+
+}  // namespace cudf
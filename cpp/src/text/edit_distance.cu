@@ -89,6 +89,79 @@ __device__ int32_t compute_distance(cudf::string_view const& d_str,
   return static_cast<int32_t>(line0[lengths.first - 1]);
 }
 
+/**
+ * @brief Compute the edit-distance between two strings up to a maximum distance
+ *
+ * Only the cells within `max_distance` of the table diagonal are evaluated and
+ * the computation stops as soon as every cell of a band row exceeds the
+ * threshold. Distances larger than `max_distance` are returned as
+ * `max_distance + 1`.
+ *
+ * The temporary buffer must be able to hold two band rows --
+ * `2 * (2 * max_distance + 1)` int16 values.
+ *
+ * @param d_str First string
+ * @param d_tgt Second string
+ * @param buffer Temporary memory buffer used for the calculation.
+ * @param max_distance Maximum distance of interest
+ * @return Edit distance value capped at `max_distance + 1`
+ */
+__device__ int32_t compute_distance_bounded(cudf::string_view const& d_str,
+                                            cudf::string_view const& d_tgt,
+                                            int16_t* buffer,
+                                            int32_t max_distance)
+{
+  // .first is min and .second is max
+  auto const lengths = std::minmax(d_str.length(), d_tgt.length());
+  // strings whose lengths differ by more than the threshold need no table at all
+  if (lengths.second - lengths.first > max_distance) return max_distance + 1;
+  if (lengths.first == 0) return lengths.second;
+
+  auto itr_A = d_str.length() < d_tgt.length() ? d_str.begin() : d_tgt.begin();  // columns
+  auto itr_B = d_str.length() < d_tgt.length() ? d_tgt.begin() : d_str.begin();  // rows
+
+  int32_t const band_width = 2 * max_distance + 1;
+  int16_t const big        = static_cast<int16_t>(max_distance + 1);  // all values capped here
+  // setup compute buffer pointers
+  auto prev = buffer;
+  auto curr = prev + band_width;
+
+  // seed the first row; the distance to an empty prefix is the column index
+  for (int32_t j = 0; j < band_width; ++j) {
+    auto const x = j - max_distance;  // column index of band position j in row 0
+    prev[j]      = (x >= 0 && x <= max_distance) ? static_cast<int16_t>(x) : big;
+  }
+
+  for (cudf::size_type y = 1; y <= lengths.second; ++y) {
+    itr_B += (y - 1 - itr_B.position());  // point to the row character
+    auto const ch_B = *itr_B;
+    int16_t row_min = big;
+    for (int32_t j = 0; j < band_width; ++j) {
+      auto const x = y - max_distance + j;  // column index of band position j
+      if (x < 0 || x > lengths.first) {
+        curr[j] = big;
+        continue;
+      }
+      int32_t value = y;  // column 0 holds the distance to an empty prefix
+      if (x > 0) {
+        itr_A += (x - 1 - itr_A.position());  // point to the column character
+        int32_t const w = prev[j] + static_cast<int32_t>(*itr_A != ch_B);
+        int32_t const u = (j + 1 < band_width) ? prev[j + 1] + 1 : big;
+        int32_t const v = (j > 0) ? curr[j - 1] + 1 : big;
+        value           = std::min(std::min(u, v), w);
+      }
+      curr[j] = static_cast<int16_t>(std::min(value, static_cast<int32_t>(big)));
+      row_min = std::min(row_min, curr[j]);
+    }
+    if (row_min > max_distance) return max_distance + 1;  // early termination
+    auto tmp = prev;
+    prev     = curr;
+    curr     = tmp;
+  }
+  // the result is at the min-length column of the last row
+  return prev[lengths.first - lengths.second + max_distance];
+}
+
 /**
  * @brief Compute the Levenshtein distance for each string.
  *
@@ -114,6 +187,28 @@ struct edit_distance_levenshtein_algorithm {
   }
 };
 
+struct edit_distance_bounded_levenshtein_algorithm {
+  cudf::column_device_view d_strings;  // computing these
+  cudf::column_device_view d_targets;  // against these
+  int16_t* d_buffer;                   // compute buffer for each string
+  int32_t max_distance;                // distances are capped at this value plus one
+  int32_t* d_results;                  // edit distance values
+
+  __device__ void operator()(cudf::size_type idx)
+  {
+    auto d_str =
+      d_strings.is_null(idx) ? cudf::string_view{} : d_strings.element<cudf::string_view>(idx);
+    auto d_tgt = [&] __device__ {  // d_targets is also allowed to have only one entry
+      if (d_targets.is_null(idx)) return cudf::string_view{};
+      return d_targets.size() == 1 ? d_targets.element<cudf::string_view>(0)
+                                   : d_targets.element<cudf::string_view>(idx);
+    }();
+    // each row uses a fixed two band-rows of working memory
+    auto work_buffer = d_buffer + (idx * 2 * (2 * max_distance + 1));
+    d_results[idx]   = compute_distance_bounded(d_str, d_tgt, work_buffer, max_distance);
+  }
+};
+
 struct edit_distance_matrix_levenshtein_algorithm {
   cudf::column_device_view d_strings;  // computing these against itself
   int16_t* d_buffer;                   // compute buffer for each string
@@ -202,6 +297,51 @@ std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& str
   return results;
 }
 
+/**
+ * @copydoc nvtext::edit_distance_bounded
+ */
+std::unique_ptr<cudf::column> edit_distance_bounded(cudf::strings_column_view const& strings,
+                                                    cudf::strings_column_view const& targets,
+                                                    cudf::size_type max_distance,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(max_distance >= 0, "max_distance must not be negative");
+  cudf::size_type strings_count = strings.size();
+  if (strings_count == 0) return cudf::make_empty_column(cudf::data_type{cudf::type_id::INT32});
+  if (targets.size() > 1)
+    CUDF_EXPECTS(strings_count == targets.size(), "targets.size() must equal strings.size()");
+
+  // create device columns from the input columns
+  auto strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  auto d_strings      = *strings_column;
+  auto targets_column = cudf::column_device_view::create(targets.parent(), stream);
+  auto d_targets      = *targets_column;
+
+  // the band only requires two rows of (2 * max_distance + 1) values per string
+  // regardless of the string lengths so no sizes/offsets scan is needed
+  auto const band_width = 2 * max_distance + 1;
+  rmm::device_uvector<int16_t> compute_buffer(
+    static_cast<size_t>(strings_count) * 2 * band_width, stream);
+  auto d_buffer = compute_buffer.data();
+
+  auto results   = cudf::make_fixed_width_column(cudf::data_type{cudf::type_id::INT32},
+                                               strings_count,
+                                               rmm::device_buffer{0, stream, mr},
+                                               0,
+                                               stream,
+                                               mr);
+  auto d_results = results->mutable_view().data<int32_t>();
+
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    strings_count,
+    edit_distance_bounded_levenshtein_algorithm{
+      d_strings, d_targets, d_buffer, max_distance, d_results});
+  return results;
+}
+
 /**
  * @copydoc nvtext::edit_distance_matrix
  */
@@ -306,6 +446,18 @@ std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& str
   return detail::edit_distance(strings, targets, rmm::cuda_stream_default, mr);
 }
 
+/**
+ * @copydoc nvtext::edit_distance_bounded
+ */
+std::unique_ptr<cudf::column> edit_distance_bounded(cudf::strings_column_view const& strings,
+                                                    cudf::strings_column_view const& targets,
+                                                    cudf::size_type max_distance,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::edit_distance_bounded(strings, targets, max_distance, rmm::cuda_stream_default, mr);
+}
+
 /**
  * @copydoc nvtext::edit_distance_matrix
  */
@@ -21,6 +21,7 @@
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
@@ -181,6 +182,34 @@ struct character_ngram_generator_fn {
   }
 };
 
+/**
+ * @brief Computes the hash of each character ngram directly from the source chars.
+ *
+ * No intermediate ngram strings are materialized.
+ */
+struct character_ngram_hash_fn {
+  cudf::column_device_view const d_strings;
+  cudf::size_type ngrams;
+  int32_t const* d_ngram_offsets;
+  uint32_t* d_hashes;
+
+  __device__ void operator()(cudf::size_type idx)
+  {
+    if (d_strings.is_null(idx)) return;
+    auto const d_str = d_strings.element<cudf::string_view>(idx);
+    if (d_str.empty()) return;
+    auto itr               = d_str.begin();
+    auto const ngram_count = d_ngram_offsets[idx + 1] - d_ngram_offsets[idx];
+    auto d_str_hashes      = d_hashes + d_ngram_offsets[idx];
+    auto const hasher      = cudf::detail::MurmurHash3_32<cudf::string_view>{};
+    for (cudf::size_type n = 0; n < ngram_count; ++n, ++itr) {
+      auto const begin = itr.byte_offset();
+      auto const end   = (itr + ngrams).byte_offset();
+      d_str_hashes[n]  = hasher(cudf::string_view(d_str.data() + begin, end - begin));
+    }
+  }
+};
+
 }  // namespace
 
 std::unique_ptr<cudf::column> generate_character_ngrams(cudf::strings_column_view const& strings,
@@ -249,6 +278,67 @@ std::unique_ptr<cudf::column> generate_character_ngrams(cudf::strings_column_vie
     total_ngrams, std::move(offsets_column), std::move(chars_column), 0, rmm::device_buffer{});
 }
 
+std::unique_ptr<cudf::column> hash_character_ngrams(cudf::strings_column_view const& strings,
+                                                    cudf::size_type ngrams,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(ngrams > 1, "Parameter ngrams should be an integer value of 2 or greater");
+
+  auto const strings_count = strings.size();
+  if (strings_count == 0)  // if no strings, return an empty lists column
+    return cudf::make_lists_column(0,
+                                   cudf::make_empty_column(cudf::data_type{cudf::type_id::INT32}),
+                                   cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
+                                   0,
+                                   rmm::device_buffer{},
+                                   stream,
+                                   mr);
+
+  auto const strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  auto const d_strings      = *strings_column;
+
+  // build the offsets column identifying the ngrams (and hashes) per string
+  auto offsets_column = cudf::make_numeric_column(
+    cudf::data_type{cudf::type_id::INT32}, strings_count + 1, cudf::mask_state::UNALLOCATED, stream, mr);
+  auto d_offsets = offsets_column->mutable_view().data<int32_t>();
+  thrust::transform_exclusive_scan(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(strings_count + 1),
+    d_offsets,
+    [d_strings, strings_count, ngrams] __device__(auto idx) {
+      if (d_strings.is_null(idx) || (idx == strings_count)) return 0;
+      auto const length = d_strings.element<cudf::string_view>(idx).length();
+      return std::max(0, static_cast<int32_t>(length + 1 - ngrams));
+    },
+    cudf::size_type{0},
+    thrust::plus<cudf::size_type>());
+
+  // total ngrams count is the last entry
+  auto const total_ngrams =
+    cudf::detail::get_value<int32_t>(offsets_column->view(), strings_count, stream);
+  CUDF_EXPECTS(total_ngrams > 0,
+               "Insufficient number of characters in each string to generate ngrams");
+
+  // hash each ngram directly from the source characters
+  auto hashes_column = cudf::make_numeric_column(
+    cudf::data_type{cudf::type_id::UINT32}, total_ngrams, cudf::mask_state::UNALLOCATED, stream, mr);
+  auto d_hashes = hashes_column->mutable_view().data<uint32_t>();
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count,
+                     character_ngram_hash_fn{d_strings, ngrams, d_offsets, d_hashes});
+
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets_column),
+                                 std::move(hashes_column),
+                                 0,  // no nulls
+                                 rmm::device_buffer{},
+                                 stream,
+                                 mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> generate_character_ngrams(cudf::strings_column_view const& strings,
@@ -259,4 +349,12 @@ std::unique_ptr<cudf::column> generate_character_ngrams(cudf::strings_column_vie
   return detail::generate_character_ngrams(strings, ngrams, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<cudf::column> hash_character_ngrams(cudf::strings_column_view const& strings,
+                                                    cudf::size_type ngrams,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_character_ngrams(strings, ngrams, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace nvtext
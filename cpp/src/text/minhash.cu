@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <nvtext/minhash.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/transform_scan.h>
+
+namespace nvtext {
+namespace detail {
+namespace {
+
+/**
+ * @brief Computes one signature value for one string.
+ *
+ * Each thread handles a (string, seed) pair and scans the string's
+ * `width`-character substrings computing the minimum hash for its seed.
+ * The substrings are hashed in place from the source characters.
+ */
+struct minhash_fn {
+  cudf::column_device_view const d_strings;
+  cudf::size_type width;
+  cudf::size_type num_hashes;
+  int32_t const* d_offsets;
+  uint32_t* d_signatures;
+
+  __device__ void operator()(cudf::size_type idx)
+  {
+    auto const str_idx = idx / num_hashes;
+    if (d_strings.is_null(str_idx)) return;
+    auto const seed   = static_cast<uint32_t>(idx % num_hashes);
+    auto const d_str  = d_strings.element<cudf::string_view>(str_idx);
+    auto const hasher = cudf::detail::MurmurHash3_32<cudf::string_view>{seed};
+
+    // strings shorter than the substring width are hashed whole
+    auto const substr_count = std::max(1, d_str.length() - width + 1);
+    uint32_t min_hash       = std::numeric_limits<uint32_t>::max();
+    auto itr                = d_str.begin();
+    for (cudf::size_type n = 0; n < substr_count; ++n, ++itr) {
+      auto const begin = itr.byte_offset();
+      auto const end   = (itr + width).byte_offset();
+      min_hash =
+        std::min(min_hash, hasher(cudf::string_view(d_str.data() + begin, end - begin)));
+    }
+    d_signatures[d_offsets[str_idx] + (idx % num_hashes)] = min_hash;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& strings,
+                                      cudf::size_type width,
+                                      cudf::size_type num_hashes,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(width > 1, "Parameter width should be an integer value of 2 or greater");
+  CUDF_EXPECTS(num_hashes > 0, "Parameter num_hashes should be greater than zero");
+
+  auto const strings_count = strings.size();
+  if (strings_count == 0)  // if no strings, return an empty lists column
+    return cudf::make_lists_column(0,
+                                   cudf::make_empty_column(cudf::data_type{cudf::type_id::INT32}),
+                                   cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
+                                   0,
+                                   rmm::device_buffer{},
+                                   stream,
+                                   mr);
+
+  auto const strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  auto const d_strings      = *strings_column;
+
+  // valid rows produce num_hashes signature values; null rows produce none
+  auto offsets_column = cudf::make_numeric_column(
+    cudf::data_type{cudf::type_id::INT32}, strings_count + 1, cudf::mask_state::UNALLOCATED, stream, mr);
+  auto d_offsets = offsets_column->mutable_view().data<int32_t>();
+  thrust::transform_exclusive_scan(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(strings_count + 1),
+    d_offsets,
+    [d_strings, strings_count, num_hashes] __device__(auto idx) {
+      if ((idx == strings_count) || d_strings.is_null(idx)) return 0;
+      return num_hashes;
+    },
+    cudf::size_type{0},
+    thrust::plus<cudf::size_type>());
+  auto const total_hashes =
+    cudf::detail::get_value<int32_t>(offsets_column->view(), strings_count, stream);
+
+  // compute the signature values
+  auto signatures_column = cudf::make_numeric_column(
+    cudf::data_type{cudf::type_id::UINT32}, total_hashes, cudf::mask_state::UNALLOCATED, stream, mr);
+  auto d_signatures = signatures_column->mutable_view().data<uint32_t>();
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count * num_hashes,
+                     minhash_fn{d_strings, width, num_hashes, d_offsets, d_signatures});
+
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets_column),
+                                 std::move(signatures_column),
+                                 0,  // no nulls
+                                 rmm::device_buffer{},
+                                 stream,
+                                 mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& strings,
+                                      cudf::size_type width,
+                                      cudf::size_type num_hashes,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash(strings, width, num_hashes, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace nvtext
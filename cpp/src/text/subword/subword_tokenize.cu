@@ -123,21 +123,21 @@ __global__ void kernel_compute_tensor_metadata(
 
 }  // namespace
 
-tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
-                                  hashed_vocabulary const& vocab_table,
-                                  uint32_t max_sequence_length,
-                                  uint32_t stride,
-                                  bool do_lower_case,
-                                  bool do_truncate,
-                                  uint32_t max_rows_tensor,
-                                  rmm::cuda_stream_view stream,
-                                  rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Tokenizes a strings column with the given tokenizer and formats the
+ * resulting token-ids into output tensors.
+ *
+ * This is shared by the free `subword_tokenize` functions which build a
+ * tokenizer per call and by `nvtext::subword_tokenizer` which reuses one.
+ */
+tokenizer_result tokenize_into_tensors(wordpiece_tokenizer& tokenizer,
+                                       cudf::strings_column_view const& strings,
+                                       uint32_t max_sequence_length,
+                                       uint32_t stride,
+                                       bool do_truncate,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
 {
-  CUDF_EXPECTS(stride <= max_sequence_length,
-               "stride must be less than or equal to max_sequence_length");
-  CUDF_EXPECTS(max_sequence_length * max_rows_tensor <
-                 static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
-               "max_sequence_length x max_rows_tensor is too large for cudf output column size");
   auto const strings_count = strings.size();
   if (strings_count == 0 || strings.chars_size() == 0)
     return tokenizer_result{0,
@@ -151,9 +151,6 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
   auto const offset    = cudf::detail::get_value<int32_t>(offsets, strings.offset(), stream);
   auto const d_chars   = strings.chars().data<char>() + offset;
 
-  // Create tokenizer
-  wordpiece_tokenizer tokenizer(
-    vocab_table, max_rows_tensor, max_sequence_length, stride, do_truncate, do_lower_case, stream);
   // Run tokenizer
   auto const tokens = tokenizer.tokenize(d_chars, d_offsets, strings_count, stream);
   // assign output components
@@ -247,8 +244,105 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                           std::move(tensor_metadata)};
 }
 
+tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
+                                  hashed_vocabulary const& vocab_table,
+                                  uint32_t max_sequence_length,
+                                  uint32_t stride,
+                                  bool do_lower_case,
+                                  bool do_truncate,
+                                  uint32_t max_rows_tensor,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(stride <= max_sequence_length,
+               "stride must be less than or equal to max_sequence_length");
+  CUDF_EXPECTS(max_sequence_length * max_rows_tensor <
+                 static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
+               "max_sequence_length x max_rows_tensor is too large for cudf output column size");
+
+  wordpiece_tokenizer tokenizer(
+    vocab_table, max_rows_tensor, max_sequence_length, stride, do_truncate, do_lower_case, stream);
+  return tokenize_into_tensors(
+    tokenizer, strings, max_sequence_length, stride, do_truncate, stream, mr);
+}
+
 }  // namespace detail
 
+struct subword_tokenizer::tokenizer_impl {
+  std::unique_ptr<hashed_vocabulary> vocabulary;
+  uint32_t max_sequence_length;
+  uint32_t stride;
+  bool do_truncate;
+  detail::wordpiece_tokenizer tokenizer;
+
+  tokenizer_impl(std::unique_ptr<hashed_vocabulary> vocabulary,
+                 uint32_t max_sequence_length,
+                 uint32_t stride,
+                 bool do_lower_case,
+                 bool do_truncate,
+                 uint32_t max_rows_tensor)
+    : vocabulary(std::move(vocabulary)),
+      max_sequence_length(max_sequence_length),
+      stride(stride),
+      do_truncate(do_truncate),
+      tokenizer(*(this->vocabulary),
+                max_rows_tensor,
+                max_sequence_length,
+                stride,
+                do_truncate,
+                do_lower_case,
+                rmm::cuda_stream_default)
+  {
+  }
+};
+
+subword_tokenizer::subword_tokenizer(std::unique_ptr<hashed_vocabulary> vocabulary,
+                                     uint32_t max_sequence_length,
+                                     uint32_t stride,
+                                     bool do_lower_case,
+                                     bool do_truncate,
+                                     uint32_t max_rows_tensor)
+{
+  CUDF_EXPECTS(vocabulary != nullptr, "vocabulary must not be null");
+  CUDF_EXPECTS(stride <= max_sequence_length,
+               "stride must be less than or equal to max_sequence_length");
+  CUDF_EXPECTS(max_sequence_length * max_rows_tensor <
+                 static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
+               "max_sequence_length x max_rows_tensor is too large for cudf output column size");
+  _impl = std::make_unique<tokenizer_impl>(
+    std::move(vocabulary), max_sequence_length, stride, do_lower_case, do_truncate, max_rows_tensor);
+}
+
+subword_tokenizer::subword_tokenizer(std::string const& filename_hashed_vocabulary,
+                                     uint32_t max_sequence_length,
+                                     uint32_t stride,
+                                     bool do_lower_case,
+                                     bool do_truncate,
+                                     uint32_t max_rows_tensor)
+  : subword_tokenizer(load_vocabulary_file(filename_hashed_vocabulary),
+                      max_sequence_length,
+                      stride,
+                      do_lower_case,
+                      do_truncate,
+                      max_rows_tensor)
+{
+}
+
+subword_tokenizer::~subword_tokenizer() = default;
+
+tokenizer_result subword_tokenizer::tokenize(cudf::strings_column_view const& strings,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::tokenize_into_tensors(_impl->tokenizer,
+                                       strings,
+                                       _impl->max_sequence_length,
+                                       _impl->stride,
+                                       _impl->do_truncate,
+                                       rmm::cuda_stream_default,
+                                       mr);
+}
+
 tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                                   std::string const& filename_hashed_vocabulary,
                                   uint32_t max_sequence_length,
@@ -19,6 +19,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/strings/detail/strings_column_factories.cuh>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
@@ -33,6 +34,7 @@
 
 #include <thrust/copy.h>
 #include <thrust/transform.h>
+#include <thrust/uninitialized_fill.h>
 
 namespace nvtext {
 namespace detail {
@@ -92,6 +94,73 @@ std::unique_ptr<cudf::column> tokenize_fn(cudf::size_type strings_count,
   return cudf::strings::detail::make_strings_column(tokens.begin(), tokens.end(), stream, mr);
 }
 
+using vocabulary_hasher = cudf::detail::MurmurHash3_32<cudf::string_view>;
+
+/**
+ * @brief Inserts each vocabulary entry into the open-addressing probe table.
+ *
+ * Empty slots hold -1; collisions (and any duplicate entries) probe linearly
+ * to the next free slot.
+ */
+struct vocabulary_inserter {
+  cudf::column_device_view const d_vocabulary;  ///< vocabulary entries
+  cudf::size_type* d_table;                     ///< probe table of vocabulary row indices
+  cudf::size_type table_size;                   ///< number of slots in d_table
+
+  __device__ void operator()(cudf::size_type idx)
+  {
+    auto const d_str = d_vocabulary.element<cudf::string_view>(idx);
+    auto slot = static_cast<cudf::size_type>(vocabulary_hasher{}(d_str) % table_size);
+    while (atomicCAS(d_table + slot, cudf::size_type{-1}, idx) != -1) {
+      slot = (slot + 1) % table_size;
+    }
+  }
+};
+
+/**
+ * @brief Tokenizes each string and resolves every token against the vocabulary.
+ *
+ * Each token is built as a `string_view` over the input characters and hashed
+ * in place, so no token strings are materialized. The output id is the row
+ * index of the matching vocabulary entry or `default_id` when no entry matches.
+ */
+struct vocabulary_tokenizer {
+  cudf::column_device_view const d_strings;     ///< strings to tokenize
+  cudf::string_view const d_delimiter;          ///< delimiter characters
+  cudf::column_device_view const d_vocabulary;  ///< vocabulary entries
+  cudf::size_type const* d_table;               ///< probe table of vocabulary row indices
+  cudf::size_type table_size;                   ///< number of slots in d_table
+  cudf::size_type default_id;                   ///< id for out-of-vocabulary tokens
+  int32_t const* d_offsets;                     ///< offsets into d_results for each string
+  int32_t* d_results;                           ///< token ids output
+
+  __device__ cudf::size_type lookup(cudf::string_view const& token) const
+  {
+    auto slot = static_cast<cudf::size_type>(vocabulary_hasher{}(token) % table_size);
+    while (true) {
+      auto const index = d_table[slot];
+      if (index < 0) return default_id;  // empty slot: token is out-of-vocabulary
+      if (d_vocabulary.element<cudf::string_view>(index) == token) return index;
+      slot = (slot + 1) % table_size;
+    }
+  }
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    if (d_strings.is_null(idx)) return;
+    auto const d_str = d_strings.element<cudf::string_view>(idx);
+    characters_tokenizer tokenizer(d_str, d_delimiter);
+    auto d_str_results        = d_results + d_offsets[idx];
+    cudf::size_type token_idx = 0;
+    while (tokenizer.next_token()) {
+      auto const token_pos = tokenizer.token_byte_positions();
+      cudf::string_view const token{d_str.data() + token_pos.first,
+                                    token_pos.second - token_pos.first};
+      d_str_results[token_idx++] = lookup(token);
+    }
+  }
+};
+
 }  // namespace
 
 // detail APIs
@@ -159,6 +228,69 @@ std::unique_ptr<cudf::column> count_tokens(cudf::strings_column_view const& stri
     mr);
 }
 
+// fused tokenize and vocabulary lookup
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view const& strings,
+                                                       cudf::strings_column_view const& vocabulary,
+                                                       cudf::string_scalar const& delimiter,
+                                                       cudf::size_type default_id,
+                                                       rmm::cuda_stream_view stream,
+                                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(delimiter.is_valid(), "Parameter delimiter must be valid");
+  CUDF_EXPECTS(vocabulary.size() > 0, "Parameter vocabulary must not be empty");
+  CUDF_EXPECTS(!vocabulary.has_nulls(), "Parameter vocabulary must not have nulls");
+
+  cudf::string_view d_delimiter(delimiter.data(), delimiter.size());
+  auto const strings_column    = cudf::column_device_view::create(strings.parent(), stream);
+  auto const vocabulary_column = cudf::column_device_view::create(vocabulary.parent(), stream);
+
+  // get the number of tokens in each string
+  auto const token_counts =
+    token_count_fn(strings.size(),
+                   strings_tokenizer{*strings_column, d_delimiter},
+                   stream,
+                   rmm::mr::get_current_device_resource());
+  auto d_token_counts = token_counts->view();
+  // create token-index offsets from the counts
+  rmm::device_uvector<int32_t> token_offsets(strings.size() + 1, stream);
+  thrust::inclusive_scan(rmm::exec_policy(stream),
+                         d_token_counts.template begin<int32_t>(),
+                         d_token_counts.template end<int32_t>(),
+                         token_offsets.begin() + 1);
+  token_offsets.set_element_to_zero_async(0, stream);
+  auto const total_tokens = token_offsets.back_element(stream);
+
+  // build the probe table over the vocabulary at 50% occupancy
+  auto const table_size = vocabulary.size() * 2 + 1;
+  rmm::device_uvector<cudf::size_type> table(table_size, stream);
+  thrust::uninitialized_fill(
+    rmm::exec_policy(stream), table.begin(), table.end(), cudf::size_type{-1});
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     vocabulary.size(),
+                     vocabulary_inserter{*vocabulary_column, table.data(), table_size});
+
+  // tokenize and write the resolved token ids directly
+  auto results   = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                           total_tokens,
+                                           cudf::mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  auto d_results = results->mutable_view().data<int32_t>();
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings.size(),
+                     vocabulary_tokenizer{*strings_column,
+                                          d_delimiter,
+                                          *vocabulary_column,
+                                          table.data(),
+                                          table_size,
+                                          default_id,
+                                          token_offsets.data(),
+                                          d_results});
+  return results;
+}
+
 // tokenize on every character
 std::unique_ptr<cudf::column> character_tokenize(cudf::strings_column_view const& strings_column,
                                                  rmm::cuda_stream_view stream,
@@ -261,4 +393,15 @@ std::unique_ptr<cudf::column> character_tokenize(cudf::strings_column_view const
   return detail::character_tokenize(strings, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view const& strings,
+                                                       cudf::strings_column_view const& vocabulary,
+                                                       cudf::string_scalar const& delimiter,
+                                                       cudf::size_type default_id,
+                                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::tokenize_with_vocabulary(
+    strings, vocabulary, delimiter, default_id, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace nvtext
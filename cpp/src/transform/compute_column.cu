@@ -19,29 +19,102 @@
 #include <cudf/ast/expressions.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/instrumentation.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/transform.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/cuda_graph.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
 #include <rmm/mr/device/device_memory_resource.hpp>
 
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 
+namespace {
+
+/**
+ * @brief Result container that writes data through to the output column but
+ * defers the validity write to the caller.
+ *
+ * The expression evaluator already resolves each row's validity as predicate
+ * state while evaluating (no intermediate masks are materialized), but writing
+ * the final bit through `mutable_column_device_view::set_valid` costs one
+ * global atomic per row. Capturing the validity here instead lets the kernel
+ * emit whole bitmask words with one ballot per warp and accumulate the valid
+ * count on the fly.
+ *
+ * @tparam has_nulls Whether or not the result data is nullable.
+ */
+template <bool has_nulls>
+struct deferred_validity_expression_result
+  : public ast::detail::expression_result<deferred_validity_expression_result<has_nulls>,
+                                          mutable_column_device_view,
+                                          has_nulls> {
+  CUDA_DEVICE_CALLABLE deferred_validity_expression_result(mutable_column_device_view& obj)
+    : _obj(obj)
+  {
+  }
+
+  template <typename Element>
+  CUDA_DEVICE_CALLABLE void set_value(
+    cudf::size_type column_index,
+    cudf::size_type row_index,
+    ast::detail::possibly_null_value_t<Element, has_nulls> const& result)
+  {
+    if constexpr (has_nulls) {
+      _valid = result.has_value();
+      if (result.has_value()) { _obj.template element<Element>(row_index) = *result; }
+    } else {
+      _obj.template element<Element>(row_index) = result;
+    }
+  }
+
+  /**
+   * @brief Returns true if the last row written was valid and false otherwise.
+   */
+  CUDA_DEVICE_CALLABLE bool is_valid() const { return _valid; }
+
+  /**
+   * @brief Not implemented for this specialization.
+   */
+  CUDA_DEVICE_CALLABLE mutable_column_device_view value() const
+  {
+    cudf_assert(false && "This method is not implemented.");
+  }
+
+  mutable_column_device_view& _obj;  ///< The column to which the data is written.
+  bool _valid{true};                 ///< The validity of the last row written.
+};
+
+}  // anonymous namespace
+
 /**
  * @brief Kernel for evaluating an expression on a table to produce a new column.
  *
  * This evaluates an expression over a table to produce a new column. Also called an n-ary
  * transform.
  *
+ * When `has_nulls` is true, each warp covers exactly one bitmask word of rows
+ * (the launch must use a block size that is a multiple of the warp size), so
+ * the output mask is written one full word per warp via ballot rather than one
+ * bit per row, and the number of valid rows is accumulated into `valid_count`.
+ *
  * @tparam max_block_size The size of the thread block, used to set launch
  * bounds and minimize register usage.
  * @tparam has_nulls whether or not the output column may contain nulls.
@@ -50,12 +123,14 @@ namespace detail {
  * @param device_expression_data Container of device data required to evaluate the desired
  * expression.
  * @param output_column The destination for the results of evaluating the expression.
+ * @param valid_count The number of valid output rows; unused if `has_nulls` is false.
  */
 template <cudf::size_type max_block_size, bool has_nulls>
 __launch_bounds__(max_block_size) __global__
   void compute_column_kernel(table_device_view const table,
                              ast::detail::expression_device_view device_expression_data,
-                             mutable_column_device_view output_column)
+                             mutable_column_device_view output_column,
+                             cudf::size_type* valid_count)
 {
   // The (required) extern storage of the shared memory array leads to
   // conflicting declarations between different templates. The easiest
@@ -65,6 +140,63 @@ __launch_bounds__(max_block_size) __global__
   ast::detail::IntermediateDataType<has_nulls>* intermediate_storage =
     reinterpret_cast<ast::detail::IntermediateDataType<has_nulls>*>(raw_intermediate_storage);
 
+  auto thread_intermediate_storage =
+    &intermediate_storage[threadIdx.x * device_expression_data.num_intermediates];
+  auto const start_idx = static_cast<cudf::size_type>(threadIdx.x + blockIdx.x * blockDim.x);
+  auto const stride    = static_cast<cudf::size_type>(blockDim.x * gridDim.x);
+  auto const num_rows  = table.num_rows();
+  auto evaluator =
+    cudf::ast::detail::expression_evaluator<has_nulls>(table, device_expression_data);
+
+  auto const lane_id = threadIdx.x % cudf::detail::warp_size;
+  cudf::size_type warp_valid_count{0};
+
+  cudf::size_type row_index = start_idx;
+  auto active_mask          = __ballot_sync(0xffff'ffffu, row_index < num_rows);
+  while (row_index < num_rows) {
+    auto output_dest = deferred_validity_expression_result<has_nulls>(output_column);
+    evaluator.evaluate(output_dest, row_index, thread_intermediate_storage);
+    if constexpr (has_nulls) {
+      bitmask_type const ballot = __ballot_sync(active_mask, output_dest.is_valid());
+      if (lane_id == 0) {
+        output_column.set_mask_word(cudf::word_index(row_index), ballot);
+        warp_valid_count += __popc(ballot);
+      }
+    }
+    row_index += stride;
+    active_mask = __ballot_sync(active_mask, row_index < num_rows);
+  }
+
+  if constexpr (has_nulls) {
+    if (lane_id == 0 && warp_valid_count > 0) { atomicAdd(valid_count, warp_valid_count); }
+  }
+}
+
+/**
+ * @brief Kernel for evaluating several expressions on a table to produce new columns.
+ *
+ * The expressions are linearized into a single plan sharing common
+ * subexpressions; each expression's root writes to its own output column.
+ *
+ * @tparam max_block_size The size of the thread block, used to set launch
+ * bounds and minimize register usage.
+ * @tparam has_nulls whether or not the output columns may contain nulls.
+ *
+ * @param table The table device view used for evaluation.
+ * @param device_expression_data Container of device data required to evaluate the desired
+ * expressions.
+ * @param output_columns The destinations for the results of evaluating the expressions.
+ */
+template <cudf::size_type max_block_size, bool has_nulls>
+__launch_bounds__(max_block_size) __global__
+  void compute_columns_kernel(table_device_view const table,
+                              ast::detail::expression_device_view device_expression_data,
+                              mutable_table_device_view output_columns)
+{
+  extern __shared__ char raw_intermediate_storage[];
+  ast::detail::IntermediateDataType<has_nulls>* intermediate_storage =
+    reinterpret_cast<ast::detail::IntermediateDataType<has_nulls>*>(raw_intermediate_storage);
+
   auto thread_intermediate_storage =
     &intermediate_storage[threadIdx.x * device_expression_data.num_intermediates];
   auto const start_idx = static_cast<cudf::size_type>(threadIdx.x + blockIdx.x * blockDim.x);
@@ -73,7 +205,7 @@ __launch_bounds__(max_block_size) __global__
     cudf::ast::detail::expression_evaluator<has_nulls>(table, device_expression_data);
 
   for (cudf::size_type row_index = start_idx; row_index < table.num_rows(); row_index += stride) {
-    auto output_dest = ast::detail::mutable_column_expression_result<has_nulls>(output_column);
+    auto output_dest = ast::detail::mutable_table_expression_result<has_nulls>(output_columns);
     evaluator.evaluate(output_dest, row_index, thread_intermediate_storage);
   }
 }
@@ -106,36 +238,120 @@ std::unique_ptr<column> compute_column(table_view const& table,
   CUDA_TRY(
     cudaDeviceGetAttribute(&shmem_limit_per_block, cudaDevAttrMaxSharedMemoryPerBlock, device_id));
   auto constexpr MAX_BLOCK_SIZE = 128;
-  auto const block_size =
+  auto const unrounded_block_size =
     parser.shmem_per_thread != 0
       ? std::min(MAX_BLOCK_SIZE, shmem_limit_per_block / parser.shmem_per_thread)
       : MAX_BLOCK_SIZE;
+  // The kernel writes the output mask one full bitmask word per warp, which
+  // requires each warp to cover exactly one word of rows.
+  auto const block_size =
+    (unrounded_block_size / cudf::detail::warp_size) * cudf::detail::warp_size;
+  CUDF_EXPECTS(block_size > 0, "The expression requires too many intermediates to evaluate");
   auto const config          = cudf::detail::grid_1d{table.num_rows(), block_size};
   auto const shmem_per_block = parser.shmem_per_thread * config.num_threads_per_block;
 
   // Execute the kernel
   auto table_device = table_device_view::create(table, stream);
   if (has_nulls) {
+    rmm::device_scalar<cudf::size_type> valid_count(0, stream);
     cudf::detail::compute_column_kernel<MAX_BLOCK_SIZE, true>
       <<<config.num_blocks, config.num_threads_per_block, shmem_per_block, stream.value()>>>(
-        *table_device, device_expression_data, *mutable_output_device);
+        *table_device, device_expression_data, *mutable_output_device, valid_count.data());
+    if (is_stream_capturing(stream)) {
+      // Reading the valid count back would synchronize and invalidate an
+      // ongoing graph capture; leave the null count to be computed lazily
+      output_column->set_null_count(cudf::UNKNOWN_NULL_COUNT);
+    } else {
+      output_column->set_null_count(table.num_rows() - valid_count.value(stream));
+    }
   } else {
     cudf::detail::compute_column_kernel<MAX_BLOCK_SIZE, false>
       <<<config.num_blocks, config.num_threads_per_block, shmem_per_block, stream.value()>>>(
-        *table_device, device_expression_data, *mutable_output_device);
+        *table_device, device_expression_data, *mutable_output_device, nullptr);
   }
   CHECK_CUDA(stream.value());
   return output_column;
 }
 
+std::unique_ptr<table> compute_columns(
+  table_view const& table,
+  std::vector<std::reference_wrapper<ast::expression const>> const& exprs,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(!exprs.empty(), "compute_columns requires at least one expression.");
+
+  // All outputs share one code path: if any expression may produce nulls, all
+  // output columns are created nullable.
+  auto const has_nulls =
+    std::any_of(exprs.cbegin(), exprs.cend(), [&](auto const& expr) {
+      return expr.get().may_evaluate_null(table, stream);
+    });
+
+  auto const parser = ast::detail::expression_parser{exprs, table, has_nulls, stream, mr};
+
+  auto const output_column_mask_state =
+    has_nulls ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED;
+
+  auto output_columns = std::vector<std::unique_ptr<column>>{};
+  auto output_views   = std::vector<mutable_column_view>{};
+  for (auto const& type : parser.output_types()) {
+    output_columns.push_back(
+      cudf::make_fixed_width_column(type, table.num_rows(), output_column_mask_state, stream, mr));
+    output_views.push_back(output_columns.back()->mutable_view());
+  }
+  auto mutable_output               = mutable_table_view{output_views};
+  auto mutable_output_device        = cudf::mutable_table_device_view::create(mutable_output, stream);
+
+  // Configure kernel parameters
+  auto const& device_expression_data = parser.device_expression_data;
+  int device_id;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  int shmem_limit_per_block;
+  CUDA_TRY(
+    cudaDeviceGetAttribute(&shmem_limit_per_block, cudaDevAttrMaxSharedMemoryPerBlock, device_id));
+  auto constexpr MAX_BLOCK_SIZE = 128;
+  auto const block_size =
+    parser.shmem_per_thread != 0
+      ? std::min(MAX_BLOCK_SIZE, shmem_limit_per_block / parser.shmem_per_thread)
+      : MAX_BLOCK_SIZE;
+  auto const config          = cudf::detail::grid_1d{table.num_rows(), block_size};
+  auto const shmem_per_block = parser.shmem_per_thread * config.num_threads_per_block;
+
+  // Execute the kernel
+  auto table_device = table_device_view::create(table, stream);
+  if (has_nulls) {
+    cudf::detail::compute_columns_kernel<MAX_BLOCK_SIZE, true>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_per_block, stream.value()>>>(
+        *table_device, device_expression_data, *mutable_output_device);
+  } else {
+    cudf::detail::compute_columns_kernel<MAX_BLOCK_SIZE, false>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_per_block, stream.value()>>>(
+        *table_device, device_expression_data, *mutable_output_device);
+  }
+  CHECK_CUDA(stream.value());
+  return std::make_unique<cudf::table>(std::move(output_columns));
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> compute_column(table_view const& table,
                                        ast::expression const& expr,
+                                       rmm::cuda_stream_view stream,
                                        rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::compute_column(table, expr, rmm::cuda_stream_default, mr);
+  CUDF_OP_RANGE(table.num_rows());
+  return detail::compute_column(table, expr, stream, mr);
+}
+
+std::unique_ptr<table> compute_columns(
+  table_view const& table,
+  std::vector<std::reference_wrapper<ast::expression const>> const& exprs,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_OP_RANGE(table.num_rows());
+  return detail::compute_columns(table, exprs, stream, mr);
 }
 
 }  // namespace cudf
@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/detail/operators.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/instrumentation.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <jit_preprocessed_files/transform/jit/expression_kernel.cu.jit.hpp>
+
+#include <jit/cache.hpp>
+#include <jit/type.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <limits>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace transformation {
+namespace jit {
+namespace {
+
+/**
+ * @brief Renders the host value of a numeric literal as a C++ source literal.
+ */
+struct literal_to_source {
+  template <typename T, std::enable_if_t<cudf::is_numeric<T>()>* = nullptr>
+  std::string operator()(scalar const& s, rmm::cuda_stream_view stream) const
+  {
+    auto const& typed_scalar = static_cast<cudf::numeric_scalar<T> const&>(s);
+    std::ostringstream source;
+    source.precision(std::numeric_limits<double>::max_digits10);
+    if constexpr (std::is_same_v<T, bool>) {
+      source << (typed_scalar.value(stream) ? "true" : "false");
+    } else {
+      // The unary plus promotes int8_t/uint8_t so they print as numbers rather
+      // than characters.
+      source << +typed_scalar.value(stream);
+    }
+    return source.str();
+  }
+
+  template <typename T, std::enable_if_t<!cudf::is_numeric<T>()>* = nullptr>
+  std::string operator()(scalar const&, rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("The JIT expression compiler only supports numeric literals.");
+  }
+};
+
+std::string binary_operator_source(ast::ast_operator op)
+{
+  switch (op) {
+    case ast::ast_operator::ADD: return "+";
+    case ast::ast_operator::SUB: return "-";
+    case ast::ast_operator::MUL: return "*";
+    case ast::ast_operator::DIV: return "/";
+    case ast::ast_operator::MOD: return "%";
+    case ast::ast_operator::EQUAL: return "==";
+    case ast::ast_operator::NOT_EQUAL: return "!=";
+    case ast::ast_operator::LESS: return "<";
+    case ast::ast_operator::GREATER: return ">";
+    case ast::ast_operator::LESS_EQUAL: return "<=";
+    case ast::ast_operator::GREATER_EQUAL: return ">=";
+    case ast::ast_operator::BITWISE_AND: return "&";
+    case ast::ast_operator::BITWISE_OR: return "|";
+    case ast::ast_operator::BITWISE_XOR: return "^";
+    case ast::ast_operator::LOGICAL_AND: return "&&";
+    case ast::ast_operator::LOGICAL_OR: return "||";
+    default: CUDF_FAIL("Binary operator is not supported by the JIT expression compiler.");
+  }
+}
+
+std::string unary_function_source(ast::ast_operator op)
+{
+  switch (op) {
+    case ast::ast_operator::SIN: return "sin";
+    case ast::ast_operator::COS: return "cos";
+    case ast::ast_operator::TAN: return "tan";
+    case ast::ast_operator::ARCSIN: return "asin";
+    case ast::ast_operator::ARCCOS: return "acos";
+    case ast::ast_operator::ARCTAN: return "atan";
+    case ast::ast_operator::SINH: return "sinh";
+    case ast::ast_operator::COSH: return "cosh";
+    case ast::ast_operator::TANH: return "tanh";
+    case ast::ast_operator::ARCSINH: return "asinh";
+    case ast::ast_operator::ARCCOSH: return "acosh";
+    case ast::ast_operator::ARCTANH: return "atanh";
+    case ast::ast_operator::EXP: return "exp";
+    case ast::ast_operator::LOG: return "log";
+    case ast::ast_operator::SQRT: return "sqrt";
+    case ast::ast_operator::CBRT: return "cbrt";
+    case ast::ast_operator::CEIL: return "ceil";
+    case ast::ast_operator::FLOOR: return "floor";
+    case ast::ast_operator::ABS: return "abs";
+    case ast::ast_operator::RINT: return "rint";
+    default: CUDF_FAIL("Unary operator is not supported by the JIT expression compiler.");
+  }
+}
+
+/**
+ * @brief Recursively renders an expression tree as C++ source.
+ *
+ * Column references are rendered as the parameters `c0`, `c1`, ... of the
+ * generated function and literal values are inlined into the source, so the
+ * rendered source (and therefore the compiled kernel, which jitify caches by
+ * source hash) is identical across calls with the same expression shape.
+ *
+ * @return A pair of the rendered source and the type of the rendered value.
+ */
+std::pair<std::string, cudf::data_type> render_expression(ast::expression const& expr,
+                                                          table_view const& table,
+                                                          rmm::cuda_stream_view stream)
+{
+  if (auto const* column_ref = dynamic_cast<ast::column_reference const*>(&expr)) {
+    CUDF_EXPECTS(column_ref->get_table_source() == ast::table_reference::LEFT,
+                 "The JIT expression compiler only supports expressions on a single table.");
+    CUDF_EXPECTS(column_ref->get_row_shift() == 0,
+                 "The JIT expression compiler does not support shifted column references.");
+    return {"c" + std::to_string(column_ref->get_column_index()),
+            column_ref->get_data_type(table)};
+  }
+  if (auto const* lit = dynamic_cast<ast::literal const*>(&expr)) {
+    CUDF_EXPECTS(lit->is_valid(stream),
+                 "The JIT expression compiler does not support null literals.");
+    auto const type = lit->get_data_type();
+    auto const text = cudf::type_dispatcher(type, literal_to_source{}, lit->get_scalar(), stream);
+    return {"static_cast<" + cudf::jit::get_type_name(type) + ">(" + text + ")", type};
+  }
+  auto const& operation_expr = dynamic_cast<ast::operation const&>(expr);
+  auto const op              = operation_expr.get_operator();
+  auto const operands        = operation_expr.get_operands();
+
+  auto operand_sources = std::vector<std::string>{};
+  auto operand_types   = std::vector<cudf::data_type>{};
+  for (auto const& operand : operands) {
+    auto [source, type] = render_expression(operand.get(), table, stream);
+    operand_sources.push_back(std::move(source));
+    operand_types.push_back(type);
+  }
+  auto const result_type = ast::detail::ast_operator_return_type(op, operand_types);
+
+  if (ast::detail::ast_operator_arity(op) == 2) {
+    if (op == ast::ast_operator::POW) {
+      return {"pow(" + operand_sources[0] + ", " + operand_sources[1] + ")", result_type};
+    }
+    return {
+      "(" + operand_sources[0] + " " + binary_operator_source(op) + " " + operand_sources[1] + ")",
+      result_type};
+  }
+  switch (op) {
+    case ast::ast_operator::IDENTITY: return {"(" + operand_sources[0] + ")", result_type};
+    case ast::ast_operator::NOT: return {"(!" + operand_sources[0] + ")", result_type};
+    case ast::ast_operator::BIT_INVERT: return {"(~" + operand_sources[0] + ")", result_type};
+    default: return {unary_function_source(op) + "(" + operand_sources[0] + ")", result_type};
+  }
+}
+
+}  // namespace
+
+void expression_operation(mutable_column_view output,
+                          table_view const& table,
+                          std::string const& expression_body,
+                          rmm::cuda_stream_view stream)
+{
+  std::vector<std::string> template_types;
+  template_types.reserve(table.num_columns() + 1);
+  template_types.push_back(cudf::jit::get_type_name(output.type()));
+  for (auto const& col : table) {
+    template_types.push_back(cudf::jit::get_type_name(col.type()));
+  }
+
+  std::string kernel_name =
+    jitify2::reflection::Template("cudf::transformation::jit::expression_kernel")
+      .instantiate(template_types);
+
+  // Render the expression as a function taking one parameter per input column.
+  std::ostringstream cuda_source;
+  cuda_source << "__device__ inline " << cudf::jit::get_type_name(output.type())
+              << " GENERIC_EXPRESSION_OP(";
+  for (cudf::size_type i = 0; i < table.num_columns(); ++i) {
+    if (i != 0) { cuda_source << ", "; }
+    cuda_source << cudf::jit::get_type_name(table.column(i).type()) << " c" << i;
+  }
+  cuda_source << ") { return " << expression_body << "; }";
+
+  cudf::size_type size = output.size();
+  const void* out_ptr  = cudf::jit::get_data_ptr(output);
+  std::vector<const void*> data_ptrs(table.num_columns());
+  std::vector<void*> kernel_args;
+  kernel_args.reserve(table.num_columns() + 2);
+  kernel_args.push_back(&size);
+  kernel_args.push_back(&out_ptr);
+  for (cudf::size_type i = 0; i < table.num_columns(); ++i) {
+    data_ptrs[i] = cudf::jit::get_data_ptr(table.column(i));
+    kernel_args.push_back(&data_ptrs[i]);
+  }
+
+  cudf::jit::get_program_cache(*transform_jit_expression_kernel_cu_jit)
+    .get_kernel(kernel_name,
+                {},
+                {{"transform/jit/expression-udf.hpp", cuda_source.str()}},
+                {"-arch=sm_."})
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())
+    ->launch(kernel_args.data());
+}
+
+}  // namespace jit
+}  // namespace transformation
+
+namespace detail {
+std::unique_ptr<column> compute_column_jit(table_view const& table,
+                                           ast::expression const& expr,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  for (auto const& col : table) {
+    CUDF_EXPECTS(is_fixed_width(col.type()),
+                 "The JIT expression compiler only supports fixed-width columns.");
+    CUDF_EXPECTS(!col.has_nulls(),
+                 "The JIT expression compiler does not support null inputs.");
+  }
+
+  auto const [expression_body, output_type] =
+    transformation::jit::render_expression(expr, table, stream);
+
+  auto output = make_fixed_width_column(
+    output_type, table.num_rows(), mask_state::UNALLOCATED, stream, mr);
+
+  if (table.num_rows() == 0) { return output; }
+
+  transformation::jit::expression_operation(
+    output->mutable_view(), table, expression_body, stream);
+
+  return output;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> compute_column_jit(table_view const& table,
+                                           ast::expression const& expr,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_OP_RANGE(table.num_rows());
+  return detail::compute_column_jit(table, expr, stream, mr);
+}
+
+}  // namespace cudf
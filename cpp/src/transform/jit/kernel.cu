@@ -50,6 +50,24 @@ __global__ void kernel(cudf::size_type size, TypeOut* out_data, TypeIn* in_data)
   }
 }
 
+template <typename TypeOut, typename... TypeIns>
+__global__ void generic_transform_kernel(cudf::size_type size,
+                                         TypeOut* out_data,
+                                         TypeIns const*... in_data)
+{
+  int tid    = threadIdx.x;
+  int blkid  = blockIdx.x;
+  int blksz  = blockDim.x;
+  int gridsz = gridDim.x;
+
+  int start = tid + blkid * blksz;
+  int step  = blksz * gridsz;
+
+  for (cudf::size_type i = start; i < size; i += step) {
+    GENERIC_TRANSFORM_OP(&out_data[i], in_data[i]...);
+  }
+}
+
 }  // namespace jit
 }  // namespace transformation
 }  // namespace cudf
@@ -18,12 +18,16 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
 
+#include <thrust/iterator/discard_iterator.h>
 #include <thrust/optional.h>
+#include <thrust/reduce.h>
+#include <thrust/tabulate.h>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
@@ -457,40 +461,41 @@ __global__ void compute_row_sizes(device_span<column_device_view const> cols,
   }
 }
 
-}  // anonymous namespace
-
 /**
- * @copydoc cudf::detail::row_bit_count
+ * @brief Flattened layout metadata for a table, memoized so that a single
+ * traversal of the column hierarchy can feed multiple size computations.
  *
+ * Building this descriptor is the host-side cost of `row_bit_count`; both the
+ * per-row and the segmented entry points construct it exactly once per call.
  */
-std::unique_ptr<column> row_bit_count(table_view const& t,
-                                      rmm::cuda_stream_view stream,
-                                      rmm::mr::device_memory_resource* mr)
-{
-  // no rows
-  if (t.num_rows() <= 0) { return cudf::make_empty_column(data_type{type_id::INT32}); }
-
-  // flatten the hierarchy and determine some information about it.
+struct flattened_hierarchy {
   std::vector<cudf::column_view> cols;
   std::vector<column_info> info;
   hierarchy_info h_info;
-  flatten_hierarchy(t.begin(), t.end(), cols, info, h_info, stream);
-  CUDF_EXPECTS(info.size() == cols.size(), "Size/info mismatch");
+};
 
-  // create output buffer and view
-  auto output = cudf::make_fixed_width_column(
-    data_type{type_id::INT32}, t.num_rows(), mask_state::UNALLOCATED, stream, mr);
-  mutable_column_view mcv = output->mutable_view();
+/**
+ * @brief Flatten the column hierarchy of `t` and compute its layout metadata.
+ */
+flattened_hierarchy flatten_table(table_view const& t, rmm::cuda_stream_view stream)
+{
+  flattened_hierarchy flattened;
+  flatten_hierarchy(t.begin(), t.end(), flattened.cols, flattened.info, flattened.h_info, stream);
+  CUDF_EXPECTS(flattened.info.size() == flattened.cols.size(), "Size/info mismatch");
+  return flattened;
+}
 
-  // simple case.  if we have no complex types (lists, strings, etc), the per-row size is already
-  // trivially computed
-  if (h_info.complex_type_count <= 0) {
-    thrust::fill(rmm::exec_policy(stream),
-                 mcv.begin<size_type>(),
-                 mcv.end<size_type>(),
-                 h_info.simple_per_row_size);
-    return output;
-  }
+/**
+ * @brief Compute per-row sizes in bits for a flattened column hierarchy,
+ * writing one value per row into `output`.
+ */
+void compute_per_row_sizes(flattened_hierarchy const& flattened,
+                           device_span<size_type> output,
+                           rmm::cuda_stream_view stream)
+{
+  auto const& cols   = flattened.cols;
+  auto const& info   = flattened.info;
+  auto const& h_info = flattened.h_info;
 
   // create a contiguous block of column_device_views
   auto d_cols = contiguous_copy_column_device_views<column_device_view>(cols, stream);
@@ -521,12 +526,103 @@ std::unique_ptr<column> row_bit_count(table_view const& t,
   // should we be aborting if we reach some extremely small block size, or just if we hit 0?
   CUDF_EXPECTS(block_size > 0, "Encountered a column hierarchy too complex for row_bit_count");
 
-  cudf::detail::grid_1d grid{t.num_rows(), block_size, 1};
+  cudf::detail::grid_1d grid{static_cast<size_type>(output.size()), block_size, 1};
   compute_row_sizes<<<grid.num_blocks, block_size, shared_mem_size, stream.value()>>>(
-    {std::get<1>(d_cols), cols.size()},
-    {d_info.data(), info.size()},
-    {mcv.data<size_type>(), static_cast<std::size_t>(t.num_rows())},
+    {std::get<1>(d_cols), cols.size()}, {d_info.data(), info.size()}, output,
     h_info.max_branch_depth);
+}
+
+}  // anonymous namespace
+
+/**
+ * @copydoc cudf::detail::row_bit_count
+ *
+ */
+std::unique_ptr<column> row_bit_count(table_view const& t,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  // no rows
+  if (t.num_rows() <= 0) { return cudf::make_empty_column(data_type{type_id::INT32}); }
+
+  // flatten the hierarchy and determine some information about it.
+  auto const flattened = flatten_table(t, stream);
+
+  // create output buffer and view
+  auto output = cudf::make_fixed_width_column(
+    data_type{type_id::INT32}, t.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  mutable_column_view mcv = output->mutable_view();
+
+  // simple case.  if we have no complex types (lists, strings, etc), the per-row size is already
+  // trivially computed
+  if (flattened.h_info.complex_type_count <= 0) {
+    thrust::fill(rmm::exec_policy(stream),
+                 mcv.begin<size_type>(),
+                 mcv.end<size_type>(),
+                 flattened.h_info.simple_per_row_size);
+    return output;
+  }
+
+  compute_per_row_sizes(
+    flattened, {mcv.data<size_type>(), static_cast<std::size_t>(t.num_rows())}, stream);
+
+  return output;
+}
+
+/**
+ * @copydoc cudf::detail::segmented_row_bit_count
+ *
+ */
+std::unique_ptr<column> segmented_row_bit_count(table_view const& t,
+                                                size_type segment_length,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(segment_length > 0, "Segment length must be positive");
+
+  // no rows
+  if (t.num_rows() <= 0) { return cudf::make_empty_column(data_type{type_id::INT32}); }
+
+  auto const num_rows = t.num_rows();
+  auto const num_segments =
+    cudf::util::div_rounding_up_safe(num_rows, segment_length);
+
+  // flatten the hierarchy once; the layout metadata is shared with the per-row pass.
+  auto const flattened = flatten_table(t, stream);
+
+  auto output = cudf::make_fixed_width_column(
+    data_type{type_id::INT32}, num_segments, mask_state::UNALLOCATED, stream, mr);
+  mutable_column_view mcv = output->mutable_view();
+
+  // simple case. every row has the same size, so each segment's size is just its row count
+  // times the constant per-row size, with no per-row pass at all.
+  if (flattened.h_info.complex_type_count <= 0) {
+    thrust::tabulate(rmm::exec_policy(stream),
+                     mcv.begin<size_type>(),
+                     mcv.end<size_type>(),
+                     [num_rows,
+                      segment_length,
+                      per_row_size = flattened.h_info.simple_per_row_size] __device__(size_type i) {
+                       auto const segment_rows =
+                         min(segment_length, num_rows - (i * segment_length));
+                       return segment_rows * per_row_size;
+                     });
+    return output;
+  }
+
+  // compute per-row sizes into a temporary buffer and reduce each segment on the device,
+  // so callers sizing partitions never see (or copy back) the per-row output.
+  rmm::device_uvector<size_type> row_sizes(num_rows, stream);
+  compute_per_row_sizes(flattened, row_sizes, stream);
+
+  auto keys = cudf::detail::make_counting_transform_iterator(
+    0, [segment_length] __device__(size_type i) { return i / segment_length; });
+  thrust::reduce_by_key(rmm::exec_policy(stream),
+                        keys,
+                        keys + num_rows,
+                        row_sizes.begin(),
+                        thrust::make_discard_iterator(),
+                        mcv.begin<size_type>());
 
   return output;
 }
@@ -542,4 +638,15 @@ std::unique_ptr<column> row_bit_count(table_view const& t, rmm::mr::device_memor
   return detail::row_bit_count(t, rmm::cuda_stream_default, mr);
 }
 
+/**
+ * @copydoc cudf::segmented_row_bit_count
+ *
+ */
+std::unique_ptr<column> segmented_row_bit_count(table_view const& t,
+                                                size_type segment_length,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  return detail::segmented_row_bit_count(t, segment_length, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
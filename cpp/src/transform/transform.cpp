@@ -16,6 +16,8 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/instrumentation.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/null_mask.hpp>
@@ -65,6 +67,57 @@ void unary_operation(mutable_column_view output,
              cudf::jit::get_data_ptr(input));
 }
 
+void transform_operation(mutable_column_view output,
+                         table_view const& inputs,
+                         const std::string& udf,
+                         data_type output_type,
+                         bool is_ptx,
+                         rmm::cuda_stream_view stream)
+{
+  std::vector<std::string> template_types;
+  template_types.reserve(inputs.num_columns() + 1);
+  template_types.push_back(cudf::jit::get_type_name(output.type()));
+  std::transform(inputs.begin(),
+                 inputs.end(),
+                 std::back_inserter(template_types),
+                 [](column_view const& col) { return cudf::jit::get_type_name(col.type()); });
+
+  std::string kernel_name =
+    jitify2::reflection::Template("cudf::transformation::jit::generic_transform_kernel")
+      .instantiate(template_types);
+
+  std::string cuda_source =
+    is_ptx ? cudf::jit::parse_single_function_ptx(udf,  //
+                                                  "GENERIC_TRANSFORM_OP",
+                                                  cudf::jit::get_type_name(output_type),
+                                                  {0})
+           : cudf::jit::parse_single_function_cuda(udf,  //
+                                                   "GENERIC_TRANSFORM_OP");
+
+  cudf::size_type size = output.size();
+  const void* out_ptr  = cudf::jit::get_data_ptr(output);
+
+  std::vector<const void*> data_ptrs(inputs.num_columns());
+  std::transform(inputs.begin(), inputs.end(), data_ptrs.begin(), [](column_view const& col) {
+    return cudf::jit::get_data_ptr(col);
+  });
+
+  std::vector<void*> kernel_args;
+  kernel_args.reserve(inputs.num_columns() + 2);
+  kernel_args.push_back(&size);
+  kernel_args.push_back(&out_ptr);
+  std::transform(data_ptrs.begin(),
+                 data_ptrs.end(),
+                 std::back_inserter(kernel_args),
+                 [](const void*& ptr) -> void* { return &ptr; });
+
+  cudf::jit::get_program_cache(*transform_jit_kernel_cu_jit)
+    .get_kernel(
+      kernel_name, {}, {{"transform/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})  //
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())                                   //
+    ->launch(kernel_args.data());
+}
+
 std::vector<std::string> make_template_types(column_view outcol_view, table_view const& data_view)
 {
   std::string mskptr_type =
@@ -165,6 +218,32 @@ std::unique_ptr<column> transform(column_view const& input,
   return output;
 }
 
+std::unique_ptr<column> transform(table_view const& inputs,
+                                  std::string const& udf,
+                                  data_type output_type,
+                                  bool is_ptx,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(inputs.num_columns() > 0, "Transform requires at least one input column");
+  std::for_each(inputs.begin(), inputs.end(), [](column_view const& col) {
+    CUDF_EXPECTS(is_fixed_width(col.type()), "Unexpected non-fixed-width type.");
+  });
+
+  auto [new_mask, null_count] = cudf::detail::bitmask_and(inputs, stream, mr);
+
+  std::unique_ptr<column> output = make_fixed_width_column(
+    output_type, inputs.num_rows(), std::move(new_mask), null_count, stream, mr);
+
+  if (inputs.num_rows() == 0) { return output; }
+
+  mutable_column_view output_view = *output;
+
+  transformation::jit::transform_operation(output_view, inputs, udf, output_type, is_ptx, stream);
+
+  return output;
+}
+
 std::unique_ptr<column> generalized_masked_op(table_view const& data_view,
                                               std::string const& udf,
                                               data_type output_type,
@@ -189,10 +268,22 @@ std::unique_ptr<column> transform(column_view const& input,
                                   std::string const& unary_udf,
                                   data_type output_type,
                                   bool is_ptx,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_OP_RANGE(input.size());
+  return detail::transform(input, unary_udf, output_type, is_ptx, stream, mr);
+}
+
+std::unique_ptr<column> transform(table_view const& inputs,
+                                  std::string const& udf,
+                                  data_type output_type,
+                                  bool is_ptx,
+                                  rmm::cuda_stream_view stream,
                                   rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
-  return detail::transform(input, unary_udf, output_type, is_ptx, rmm::cuda_stream_default, mr);
+  CUDF_OP_RANGE(inputs.num_rows());
+  return detail::transform(inputs, udf, output_type, is_ptx, stream, mr);
 }
 
 std::unique_ptr<column> generalized_masked_op(table_view const& data_view,
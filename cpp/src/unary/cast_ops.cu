@@ -15,13 +15,11 @@
  */
 
 #include <cudf/column/column.hpp>
-#include <cudf/detail/binaryop.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/unary.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/null_mask.hpp>
-#include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/unary.hpp>
 #include <cudf/utilities/traits.hpp>
 
@@ -156,6 +154,26 @@ struct device_cast {
   __device__ To operator()(From element) { return static_cast<To>(element); }
 };
 
+/**
+ * @brief Converts a `fixed_point` representation to another representation and scale in one step.
+ *
+ * The representation is converted first and the scale adjustment is applied in the target
+ * representation, so widening conversions gain precision before the shift and narrowing
+ * conversions match a plain representation cast followed by a rescale. Scale increases
+ * truncate toward zero.
+ */
+template <typename FromDeviceT, typename ToDeviceT>
+struct fixed_point_rescale_cast {
+  ToDeviceT factor;  ///< power-of-ten magnitude of the scale change
+  bool divide;       ///< true when the target scale is larger (coarser) than the source scale
+
+  __device__ ToDeviceT operator()(FromDeviceT element)
+  {
+    auto const rep = static_cast<ToDeviceT>(element);
+    return divide ? rep / factor : rep * factor;
+  }
+};
+
 /**
  * @brief Takes a `fixed_point` column_view as @p input and returns a `fixed_point` column with new
  * @p scale
@@ -174,18 +192,30 @@ std::unique_ptr<column> rescale(column_view input,
                                 rmm::cuda_stream_view stream,
                                 rmm::mr::device_memory_resource* mr)
 {
-  using namespace numeric;
-
-  if (input.type().scale() > scale) {
-    auto const scalar = make_fixed_point_scalar<T>(0, scale_type{scale});
-    auto const type   = cudf::data_type{cudf::type_to_id<T>(), scale};
-    return detail::binary_operation(input, *scalar, binary_operator::ADD, type, stream, mr);
-  } else {
-    auto const diff   = input.type().scale() - scale;
-    auto const scalar = make_fixed_point_scalar<T>(std::pow(10, -diff), scale_type{diff});
-    auto const type   = cudf::data_type{cudf::type_to_id<T>(), scale};
-    return detail::binary_operation(input, *scalar, binary_operator::DIV, type, stream, mr);
-  }
+  using DeviceT = device_storage_type_t<T>;
+
+  auto const type = cudf::data_type{cudf::type_to_id<T>(), scale};
+  auto const size = input.size();
+  auto output =
+    std::make_unique<column>(type,
+                             size,
+                             rmm::device_buffer{size * cudf::size_of(type), stream, mr},
+                             detail::copy_bitmask(input, stream, mr),
+                             input.null_count());
+
+  mutable_column_view output_mutable = *output;
+
+  auto const diff = static_cast<int32_t>(scale) - input.type().scale();
+  auto const factor =
+    numeric::detail::ipow<DeviceT, numeric::Radix::BASE_10>(diff < 0 ? -diff : diff);
+
+  thrust::transform(rmm::exec_policy(stream),
+                    input.begin<DeviceT>(),
+                    input.end<DeviceT>(),
+                    output_mutable.begin<DeviceT>(),
+                    fixed_point_rescale_cast<DeviceT, DeviceT>{factor, diff > 0});
+
+  return output;
 };
 
 template <typename _SourceT>
@@ -304,29 +334,32 @@ struct dispatch_unary_cast_to {
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
   {
-    using namespace numeric;
+    using SourceDeviceT = device_storage_type_t<SourceT>;
+    using TargetDeviceT = device_storage_type_t<TargetT>;
 
     auto const size = input.size();
-    auto temporary =
-      std::make_unique<column>(cudf::data_type{type.id(), input.type().scale()},
+    auto output =
+      std::make_unique<column>(type,
                                size,
-                               rmm::device_buffer{size * cudf::size_of(type), stream},
-                               copy_bitmask(input, stream),
+                               rmm::device_buffer{size * cudf::size_of(type), stream, mr},
+                               copy_bitmask(input, stream, mr),
                                input.null_count());
 
-    using SourceDeviceT = device_storage_type_t<SourceT>;
-    using TargetDeviceT = device_storage_type_t<TargetT>;
+    mutable_column_view output_mutable = *output;
 
-    mutable_column_view output_mutable = *temporary;
+    // convert the representation and adjust the scale in a single pass rather than
+    // materializing an intermediate column at the source scale
+    auto const diff = type.scale() - input.type().scale();
+    auto const factor =
+      numeric::detail::ipow<TargetDeviceT, numeric::Radix::BASE_10>(diff < 0 ? -diff : diff);
 
     thrust::transform(rmm::exec_policy(stream),
                       input.begin<SourceDeviceT>(),
                       input.end<SourceDeviceT>(),
                       output_mutable.begin<TargetDeviceT>(),
-                      device_cast<SourceDeviceT, TargetDeviceT>{});
+                      fixed_point_rescale_cast<SourceDeviceT, TargetDeviceT>{factor, diff > 0});
 
-    // clearly there is a more efficient way to do this, can optimize in the future
-    return rescale<TargetT>(*temporary, numeric::scale_type{type.scale()}, stream, mr);
+    return output;
   }
 
   template <typename TargetT,
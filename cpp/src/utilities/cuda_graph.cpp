@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/cuda_graph.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <utility>
+
+namespace cudf {
+
+cuda_graph cuda_graph::capture(std::function<void(rmm::cuda_stream_view)> const& work,
+                               rmm::cuda_stream_view stream)
+{
+  cuda_graph graph;
+  CUDA_TRY(cudaStreamBeginCapture(stream.value(), cudaStreamCaptureModeThreadLocal));
+  work(stream);
+  CUDA_TRY(cudaStreamEndCapture(stream.value(), &graph._graph));
+  CUDA_TRY(cudaGraphInstantiate(&graph._exec, graph._graph, nullptr, nullptr, 0));
+  return graph;
+}
+
+void cuda_graph::launch(rmm::cuda_stream_view stream) const
+{
+  CUDF_EXPECTS(_exec != nullptr, "Cannot launch a moved-from graph");
+  CUDA_TRY(cudaGraphLaunch(_exec, stream.value()));
+}
+
+cuda_graph::~cuda_graph()
+{
+  // Destructors must not throw; failure to destroy leaks the graph only
+  if (_exec != nullptr) { cudaGraphExecDestroy(_exec); }
+  if (_graph != nullptr) { cudaGraphDestroy(_graph); }
+}
+
+cuda_graph::cuda_graph(cuda_graph&& other) noexcept
+  : _graph{std::exchange(other._graph, nullptr)}, _exec{std::exchange(other._exec, nullptr)}
+{
+}
+
+cuda_graph& cuda_graph::operator=(cuda_graph&& other) noexcept
+{
+  if (this != &other) {
+    if (_exec != nullptr) { cudaGraphExecDestroy(_exec); }
+    if (_graph != nullptr) { cudaGraphDestroy(_graph); }
+    _graph = std::exchange(other._graph, nullptr);
+    _exec  = std::exchange(other._exec, nullptr);
+  }
+  return *this;
+}
+
+bool is_stream_capturing(rmm::cuda_stream_view stream)
+{
+  cudaStreamCaptureStatus status{cudaStreamCaptureStatusNone};
+  CUDA_TRY(cudaStreamIsCapturing(stream.value(), &status));
+  return status != cudaStreamCaptureStatusNone;
+}
+
+}  // namespace cudf
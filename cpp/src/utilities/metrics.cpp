@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/instrumentation.hpp>
+#include <cudf/utilities/metrics.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+
+namespace cudf {
+namespace {
+
+std::mutex& callback_mutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+metrics_callback& callback()
+{
+  static metrics_callback cb;
+  return cb;
+}
+
+std::atomic<bool>& callback_registered()
+{
+  static std::atomic<bool> registered{false};
+  return registered;
+}
+
+}  // namespace
+
+void set_metrics_callback(metrics_callback cb)
+{
+  std::lock_guard<std::mutex> lock{callback_mutex()};
+  callback() = std::move(cb);
+  callback_registered().store(static_cast<bool>(callback()), std::memory_order_relaxed);
+}
+
+namespace detail {
+
+bool has_metrics_callback()
+{
+  return callback_registered().load(std::memory_order_relaxed);
+}
+
+void report_operation(operation_metrics const& metrics)
+{
+  std::lock_guard<std::mutex> lock{callback_mutex()};
+  if (callback()) { callback()(metrics); }
+}
+
+}  // namespace detail
+}  // namespace cudf
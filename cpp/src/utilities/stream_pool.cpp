@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/stream_pool.hpp>
+
+#include <cstdlib>
+#include <string>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief Number of streams the process-wide pool is created with.
+ *
+ * Controlled by the `LIBCUDF_STREAM_POOL_SIZE` environment variable; defaults
+ * to 16 streams when unset.
+ */
+std::size_t pool_size()
+{
+  auto const* env = std::getenv("LIBCUDF_STREAM_POOL_SIZE");
+  if (env == nullptr) { return 16; }
+  auto const size = std::stol(env);
+  CUDF_EXPECTS(size > 0, "LIBCUDF_STREAM_POOL_SIZE must be positive");
+  return static_cast<std::size_t>(size);
+}
+
+}  // namespace
+
+rmm::cuda_stream_pool& stream_pool()
+{
+  static rmm::cuda_stream_pool pool{pool_size()};
+  return pool;
+}
+
+rmm::cuda_stream_view get_stream_from_pool() { return stream_pool().get_stream(); }
+
+}  // namespace cudf
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/temp_memory_resource.hpp>
+
+#include <rmm/mr/device/arena_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+
+namespace cudf {
+namespace {
+
+std::atomic<rmm::mr::device_memory_resource*>& temp_mr_override()
+{
+  static std::atomic<rmm::mr::device_memory_resource*> mr{nullptr};
+  return mr;
+}
+
+/**
+ * @brief Returns the arena requested via `LIBCUDF_TEMP_ARENA_SIZE`, if any.
+ *
+ * The arena is created on first use over the then-current device resource and
+ * lives for the remainder of the process.
+ */
+rmm::mr::device_memory_resource* env_temp_arena()
+{
+  static rmm::mr::device_memory_resource* arena = []() -> rmm::mr::device_memory_resource* {
+    auto const* env = std::getenv("LIBCUDF_TEMP_ARENA_SIZE");
+    if (env == nullptr) { return nullptr; }
+    auto const size = std::stoll(env);
+    CUDF_EXPECTS(size > 0, "LIBCUDF_TEMP_ARENA_SIZE must be positive");
+    static rmm::mr::arena_memory_resource<rmm::mr::device_memory_resource> resource{
+      rmm::mr::get_current_device_resource(), static_cast<std::size_t>(size)};
+    return &resource;
+  }();
+  return arena;
+}
+
+}  // namespace
+
+rmm::mr::device_memory_resource* get_temp_memory_resource()
+{
+  auto* mr = temp_mr_override().load(std::memory_order_acquire);
+  if (mr != nullptr) { return mr; }
+  auto* arena = env_temp_arena();
+  return arena != nullptr ? arena : rmm::mr::get_current_device_resource();
+}
+
+rmm::mr::device_memory_resource* set_temp_memory_resource(rmm::mr::device_memory_resource* mr)
+{
+  return temp_mr_override().exchange(mr, std::memory_order_acq_rel);
+}
+
+}  // namespace cudf
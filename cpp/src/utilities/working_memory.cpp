@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/working_memory.hpp>
+
+#include <cmath>
+#include <numeric>
+
+namespace cudf {
+namespace {
+
+// Mirrors DEFAULT_HASH_TABLE_OCCUPANCY / compute_hash_table_size in
+// src/hash/helper_functions.cuh, which cannot be included from a host-only
+// translation unit.
+constexpr double hash_table_grow_factor = 2.0;  // 50% occupancy
+
+// One multimap entry holds a 32-bit row hash and a 32-bit row index.
+constexpr std::size_t hash_table_entry_bytes = sizeof(uint32_t) + sizeof(size_type);
+
+}  // namespace
+
+std::size_t estimate_working_memory(hash_join_memory_descriptor const& descriptor)
+{
+  auto const num_rows = static_cast<std::size_t>(descriptor.num_build_rows);
+  auto const num_entries =
+    static_cast<std::size_t>(std::ceil(num_rows * hash_table_grow_factor));
+  // The multimap plus the row hash values computed over the build table
+  return num_entries * hash_table_entry_bytes + num_rows * sizeof(uint32_t);
+}
+
+std::size_t estimate_working_memory(sort_memory_descriptor const& descriptor)
+{
+  auto const num_rows = static_cast<std::size_t>(descriptor.num_rows);
+  // Radix sort double-buffers the keys and the permutation indices
+  return 2 * num_rows * (descriptor.key_row_bytes + sizeof(size_type));
+}
+
+std::size_t fixed_width_row_bytes(table_view const& keys)
+{
+  return std::accumulate(
+    keys.begin(), keys.end(), std::size_t{0}, [](std::size_t bytes, column_view const& col) {
+      return bytes + (is_fixed_width(col.type()) ? size_of(col.type())
+                                                 : sizeof(offset_type));
+    });
+}
+
+}  // namespace cudf
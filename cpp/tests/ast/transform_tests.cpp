@@ -378,6 +378,98 @@ TEST_F(TransformTest, StringComparison)
   cudf::test::expect_columns_equal(expected, result->view(), verbosity);
 }
 
+TEST_F(TransformTest, JitBasicAdditionLiteral)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto col_ref_1     = cudf::ast::column_reference(1);
+  auto literal_value = cudf::numeric_scalar<int32_t>(2);
+  auto literal       = cudf::ast::literal(literal_value);
+
+  auto sum        = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::MUL, sum, literal);
+
+  auto expected = column_wrapper<int32_t>{26, 54, 42, 100};
+  auto result   = cudf::compute_column_jit(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, JitUnsupportedInputs)
+{
+  auto c_0        = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 1, 0, 1}};
+  auto null_table = cudf::table_view{{c_0}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::IDENTITY, col_ref_0);
+
+  EXPECT_THROW(cudf::compute_column_jit(null_table, expression), cudf::logic_error);
+
+  auto c_1          = cudf::test::strings_column_wrapper({"a", "bb", "ccc", "dddd"});
+  auto string_table = cudf::table_view{{c_1}};
+
+  EXPECT_THROW(cudf::compute_column_jit(string_table, expression), cudf::logic_error);
+}
+
+TEST_F(TransformTest, StringLiteralComparison)
+{
+  auto c_0   = cudf::test::strings_column_wrapper({"a", "bb", "ccc", "dddd"});
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto literal_value = cudf::string_scalar("bb");
+  auto literal       = cudf::ast::literal(literal_value);
+  auto expression    = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref_0, literal);
+
+  auto expected = column_wrapper<bool>{false, true, false, false};
+  auto result   = cudf::compute_column(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, StringLike)
+{
+  auto c_0   = cudf::test::strings_column_wrapper({"abc", "abbc", "xbc", "ab", "zzabcz"});
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+
+  auto prefix_value = cudf::string_scalar("ab%");
+  auto prefix       = cudf::ast::literal(prefix_value);
+  auto expression_prefix =
+    cudf::ast::operation(cudf::ast::ast_operator::LIKE, col_ref_0, prefix);
+  auto expected_prefix = column_wrapper<bool>{true, true, false, true, false};
+  auto result_prefix   = cudf::compute_column(table, expression_prefix);
+  cudf::test::expect_columns_equal(expected_prefix, result_prefix->view(), verbosity);
+
+  auto suffix_value = cudf::string_scalar("%bc");
+  auto suffix       = cudf::ast::literal(suffix_value);
+  auto expression_suffix =
+    cudf::ast::operation(cudf::ast::ast_operator::LIKE, col_ref_0, suffix);
+  auto expected_suffix = column_wrapper<bool>{true, true, true, false, false};
+  auto result_suffix   = cudf::compute_column(table, expression_suffix);
+  cudf::test::expect_columns_equal(expected_suffix, result_suffix->view(), verbosity);
+
+  auto contains_value = cudf::string_scalar("%abc%");
+  auto contains       = cudf::ast::literal(contains_value);
+  auto expression_contains =
+    cudf::ast::operation(cudf::ast::ast_operator::LIKE, col_ref_0, contains);
+  auto expected_contains = column_wrapper<bool>{true, false, false, false, true};
+  auto result_contains   = cudf::compute_column(table, expression_contains);
+  cudf::test::expect_columns_equal(expected_contains, result_contains->view(), verbosity);
+
+  auto single_value = cudf::string_scalar("a_c");
+  auto single       = cudf::ast::literal(single_value);
+  auto expression_single =
+    cudf::ast::operation(cudf::ast::ast_operator::LIKE, col_ref_0, single);
+  auto expected_single = column_wrapper<bool>{true, false, false, false, false};
+  auto result_single   = cudf::compute_column(table, expression_single);
+  cudf::test::expect_columns_equal(expected_single, result_single->view(), verbosity);
+}
+
 TEST_F(TransformTest, CopyColumn)
 {
   auto c_0   = column_wrapper<int32_t>{3, 0, 1, 50};
@@ -621,4 +713,126 @@ TEST_F(TransformTest, NullLogicalOr)
   cudf::test::expect_columns_equal(expected, result->view(), verbosity);
 }
 
+TEST_F(TransformTest, CompoundPredicateNullCount)
+{
+  auto N = 2000;
+  auto a = thrust::make_counting_iterator(0);
+
+  auto validities = std::vector<int32_t>(N);
+  std::fill(validities.begin(), validities.begin() + N / 4, 0);
+  std::fill(validities.begin() + (N / 4), validities.end(), 1);
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::shuffle(validities.begin(), validities.end(), gen);
+
+  auto c_0   = column_wrapper<int32_t>(a, a + N, validities.begin());
+  auto c_1   = column_wrapper<int32_t>(a, a + N);
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  // (c0 < c1) && (c0 > c1): a compound predicate whose validity is resolved
+  // per row inside the evaluation loop, with only the final mask emitted.
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto left      = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_0, col_ref_1);
+  auto right     = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_0, col_ref_1);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, left, right);
+
+  auto b        = cudf::detail::make_counting_transform_iterator(0, [](auto) { return false; });
+  auto expected = column_wrapper<bool>(b, b + N, validities.begin());
+  auto result   = cudf::compute_column(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), verbosity);
+  EXPECT_EQ(result->null_count(),
+            std::count(validities.begin(), validities.end(), 0));
+}
+
+TEST_F(TransformTest, ComputeColumnsSharedSubexpression)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto sum       = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+  // (a + b) * (a + b) shares the sum subexpression with the first output.
+  auto expr_0 = cudf::ast::operation(cudf::ast::ast_operator::IDENTITY, sum);
+  auto expr_1 = cudf::ast::operation(cudf::ast::ast_operator::MUL, sum, sum);
+  auto expr_2 = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_0, col_ref_1);
+
+  auto result = cudf::compute_columns(table, {expr_0, expr_1, expr_2});
+
+  auto expected_0 = column_wrapper<int32_t>{13, 27, 21, 50};
+  auto expected_1 = column_wrapper<int32_t>{169, 729, 441, 2500};
+  auto expected_2 = column_wrapper<bool>{true, false, true, false};
+
+  ASSERT_EQ(3, result->num_columns());
+  cudf::test::expect_columns_equal(expected_0, result->get_column(0).view(), verbosity);
+  cudf::test::expect_columns_equal(expected_1, result->get_column(1).view(), verbosity);
+  cudf::test::expect_columns_equal(expected_2, result->get_column(2).view(), verbosity);
+}
+
+TEST_F(TransformTest, ComputeColumnsNulls)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 0, 1, 1}};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto sum       = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+  auto expr_0    = cudf::ast::operation(cudf::ast::ast_operator::IDENTITY, sum);
+  auto expr_1    = cudf::ast::operation(cudf::ast::ast_operator::MUL, sum, sum);
+
+  auto result = cudf::compute_columns(table, {expr_0, expr_1});
+
+  auto expected_0 = column_wrapper<int32_t>{{13, 0, 21, 50}, {1, 0, 1, 1}};
+  auto expected_1 = column_wrapper<int32_t>{{169, 0, 441, 2500}, {1, 0, 1, 1}};
+
+  ASSERT_EQ(2, result->num_columns());
+  cudf::test::expect_columns_equal(expected_0, result->get_column(0).view(), verbosity);
+  cudf::test::expect_columns_equal(expected_1, result->get_column(1).view(), verbosity);
+}
+
+TEST_F(TransformTest, ComputeColumnsEmptyFailure)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto table = cudf::table_view{{c_0}};
+
+  EXPECT_THROW(cudf::compute_columns(table, {}), cudf::logic_error);
+}
+
+TEST_F(TransformTest, ShiftedColumnReference)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto table = cudf::table_view{{c_0}};
+
+  // col - shift(col, 1) computed in a single pass.
+  auto col_ref         = cudf::ast::column_reference(0);
+  auto shifted_col_ref = cudf::ast::column_reference(0, cudf::ast::table_reference::LEFT, 1);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::SUB, col_ref, shifted_col_ref);
+
+  auto expected = column_wrapper<int32_t>{{0, 17, -19, 49}, {0, 1, 1, 1}};
+  auto result   = cudf::compute_column(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, ShiftedColumnReferenceNegativeShiftNulls)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 0, 1, 1}};
+  auto table = cudf::table_view{{c_0}};
+
+  // col - shift(col, -1): nulls propagate and the last row shifts out of bounds.
+  auto col_ref         = cudf::ast::column_reference(0);
+  auto shifted_col_ref = cudf::ast::column_reference(0, cudf::ast::table_reference::LEFT, -1);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::SUB, col_ref, shifted_col_ref);
+
+  auto expected = column_wrapper<int32_t>{{0, 0, -49, 0}, {0, 0, 1, 0}};
+  auto result   = cudf::compute_column(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), verbosity);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
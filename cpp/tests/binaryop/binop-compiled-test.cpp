@@ -14,9 +14,12 @@
  * limitations under the License.
  */
 
+#include <cudf/aggregation.hpp>
 #include <cudf/binaryop.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/replace.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/types.hpp>
 #include <cudf/unary.hpp>
@@ -652,4 +655,260 @@ TEST_F(BinaryOperationCompiledTest_NullOpsString, NullMin_Vector_Vector)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, result->view());
 }
 
+struct BinaryOperationCompiledTest_Dictionary : public BinaryOperationTest {
+};
+
+TEST_F(BinaryOperationCompiledTest_Dictionary, Comparison_Vector_Scalar)
+{
+  // the operation runs over the keys and is mapped through the indices
+  auto dict = cudf::test::dictionary_column_wrapper<std::string>(
+    {"left", "right", "left", "up", "right", "left"});
+  auto s = cudf::string_scalar("left");
+
+  auto const expected =
+    fixed_width_column_wrapper<bool>{{true, false, true, false, false, true}};
+  auto const result = cudf::binary_operation(
+    dict, s, cudf::binary_operator::EQUAL, data_type{type_id::BOOL8});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(BinaryOperationCompiledTest_Dictionary, Comparison_Vector_Scalar_Nulls)
+{
+  auto dict = cudf::test::dictionary_column_wrapper<int32_t>({10, 20, 10, 30, 20, 10},
+                                                             {1, 1, 0, 1, 1, 0});
+  auto s    = cudf::numeric_scalar<int32_t>(20);
+
+  // null rows stay null regardless of the key-level result
+  auto const expected = fixed_width_column_wrapper<bool>{
+    {false, true, false, false, true, false}, {1, 1, 0, 1, 1, 0}};
+  auto const result = cudf::binary_operation(
+    dict, s, cudf::binary_operator::EQUAL, data_type{type_id::BOOL8});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(BinaryOperationCompiledTest_Dictionary, Arithmetic_Scalar_Vector)
+{
+  auto dict = cudf::test::dictionary_column_wrapper<int32_t>({5, 1, 5, 2, 1});
+  auto s    = cudf::numeric_scalar<int32_t>(100);
+
+  auto const expected = fixed_width_column_wrapper<int32_t>{{95, 99, 95, 98, 99}};
+  auto const result   = cudf::binary_operation(
+    s, dict, cudf::binary_operator::SUB, data_type{type_id::INT32});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(BinaryOperationCompiledTest_Dictionary, InvalidScalar)
+{
+  auto dict = cudf::test::dictionary_column_wrapper<int32_t>({10, 20, 10});
+  auto s    = cudf::numeric_scalar<int32_t>(20, false);
+
+  // an invalid scalar nullifies every row
+  auto const expected =
+    fixed_width_column_wrapper<int32_t>{{0, 0, 0}, {0, 0, 0}};
+  auto const result =
+    cudf::binary_operation(dict, s, cudf::binary_operator::ADD, data_type{type_id::INT32});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+struct TernaryOperationCompiledTest : public BinaryOperationTest {
+};
+
+TEST_F(TernaryOperationCompiledTest, MultiplyAdd_Vector_Vector_Vector)
+{
+  auto x = fixed_width_column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 1, 1, 0}};
+  auto y = fixed_width_column_wrapper<int32_t>{{10, 7, 20, 0}, {1, 0, 1, 1}};
+  auto z = fixed_width_column_wrapper<int32_t>{{2, 2, 2, 2}};
+
+  auto const expected = fixed_width_column_wrapper<int32_t>{{32, 0, 22, 0}, {1, 0, 1, 0}};
+  auto const result   = cudf::ternary_operation(
+    x, y, z, cudf::ternary_operator::MULTIPLY_ADD, data_type(type_to_id<int32_t>()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(TernaryOperationCompiledTest, MultiplyAdd_MatchesChainedBinops)
+{
+  auto x = lhs_random_column<double>(col_size);
+  auto y = rhs_random_column<double>(col_size);
+  auto z = lhs_random_column<double>(col_size);
+
+  auto const out_type = data_type(type_to_id<double>());
+  auto const product  = cudf::binary_operation(x, y, cudf::binary_operator::MUL, out_type);
+  auto const expected =
+    cudf::binary_operation(product->view(), z, cudf::binary_operator::ADD, out_type);
+  auto const result =
+    cudf::ternary_operation(x, y, z, cudf::ternary_operator::MULTIPLY_ADD, out_type);
+  // The fused operation has a single rounding step, so allow near-equality.
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected->view(), result->view());
+}
+
+TEST_F(TernaryOperationCompiledTest, AddMultiply_Vector_Vector_Vector)
+{
+  auto x = fixed_width_column_wrapper<int32_t>{{3, 20, 1, 50}};
+  auto y = fixed_width_column_wrapper<int32_t>{{10, 7, 20, 0}};
+  auto z = fixed_width_column_wrapper<int32_t>{{2, 3, 0, 1}};
+
+  auto const expected = fixed_width_column_wrapper<int32_t>{{26, 81, 0, 50}};
+  auto const result   = cudf::ternary_operation(
+    x, y, z, cudf::ternary_operator::ADD_MULTIPLY, data_type(type_to_id<int32_t>()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(TernaryOperationCompiledTest, ErrorCases)
+{
+  auto x     = fixed_width_column_wrapper<int32_t>{{3, 20, 1, 50}};
+  auto y     = fixed_width_column_wrapper<int32_t>{{10, 7, 20, 0}};
+  auto short_z = fixed_width_column_wrapper<int32_t>{{2, 2}};
+  EXPECT_THROW(cudf::ternary_operation(x,
+                                       y,
+                                       short_z,
+                                       cudf::ternary_operator::MULTIPLY_ADD,
+                                       data_type(type_to_id<int32_t>())),
+               cudf::logic_error);
+
+  auto strings = cudf::test::strings_column_wrapper({"a", "b", "c", "d"});
+  EXPECT_THROW(cudf::ternary_operation(x,
+                                       y,
+                                       strings,
+                                       cudf::ternary_operator::MULTIPLY_ADD,
+                                       data_type(type_to_id<int32_t>())),
+               cudf::logic_error);
+}
+
+struct BinaryOperationDeviceScalarTest : public BinaryOperationTest {
+};
+
+TEST_F(BinaryOperationDeviceScalarTest, ValidScalarMatchesHostRead)
+{
+  auto col = fixed_width_column_wrapper<int32_t>({10, 20, 30, 40}, {1, 1, 0, 1});
+  auto s   = cudf::numeric_scalar<int32_t>(2);
+
+  auto device_read = cudf::binary_operation(col,
+                                            s,
+                                            cudf::binary_operator::MUL,
+                                            data_type(type_to_id<int32_t>()),
+                                            cudf::scalar_validity::READ_ON_DEVICE);
+  auto host_read   = cudf::binary_operation(
+    col, s, cudf::binary_operator::MUL, data_type(type_to_id<int32_t>()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(device_read->view(), host_read->view());
+}
+
+TEST_F(BinaryOperationDeviceScalarTest, NullScalarNullsAllRows)
+{
+  auto col = fixed_width_column_wrapper<int32_t>({10, 20, 30, 40});
+  auto s   = cudf::numeric_scalar<int32_t>(0, false);
+
+  auto result = cudf::binary_operation(s,
+                                       col,
+                                       cudf::binary_operator::ADD,
+                                       data_type(type_to_id<int32_t>()),
+                                       cudf::scalar_validity::READ_ON_DEVICE);
+  EXPECT_EQ(result->view().null_count(), 4);
+}
+
+TEST_F(BinaryOperationDeviceScalarTest, ReductionScalarOperand)
+{
+  // normalize-by-max without reading the max on the host
+  auto col = fixed_width_column_wrapper<double>({1.0, 2.0, 4.0});
+  auto max = cudf::reduce(
+    col, cudf::make_max_aggregation(), data_type(type_to_id<double>()));
+
+  auto result = cudf::binary_operation(col,
+                                       *max,
+                                       cudf::binary_operator::DIV,
+                                       data_type(type_to_id<double>()),
+                                       cudf::scalar_validity::READ_ON_DEVICE);
+  auto expected = fixed_width_column_wrapper<double>({0.25, 0.5, 1.0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result->view(), expected);
+}
+
+struct BinaryOperationCompiledTest_NullReplacement : public BinaryOperationTest {
+};
+
+TEST_F(BinaryOperationCompiledTest_NullReplacement, Add_Vector_Vector)
+{
+  auto lhs  = fixed_width_column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 1, 1, 0}};
+  auto rhs  = fixed_width_column_wrapper<int32_t>{{10, 7, 20, 6}, {1, 0, 1, 1}};
+  auto repl = cudf::numeric_scalar<int32_t>(-1);
+
+  auto const expected = fixed_width_column_wrapper<int32_t>{{13, -1, 21, -1}};
+  auto const result   = cudf::binary_operation(
+    lhs, rhs, cudf::binary_operator::ADD, data_type(type_to_id<int32_t>()), repl);
+  EXPECT_FALSE(result->nullable());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(BinaryOperationCompiledTest_NullReplacement, Mul_Vector_Scalar)
+{
+  auto lhs  = fixed_width_column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 0, 1, 1}};
+  auto rhs  = cudf::numeric_scalar<int32_t>(2);
+  auto repl = cudf::numeric_scalar<int32_t>(0);
+
+  auto const expected = fixed_width_column_wrapper<int32_t>{{6, 0, 2, 100}};
+  auto const result   = cudf::binary_operation(
+    lhs, rhs, cudf::binary_operator::MUL, data_type(type_to_id<int32_t>()), repl);
+  EXPECT_FALSE(result->nullable());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(BinaryOperationCompiledTest_NullReplacement, Sub_InvalidScalar_Vector)
+{
+  auto lhs  = cudf::numeric_scalar<int32_t>(10, false);
+  auto rhs  = fixed_width_column_wrapper<int32_t>{{3, 20, 1, 50}};
+  auto repl = cudf::numeric_scalar<int32_t>(7);
+
+  // An invalid scalar operand makes every row null, so every row takes the replacement.
+  auto const expected = fixed_width_column_wrapper<int32_t>{{7, 7, 7, 7}};
+  auto const result   = cudf::binary_operation(
+    lhs, rhs, cudf::binary_operator::SUB, data_type(type_to_id<int32_t>()), repl);
+  EXPECT_FALSE(result->nullable());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(BinaryOperationCompiledTest_NullReplacement, MatchesReplaceNulls)
+{
+  auto lhs = lhs_random_column<double>(col_size);
+  auto rhs = rhs_random_column<double>(col_size);
+
+  auto const out_type = data_type(type_to_id<double>());
+  auto repl           = cudf::numeric_scalar<double>(0.0);
+  auto const unfused  = cudf::binary_operation(lhs, rhs, cudf::binary_operator::MUL, out_type);
+  auto const expected = cudf::replace_nulls(unfused->view(), repl);
+  auto const result =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::MUL, out_type, repl);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected->view(), result->view());
+}
+
+TEST_F(BinaryOperationCompiledTest_NullReplacement, ErrorCases)
+{
+  auto lhs = fixed_width_column_wrapper<int32_t>{{3, 20, 1, 50}};
+  auto rhs = fixed_width_column_wrapper<int32_t>{{10, 7, 20, 6}};
+
+  // replacement type must match the output type
+  auto wrong_type_repl = cudf::numeric_scalar<int64_t>(0);
+  EXPECT_THROW(cudf::binary_operation(lhs,
+                                      rhs,
+                                      cudf::binary_operator::ADD,
+                                      data_type(type_to_id<int32_t>()),
+                                      wrong_type_repl),
+               cudf::logic_error);
+
+  // replacement must be valid
+  auto invalid_repl = cudf::numeric_scalar<int32_t>(0, false);
+  EXPECT_THROW(cudf::binary_operation(lhs,
+                                      rhs,
+                                      cudf::binary_operator::ADD,
+                                      data_type(type_to_id<int32_t>()),
+                                      invalid_repl),
+               cudf::logic_error);
+
+  // only arithmetic operators are supported
+  auto repl = cudf::numeric_scalar<bool>(false);
+  EXPECT_THROW(cudf::binary_operation(lhs,
+                                      rhs,
+                                      cudf::binary_operator::LESS,
+                                      data_type(type_to_id<bool>()),
+                                      repl),
+               cudf::logic_error);
+}
+
 }  // namespace cudf::test::binop
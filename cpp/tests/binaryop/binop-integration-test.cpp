@@ -18,6 +18,7 @@
  */
 
 #include <cudf/binaryop.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
@@ -2673,6 +2674,66 @@ TYPED_TEST(FixedPointTestBothReps, FixedPointBinaryOpThrows)
                cudf::logic_error);
 }
 
+struct BinaryOperationInPlaceTest : public BinaryOperationTest {
+};
+
+TEST_F(BinaryOperationInPlaceTest, MatchesAllocatingOperation)
+{
+  auto const lhs  = fixed_width_column_wrapper<int32_t>{{1, 2, 3, 4, 5}, {1, 1, 0, 1, 1}};
+  auto const rhs  = fixed_width_column_wrapper<int32_t>{{10, 20, 30, 40, 50}, {1, 0, 1, 1, 1}};
+  auto const type = data_type{type_id::INT32};
+
+  auto const expected = cudf::binary_operation(lhs, rhs, binary_operator::ADD, type);
+
+  // a stale all-null mask from a previous batch must be overwritten
+  auto output      = make_fixed_width_column(type, 5, mask_state::ALL_NULL);
+  auto output_view = output->mutable_view();
+  cudf::binary_operation_in_place(lhs, rhs, binary_operator::ADD, output_view);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), output->view());
+}
+
+TEST_F(BinaryOperationInPlaceTest, ReusedBufferAcrossBatches)
+{
+  auto const type  = data_type{type_id::INT64};
+  auto output      = make_fixed_width_column(type, 4, mask_state::UNALLOCATED);
+  auto output_view = output->mutable_view();
+
+  auto const lhs1 = fixed_width_column_wrapper<int64_t>{{1, 2, 3, 4}};
+  auto const rhs1 = fixed_width_column_wrapper<int64_t>{{5, 6, 7, 8}};
+  cudf::binary_operation_in_place(lhs1, rhs1, binary_operator::MUL, output_view);
+  auto const expected1 = fixed_width_column_wrapper<int64_t>{{5, 12, 21, 32}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected1, output->view());
+
+  auto const lhs2 = fixed_width_column_wrapper<int64_t>{{9, 9, 9, 9}};
+  auto const rhs2 = fixed_width_column_wrapper<int64_t>{{1, 2, 3, 4}};
+  cudf::binary_operation_in_place(lhs2, rhs2, binary_operator::SUB, output_view);
+  auto const expected2 = fixed_width_column_wrapper<int64_t>{{8, 7, 6, 5}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected2, output->view());
+}
+
+TEST_F(BinaryOperationInPlaceTest, InvalidInputsThrow)
+{
+  auto const lhs       = fixed_width_column_wrapper<int32_t>{{1, 2, 3}};
+  auto const rhs_short = fixed_width_column_wrapper<int32_t>{{1, 2}};
+  auto const rhs_nulls = fixed_width_column_wrapper<int32_t>{{1, 2, 3}, {1, 0, 1}};
+
+  auto output      = make_fixed_width_column(data_type{type_id::INT32}, 3, mask_state::UNALLOCATED);
+  auto output_view = output->mutable_view();
+
+  // operand size mismatch
+  EXPECT_THROW(cudf::binary_operation_in_place(lhs, rhs_short, binary_operator::ADD, output_view),
+               cudf::logic_error);
+  // output size mismatch
+  auto small      = make_fixed_width_column(data_type{type_id::INT32}, 2, mask_state::UNALLOCATED);
+  auto small_view = small->mutable_view();
+  EXPECT_THROW(cudf::binary_operation_in_place(lhs, rhs_nulls, binary_operator::ADD, small_view),
+               cudf::logic_error);
+  // a null operand requires a nullable output
+  EXPECT_THROW(cudf::binary_operation_in_place(lhs, rhs_nulls, binary_operator::ADD, output_view),
+               cudf::logic_error);
+}
+
 }  // namespace binop
 }  // namespace test
 }  // namespace cudf
@@ -15,6 +15,7 @@
  */
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/types.hpp>
@@ -464,6 +465,53 @@ TEST_F(CopyBitmaskTest, TestNonZeroOffset)
     gold_splice_mask.data(), splice_mask.data(), cudf::num_bitmask_words(number_of_bits));
 }
 
+TEST_F(CopyBitmaskTest, TestWordAlignedOffset)
+{
+  std::vector<int> validity_bit(1000);
+  for (auto& m : validity_bit) {
+    m = this->generate();
+  }
+  auto input_mask = cudf::test::detail::make_null_mask(validity_bit.begin(), validity_bit.end());
+
+  // Word-aligned non-zero offset takes the straight-copy path
+  int begin_bit         = 64;
+  int end_bit           = 1000;
+  auto gold_splice_mask = cudf::test::detail::make_null_mask(validity_bit.begin() + begin_bit,
+                                                             validity_bit.begin() + end_bit);
+
+  auto splice_mask = cudf::copy_bitmask(
+    static_cast<const cudf::bitmask_type*>(input_mask.data()), begin_bit, end_bit);
+
+  cleanEndWord(splice_mask, begin_bit, end_bit);
+  auto number_of_bits = end_bit - begin_bit;
+  CUDF_TEST_EXPECT_EQUAL_BUFFERS(
+    gold_splice_mask.data(), splice_mask.data(), cudf::num_bitmask_words(number_of_bits));
+}
+
+TEST_F(CopyBitmaskTest, TestNonZeroOffsetManyWords)
+{
+  std::vector<int> validity_bit(8000);
+  for (auto& m : validity_bit) {
+    m = this->generate();
+  }
+  auto input_mask = cudf::test::detail::make_null_mask(validity_bit.begin(), validity_bit.end());
+
+  // Unaligned offset over enough words to exercise both the four-word
+  // vectorized chunks and the word-at-a-time tail
+  int begin_bit         = 33;
+  int end_bit           = 7897;
+  auto gold_splice_mask = cudf::test::detail::make_null_mask(validity_bit.begin() + begin_bit,
+                                                             validity_bit.begin() + end_bit);
+
+  auto splice_mask = cudf::copy_bitmask(
+    static_cast<const cudf::bitmask_type*>(input_mask.data()), begin_bit, end_bit);
+
+  cleanEndWord(splice_mask, begin_bit, end_bit);
+  auto number_of_bits = end_bit - begin_bit;
+  CUDF_TEST_EXPECT_EQUAL_BUFFERS(
+    gold_splice_mask.data(), splice_mask.data(), cudf::num_bitmask_words(number_of_bits));
+}
+
 TEST_F(CopyBitmaskTest, TestCopyColumnViewVectorContiguous)
 {
   cudf::data_type t{cudf::type_id::INT32};
@@ -585,4 +633,71 @@ TEST_F(MergeBitmaskTest, TestBitmaskOr)
   EXPECT_EQ(nullptr, result3.data());
 }
 
+TEST_F(MergeBitmaskTest, TestBitmaskMergeNullCount)
+{
+  cudf::test::fixed_width_column_wrapper<bool> const bools_col1({0, 1, 0, 1, 1}, {0, 1, 1, 1, 0});
+  cudf::test::fixed_width_column_wrapper<bool> const bools_col2({0, 2, 1, 0, 255}, {1, 1, 0, 1, 0});
+
+  auto const input = cudf::table_view({bools_col1, bools_col2});
+
+  // The null count is produced by the merge kernel itself; it must match a
+  // standalone count over the merged mask
+  auto const [mask_and, null_count_and] =
+    cudf::detail::bitmask_and(input, rmm::cuda_stream_default);
+  EXPECT_EQ(null_count_and, 3);
+  EXPECT_EQ(null_count_and,
+            cudf::count_unset_bits(
+              static_cast<cudf::bitmask_type const*>(mask_and.data()), 0, input.num_rows()));
+
+  auto const [mask_or, null_count_or] = cudf::detail::bitmask_or(input, rmm::cuda_stream_default);
+  EXPECT_EQ(null_count_or, 1);
+  EXPECT_EQ(null_count_or,
+            cudf::count_unset_bits(
+              static_cast<cudf::bitmask_type const*>(mask_or.data()), 0, input.num_rows()));
+}
+
+TEST_F(MergeBitmaskTest, TestBitmaskMergeAllValid)
+{
+  cudf::test::fixed_width_column_wrapper<bool> const bools_col1({0, 1, 0, 1, 1}, {1, 1, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<bool> const bools_col2({0, 2, 1, 0, 255}, {1, 1, 1, 1, 1});
+
+  auto const input = cudf::table_view({bools_col1, bools_col2});
+
+  // Nullable inputs whose masks hold no nulls merge to no mask at all
+  auto const [mask_and, null_count_and] =
+    cudf::detail::bitmask_and(input, rmm::cuda_stream_default);
+  EXPECT_EQ(nullptr, mask_and.data());
+  EXPECT_EQ(null_count_and, 0);
+
+  auto const [mask_or, null_count_or] = cudf::detail::bitmask_or(input, rmm::cuda_stream_default);
+  EXPECT_EQ(nullptr, mask_or.data());
+  EXPECT_EQ(null_count_or, 0);
+}
+
+struct ReclaimNullMaskTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ReclaimNullMaskTest, AllValidMaskReleased)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> wrapped({1, 2, 3, 4, 5}, {1, 1, 1, 1, 1});
+  auto col = wrapped.release();
+  EXPECT_TRUE(col->nullable());
+
+  auto const released = cudf::reclaim_null_masks(*col);
+  EXPECT_EQ(released, cudf::bitmask_allocation_size_bytes(col->size()));
+  EXPECT_FALSE(col->nullable());
+  EXPECT_EQ(col->null_count(), 0);
+}
+
+TEST_F(ReclaimNullMaskTest, MaskWithNullsKept)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> wrapped({1, 2, 3, 4, 5}, {1, 0, 1, 1, 1});
+  auto col = wrapped.release();
+
+  auto const released = cudf::reclaim_null_masks(*col);
+  EXPECT_EQ(released, std::size_t{0});
+  EXPECT_TRUE(col->nullable());
+  EXPECT_EQ(col->null_count(), 1);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -20,10 +20,14 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/pinned_vector.hpp>
+#include <cudf/utilities/span.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -456,6 +460,19 @@ TEST_F(ColumnFactoryTest, DictionaryFromStringScalar)
   EXPECT_FALSE(column->has_nulls());
 }
 
+TEST_F(ColumnFactoryTest, DictionaryFromScalarBroadcast)
+{
+  cudf::string_scalar value("hello");
+  auto column = cudf::make_dictionary_from_scalar(value, 100);
+  EXPECT_EQ(100, column->size());
+  auto const view = cudf::dictionary_column_view(column->view());
+  EXPECT_EQ(view.indices().type(), cudf::data_type{cudf::type_id::UINT8});
+  EXPECT_EQ(1, view.keys_size());
+  auto const decoded  = cudf::dictionary::decode(view);
+  auto const expected = cudf::make_column_from_scalar(value, 100);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(decoded->view(), expected->view());
+}
+
 TEST_F(ColumnFactoryTest, DictionaryFromStringScalarError)
 {
   cudf::string_scalar value("hello", false);
@@ -786,3 +803,39 @@ void struct_from_scalar(bool is_valid)
 TEST_F(ColumnFactoryTest, FromStructScalar) { struct_from_scalar(true); }
 
 TEST_F(ColumnFactoryTest, FromStructScalarNull) { struct_from_scalar(false); }
+
+TEST_F(ColumnFactoryTest, FromPinnedHostSpan)
+{
+  cudf::pinned_vector<int32_t> host_data{1, 2, 3, 4, 5};
+  auto const column =
+    cudf::make_fixed_width_column(cudf::host_span<int32_t const>{host_data.data(), host_data.size()});
+  rmm::cuda_stream_default.synchronize();
+
+  auto const expected = cudf::test::fixed_width_column_wrapper<int32_t>{{1, 2, 3, 4, 5}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, column->view());
+  EXPECT_EQ(column->null_count(), 0);
+}
+
+TEST_F(ColumnFactoryTest, FromHostSpanBytes)
+{
+  std::vector<int64_t> host_data{10, 20, 30};
+  auto const column = cudf::make_fixed_width_column(
+    cudf::data_type{cudf::type_id::INT64},
+    cudf::host_span<uint8_t const>{reinterpret_cast<uint8_t const*>(host_data.data()),
+                                   host_data.size() * sizeof(int64_t)});
+  rmm::cuda_stream_default.synchronize();
+
+  auto const expected = cudf::test::fixed_width_column_wrapper<int64_t>{{10, 20, 30}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, column->view());
+}
+
+TEST_F(ColumnFactoryTest, FromHostSpanErrors)
+{
+  std::vector<uint8_t> bytes(7);  // not a multiple of sizeof(int32_t)
+  EXPECT_THROW(cudf::make_fixed_width_column(cudf::data_type{cudf::type_id::INT32},
+                                             cudf::host_span<uint8_t const>{bytes.data(), bytes.size()}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::make_fixed_width_column(cudf::data_type{cudf::type_id::STRING},
+                                             cudf::host_span<uint8_t const>{bytes.data(), 4}),
+               cudf::logic_error);
+}
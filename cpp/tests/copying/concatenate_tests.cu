@@ -21,6 +21,7 @@
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/encode.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
+#include <cudf/strings/concatenate.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -156,6 +157,27 @@ TEST_F(StringColumnTest, ConcatenateColumnView)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringColumnTest, ConcatenateManySmallColumnsWithNulls)
+{
+  std::vector<const char*> h_strings{"aaa", "bb", "", "cccc", "d"};
+  auto valids = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return (i % 5) % 3 != 0 ? true : false; });
+
+  std::vector<const char*> expected_strings;
+  std::vector<cudf::test::strings_column_wrapper> wrappers;
+  std::vector<cudf::column_view> strings_columns;
+  for (int i = 0; i < 300; ++i) {
+    wrappers.emplace_back(h_strings.data(), h_strings.data() + h_strings.size(), valids);
+    strings_columns.push_back(wrappers[i]);
+    expected_strings.insert(expected_strings.end(), h_strings.begin(), h_strings.end());
+  }
+  cudf::test::strings_column_wrapper expected(
+    expected_strings.data(), expected_strings.data() + expected_strings.size(), valids);
+
+  auto results = cudf::concatenate(strings_columns);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
 TEST_F(StringColumnTest, ConcatenateTooManyColumns)
 {
   std::vector<const char*> h_strings{"aaa",
@@ -192,6 +214,34 @@ TEST_F(StringColumnTest, ConcatenateTooManyColumns)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringColumnTest, ConcatenateIntoBatches)
+{
+  std::vector<const char*> h_strings{"aaa", "bb", "", "cccc", "d", "ééé", "ff", "gggg"};
+  cudf::test::strings_column_wrapper strings1(h_strings.data(), h_strings.data() + 3);
+  cudf::test::strings_column_wrapper strings2(h_strings.data() + 3, h_strings.data() + 6);
+  cudf::test::strings_column_wrapper strings3(h_strings.data() + 6,
+                                              h_strings.data() + h_strings.size());
+
+  std::vector<cudf::column_view> strings_columns;
+  strings_columns.push_back(strings1);
+  strings_columns.push_back(strings2);
+  strings_columns.push_back(strings3);
+
+  // everything fits in one column so this matches concatenate
+  auto results = cudf::strings::concatenate_into_batches(strings_columns);
+  EXPECT_EQ(results.size(), std::size_t{1});
+  cudf::test::strings_column_wrapper expected(h_strings.begin(), h_strings.end());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results.front(), expected);
+
+  auto empty_results = cudf::strings::concatenate_into_batches({});
+  EXPECT_EQ(empty_results.size(), std::size_t{1});
+  EXPECT_EQ(empty_results.front()->size(), 0);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({1, 2, 3});
+  EXPECT_THROW(cudf::strings::concatenate_into_batches(std::vector<cudf::column_view>{ints}),
+               cudf::logic_error);
+}
+
 struct TableTest : public cudf::test::BaseFixture {
 };
 
@@ -521,3 +521,42 @@ TYPED_TEST(FixedPointTypesCopyRange, FixedPointScaleMismatch)
 
   EXPECT_THROW(cudf::copy_range(source, target, 1, 4, 1), cudf::logic_error);
 }
+
+struct CopyRangeNullCountTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(CopyRangeNullCountTest, UnknownNullCountInPlace)
+{
+  // an unknown target null count must not be materialized (a full-column
+  // bitmask scan) just to track the range's delta; it stays unknown and is
+  // computed only when asked for
+  cudf::test::fixed_width_column_wrapper<int32_t> target_wrapper(
+    thrust::make_counting_iterator(0),
+    thrust::make_counting_iterator(1000),
+    cudf::detail::make_counting_transform_iterator(0, even_valid));
+  cudf::column target_column(target_wrapper);
+  auto view = target_column.mutable_view();
+  cudf::mutable_column_view target(view.type(),
+                                   view.size(),
+                                   view.head(),
+                                   view.null_mask(),
+                                   cudf::UNKNOWN_NULL_COUNT);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> source(
+    thrust::make_counting_iterator(0),
+    thrust::make_counting_iterator(10),
+    cudf::detail::make_counting_transform_iterator(0, all_valid));
+  cudf::copy_range_in_place(source, target, 0, 10, 100);
+
+  auto expected_values = cudf::detail::make_counting_transform_iterator(
+    0, [](cudf::size_type row) { return (row >= 100 && row < 110) ? row - 100 : row; });
+  cudf::test::fixed_width_column_wrapper<int32_t> expected(
+    expected_values,
+    expected_values + 1000,
+    cudf::detail::make_counting_transform_iterator(0, [](cudf::size_type row) {
+      return (row >= 100 && row < 110) || (row % 2 == 0);
+    }));
+  auto expected_view = cudf::column_view(expected);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(target, expected_view);
+  EXPECT_EQ(target.null_count(), expected_view.null_count());
+}
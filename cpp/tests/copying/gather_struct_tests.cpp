@@ -177,6 +177,42 @@ TYPED_TEST(TypedStructGatherTest, TestSimpleStructGather)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(output->view(), expected_output);
 }
 
+TEST_F(StructGatherTest, TestManyFixedWidthLeaves)
+{
+  // A wide struct exercises the fused leaf gather, which processes all
+  // fixed-width members in a single kernel.
+  auto constexpr num_leaves = 40;
+  auto constexpr num_rows   = 100;
+
+  std::vector<std::unique_ptr<cudf::column>> members;
+  for (auto leaf = 0; leaf < num_leaves; ++leaf) {
+    auto iter = cudf::detail::make_counting_transform_iterator(
+      0, [leaf](auto row) { return leaf * num_rows + row; });
+    members.push_back(numerics<int32_t>{iter, iter + num_rows, null_at(leaf)}.release());
+  }
+  auto const struct_column = cudf::make_structs_column(
+    num_rows, std::move(members), 0, rmm::device_buffer{});
+
+  auto const gather_map = gather_map_t{null_index, 99, 42, 7, 0};
+  auto const output     = do_gather(struct_column->view(), gather_map);
+
+  std::vector<std::unique_ptr<cudf::column>> expected_members;
+  for (auto leaf = 0; leaf < num_leaves; ++leaf) {
+    auto iter = cudf::detail::make_counting_transform_iterator(0, [leaf, &gather_map](auto i) {
+      return i == 0 ? 0 : leaf * num_rows + gather_map[i];
+    });
+    auto validity = cudf::detail::make_counting_transform_iterator(0, [leaf, &gather_map](auto i) {
+      return i != 0 and gather_map[i] != leaf;
+    });
+    expected_members.push_back(
+      numerics<int32_t>{iter, iter + gather_map.size(), validity}.release());
+  }
+  auto const expected =
+    structs{std::move(expected_members), std::vector<bool>{false, true, true, true, true}};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(output->view(), expected);
+}
+
 TYPED_TEST(TypedStructGatherTest, TestSlicedStructsColumnGatherNoNulls)
 {
   auto const structs_original = [] {
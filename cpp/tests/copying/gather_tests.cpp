@@ -244,3 +244,127 @@ TYPED_TEST(GatherTest, MultiColNulls)
     CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_column, result->view().column(i));
   }
 }
+
+TYPED_TEST(GatherTest, AllValidSourceDropsMask)
+{
+  constexpr cudf::size_type source_size{1000};
+
+  auto data     = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return true; });
+  cudf::test::fixed_width_column_wrapper<TypeParam> source_column(
+    data, data + source_size, validity);
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(data, data + source_size);
+
+  cudf::table_view source_table({source_column});
+  EXPECT_TRUE(source_table.column(0).nullable());
+
+  auto const result = cudf::gather(source_table, gather_map);
+
+  // A nullable source with no nulls gathers to a result with no null mask at all
+  EXPECT_FALSE(result->view().column(0).nullable());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(source_table.column(0), result->view().column(0));
+}
+
+struct GatherBatchedTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(GatherBatchedTest, MatchesSingleTableGather)
+{
+  // mixed fixed-width tables take the fused path; the strings table and the
+  // nullable table fall back to the per-table gather
+  cudf::test::fixed_width_column_wrapper<int32_t> col1a({10, 20, 30, 40, 50});
+  cudf::test::fixed_width_column_wrapper<double> col1b({1.5, 2.5, 3.5, 4.5, 5.5});
+  cudf::test::fixed_width_column_wrapper<int8_t> col2a({1, 2, 3, 4});
+  cudf::test::strings_column_wrapper col3a({"aa", "bb", "cc"});
+  cudf::test::fixed_width_column_wrapper<int32_t> col4a({7, 8, 9}, {1, 0, 1});
+
+  std::vector<cudf::table_view> tables{cudf::table_view{{col1a, col1b}},
+                                       cudf::table_view{{col2a}},
+                                       cudf::table_view{{col3a}},
+                                       cudf::table_view{{col4a}}};
+
+  // negative indices exercise the signed-map normalization
+  cudf::test::fixed_width_column_wrapper<int32_t> map1({4, 0, -1, 2});
+  cudf::test::fixed_width_column_wrapper<uint32_t> map2({3, 3, 0});
+  cudf::test::fixed_width_column_wrapper<int32_t> map3({2, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> map4({0, 2});
+  std::vector<cudf::column_view> maps{map1, map2, map3, map4};
+
+  auto results = cudf::gather(tables, maps);
+  ASSERT_EQ(results.size(), tables.size());
+  for (std::size_t idx = 0; idx < tables.size(); ++idx) {
+    auto expected = cudf::gather(tables[idx], maps[idx]);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*results[idx], *expected);
+  }
+
+  // one map is required per table
+  EXPECT_THROW(cudf::gather(tables, std::vector<cudf::column_view>{map1}), cudf::logic_error);
+}
+
+struct GatherInPlaceTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(GatherInPlaceTest, MatchesAllocatingGather)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1({10, 20, 30, 40, 50});
+  cudf::test::fixed_width_column_wrapper<double> col2({1.5, 2.5, 3.5, 4.5, 5.5});
+  cudf::table_view source({col1, col2});
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map({4, 0, 2});
+
+  auto dest1 = cudf::test::fixed_width_column_wrapper<int32_t>({0, 0, 0}).release();
+  auto dest2 = cudf::test::fixed_width_column_wrapper<double>({0, 0, 0}).release();
+  auto dest1_view = dest1->mutable_view();
+  auto dest2_view = dest2->mutable_view();
+  cudf::mutable_table_view destination({dest1_view, dest2_view});
+
+  cudf::gather_in_place(source, gather_map, destination);
+
+  auto const expected = cudf::gather(source, gather_map);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), cudf::table_view({dest1->view(), dest2->view()}));
+}
+
+TEST_F(GatherInPlaceTest, OversizedDestinationKeepsTrailingRows)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({10, 20, 30});
+  cudf::table_view source({col});
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map({2, 1});
+
+  // only the first gather_map.size() rows are written; the rest are left untouched
+  auto dest      = cudf::test::fixed_width_column_wrapper<int32_t>({0, 0, 7, 8}).release();
+  auto dest_view = dest->mutable_view();
+  cudf::mutable_table_view destination({dest_view});
+  cudf::gather_in_place(source, gather_map, destination);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({30, 20, 7, 8});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, dest->view());
+}
+
+TEST_F(GatherInPlaceTest, InvalidInputsThrow)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({10, 20, 30});
+  cudf::test::fixed_width_column_wrapper<int32_t> col_nulls({10, 20, 30}, {1, 0, 1});
+  cudf::test::strings_column_wrapper col_str({"a", "b", "c"});
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map({0, 1, 2});
+
+  auto dest       = cudf::test::fixed_width_column_wrapper<int32_t>({0, 0, 0}).release();
+  auto dest_small = cudf::test::fixed_width_column_wrapper<int32_t>({0, 0}).release();
+  auto dest_type  = cudf::test::fixed_width_column_wrapper<int64_t>({0, 0, 0}).release();
+  auto dest_view       = dest->mutable_view();
+  auto dest_small_view = dest_small->mutable_view();
+  auto dest_type_view  = dest_type->mutable_view();
+  cudf::mutable_table_view destination({dest_view});
+  cudf::mutable_table_view destination_small({dest_small_view});
+  cudf::mutable_table_view destination_type({dest_type_view});
+
+  // destination is too small for the map
+  EXPECT_THROW(cudf::gather_in_place(cudf::table_view({col}), gather_map, destination_small),
+               cudf::logic_error);
+  // data type mismatch
+  EXPECT_THROW(cudf::gather_in_place(cudf::table_view({col}), gather_map, destination_type),
+               cudf::logic_error);
+  // source columns with nulls and variable-width columns are not supported
+  EXPECT_THROW(cudf::gather_in_place(cudf::table_view({col_nulls}), gather_map, destination),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::gather_in_place(cudf::table_view({col_str}), gather_map, destination),
+               cudf::logic_error);
+}
@@ -18,6 +18,7 @@
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/dictionary/update_keys.hpp>
 #include <cudf/scalar/scalar.hpp>
@@ -922,5 +923,53 @@ TEST_F(StructGetValueTest, multi_level_nested)
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(fields, typed_s->view());
 }
 
+struct GetElementsTest : public BaseFixture {
+};
+
+TEST_F(GetElementsTest, FixedWidthBatch)
+{
+  fixed_width_column_wrapper<int32_t> col({9, 8, 7, 6}, {0, 1, 0, 1});
+  auto const indices = cudf::detail::make_device_uvector_sync(std::vector<size_type>{3, 0, 1, 3});
+
+  auto const results = get_elements(col, indices);
+
+  ASSERT_EQ(results.size(), std::size_t{4});
+  for (size_type i = 0; i < 4; ++i) {
+    auto const indices_host = std::vector<size_type>{3, 0, 1, 3};
+    auto expected           = get_element(col, indices_host[i]);
+    EXPECT_EQ(results[i]->is_valid(), expected->is_valid());
+    if (expected->is_valid()) {
+      EXPECT_EQ(static_cast<numeric_scalar<int32_t> const*>(results[i].get())->value(),
+                static_cast<numeric_scalar<int32_t> const*>(expected.get())->value());
+    }
+  }
+}
+
+TEST_F(GetElementsTest, StringsBatch)
+{
+  strings_column_wrapper col({"this", "is", "a", "test"}, {1, 1, 0, 1});
+  auto const indices = cudf::detail::make_device_uvector_sync(std::vector<size_type>{2, 3, 0});
+
+  auto const results = get_elements(col, indices);
+
+  ASSERT_EQ(results.size(), std::size_t{3});
+  EXPECT_FALSE(results[0]->is_valid());
+  EXPECT_TRUE(results[1]->is_valid());
+  EXPECT_EQ("test", static_cast<string_scalar const*>(results[1].get())->to_string());
+  EXPECT_TRUE(results[2]->is_valid());
+  EXPECT_EQ("this", static_cast<string_scalar const*>(results[2].get())->to_string());
+}
+
+TEST_F(GetElementsTest, Errors)
+{
+  fixed_width_column_wrapper<int32_t> col({9, 8, 7, 6});
+  auto const out_of_range = cudf::detail::make_device_uvector_sync(std::vector<size_type>{1, 4});
+  CUDF_EXPECT_THROW_MESSAGE(get_elements(col, out_of_range), "Index out of bounds");
+
+  lists_column_wrapper<int32_t> lists{{1, 2}, {3}};
+  auto const indices = cudf::detail::make_device_uvector_sync(std::vector<size_type>{0});
+  EXPECT_THROW(get_elements(lists, indices), cudf::logic_error);
+}
+
 }  // namespace test
 }  // namespace cudf
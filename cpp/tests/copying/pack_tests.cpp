@@ -15,10 +15,15 @@
  */
 
 #include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/table_utilities.hpp>
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace test {
 
@@ -541,5 +546,56 @@ TEST_F(PackUnpackTest, SlicedEmpty)
 
 // clang-format on
 
+struct PackCompressTest : public BaseFixture {
+};
+
+TEST_F(PackCompressTest, RoundTrip)
+{
+  // large enough to span several compression chunks
+  constexpr cudf::size_type num_rows = 300000;
+  auto ints = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 1000; });
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(ints, ints + num_rows, valids);
+  std::vector<std::string> strings(num_rows);
+  std::generate(strings.begin(), strings.end(), [n = 0]() mutable {
+    return "string_" + std::to_string(n++ % 100);
+  });
+  cudf::test::strings_column_wrapper col2(strings.begin(), strings.end());
+  cudf::table_view t({col1, col2});
+
+  auto packed       = cudf::pack(t);
+  auto compressed   = cudf::compress_packed(packed);
+  auto decompressed = cudf::decompress_packed(compressed);
+
+  EXPECT_EQ(packed.gpu_data->size(), decompressed.gpu_data->size());
+  auto unpacked = cudf::unpack(decompressed);
+  cudf::test::expect_tables_equal(t, unpacked);
+
+  // repetitive data should actually shrink
+  EXPECT_LT(compressed.gpu_data->size(), packed.gpu_data->size());
+}
+
+TEST_F(PackCompressTest, EmptyInput)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1;
+  cudf::table_view t({col1});
+
+  auto packed       = cudf::pack(t);
+  auto compressed   = cudf::compress_packed(packed);
+  auto decompressed = cudf::decompress_packed(compressed);
+  auto unpacked     = cudf::unpack(decompressed);
+  cudf::test::expect_tables_equal(t, unpacked);
+}
+
+TEST_F(PackCompressTest, NotCompressed)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1({1, 2, 3, 4, 5});
+  cudf::table_view t({col1});
+
+  auto packed = cudf::pack(t);
+  EXPECT_THROW(cudf::decompress_packed(packed), cudf::logic_error);
+}
+
 }  // namespace test
 }  // namespace cudf
@@ -113,3 +113,30 @@ INSTANTIATE_TEST_CASE_P(
                     std::make_tuple(1024, cudf::sample_with_replacement::TRUE),
                     std::make_tuple(1024, cudf::sample_with_replacement::FALSE),
                     std::make_tuple(2048, cudf::sample_with_replacement::TRUE)));
+
+TEST_F(SampleTest, SmallFractionWithoutReplacement)
+{
+  // small n relative to the table exercises the O(n) candidate-drawing path
+  cudf::size_type const table_size = 10000;
+  cudf::size_type const n_samples  = 100;
+  auto data = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(data, data + table_size);
+
+  cudf::table_view input({col1});
+
+  auto out_table = cudf::sample(input, n_samples, cudf::sample_with_replacement::FALSE, 7);
+  EXPECT_EQ(out_table->num_rows(), n_samples);
+
+  // all sampled rows must be distinct rows of the input
+  auto sorted = cudf::sort(out_table->view());
+  auto host   = cudf::test::to_host<int32_t>(sorted->view().column(0)).first;
+  for (cudf::size_type i = 0; i < n_samples; i++) {
+    EXPECT_GE(host[i], 0);
+    EXPECT_LT(host[i], table_size);
+    if (i > 0) { EXPECT_LT(host[i - 1], host[i]); }
+  }
+
+  // same seed reproduces the same sample
+  auto repeat = cudf::sample(input, n_samples, cudf::sample_with_replacement::FALSE, 7);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(out_table->view(), repeat->view());
+}
@@ -930,3 +930,73 @@ TYPED_TEST(FixedPointTestBothReps, FixedPointScatter)
 
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected_table, result->view());
 }
+
+class ScatterBatchedTests : public cudf::test::BaseFixture {
+};
+
+TEST_F(ScatterBatchedTests, MatchesSequentialScatter)
+{
+  using cudf::test::fixed_width_column_wrapper;
+
+  fixed_width_column_wrapper<int32_t> target_ints({10, 20, 30, 40, 50, 60, 70, 80});
+  fixed_width_column_wrapper<double> target_doubles({1, 2, 3, 4, 5, 6, 7, 8});
+  cudf::table_view target({target_ints, target_doubles});
+
+  // first pair carries nulls, second uses negative indices
+  fixed_width_column_wrapper<int32_t> src1_ints({101, 102, 103}, {1, 0, 1});
+  fixed_width_column_wrapper<double> src1_doubles({11, 12, 13});
+  fixed_width_column_wrapper<int32_t> map1({0, 2, 4});
+  fixed_width_column_wrapper<int32_t> src2_ints({201, 202});
+  fixed_width_column_wrapper<double> src2_doubles({21, 22}, {0, 1});
+  fixed_width_column_wrapper<int32_t> map2({-1, 5});
+
+  std::vector<cudf::table_view> sources;
+  sources.emplace_back(std::vector<cudf::column_view>{src1_ints, src1_doubles});
+  sources.emplace_back(std::vector<cudf::column_view>{src2_ints, src2_doubles});
+  std::vector<cudf::column_view> maps{map1, map2};
+
+  auto const result = cudf::scatter(sources, maps, target);
+
+  auto expected = cudf::scatter(sources[0], maps[0], target);
+  expected      = cudf::scatter(sources[1], maps[1], expected->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+}
+
+TEST_F(ScatterBatchedTests, StringsFallback)
+{
+  using cudf::test::fixed_width_column_wrapper;
+  using cudf::test::strings_column_wrapper;
+
+  strings_column_wrapper target_strings({"a", "b", "c", "d", "e"});
+  cudf::table_view target({target_strings});
+
+  strings_column_wrapper src1({"xx", "yy"});
+  fixed_width_column_wrapper<int32_t> map1({1, 3});
+  strings_column_wrapper src2({"zz"});
+  fixed_width_column_wrapper<int32_t> map2({0});
+
+  std::vector<cudf::table_view> sources;
+  sources.emplace_back(std::vector<cudf::column_view>{src1});
+  sources.emplace_back(std::vector<cudf::column_view>{src2});
+  std::vector<cudf::column_view> maps{map1, map2};
+
+  auto const result = cudf::scatter(sources, maps, target);
+
+  strings_column_wrapper expected({"zz", "xx", "c", "yy", "e"});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expected}), result->view());
+}
+
+TEST_F(ScatterBatchedTests, PairCountMismatch)
+{
+  using cudf::test::fixed_width_column_wrapper;
+
+  fixed_width_column_wrapper<int32_t> target_col({1, 2, 3});
+  fixed_width_column_wrapper<int32_t> source_col({4});
+  fixed_width_column_wrapper<int32_t> map({0});
+
+  std::vector<cudf::table_view> sources;
+  sources.emplace_back(std::vector<cudf::column_view>{source_col});
+  std::vector<cudf::column_view> maps;
+
+  EXPECT_THROW(cudf::scatter(sources, maps, cudf::table_view({target_col})), cudf::logic_error);
+}
@@ -323,6 +323,32 @@ TEST_F(SliceCornerCases, ImproperRange)
   EXPECT_THROW(cudf::slice(col, indices), cudf::logic_error);
 }
 
+TEST_F(SliceCornerCases, LazyNullCount)
+{
+  cudf::size_type start = 0;
+  cudf::size_type size  = 10;
+  auto valids           = cudf::detail::make_counting_transform_iterator(
+    start, [](auto i) { return i % 2 == 0 ? true : false; });
+
+  cudf::test::fixed_width_column_wrapper<int8_t> col =
+    create_fixed_columns<int8_t>(start, size, valids);
+  std::vector<cudf::size_type> indices{1, 3, 5, 9};
+
+  std::vector<cudf::column_view> result = cudf::slice(col, indices);
+
+  // slicing a nullable column defers the null count until it is asked for
+  EXPECT_FALSE(result[0].null_count_known());
+  EXPECT_EQ(1, result[0].null_count());
+  EXPECT_TRUE(result[0].null_count_known());
+  EXPECT_EQ(2, result[1].null_count());
+
+  // columns without nulls produce views with a known zero count
+  cudf::test::fixed_width_column_wrapper<int8_t> no_nulls({0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+  std::vector<cudf::column_view> no_null_result = cudf::slice(no_nulls, indices);
+  EXPECT_TRUE(no_null_result[0].null_count_known());
+  EXPECT_EQ(0, no_null_result[0].null_count());
+}
+
 TEST_F(SliceCornerCases, NegativeOffset)
 {
   cudf::size_type start = 0;
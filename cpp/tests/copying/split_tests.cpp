@@ -17,6 +17,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/pinned_host_memory_resource.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <cudf_test/base_fixture.hpp>
@@ -1315,6 +1316,35 @@ TEST_F(ContiguousSplitUntypedTest, ProgressiveSizes)
   }
 }
 
+TEST_F(ContiguousSplitUntypedTest, PinnedHostOutput)
+{
+  auto iter = thrust::make_counting_iterator(0);
+  cudf::test::fixed_width_column_wrapper<int32_t> ints(iter, iter + 100);
+  std::vector<std::string> strings;
+  std::transform(iter, iter + 100, std::back_inserter(strings), [](int i) {
+    return "str_" + std::to_string(i);
+  });
+  cudf::test::strings_column_wrapper col2(strings.begin(), strings.end());
+  cudf::table_view t({ints, col2});
+  std::vector<cudf::size_type> splits{37, 80};
+
+  // pack directly into pinned host memory; the results must match a regular split
+  cudf::detail::pinned_host_memory_resource pinned_mr;
+  auto result   = cudf::contiguous_split(t, splits, &pinned_mr);
+  auto expected = cudf::split(t, splits);
+  ASSERT_EQ(expected.size(), result.size());
+  for (std::size_t idx = 0; idx < result.size(); idx++) {
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected[idx], result[idx].table);
+  }
+
+  // the packed buffer is host memory: the first partition starts with the (non-nullable)
+  // int column's data, readable in place with no copy back from the device
+  auto const* host_ints = reinterpret_cast<int32_t const*>(result[0].data.gpu_data->data());
+  for (int i = 0; i < 37; i++) {
+    EXPECT_EQ(host_ints[i], i);
+  }
+}
+
 // contiguous split with strings
 struct ContiguousSplitStringTableTest : public SplitTest<std::string> {
 };
@@ -25,6 +25,7 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/datetime.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/wrappers/timestamps.hpp>
 
@@ -146,6 +147,55 @@ TEST_F(BasicDatetimeOpsTest, TestExtractingDatetimeComponents)
                                  fixed_width_column_wrapper<int16_t>{12, 0, 12});
 }
 
+TEST_F(BasicDatetimeOpsTest, TestExtractingDatetimeComponentsFused)
+{
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+
+  auto timestamps_s =
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+      -131968728,  // 1965-10-26 14:01:12 GMT
+      1530705600,  // 2018-07-04 12:00:00 GMT
+      1674631932   // 2023-01-25 07:32:12 GMT
+    };
+
+  auto const components = std::vector<datetime_component>{datetime_component::YEAR,
+                                                          datetime_component::MONTH,
+                                                          datetime_component::DAY,
+                                                          datetime_component::WEEKDAY,
+                                                          datetime_component::HOUR,
+                                                          datetime_component::MINUTE,
+                                                          datetime_component::SECOND};
+
+  auto const extracted = extract_datetime_components(timestamps_s, components);
+
+  // Each column of the fused extraction matches the corresponding extract_* call
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(extracted->get_column(0), *extract_year(timestamps_s));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(extracted->get_column(1), *extract_month(timestamps_s));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(extracted->get_column(2), *extract_day(timestamps_s));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(extracted->get_column(3), *extract_weekday(timestamps_s));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(extracted->get_column(4), *extract_hour(timestamps_s));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(extracted->get_column(5), *extract_minute(timestamps_s));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(extracted->get_column(6), *extract_second(timestamps_s));
+
+  // Nulls propagate to every extracted component
+  auto timestamps_with_nulls =
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+      {-131968728, 1530705600, 1674631932}, {true, false, true}};
+
+  auto const extracted_nulls = extract_datetime_components(
+    timestamps_with_nulls, std::vector<datetime_component>{datetime_component::YEAR});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(extracted_nulls->get_column(0),
+                                 fixed_width_column_wrapper<int16_t>{{1965, XXX, 2023},
+                                                                     {true, false, true}});
+
+  // Empty component lists and sub-day components of the switch are rejected
+  EXPECT_THROW(extract_datetime_components(timestamps_s, {}), cudf::logic_error);
+  EXPECT_THROW(extract_datetime_components(
+                 timestamps_s, std::vector<datetime_component>{datetime_component::MILLISECOND}),
+               cudf::logic_error);
+}
+
 template <typename T>
 struct TypedDatetimeOpsTest : public cudf::test::BaseFixture {
   cudf::size_type size() { return cudf::size_type(10); }
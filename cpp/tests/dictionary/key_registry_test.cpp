@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/key_registry.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <vector>
+
+struct DictionaryKeyRegistryTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(DictionaryKeyRegistryTest, StringsColumn)
+{
+  cudf::dictionary::key_registry registry(cudf::data_type{cudf::type_id::STRING});
+
+  cudf::test::strings_column_wrapper batch1({"ccc", "aaa", "ccc", "bbb"});
+  auto d1 = registry.encode(batch1);
+  cudf::dictionary_column_view view1(d1->view());
+
+  cudf::test::strings_column_wrapper keys_expected1({"aaa", "bbb", "ccc"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view1.keys(), keys_expected1);
+  cudf::test::fixed_width_column_wrapper<uint8_t> indices_expected1({2, 0, 2, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view1.indices(), indices_expected1);
+
+  // same categories again: key-set is reused without growing
+  cudf::test::strings_column_wrapper batch2({"bbb", "bbb", "aaa"});
+  auto d2 = registry.encode(batch2);
+  cudf::dictionary_column_view view2(d2->view());
+  EXPECT_EQ(registry.size(), 3);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view2.keys(), keys_expected1);
+  cudf::test::fixed_width_column_wrapper<uint8_t> indices_expected2({1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view2.indices(), indices_expected2);
+}
+
+TEST_F(DictionaryKeyRegistryTest, GrowingKeys)
+{
+  cudf::dictionary::key_registry registry(cudf::data_type{cudf::type_id::INT32});
+
+  cudf::test::fixed_width_column_wrapper<int32_t> batch1({20, 10, 20});
+  auto d1 = registry.encode(batch1);
+
+  // new category appears: key-set grows, earlier column is unaffected
+  cudf::test::fixed_width_column_wrapper<int32_t> batch2({15, 20, 15});
+  auto d2 = registry.encode(batch2);
+  EXPECT_EQ(registry.size(), 3);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> keys_expected({10, 15, 20});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(registry.keys(), keys_expected);
+  cudf::test::fixed_width_column_wrapper<uint8_t> indices_expected2({1, 2, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::dictionary_column_view(d2->view()).indices(),
+                                 indices_expected2);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> keys_expected1({10, 20});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::dictionary_column_view(d1->view()).keys(), keys_expected1);
+
+  // bring the earlier column onto the current key-set through the cached remap
+  auto remapped = registry.remap(cudf::dictionary_column_view(d1->view()));
+  cudf::dictionary_column_view view1(remapped->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view1.keys(), keys_expected);
+  cudf::test::fixed_width_column_wrapper<uint8_t> indices_expected1({2, 0, 2});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view1.indices(), indices_expected1);
+}
+
+TEST_F(DictionaryKeyRegistryTest, RemapOlderKeySet)
+{
+  cudf::dictionary::key_registry registry(cudf::data_type{cudf::type_id::STRING});
+
+  cudf::test::strings_column_wrapper batch1({"bb", "aa"});
+  auto d1 = registry.encode(batch1);
+
+  // grow twice so d1 predates the cached remap table
+  cudf::test::strings_column_wrapper more1({"cc"});
+  registry.add_keys(more1);
+  cudf::test::strings_column_wrapper more2({"a"});
+  registry.add_keys(more2);
+  EXPECT_EQ(registry.size(), 4);
+
+  auto remapped = registry.remap(cudf::dictionary_column_view(d1->view()));
+  cudf::dictionary_column_view view(remapped->view());
+  cudf::test::strings_column_wrapper keys_expected({"a", "aa", "bb", "cc"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.keys(), keys_expected);
+  cudf::test::fixed_width_column_wrapper<uint8_t> indices_expected({2, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.indices(), indices_expected);
+}
+
+TEST_F(DictionaryKeyRegistryTest, WithNulls)
+{
+  cudf::dictionary::key_registry registry(cudf::data_type{cudf::type_id::INT64});
+
+  cudf::test::fixed_width_column_wrapper<int64_t> input({444, 0, 333, 111, 222, 222, 222, 444, 0},
+                                                        {1, 0, 1, 1, 1, 1, 1, 1, 0});
+  auto result = registry.encode(input);
+  cudf::dictionary_column_view view(result->view());
+
+  // null entries are not registered as keys
+  cudf::test::fixed_width_column_wrapper<int64_t> keys_expected({111, 222, 333, 444});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(registry.keys(), keys_expected);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.keys(), keys_expected);
+  EXPECT_EQ(view.null_count(), 2);
+}
+
+TEST_F(DictionaryKeyRegistryTest, Errors)
+{
+  cudf::dictionary::key_registry registry(cudf::data_type{cudf::type_id::INT32});
+
+  cudf::test::fixed_width_column_wrapper<int64_t> wrong_type({1, 2, 3});
+  EXPECT_THROW(registry.encode(wrong_type), cudf::logic_error);
+  EXPECT_THROW(registry.add_keys(wrong_type), cudf::logic_error);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> null_keys({1, 2, 3}, {1, 0, 1});
+  EXPECT_THROW(registry.add_keys(null_keys), cudf::logic_error);
+}
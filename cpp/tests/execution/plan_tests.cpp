@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/execution/plan.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/types.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+
+struct ExecutionPlanTest : public cudf::test::BaseFixture {
+};
+
+// Hash-based operators return rows in unspecified order; sort by all columns
+// before comparing.
+std::unique_ptr<cudf::table> sorted(cudf::table_view const& input)
+{
+  return cudf::gather(input, *cudf::sorted_order(input));
+}
+
+TEST_F(ExecutionPlanTest, FilterProjectMatchesOpByOp)
+{
+  auto c_0 = column_wrapper<int32_t>{3, 20, 1, 50, 7};
+  auto c_1 = column_wrapper<int32_t>{10, 7, 20, 0, 5};
+  auto input = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto predicate = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_0, col_ref_1);
+  auto sum_expr  = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+
+  cudf::execution::plan plan;
+  auto const source = plan.add_source(input);
+  auto const kept   = plan.add_filter(source, predicate);
+  plan.add_project(kept, {std::cref<cudf::ast::expression>(sum_expr)});
+  auto const result = plan.execute();
+
+  auto const filtered = cudf::filter(input, predicate);
+  auto const expected = cudf::compute_columns(
+    filtered->view(), {std::cref<cudf::ast::expression>(sum_expr)});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+}
+
+TEST_F(ExecutionPlanTest, FusedFilterChainMatchesSequentialFilters)
+{
+  auto c_0 = column_wrapper<int32_t>{3, 20, 1, 50, 7, 13};
+  auto input = cudf::table_view{{c_0}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto five      = cudf::numeric_scalar<int32_t>(5);
+  auto forty     = cudf::numeric_scalar<int32_t>(40);
+  auto lit_5     = cudf::ast::literal(five);
+  auto lit_40    = cudf::ast::literal(forty);
+  auto above_5   = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_0, lit_5);
+  auto below_40  = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_0, lit_40);
+
+  cudf::execution::plan plan;
+  auto const source = plan.add_source(input);
+  plan.add_filter(plan.add_filter(source, above_5), below_40);
+  auto const result = plan.execute();
+
+  auto const expected = cudf::filter(cudf::filter(input, above_5)->view(), below_40);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+}
+
+TEST_F(ExecutionPlanTest, JoinOfFilteredBranches)
+{
+  auto left_key  = column_wrapper<int32_t>{0, 1, 2, 3, 4};
+  auto left_val  = column_wrapper<int32_t>{10, 11, 12, 13, 14};
+  auto right_key = column_wrapper<int32_t>{1, 2, 3, 4, 5};
+  auto right_val = column_wrapper<int32_t>{21, 22, 23, 24, 25};
+  auto left      = cudf::table_view{{left_key, left_val}};
+  auto right     = cudf::table_view{{right_key, right_val}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto two       = cudf::numeric_scalar<int32_t>(2);
+  auto five      = cudf::numeric_scalar<int32_t>(5);
+  auto lit_2     = cudf::ast::literal(two);
+  auto lit_5     = cudf::ast::literal(five);
+  auto left_pred = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref_0, lit_2);
+  auto right_pred = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_0, lit_5);
+
+  cudf::execution::plan plan;
+  auto const left_kept  = plan.add_filter(plan.add_source(left), left_pred);
+  auto const right_kept = plan.add_filter(plan.add_source(right), right_pred);
+  plan.add_inner_join(left_kept, right_kept, {0}, {0});
+  auto const result = plan.execute();
+
+  auto const expected = cudf::inner_join(cudf::filter(left, left_pred)->view(),
+                                         cudf::filter(right, right_pred)->view(),
+                                         {0},
+                                         {0});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(sorted(expected->view())->view(), sorted(result->view())->view());
+}
+
+TEST_F(ExecutionPlanTest, AggregateOverFilter)
+{
+  auto keys = column_wrapper<int32_t>{1, 2, 1, 2, 1, 2};
+  auto vals = column_wrapper<int32_t>{10, 20, 30, 40, 50, 60};
+  auto input = cudf::table_view{{keys, vals}};
+
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto fifteen   = cudf::numeric_scalar<int32_t>(15);
+  auto lit_15    = cudf::ast::literal(fifteen);
+  auto predicate = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_1, lit_15);
+
+  cudf::execution::plan plan;
+  auto const kept = plan.add_filter(plan.add_source(input), predicate);
+  std::vector<std::pair<cudf::size_type, std::unique_ptr<cudf::groupby_aggregation>>> aggs;
+  aggs.emplace_back(1, cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  plan.add_aggregate(kept, {0}, std::move(aggs));
+  auto const result = plan.execute();
+
+  // rows kept: {1, 30}, {2, 20}, {2, 40}, {1, 50}, {2, 60}
+  auto expected_keys = column_wrapper<int32_t>{1, 2};
+  auto expected_sums = column_wrapper<int64_t>{80, 120};
+  auto const expected = cudf::table_view{{expected_keys, expected_sums}};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(sorted(expected)->view(), sorted(result->view())->view());
+
+  // plans are reusable: a second execution returns the same result
+  auto const again = plan.execute();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(sorted(expected)->view(), sorted(again->view())->view());
+}
+
+TEST_F(ExecutionPlanTest, InvalidPlansThrow)
+{
+  auto c_0 = column_wrapper<int32_t>{1, 2, 3};
+  auto input = cudf::table_view{{c_0}};
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto predicate = cudf::ast::operation(cudf::ast::ast_operator::NOT, col_ref_0);
+
+  // empty plan
+  EXPECT_THROW(cudf::execution::plan{}.execute(), cudf::logic_error);
+
+  // unknown node id
+  cudf::execution::plan plan;
+  EXPECT_THROW(plan.add_filter(7, predicate), cudf::logic_error);
+
+  // a node whose result is never consumed
+  cudf::execution::plan dangling;
+  auto const source = dangling.add_source(input);
+  dangling.add_filter(source, predicate);
+  dangling.add_source(input);  // root; the filter result is unused
+  EXPECT_THROW(dangling.execute(), cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
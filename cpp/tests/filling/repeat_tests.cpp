@@ -293,3 +293,53 @@ TEST_F(RepeatErrorTestFixture, NegativeCountOrOverflow)
   // overflow
   EXPECT_THROW(auto p_ret = cudf::repeat(input_table, count_overflow, true), cudf::logic_error);
 }
+
+class RunLengthEncodeTestFixture : public cudf::test::BaseFixture {
+};
+
+TEST_F(RunLengthEncodeTestFixture, CompressAndRoundTrip)
+{
+  auto ints    = cudf::test::fixed_width_column_wrapper<int32_t>({4, 5, 5, 6, 6, 6});
+  auto strings = cudf::test::strings_column_wrapper({"a", "b", "b", "c", "c", "c"});
+  cudf::table_view input_table{{ints, strings}};
+
+  auto expected_ints    = cudf::test::fixed_width_column_wrapper<int32_t>({4, 5, 6});
+  auto expected_strings = cudf::test::strings_column_wrapper({"a", "b", "c"});
+  auto expected_lengths = cudf::test::fixed_width_column_wrapper<cudf::size_type>({1, 2, 3});
+
+  auto const [values, run_lengths] = cudf::run_length_encode(input_table);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expected_ints, expected_strings}),
+                                values->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_lengths, run_lengths->view());
+
+  // encoding is the inverse of repeat
+  auto const round_trip = cudf::repeat(values->view(), run_lengths->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input_table, round_trip->view());
+}
+
+TEST_F(RunLengthEncodeTestFixture, NullRunsCompress)
+{
+  auto input = cudf::test::fixed_width_column_wrapper<int32_t>({1, 1, 0, 0, 1}, {1, 1, 0, 0, 1});
+  cudf::table_view input_table{{input}};
+
+  auto expected_values  = cudf::test::fixed_width_column_wrapper<int32_t>({1, 0, 1}, {1, 0, 1});
+  auto expected_lengths = cudf::test::fixed_width_column_wrapper<cudf::size_type>({2, 2, 1});
+
+  auto const [values, run_lengths] = cudf::run_length_encode(input_table);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_values, values->view().column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_lengths, run_lengths->view());
+}
+
+TEST_F(RunLengthEncodeTestFixture, ZeroSizeInput)
+{
+  auto input = cudf::test::fixed_width_column_wrapper<int32_t>(thrust::make_counting_iterator(0),
+                                                               thrust::make_counting_iterator(0));
+  cudf::table_view input_table{{input}};
+
+  auto const [values, run_lengths] = cudf::run_length_encode(input_table);
+
+  EXPECT_EQ(values->num_rows(), 0);
+  EXPECT_EQ(run_lengths->size(), 0);
+}
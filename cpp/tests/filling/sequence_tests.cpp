@@ -134,3 +134,37 @@ TYPED_TEST(SequenceTypedTestFixture, DefaultStep)
 
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected_w);
 }
+
+TEST_F(SequenceTestFixture, DateSequenceCalendricalMonth)
+{
+  // 2020-01-31; adding one month lands on the last day of February (leap year)
+  timestamp_scalar<timestamp_D> init(typename timestamp_D::duration{18292}, true);
+
+  size_type num_els = 4;
+
+  fixed_width_column_wrapper<timestamp_D, int32_t> expected_w({18292, 18321, 18352, 18382});
+
+  auto result = cudf::calendrical_month_sequence(num_els, init, 1);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected_w);
+}
+
+TEST_F(SequenceTestFixture, DateSequenceNegativeMonth)
+{
+  // 2020-03-31 stepping back one month scales to 2020-02-29
+  timestamp_scalar<timestamp_D> init(typename timestamp_D::duration{18352}, true);
+
+  size_type num_els = 3;
+
+  fixed_width_column_wrapper<timestamp_D, int32_t> expected_w({18352, 18321, 18292});
+
+  auto result = cudf::calendrical_month_sequence(num_els, init, -1);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected_w);
+}
+
+TEST_F(SequenceTestFixture, DateSequenceBadTypes)
+{
+  numeric_scalar<int32_t> init(0);
+  EXPECT_THROW(cudf::calendrical_month_sequence(10, init, 1), cudf::logic_error);
+}
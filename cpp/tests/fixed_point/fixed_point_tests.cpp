@@ -423,6 +423,25 @@ void integer_vector_test(ValueType const initial_value,
   EXPECT_EQ(vec2, vec3);
 }
 
+TEST_F(FixedPointTest, Decimal128Basics)
+{
+  // values that do not fit in 64 bits
+  auto const huge = __int128_t{std::numeric_limits<int64_t>::max()} * 1000;
+
+  decimal128 num0{scaled_integer<__int128_t>{huge, scale_type{-3}}};
+  decimal128 num1{scaled_integer<__int128_t>{huge, scale_type{-3}}};
+
+  EXPECT_EQ(num0, num1);
+  EXPECT_EQ((num0 + num1).value(), huge + huge);
+  EXPECT_EQ((num0 - num1).value(), __int128_t{0});
+
+  auto const rescaled = num0.rescaled(scale_type{0});
+  EXPECT_EQ(rescaled.value(), huge / 1000);
+
+  EXPECT_EQ(static_cast<std::string>(decimal128{scaled_integer<__int128_t>{huge, scale_type{0}}}),
+            std::string{"9223372036854775807000"});
+}
+
 TEST_F(FixedPointTest, Decimal32IntVector)
 {
   integer_vector_test(0, 10, -2, std::plus<>());
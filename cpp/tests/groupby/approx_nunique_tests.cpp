@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+
+#include <algorithm>
+
+using namespace cudf::test::iterators;
+
+namespace cudf {
+namespace test {
+
+struct groupby_approx_nunique_test : public cudf::test::BaseFixture {
+  // Aggregates with APPROX_NUNIQUE and checks every group's estimate against
+  // its exact distinct count within the given relative error
+  static void expect_approx_nunique(column_view const& keys,
+                                    column_view const& values,
+                                    std::vector<size_type> const& exact,
+                                    double relative_error,
+                                    null_policy null_handling = null_policy::EXCLUDE)
+  {
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = values;
+    requests[0].aggregations.push_back(
+      cudf::make_approx_nunique_aggregation<groupby_aggregation>(null_handling));
+
+    groupby::groupby gb_obj(table_view({keys}));
+    auto result = gb_obj.aggregate(requests);
+
+    auto const sort_order  = sorted_order(result.first->view(), {}, {null_order::AFTER});
+    auto const sorted_vals = gather(table_view({*result.second[0].results[0]}), *sort_order);
+    auto const estimates   = to_host<size_type>(sorted_vals->get_column(0).view()).first;
+
+    ASSERT_EQ(exact.size(), estimates.size());
+    for (size_t i = 0; i < exact.size(); ++i) {
+      auto const tolerance =
+        std::max<double>(1.0, relative_error * static_cast<double>(exact[i]));
+      EXPECT_NEAR(static_cast<double>(estimates[i]), static_cast<double>(exact[i]), tolerance);
+    }
+  }
+};
+
+TEST_F(groupby_approx_nunique_test, basic)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<int32_t> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  // Small cardinalities fall in the linear counting range of the sketch and
+  // should come out at (or within one of) the exact counts
+  expect_approx_nunique(keys, vals, {3, 4, 3}, 0.05);
+}
+
+TEST_F(groupby_approx_nunique_test, repeated_values)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 1, 1, 1, 2, 2, 2};
+  fixed_width_column_wrapper<int32_t> vals{7, 7, 7, 7, 3, 3, 5};
+
+  expect_approx_nunique(keys, vals, {1, 2}, 0.05);
+}
+
+TEST_F(groupby_approx_nunique_test, null_handling)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 1, 1, 2, 2};
+  fixed_width_column_wrapper<int32_t> vals({3, 4, -1, 5, -1}, {1, 1, 0, 1, 0});
+
+  // Nulls are skipped by default and count as a single distinct element with
+  // INCLUDE, matching NUNIQUE
+  expect_approx_nunique(keys, vals, {2, 1}, 0.05);
+  expect_approx_nunique(keys, vals, {3, 2}, 0.05, null_policy::INCLUDE);
+}
+
+TEST_F(groupby_approx_nunique_test, large_cardinality)
+{
+  auto keys_it = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(i % 4); });
+  auto vals_it = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(i); });
+  fixed_width_column_wrapper<int32_t> keys(keys_it, keys_it + 20000);
+  fixed_width_column_wrapper<int32_t> vals(vals_it, vals_it + 20000);
+
+  // Each group holds 5000 distinct values; the default precision of 11 gives
+  // a standard error of about 2.3%
+  expect_approx_nunique(keys, vals, {5000, 5000, 5000, 5000}, 0.10);
+}
+
+TEST_F(groupby_approx_nunique_test, sort_path_is_exact)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<int32_t> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2, 3};
+  fixed_width_column_wrapper<size_type> expect_vals{3, 4, 3};
+
+  // The sort implementation computes the exact count from the formed groups
+  auto agg = cudf::make_approx_nunique_aggregation<groupby_aggregation>();
+  test_single_agg(
+    keys, vals, expect_keys, expect_vals, std::move(agg), force_use_sort_impl::YES);
+}
+
+TEST_F(groupby_approx_nunique_test, invalid_precision)
+{
+  EXPECT_THROW(cudf::make_approx_nunique_aggregation<groupby_aggregation>(null_policy::EXCLUDE, 3),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::make_approx_nunique_aggregation<groupby_aggregation>(null_policy::EXCLUDE, 19),
+               cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <cmath>
+
+namespace cudf {
+namespace test {
+
+struct groupby_merge_aggregates_test : public cudf::test::BaseFixture {
+  // Runs partial_aggregate per worker chunk, concatenates the partial states,
+  // and merges them, returning the merged results sorted by key
+  static std::pair<std::unique_ptr<table>, std::unique_ptr<table>> partial_then_merge(
+    std::vector<std::pair<column_view, column_view>> const& chunks,
+    std::vector<aggregation::Kind> const& aggs)
+  {
+    std::vector<std::unique_ptr<table>> partial_keys;
+    std::vector<std::unique_ptr<table>> partial_states;
+    for (auto const& [keys, vals] : chunks) {
+      std::vector<column_view> value_columns(aggs.size(), vals);
+      auto [chunk_keys, chunk_state] =
+        groupby::partial_aggregate(table_view({keys}), table_view(value_columns), aggs);
+      partial_keys.push_back(std::move(chunk_keys));
+      partial_states.push_back(std::move(chunk_state));
+    }
+
+    std::vector<table_view> key_views;
+    std::vector<table_view> state_views;
+    for (size_t i = 0; i < partial_keys.size(); ++i) {
+      key_views.push_back(partial_keys[i]->view());
+      state_views.push_back(partial_states[i]->view());
+    }
+    auto const all_keys   = cudf::concatenate(key_views);
+    auto const all_states = cudf::concatenate(state_views);
+
+    auto [merged_keys, merged_values] =
+      groupby::merge_aggregates(all_keys->view(), all_states->view(), aggs);
+
+    auto const sort_order  = cudf::sorted_order(merged_keys->view());
+    auto sorted_keys       = cudf::gather(merged_keys->view(), *sort_order);
+    auto sorted_values     = cudf::gather(merged_values->view(), *sort_order);
+    return std::make_pair(std::move(sorted_keys), std::move(sorted_values));
+  }
+};
+
+TEST_F(groupby_merge_aggregates_test, TwoWorkers)
+{
+  fixed_width_column_wrapper<int32_t> keys0{1, 2, 1, 2};
+  fixed_width_column_wrapper<int32_t> vals0{10, 20, 30, 40};
+  fixed_width_column_wrapper<int32_t> keys1{2, 3, 3};
+  fixed_width_column_wrapper<int32_t> vals1{5, 6, 7};
+
+  std::vector<aggregation::Kind> aggs{aggregation::SUM,
+                                      aggregation::COUNT_VALID,
+                                      aggregation::MEAN,
+                                      aggregation::VARIANCE,
+                                      aggregation::STD};
+  auto const [sorted_keys, sorted_values] =
+    partial_then_merge({{keys0, vals0}, {keys1, vals1}}, aggs);
+
+  // Groups over all rows: 1 -> {10, 30}, 2 -> {20, 40, 5}, 3 -> {6, 7}
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2, 3};
+  fixed_width_column_wrapper<int64_t> expect_sums{40, 65, 13};
+  fixed_width_column_wrapper<int64_t> expect_counts{2, 3, 2};
+  fixed_width_column_wrapper<double> expect_means{20., 65. / 3, 6.5};
+  fixed_width_column_wrapper<double> expect_vars{200., 5550. / 9 / 2, 0.5};
+  fixed_width_column_wrapper<double> expect_stds{
+    std::sqrt(200.), std::sqrt(5550. / 9 / 2), std::sqrt(0.5)};
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), sorted_keys->view());
+  table_view expected{{expect_sums, expect_counts, expect_means, expect_vars, expect_stds}};
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected, sorted_values->view());
+}
+
+TEST_F(groupby_merge_aggregates_test, MinMaxAcrossWorkers)
+{
+  fixed_width_column_wrapper<int32_t> keys0{1, 1, 2};
+  fixed_width_column_wrapper<int32_t> vals0{5, 3, 9};
+  fixed_width_column_wrapper<int32_t> keys1{1, 2};
+  fixed_width_column_wrapper<int32_t> vals1{7, 1};
+
+  std::vector<aggregation::Kind> aggs{aggregation::MIN, aggregation::MAX};
+  auto const [sorted_keys, sorted_values] =
+    partial_then_merge({{keys0, vals0}, {keys1, vals1}}, aggs);
+
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2};
+  fixed_width_column_wrapper<int32_t> expect_mins{3, 1};
+  fixed_width_column_wrapper<int32_t> expect_maxs{7, 9};
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), sorted_keys->view());
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(table_view({expect_mins, expect_maxs}),
+                                     sorted_values->view());
+}
+
+TEST_F(groupby_merge_aggregates_test, AllNullGroup)
+{
+  fixed_width_column_wrapper<int32_t> keys0{1, 1, 2};
+  fixed_width_column_wrapper<int32_t> vals0({-1, -1, 3}, {0, 0, 1});
+  fixed_width_column_wrapper<int32_t> keys1{1, 2};
+  fixed_width_column_wrapper<int32_t> vals1({-1, 4}, {0, 1});
+
+  std::vector<aggregation::Kind> aggs{aggregation::MEAN, aggregation::VARIANCE};
+  auto const [sorted_keys, sorted_values] =
+    partial_then_merge({{keys0, vals0}, {keys1, vals1}}, aggs);
+
+  // Group 1 has no valid values, so its mean and variance stay null; group 2
+  // has one valid value per chunk and only their combination has the two
+  // observations a variance with the default ddof of 1 needs
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2};
+  fixed_width_column_wrapper<double> expect_means({0., 3.5}, {0, 1});
+  fixed_width_column_wrapper<double> expect_vars({0., 0.5}, {0, 1});
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), sorted_keys->view());
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(table_view({expect_means, expect_vars}),
+                                     sorted_values->view());
+}
+
+TEST_F(groupby_merge_aggregates_test, InvalidRequests)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2};
+  fixed_width_column_wrapper<int32_t> vals{3, 4};
+
+  // One aggregation per value column is required
+  EXPECT_THROW(groupby::partial_aggregate(
+                 table_view({keys}), table_view({vals}), {aggregation::SUM, aggregation::MIN}),
+               cudf::logic_error);
+  // NUNIQUE partials cannot be merged
+  EXPECT_THROW(
+    groupby::partial_aggregate(table_view({keys}), table_view({vals}), {aggregation::NUNIQUE}),
+    cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+namespace cudf {
+namespace test {
+
+struct groupby_streaming_test : public cudf::test::BaseFixture {
+  // Sorts the (keys, values) result pair by key for order-insensitive comparison
+  static std::unique_ptr<table> sorted_state(
+    std::pair<std::unique_ptr<table>, std::unique_ptr<table>> const& state)
+  {
+    std::vector<column_view> columns(state.first->view().begin(), state.first->view().end());
+    columns.insert(columns.end(), state.second->view().begin(), state.second->view().end());
+    table_view combined{columns};
+    auto sort_order = cudf::sorted_order(state.first->view());
+    return cudf::gather(combined, *sort_order);
+  }
+};
+
+TEST_F(groupby_streaming_test, RunningSumAndCount)
+{
+  groupby::streaming_groupby gb({aggregation::SUM, aggregation::COUNT_VALID});
+
+  fixed_width_column_wrapper<int32_t> keys0{1, 2, 1, 3};
+  fixed_width_column_wrapper<int32_t> vals0{10, 20, 30, 40};
+  gb.update(table_view({keys0}), table_view({vals0, vals0}));
+
+  fixed_width_column_wrapper<int32_t> keys1{2, 3, 4};
+  fixed_width_column_wrapper<int32_t> vals1{5, 6, 7};
+  gb.update(table_view({keys1}), table_view({vals1, vals1}));
+
+  auto state = gb.results();
+
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2, 3, 4};
+  fixed_width_column_wrapper<int64_t> expect_sums{40, 25, 46, 7};
+  fixed_width_column_wrapper<int64_t> expect_counts{2, 2, 2, 1};
+  table_view expected{{expect_keys, expect_sums, expect_counts}};
+
+  auto const sorted = sorted_state(state);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected, sorted->view());
+}
+
+TEST_F(groupby_streaming_test, MinMaxAcrossChunks)
+{
+  groupby::streaming_groupby gb({aggregation::MIN, aggregation::MAX});
+
+  fixed_width_column_wrapper<int32_t> keys0{1, 1, 2};
+  fixed_width_column_wrapper<int32_t> vals0{5, 3, 9};
+  gb.update(table_view({keys0}), table_view({vals0, vals0}));
+
+  fixed_width_column_wrapper<int32_t> keys1{1, 2};
+  fixed_width_column_wrapper<int32_t> vals1{7, 1};
+  gb.update(table_view({keys1}), table_view({vals1, vals1}));
+
+  auto state = gb.results();
+
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2};
+  fixed_width_column_wrapper<int32_t> expect_mins{3, 1};
+  fixed_width_column_wrapper<int32_t> expect_maxs{7, 9};
+  table_view expected{{expect_keys, expect_mins, expect_maxs}};
+
+  auto const sorted = sorted_state(state);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected, sorted->view());
+}
+
+TEST_F(groupby_streaming_test, EmptyBeforeFirstUpdate)
+{
+  groupby::streaming_groupby gb({aggregation::SUM});
+  auto state = gb.results();
+  EXPECT_EQ(state.first->num_columns(), 0);
+  EXPECT_EQ(state.second->num_columns(), 0);
+}
+
+TEST_F(groupby_streaming_test, RejectsUnmergeableAggregation)
+{
+  EXPECT_THROW(groupby::streaming_groupby({aggregation::MEAN}), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -22,6 +22,7 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
 
 using namespace cudf::test::iterators;
 
@@ -74,6 +75,87 @@ TYPED_TEST(groupby_sum_test, empty_cols)
   test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
+TYPED_TEST(groupby_sum_test, low_cardinality_large)
+{
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  // Large enough to engage the shared-memory pre-aggregation path of the
+  // hash groupby; the result must match the sort-based implementation.
+  constexpr cudf::size_type num_rows = 20000;
+  auto keys_it = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  auto vals_it = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return 1; });
+  fixed_width_column_wrapper<K> keys(keys_it, keys_it + num_rows);
+  fixed_width_column_wrapper<V, int> vals(vals_it, vals_it + num_rows);
+
+  fixed_width_column_wrapper<K> expect_keys{0, 1, 2};
+  fixed_width_column_wrapper<R, int> expect_vals{6667, 6667, 6666};
+
+  auto agg = cudf::make_sum_aggregation<groupby_aggregation>();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+  auto agg2 = cudf::make_sum_aggregation<groupby_aggregation>();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
+}
+
+TYPED_TEST(groupby_sum_test, repeated_requests_same_column)
+{
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<V> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  fixed_width_column_wrapper<R> expect_vals{9, 19, 17};
+
+  // Several requests against the same values column share one cache slot in
+  // the sort-based groupby; every request must still get its own result.
+  std::vector<groupby::aggregation_request> requests(3);
+  for (auto& request : requests) {
+    request.values = vals;
+    request.aggregations.push_back(cudf::make_sum_aggregation<groupby_aggregation>());
+  }
+  // WAR to force groupby to use sort implementation
+  requests[0].aggregations.push_back(make_nth_element_aggregation<groupby_aggregation>(0));
+
+  groupby::groupby gb_obj(table_view({keys}));
+  auto result = gb_obj.aggregate(requests);
+
+  for (auto const& aggregation_result : result.second) {
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_vals, *aggregation_result.results[0]);
+  }
+}
+
+TYPED_TEST(groupby_sum_test, fused_with_min_and_max)
+{
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<V> vals({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}, {1, 1, 1, 0, 1, 1, 1, 1, 1, 1});
+
+  fixed_width_column_wrapper<R> expect_sums({6, 19, 17}, no_nulls());
+  fixed_width_column_wrapper<V> expect_mins({0, 1, 2}, no_nulls());
+  fixed_width_column_wrapper<V> expect_maxs({6, 9, 8}, no_nulls());
+
+  // SUM, MIN, and MAX in one request are computed by a single fused pass in
+  // the sort-based groupby; each must match its dedicated reduction.
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_min_aggregation<groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_max_aggregation<groupby_aggregation>());
+  // WAR to force groupby to use sort implementation
+  requests[0].aggregations.push_back(make_nth_element_aggregation<groupby_aggregation>(0));
+
+  groupby::groupby gb_obj(table_view({keys}));
+  auto result = gb_obj.aggregate(requests);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_sums, *result.second[0].results[0]);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_mins, *result.second[0].results[1]);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_maxs, *result.second[0].results[2]);
+}
+
 TYPED_TEST(groupby_sum_test, zero_valid_keys)
 {
   using V = TypeParam;
@@ -219,5 +301,63 @@ TYPED_TEST(FixedPointTestBothReps, GroupByHashSumDecimalAsValue)
   }
 }
 
+struct groupby_rle_sum_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_rle_sum_test, matches_expanded_sum)
+{
+  using R = cudf::detail::target_type_t<int32_t, aggregation::SUM>;
+
+  // each row stands for run_lengths[i] identical rows
+  fixed_width_column_wrapper<K> keys{1, 1, 2, 2};
+  fixed_width_column_wrapper<int32_t> vals{10, 20, 5, 7};
+  fixed_width_column_wrapper<size_type> lengths{2, 1, 3, 2};
+
+  fixed_width_column_wrapper<K> expect_keys{1, 2};
+  fixed_width_column_wrapper<R> expect_vals{40, 29};
+
+  auto const result = groupby::run_length_sum(table_view({keys}), table_view({vals}), lengths);
+
+  // the hash groupby does not order its groups
+  auto const sort_order  = sorted_order(result.first->view(), {}, {null_order::AFTER});
+  auto const sorted_keys = gather(result.first->view(), *sort_order);
+  auto const sorted_sums = gather(result.second->view(), *sort_order);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), *sorted_keys);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_vals, sorted_sums->view().column(0));
+}
+
+TEST_F(groupby_rle_sum_test, null_value_runs)
+{
+  using R = cudf::detail::target_type_t<int32_t, aggregation::SUM>;
+
+  // a null value run contributes nothing, exactly as its expanded rows would
+  fixed_width_column_wrapper<K> keys{1, 1};
+  fixed_width_column_wrapper<int32_t> vals({10, 0}, {1, 0});
+  fixed_width_column_wrapper<size_type> lengths{2, 5};
+
+  fixed_width_column_wrapper<K> expect_keys{1};
+  fixed_width_column_wrapper<R> expect_vals{20};
+
+  auto const result = groupby::run_length_sum(table_view({keys}), table_view({vals}), lengths);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), result.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_vals, result.second->view().column(0));
+}
+
+TEST_F(groupby_rle_sum_test, bad_run_lengths)
+{
+  fixed_width_column_wrapper<K> keys{1, 1};
+  fixed_width_column_wrapper<int32_t> vals{10, 20};
+
+  fixed_width_column_wrapper<size_type> short_lengths{2};
+  EXPECT_THROW(groupby::run_length_sum(table_view({keys}), table_view({vals}), short_lengths),
+               cudf::logic_error);
+
+  fixed_width_column_wrapper<size_type> null_lengths({2, 1}, {1, 0});
+  EXPECT_THROW(groupby::run_length_sum(table_view({keys}), table_view({vals}), null_lengths),
+               cudf::logic_error);
+}
+
 }  // namespace test
 }  // namespace cudf
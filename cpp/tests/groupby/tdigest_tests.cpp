@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/groupby.hpp>
+
+namespace cudf {
+namespace test {
+
+using lists_dbl   = lists_column_wrapper<double>;
+using structs_col = structs_column_wrapper;
+
+template <typename V>
+struct groupby_tdigest_test : public cudf::test::BaseFixture {
+};
+
+using ArithmeticTypes =
+  cudf::test::Concat<cudf::test::IntegralTypesNotBool, cudf::test::FloatingPointTypes>;
+TYPED_TEST_CASE(groupby_tdigest_test, ArithmeticTypes);
+
+TYPED_TEST(groupby_tdigest_test, ExactWhenUncompressed)
+{
+  using K = int32_t;
+  using V = TypeParam;
+
+  fixed_width_column_wrapper<K, int32_t> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<V, int32_t> values{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  // With max_centroids far above the group sizes every value becomes its own
+  // unit-weight centroid, so the digest is exactly the sorted group values
+  fixed_width_column_wrapper<K, int32_t> expect_keys{1, 2, 3};
+  lists_dbl means{{0, 3, 6}, {1, 4, 5, 9}, {2, 7, 8}};
+  lists_dbl weights{{1, 1, 1}, {1, 1, 1, 1}, {1, 1, 1}};
+  structs_col expect_vals({means, weights});
+
+  auto agg = cudf::make_tdigest_aggregation<groupby_aggregation>();
+  test_single_agg(keys, values, expect_keys, expect_vals, std::move(agg));
+}
+
+TYPED_TEST(groupby_tdigest_test, NullsExcluded)
+{
+  using K = int32_t;
+  using V = TypeParam;
+
+  fixed_width_column_wrapper<K, int32_t> keys{1, 1, 2, 2, 3};
+  fixed_width_column_wrapper<V, int32_t> values{{3, 1, 4, 1, 5}, {1, 0, 1, 1, 0}};
+
+  // Null elements are excluded; an all-null group gets empty centroid lists
+  fixed_width_column_wrapper<K, int32_t> expect_keys{1, 2, 3};
+  lists_dbl means{{3}, {1, 4}, {}};
+  lists_dbl weights{{1}, {1, 1}, {}};
+  structs_col expect_vals({means, weights});
+
+  auto agg = cudf::make_tdigest_aggregation<groupby_aggregation>();
+  test_single_agg(keys, values, expect_keys, expect_vals, std::move(agg));
+}
+
+TYPED_TEST(groupby_tdigest_test, SingleCentroid)
+{
+  using K = int32_t;
+  using V = TypeParam;
+
+  fixed_width_column_wrapper<K, int32_t> keys{1, 1, 1, 2, 2};
+  fixed_width_column_wrapper<V, int32_t> values{1, 2, 6, 4, 8};
+
+  // max_centroids of one collapses each group into its mean and total weight
+  fixed_width_column_wrapper<K, int32_t> expect_keys{1, 2};
+  lists_dbl means{{3}, {6}};
+  lists_dbl weights{{3}, {2}};
+  structs_col expect_vals({means, weights});
+
+  auto agg = cudf::make_tdigest_aggregation<groupby_aggregation>(1);
+  test_single_agg(keys, values, expect_keys, expect_vals, std::move(agg));
+}
+
+struct groupby_merge_tdigest_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_merge_tdigest_test, MergeDigests)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 1, 2};
+
+  lists_dbl in_means{{1, 5}, {3}, {2}};
+  lists_dbl in_weights{{2, 1}, {4}, {1}};
+  structs_col values({in_means, in_weights});
+
+  // Pooled centroids are ordered by mean; with a high max_centroids none of
+  // them are combined, so the merge keeps the individual centroids
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2};
+  lists_dbl means{{1, 3, 5}, {2}};
+  lists_dbl weights{{2, 4, 1}, {1}};
+  structs_col expect_vals({means, weights});
+
+  auto agg = cudf::make_merge_tdigest_aggregation<groupby_aggregation>();
+  test_single_agg(keys, values, expect_keys, expect_vals, std::move(agg));
+}
+
+TEST_F(groupby_merge_tdigest_test, DistributedRollup)
+{
+  // Build partial digests per partition, then merge them under the original
+  // keys; the rollup must match building one digest over all the data
+  fixed_width_column_wrapper<int32_t> keys1{1, 2, 1, 2};
+  fixed_width_column_wrapper<double> values1{1, 8, 3, 4};
+  fixed_width_column_wrapper<int32_t> keys2{2, 1, 1};
+  fixed_width_column_wrapper<double> values2{6, 2, 5};
+
+  auto make_digest = [](column_view const& keys, column_view const& values) {
+    std::vector<groupby::aggregation_request> requests;
+    requests.emplace_back(groupby::aggregation_request());
+    requests[0].values = values;
+    requests[0].aggregations.emplace_back(make_tdigest_aggregation<groupby_aggregation>());
+    auto gb_obj = groupby::groupby(table_view({keys}));
+    auto result = gb_obj.aggregate(requests);
+    return std::make_pair(std::move(result.first->release()[0]),
+                          std::move(result.second[0].results[0]));
+  };
+
+  auto [part_keys1, digest1] = make_digest(keys1, values1);
+  auto [part_keys2, digest2] = make_digest(keys2, values2);
+
+  auto const merged_keys =
+    cudf::concatenate(std::vector<column_view>{part_keys1->view(), part_keys2->view()});
+  auto const merged_values =
+    cudf::concatenate(std::vector<column_view>{digest1->view(), digest2->view()});
+
+  std::vector<groupby::aggregation_request> requests;
+  requests.emplace_back(groupby::aggregation_request());
+  requests[0].values = merged_values->view();
+  requests[0].aggregations.emplace_back(make_merge_tdigest_aggregation<groupby_aggregation>());
+  auto gb_obj = groupby::groupby(table_view({merged_keys->view()}));
+  auto result = gb_obj.aggregate(requests);
+
+  // All values are unit-weight centroids in the uncompressed digests, so the
+  // merge result equals the digest of the concatenated raw values
+  fixed_width_column_wrapper<int32_t> all_keys{1, 2, 1, 2, 2, 1, 1};
+  fixed_width_column_wrapper<double> all_values{1, 8, 3, 4, 6, 2, 5};
+  auto [expect_keys, expect_digest] = make_digest(all_keys, all_values);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result.first->get_column(0).view(), expect_keys->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result.second[0].results[0]->view(), expect_digest->view());
+}
+
+TEST_F(groupby_merge_tdigest_test, InvalidRequests)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3};
+  fixed_width_column_wrapper<int32_t> values{1, 2, 3};
+
+  // max_centroids must be positive
+  EXPECT_THROW(cudf::make_tdigest_aggregation<groupby_aggregation>(0), cudf::logic_error);
+  EXPECT_THROW(cudf::make_merge_tdigest_aggregation<groupby_aggregation>(0), cudf::logic_error);
+
+  // MERGE_TDIGEST requires the digest structs layout
+  auto agg = cudf::make_merge_tdigest_aggregation<groupby_aggregation>();
+  EXPECT_THROW(test_single_agg(keys, values, keys, values, std::move(agg)), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/detail/aggregation/aggregation.hpp>
+
+namespace cudf {
+namespace test {
+
+template <typename V>
+struct groupby_topk_test : public cudf::test::BaseFixture {
+};
+
+using FixedWidthTypesNotBool = cudf::test::Concat<cudf::test::IntegralTypesNotBool,
+                                                  cudf::test::FloatingPointTypes,
+                                                  cudf::test::TimestampTypes>;
+TYPED_TEST_CASE(groupby_topk_test, FixedWidthTypesNotBool);
+
+TYPED_TEST(groupby_topk_test, TopK)
+{
+  using K = int32_t;
+  using V = TypeParam;
+
+  fixed_width_column_wrapper<K, int32_t> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<V, int32_t> values{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  fixed_width_column_wrapper<K, int32_t> expect_keys{1, 2, 3};
+  lists_column_wrapper<V, int32_t> expect_vals{{6, 3}, {9, 5}, {8, 7}};
+
+  auto agg = cudf::make_top_k_aggregation<groupby_aggregation>(2);
+  test_single_agg(keys, values, expect_keys, expect_vals, std::move(agg));
+}
+
+TYPED_TEST(groupby_topk_test, BottomK)
+{
+  using K = int32_t;
+  using V = TypeParam;
+
+  fixed_width_column_wrapper<K, int32_t> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<V, int32_t> values{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  fixed_width_column_wrapper<K, int32_t> expect_keys{1, 2, 3};
+  lists_column_wrapper<V, int32_t> expect_vals{{0, 3}, {1, 4}, {2, 7}};
+
+  auto agg = cudf::make_top_k_aggregation<groupby_aggregation>(2, order::ASCENDING);
+  test_single_agg(keys, values, expect_keys, expect_vals, std::move(agg));
+}
+
+TYPED_TEST(groupby_topk_test, KLargerThanGroups)
+{
+  using K = int32_t;
+  using V = TypeParam;
+
+  fixed_width_column_wrapper<K, int32_t> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<V, int32_t> values{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  // Groups smaller than k return all their elements, still ordered best first
+  fixed_width_column_wrapper<K, int32_t> expect_keys{1, 2, 3};
+  lists_column_wrapper<V, int32_t> expect_vals{{6, 3, 0}, {9, 5, 4, 1}, {8, 7, 2}};
+
+  auto agg = cudf::make_top_k_aggregation<groupby_aggregation>(5);
+  test_single_agg(keys, values, expect_keys, expect_vals, std::move(agg));
+}
+
+TYPED_TEST(groupby_topk_test, NullsAreExcluded)
+{
+  using K = int32_t;
+  using V = TypeParam;
+
+  fixed_width_column_wrapper<K, int32_t> keys{1, 1, 1, 2, 2, 2, 3, 3};
+  fixed_width_column_wrapper<V, int32_t> values{{0, 1, 2, 3, 4, 5, 6, 7},
+                                                {true, false, true, false, true, false, false, false}};
+
+  // Group 3 has no valid elements and returns an empty list
+  fixed_width_column_wrapper<K, int32_t> expect_keys{1, 2, 3};
+  lists_column_wrapper<V, int32_t> expect_vals{{2, 0}, {4}, {}};
+
+  auto agg = cudf::make_top_k_aggregation<groupby_aggregation>(2);
+  test_single_agg(keys, values, expect_keys, expect_vals, std::move(agg));
+}
+
+struct groupby_topk_error_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_topk_error_test, InvalidK)
+{
+  EXPECT_THROW(cudf::make_top_k_aggregation<groupby_aggregation>(0), cudf::logic_error);
+  EXPECT_THROW(cudf::make_top_k_aggregation<groupby_aggregation>(33), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -25,6 +25,8 @@
 
 #include <cudf/detail/aggregation/aggregation.hpp>
 
+#include <cmath>
+
 using namespace cudf::test::iterators;
 
 namespace cudf {
@@ -167,6 +169,51 @@ TYPED_TEST(groupby_var_test, dictionary)
                   cudf::make_variance_aggregation<cudf::groupby_aggregation>());
 }
 
+// Multiple variance-family aggregations across requests are computed by a
+// single fused pass in the hash implementation; results must match the
+// independently computed single-aggregation results.
+TYPED_TEST(groupby_var_test, multiple_fused_variances)
+{
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::VARIANCE>;
+
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<V> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  std::vector<groupby::aggregation_request> requests(2);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_variance_aggregation<groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_variance_aggregation<groupby_aggregation>(0));
+  requests[0].aggregations.push_back(cudf::make_std_aggregation<groupby_aggregation>());
+  requests[1].values = vals;
+  requests[1].aggregations.push_back(cudf::make_variance_aggregation<groupby_aggregation>());
+
+  groupby::groupby gb_obj(table_view({keys}));
+  auto result = gb_obj.aggregate(requests);
+
+  auto const sort_order  = sorted_order(result.first->view(), {}, {null_order::AFTER});
+  auto const sorted_keys = gather(result.first->view(), *sort_order);
+
+  fixed_width_column_wrapper<K> expect_keys{1, 2, 3};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), *sorted_keys);
+
+  // clang-format off
+  fixed_width_column_wrapper<R> expect_var  ({9.,          131. / 12,       31. / 3},       no_nulls());
+  fixed_width_column_wrapper<R> expect_var0 ({6.,          131. / 16,       62. / 9},       no_nulls());
+  fixed_width_column_wrapper<R> expect_std  ({3.,          std::sqrt(131. / 12),
+                                                                            std::sqrt(31. / 3)},
+                                             no_nulls());
+  // clang-format on
+
+  auto const sorted = [&](column_view const& col) {
+    return std::move(gather(table_view({col}), *sort_order)->release()[0]);
+  };
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_var, *sorted(*result.second[0].results[0]));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_var0, *sorted(*result.second[0].results[1]));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_std, *sorted(*result.second[0].results[2]));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_var, *sorted(*result.second[1].results[0]));
+}
+
 }  // namespace test
 }  // namespace cudf
 
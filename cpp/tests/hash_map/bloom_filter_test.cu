@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <hash/blocked_bloom_filter.cuh>
+#include <hash/hash_allocator.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <thrust/device_vector.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+using filter_type = blocked_bloom_filter<uint32_t>;
+
+__global__ void insert_values(filter_type filter, uint32_t const* values, int num_values)
+{
+  int i = threadIdx.x + blockIdx.x * blockDim.x;
+  if (i < num_values) { filter.insert(values[i]); }
+}
+
+__global__ void query_values(filter_type filter, uint32_t const* values, int num_values, bool* hits)
+{
+  int i = threadIdx.x + blockIdx.x * blockDim.x;
+  if (i < num_values) { hits[i] = filter.contains(values[i]); }
+}
+
+}  // namespace
+
+class BloomFilterTest : public cudf::test::BaseFixture {
+ public:
+  static constexpr int num_keys = 256;
+
+  std::unique_ptr<filter_type, std::function<void(filter_type*)>> the_filter;
+
+  BloomFilterTest() : the_filter(filter_type::create(num_keys))
+  {
+    rmm::cuda_stream_default.synchronize();
+  }
+};
+
+TEST_F(BloomFilterTest, NoFalseNegatives)
+{
+  std::vector<uint32_t> h_values(num_keys);
+  std::iota(h_values.begin(), h_values.end(), 7u);
+  for (auto& v : h_values) {
+    v *= 2654435761u;
+  }
+
+  thrust::device_vector<uint32_t> d_values(h_values);
+  insert_values<<<1, num_keys>>>(*(this->the_filter), d_values.data().get(), num_keys);
+
+  thrust::device_vector<bool> d_hits(num_keys, false);
+  query_values<<<1, num_keys>>>(
+    *(this->the_filter), d_values.data().get(), num_keys, d_hits.data().get());
+
+  std::vector<uint8_t> h_hits(num_keys);
+  thrust::copy(d_hits.begin(), d_hits.end(), h_hits.begin());
+  for (int i = 0; i < num_keys; ++i) {
+    EXPECT_TRUE(h_hits[i]) << "value index " << i;
+  }
+}
+
+TEST_F(BloomFilterTest, MostlyRejectsAbsentValues)
+{
+  std::vector<uint32_t> h_inserted(num_keys);
+  std::iota(h_inserted.begin(), h_inserted.end(), 7u);
+  for (auto& v : h_inserted) {
+    v *= 2654435761u;
+  }
+
+  thrust::device_vector<uint32_t> d_inserted(h_inserted);
+  insert_values<<<1, num_keys>>>(*(this->the_filter), d_inserted.data().get(), num_keys);
+
+  // Query a disjoint set of values; a handful of false positives is expected,
+  // but the overwhelming majority must be rejected
+  std::vector<uint32_t> h_absent(num_keys);
+  std::iota(h_absent.begin(), h_absent.end(), 100000u);
+  for (auto& v : h_absent) {
+    v *= 40503u;
+  }
+
+  thrust::device_vector<uint32_t> d_absent(h_absent);
+  thrust::device_vector<bool> d_hits(num_keys, false);
+  query_values<<<1, num_keys>>>(
+    *(this->the_filter), d_absent.data().get(), num_keys, d_hits.data().get());
+
+  std::vector<uint8_t> h_hits(num_keys);
+  thrust::copy(d_hits.begin(), d_hits.end(), h_hits.begin());
+  auto const false_positives = std::accumulate(h_hits.begin(), h_hits.end(), 0);
+  EXPECT_LT(false_positives, num_keys / 10);
+}
+
+TEST_F(BloomFilterTest, PassThroughWhenEmpty)
+{
+  filter_type pass_through{};
+  EXPECT_EQ(pass_through.num_blocks(), 0u);
+
+  thrust::device_vector<uint32_t> d_values(1, 42u);
+  thrust::device_vector<bool> d_hits(1, false);
+  query_values<<<1, 1>>>(pass_through, d_values.data().get(), 1, d_hits.data().get());
+
+  std::vector<uint8_t> h_hits(1);
+  thrust::copy(d_hits.begin(), d_hits.end(), h_hits.begin());
+  EXPECT_TRUE(h_hits[0]);
+}
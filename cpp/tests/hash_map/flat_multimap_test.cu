@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <hash/flat_multimap.cuh>
+#include <hash/hash_allocator.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <thrust/device_vector.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+namespace {
+
+template <typename map_type, typename key_type, typename value_type>
+__global__ void insert_pairs(
+  map_type map, key_type const* keys, value_type const* values, int num_pairs, int* error)
+{
+  int i = threadIdx.x + blockIdx.x * blockDim.x;
+  if (i < num_pairs) {
+    auto const hash_value = static_cast<typename map_type::hash_value_type>(keys[i]);
+    if (not map.insert(keys[i], values[i], hash_value)) { *error = 1; }
+  }
+}
+
+template <typename map_type, typename key_type>
+__global__ void count_matches(map_type map, key_type const* keys, int num_keys, int* counts)
+{
+  int i = threadIdx.x + blockIdx.x * blockDim.x;
+  if (i < num_keys) {
+    auto const hash_value = static_cast<typename map_type::hash_value_type>(keys[i]);
+    auto probe            = map.probe(hash_value);
+    int matches           = 0;
+    while (not(map.get_unused_key() == probe.key() or probe.exhausted())) {
+      if (probe.key() == keys[i]) { ++matches; }
+      probe.advance();
+    }
+    counts[i] = matches;
+  }
+}
+
+}  // namespace
+
+// This is necessary to do a parametrized typed-test over multiple template
+// arguments
+template <typename Key, typename Value>
+struct KeyValueTypes {
+  using key_type   = Key;
+  using value_type = Value;
+};
+
+// A new instance of this class will be created for each *TEST(FlatMultimapTest,
+// ...) Put all repeated stuff for each test here
+template <class T>
+class FlatMultimapTest : public cudf::test::BaseFixture {
+ public:
+  using key_type   = typename T::key_type;
+  using value_type = typename T::value_type;
+  using size_type  = int;
+
+  using multimap_type = flat_multimap<key_type,
+                                      value_type,
+                                      size_type,
+                                      std::numeric_limits<key_type>::max(),
+                                      std::numeric_limits<value_type>::max(),
+                                      default_hash<key_type>,
+                                      equal_to<key_type>,
+                                      default_allocator<char>>;
+
+  std::unique_ptr<multimap_type, std::function<void(multimap_type*)>> the_map;
+
+  const key_type unused_key = std::numeric_limits<key_type>::max();
+
+  const size_type size;
+
+  FlatMultimapTest(const size_type hash_table_size = 100)
+    : the_map(multimap_type::create(hash_table_size)), size(hash_table_size)
+  {
+    rmm::cuda_stream_default.synchronize();
+  }
+
+  ~FlatMultimapTest() {}
+};
+
+typedef ::testing::Types<KeyValueTypes<int, int>,
+                         KeyValueTypes<int, long long int>,
+                         KeyValueTypes<int, unsigned long long int>,
+                         KeyValueTypes<unsigned long long int, int>,
+                         KeyValueTypes<unsigned long long int, long long int>,
+                         KeyValueTypes<unsigned long long int, unsigned long long int>>
+  Implementations;
+
+TYPED_TEST_CASE(FlatMultimapTest, Implementations);
+
+TYPED_TEST(FlatMultimapTest, InitialState)
+{
+  EXPECT_GE(this->the_map->capacity(), this->size);
+  EXPECT_EQ(this->the_map->capacity() % TestFixture::multimap_type::window_size, 0);
+}
+
+TYPED_TEST(FlatMultimapTest, ProbeFindsAllDuplicates)
+{
+  using key_type   = typename TypeParam::key_type;
+  using value_type = typename TypeParam::value_type;
+
+  constexpr int num_unique_keys = 10;
+  constexpr int num_copies      = 3;
+  constexpr int num_pairs       = num_unique_keys * num_copies;
+
+  std::vector<key_type> h_keys(num_pairs);
+  std::vector<value_type> h_values(num_pairs);
+  for (int i = 0; i < num_pairs; ++i) {
+    h_keys[i]   = static_cast<key_type>(i % num_unique_keys);
+    h_values[i] = static_cast<value_type>(i);
+  }
+
+  thrust::device_vector<key_type> d_keys(h_keys);
+  thrust::device_vector<value_type> d_values(h_values);
+  thrust::device_vector<int> d_error(1, 0);
+
+  insert_pairs<<<1, num_pairs>>>(*(this->the_map),
+                                 d_keys.data().get(),
+                                 d_values.data().get(),
+                                 num_pairs,
+                                 d_error.data().get());
+  EXPECT_EQ(0, static_cast<int>(d_error[0]));
+
+  thrust::device_vector<int> d_counts(num_pairs, 0);
+  count_matches<<<1, num_pairs>>>(
+    *(this->the_map), d_keys.data().get(), num_pairs, d_counts.data().get());
+
+  std::vector<int> h_counts(num_pairs);
+  thrust::copy(d_counts.begin(), d_counts.end(), h_counts.begin());
+  for (int i = 0; i < num_pairs; ++i) {
+    EXPECT_EQ(num_copies, h_counts[i]) << "key " << i % num_unique_keys;
+  }
+}
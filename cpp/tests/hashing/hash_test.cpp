@@ -127,6 +127,12 @@ TEST_F(HashTest, MultiValueNulls)
 
   EXPECT_EQ(input1.num_rows(), spark_output1->size());
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(spark_output1->view(), spark_output2->view());
+
+  auto const xxhash64_output1 = cudf::hash(input1, cudf::hash_id::HASH_XXHASH64, {}, 0);
+  auto const xxhash64_output2 = cudf::hash(input2, cudf::hash_id::HASH_XXHASH64);
+
+  EXPECT_EQ(input1.num_rows(), xxhash64_output1->size());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(xxhash64_output1->view(), xxhash64_output2->view());
 }
 
 template <typename T>
@@ -451,6 +457,74 @@ TEST_F(SparkMurmurHash3Test, ListThrows)
     cudf::logic_error);
 }
 
+class XXHash64Test : public cudf::test::BaseFixture {
+};
+
+TEST_F(XXHash64Test, MultiValueWithSeeds)
+{
+  // The hash values were determined by running the reference xxHash64 implementation on the host
+  fixed_width_column_wrapper<int64_t> const strings_col_result({-4369874336550183780,
+                                                                -719229648235761015,
+                                                                -8226313052879812579,
+                                                                5233279012148278091,
+                                                                460863295879185677});
+  fixed_width_column_wrapper<int64_t> const ints_col_result({3614696996920510707,
+                                                             -7987742665087449293,
+                                                             8990748234399402673,
+                                                             2073849959933241805,
+                                                             1508894993788531228});
+
+  strings_column_wrapper const strings_col({"",
+                                            "The quick brown fox",
+                                            "jumps over the lazy dog.",
+                                            "All work and no play makes Jack a dull boy",
+                                            "!\"#$%&\'()*+,-./0123456789:;<=>?@[\\]^_`{|}~"});
+
+  using limits = std::numeric_limits<int32_t>;
+  fixed_width_column_wrapper<int32_t> const ints_col({0, 100, -100, limits::min(), limits::max()});
+
+  // Different truth values should be equal
+  fixed_width_column_wrapper<bool> const bools_col1({0, 1, 1, 1, 0});
+  fixed_width_column_wrapper<bool> const bools_col2({0, 1, 2, 255, 0});
+
+  auto const combo1 = cudf::table_view({strings_col, ints_col, bools_col1});
+  auto const combo2 = cudf::table_view({strings_col, ints_col, bools_col2});
+
+  constexpr auto hasher   = cudf::hash_id::HASH_XXHASH64;
+  auto const strings_hash = cudf::hash(cudf::table_view({strings_col}), hasher, {}, 314);
+  auto const ints_hash    = cudf::hash(cudf::table_view({ints_col}), hasher, {}, 42);
+  auto const combo1_hash  = cudf::hash(combo1, hasher, {});
+  auto const combo2_hash  = cudf::hash(combo2, hasher, {});
+
+  EXPECT_EQ(cudf::type_id::INT64, strings_hash->type().id());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*strings_hash, strings_col_result, verbosity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*ints_hash, ints_col_result, verbosity);
+  EXPECT_EQ(combo1.num_rows(), combo1_hash->size());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*combo1_hash, *combo2_hash, verbosity);
+}
+
+TEST_F(XXHash64Test, WideTable)
+{
+  // More key columns than the fused row hasher supports; exercises the generic fallback
+  fixed_width_column_wrapper<int32_t> const ints_col({0, 100, -100, 0, 100});
+  std::vector<cudf::column_view> cols(8, ints_col);
+
+  auto const output = cudf::hash(cudf::table_view(cols), cudf::hash_id::HASH_XXHASH64, {});
+
+  EXPECT_EQ(cudf::column_view(ints_col).size(), output->size());
+  auto const rows = cudf::test::to_host<int64_t>(output->view()).first;
+  EXPECT_EQ(rows[0], rows[3]);
+  EXPECT_EQ(rows[1], rows[4]);
+  EXPECT_NE(rows[0], rows[1]);
+}
+
+TEST_F(XXHash64Test, ListThrows)
+{
+  lists_column_wrapper<cudf::string_view> strings_list_col({{""}, {"abc"}, {"123"}});
+  EXPECT_THROW(cudf::hash(cudf::table_view({strings_list_col}), cudf::hash_id::HASH_XXHASH64, {}),
+               cudf::logic_error);
+}
+
 class MD5HashTest : public cudf::test::BaseFixture {
 };
 
@@ -714,4 +788,55 @@ TYPED_TEST(MD5HashTestFloatTyped, TestListExtremes)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(output1->view(), output2->view(), verbosity);
 }
 
+class TableChecksumTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(TableChecksumTest, EqualTablesEqualChecksums)
+{
+  fixed_width_column_wrapper<int32_t> const col1({1, 2, 3, 4}, {1, 1, 0, 1});
+  strings_column_wrapper const col2({"a", "bc", "", "def"});
+  fixed_width_column_wrapper<int32_t> const col3({1, 2, 3, 4}, {1, 1, 0, 1});
+  strings_column_wrapper const col4({"a", "bc", "", "def"});
+
+  auto const input1 = cudf::table_view({col1, col2});
+  auto const input2 = cudf::table_view({col3, col4});
+
+  EXPECT_EQ(cudf::table_checksum(input1), cudf::table_checksum(input2));
+  EXPECT_EQ(cudf::table_checksum(input1, 42), cudf::table_checksum(input2, 42));
+}
+
+TEST_F(TableChecksumTest, SensitiveToContentOrderValidityAndSeed)
+{
+  fixed_width_column_wrapper<int32_t> const col({1, 2, 3, 4});
+  fixed_width_column_wrapper<int32_t> const changed_value({1, 2, 5, 4});
+  fixed_width_column_wrapper<int32_t> const reordered({2, 1, 3, 4});
+  fixed_width_column_wrapper<int32_t> const changed_validity({1, 2, 3, 4}, {1, 1, 0, 1});
+
+  auto const base = cudf::table_checksum(cudf::table_view({col}));
+
+  EXPECT_NE(base, cudf::table_checksum(cudf::table_view({changed_value})));
+  EXPECT_NE(base, cudf::table_checksum(cudf::table_view({reordered})));
+  EXPECT_NE(base, cudf::table_checksum(cudf::table_view({changed_validity})));
+  EXPECT_NE(base, cudf::table_checksum(cudf::table_view({col}), 42));
+}
+
+TEST_F(TableChecksumTest, EmptyTablesDifferBySchema)
+{
+  fixed_width_column_wrapper<int32_t> const int_col{};
+  fixed_width_column_wrapper<int64_t> const bigint_col{};
+
+  EXPECT_EQ(cudf::table_checksum(cudf::table_view({int_col})),
+            cudf::table_checksum(cudf::table_view({int_col})));
+  EXPECT_NE(cudf::table_checksum(cudf::table_view({int_col})),
+            cudf::table_checksum(cudf::table_view({bigint_col})));
+  EXPECT_NE(cudf::table_checksum(cudf::table_view({})),
+            cudf::table_checksum(cudf::table_view({int_col})));
+}
+
+TEST_F(TableChecksumTest, ListThrows)
+{
+  lists_column_wrapper<cudf::string_view> strings_list_col({{""}, {"abc"}, {"123"}});
+  EXPECT_THROW(cudf::table_checksum(cudf::table_view({strings_list_col})), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
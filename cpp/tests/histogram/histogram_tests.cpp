@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/histogram.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <limits>
+
+namespace {
+
+template <typename T>
+using fwc_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+
+struct HistogramTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(HistogramTest, BasicEdges)
+{
+  fwc_wrapper<int32_t> input{1, 2, 3, 4, 5, 9, 10};
+  fwc_wrapper<int32_t> edges{0, 5, 10};
+
+  // the last bin includes its right edge
+  fwc_wrapper<cudf::size_type> expected{4, 3};
+
+  auto const counts = cudf::histogram(input, edges);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, counts->view());
+}
+
+TEST_F(HistogramTest, IgnoresNullsNaNsAndOutOfRange)
+{
+  auto const nan = std::numeric_limits<double>::quiet_NaN();
+  fwc_wrapper<double> input({-1.0, 0.0, 1.0, nan, 2.5, 7.0, 11.0}, {1, 1, 0, 1, 1, 1, 1});
+  fwc_wrapper<double> edges{0.0, 5.0, 10.0};
+
+  fwc_wrapper<cudf::size_type> expected{2, 1};
+
+  auto const counts = cudf::histogram(input, edges);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, counts->view());
+}
+
+TEST_F(HistogramTest, ComputedEdges)
+{
+  auto values_it = thrust::make_counting_iterator(0);
+  fwc_wrapper<int32_t> input(values_it, values_it + 10);
+
+  fwc_wrapper<double> expected_edges{0.0, 4.5, 9.0};
+  fwc_wrapper<cudf::size_type> expected_counts{5, 5};
+
+  auto const [edges, counts] = cudf::histogram(input, cudf::size_type{2});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_edges, edges->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_counts, counts->view());
+}
+
+TEST_F(HistogramTest, ComputedEdgesConstantColumn)
+{
+  fwc_wrapper<int32_t> input{3, 3, 3, 3, 3};
+
+  // a constant column spans [minimum, minimum + 1) so every element lands in the first bin
+  fwc_wrapper<double> expected_edges{3.0, 3.5, 4.0};
+  fwc_wrapper<cudf::size_type> expected_counts{5, 0};
+
+  auto const [edges, counts] = cudf::histogram(input, cudf::size_type{2});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_edges, edges->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_counts, counts->view());
+}
+
+TEST_F(HistogramTest, Errors)
+{
+  fwc_wrapper<int32_t> input{1, 2, 3};
+  fwc_wrapper<double> mismatched_edges{0.0, 5.0};
+  EXPECT_THROW(cudf::histogram(input, mismatched_edges), cudf::logic_error);
+
+  fwc_wrapper<int32_t> single_edge{0};
+  EXPECT_THROW(cudf::histogram(input, single_edge), cudf::logic_error);
+
+  fwc_wrapper<int32_t> null_edges({0, 5}, {1, 0});
+  EXPECT_THROW(cudf::histogram(input, null_edges), cudf::logic_error);
+
+  EXPECT_THROW(cudf::histogram(input, cudf::size_type{0}), cudf::logic_error);
+
+  cudf::test::strings_column_wrapper strings{"a", "b"};
+  EXPECT_THROW(cudf::histogram(strings, cudf::size_type{2}), cudf::logic_error);
+}
+
+struct ValueCountsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ValueCountsTest, LowCardinality)
+{
+  fwc_wrapper<int32_t> input{1, 2, 2, 3, 3, 3};
+
+  fwc_wrapper<int32_t> expected_values{1, 2, 3};
+  fwc_wrapper<cudf::size_type> expected_counts{1, 2, 3};
+
+  auto const [values, counts] = cudf::value_counts(input);
+
+  // the element order of the result is unspecified
+  auto const sort_order     = cudf::sorted_order(cudf::table_view({values->view()}));
+  auto const sorted_results = cudf::gather(
+    cudf::table_view({values->view(), counts->view()}), sort_order->view());
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_values, sorted_results->view().column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_counts, sorted_results->view().column(1));
+}
+
+TEST_F(ValueCountsTest, NullHandling)
+{
+  fwc_wrapper<int32_t> input({1, 1, 0, 0}, {1, 1, 0, 0});
+
+  // nulls excluded by default
+  auto const [values, counts] = cudf::value_counts(input);
+  EXPECT_EQ(values->size(), 1);
+
+  // including them produces a count for the null group
+  auto const [values_with_null, counts_with_null] =
+    cudf::value_counts(input, cudf::null_policy::INCLUDE);
+  EXPECT_EQ(values_with_null->size(), 2);
+}
+
+}  // anonymous namespace
+
+CUDF_TEST_PROGRAM_MAIN()
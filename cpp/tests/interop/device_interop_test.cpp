@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/interop.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+#include <cudf_test/type_lists.hpp>
+
+struct DeviceInteropTest : public cudf::test::BaseFixture {
+};
+
+std::shared_ptr<cudf::table> make_device_interop_table()
+{
+  auto int_col = cudf::test::fixed_width_column_wrapper<int32_t>(
+    {1, 2, 5, 2, 7}, {true, false, true, true, true});
+  auto double_col = cudf::test::fixed_width_column_wrapper<double>({1., 2., 3., 4., 5.});
+  auto string_col = cudf::test::strings_column_wrapper(
+    {"fff", "aaa", "", "fff", "ccc"}, {true, true, true, false, true});
+  return std::make_shared<cudf::table>(
+    cudf::table_view({int_col, double_col, string_col}));
+}
+
+TEST_F(DeviceInteropTest, ToArrowDeviceSharesBuffers)
+{
+  auto const table       = make_device_interop_table();
+  auto const arrow_table = cudf::to_arrow_device(table, {{"a"}, {"b"}, {"c"}});
+
+  EXPECT_EQ(arrow_table->num_columns(), 3);
+  EXPECT_EQ(arrow_table->num_rows(), table->num_rows());
+
+  // buffers must point at the table's device memory, not a copy
+  auto const& int_data = arrow_table->column(0)->chunk(0)->data();
+  EXPECT_EQ(int_data->buffers[1]->data(),
+            reinterpret_cast<uint8_t const*>(table->view().column(0).head<uint8_t>()));
+  EXPECT_EQ(int_data->buffers[0]->data(),
+            reinterpret_cast<uint8_t const*>(table->view().column(0).null_mask()));
+}
+
+TEST_F(DeviceInteropTest, RoundTrip)
+{
+  auto const table       = make_device_interop_table();
+  auto const arrow_table = cudf::to_arrow_device(table, {{"a"}, {"b"}, {"c"}});
+  auto const result      = cudf::from_arrow_device(*arrow_table);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result, table->view());
+}
+
+TEST_F(DeviceInteropTest, UnsupportedTypes)
+{
+  auto bool_col = cudf::test::fixed_width_column_wrapper<bool>({true, false, true});
+  auto bool_table =
+    std::make_shared<cudf::table>(cudf::table_view({bool_col}));
+  EXPECT_THROW(cudf::to_arrow_device(bool_table, {{"a"}}), cudf::logic_error);
+
+  auto list_col = cudf::test::lists_column_wrapper<int32_t>({{1, 2}, {3}, {4, 5, 6}});
+  auto list_table =
+    std::make_shared<cudf::table>(cudf::table_view({list_col}));
+  EXPECT_THROW(cudf::to_arrow_device(list_table, {{"a"}}), cudf::logic_error);
+}
+
+TEST_F(DeviceInteropTest, MetadataSizeMismatch)
+{
+  auto const table = make_device_interop_table();
+  EXPECT_THROW(cudf::to_arrow_device(table, {{"a"}}), cudf::logic_error);
+}
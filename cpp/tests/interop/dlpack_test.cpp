@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/copying.hpp>
 #include <cudf/interop.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -206,6 +207,27 @@ TEST_F(DLPackUntypedTests, UnsupportedLanesFromDlpack)
   EXPECT_THROW(cudf::from_dlpack(tensor.get()), cudf::logic_error);
 }
 
+TEST_F(DLPackUntypedTests, EmptyColumnToDlpackView)
+{
+  fixed_width_column_wrapper<int32_t> col({});
+  EXPECT_EQ(nullptr, cudf::to_dlpack_view(static_cast<cudf::column_view>(col)));
+}
+
+TEST_F(DLPackUntypedTests, InvalidNullsToDlpackView)
+{
+  fixed_width_column_wrapper<int32_t> col({1, 2, 3, 4}, {1, 0, 1, 1});
+  EXPECT_THROW(cudf::to_dlpack_view(static_cast<cudf::column_view>(col)), cudf::logic_error);
+}
+
+TEST_F(DLPackUntypedTests, NonUniformStrideToDlpackView)
+{
+  // Overlapping slices are not spaced by at least a full column of elements
+  fixed_width_column_wrapper<int32_t> col({1, 2, 3, 4, 5, 6});
+  auto const slices = cudf::slice(static_cast<cudf::column_view>(col), {0, 4, 2, 6});
+  cudf::table_view input(slices);
+  EXPECT_THROW(cudf::to_dlpack_view(input), cudf::logic_error);
+}
+
 template <typename T>
 class DLPackTimestampTests : public BaseFixture {
 };
@@ -296,6 +318,55 @@ TYPED_TEST(DLPackNumericTests, ToDlpack2D)
   }
 }
 
+TYPED_TEST(DLPackNumericTests, ToDlpackView1D)
+{
+  fixed_width_column_wrapper<TypeParam> col({1, 2, 3, 4});
+  auto const col_view = static_cast<cudf::column_view>(col);
+  unique_managed_tensor result(cudf::to_dlpack_view(col_view));
+
+  auto const& tensor = result->dl_tensor;
+  validate_dtype<TypeParam>(tensor.dtype);
+  EXPECT_EQ(kDLCUDA, tensor.device.device_type);
+  EXPECT_EQ(1, tensor.ndim);
+  EXPECT_EQ(uint64_t{0}, tensor.byte_offset);
+  EXPECT_EQ(nullptr, tensor.strides);
+
+  // The tensor must share the column's device buffer, not copy it
+  EXPECT_EQ(col_view.head<void>(), tensor.data);
+
+  cudf::column_view const result_view(col_view.type(), tensor.shape[0], tensor.data, nullptr);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(col_view, result_view);
+}
+
+TYPED_TEST(DLPackNumericTests, ToDlpackView2D)
+{
+  // Slices of one column are equally spaced in device memory, so they can be
+  // viewed as a single strided tensor
+  fixed_width_column_wrapper<TypeParam> col({1, 2, 3, 4, 5, 6, 7, 8});
+  auto const col_view = static_cast<cudf::column_view>(col);
+  auto const slices   = cudf::slice(col_view, {0, 4, 4, 8});
+  cudf::table_view input(slices);
+  unique_managed_tensor result(cudf::to_dlpack_view(input));
+
+  auto const& tensor = result->dl_tensor;
+  validate_dtype<TypeParam>(tensor.dtype);
+  EXPECT_EQ(kDLCUDA, tensor.device.device_type);
+  EXPECT_EQ(2, tensor.ndim);
+  EXPECT_EQ(col_view.head<void>(), tensor.data);
+  EXPECT_EQ(4, tensor.shape[0]);
+  EXPECT_EQ(2, tensor.shape[1]);
+  EXPECT_EQ(1, tensor.strides[0]);
+  EXPECT_EQ(4, tensor.strides[1]);
+
+  // Verify that data matches input columns
+  cudf::size_type offset{0};
+  for (auto const& in_col : input) {
+    cudf::column_view const result_view(col_view.type(), tensor.shape[0], tensor.data, nullptr, 0, offset);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(in_col, result_view);
+    offset += tensor.strides[1];
+  }
+}
+
 TYPED_TEST(DLPackNumericTests, FromDlpack1D)
 {
   // Use to_dlpack to generate an input tensor
@@ -21,6 +21,7 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/concatenate.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/csv.hpp>
@@ -2198,4 +2199,73 @@ TEST_F(CsvReaderTest, DtypesMapInvalid)
   EXPECT_THROW(cudf_io::read_csv(in_opts), cudf::logic_error);
 }
 
+TEST_F(CsvReaderTest, SampledTypeInference)
+{
+  constexpr auto num_rows = 100;
+  std::ostringstream csv_data;
+  for (int i = 0; i < num_rows; ++i) {
+    csv_data << i << "," << (i + 0.5) << "\n";
+  }
+  auto const csv_buffer = csv_data.str();
+
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(
+      cudf_io::source_info{csv_buffer.c_str(), csv_buffer.size()})
+      .header(-1)
+      .num_inference_rows(10);
+  auto const result = cudf_io::read_csv(in_opts);
+
+  // Types are inferred from the sample, but every row is read
+  auto const view = result.tbl->view();
+  ASSERT_EQ(view.num_columns(), 2);
+  EXPECT_EQ(view.column(0).type(), data_type{type_id::INT64});
+  EXPECT_EQ(view.column(1).type(), data_type{type_id::FLOAT64});
+  EXPECT_EQ(view.num_rows(), num_rows);
+}
+
+TEST_F(CsvReaderTest, ChunkedRead)
+{
+  constexpr auto num_rows = 25;
+  auto int64_values       = random_values<int64_t>(num_rows);
+  auto float64_values     = random_values<double>(num_rows);
+
+  auto filepath = temp_env->get_temp_dir() + "ChunkedRead.csv";
+  {
+    std::ostringstream line;
+    for (int i = 0; i < num_rows; ++i) {
+      line << int64_values[i] << "," << float64_values[i] << "\n";
+    }
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << line.str();
+  }
+
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{filepath})
+      .header(-1)
+      .dtypes({dtype<int64_t>(), dtype<double>()});
+  auto const full = cudf_io::read_csv(in_opts);
+
+  auto reader = cudf_io::chunked_csv_reader(10, in_opts);
+  std::vector<std::unique_ptr<table>> chunks;
+  while (reader.has_next()) {
+    chunks.emplace_back(std::move(reader.read_chunk().tbl));
+  }
+  ASSERT_EQ(chunks.size(), 3);
+  EXPECT_EQ(chunks[0]->num_rows(), 10);
+  EXPECT_EQ(chunks[1]->num_rows(), 10);
+  EXPECT_EQ(chunks[2]->num_rows(), 5);
+
+  std::vector<table_view> chunk_views;
+  std::transform(chunks.cbegin(), chunks.cend(), std::back_inserter(chunk_views), [](auto& chunk) {
+    return chunk->view();
+  });
+  auto const concatenated = cudf::concatenate(chunk_views);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(full.tbl->view(), concatenated->view());
+
+  // Reading past the end yields an empty table with the same columns
+  auto const empty = reader.read_chunk();
+  EXPECT_EQ(empty.tbl->num_rows(), 0);
+  EXPECT_EQ(empty.tbl->num_columns(), 2);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <cudf/io/datasource.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+// Base test fixture for tests
+struct DatasourceCacheTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+
+std::string write_test_file(std::string const& name, size_t size)
+{
+  std::vector<char> content(size);
+  std::iota(content.begin(), content.end(), 0);
+  auto const file_name = temp_env->get_temp_dir() + name;
+  std::ofstream outfile(file_name, std::ofstream::out | std::ofstream::binary);
+  outfile.write(content.data(), content.size());
+  return file_name;
+}
+
+}  // namespace
+
+TEST_F(DatasourceCacheTest, HostReads)
+{
+  auto const file_size = size_t{1000};
+  auto const file_name = write_test_file("cached_host_reads", file_size);
+
+  auto uncached = cudf::io::datasource::create(file_name);
+  auto cached   = cudf::io::datasource::create_cached(
+    cudf::io::datasource::create(file_name), 4 * 64, 64);
+
+  EXPECT_EQ(cached->size(), file_size);
+
+  // Reads within a block, across blocks, and past EOF; repeated to exercise cache hits
+  std::vector<std::pair<size_t, size_t>> const ranges{{0, 16}, {60, 8}, {0, 500}, {900, 200}};
+  for (int repeat = 0; repeat < 2; ++repeat) {
+    for (auto const& [offset, size] : ranges) {
+      auto const expected = uncached->host_read(offset, size);
+      auto const result   = cached->host_read(offset, size);
+      ASSERT_EQ(expected->size(), result->size());
+      EXPECT_EQ(0, std::memcmp(expected->data(), result->data(), result->size()));
+
+      std::vector<uint8_t> read_buffer(size);
+      auto const bytes_read = cached->host_read(offset, size, read_buffer.data());
+      ASSERT_EQ(expected->size(), bytes_read);
+      EXPECT_EQ(0, std::memcmp(expected->data(), read_buffer.data(), bytes_read));
+    }
+  }
+}
+
+TEST_F(DatasourceCacheTest, DeviceReads)
+{
+  auto const file_size = size_t{1000};
+  auto const file_name = write_test_file("cached_device_reads", file_size);
+
+  auto uncached = cudf::io::datasource::create(file_name);
+  auto cached   = cudf::io::datasource::create_cached(
+    cudf::io::datasource::create(file_name), 4 * 64, 64);
+
+  EXPECT_TRUE(cached->supports_device_read());
+
+  auto const expected = uncached->host_read(100, 300);
+  auto const d_result = cached->device_read(100, 300, rmm::cuda_stream_default);
+  ASSERT_EQ(expected->size(), d_result->size());
+
+  std::vector<uint8_t> h_result(d_result->size());
+  CUDA_TRY(cudaMemcpy(
+    h_result.data(), d_result->data(), d_result->size(), cudaMemcpyDeviceToHost));
+  EXPECT_EQ(0, std::memcmp(expected->data(), h_result.data(), h_result.size()));
+}
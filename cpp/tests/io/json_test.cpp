@@ -606,6 +606,101 @@ TEST_F(JsonReaderTest, JsonLinesObjectsOutOfOrder)
                                  cudf::test::strings_column_wrapper({"aaa", "bbb"}));
 }
 
+TEST_F(JsonReaderTest, JsonLinesObjectsSelectColumns)
+{
+  std::string const data =
+    "{\"col1\":100, \"col2\":1.1, \"col3\":\"aaa\", \"col4\":10}\n"
+    "{\"col1\":200, \"col2\":2.2, \"col3\":\"bbb\", \"col4\":20}\n";
+
+  cudf_io::json_reader_options in_options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{data.data(), data.size()})
+      .lines(true)
+      .use_cols_names({"col4", "col2"});
+
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_options);
+
+  // Columns are kept in the order in which they appear in the input
+  EXPECT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.tbl->num_rows(), 2);
+
+  EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::FLOAT64);
+  EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::type_id::INT64);
+
+  EXPECT_EQ(std::string(result.metadata.column_names[0]), "col2");
+  EXPECT_EQ(std::string(result.metadata.column_names[1]), "col4");
+
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return true; });
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), float64_wrapper{{1.1, 2.2}, validity});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(1), int64_wrapper{{10, 20}, validity});
+}
+
+TEST_F(JsonReaderTest, JsonLinesNestedObjects)
+{
+  std::string const data =
+    "{\"col1\":100, \"col2\":{\"nested1\":1.1, \"nested2\":\"aaa\"}, \"col3\":10}\n"
+    "{\"col1\":200, \"col2\":{\"nested1\":2.2, \"nested2\":\"bbb\"}, \"col3\":20}\n";
+
+  cudf_io::json_reader_options in_options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{data.data(), data.size()})
+      .lines(true)
+      .flatten_nested_objects(true);
+
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_options);
+
+  EXPECT_EQ(result.tbl->num_columns(), 4);
+  EXPECT_EQ(result.tbl->num_rows(), 2);
+
+  EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::INT64);
+  EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::type_id::FLOAT64);
+  EXPECT_EQ(result.tbl->get_column(2).type().id(), cudf::type_id::STRING);
+  EXPECT_EQ(result.tbl->get_column(3).type().id(), cudf::type_id::INT64);
+
+  EXPECT_EQ(std::string(result.metadata.column_names[0]), "col1");
+  EXPECT_EQ(std::string(result.metadata.column_names[1]), "col2.nested1");
+  EXPECT_EQ(std::string(result.metadata.column_names[2]), "col2.nested2");
+  EXPECT_EQ(std::string(result.metadata.column_names[3]), "col3");
+
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return true; });
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), int64_wrapper{{100, 200}, validity});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(1), float64_wrapper{{1.1, 2.2}, validity});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(2),
+                                 cudf::test::strings_column_wrapper({"aaa", "bbb"}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(3), int64_wrapper{{10, 20}, validity});
+}
+
+TEST_F(JsonReaderTest, JsonLinesNestedObjectsDeeperLevels)
+{
+  // Only one level of nesting is flattened; deeper values are read as strings
+  std::string const data =
+    "{\"col1\":{\"nested\":{\"deep\":1, \"deeper\":2}}, \"col2\":100}\n"
+    "{\"col1\":{\"nested\":{\"deep\":3, \"deeper\":4}}, \"col2\":200}\n";
+
+  cudf_io::json_reader_options in_options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{data.data(), data.size()})
+      .lines(true)
+      .flatten_nested_objects(true);
+
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_options);
+
+  EXPECT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.tbl->num_rows(), 2);
+
+  EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::STRING);
+  EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::type_id::INT64);
+
+  EXPECT_EQ(std::string(result.metadata.column_names[0]), "col1.nested");
+  EXPECT_EQ(std::string(result.metadata.column_names[1]), "col2");
+
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return true; });
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0),
+                                 cudf::test::strings_column_wrapper(
+                                   {"{\"deep\":1, \"deeper\":2}", "{\"deep\":3, \"deeper\":4}"}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(1), int64_wrapper{{100, 200}, validity});
+}
+
 /*
 // currently, the json reader is strict about having non-empty input.
 TEST_F(JsonReaderTest, EmptyFile)
@@ -22,6 +22,7 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
@@ -849,6 +850,70 @@ TEST_F(OrcChunkedWriterTest, ReadStripesError)
   EXPECT_THROW(cudf_io::read_orc(read_opts), cudf::logic_error);
 }
 
+TEST_F(OrcChunkedWriterTest, FilterStripes)
+{
+  auto seq1 = thrust::make_counting_iterator(0);
+  auto seq2 = thrust::make_counting_iterator(100);
+  column_wrapper<int> col1(seq1, seq1 + 100);
+  column_wrapper<int> col2(seq2, seq2 + 100);
+  table_view table1({col1});
+  table_view table2({col2});
+
+  // Each chunked-writer write() call produces (at least) one stripe
+  auto filepath = temp_env->get_temp_filepath("FilterStripes.orc");
+  cudf_io::chunked_orc_writer_options opts =
+    cudf_io::chunked_orc_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::orc_chunked_writer(opts).write(table1).write(table2);
+
+  // Only the second stripe can contain values >= 100
+  auto literal_value = cudf::numeric_scalar<int>(100);
+  auto literal       = cudf::ast::literal(literal_value);
+  auto col_ref       = cudf::ast::column_reference(0);
+  auto filter = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref, literal);
+
+  cudf_io::orc_reader_options read_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+  auto result = cudf_io::read_orc(read_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table2, result.tbl->view());
+}
+
+TEST_F(OrcChunkedWriterTest, ChunkedRead)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(5, 5, true);
+  auto table2 = create_random_fixed_table<int>(5, 5, true);
+  auto table3 = create_random_fixed_table<int>(5, 5, true);
+
+  auto full_table = cudf::concatenate(std::vector<table_view>({*table1, *table2, *table3}));
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedRead.orc");
+  cudf_io::chunked_orc_writer_options opts =
+    cudf_io::chunked_orc_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::orc_chunked_writer(opts).write(*table1).write(*table2).write(*table3);
+
+  // Read the file back one stripe at a time
+  cudf_io::orc_reader_options read_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath});
+  auto reader = cudf_io::chunked_orc_reader(1, read_opts);
+
+  std::vector<std::unique_ptr<table>> chunks;
+  std::vector<table_view> chunk_views;
+  while (reader.has_next()) {
+    chunks.push_back(std::move(reader.read_chunk().tbl));
+    chunk_views.push_back(chunks.back()->view());
+  }
+  EXPECT_EQ(chunks.size(), 3);
+
+  auto result = cudf::concatenate(chunk_views);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result, *full_table);
+
+  // Reading past the end yields an empty table with the same schema
+  auto empty = reader.read_chunk();
+  EXPECT_EQ(empty.tbl->num_columns(), full_table->num_columns());
+  EXPECT_EQ(empty.tbl->num_rows(), 0);
+}
+
 TYPED_TEST(OrcChunkedWriterNumericTypeTest, UnalignedSize)
 {
   // write out two 31 row tables and make sure they get
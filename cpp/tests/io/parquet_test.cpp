@@ -14,9 +14,12 @@
  * limitations under the License.
  */
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/parquet.hpp>
@@ -1901,6 +1904,37 @@ TEST_F(ParquetWriterTest, DecimalWrite)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table);
 }
 
+TEST_F(ParquetWriterTest, Decimal128Write)
+{
+  constexpr cudf::size_type num_rows = 500;
+  auto seq_col0                      = random_values<int64_t>(num_rows);
+
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 2 == 0; });
+
+  // decimal128 round trips through a 16-byte FIXED_LEN_BYTE_ARRAY
+  auto vals = std::vector<__int128_t>(seq_col0.begin(), seq_col0.end());
+  auto col0 = cudf::test::fixed_point_column_wrapper<__int128_t>{
+    vals.begin(), vals.end(), valids, numeric::scale_type{-5}};
+
+  auto table = table_view({col0});
+
+  auto filepath = temp_env->get_temp_filepath("Decimal128Write.parquet");
+  cudf_io::parquet_writer_options args =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, table);
+
+  cudf_io::table_input_metadata expected_metadata(table);
+  expected_metadata.column_metadata[0].set_decimal_precision(38);
+  args.set_metadata(&expected_metadata);
+  cudf_io::write_parquet(args);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto result = cudf_io::read_parquet(read_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table);
+}
+
 TYPED_TEST(ParquetChunkedWriterNumericTypeTest, UnalignedSize)
 {
   // write out two 31 row tables and make sure they get
@@ -3004,4 +3038,145 @@ TEST_F(ParquetReaderTest, EmptyOutput)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
 }
 
+TEST_F(ParquetReaderTest, FilterRowGroups)
+{
+  auto seq1 = thrust::make_counting_iterator(0);
+  auto seq2 = thrust::make_counting_iterator(100);
+  column_wrapper<int> col1(seq1, seq1 + 100);
+  column_wrapper<int> col2(seq2, seq2 + 100);
+  table_view table1({col1});
+  table_view table2({col2});
+
+  // Each chunked-writer write() call produces (at least) one row group
+  auto filepath = temp_env->get_temp_filepath("FilterRowGroups.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::parquet_chunked_writer(args).write(table1).write(table2);
+
+  // Only the second row group can contain values >= 100
+  auto literal_value = cudf::numeric_scalar<int>(100);
+  auto literal       = cudf::ast::literal(literal_value);
+  auto col_ref       = cudf::ast::column_reference(0);
+  auto filter = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref, literal);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+  auto result = cudf_io::read_parquet(read_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table2, result.tbl->view());
+}
+
+TEST_F(ParquetReaderTest, ChunkedRead)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(5, 1024, true);
+  auto table2 = create_random_fixed_table<int>(5, 1024, true);
+  auto table3 = create_random_fixed_table<int>(5, 1024, true);
+
+  auto full_table = cudf::concatenate(std::vector<table_view>({*table1, *table2, *table3}));
+
+  // Each chunked-writer write() call produces (at least) one row group
+  auto filepath = temp_env->get_temp_filepath("ChunkedRead.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::parquet_chunked_writer(args).write(*table1).write(*table2).write(*table3);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+
+  // A budget of one byte forces one row group per chunk
+  auto reader = cudf_io::chunked_parquet_reader(1, read_opts);
+
+  int num_chunks = 0;
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  while (reader.has_next()) {
+    chunks.push_back(std::move(reader.read_chunk().tbl));
+    num_chunks++;
+  }
+  EXPECT_EQ(num_chunks, 3);
+
+  std::vector<table_view> chunk_views;
+  std::transform(chunks.begin(), chunks.end(), std::back_inserter(chunk_views), [](auto const& t) {
+    return t->view();
+  });
+  auto read_table = cudf::concatenate(chunk_views);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*full_table, *read_table);
+
+  // Reading past the end yields empty tables with the same schema
+  auto empty = reader.read_chunk();
+  EXPECT_EQ(empty.tbl->num_columns(), full_table->num_columns());
+  EXPECT_EQ(empty.tbl->num_rows(), 0);
+}
+
+TEST_F(ParquetReaderTest, StringsToDictionary)
+{
+  std::vector<std::string> elements{"cats", "dogs", "fish", "dogs", "cats", "cats", "fish", "dogs"};
+  cudf::test::strings_column_wrapper col(elements.begin(), elements.end());
+  table_view expected({col});
+
+  auto filepath = temp_env->get_temp_filepath("StringsToDictionary.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected);
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .convert_strings_to_dictionaries(true);
+  auto result = cudf_io::read_parquet(read_opts);
+
+  // The column comes back as a dictionary built from the file's dictionary page
+  auto const& dict_col = result.tbl->view().column(0);
+  ASSERT_EQ(dict_col.type().id(), cudf::type_id::DICTIONARY32);
+  EXPECT_EQ(cudf::dictionary_column_view(dict_col).keys_size(), 3);
+
+  // Decoding the dictionary round-trips to the original strings
+  auto decoded = cudf::dictionary::decode(cudf::dictionary_column_view(dict_col));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(col, decoded->view());
+}
+
+TEST_F(ParquetReaderTest, FooterCache)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(4, 100, true);
+
+  auto filepath = temp_env->get_temp_filepath("FooterCache.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, *expected);
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .use_footer_cache(true);
+
+  // The first read populates the cache, the second one reuses the parsed footer
+  auto first  = cudf_io::read_parquet(read_opts);
+  auto second = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, first.tbl->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, second.tbl->view());
+}
+
+TEST_F(ParquetReaderTest, PageSizingCache)
+{
+  // Lists engage the page sizing pass, whose untrimmed results are cached alongside the footer
+  using lcw = cudf::test::lists_column_wrapper<int32_t>;
+  lcw col{{1, 2}, {3}, {}, {4, 5, 6}, {7}, {8, 9, 10, 11}, {}, {12}};
+  auto expected = table_view({col});
+
+  auto filepath = temp_env->get_temp_filepath("PageSizingCache.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected);
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .use_footer_cache(true);
+
+  // The first read populates the sizing cache, the second one skips the untrimmed sizing pass
+  auto first  = cudf_io::read_parquet(read_opts);
+  auto second = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, first.tbl->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, second.tbl->view());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -141,3 +141,37 @@ TEST_F(MultibyteSplitTest, HandpickedInput)
 
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out, debug_output_level::ALL_ERRORS);
 }
+
+TEST_F(MultibyteSplitTest, ByteRangeSeamResolution)
+{
+  auto delimiter  = std::string(":");
+  auto host_input = std::string("abc:defghij:kl:");
+
+  auto source = cudf::io::text::make_source(host_input);
+
+  // row "defghij:" begins inside the first range and ends past it, so the first range scans past
+  // its end to the next delimiter and owns the row in full. the trailing empty row belongs to the
+  // range which reaches the end of the input.
+  auto expected_first  = strings_column_wrapper{"abc:", "defghij:"};
+  auto expected_second = strings_column_wrapper{"kl:", ""};
+
+  auto out_first  = cudf::io::text::multibyte_split(*source, delimiter, 0, 7);
+  auto out_second = cudf::io::text::multibyte_split(*source, delimiter, 7, 8);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_first, *out_first);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_second, *out_second);
+}
+
+TEST_F(MultibyteSplitTest, ByteRangeWithoutRows)
+{
+  auto delimiter  = std::string(":");
+  auto host_input = std::string("abcdefghij:kl");
+
+  auto source = cudf::io::text::make_source(host_input);
+
+  // no row begins within [2, 7), so the range owns nothing
+  auto out = cudf::io::text::multibyte_split(*source, delimiter, 2, 5);
+
+  EXPECT_EQ(out->size(), 0);
+  EXPECT_EQ(out->type().id(), cudf::type_id::STRING);
+}
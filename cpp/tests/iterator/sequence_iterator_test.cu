@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License
+ * is distributed on an "AS IS" BASIS,  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#include <tests/iterator/iterator_tests.cuh>
+
+using TestingTypes = cudf::test::NumericTypes;
+
+template <typename T>
+struct SequenceIteratorTest : public IteratorTest<T> {
+};
+
+TYPED_TEST_CASE(SequenceIteratorTest, TestingTypes);
+
+TYPED_TEST(SequenceIteratorTest, unit_step)
+{
+  using T = TypeParam;
+  T init  = cudf::test::make_type_param_scalar<T>(5);
+
+  // calculate the expected values by CPU.
+  thrust::host_vector<T> host_values(100);
+  std::generate(host_values.begin(), host_values.end(), [v = init]() mutable {
+    auto cur = v;
+    v        = static_cast<T>(v + T{1});
+    return cur;
+  });
+
+  // GPU test
+  auto it_dev = cudf::detail::make_sequence_iterator(init);
+  this->iterator_test_thrust(host_values, it_dev, host_values.size());
+}
+
+TYPED_TEST(SequenceIteratorTest, custom_step)
+{
+  using T      = TypeParam;
+  T const init = cudf::test::make_type_param_scalar<T>(2);
+  T const step = cudf::test::make_type_param_scalar<T>(3);
+
+  // calculate the expected values by CPU.
+  thrust::host_vector<T> host_values(100);
+  std::generate(host_values.begin(), host_values.end(), [v = init, step]() mutable {
+    auto cur = v;
+    v        = static_cast<T>(v + step);
+    return cur;
+  });
+
+  // GPU test
+  auto it_dev = cudf::detail::make_sequence_iterator(init, step);
+  this->iterator_test_thrust(host_values, it_dev, host_values.size());
+}
@@ -415,6 +415,68 @@ TYPED_TEST(ConditionalInnerJoinTest, TestGreaterComparison)
   this->test({{0, 1, 2}}, {{1, 0, 0}}, expression, {{1, 1}, {1, 2}, {2, 0}, {2, 1}, {2, 2}});
 };
 
+TYPED_TEST(ConditionalInnerJoinTest, TestGreaterComparisonSortedRight)
+{
+  // The right column is sorted, so the ordered comparison is range-pruned by binary search
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_0, col_ref_1);
+
+  this->test({{0, 1, 2}}, {{0, 0, 1}}, expression, {{1, 0}, {1, 1}, {2, 0}, {2, 1}, {2, 2}});
+};
+
+TYPED_TEST(ConditionalInnerJoinTest, TestIntervalBandSortedRight)
+{
+  // Interval-style condition: left - 1 <= right <= left, expressed as an AND of two ordered
+  // comparisons against a sorted right column; only the first conjunct is range-pruned
+  auto col_ref_left  = cudf::ast::column_reference(0, cudf::ast::table_reference::LEFT);
+  auto col_ref_right = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto upper =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref_left, col_ref_right);
+  auto lower = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_left, col_ref_right);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, upper, lower);
+
+  this->test({{0, 2, 4}}, {{0, 1, 2, 3, 4}}, expression, {});
+
+  auto band = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_left, col_ref_right);
+  auto expression2 = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, upper, band);
+  this->test({{1, 3}}, {{0, 1, 2, 3}}, expression2, {{0, 0}, {1, 0}, {1, 1}, {1, 2}});
+};
+
+TYPED_TEST(ConditionalInnerJoinTest, TestLargeSampledSizeUnderestimate)
+{
+  // A left table large enough to trigger the sampled output size estimate,
+  // with the matching rows placed off the sampling stride so the estimate
+  // comes up empty and the join must detect the overflow and rerun with the
+  // exact size.
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_0, col_ref_1);
+
+  std::vector<TypeParam> left_data(40000, TypeParam{5});
+  left_data[1]  = TypeParam{0};
+  left_data[33] = TypeParam{0};
+  this->test({left_data}, {{1}}, expression, {{1, 0}, {33, 0}});
+};
+
+TYPED_TEST(ConditionalInnerJoinTest, TestLargeSampledSizeOverestimate)
+{
+  // A left table large enough to trigger the sampled output size estimate,
+  // with all matching rows on the sampling stride so the scaled-up estimate
+  // exceeds the true output size and the result must be trimmed back down.
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_0, col_ref_1);
+
+  std::vector<TypeParam> left_data(40000, TypeParam{5});
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> expected;
+  for (cudf::size_type i = 0; i < 40000; i += 32) {
+    left_data[i] = TypeParam{0};
+    expected.push_back({i, 0});
+  }
+  this->test({left_data}, {{1}}, expression, expected);
+};
+
 TYPED_TEST(ConditionalInnerJoinTest, TestGreaterTwoColumnComparison)
 {
   auto col_ref_0  = cudf::ast::column_reference(0);
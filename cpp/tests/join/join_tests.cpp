@@ -1355,6 +1355,264 @@ TEST_F(JoinTest, HashJoinSequentialProbes)
   }
 }
 
+TEST_F(JoinTest, HashJoinSerializedHashTable)
+{
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{{2, 2, 0, 4, 3}}.release());
+  cols1.emplace_back(strcol_wrapper{{"s1", "s0", "s1", "s2", "s1"}}.release());
+
+  Table t1(std::move(cols1));
+
+  cudf::hash_join hash_join(t1, cudf::null_equality::EQUAL);
+
+  // Round-trip the built hash table and probe with the reconstructed object
+  auto const serialized = hash_join.serialize_hash_table();
+  EXPECT_GT(serialized.size(), 0);
+  cudf::hash_join deserialized_join(
+    t1,
+    cudf::device_span<uint8_t const>{static_cast<uint8_t const*>(serialized.data()),
+                                     serialized.size()});
+
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{3, 1, 2, 0, 2}}.release());
+  cols0.emplace_back(strcol_wrapper({"s1", "s1", "s0", "s4", "s0"}).release());
+
+  Table t0(std::move(cols0));
+
+  EXPECT_EQ(hash_join.inner_join_size(t0), deserialized_join.inner_join_size(t0));
+
+  auto result = deserialized_join.inner_join(t0);
+  column_wrapper<int32_t> col_gold_0{{2, 4, 0}};
+  column_wrapper<int32_t> col_gold_1{{1, 1, 4}};
+  auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+}
+
+TEST_F(JoinTest, HashJoinSerializedHashTableEmptyBuild)
+{
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{}.release());
+
+  Table t1(std::move(cols1));
+
+  cudf::hash_join hash_join(t1, cudf::null_equality::EQUAL);
+
+  auto const serialized = hash_join.serialize_hash_table();
+  EXPECT_EQ(serialized.size(), 0);
+  cudf::hash_join deserialized_join(t1, cudf::device_span<uint8_t const>{});
+
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{3, 1, 2}}.release());
+
+  Table t0(std::move(cols0));
+
+  EXPECT_EQ(deserialized_join.inner_join_size(t0), 0);
+}
+
+TEST_F(JoinTest, SortedMergeInnerJoin)
+{
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{0, 1, 2, 2, 3}}.release());
+  Table t0(std::move(cols0));
+
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{{1, 2, 2, 4}}.release());
+  Table t1(std::move(cols1));
+
+  auto result = cudf::sorted_merge_inner_join(t0, t1);
+
+  column_wrapper<int32_t> col_gold_0{{1, 2, 2, 3, 3}};
+  column_wrapper<int32_t> col_gold_1{{0, 1, 2, 1, 2}};
+  auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+}
+
+TEST_F(JoinTest, SortedMergeInnerJoinMultiColumn)
+{
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{0, 1, 1, 2}}.release());
+  cols0.emplace_back(strcol_wrapper({"s0", "s0", "s1", "s2"}).release());
+  Table t0(std::move(cols0));
+
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{{1, 1, 2, 3}}.release());
+  cols1.emplace_back(strcol_wrapper({"s0", "s1", "s0", "s1"}).release());
+  Table t1(std::move(cols1));
+
+  auto result = cudf::sorted_merge_inner_join(t0, t1);
+
+  column_wrapper<int32_t> col_gold_0{{1, 2}};
+  column_wrapper<int32_t> col_gold_1{{0, 1}};
+  auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+}
+
+TEST_F(JoinTest, SortedMergeInnerJoinEmpty)
+{
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{0, 1, 2}}.release());
+  Table t0(std::move(cols0));
+
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{}.release());
+  Table t1(std::move(cols1));
+
+  auto result = cudf::sorted_merge_inner_join(t0, t1);
+  EXPECT_EQ(result.first->size(), 0);
+  EXPECT_EQ(result.second->size(), 0);
+}
+
+TEST_F(JoinTest, GraceHashInnerJoin)
+{
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{3, 1, 2, 0, 3}}.release());
+  cols0.emplace_back(strcol_wrapper({"s0", "s1", "s2", "s4", "s1"}).release());
+  Table t0(std::move(cols0));
+
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{{2, 2, 0, 4, 3}}.release());
+  cols1.emplace_back(strcol_wrapper({"s1", "s0", "s1", "s2", "s1"}).release());
+  Table t1(std::move(cols1));
+
+  // Must match a regular inner join regardless of the partition count
+  for (auto num_partitions : {1, 4}) {
+    auto result    = cudf::grace_hash_inner_join(t0, t1, num_partitions);
+    auto reference = cudf::inner_join(t0, t1);
+
+    cudf::column_view ref_left{cudf::data_type{cudf::type_id::INT32},
+                               static_cast<cudf::size_type>(reference.first->size()),
+                               reference.first->data()};
+    cudf::column_view ref_right{cudf::data_type{cudf::type_id::INT32},
+                                static_cast<cudf::size_type>(reference.second->size()),
+                                reference.second->data()};
+    auto const [sorted_gold, sorted_result] = gather_maps_as_tables(ref_left, ref_right, result);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+  }
+}
+
+TEST_F(JoinTest, GraceHashInnerJoinEmpty)
+{
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{0, 1, 2}}.release());
+  Table t0(std::move(cols0));
+
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{}.release());
+  Table t1(std::move(cols1));
+
+  auto result = cudf::grace_hash_inner_join(t0, t1, 4);
+  EXPECT_EQ(result.first->size(), 0);
+  EXPECT_EQ(result.second->size(), 0);
+}
+
+TEST_F(JoinTest, DistributedInnerJoinSingleDevice)
+{
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{3, 1, 2, 0, 3}}.release());
+  cols0.emplace_back(strcol_wrapper({"s0", "s1", "s2", "s4", "s1"}).release());
+  Table t0(std::move(cols0));
+
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{{2, 2, 0, 4, 3}}.release());
+  cols1.emplace_back(strcol_wrapper({"s1", "s0", "s1", "s2", "s1"}).release());
+  Table t1(std::move(cols1));
+
+  auto result = cudf::distributed::inner_join({t0.view()}, {t1.view()}, {0, 1}, {0, 1});
+  ASSERT_EQ(result.size(), 1u);
+
+  auto reference = cudf::inner_join(t0, t1, {0, 1}, {0, 1});
+
+  auto result_sort_order = cudf::sorted_order(result.front()->view());
+  auto sorted_result     = cudf::gather(result.front()->view(), *result_sort_order);
+  auto gold_sort_order   = cudf::sorted_order(reference->view());
+  auto sorted_gold       = cudf::gather(reference->view(), *gold_sort_order);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+}
+
+TEST_F(JoinTest, DistributedInnerJoinMultiDevice)
+{
+  int device_count = 0;
+  CUDA_TRY(cudaGetDeviceCount(&device_count));
+  if (device_count < 2) { return; }
+
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{3, 1, 2, 0, 3}}.release());
+  Table t0(std::move(cols0));
+
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{{2, 2, 0, 4, 3}}.release());
+  Table t1(std::move(cols1));
+
+  // Reuse device 0's tables as both shards; unified addressing lets device 1
+  // read them, which is enough to exercise the exchange path.
+  auto result = cudf::distributed::inner_join(
+    {t0.view(), t0.view()}, {t1.view(), t1.view()}, {0}, {0});
+  ASSERT_EQ(result.size(), 2u);
+
+  // Joining two identical shards of each side must produce, in total, four
+  // copies of every pair in the single-table join.
+  auto reference        = cudf::inner_join(t0, t1, {0}, {0});
+  cudf::size_type total = 0;
+  for (auto const& part : result) {
+    total += part->num_rows();
+  }
+  EXPECT_EQ(total, 4 * reference->num_rows());
+}
+
+TEST_F(JoinTest, DistinctInnerJoin)
+{
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{0, 1, 2, 1}}.release());
+  Table t0(std::move(cols0));
+
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{{1, 2, 3}}.release());
+  Table t1(std::move(cols1));
+
+  auto result = cudf::distinct_inner_join(t0, t1);
+
+  column_wrapper<int32_t> col_gold_0{{1, 2, 3}};
+  column_wrapper<int32_t> col_gold_1{{0, 1, 0}};
+  auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+}
+
+TEST_F(JoinTest, DistinctLeftJoin)
+{
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{0, 1, 2}}.release());
+  Table t0(std::move(cols0));
+
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{{1, 2, 3}}.release());
+  Table t1(std::move(cols1));
+
+  auto result = cudf::distinct_left_join(t0, t1);
+
+  column_wrapper<int32_t> col_gold_0{{0, 1, 2}};
+  column_wrapper<int32_t> col_gold_1{{NoneValue, 0, 1}};
+  auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+}
+
+TEST_F(JoinTest, DistinctLeftJoinEmptyRight)
+{
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{0, 1, 2}}.release());
+  Table t0(std::move(cols0));
+
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{}.release());
+  Table t1(std::move(cols1));
+
+  auto result = cudf::distinct_left_join(t0, t1);
+
+  column_wrapper<int32_t> col_gold_0{{0, 1, 2}};
+  column_wrapper<int32_t> col_gold_1{{NoneValue, NoneValue, NoneValue}};
+  auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+}
+
 TEST_F(JoinTest, HashJoinWithStructsAndNulls)
 {
   auto col0_names_col = strcol_wrapper{
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using column_wrapper = cudf::test::fixed_width_column_wrapper<int32_t>;
+
+constexpr cudf::size_type JoinNoneValue = std::numeric_limits<cudf::size_type>::min();
+
+// Common column references.
+const auto col_ref_left_0  = cudf::ast::column_reference(0, cudf::ast::table_reference::LEFT);
+const auto col_ref_right_0 = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+
+// Copy the resulting gather maps to host and sort them pairwise for
+// order-insensitive comparison against the expected output.
+std::vector<std::pair<cudf::size_type, cudf::size_type>> sorted_result_pairs(
+  std::pair<std::unique_ptr<rmm::device_uvector<cudf::size_type>>,
+            std::unique_ptr<rmm::device_uvector<cudf::size_type>>> const& result)
+{
+  auto const size = result.first->size();
+  EXPECT_EQ(size, result.second->size());
+  std::vector<cudf::size_type> left_indices(size);
+  std::vector<cudf::size_type> right_indices(size);
+  CUDA_TRY(cudaMemcpy(left_indices.data(),
+                      result.first->data(),
+                      size * sizeof(cudf::size_type),
+                      cudaMemcpyDeviceToHost));
+  CUDA_TRY(cudaMemcpy(right_indices.data(),
+                      result.second->data(),
+                      size * sizeof(cudf::size_type),
+                      cudaMemcpyDeviceToHost));
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> pairs(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    pairs[i] = {left_indices[i], right_indices[i]};
+  }
+  std::sort(pairs.begin(), pairs.end());
+  return pairs;
+}
+
+}  // namespace
+
+struct MixedJoinTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(MixedJoinTest, MixedInnerJoin)
+{
+  // Equality keys match pairwise; the condition then filters the matches.
+  column_wrapper left_equality_col{0, 1, 2, 1};
+  column_wrapper right_equality_col{1, 2, 3};
+  column_wrapper left_conditional_col{10, 20, 30, 5};
+  column_wrapper right_conditional_col{15, 40, 0};
+
+  cudf::table_view left_equality{{left_equality_col}};
+  cudf::table_view right_equality{{right_equality_col}};
+  cudf::table_view left_conditional{{left_conditional_col}};
+  cudf::table_view right_conditional{{right_conditional_col}};
+
+  auto predicate =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_left_0, col_ref_right_0);
+
+  auto result = cudf::mixed_inner_join(
+    left_equality, right_equality, left_conditional, right_conditional, predicate);
+
+  // Equality matches: (1, 0), (3, 0), (2, 1). Only (1, 0) passes the
+  // condition left > right (20 > 15).
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> expected{{1, 0}};
+  EXPECT_EQ(sorted_result_pairs(result), expected);
+}
+
+TEST_F(MixedJoinTest, MixedInnerJoinAllConditionTrue)
+{
+  column_wrapper left_equality_col{0, 1, 2, 1};
+  column_wrapper right_equality_col{1, 2, 3};
+  column_wrapper left_conditional_col{10, 20, 30, 5};
+  column_wrapper right_conditional_col{0, 0, 0};
+
+  cudf::table_view left_equality{{left_equality_col}};
+  cudf::table_view right_equality{{right_equality_col}};
+  cudf::table_view left_conditional{{left_conditional_col}};
+  cudf::table_view right_conditional{{right_conditional_col}};
+
+  auto predicate =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_left_0, col_ref_right_0);
+
+  auto result = cudf::mixed_inner_join(
+    left_equality, right_equality, left_conditional, right_conditional, predicate);
+
+  // With an always-true condition the result is exactly the equality join.
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> expected{{1, 0}, {2, 1}, {3, 0}};
+  EXPECT_EQ(sorted_result_pairs(result), expected);
+}
+
+TEST_F(MixedJoinTest, MixedLeftJoin)
+{
+  column_wrapper left_equality_col{0, 1, 2};
+  column_wrapper right_equality_col{1, 2, 3};
+  column_wrapper left_conditional_col{10, 20, 30};
+  column_wrapper right_conditional_col{15, 40, 0};
+
+  cudf::table_view left_equality{{left_equality_col}};
+  cudf::table_view right_equality{{right_equality_col}};
+  cudf::table_view left_conditional{{left_conditional_col}};
+  cudf::table_view right_conditional{{right_conditional_col}};
+
+  auto predicate =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_left_0, col_ref_right_0);
+
+  auto result = cudf::mixed_left_join(
+    left_equality, right_equality, left_conditional, right_conditional, predicate);
+
+  // Row 1 matches (1, 0) and passes the condition (20 > 15); rows 0 and 2
+  // have no surviving match and join to null.
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> expected{
+    {0, JoinNoneValue}, {1, 0}, {2, JoinNoneValue}};
+  EXPECT_EQ(sorted_result_pairs(result), expected);
+}
+
+TEST_F(MixedJoinTest, MixedLeftJoinEmptyRight)
+{
+  column_wrapper left_equality_col{0, 1, 2};
+  column_wrapper right_equality_col{};
+  column_wrapper left_conditional_col{10, 20, 30};
+  column_wrapper right_conditional_col{};
+
+  cudf::table_view left_equality{{left_equality_col}};
+  cudf::table_view right_equality{{right_equality_col}};
+  cudf::table_view left_conditional{{left_conditional_col}};
+  cudf::table_view right_conditional{{right_conditional_col}};
+
+  auto predicate =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_left_0, col_ref_right_0);
+
+  auto result = cudf::mixed_left_join(
+    left_equality, right_equality, left_conditional, right_conditional, predicate);
+
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> expected{
+    {0, JoinNoneValue}, {1, JoinNoneValue}, {2, JoinNoneValue}};
+  EXPECT_EQ(sorted_result_pairs(result), expected);
+}
+
+TEST_F(MixedJoinTest, MixedInnerJoinRowCountMismatch)
+{
+  column_wrapper left_equality_col{0, 1, 2};
+  column_wrapper right_equality_col{1, 2, 3};
+  column_wrapper left_conditional_col{10, 20};
+  column_wrapper right_conditional_col{15, 40, 0};
+
+  cudf::table_view left_equality{{left_equality_col}};
+  cudf::table_view right_equality{{right_equality_col}};
+  cudf::table_view left_conditional{{left_conditional_col}};
+  cudf::table_view right_conditional{{right_conditional_col}};
+
+  auto predicate =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref_left_0, col_ref_right_0);
+
+  EXPECT_THROW(cudf::mixed_inner_join(
+                 left_equality, right_equality, left_conditional, right_conditional, predicate),
+               cudf::logic_error);
+}
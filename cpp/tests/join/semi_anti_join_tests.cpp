@@ -30,6 +30,9 @@
 
 #include <thrust/iterator/transform_iterator.h>
 
+#include <numeric>
+#include <vector>
+
 template <typename T>
 using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
 using strcol_wrapper = cudf::test::strings_column_wrapper;
@@ -215,3 +218,30 @@ TEST_F(JoinTest, AntiJoinWithStructsAndNullsNotEqual)
 
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
 }
+
+TEST_F(JoinTest, SemiAntiJoinLargeProbe)
+{
+  // A probe table much larger than the build table takes the Bloom-filtered
+  // probe path; the filter must never reject a true match.
+  std::vector<int32_t> left_data(100);
+  std::iota(left_data.begin(), left_data.end(), 0);
+
+  column_vector cols0, cols1;
+  cols0.push_back(column_wrapper<int32_t>(left_data.begin(), left_data.end()).release());
+  cols1.push_back(column_wrapper<int32_t>{{5, 7, 12}}.release());
+  Table t0(std::move(cols0));
+  Table t1(std::move(cols1));
+
+  auto semi_result = cudf::left_semi_join(t0, t1, {0}, {0});
+  auto semi_sort_order = cudf::sorted_order(semi_result->view());
+  auto sorted_semi     = cudf::gather(semi_result->view(), *semi_sort_order);
+
+  column_wrapper<int32_t> semi_gold_col{{5, 7, 12}};
+  column_vector semi_cols_gold;
+  semi_cols_gold.push_back(semi_gold_col.release());
+  Table semi_gold(std::move(semi_cols_gold));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(semi_gold.view(), *sorted_semi);
+
+  auto anti_result = cudf::left_anti_join(t0, t1, {0}, {0});
+  EXPECT_EQ(anti_result->num_rows(), 97);
+}
@@ -761,6 +761,75 @@ TYPED_TEST(TypedContainsDecimalsTest, ListContainsVector)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
 }
 
+struct IndexOfTest : public BaseFixture {
+};
+
+TEST_F(IndexOfTest, ScalarKey)
+{
+  auto search_space =
+    lists_column_wrapper<int32_t>{{0, 1, 2}, {3, 4, 5}, {6, 4, 4}, {}, {7, 8, 9}}.release();
+  auto search_key_one = create_scalar_search_key<int32_t>(4);
+
+  auto actual_result = lists::index_of(lists_column_view{search_space->view()}, *search_key_one);
+  auto expected_result = fixed_width_column_wrapper<size_type>{-1, 1, 1, -1, -1};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
+}
+
+TEST_F(IndexOfTest, ScalarKeyWithNulls)
+{
+  auto numerals = fixed_width_column_wrapper<int32_t>{{0, 1, 2, 3, 4, 5, 6, 7, 8},
+                                                      {1, 1, 0, 1, 1, 1, 1, 0, 1}};
+  auto input_null_mask_iter =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 2; });
+
+  auto search_space = make_lists_column(
+    4,
+    fixed_width_column_wrapper<size_type>{0, 3, 6, 6, 9}.release(),
+    numerals.release(),
+    1,
+    cudf::test::detail::make_null_mask(input_null_mask_iter, input_null_mask_iter + 4));
+
+  // Unlike contains(), an absent key in a list with nulls is still a valid -1.
+  auto search_key_one = create_scalar_search_key<int32_t>(7);
+  auto actual_result = lists::index_of(lists_column_view{search_space->view()}, *search_key_one);
+  auto expected_result =
+    fixed_width_column_wrapper<size_type>{{-1, -1, 0, -1}, {1, 1, 0, 1}};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
+
+  auto null_key          = create_null_search_key<int32_t>();
+  auto null_key_result   = lists::index_of(lists_column_view{search_space->view()}, *null_key);
+  auto expected_all_null = fixed_width_column_wrapper<size_type>{{0, 0, 0, 0}, {0, 0, 0, 0}};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_all_null, *null_key_result);
+}
+
+TEST_F(IndexOfTest, VectorKeys)
+{
+  auto search_space =
+    lists_column_wrapper<int32_t>{{0, 1, 2}, {3, 4, 5}, {6, 4, 4}, {7, 8, 9}}.release();
+  auto search_keys = fixed_width_column_wrapper<int32_t>{{2, 3, 4, 4}, {1, 1, 1, 0}};
+
+  auto actual_result =
+    lists::index_of(lists_column_view{search_space->view()}, search_keys);
+  auto expected_result = fixed_width_column_wrapper<size_type>{{2, 0, 1, 0}, {1, 1, 1, 0}};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
+}
+
+TEST_F(IndexOfTest, StringKey)
+{
+  auto search_space =
+    lists_column_wrapper<string_view>{{"a", "b", "c"}, {"d", "e"}, {"f", "e", "e"}}.release();
+  auto search_key_one = create_scalar_search_key<std::string>("e");
+
+  auto actual_result = lists::index_of(lists_column_view{search_space->view()}, *search_key_one);
+  auto expected_result = fixed_width_column_wrapper<size_type>{-1, 1, 1};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
+}
+
 }  // namespace test
 
 }  // namespace cudf
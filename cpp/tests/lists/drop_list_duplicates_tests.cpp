@@ -24,6 +24,7 @@
 #include <cudf/lists/drop_list_duplicates.hpp>
 
 #include <algorithm>
+#include <numeric>
 #include <unordered_set>
 
 using namespace cudf::test::iterators;
@@ -605,3 +606,28 @@ TEST_F(DropListDuplicatesTest, SlicedInputListsOfStructsWithNaNs)
     EXPECT_TRUE(results_children_expected.size() == results.size() && NaN_count == num_NaNs);
   }
 }
+
+
+TEST_F(DropListDuplicatesTest, LongListsFallback)
+{
+  // One list exceeds the limit of the fused short-lists kernel, forcing the
+  // segmented-sort fallback; results must be identical to the short-list path.
+  std::vector<int32_t> h_entries(200);
+  std::generate(h_entries.begin(), h_entries.end(), [i = 0]() mutable { return (i++ * 7) % 100; });
+  h_entries.insert(h_entries.end(), {3, 2, 3});
+  auto entries = IntsCol(h_entries.begin(), h_entries.end());
+  auto offsets = IntsCol{0, 200, 203};
+  auto const lists =
+    cudf::make_lists_column(2, offsets.release(), entries.release(), 0, {});
+
+  std::vector<int32_t> h_expected(100);
+  std::iota(h_expected.begin(), h_expected.end(), 0);
+  h_expected.insert(h_expected.end(), {2, 3});
+  auto expected_entries = IntsCol(h_expected.begin(), h_expected.end());
+  auto expected_offsets = IntsCol{0, 100, 102};
+  auto const expected   = cudf::make_lists_column(
+    2, expected_offsets.release(), expected_entries.release(), 0, {});
+
+  auto const results = cudf::lists::drop_list_duplicates(cudf::lists_column_view{lists->view()});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected->view(), verbosity);
+}
@@ -1183,3 +1183,42 @@ TEST_F(ExplodeOuterTest, SlicedList)
   auto pos_ret = cudf::explode_outer_position(sliced_t[0], 0);
   CUDF_TEST_EXPECT_TABLES_EQUAL(pos_ret->view(), pos_expected);
 }
+
+
+TEST_F(ExplodeTest, ManyFixedWidthPassthrough)
+{
+  // All passthrough columns are non-nullable fixed width, so expansion runs
+  // through the fused kernel without materializing a gather map.
+  FCW a{100, 200, 300};
+  fixed_width_column_wrapper<double> b{1.5, 2.5, 3.5};
+  fixed_width_column_wrapper<int64_t> c{10, 20, 30};
+  LCW d{LCW{1, 2, 7}, LCW{5, 6}, LCW{0, 3}};
+
+  FCW expected_a{100, 100, 100, 200, 200, 300, 300};
+  fixed_width_column_wrapper<double> expected_b{1.5, 1.5, 1.5, 2.5, 2.5, 3.5, 3.5};
+  fixed_width_column_wrapper<int64_t> expected_c{10, 10, 10, 20, 20, 30, 30};
+  FCW expected_d{1, 2, 7, 5, 6, 0, 3};
+
+  cudf::table_view t({a, b, c, d});
+  cudf::table_view expected({expected_a, expected_b, expected_c, expected_d});
+
+  auto ret = cudf::explode(t, 3);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(ret->view(), expected);
+}
+
+TEST_F(ExplodeOuterTest, ManyFixedWidthPassthrough)
+{
+  FCW a{100, 200, 300};
+  fixed_width_column_wrapper<int64_t> b{10, 20, 30};
+  LCW c{LCW{1, 2, 7}, LCW{}, LCW{0, 3}};
+
+  FCW expected_a{100, 100, 100, 200, 300, 300};
+  fixed_width_column_wrapper<int64_t> expected_b{10, 10, 10, 20, 30, 30};
+  auto expected_c = FCW{{1, 2, 7, 0, 0, 3}, {1, 1, 1, 0, 1, 1}};
+
+  cudf::table_view t({a, b, c});
+  cudf::table_view expected({expected_a, expected_b, expected_c});
+
+  auto ret = cudf::explode_outer(t, 2);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(ret->view(), expected);
+}
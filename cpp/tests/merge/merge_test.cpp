@@ -727,6 +727,41 @@ TEST_F(MergeTest, KeysWithNulls)
     }
 }
 
+TEST_F(MergeTest, KWayKeysWithNulls)
+{
+  // Four inputs take the k-way merge path rather than pairwise folding.
+  cudf::size_type nrows = 13200;
+  auto data_iter        = thrust::make_counting_iterator<int32_t>(0);
+  std::vector<cudf::test::fixed_width_column_wrapper<int32_t>> data;
+  for (int t = 0; t < 4; ++t) {
+    auto valids = cudf::detail::make_counting_transform_iterator(
+      0, [t](auto row) { return (row % (10 + t) == 0) ? false : true; });
+    data.emplace_back(data_iter, data_iter + nrows, valids);
+  }
+  auto all_data = cudf::concatenate(
+    std::vector<cudf::column_view>{{data[0], data[1], data[2], data[3]}});
+
+  std::vector<cudf::order> column_orders{cudf::order::ASCENDING, cudf::order::DESCENDING};
+  std::vector<cudf::null_order> null_precedences{cudf::null_order::AFTER, cudf::null_order::BEFORE};
+
+  for (auto co : column_orders)
+    for (auto np : null_precedences) {
+      std::vector<cudf::order> column_order{co};
+      std::vector<cudf::null_order> null_precedence{np};
+      std::vector<std::unique_ptr<cudf::table>> sorted;
+      std::vector<cudf::table_view> views;
+      for (auto const& col : data) {
+        sorted.push_back(cudf::sort(cudf::table_view({col}), column_order, null_precedence));
+        views.push_back(sorted.back()->view());
+      }
+
+      auto result = cudf::merge(views, {0}, column_order, null_precedence);
+      auto sorted_all =
+        cudf::sort(cudf::table_view({all_data->view()}), column_order, null_precedence);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(sorted_all->view().column(0), result->view().column(0));
+    }
+}
+
 TEST_F(MergeTest, Structs)
 {
   // clang-format off
@@ -905,4 +940,82 @@ TYPED_TEST(FixedPointTestBothReps, FixedPointMerge)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(exp_table.column(0), result->view().column(0));
 }
 
+class MergeUpsertTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(MergeUpsertTest, ReplaceAndInsert)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> target_keys{{0, 1, 3, 5}};
+  cudf::test::strings_column_wrapper target_vals{{"a", "b", "c", "d"}};
+  cudf::test::fixed_width_column_wrapper<int32_t> update_keys{{1, 2, 5, 7}};
+  cudf::test::strings_column_wrapper update_vals{{"B", "X", "D", "Y"}};
+
+  auto const result = cudf::merge_upsert(cudf::table_view({target_keys, target_vals}),
+                                         cudf::table_view({update_keys, update_vals}),
+                                         {0},
+                                         {cudf::order::ASCENDING});
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_keys{{0, 1, 2, 3, 5, 7}};
+  cudf::test::strings_column_wrapper expected_vals{{"a", "B", "X", "c", "D", "Y"}};
+  auto const expected = cudf::table_view({expected_keys, expected_vals});
+
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected, result->view());
+}
+
+TEST_F(MergeUpsertTest, KeysWithNulls)
+{
+  std::vector<cudf::order> const column_order{cudf::order::ASCENDING};
+  std::vector<cudf::null_order> const null_precedence{cudf::null_order::AFTER};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> target_keys{{0, 2, 4, 0}, {1, 1, 1, 0}};
+  cudf::test::fixed_width_column_wrapper<int32_t> target_vals{{10, 20, 30, 40}};
+  cudf::test::fixed_width_column_wrapper<int32_t> update_keys{{2, 3}};
+  cudf::test::fixed_width_column_wrapper<int32_t> update_vals{{200, 300}};
+
+  auto const result = cudf::merge_upsert(cudf::table_view({target_keys, target_vals}),
+                                         cudf::table_view({update_keys, update_vals}),
+                                         {0},
+                                         column_order,
+                                         null_precedence);
+
+  // the null key sorts after all valid keys and has no matching update
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_keys{{0, 2, 3, 4, 0}, {1, 1, 1, 1, 0}};
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_vals{{10, 200, 300, 30, 40}};
+  auto const expected = cudf::table_view({expected_keys, expected_vals});
+
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected, result->view());
+}
+
+TEST_F(MergeUpsertTest, EmptyInputs)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{{1, 2, 3}};
+  cudf::test::fixed_width_column_wrapper<int32_t> vals{{10, 20, 30}};
+  cudf::test::fixed_width_column_wrapper<int32_t> empty_keys{};
+  cudf::test::fixed_width_column_wrapper<int32_t> empty_vals{};
+
+  auto const table       = cudf::table_view({keys, vals});
+  auto const empty_table = cudf::table_view({empty_keys, empty_vals});
+
+  auto const no_updates = cudf::merge_upsert(table, empty_table, {0}, {cudf::order::ASCENDING});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table, no_updates->view());
+
+  auto const all_inserts = cudf::merge_upsert(empty_table, table, {0}, {cudf::order::ASCENDING});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table, all_inserts->view());
+}
+
+TEST_F(MergeUpsertTest, MismatchedInputs)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{{1, 2, 3}};
+  cudf::test::fixed_width_column_wrapper<double> other_keys{{1., 2., 3.}};
+
+  EXPECT_THROW(cudf::merge_upsert(cudf::table_view({keys}),
+                                  cudf::table_view({other_keys}),
+                                  {0},
+                                  {cudf::order::ASCENDING}),
+               cudf::logic_error);
+  EXPECT_THROW(
+    cudf::merge_upsert(cudf::table_view({keys}), cudf::table_view({keys}), {}, {}),
+    cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
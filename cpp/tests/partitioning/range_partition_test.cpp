@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/partitioning.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <numeric>
+
+struct RangePartitionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(RangePartitionTest, SimpleSplitters)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{{7, 1, 25, 12, 3, 30, 18}};
+  cudf::test::fixed_width_column_wrapper<int32_t> values{{0, 1, 2, 3, 4, 5, 6}};
+  cudf::table_view input{{keys, values}};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> splitter_keys{{10, 20}};
+  cudf::table_view splitters{{splitter_keys}};
+
+  auto [output, offsets] = cudf::range_partition(input, {0}, splitters);
+
+  EXPECT_EQ(std::vector<cudf::size_type>({0, 3, 5, 7}), offsets);
+
+  // Row order within a partition is undefined; sort each partition's keys
+  // before comparing.
+  auto sorted = cudf::sort(output->view());
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_keys{{1, 3, 7, 12, 18, 25, 30}};
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_values{{1, 4, 0, 3, 6, 2, 5}};
+  cudf::table_view expected{{expected_keys, expected_values}};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, sorted->view());
+}
+
+TEST_F(RangePartitionTest, EmptyInput)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{};
+  cudf::table_view input{{keys}};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> splitter_keys{{10, 20}};
+  cudf::table_view splitters{{splitter_keys}};
+
+  auto [output, offsets] = cudf::range_partition(input, {0}, splitters);
+
+  EXPECT_EQ(0, output->num_rows());
+  EXPECT_EQ(std::vector<cudf::size_type>({0, 0, 0, 0}), offsets);
+}
+
+TEST_F(RangePartitionTest, MismatchedSplitterColumnsThrows)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{{1, 2, 3}};
+  cudf::table_view input{{keys}};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> splitter_keys{{2}};
+  cudf::table_view splitters{{splitter_keys, splitter_keys}};
+
+  EXPECT_THROW(cudf::range_partition(input, {0}, splitters), cudf::logic_error);
+}
+
+TEST_F(RangePartitionTest, ComputedSplittersBalance)
+{
+  auto sequence = std::vector<int32_t>(1000);
+  std::iota(sequence.begin(), sequence.end(), 0);
+  cudf::test::fixed_width_column_wrapper<int32_t> keys(sequence.begin(), sequence.end());
+  cudf::table_view input{{keys}};
+
+  auto constexpr num_partitions = 4;
+  auto splitters = cudf::compute_range_splitters(input, num_partitions);
+  EXPECT_EQ(num_partitions - 1, splitters->num_rows());
+
+  auto [output, offsets] = cudf::range_partition(input, {0}, splitters->view());
+
+  EXPECT_EQ(static_cast<std::size_t>(num_partitions) + 1, offsets.size());
+  EXPECT_EQ(0, offsets.front());
+  EXPECT_EQ(1000, offsets.back());
+
+  // The sample covers the whole input here, so every partition should be
+  // close to the ideal 250 rows.
+  for (int i = 0; i < num_partitions; ++i) {
+    auto const size = offsets[i + 1] - offsets[i];
+    EXPECT_GT(size, 150);
+    EXPECT_LT(size, 350);
+  }
+}
+
+TEST_F(RangePartitionTest, SinglePartitionNoSplitters)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{{5, 3, 1}};
+  cudf::table_view input{{keys}};
+
+  auto splitters = cudf::compute_range_splitters(input, 1);
+  EXPECT_EQ(0, splitters->num_rows());
+
+  auto [output, offsets] = cudf::range_partition(input, {0}, splitters->view());
+  EXPECT_EQ(std::vector<cudf::size_type>({0, 3}), offsets);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, output->view());
+}
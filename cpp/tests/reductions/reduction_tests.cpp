@@ -2136,4 +2136,125 @@ TEST_F(StructReductionTest, NonValidStructReductionNthElement)
                        cudf::make_nth_element_aggregation(0, cudf::null_policy::INCLUDE));
 }
 
+struct TDigestReductionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(TDigestReductionTest, TDigest)
+{
+  using LCW = cudf::test::lists_column_wrapper<double>;
+
+  // The whole column is sketched as one group with nulls excluded; with
+  // max_centroids above the input size every valid value becomes its own
+  // unit-weight centroid, so the digest is exactly the sorted valid values
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{5, 0, 1, 3}, {1, 0, 1, 1}};
+  auto result = cudf::reduce(
+    col, cudf::make_tdigest_aggregation(), cudf::data_type(cudf::type_id::STRUCT));
+  auto digest = dynamic_cast<cudf::struct_scalar*>(result.get());
+  EXPECT_TRUE(digest->is_valid());
+
+  LCW means{1, 3, 5};
+  LCW weights{1, 1, 1};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({means, weights}), digest->view());
+}
+
+TEST_F(TDigestReductionTest, MergeTDigest)
+{
+  using LCW = cudf::test::lists_column_wrapper<double>;
+
+  LCW in_means{{1, 5}, {3}};
+  LCW in_weights{{2, 1}, {4}};
+  cudf::test::structs_column_wrapper digests({in_means, in_weights});
+
+  auto result = cudf::reduce(
+    digests, cudf::make_merge_tdigest_aggregation(), cudf::data_type(cudf::type_id::STRUCT));
+  auto merged = dynamic_cast<cudf::struct_scalar*>(result.get());
+  EXPECT_TRUE(merged->is_valid());
+
+  // Centroids pooled across the digest rows, ordered by mean
+  LCW means{1, 3, 5};
+  LCW weights{2, 4, 1};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({means, weights}), merged->view());
+}
+
+struct ReduceMultiTest : public cudf::test::BaseFixture {
+  template <typename T>
+  T scalar_value(std::unique_ptr<cudf::scalar> const& s)
+  {
+    return static_cast<cudf::numeric_scalar<T>*>(s.get())->value();
+  }
+};
+
+TEST_F(ReduceMultiTest, FusedNumericAggs)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({5, 1, 0, 7}, {1, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<double> doubles({2.5, 0.5, 4.0, 1.0});
+
+  std::vector<std::unique_ptr<cudf::aggregation>> aggs;
+  aggs.push_back(cudf::make_min_aggregation());
+  aggs.push_back(cudf::make_max_aggregation());
+  aggs.push_back(cudf::make_sum_aggregation());
+  aggs.push_back(cudf::make_count_aggregation());
+
+  auto results = cudf::reduce_multi(cudf::table_view{{ints, doubles}}, aggs);
+  ASSERT_EQ(results.size(), 8u);
+
+  EXPECT_EQ(scalar_value<int32_t>(results[0]), 1);
+  EXPECT_EQ(scalar_value<int32_t>(results[1]), 7);
+  EXPECT_EQ(scalar_value<int64_t>(results[2]), 13);  // SUM of int32 promotes to int64
+  EXPECT_EQ(scalar_value<cudf::size_type>(results[3]), 3);
+
+  EXPECT_EQ(scalar_value<double>(results[4]), 0.5);
+  EXPECT_EQ(scalar_value<double>(results[5]), 4.0);
+  EXPECT_EQ(scalar_value<double>(results[6]), 8.0);
+  EXPECT_EQ(scalar_value<cudf::size_type>(results[7]), 4);
+}
+
+TEST_F(ReduceMultiTest, FallbackTypesAndAggs)
+{
+  cudf::test::strings_column_wrapper strings({"bb", "aa", "cc"});
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({2, 4, 6});
+
+  std::vector<std::unique_ptr<cudf::aggregation>> aggs;
+  aggs.push_back(cudf::make_min_aggregation());
+  aggs.push_back(cudf::make_max_aggregation());
+  aggs.push_back(cudf::make_count_aggregation());
+
+  auto results = cudf::reduce_multi(cudf::table_view{{strings, ints}}, aggs);
+  ASSERT_EQ(results.size(), 6u);
+
+  EXPECT_EQ(static_cast<cudf::string_scalar*>(results[0].get())->to_string(), "aa");
+  EXPECT_EQ(static_cast<cudf::string_scalar*>(results[1].get())->to_string(), "cc");
+  EXPECT_EQ(scalar_value<cudf::size_type>(results[2]), 3);
+
+  EXPECT_EQ(scalar_value<int32_t>(results[3]), 2);
+  EXPECT_EQ(scalar_value<int32_t>(results[4]), 6);
+  EXPECT_EQ(scalar_value<cudf::size_type>(results[5]), 3);
+
+  // non-fused aggregations route through the regular per-column reduce
+  std::vector<std::unique_ptr<cudf::aggregation>> mean_agg;
+  mean_agg.push_back(cudf::make_mean_aggregation());
+  auto mean_results = cudf::reduce_multi(cudf::table_view{{ints}}, mean_agg);
+  EXPECT_EQ(scalar_value<double>(mean_results[0]), 4.0);
+}
+
+TEST_F(ReduceMultiTest, AllNullAndEmpty)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> all_null({0, 0, 0}, {0, 0, 0});
+
+  std::vector<std::unique_ptr<cudf::aggregation>> aggs;
+  aggs.push_back(cudf::make_min_aggregation());
+  aggs.push_back(cudf::make_sum_aggregation());
+  aggs.push_back(cudf::make_count_aggregation());
+
+  auto results = cudf::reduce_multi(cudf::table_view{{all_null}}, aggs);
+  ASSERT_EQ(results.size(), 3u);
+  EXPECT_FALSE(results[0]->is_valid());
+  EXPECT_FALSE(results[1]->is_valid());
+  EXPECT_TRUE(results[2]->is_valid());
+  EXPECT_EQ(scalar_value<cudf::size_type>(results[2]), 0);
+
+  std::vector<std::unique_ptr<cudf::aggregation>> no_aggs;
+  EXPECT_THROW(cudf::reduce_multi(cudf::table_view{{all_null}}, no_aggs), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -690,5 +690,62 @@ TEST(RankScanTest, ExclusiveScan)
     "Unsupported rank aggregation operator for exclusive scan");
 }
 
+struct ScanMultiTest : public BaseFixture {
+};
+
+TEST_F(ScanMultiTest, MatchesSingleColumnScans)
+{
+  fixed_width_column_wrapper<int32_t> col0({1, 2, 3, 4}, {1, 1, 0, 1});
+  fixed_width_column_wrapper<int32_t> col1({5, 6, 7, 8});
+  fixed_width_column_wrapper<double> col2({1.5, 2.5, 3.5, 4.5});
+  table_view input{{col0, col1, col2}};
+
+  for (auto inclusive : {scan_type::INCLUSIVE, scan_type::EXCLUSIVE}) {
+    for (auto null_handling : {null_policy::EXCLUDE, null_policy::INCLUDE}) {
+      auto results = scan_multi(input, make_sum_aggregation(), inclusive, null_handling);
+      ASSERT_EQ(results.size(), std::size_t{3});
+      for (size_type i = 0; i < input.num_columns(); ++i) {
+        auto expected = scan(input.column(i), make_sum_aggregation(), inclusive, null_handling);
+        CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results[i], *expected);
+      }
+    }
+  }
+}
+
+TEST_F(ScanMultiTest, IncludeNullPolicy)
+{
+  fixed_width_column_wrapper<int32_t> vals({1, 2, 3, 4}, {1, 1, 0, 1});
+  table_view input{{vals}};
+
+  auto inclusive =
+    scan_multi(input, make_sum_aggregation(), scan_type::INCLUSIVE, null_policy::INCLUDE);
+  fixed_width_column_wrapper<int32_t> expected_inclusive({1, 3, 3, 7}, {1, 1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*inclusive.front(), expected_inclusive);
+
+  auto exclusive =
+    scan_multi(input, make_sum_aggregation(), scan_type::EXCLUSIVE, null_policy::INCLUDE);
+  fixed_width_column_wrapper<int32_t> expected_exclusive({0, 1, 3, 3}, {1, 1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*exclusive.front(), expected_exclusive);
+}
+
+TEST_F(ScanMultiTest, MixedTypesFallback)
+{
+  strings_column_wrapper strings({"bb", "aa", "cc"});
+  fixed_width_column_wrapper<int32_t> ints({3, 1, 2});
+  table_view input{{strings, ints}};
+
+  auto results = scan_multi(input, make_min_aggregation(), scan_type::INCLUSIVE);
+  auto expected_strings = scan(strings, make_min_aggregation(), scan_type::INCLUSIVE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results[0], *expected_strings);
+  fixed_width_column_wrapper<int32_t> expected_ints({3, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results[1], expected_ints);
+}
+
+TEST_F(ScanMultiTest, EmptyTable)
+{
+  auto results = scan_multi(table_view{}, make_sum_aggregation(), scan_type::INCLUSIVE);
+  EXPECT_TRUE(results.empty());
+}
+
 }  // namespace test
 }  // namespace cudf
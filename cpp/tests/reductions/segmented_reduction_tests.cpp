@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+struct SegmentedReductionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SegmentedReductionTest, SumMinMax)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input({1, 2, 3, 10, 20, 5});
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets({0, 3, 3, 5, 6});
+
+  auto sums = cudf::segmented_reduce(input,
+                                     offsets,
+                                     cudf::make_sum_aggregation(),
+                                     cudf::data_type{cudf::type_id::INT64});
+  cudf::test::fixed_width_column_wrapper<int64_t> expected_sums({6, 0, 30, 5}, {1, 0, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*sums, expected_sums);
+
+  auto mins = cudf::segmented_reduce(input,
+                                     offsets,
+                                     cudf::make_min_aggregation(),
+                                     cudf::data_type{cudf::type_id::INT32});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_mins({1, 0, 10, 5}, {1, 0, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*mins, expected_mins);
+
+  auto maxs = cudf::segmented_reduce(input,
+                                     offsets,
+                                     cudf::make_max_aggregation(),
+                                     cudf::data_type{cudf::type_id::INT32});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_maxs({3, 0, 20, 5}, {1, 0, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*maxs, expected_maxs);
+}
+
+TEST_F(SegmentedReductionTest, NullPolicies)
+{
+  cudf::test::fixed_width_column_wrapper<double> input({1.0, 0.0, 3.0, 4.0, 0.0, 0.0},
+                                                       {1, 0, 1, 1, 0, 0});
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets({0, 3, 4, 6});
+
+  auto excluded = cudf::segmented_reduce(input,
+                                         offsets,
+                                         cudf::make_sum_aggregation(),
+                                         cudf::data_type{cudf::type_id::FLOAT64},
+                                         cudf::null_policy::EXCLUDE);
+  cudf::test::fixed_width_column_wrapper<double> expected_excluded({4.0, 4.0, 0.0}, {1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*excluded, expected_excluded);
+
+  auto included = cudf::segmented_reduce(input,
+                                         offsets,
+                                         cudf::make_sum_aggregation(),
+                                         cudf::data_type{cudf::type_id::FLOAT64},
+                                         cudf::null_policy::INCLUDE);
+  cudf::test::fixed_width_column_wrapper<double> expected_included({0.0, 4.0, 0.0}, {0, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*included, expected_included);
+}
+
+TEST_F(SegmentedReductionTest, AnyAll)
+{
+  cudf::test::fixed_width_column_wrapper<bool> input({true, false, false, true, true});
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets({0, 2, 3, 5});
+
+  auto any = cudf::segmented_reduce(input,
+                                    offsets,
+                                    cudf::make_any_aggregation(),
+                                    cudf::data_type{cudf::type_id::BOOL8});
+  cudf::test::fixed_width_column_wrapper<bool> expected_any({true, false, true});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*any, expected_any);
+
+  auto all = cudf::segmented_reduce(input,
+                                    offsets,
+                                    cudf::make_all_aggregation(),
+                                    cudf::data_type{cudf::type_id::BOOL8});
+  cudf::test::fixed_width_column_wrapper<bool> expected_all({false, false, true});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*all, expected_all);
+}
+
+TEST_F(SegmentedReductionTest, Errors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input({1, 2, 3});
+  cudf::test::fixed_width_column_wrapper<int64_t> bad_offsets({0, 3});
+  EXPECT_THROW(cudf::segmented_reduce(input,
+                                      bad_offsets,
+                                      cudf::make_sum_aggregation(),
+                                      cudf::data_type{cudf::type_id::INT64}),
+               cudf::logic_error);
+
+  cudf::test::strings_column_wrapper strings({"a", "b"});
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets({0, 2});
+  EXPECT_THROW(cudf::segmented_reduce(strings,
+                                      offsets,
+                                      cudf::make_min_aggregation(),
+                                      cudf::data_type{cudf::type_id::STRING}),
+               cudf::logic_error);
+
+  EXPECT_THROW(cudf::segmented_reduce(input,
+                                      offsets,
+                                      cudf::make_mean_aggregation(),
+                                      cudf::data_type{cudf::type_id::FLOAT64}),
+               cudf::logic_error);
+}
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cudf/binaryop.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/dictionary/encode.hpp>
 #include <cudf/replace.hpp>
@@ -661,4 +662,145 @@ TYPED_TEST(FixedPointTest, MismatchedColumnScalarScale)
   EXPECT_THROW(cudf::clamp(input, *lo, *hi), cudf::logic_error);
 }
 
+template <typename T>
+struct NormalizeTest : public cudf::test::BaseFixture {
+  std::unique_ptr<cudf::scalar> make_scalar(T value, bool validity = true)
+  {
+    using ScalarType = cudf::scalar_type_t<T>;
+    auto scalar      = cudf::make_numeric_scalar(cudf::data_type{cudf::type_to_id<T>()});
+    static_cast<ScalarType*>(scalar.get())->set_value(value);
+    static_cast<ScalarType*>(scalar.get())->set_valid_async(validity);
+    return scalar;
+  }
+};
+
+using NormalizeTypes =
+  cudf::test::Concat<cudf::test::IntegralTypesNotBool, cudf::test::FloatingPointTypes>;
+TYPED_TEST_CASE(NormalizeTest, NormalizeTypes);
+
+TYPED_TEST(NormalizeTest, WithNoNull)
+{
+  using T = TypeParam;
+
+  auto const lo    = this->make_scalar(cudf::test::make_type_param_scalar<T>(2));
+  auto const hi    = this->make_scalar(cudf::test::make_type_param_scalar<T>(8));
+  auto const shift = this->make_scalar(cudf::test::make_type_param_scalar<T>(2));
+  auto const scale = this->make_scalar(cudf::test::make_type_param_scalar<T>(2));
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> input({0, 2, 4, 6, 8, 10});
+
+  auto got = cudf::normalize(input, *lo, *hi, *shift, *scale);
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> expected({0, 0, 1, 2, 3, 3});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+}
+
+TYPED_TEST(NormalizeTest, WithNulls)
+{
+  using T = TypeParam;
+
+  auto const lo    = this->make_scalar(cudf::test::make_type_param_scalar<T>(2));
+  auto const hi    = this->make_scalar(cudf::test::make_type_param_scalar<T>(8));
+  auto const shift = this->make_scalar(cudf::test::make_type_param_scalar<T>(2));
+  auto const scale = this->make_scalar(cudf::test::make_type_param_scalar<T>(2));
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> input({0, 2, 4, 6, 8, 10},
+                                                           {1, 0, 1, 1, 0, 1});
+
+  auto got = cudf::normalize(input, *lo, *hi, *shift, *scale);
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> expected({0, 0, 1, 2, 0, 3},
+                                                              {1, 0, 1, 1, 0, 1});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+}
+
+TYPED_TEST(NormalizeTest, NullBounds)
+{
+  using T = TypeParam;
+
+  // invalid lo and hi mean no clamping on either side
+  auto const lo    = this->make_scalar(cudf::test::make_type_param_scalar<T>(2), false);
+  auto const hi    = this->make_scalar(cudf::test::make_type_param_scalar<T>(8), false);
+  auto const shift = this->make_scalar(cudf::test::make_type_param_scalar<T>(2));
+  auto const scale = this->make_scalar(cudf::test::make_type_param_scalar<T>(2));
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> input({2, 4, 6, 8, 10, 12});
+
+  auto got = cudf::normalize(input, *lo, *hi, *shift, *scale);
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> expected({0, 1, 2, 3, 4, 5});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+}
+
+TYPED_TEST(NormalizeTest, MatchesUnfusedChain)
+{
+  using T = TypeParam;
+
+  auto const lo    = this->make_scalar(cudf::test::make_type_param_scalar<T>(1));
+  auto const hi    = this->make_scalar(cudf::test::make_type_param_scalar<T>(9));
+  auto const shift = this->make_scalar(cudf::test::make_type_param_scalar<T>(3));
+  auto const scale = this->make_scalar(cudf::test::make_type_param_scalar<T>(2));
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> input({0, 1, 5, 7, 9, 11},
+                                                           {1, 1, 0, 1, 1, 1});
+
+  auto const out_type = cudf::data_type{cudf::type_to_id<T>()};
+  auto const clamped  = cudf::clamp(input, *lo, *hi);
+  auto const shifted =
+    cudf::binary_operation(clamped->view(), *shift, cudf::binary_operator::SUB, out_type);
+  auto const expected =
+    cudf::binary_operation(shifted->view(), *scale, cudf::binary_operator::DIV, out_type);
+
+  auto got = cudf::normalize(input, *lo, *hi, *shift, *scale);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), got->view());
+}
+
+struct NormalizeErrorTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(NormalizeErrorTest, NonNumericInput)
+{
+  auto scalar = cudf::make_string_scalar("b");
+  cudf::test::strings_column_wrapper input({"a", "b", "c"});
+
+  EXPECT_THROW(cudf::normalize(input, *scalar, *scalar, *scalar, *scalar), cudf::logic_error);
+}
+
+TEST_F(NormalizeErrorTest, MisMatchingScalarTypes)
+{
+  auto lo = cudf::make_numeric_scalar(cudf::data_type(cudf::type_id::INT32));
+  lo->set_valid_async(true);
+  auto hi = cudf::make_numeric_scalar(cudf::data_type(cudf::type_id::INT32));
+  hi->set_valid_async(true);
+  auto shift = cudf::make_numeric_scalar(cudf::data_type(cudf::type_id::INT64));
+  shift->set_valid_async(true);
+  auto scale = cudf::make_numeric_scalar(cudf::data_type(cudf::type_id::INT32));
+  scale->set_valid_async(true);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> input({1, 2, 3, 4, 5, 6});
+
+  EXPECT_THROW(cudf::normalize(input, *lo, *hi, *shift, *scale), cudf::logic_error);
+}
+
+TEST_F(NormalizeErrorTest, InvalidShiftOrScale)
+{
+  auto lo = cudf::make_numeric_scalar(cudf::data_type(cudf::type_id::INT32));
+  lo->set_valid_async(true);
+  auto hi = cudf::make_numeric_scalar(cudf::data_type(cudf::type_id::INT32));
+  hi->set_valid_async(true);
+  auto valid = cudf::make_numeric_scalar(cudf::data_type(cudf::type_id::INT32));
+  valid->set_valid_async(true);
+  auto invalid = cudf::make_numeric_scalar(cudf::data_type(cudf::type_id::INT32));
+  invalid->set_valid_async(false);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> input({1, 2, 3, 4, 5, 6});
+
+  EXPECT_THROW(cudf::normalize(input, *lo, *hi, *invalid, *valid), cudf::logic_error);
+  EXPECT_THROW(cudf::normalize(input, *lo, *hi, *valid, *invalid), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
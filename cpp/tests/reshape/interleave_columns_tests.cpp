@@ -173,6 +173,68 @@ TYPED_TEST(InterleaveColumnsTest, ThreeColumnsNullable)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, actual->view());
 }
 
+TYPED_TEST(InterleaveColumnsTest, WideTable)
+{
+  using T = TypeParam;
+
+  // Wide enough to exercise the tiled shared-memory path.
+  constexpr cudf::size_type num_columns = 40;
+  constexpr cudf::size_type num_rows    = 50;
+
+  std::vector<cudf::test::fixed_width_column_wrapper<T, int32_t>> columns;
+  std::vector<int32_t> interleaved(num_columns * num_rows);
+  for (cudf::size_type col = 0; col < num_columns; ++col) {
+    std::vector<int32_t> values(num_rows);
+    for (cudf::size_type row = 0; row < num_rows; ++row) {
+      values[row]                              = (row * num_columns + col) % 100;
+      interleaved[row * num_columns + col] = values[row];
+    }
+    columns.emplace_back(values.begin(), values.end());
+  }
+
+  cudf::table_view in(std::vector<cudf::column_view>(columns.begin(), columns.end()));
+
+  auto expected =
+    cudf::test::fixed_width_column_wrapper<T, int32_t>(interleaved.begin(), interleaved.end());
+  auto actual = cudf::interleave_columns(in);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, actual->view());
+}
+
+TYPED_TEST(InterleaveColumnsTest, WideTableNullable)
+{
+  using T = TypeParam;
+
+  constexpr cudf::size_type num_columns = 40;
+  constexpr cudf::size_type num_rows    = 50;
+
+  auto const is_valid = [](cudf::size_type idx) { return idx % 3 != 0; };
+
+  std::vector<cudf::test::fixed_width_column_wrapper<T, int32_t>> columns;
+  std::vector<int32_t> interleaved(num_columns * num_rows);
+  std::vector<bool> validity(num_columns * num_rows);
+  for (cudf::size_type col = 0; col < num_columns; ++col) {
+    std::vector<int32_t> values(num_rows);
+    std::vector<bool> valids(num_rows);
+    for (cudf::size_type row = 0; row < num_rows; ++row) {
+      auto const out_idx = row * num_columns + col;
+      values[row]        = out_idx % 100;
+      valids[row]        = is_valid(out_idx);
+      interleaved[out_idx] = values[row];
+      validity[out_idx]    = valids[row];
+    }
+    columns.emplace_back(values.begin(), values.end(), valids.begin());
+  }
+
+  cudf::table_view in(std::vector<cudf::column_view>(columns.begin(), columns.end()));
+
+  auto expected = cudf::test::fixed_width_column_wrapper<T, int32_t>(
+    interleaved.begin(), interleaved.end(), validity.begin());
+  auto actual = cudf::interleave_columns(in);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, actual->view());
+}
+
 TYPED_TEST(InterleaveColumnsTest, MismatchedDtypes)
 {
   using T = TypeParam;
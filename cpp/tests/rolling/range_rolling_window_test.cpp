@@ -603,5 +603,63 @@ TYPED_TEST(TypedRangeRollingNullsTest, UnboundedFollowingWindowSingleGroupOrderB
                                    {9, 9, 9, 9, 5, 5, 4, 4, 3, 2}, {1, 1, 1, 1, 1, 1, 1, 1, 1, 1}});
 }
 
+TEST_F(RangeRollingTest, CachedWindowBoundsMatchPerCallResults)
+{
+  using T = int32_t;
+
+  // Groupby column.
+  auto const grp_col = fixed_width_column_wrapper<T>{0, 0, 0, 0, 0, 1, 1, 1, 1, 1};
+  // Aggregation column.
+  auto const agg_col =
+    fixed_width_column_wrapper<T>{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}, {1, 1, 1, 1, 1, 0, 1, 1, 1, 1}};
+  // OrderBy column.
+  auto const oby_col = fixed_width_column_wrapper<T>{1, 2, 2, 4, 5, 1, 2, 3, 6, 7};
+
+  auto const grouping_keys = cudf::table_view{std::vector<cudf::column_view>{grp_col}};
+  auto const preceding     = range_window_bounds::get(numeric_scalar<T>{T{1}, true});
+  auto const following     = range_window_bounds::get(numeric_scalar<T>{T{1}, true});
+  auto const min_periods   = size_type{1};
+
+  // Bounds computed once, reused for every aggregation.
+  cudf::grouped_range_rolling const windows(
+    grouping_keys, oby_col, cudf::order::ASCENDING, preceding, following, min_periods);
+
+  for (auto const& agg : {make_sum_aggregation<rolling_aggregation>(),
+                          make_count_aggregation<rolling_aggregation>(),
+                          make_min_aggregation<rolling_aggregation>(),
+                          make_max_aggregation<rolling_aggregation>()}) {
+    auto const expected = cudf::grouped_range_rolling_window(
+      grouping_keys, oby_col, cudf::order::ASCENDING, agg_col, preceding, following, min_periods, *agg);
+    auto const actual = windows.aggregate(agg_col, *agg);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(actual->view(), expected->view());
+  }
+}
+
+TEST_F(RangeRollingTest, CachedWindowBoundsInvalidRequests)
+{
+  using T = int32_t;
+
+  auto const grp_col = fixed_width_column_wrapper<T>{0, 0, 0, 1, 1};
+  auto const oby_col = fixed_width_column_wrapper<T>{1, 2, 3, 1, 2};
+
+  auto const grouping_keys = cudf::table_view{std::vector<cudf::column_view>{grp_col}};
+  auto const preceding     = range_window_bounds::get(numeric_scalar<T>{T{1}, true});
+  auto const following     = range_window_bounds::get(numeric_scalar<T>{T{1}, true});
+
+  // min_periods must be positive.
+  EXPECT_THROW(cudf::grouped_range_rolling(
+                 grouping_keys, oby_col, cudf::order::ASCENDING, preceding, following, 0),
+               cudf::logic_error);
+
+  cudf::grouped_range_rolling const windows(
+    grouping_keys, oby_col, cudf::order::ASCENDING, preceding, following, 1);
+
+  // Aggregated columns must match the order-by column's row count.
+  auto const wrong_size_col = fixed_width_column_wrapper<T>{1, 2, 3};
+  EXPECT_THROW(
+    windows.aggregate(wrong_size_col, *make_sum_aggregation<rolling_aggregation>()),
+    cudf::logic_error);
+}
+
 }  // namespace test
 }  // namespace cudf
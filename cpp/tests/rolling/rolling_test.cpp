@@ -874,6 +874,28 @@ TYPED_TEST(RollingTest, RandomStaticWithInvalid)
   this->run_test_col_agg(input, window, window, periods);
 }
 
+// random input data, wide asymmetric static windows exercising the
+// prefix-scan fast path and its clamped edge windows
+TYPED_TEST(RollingTest, RandomStaticWideWindow)
+{
+  size_type num_rows = 5000;
+
+  // random input
+  std::vector<TypeParam> col_data(num_rows);
+  std::vector<bool> col_valid(num_rows);
+  cudf::test::UniformRandomGenerator<TypeParam> rng;
+  cudf::test::UniformRandomGenerator<bool> rbg;
+  std::generate(col_data.begin(), col_data.end(), [&rng]() { return rng.generate(); });
+  std::generate(col_valid.begin(), col_valid.end(), [&rbg]() { return rbg.generate(); });
+  fixed_width_column_wrapper<TypeParam> input(col_data.begin(), col_data.end(), col_valid.begin());
+
+  std::vector<size_type> preceding_window({150});
+  std::vector<size_type> following_window({30});
+
+  this->run_test_col_agg(input, preceding_window, following_window, 100);
+  this->run_test_col_agg(input, following_window, preceding_window, 1);
+}
+
 // random input data, dynamic parameters, no nulls
 TYPED_TEST(RollingTest, RandomDynamicAllValid)
 {
@@ -22,6 +22,9 @@
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/search.hpp>
 
+#include <algorithm>
+#include <vector>
+
 struct SearchTest : public cudf::test::BaseFixture {
 };
 
@@ -102,6 +105,102 @@ TEST_F(SearchTest, non_null_column__find_last)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
 }
 
+TEST_F(SearchTest, non_null_column_large__matches_host)
+{
+  using element_type = int64_t;
+
+  // Large enough to span many pivot intervals of the single-column fast path,
+  // with a skewed distribution and duplicate runs so the interpolation
+  // probes land off target and the binary-search fallback has to finish
+  constexpr int num_rows = 20000;
+  std::vector<element_type> host_column(num_rows);
+  std::generate(host_column.begin(), host_column.end(), [n = 0]() mutable {
+    auto const i = n++;
+    return static_cast<element_type>(i < num_rows / 2 ? i / 8 : i * 1000);
+  });
+  std::sort(host_column.begin(), host_column.end());
+
+  std::vector<element_type> host_values{-10,
+                                        0,
+                                        host_column[37],
+                                        host_column[num_rows / 2],
+                                        host_column[num_rows - 1],
+                                        host_column[num_rows - 1] + 1};
+  std::vector<size_type> expect_lower, expect_upper;
+  for (auto const v : host_values) {
+    expect_lower.push_back(static_cast<size_type>(
+      std::lower_bound(host_column.begin(), host_column.end(), v) - host_column.begin()));
+    expect_upper.push_back(static_cast<size_type>(
+      std::upper_bound(host_column.begin(), host_column.end(), v) - host_column.begin()));
+  }
+
+  fixed_width_column_wrapper<element_type> column(host_column.begin(), host_column.end());
+  fixed_width_column_wrapper<element_type> values(host_values.begin(), host_values.end());
+
+  auto const result_lower = cudf::lower_bound({cudf::table_view{{column}}},
+                                              {cudf::table_view{{values}}},
+                                              {cudf::order::ASCENDING},
+                                              {cudf::null_order::BEFORE});
+  auto const result_upper = cudf::upper_bound({cudf::table_view{{column}}},
+                                              {cudf::table_view{{values}}},
+                                              {cudf::order::ASCENDING},
+                                              {cudf::null_order::BEFORE});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *result_lower, fixed_width_column_wrapper<size_type>(expect_lower.begin(), expect_lower.end()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *result_upper, fixed_width_column_wrapper<size_type>(expect_upper.begin(), expect_upper.end()));
+}
+
+TEST_F(SearchTest, sorted_index__matches_free_functions)
+{
+  using element_type = int64_t;
+
+  fixed_width_column_wrapper<element_type> column{10, 20, 20, 30, 50};
+  fixed_width_column_wrapper<element_type> values{0, 7, 10, 11, 20, 30, 32, 50, 90};
+
+  // Built once, probed repeatedly: results must match the one-shot searches
+  cudf::sorted_index const index(cudf::table_view{{column}},
+                                 {cudf::order::ASCENDING},
+                                 {cudf::null_order::BEFORE});
+
+  auto const expect_lower = cudf::lower_bound({cudf::table_view{{column}}},
+                                              {cudf::table_view{{values}}},
+                                              {cudf::order::ASCENDING},
+                                              {cudf::null_order::BEFORE});
+  auto const expect_upper = cudf::upper_bound({cudf::table_view{{column}}},
+                                              {cudf::table_view{{values}}},
+                                              {cudf::order::ASCENDING},
+                                              {cudf::null_order::BEFORE});
+
+  for (int probe = 0; probe < 2; ++probe) {
+    auto const result_lower = index.lower_bound(cudf::table_view{{values}});
+    auto const result_upper = index.upper_bound(cudf::table_view{{values}});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result_lower, *expect_lower);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result_upper, *expect_upper);
+  }
+}
+
+TEST_F(SearchTest, sorted_index__comparator_fallback)
+{
+  // Nullable haystacks have no pivot hierarchy; the index must fall back to
+  // the generic comparator path and still match the free function
+  fixed_width_column_wrapper<int32_t> column{{10, 20, 30, 40, 50}, {0, 1, 1, 1, 1}};
+  fixed_width_column_wrapper<int32_t> values{{8, 20, 45}, {0, 1, 1}};
+
+  cudf::sorted_index const index(cudf::table_view{{column}},
+                                 {cudf::order::ASCENDING},
+                                 {cudf::null_order::BEFORE});
+
+  auto const expect = cudf::lower_bound({cudf::table_view{{column}}},
+                                        {cudf::table_view{{values}}},
+                                        {cudf::order::ASCENDING},
+                                        {cudf::null_order::BEFORE});
+  auto const result = index.lower_bound(cudf::table_view{{values}});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, *expect);
+}
+
 TEST_F(SearchTest, non_null_column_desc__find_first)
 {
   using element_type = int64_t;
@@ -24,6 +24,7 @@
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/type_list_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
+#include <numeric>
 #include <vector>
 
 using namespace cudf::test;
@@ -451,4 +452,26 @@ struct IsSortedFixedWidthOnly : public cudf::test::BaseFixture {
 
 TYPED_TEST_CASE(IsSortedFixedWidthOnly, cudf::test::FixedWidthTypes);
 
+struct IsSortedLarge : public BaseFixture {
+};
+
+TEST_F(IsSortedLarge, ViolationPositions)
+{
+  // Large enough to span many blocks of the early-exit kernel; a violation
+  // anywhere, including the very first and last pairs, must be detected
+  constexpr int num_rows = 100000;
+  std::vector<int32_t> data(num_rows);
+  std::iota(data.begin(), data.end(), 0);
+
+  auto sorted = fixed_width_column_wrapper<int32_t>(data.begin(), data.end());
+  EXPECT_TRUE(cudf::is_sorted(cudf::table_view{{sorted}}, {cudf::order::ASCENDING}, {}));
+
+  for (auto const pos : {1, num_rows / 2, num_rows - 1}) {
+    auto broken = data;
+    std::swap(broken[pos - 1], broken[pos]);
+    auto col = fixed_width_column_wrapper<int32_t>(broken.begin(), broken.end());
+    EXPECT_FALSE(cudf::is_sorted(cudf::table_view{{col}}, {cudf::order::ASCENDING}, {}));
+  }
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -410,5 +410,51 @@ TYPED_TEST(Rank, min_desc_bottom_pct)
   this->run_all_tests(rank_method::MIN, desc_bottom, col1_rank, col2_rank, col3_rank, true);
 }
 
+struct RankPercent : public BaseFixture {
+};
+
+TEST_F(RankPercent, first_max_average_asce_pct)
+{
+  fixed_width_column_wrapper<int32_t> col{{5, 4, 3, 5, 8, 5}};
+
+  fixed_width_column_wrapper<double> first_rank{
+    {3.0 / 6.0, 2.0 / 6.0, 1.0 / 6.0, 4.0 / 6.0, 1., 5.0 / 6.0}};
+  fixed_width_column_wrapper<double> max_rank{
+    {5.0 / 6.0, 2.0 / 6.0, 1.0 / 6.0, 5.0 / 6.0, 1., 5.0 / 6.0}};
+  fixed_width_column_wrapper<double> average_rank{
+    {4.0 / 6.0, 2.0 / 6.0, 1.0 / 6.0, 4.0 / 6.0, 1., 4.0 / 6.0}};
+
+  auto percent_rank = [&](rank_method method) {
+    return cudf::rank(col, method, order::ASCENDING, null_policy::INCLUDE, null_order::AFTER, true);
+  };
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(first_rank, percent_rank(rank_method::FIRST)->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(max_rank, percent_rank(rank_method::MAX)->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(average_rank, percent_rank(rank_method::AVERAGE)->view());
+}
+
+TEST_F(RankPercent, table_rank_matches_columnwise)
+{
+  fixed_width_column_wrapper<int32_t> col1{{5, 4, 3, 5, 8, 5}};
+  fixed_width_column_wrapper<int32_t> col2{{5, 4, 3, 5, 8, 5}, {1, 1, 0, 1, 1, 1}};
+
+  for (auto const percentage : {false, true}) {
+    auto const batched = cudf::rank(table_view{{col1, col2}},
+                                    rank_method::MIN,
+                                    order::ASCENDING,
+                                    null_policy::EXCLUDE,
+                                    null_order::AFTER,
+                                    percentage);
+    for (auto i = 0; i < 2; ++i) {
+      auto const single = cudf::rank(table_view{{col1, col2}}.column(i),
+                                     rank_method::MIN,
+                                     order::ASCENDING,
+                                     null_policy::EXCLUDE,
+                                     null_order::AFTER,
+                                     percentage);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(batched->get_column(i).view(), single->view());
+    }
+  }
+}
+
 }  // namespace test
 }  // namespace cudf
@@ -21,6 +21,7 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/sorting.hpp>
 
@@ -214,6 +215,39 @@ TEST_F(SegmentedSortInt, NonZeroSegmentsStart)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected3);
 }
 
+TEST_F(SegmentedSortInt, SizeBinnedSegments)
+{
+  using T = int;
+  // One segment larger than the block-sort capacity plus two smaller ones;
+  // each segment holds its row range in reverse, so the ascending segmented
+  // sort yields the identity sequence.
+  constexpr int num_rows = 3000;
+  auto value_at          = [](int i) {
+    int begin = 0, end = 2000;
+    if (i >= 2600) {
+      begin = 2600;
+      end   = num_rows;
+    } else if (i >= 2000) {
+      begin = 2000;
+      end   = 2600;
+    }
+    return begin + end - 1 - i;
+  };
+  auto input_iter = cudf::detail::make_counting_transform_iterator(0, value_at);
+  column_wrapper<T> col(input_iter, input_iter + num_rows);
+  column_wrapper<int> segments{{0, 2000, 2600, num_rows}};
+  table_view input{{col}};
+
+  auto identity_iter = thrust::make_counting_iterator<int>(0);
+  column_wrapper<T> expected_asc(identity_iter, identity_iter + num_rows);
+  auto results = cudf::segmented_sort_by_key(input, input, segments, {order::ASCENDING});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(results->view(), table_view{{expected_asc}});
+
+  // descending: each reversed segment is already in descending order
+  results = cudf::segmented_sort_by_key(input, input, segments, {order::DESCENDING});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(results->view(), input);
+}
+
 TEST_F(SegmentedSortInt, Sliced)
 {
   using T = int;
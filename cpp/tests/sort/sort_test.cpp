@@ -202,6 +202,145 @@ TYPED_TEST(Sort, WithAllValid)
   }
 }
 
+TYPED_TEST(Sort, SingleColumnWithNulls)
+{
+  using T = TypeParam;
+
+  // Single-column sorts with nulls take the partition-then-radix-sort path
+  // for fixed-width types; exercise all order/null-precedence combinations.
+  fixed_width_column_wrapper<T> col{{5, 9, 0, 7, 2}, {1, 0, 1, 1, 1}};
+  table_view input{{col}};
+
+  {
+    fixed_width_column_wrapper<int32_t> expected{{1, 2, 4, 0, 3}};
+    std::vector<order> column_order{order::ASCENDING};
+    std::vector<null_order> null_precedence{null_order::BEFORE};
+    auto got = sorted_order(input, column_order, null_precedence);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+    run_sort_test(input, expected, column_order, null_precedence);
+  }
+  {
+    fixed_width_column_wrapper<int32_t> expected{{2, 4, 0, 3, 1}};
+    std::vector<order> column_order{order::ASCENDING};
+    std::vector<null_order> null_precedence{null_order::AFTER};
+    auto got = sorted_order(input, column_order, null_precedence);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+    run_sort_test(input, expected, column_order, null_precedence);
+  }
+  {
+    fixed_width_column_wrapper<int32_t> expected{{3, 0, 4, 2, 1}};
+    std::vector<order> column_order{order::DESCENDING};
+    std::vector<null_order> null_precedence{null_order::BEFORE};
+    auto got = sorted_order(input, column_order, null_precedence);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+    run_sort_test(input, expected, column_order, null_precedence);
+  }
+  {
+    fixed_width_column_wrapper<int32_t> expected{{1, 3, 0, 4, 2}};
+    std::vector<order> column_order{order::DESCENDING};
+    std::vector<null_order> null_precedence{null_order::AFTER};
+    auto got = sorted_order(input, column_order, null_precedence);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+    run_sort_test(input, expected, column_order, null_precedence);
+  }
+}
+
+TYPED_TEST(Sort, PackedCompositeKeys)
+{
+  using T = TypeParam;
+
+  // Multiple small fixed-width key columns without nulls are packed into a
+  // single 64-bit key per row; ties in the first column are broken by the
+  // second, including with mixed sort orders.
+  fixed_width_column_wrapper<T> col1{{5, 5, 2, 9, 2, 9}};
+  fixed_width_column_wrapper<int8_t> col2{{1, 2, 3, 4, 5, 6}};
+  table_view input{{col1, col2}};
+
+  {
+    fixed_width_column_wrapper<int32_t> expected{{2, 4, 0, 1, 3, 5}};
+    std::vector<order> column_order{order::ASCENDING, order::ASCENDING};
+    auto got = sorted_order(input, column_order);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+    run_sort_test(input, expected, column_order);
+  }
+  {
+    fixed_width_column_wrapper<int32_t> expected{{4, 2, 1, 0, 5, 3}};
+    std::vector<order> column_order{order::ASCENDING, order::DESCENDING};
+    auto got = sorted_order(input, column_order);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+    run_sort_test(input, expected, column_order);
+  }
+  {
+    fixed_width_column_wrapper<int32_t> expected{{3, 5, 0, 1, 2, 4}};
+    std::vector<order> column_order{order::DESCENDING, order::ASCENDING};
+    auto got = sorted_order(input, column_order);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+    run_sort_test(input, expected, column_order);
+  }
+}
+
+struct SortCompositeKeys : public BaseFixture {
+};
+
+TEST_F(SortCompositeKeys, SignedKeysWithNegatives)
+{
+  // Sign-flip key transformation must keep negative values ordered correctly.
+  fixed_width_column_wrapper<int32_t> col1{{-5, 3, -5, 0, -8, 3}};
+  fixed_width_column_wrapper<int16_t> col2{{-1, -2, 4, 0, 7, -9}};
+  table_view input{{col1, col2}};
+
+  fixed_width_column_wrapper<int32_t> expected{{4, 0, 2, 3, 5, 1}};
+  std::vector<order> column_order{order::ASCENDING, order::ASCENDING};
+  auto got = sorted_order(input, column_order);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+  run_sort_test(input, expected, column_order);
+}
+
+struct ExternalSort : public BaseFixture {
+};
+
+TEST_F(ExternalSort, ChunkedSortMatchesSort)
+{
+  fixed_width_column_wrapper<int32_t> chunk1_a{{5, 1, 9}};
+  strings_column_wrapper chunk1_b({"a", "b", "c"});
+  fixed_width_column_wrapper<int32_t> chunk2_a{{3, 1, 7}};
+  strings_column_wrapper chunk2_b({"d", "e", "f"});
+  fixed_width_column_wrapper<int32_t> chunk3_a{{0, 8}};
+  strings_column_wrapper chunk3_b({"g", "h"});
+
+  external_sorter sorter;
+  sorter.add_chunk(table_view{{chunk1_a, chunk1_b}});
+  sorter.add_chunk(table_view{{chunk2_a, chunk2_b}});
+  sorter.add_chunk(table_view{{chunk3_a, chunk3_b}});
+  auto got = sorter.sort();
+
+  fixed_width_column_wrapper<int32_t> expected_a{{0, 1, 1, 3, 5, 7, 8, 9}};
+  strings_column_wrapper expected_b({"g", "b", "e", "d", "a", "f", "h", "c"});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expected_a, expected_b}), got->view());
+}
+
+TEST_F(ExternalSort, SingleChunk)
+{
+  fixed_width_column_wrapper<int32_t> col{{5, 1, 9, 3}};
+
+  external_sorter sorter({order::DESCENDING});
+  sorter.add_chunk(table_view{{col}});
+  auto got = sorter.sort();
+
+  fixed_width_column_wrapper<int32_t> expected{{9, 5, 3, 1}};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expected}), got->view());
+}
+
+TEST_F(ExternalSort, MismatchedChunkSchema)
+{
+  fixed_width_column_wrapper<int32_t> col1{{5, 1}};
+  fixed_width_column_wrapper<int64_t> col2{{5, 1}};
+
+  external_sorter sorter;
+  sorter.add_chunk(table_view{{col1}});
+  EXPECT_THROW(sorter.add_chunk(table_view{{col2}}), logic_error);
+}
+
 TYPED_TEST(Sort, WithStructColumn)
 {
   using T = TypeParam;
@@ -709,6 +848,42 @@ TYPED_TEST(FixedPointTestBothReps, FixedPointSortedOrderGather)
   CUDF_TEST_EXPECT_TABLES_EQUAL(sorted_table, sorted->view());
 }
 
+struct BatchedSort : public BaseFixture {
+};
+
+TEST_F(BatchedSort, MatchesPerTableSort)
+{
+  fixed_width_column_wrapper<int32_t> keys1{{5, 4, 3, 5, 8}, {1, 1, 0, 1, 1}};
+  strings_column_wrapper vals1{{"d", "e", "a", "d", "k"}};
+  fixed_width_column_wrapper<int32_t> keys2{{9, 6, 7}};
+  strings_column_wrapper vals2{{"i", "f", "g"}};
+  fixed_width_column_wrapper<int32_t> keys3{};
+  strings_column_wrapper vals3{};
+
+  std::vector<table_view> inputs{
+    table_view{{keys1, vals1}}, table_view{{keys2, vals2}}, table_view{{keys3, vals3}}};
+  std::vector<order> const column_order{order::ASCENDING, order::ASCENDING};
+  std::vector<null_order> const null_precedence{null_order::AFTER, null_order::AFTER};
+
+  auto const results = batched_sort(inputs, column_order, null_precedence);
+
+  ASSERT_EQ(results.size(), inputs.size());
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    auto const expected = sort(inputs[i], column_order, null_precedence);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), results[i]->view());
+  }
+}
+
+TEST_F(BatchedSort, MismatchedSchemas)
+{
+  fixed_width_column_wrapper<int32_t> col1{{1, 2, 3}};
+  fixed_width_column_wrapper<double> col2{{1., 2., 3.}};
+
+  std::vector<table_view> inputs{table_view{{col1}}, table_view{{col2}}};
+
+  EXPECT_THROW(batched_sort(inputs), logic_error);
+}
+
 }  // namespace test
 }  // namespace cudf
 
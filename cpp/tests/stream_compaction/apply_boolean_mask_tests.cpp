@@ -366,4 +366,114 @@ TEST_F(ApplyBooleanMask, StructOfListsFiltering)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(filtered_lists_column, expected_structs_column);
 }
 
+TEST_F(ApplyBooleanMask, MaskToIndices)
+{
+  cudf::test::fixed_width_column_wrapper<bool> mask{{true, false, true, true, false, true},
+                                                    {1, 1, 0, 1, 1, 1}};
+
+  auto const indices = cudf::mask_to_indices(mask);
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected{{0, 3, 5}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, indices->view());
+
+  cudf::test::fixed_width_column_wrapper<bool> empty_mask{};
+  EXPECT_EQ(cudf::mask_to_indices(empty_mask)->size(), 0);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> not_a_mask{{1, 2, 3}};
+  EXPECT_THROW(cudf::mask_to_indices(not_a_mask), cudf::logic_error);
+}
+
+TEST_F(ApplyBooleanMask, FilterWithIndices)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{9, 8, 7, 6, 5}, {1, 1, 0, 1, 1}};
+  cudf::test::strings_column_wrapper col2{{"this", "is", "the", "a", "z"}};
+  cudf::test::fixed_width_column_wrapper<bool> mask{{true, false, true, false, true}};
+  cudf::table_view input{{col1, col2}};
+
+  auto const [result, indices] = cudf::apply_boolean_mask_with_indices(input, mask);
+
+  auto const expected = cudf::apply_boolean_mask(input, mask);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected->view(), result->view());
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected_indices{{0, 2, 4}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_indices, indices->view());
+}
+
+TEST_F(ApplyBooleanMask, BatchedMatchesPerTableFilter)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{1, 2, 3, 4, 5}, {1, 1, 0, 1, 1}};
+  cudf::test::strings_column_wrapper col2{{"a", "b", "c", "d", "e"}};
+  cudf::test::fixed_width_column_wrapper<bool> mask1{{true, false, true, true, false},
+                                                     {1, 1, 1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> col3{{6, 7, 8}};
+  cudf::test::strings_column_wrapper col4{{"f", "g", "h"}};
+  cudf::test::fixed_width_column_wrapper<bool> mask2{{false, false, false}};
+  cudf::test::fixed_width_column_wrapper<int32_t> col5{};
+  cudf::test::strings_column_wrapper col6{};
+  cudf::test::fixed_width_column_wrapper<bool> mask3{};
+
+  std::vector<cudf::table_view> inputs{
+    cudf::table_view{{col1, col2}}, cudf::table_view{{col3, col4}}, cudf::table_view{{col5, col6}}};
+  std::vector<cudf::column_view> masks{mask1, mask2, mask3};
+
+  auto const results = cudf::batched_apply_boolean_mask(inputs, masks);
+
+  ASSERT_EQ(results.size(), inputs.size());
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    auto const expected = cudf::apply_boolean_mask(inputs[i], masks[i]);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), results[i]->view());
+  }
+}
+
+TEST_F(ApplyBooleanMask, InPlaceFilter)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{1, 2, 3, 4, 5}};
+  cudf::test::fixed_width_column_wrapper<double> col2{{1.5, 2.5, 3.5, 4.5, 5.5}};
+  cudf::test::fixed_width_column_wrapper<bool> mask{{true, false, true, false, true},
+                                                    {1, 1, 1, 0, 1}};
+  cudf::table_view input{{col1, col2}};
+
+  auto dest1      = cudf::test::fixed_width_column_wrapper<int32_t>({0, 0, 0, 0, 0}).release();
+  auto dest2      = cudf::test::fixed_width_column_wrapper<double>({0, 0, 0, 0, 0}).release();
+  auto dest1_view = dest1->mutable_view();
+  auto dest2_view = dest2->mutable_view();
+  cudf::mutable_table_view destination{{dest1_view, dest2_view}};
+
+  auto const num_selected = cudf::apply_boolean_mask_in_place(input, mask, destination);
+  EXPECT_EQ(num_selected, 3);
+
+  auto const expected = cudf::apply_boolean_mask(input, mask);
+  auto const result =
+    cudf::slice(cudf::table_view{{dest1->view(), dest2->view()}}, {0, num_selected}).front();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result);
+
+  // the same destination is reusable for the next batch
+  cudf::test::fixed_width_column_wrapper<bool> mask2{{false, true, false, false, false}};
+  EXPECT_EQ(cudf::apply_boolean_mask_in_place(input, mask2, destination), 1);
+}
+
+TEST_F(ApplyBooleanMask, InPlaceDestinationTooSmall)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{1, 2, 3}};
+  cudf::test::fixed_width_column_wrapper<bool> mask{{true, true, true}};
+
+  auto dest      = cudf::test::fixed_width_column_wrapper<int32_t>({0, 0}).release();
+  auto dest_view = dest->mutable_view();
+  cudf::mutable_table_view destination{{dest_view}};
+
+  EXPECT_THROW(cudf::apply_boolean_mask_in_place(cudf::table_view{{col}}, mask, destination),
+               cudf::logic_error);
+}
+
+TEST_F(ApplyBooleanMask, BatchedSizeMismatch)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{1, 2, 3}};
+  cudf::test::fixed_width_column_wrapper<bool> mask1{{true, false, true}};
+
+  std::vector<cudf::table_view> inputs{cudf::table_view{{col1}}, cudf::table_view{{col1}}};
+  std::vector<cudf::column_view> masks{mask1};
+
+  EXPECT_THROW(cudf::batched_apply_boolean_mask(inputs, masks), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -18,6 +18,8 @@
 #include <cmath>
 #include <ctgmath>
 #include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/sorting.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -258,6 +260,65 @@ TEST_F(DistinctCount, TableWithStringColumnWithNull)
   EXPECT_EQ(10, cudf::distinct_count(input, null_equality::UNEQUAL));
 }
 
+struct ApproxDistinctCount : public cudf::test::BaseFixture {
+};
+
+TEST_F(ApproxDistinctCount, WithinErrorBound)
+{
+  // 10000 rows over 1000 distinct values; at precision 12 the expected
+  // relative error is ~1.6%, so a 10% tolerance is comfortably loose.
+  auto values = cudf::detail::make_counting_transform_iterator(
+    0, [](cudf::size_type i) { return i % 1000; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col(values, values + 10000);
+  cudf::table_view input{{col}};
+
+  auto const estimate = cudf::approx_distinct_count(input);
+  EXPECT_GT(estimate, 900);
+  EXPECT_LT(estimate, 1100);
+}
+
+TEST_F(ApproxDistinctCount, MergedSketches)
+{
+  auto first_values  = thrust::counting_iterator<int32_t>(0);
+  auto second_values = thrust::counting_iterator<int32_t>(250);
+  cudf::test::fixed_width_column_wrapper<int32_t> first_col(first_values, first_values + 500);
+  cudf::test::fixed_width_column_wrapper<int32_t> second_col(second_values, second_values + 500);
+
+  auto const first_sketch  = cudf::distinct_count_sketch(cudf::table_view{{first_col}});
+  auto const second_sketch = cudf::distinct_count_sketch(cudf::table_view{{second_col}});
+
+  // Merge by elementwise register maximum, then estimate the union: the two
+  // batches overlap on [250, 500) so the union holds 750 distinct values.
+  auto const first_registers  = cudf::test::to_host<uint8_t>(first_sketch->view()).first;
+  auto const second_registers = cudf::test::to_host<uint8_t>(second_sketch->view()).first;
+  std::vector<uint8_t> merged(first_registers.size());
+  std::transform(first_registers.begin(),
+                 first_registers.end(),
+                 second_registers.begin(),
+                 merged.begin(),
+                 [](uint8_t a, uint8_t b) { return std::max(a, b); });
+  cudf::test::fixed_width_column_wrapper<uint8_t> merged_sketch(merged.begin(), merged.end());
+
+  auto const estimate = cudf::approx_distinct_count(cudf::column_view{merged_sketch});
+  EXPECT_GT(estimate, 675);
+  EXPECT_LT(estimate, 825);
+}
+
+TEST_F(ApproxDistinctCount, InvalidArguments)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{1, 2, 3}};
+  cudf::table_view input{{col}};
+
+  EXPECT_THROW(cudf::approx_distinct_count(input, 3), cudf::logic_error);
+  EXPECT_THROW(cudf::approx_distinct_count(input, 19), cudf::logic_error);
+
+  // A sketch must be a non-nullable UINT8 column of power-of-two size
+  cudf::test::fixed_width_column_wrapper<uint8_t> bad_size(
+    thrust::counting_iterator<uint8_t>(0), thrust::counting_iterator<uint8_t>(100));
+  EXPECT_THROW(cudf::approx_distinct_count(cudf::column_view{bad_size}), cudf::logic_error);
+  EXPECT_THROW(cudf::approx_distinct_count(cudf::column_view{col}), cudf::logic_error);
+}
+
 struct DropDuplicate : public cudf::test::BaseFixture {
 };
 
@@ -309,6 +370,43 @@ TEST_F(DropDuplicate, NonNullTable)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected_unique, got_unique->view());
 }
 
+TEST_F(DropDuplicate, KeepAnyHashPath)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{40, 40, 40, 38, 42, 18}};
+  cudf::test::fixed_width_column_wrapper<int32_t> key{{20, 20, 20, 19, 21, 9}};
+  cudf::table_view input{{col, key}};
+  std::vector<cudf::size_type> keys{1};
+
+  auto got = drop_duplicates(input, keys, cudf::duplicate_keep_option::KEEP_ANY);
+
+  // KEEP_ANY output order is unspecified; sort before comparing
+  auto sorted = cudf::sort_by_key(got->view(), got->view().select({1}));
+
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col{{18, 38, 40, 42}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_key{{9, 19, 20, 21}};
+  cudf::table_view expected{{exp_col, exp_key}};
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, sorted->view());
+}
+
+TEST_F(DropDuplicate, KeepAnyWithNull)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{1, 1, 2, 3, 3}};
+  cudf::test::fixed_width_column_wrapper<int32_t> key{{20, 20, 19, 21, 21}, {0, 0, 1, 1, 1}};
+  cudf::table_view input{{col, key}};
+  std::vector<cudf::size_type> keys{1};
+
+  auto got =
+    drop_duplicates(input, keys, cudf::duplicate_keep_option::KEEP_ANY, null_equality::EQUAL);
+  auto sorted = cudf::sort_by_key(got->view(), got->view().select({1}));
+
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col{{1, 2, 3}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_key{{20, 19, 21}, {0, 1, 1}};
+  cudf::table_view expected{{exp_col, exp_key}};
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, sorted->view());
+}
+
 TEST_F(DropDuplicate, WithNull)
 {
   cudf::test::fixed_width_column_wrapper<int32_t> col{{5, 4, 3, 5, 8, 1}, {1, 0, 1, 1, 1, 1}};
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+struct FilterTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(FilterTest, SimplePredicate)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{10, 40, 70, 5, 2, 10}};
+  cudf::test::fixed_width_column_wrapper<double> col2{{1, 2, 3, 4, 5, 6}};
+  cudf::table_view input{{col1, col2}};
+
+  auto col_ref       = cudf::ast::column_reference(0);
+  auto literal_value = cudf::numeric_scalar<int32_t>(10);
+  auto literal       = cudf::ast::literal(literal_value);
+  auto predicate = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref, literal);
+
+  auto result = cudf::filter(input, predicate);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col1_expected{{10, 40, 70, 10}};
+  cudf::test::fixed_width_column_wrapper<double> col2_expected{{1, 2, 3, 6}};
+  cudf::table_view expected{{col1_expected, col2_expected}};
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result->view());
+}
+
+TEST_F(FilterTest, NullPredicateRowsDropped)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{10, 40, 70, 5}, {1, 0, 1, 1}};
+  cudf::table_view input{{col1}};
+
+  auto col_ref       = cudf::ast::column_reference(0);
+  auto literal_value = cudf::numeric_scalar<int32_t>(5);
+  auto literal       = cudf::ast::literal(literal_value);
+  auto predicate     = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref, literal);
+
+  auto result = cudf::filter(input, predicate);
+
+  // The null row compares null and is filtered out
+  cudf::test::fixed_width_column_wrapper<int32_t> col1_expected{{10, 70}, {1, 1}};
+  cudf::table_view expected{{col1_expected}};
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result->view());
+}
+
+TEST_F(FilterTest, NonBooleanPredicateThrows)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{1, 2, 3}};
+  cudf::table_view input{{col1}};
+
+  auto col_ref   = cudf::ast::column_reference(0);
+  auto predicate = cudf::ast::operation(cudf::ast::ast_operator::IDENTITY, col_ref);
+
+  EXPECT_THROW(cudf::filter(input, predicate), cudf::logic_error);
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/apply_on_distinct.hpp>
+#include <cudf/strings/case.hpp>
+#include <cudf/strings/replace.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <vector>
+
+struct StringsApplyOnDistinctTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(StringsApplyOnDistinctTest, ToLower)
+{
+  std::vector<const char*> h_strings{
+    "ACTIVE", "inactive", "ACTIVE", nullptr, "Pending", "ACTIVE", "inactive"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  auto view = cudf::strings_column_view(strings);
+
+  auto results = cudf::strings::apply_on_distinct(
+    view, [](auto const& distinct) { return cudf::strings::to_lower(distinct); });
+  auto expected = cudf::strings::to_lower(view);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, *expected);
+}
+
+TEST_F(StringsApplyOnDistinctTest, Replace)
+{
+  cudf::test::strings_column_wrapper strings({"US-1", "DE-2", "US-1", "US-1", "DE-2"});
+  auto view = cudf::strings_column_view(strings);
+
+  auto results = cudf::strings::apply_on_distinct(view, [](auto const& distinct) {
+    return cudf::strings::replace(
+      distinct, cudf::string_scalar("-"), cudf::string_scalar("_"));
+  });
+  cudf::test::strings_column_wrapper expected({"US_1", "DE_2", "US_1", "US_1", "DE_2"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(StringsApplyOnDistinctTest, EmptyAndAllNulls)
+{
+  auto to_upper_op = [](cudf::strings_column_view const& distinct) {
+    return cudf::strings::to_upper(distinct);
+  };
+  {
+    std::vector<std::string> h_strings;
+    cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+    auto results = cudf::strings::apply_on_distinct(cudf::strings_column_view(strings), to_upper_op);
+    EXPECT_EQ(results->size(), 0);
+  }
+  {
+    std::vector<const char*> h_strings{nullptr, nullptr, nullptr};
+    cudf::test::strings_column_wrapper strings(
+      h_strings.begin(),
+      h_strings.end(),
+      thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+    auto results = cudf::strings::apply_on_distinct(cudf::strings_column_view(strings), to_upper_op);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, strings);
+  }
+}
+
+TEST_F(StringsApplyOnDistinctTest, InvalidOpResults)
+{
+  cudf::test::strings_column_wrapper strings({"aa", "bb", "aa"});
+  auto view = cudf::strings_column_view(strings);
+
+  // op returning a different number of rows
+  EXPECT_THROW(cudf::strings::apply_on_distinct(
+                 view,
+                 [&](auto const&) {
+                   return std::make_unique<cudf::column>(cudf::column_view{strings});
+                 }),
+               cudf::logic_error);
+}
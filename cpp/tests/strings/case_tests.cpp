@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/strings/capitalize.hpp>
 #include <cudf/strings/case.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -53,6 +54,34 @@ TEST_F(StringsCaseTest, ToLower)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsCaseTest, AsciiOnly)
+{
+  // all-ASCII input exercises the byte-parallel conversion
+  std::vector<const char*> h_strings{
+    "Hello World", "1234567890", nullptr, "ALL UPPER", "all lower", ""};
+  std::vector<const char*> h_expected{
+    "HELLO WORLD", "1234567890", nullptr, "ALL UPPER", "ALL LOWER", ""};
+
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+
+  auto results = cudf::strings::to_upper(cudf::strings_column_view(strings));
+
+  cudf::test::strings_column_wrapper expected(
+    h_expected.begin(),
+    h_expected.end(),
+    thrust::make_transform_iterator(h_expected.begin(), [](auto str) { return str != nullptr; }));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  // a sliced column exercises the offsets rebasing
+  auto sliced         = cudf::slice(strings, {3, 6}).front();
+  auto sliced_results = cudf::strings::to_lower(cudf::strings_column_view(sliced));
+  cudf::test::strings_column_wrapper sliced_expected({"all upper", "all lower", ""});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*sliced_results, sliced_expected);
+}
+
 TEST_F(StringsCaseTest, ToUpper)
 {
   std::vector<const char*> h_strings{
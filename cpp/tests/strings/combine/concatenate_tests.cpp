@@ -97,6 +97,47 @@ TEST_F(StringsCombineTest, Concatenate)
   }
 }
 
+TEST_F(StringsCombineTest, ConcatenateGapSeparators)
+{
+  cudf::test::strings_column_wrapper strings1({"a", "bb", "ccc"}, {true, true, false});
+  cudf::test::strings_column_wrapper strings2({"dd", "e", "ff"});
+  cudf::test::strings_column_wrapper strings3({"ggg", "h", "i"});
+
+  std::vector<cudf::column_view> strings_columns;
+  strings_columns.push_back(strings1);
+  strings_columns.push_back(strings2);
+  strings_columns.push_back(strings3);
+
+  cudf::table_view table(strings_columns);
+  std::vector<std::string> separators{"_", "-"};
+
+  {
+    std::vector<const char*> h_expected{"a_dd-ggg", "bb_e-h", nullptr};
+    cudf::test::strings_column_wrapper expected(
+      h_expected.begin(),
+      h_expected.end(),
+      thrust::make_transform_iterator(h_expected.begin(), [](auto str) { return str != nullptr; }));
+
+    auto results = cudf::strings::concatenate(table, separators);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::strings_column_wrapper expected({"a_dd-ggg", "bb_e-h", "*_ff-i"});
+    auto results = cudf::strings::concatenate(table, separators, cudf::string_scalar("*"));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::strings_column_wrapper expected({"a_dd-ggg", "bb_e-h", "ff-i"});
+    auto results = cudf::strings::concatenate(
+      table, separators, cudf::string_scalar(""), cudf::strings::separator_on_nulls::NO);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+
+  // separator count must be one less than the column count
+  EXPECT_THROW(cudf::strings::concatenate(table, std::vector<std::string>{"_"}),
+               cudf::logic_error);
+}
+
 TEST_F(StringsCombineTest, ConcatenateSkipNulls)
 {
   cudf::test::strings_column_wrapper strings1({"eee", "", "", "", "aa", "bbb", "ééé"},
@@ -275,6 +275,108 @@ TEST_F(StringsContainsTests, CountTest)
   }
 }
 
+TEST_F(StringsContainsTests, LongStrings)
+{
+  // average length above 64 bytes triggers the warp-parallel contains kernel
+  std::string const padding(100, 'x');
+  std::vector<std::string> h_strings{"quick brown @fox jumps" + padding,
+                                     padding + "over the lazy @dog",
+                                     padding + "@cat naps" + padding,
+                                     padding + padding,
+                                     "",
+                                     padding + "@"};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  auto strings_view = cudf::strings_column_view(strings);
+  {
+    auto results = cudf::strings::contains_re(strings_view, "@\\w+");
+    cudf::test::fixed_width_column_wrapper<bool> expected({true, true, true, false, false, false});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    // empty pattern matches everything including the empty string
+    auto results = cudf::strings::contains_re(strings_view, "");
+    cudf::test::fixed_width_column_wrapper<bool> expected({true, true, true, true, true, true});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    // match at the very end of the string
+    auto results = cudf::strings::contains_re(strings_view, "@dog$");
+    cudf::test::fixed_width_column_wrapper<bool> expected({false, true, false, false, false, false});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
+TEST_F(StringsContainsTests, ContainsMultiple)
+{
+  std::vector<const char*> h_strings{
+    "Hello world", "123 456", "", nullptr, "tokenize 99 this", "^ $"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  auto strings_view = cudf::strings_column_view(strings);
+
+  std::vector<std::string> patterns{"\\d+", "[a-z]+", "^Hello", "\\s\\$$"};
+  auto results = cudf::strings::contains_multiple_re(strings_view, patterns);
+  ASSERT_EQ(results->num_columns(), static_cast<int>(patterns.size()));
+  for (std::size_t idx = 0; idx < patterns.size(); ++idx) {
+    auto expected = cudf::strings::contains_re(strings_view, patterns[idx]);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(idx).view(), *expected);
+  }
+
+  EXPECT_THROW(cudf::strings::contains_multiple_re(strings_view, {}), cudf::logic_error);
+}
+
+TEST_F(StringsContainsTests, SimplePatterns)
+{
+  // literals, character classes and anchors are lowered to a JIT-compiled
+  // matcher; results must be identical to the interpreted engine
+  std::vector<const char*> h_strings{"www.example.com",
+                                     "wwwXexampleYcom",
+                                     "line1\nerror\nline3",
+                                     "error",
+                                     "trailing error",
+                                     "ERROR",
+                                     nullptr,
+                                     ""};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  auto strings_view = cudf::strings_column_view(strings);
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  {
+    auto results = cudf::strings::contains_re(strings_view, "www\\.example\\.com");
+    bool h_expected[] = {true, false, false, false, false, false, false, false};
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      h_expected, h_expected + h_strings.size(), validity);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    // ^ and $ also match around newlines just like the interpreted engine
+    auto results      = cudf::strings::contains_re(strings_view, "^error$");
+    bool h_expected[] = {false, false, true, true, false, false, false, false};
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      h_expected, h_expected + h_strings.size(), validity);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results      = cudf::strings::contains_re(strings_view, "[Ee]rror");
+    bool h_expected[] = {false, false, true, true, true, false, false, false};
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      h_expected, h_expected + h_strings.size(), validity);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results      = cudf::strings::matches_re(strings_view, "error");
+    bool h_expected[] = {false, false, false, true, false, false, false, false};
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      h_expected, h_expected + h_strings.size(), validity);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
 TEST_F(StringsContainsTests, MediumRegex)
 {
   // This results in 95 regex instructions and falls in the 'medium' range.
@@ -80,6 +80,48 @@ TEST_F(StringsFindTest, Contains)
   }
 }
 
+TEST_F(StringsFindTest, ContainsLongTargets)
+{
+  // multi-byte targets exercise the skip-table search
+  cudf::test::strings_column_wrapper strings(
+    {"the quick brown fox jumps over the lazy dog",
+     "the fat cat lays next to the other accénted cat",
+     "a slow moving turtlé cannot catch the bird",
+     "which can be composéd together to form a more complete",
+     "thé result does not include the value in the sum in",
+     "",
+     "absent stop words"});
+  auto strings_view = cudf::strings_column_view(strings);
+  {
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 1, 1, 0, 1, 0, 0});
+    auto results = cudf::strings::contains(strings_view, cudf::string_scalar("the "));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<bool> expected({0, 1, 1, 1, 1, 0, 0});
+    auto results = cudf::strings::contains(strings_view, cudf::string_scalar("é"));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    // match only at the very end of a string
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 0, 0, 0, 0});
+    auto results = cudf::strings::contains(strings_view, cudf::string_scalar("lazy dog"));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    // target with repeated bytes and partial-match prefixes
+    cudf::test::fixed_width_column_wrapper<bool> expected({0, 0, 0, 0, 1, 0, 0});
+    auto results = cudf::strings::contains(strings_view, cudf::string_scalar("in the sum"));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    // target longer than some of the strings
+    cudf::test::fixed_width_column_wrapper<bool> expected({0, 0, 0, 0, 0, 0, 1});
+    auto results = cudf::strings::contains(strings_view, cudf::string_scalar("absent stop words"));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
 TEST_F(StringsFindTest, StartsWith)
 {
   cudf::test::strings_column_wrapper strings({"Héllo", "thesé", "", "lease", "tést strings", ""},
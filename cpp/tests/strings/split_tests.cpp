@@ -62,6 +62,35 @@ TEST_F(StringsSplitTest, Split)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*results, *expected);
 }
 
+TEST_F(StringsSplitTest, SplitManyColumns)
+{
+  // covers many output columns and rows spanning multiple null-mask words
+  std::vector<std::string> h_strings;
+  for (int row = 0; row < 100; ++row) {
+    std::string str;
+    for (int token = 0; token <= row % 12; ++token) {
+      if (token > 0) str += ' ';
+      str += std::to_string(token);
+    }
+    h_strings.push_back(str);
+  }
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+
+  auto results = cudf::strings::split(cudf::strings_column_view(strings), cudf::string_scalar(" "));
+  EXPECT_TRUE(results->num_columns() == 12);
+  for (int col = 0; col < results->num_columns(); ++col) {
+    auto const value = std::to_string(col);
+    std::vector<const char*> h_expected;
+    for (int row = 0; row < 100; ++row)
+      h_expected.push_back(col <= row % 12 ? value.c_str() : nullptr);
+    cudf::test::strings_column_wrapper expected(
+      h_expected.begin(),
+      h_expected.end(),
+      thrust::make_transform_iterator(h_expected.begin(), [](auto str) { return str != nullptr; }));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(col), expected);
+  }
+}
+
 TEST_F(StringsSplitTest, SplitWithMax)
 {
   cudf::test::strings_column_wrapper strings(
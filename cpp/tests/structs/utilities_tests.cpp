@@ -504,4 +504,67 @@ TYPED_TEST(TypedSuperimposeTest, NestedStruct_Sliced)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(output, expected_sliced_structs);
 }
 
+struct FlattenCacheTest : StructUtilitiesTest {
+};
+
+TEST_F(FlattenCacheTest, ReusesResultForSameInput)
+{
+  using namespace cudf::structs::detail;
+
+  auto nums_member = nums<int32_t>{{0, 1, 2}, null_at(1)};
+  auto strs_member = strings{"aa", "bb", "cc"};
+  auto structs_col = structs{{nums_member, strs_member}, null_at(2)};
+  auto input       = cudf::table_view{{structs_col}};
+
+  flattened_table_cache cache;
+  auto [first, _, __]    = cache.flatten(input, {}, {}, column_nullability::FORCE);
+  auto [second, ___, x_] = cache.flatten(input, {}, {}, column_nullability::FORCE);
+
+  auto [expected, y_, z_, owners] = flatten_nested_columns(input, {}, {}, column_nullability::FORCE);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(first, expected);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(second, expected);
+
+  // the cached validity column is handed back as-is on a repeat call
+  EXPECT_EQ(first.num_columns(), second.num_columns());
+  for (auto i = 0; i < first.num_columns(); ++i) {
+    EXPECT_EQ(first.column(i).head(), second.column(i).head());
+  }
+}
+
+TEST_F(FlattenCacheTest, RecomputesOnNewInput)
+{
+  using namespace cudf::structs::detail;
+
+  auto nums_member1 = nums<int32_t>{0, 1, 2};
+  auto structs_col1 = structs{{nums_member1}, null_at(0)};
+  auto nums_member2 = nums<int32_t>{5, 6, 7};
+  auto structs_col2 = structs{{nums_member2}, null_at(1)};
+
+  flattened_table_cache cache;
+  auto [first, _, __]  = cache.flatten(
+    cudf::table_view{{structs_col1}}, {}, {}, column_nullability::FORCE);
+  auto [second, x_, y_] = cache.flatten(
+    cudf::table_view{{structs_col2}}, {}, {}, column_nullability::FORCE);
+
+  auto [expected, z_, w_, owners] = flatten_nested_columns(
+    cudf::table_view{{structs_col2}}, {}, {}, column_nullability::FORCE);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(second, expected);
+}
+
+TEST_F(FlattenCacheTest, NoStructsPassThrough)
+{
+  using namespace cudf::structs::detail;
+
+  auto nums_col = nums<int32_t>{{0, 1, 2}, null_at(2)};
+  auto input    = cudf::table_view{{nums_col}};
+
+  flattened_table_cache cache;
+  auto [first, _, __]   = cache.flatten(input, {}, {}, column_nullability::MATCH_INCOMING);
+  auto [second, x_, y_] = cache.flatten(input, {}, {}, column_nullability::MATCH_INCOMING);
+
+  // no flattening required; the input views are returned directly
+  CUDF_TEST_EXPECT_TABLES_EQUAL(first, input);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(second, input);
+}
+
 }  // namespace cudf::test
@@ -16,8 +16,10 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/table/table.hpp>
+#include <cudf/table/table_builder.hpp>
 #include <cudf/table/table_view.hpp>
 
 #include <cudf_test/base_fixture.hpp>
@@ -150,4 +152,55 @@ TEST_F(TableTest, CreateFromViewVectorEmptyTables)
   EXPECT_EQ(final_view.num_columns(), 0);
 }
 
+struct TableBuilderTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(TableBuilderTest, MatchesConcatenate)
+{
+  column_wrapper<int32_t> ints1{{1, 2, 3, 4}};
+  s_col_wrapper strs1({"a", "bb", "ccc", ""});
+  column_wrapper<int32_t> ints2{{5, 6, 7}, {1, 0, 1}};
+  s_col_wrapper strs2({"dddd", "", "ee"}, {1, 0, 1});
+  column_wrapper<int32_t> ints3{{8}};
+  s_col_wrapper strs3({"fff"});
+
+  std::vector<TView> batches;
+  batches.emplace_back(std::vector<column_view>{ints1, strs1});
+  batches.emplace_back(std::vector<column_view>{ints2, strs2});
+  batches.emplace_back(std::vector<column_view>{ints3, strs3});
+
+  cudf::table_builder builder(
+    {cudf::data_type{cudf::type_id::INT32}, cudf::data_type{cudf::type_id::STRING}});
+  for (auto const& batch : batches) { builder.append(batch); }
+  EXPECT_EQ(builder.num_rows(), 8);
+  auto result = builder.release();
+
+  auto expected = cudf::concatenate(batches);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+
+  // the builder is empty again and can be reused
+  EXPECT_EQ(builder.num_rows(), 0);
+  builder.append(batches[1]);
+  auto reused = builder.release();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(batches[1], reused->view());
+}
+
+TEST_F(TableBuilderTest, EmptyRelease)
+{
+  cudf::table_builder builder(
+    {cudf::data_type{cudf::type_id::INT32}, cudf::data_type{cudf::type_id::STRING}});
+  auto result = builder.release();
+  EXPECT_EQ(result->num_columns(), 2);
+  EXPECT_EQ(result->num_rows(), 0);
+}
+
+TEST_F(TableBuilderTest, Errors)
+{
+  EXPECT_THROW(cudf::table_builder({cudf::data_type{cudf::type_id::LIST}}), cudf::logic_error);
+
+  cudf::table_builder builder({cudf::data_type{cudf::type_id::INT32}});
+  column_wrapper<int16_t> col{{1, 2, 3}};
+  EXPECT_THROW(builder.append(TView{std::vector<column_view>{col}}), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
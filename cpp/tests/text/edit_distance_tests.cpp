@@ -55,6 +55,42 @@ TEST_F(TextEditDistanceTest, EditDistance)
   }
 }
 
+TEST_F(TextEditDistanceTest, EditDistanceBounded)
+{
+  std::vector<const char*> h_strings{"dog", nullptr, "cat", "mouse", "pup", "", "puppy", "thé"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+
+  std::vector<const char*> h_targets{"hog", "not", "cake", "house", "fox", nullptr, "puppy", "the"};
+  cudf::test::strings_column_wrapper targets(
+    h_targets.begin(),
+    h_targets.end(),
+    thrust::make_transform_iterator(h_targets.begin(), [](auto str) { return str != nullptr; }));
+  {
+    // distances larger than the threshold are reported as max_distance + 1
+    auto results = nvtext::edit_distance_bounded(
+      cudf::strings_column_view(strings), cudf::strings_column_view(targets), 1);
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 2, 2, 1, 2, 0, 0, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    // a large enough threshold matches the unbounded result
+    auto results = nvtext::edit_distance_bounded(
+      cudf::strings_column_view(strings), cudf::strings_column_view(targets), 2);
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 3, 2, 1, 3, 0, 0, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::strings_column_wrapper single({"pup"});
+    auto results = nvtext::edit_distance_bounded(
+      cudf::strings_column_view(strings), cudf::strings_column_view(single), 2);
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({3, 3, 3, 3, 0, 3, 2, 3});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
 TEST_F(TextEditDistanceTest, EditDistanceMatrix)
 {
   std::vector<const char*> h_strings{"dog", nullptr, "hog", "frog", "cat", "", "hat", "clog"};
@@ -85,6 +121,8 @@ TEST_F(TextEditDistanceTest, EmptyTest)
   cudf::strings_column_view strings_view(strings->view());
   auto results = nvtext::edit_distance(strings_view, strings_view);
   EXPECT_EQ(results->size(), 0);
+  results = nvtext::edit_distance_bounded(strings_view, strings_view, 3);
+  EXPECT_EQ(results->size(), 0);
   results = nvtext::edit_distance_matrix(strings_view);
   EXPECT_EQ(results->size(), 0);
 }
@@ -96,5 +134,11 @@ TEST_F(TextEditDistanceTest, ErrorsTest)
   EXPECT_THROW(
     nvtext::edit_distance(cudf::strings_column_view(strings), cudf::strings_column_view(targets)),
     cudf::logic_error);
+  EXPECT_THROW(nvtext::edit_distance_bounded(
+                 cudf::strings_column_view(strings), cudf::strings_column_view(targets), 3),
+               cudf::logic_error);
+  EXPECT_THROW(nvtext::edit_distance_bounded(
+                 cudf::strings_column_view(strings), cudf::strings_column_view(strings), -1),
+               cudf::logic_error);
   EXPECT_THROW(nvtext::edit_distance_matrix(cudf::strings_column_view(strings)), cudf::logic_error);
 }
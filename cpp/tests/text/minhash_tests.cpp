@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <nvtext/minhash.hpp>
+
+#include <vector>
+
+struct TextMinHashTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(TextMinHashTest, MinHash)
+{
+  std::vector<const char*> h_strings{
+    "the fox jumped over the dog", "the dog chased the cat", nullptr, "ab", ""};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+
+  auto const results = nvtext::minhash(cudf::strings_column_view(strings), 4, 3);
+
+  using LCW = cudf::test::lists_column_wrapper<uint32_t>;
+  // clang-format off
+  LCW expected({LCW{  86520422u,  182797781u,  119591624u},
+                LCW{  86520422u,  173733841u,  265107354u},
+                LCW{},
+                LCW{2613040991u, 3087506246u, 1752756981u},
+                LCW{         0u, 1364076727u,  821347078u}});
+  // clang-format on
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(TextMinHashTest, Empty)
+{
+  auto strings = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
+  auto results = nvtext::minhash(cudf::strings_column_view(strings->view()));
+  EXPECT_EQ(results->size(), 0);
+}
+
+TEST_F(TextMinHashTest, Errors)
+{
+  cudf::test::strings_column_wrapper strings{"minhash"};
+  // invalid parameter values
+  EXPECT_THROW(nvtext::minhash(cudf::strings_column_view(strings), 1), cudf::logic_error);
+  EXPECT_THROW(nvtext::minhash(cudf::strings_column_view(strings), 4, 0), cudf::logic_error);
+}
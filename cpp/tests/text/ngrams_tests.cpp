@@ -75,6 +75,25 @@ TEST_F(TextGenerateNgramsTest, Ngrams)
   }
 }
 
+TEST_F(TextGenerateNgramsTest, NgramsHash)
+{
+  cudf::test::strings_column_wrapper strings{"the", "fox", "jumped", "over", "thé", "dog"};
+  cudf::strings_column_view strings_view(strings);
+
+  auto const results = nvtext::hash_character_ngrams(strings_view);
+
+  using LCW = cudf::test::lists_column_wrapper<uint32_t>;
+  // clang-format off
+  LCW expected({LCW{3537305573u, 2020321539u},
+                LCW{ 382126120u, 1250437857u},
+                LCW{4249848142u, 3215046089u, 3486394129u, 1837495628u, 1903873037u},
+                LCW{2256876280u, 1432087569u, 1234080729u},
+                LCW{3537305573u, 3187791043u},
+                LCW{1518651811u, 3742085266u}});
+  // clang-format on
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
 TEST_F(TextGenerateNgramsTest, NgramsWithNulls)
 {
   std::vector<const char*> h_strings{"the", "fox", "", "jumped", "over", nullptr, "the", "dog"};
@@ -106,6 +125,8 @@ TEST_F(TextGenerateNgramsTest, Empty)
   cudf::test::expect_strings_empty(results->view());
   results = nvtext::generate_character_ngrams(cudf::strings_column_view(zero_size_strings_column));
   cudf::test::expect_strings_empty(results->view());
+  results = nvtext::hash_character_ngrams(cudf::strings_column_view(zero_size_strings_column));
+  EXPECT_EQ(results->size(), 0);
 }
 
 TEST_F(TextGenerateNgramsTest, Errors)
@@ -115,6 +136,8 @@ TEST_F(TextGenerateNgramsTest, Errors)
   EXPECT_THROW(nvtext::generate_ngrams(cudf::strings_column_view(strings), 1), cudf::logic_error);
   EXPECT_THROW(nvtext::generate_character_ngrams(cudf::strings_column_view(strings), 1),
                cudf::logic_error);
+  EXPECT_THROW(nvtext::hash_character_ngrams(cudf::strings_column_view(strings), 1),
+               cudf::logic_error);
   // not enough strings to generate ngrams
   EXPECT_THROW(nvtext::generate_ngrams(cudf::strings_column_view(strings), 3), cudf::logic_error);
   EXPECT_THROW(nvtext::generate_character_ngrams(cudf::strings_column_view(strings), 3),
@@ -257,6 +257,61 @@ TEST(TextSubwordTest, TokenizeFromVocabStruct)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_metadata->view(), expected_metadata);
 }
 
+TEST(TextSubwordTest, PersistentTokenizer)
+{
+  std::vector<const char*> h_strings{"This is a test.", "This is a test. This is a tést."};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+
+  uint32_t max_sequence_length = 8;
+  uint32_t stride              = 6;
+
+  nvtext::subword_tokenizer tokenizer(hash_file,
+                                      max_sequence_length,
+                                      stride,
+                                      true,   // do_lower_case
+                                      false,  // do_truncate
+                                      MAX_ROWS_TENSOR);
+
+  auto expected = nvtext::subword_tokenize(cudf::strings_column_view{strings},
+                                           hash_file,
+                                           max_sequence_length,
+                                           stride,
+                                           true,   // do_lower_case
+                                           false,  // do_truncate
+                                           MAX_ROWS_TENSOR);
+
+  // repeated calls reuse the device vocabulary and must match the free function
+  for (int count = 0; count < 2; ++count) {
+    auto result = tokenizer.tokenize(cudf::strings_column_view{strings});
+    EXPECT_EQ(expected.nrows_tensor, result.nrows_tensor);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_token_ids->view(),
+                                   expected.tensor_token_ids->view());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_attention_mask->view(),
+                                   expected.tensor_attention_mask->view());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_metadata->view(),
+                                   expected.tensor_metadata->view());
+  }
+}
+
+TEST(TextSubwordTest, PersistentTokenizerErrors)
+{
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+
+  EXPECT_THROW(nvtext::subword_tokenizer(std::unique_ptr<nvtext::hashed_vocabulary>{},
+                                         16,
+                                         16,
+                                         true,
+                                         false,
+                                         MAX_ROWS_TENSOR),
+               cudf::logic_error);
+  // stride > max_sequence_length
+  EXPECT_THROW(nvtext::subword_tokenizer(hash_file, 8, 9, true, false, MAX_ROWS_TENSOR),
+               cudf::logic_error);
+}
+
 TEST(TextSubwordTest, LoadVocabFileErrors)
 {
   std::vector<const char*> h_strings{"This is a test.", "This is a test. This is a tést."};
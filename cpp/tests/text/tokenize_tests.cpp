@@ -149,6 +149,63 @@ TEST_F(TextTokenizeTest, TokenizeEmptyTest)
   EXPECT_EQ(results->size(), 0);
 }
 
+TEST_F(TextTokenizeTest, TokenizeVocabulary)
+{
+  std::vector<const char*> h_strings{"the fox jumped over the dog",
+                                     "the dog chased  the cat",
+                                     nullptr,
+                                     "",
+                                     "the cat chased the mousé "};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  cudf::strings_column_view strings_view(strings);
+
+  cudf::test::strings_column_wrapper vocabulary{"cat", "chased", "dog", "fox", "the"};
+  cudf::strings_column_view vocabulary_view(vocabulary);
+
+  {
+    auto results = nvtext::tokenize_with_vocabulary(strings_view, vocabulary_view);
+    cudf::test::fixed_width_column_wrapper<int32_t> expected{
+      4, 3, -1, -1, 4, 2, 4, 2, 1, 4, 0, 4, 0, 1, 4, -1};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results =
+      nvtext::tokenize_with_vocabulary(strings_view, vocabulary_view, cudf::string_scalar(" "), 99);
+    cudf::test::fixed_width_column_wrapper<int32_t> expected{
+      4, 3, 99, 99, 4, 2, 4, 2, 1, 4, 0, 4, 0, 1, 4, 99};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
+TEST_F(TextTokenizeTest, TokenizeVocabularyErrors)
+{
+  cudf::test::strings_column_wrapper strings{"this column intentionally left blank"};
+  cudf::strings_column_view strings_view(strings);
+
+  {
+    cudf::test::strings_column_wrapper vocabulary;  // empty vocabulary
+    EXPECT_THROW(
+      nvtext::tokenize_with_vocabulary(strings_view, cudf::strings_column_view(vocabulary)),
+      cudf::logic_error);
+  }
+  {
+    cudf::test::strings_column_wrapper vocabulary({"", ""}, {0, 0});  // null vocabulary
+    EXPECT_THROW(
+      nvtext::tokenize_with_vocabulary(strings_view, cudf::strings_column_view(vocabulary)),
+      cudf::logic_error);
+  }
+  {
+    cudf::test::strings_column_wrapper vocabulary{"blank"};
+    EXPECT_THROW(nvtext::tokenize_with_vocabulary(strings_view,
+                                                  cudf::strings_column_view(vocabulary),
+                                                  cudf::string_scalar("", false)),
+                 cudf::logic_error);
+  }
+}
+
 TEST_F(TextTokenizeTest, Detokenize)
 {
   cudf::test::strings_column_wrapper strings{
@@ -18,10 +18,12 @@
  */
 
 #include <cudf/detail/iterator.cuh>
+#include <cudf/table/table_view.hpp>
 #include <cudf/transform.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 
 #include "assert-unary.h"
@@ -225,6 +227,62 @@ __device__ inline void f(cudf::timestamp_us* output, cudf::timestamp_us input)
   test_udf<dtype>(cuda, op, data_init, 500, false);
 }
 
+struct NaryOperationIntegrationTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(NaryOperationIntegrationTest, Transform_Nary_FP32)
+{
+  // out = a * b + c
+  const char cuda[] =
+    R"***(
+__device__ inline void f(float* output, float a, float b, float c)
+{
+  *output = a * b + c;
+}
+)***";
+
+  auto a = cudf::test::fixed_width_column_wrapper<float>{{1.5, 2.0, 3.0, 4.0}};
+  auto b = cudf::test::fixed_width_column_wrapper<float>{{2.0, 0.5, 3.0, 0.0}};
+  auto c = cudf::test::fixed_width_column_wrapper<float>{{1.0, 1.0, 1.0, 7.0}};
+
+  auto const expected = cudf::test::fixed_width_column_wrapper<float>{{4.0, 2.0, 10.0, 7.0}};
+  auto const result   = cudf::transform(
+    cudf::table_view{{a, b, c}}, cuda, data_type(type_to_id<float>()), false);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(NaryOperationIntegrationTest, Transform_Nary_Null_Mask)
+{
+  // The output is null wherever any input is null.
+  const char cuda[] =
+    "__device__ inline void f(int* output, int a, int b){*output = a + b;}";
+
+  auto a = cudf::test::fixed_width_column_wrapper<int>{{1, 2, 3, 4}, {1, 0, 1, 1}};
+  auto b = cudf::test::fixed_width_column_wrapper<int>{{10, 20, 30, 40}, {1, 1, 0, 1}};
+
+  auto const expected =
+    cudf::test::fixed_width_column_wrapper<int>{{11, 0, 0, 44}, {1, 0, 0, 1}};
+  auto const result =
+    cudf::transform(cudf::table_view{{a, b}}, cuda, data_type(type_to_id<int>()), false);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(NaryOperationIntegrationTest, Transform_Nary_Invalid_Input)
+{
+  const char cuda[] = "__device__ inline void f(int* output, int a){*output = a;}";
+
+  EXPECT_THROW(
+    cudf::transform(cudf::table_view{}, cuda, data_type(type_to_id<int>()), false),
+    cudf::logic_error);
+
+  auto strings = cudf::test::strings_column_wrapper({"a", "b"});
+  EXPECT_THROW(
+    cudf::transform(cudf::table_view{{strings}}, cuda, data_type(type_to_id<int>()), false),
+    cudf::logic_error);
+}
+
 }  // namespace transformation
 }  // namespace test
 }  // namespace cudf
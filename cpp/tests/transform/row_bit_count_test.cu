@@ -30,6 +30,8 @@
 #include <thrust/fill.h>
 #include <thrust/tabulate.h>
 
+#include <numeric>
+
 using namespace cudf;
 
 template <typename T>
@@ -712,3 +714,52 @@ TEST_F(RowBitCount, EmptyTable)
     CUDF_EXPECTS(result != nullptr && result->size() == 0, "Expected an empty column");
   }
 }
+
+struct SegmentedRowBitCount : public cudf::test::BaseFixture {
+};
+
+TEST_F(SegmentedRowBitCount, FixedWidth)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> c0{1, 2, 3, 4, 5, 6, 7};
+  cudf::test::fixed_width_column_wrapper<int16_t> c1{1, 2, 3, 4, 5, 6, 7};
+  table_view t({c0, c1});
+
+  // 48 bits per row, segments of 3 rows; the last segment covers 1 row.
+  auto result = cudf::segmented_row_bit_count(t, 3);
+  cudf::test::fixed_width_column_wrapper<size_type> expected{144, 144, 48};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+}
+
+TEST_F(SegmentedRowBitCount, MatchesRowBitCountSum)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> c0{0, 1, 2, 3, 4, 5, 6, 7};
+  std::vector<std::string> strings{"daïs", "def", "", "z", "bananas", "warp", "", "zing"};
+  cudf::test::strings_column_wrapper c1(strings.begin(), strings.end());
+  table_view t({c0, c1});
+
+  auto const segment_length = 3;
+  auto const per_row        = cudf::row_bit_count(t);
+  auto const result         = cudf::segmented_row_bit_count(t, segment_length);
+
+  // compare against a host-side segment sum of the per-row output
+  auto const h_sizes = cudf::test::to_host<size_type>(*per_row).first;
+  std::vector<size_type> h_expected;
+  for (size_type i = 0; i < static_cast<size_type>(h_sizes.size()); i += segment_length) {
+    auto const end = std::min(i + segment_length, static_cast<size_type>(h_sizes.size()));
+    h_expected.push_back(std::accumulate(h_sizes.begin() + i, h_sizes.begin() + end, 0));
+  }
+  cudf::test::fixed_width_column_wrapper<size_type> expected(h_expected.begin(), h_expected.end());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+}
+
+TEST_F(SegmentedRowBitCount, EmptyTableAndErrors)
+{
+  cudf::table_view empty;
+  auto result = cudf::segmented_row_bit_count(empty, 4);
+  CUDF_EXPECTS(result != nullptr && result->size() == 0, "Expected an empty column");
+
+  cudf::test::fixed_width_column_wrapper<int32_t> c0{1, 2, 3};
+  table_view t({c0});
+  EXPECT_THROW(cudf::segmented_row_bit_count(t, 0), cudf::logic_error);
+  EXPECT_THROW(cudf::segmented_row_bit_count(t, -1), cudf::logic_error);
+}
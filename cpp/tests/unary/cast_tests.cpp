@@ -742,6 +742,21 @@ TYPED_TEST(FixedPointTests, FixedPointToFixedPointSameTypeidDown)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
 }
 
+TYPED_TEST(FixedPointTests, FixedPointToFixedPointSameTypeidUpNullMask)
+{
+  using namespace numeric;
+  using decimalXX  = TypeParam;
+  using RepType    = cudf::device_storage_type_t<decimalXX>;
+  using fp_wrapper = cudf::test::fixed_point_column_wrapper<RepType>;
+
+  auto const vec      = std::vector<int32_t>{1729, 17290, 172900, 1729000};
+  auto const input    = fp_wrapper{vec.cbegin(), vec.cend(), {1, 0, 1, 1}, scale_type{-3}};
+  auto const expected = fp_wrapper{{172, 1729, 17290, 172900}, {1, 0, 1, 1}, scale_type{-2}};
+  auto const result   = cudf::cast(input, make_fixed_point_data_type<decimalXX>(-2));
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
 TYPED_TEST(FixedPointTests, FixedPointToFixedPointSameTypeidUpPositive)
 {
   using namespace numeric;
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/binaryop.hpp>
+#include <cudf/utilities/cuda_graph.hpp>
+#include <cudf/utilities/stream_pool.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <rmm/cuda_stream.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/mr/device/pool_memory_resource.hpp>
+
+struct CudaGraphTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(CudaGraphTest, IsStreamCapturing)
+{
+  rmm::cuda_stream stream;
+  EXPECT_FALSE(cudf::is_stream_capturing(stream.view()));
+}
+
+TEST_F(CudaGraphTest, CaptureAndReplayBinaryOperation)
+{
+  // Allocations during capture must not make CUDA calls, so route them
+  // through a pool and warm it up by running the work once before capturing
+  rmm::mr::pool_memory_resource<rmm::mr::device_memory_resource> pool{
+    rmm::mr::get_current_device_resource()};
+  auto* old_mr = rmm::mr::set_current_device_resource(&pool);
+
+  auto lhs = cudf::test::fixed_width_column_wrapper<int32_t>{{1, 2, 3, 4}};
+  auto rhs = cudf::test::fixed_width_column_wrapper<int32_t>{{10, 20, 30, 40}};
+
+  rmm::cuda_stream stream;
+  auto const run = [&](rmm::cuda_stream_view s) {
+    return cudf::binary_operation(
+      lhs, rhs, cudf::binary_operator::ADD, cudf::data_type{cudf::type_id::INT32}, s);
+  };
+  // Warm-up pass outside of capture
+  { auto const warmup = run(stream.view()); }
+
+  std::unique_ptr<cudf::column> result;
+  auto const graph = cudf::cuda_graph::capture(
+    [&](rmm::cuda_stream_view s) { result = run(s); }, stream.view());
+
+  graph.launch(stream.view());
+  stream.synchronize();
+
+  auto const expected = cudf::test::fixed_width_column_wrapper<int32_t>{{11, 22, 33, 44}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+
+  rmm::mr::set_current_device_resource(old_mr);
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/binaryop.hpp>
+#include <cudf/utilities/metrics.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <string>
+#include <vector>
+
+struct MetricsTest : public cudf::test::BaseFixture {
+  ~MetricsTest() { cudf::set_metrics_callback({}); }
+};
+
+TEST_F(MetricsTest, CallbackReceivesOperation)
+{
+  std::vector<cudf::operation_metrics> reported;
+  cudf::set_metrics_callback(
+    [&reported](cudf::operation_metrics const& metrics) { reported.push_back(metrics); });
+
+  auto lhs = cudf::test::fixed_width_column_wrapper<int32_t>{{1, 2, 3, 4}};
+  auto rhs = cudf::test::fixed_width_column_wrapper<int32_t>{{10, 20, 30, 40}};
+  auto const result = cudf::binary_operation(
+    lhs, rhs, cudf::binary_operator::ADD, cudf::data_type{cudf::type_id::INT32});
+
+  ASSERT_EQ(reported.size(), std::size_t{1});
+  EXPECT_EQ(std::string{reported.front().name}, "binary_operation");
+  EXPECT_EQ(reported.front().num_rows, 4);
+  EXPECT_GE(reported.front().wall_time.count(), 0);
+}
+
+TEST_F(MetricsTest, NoCallbackNoReport)
+{
+  std::size_t num_reports = 0;
+  cudf::set_metrics_callback(
+    [&num_reports](cudf::operation_metrics const&) { ++num_reports; });
+  cudf::set_metrics_callback({});
+
+  auto lhs = cudf::test::fixed_width_column_wrapper<int32_t>{{1, 2, 3, 4}};
+  auto rhs = cudf::test::fixed_width_column_wrapper<int32_t>{{10, 20, 30, 40}};
+  auto const result = cudf::binary_operation(
+    lhs, rhs, cudf::binary_operator::ADD, cudf::data_type{cudf::type_id::INT32});
+
+  EXPECT_EQ(num_reports, std::size_t{0});
+}
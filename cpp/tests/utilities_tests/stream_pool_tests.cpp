@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/binaryop.hpp>
+#include <cudf/utilities/stream_pool.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+struct StreamPoolTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(StreamPoolTest, PooledStreamsAreValid)
+{
+  auto const size = cudf::stream_pool().get_pool_size();
+  EXPECT_GT(size, std::size_t{0});
+  for (std::size_t i = 0; i < size; ++i) {
+    auto const stream = cudf::get_stream_from_pool();
+    EXPECT_NO_THROW(stream.synchronize());
+  }
+}
+
+TEST_F(StreamPoolTest, BinaryOperationOnPooledStream)
+{
+  auto lhs = cudf::test::fixed_width_column_wrapper<int32_t>{{1, 2, 3, 4}};
+  auto rhs = cudf::test::fixed_width_column_wrapper<int32_t>{{10, 20, 30, 40}};
+  auto const stream = cudf::get_stream_from_pool();
+  auto const result = cudf::binary_operation(lhs,
+                                             rhs,
+                                             cudf::binary_operator::ADD,
+                                             cudf::data_type{cudf::type_id::INT32},
+                                             stream);
+  stream.synchronize();
+  auto const expected = cudf::test::fixed_width_column_wrapper<int32_t>{{11, 22, 33, 44}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
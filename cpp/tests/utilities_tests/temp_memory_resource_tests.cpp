@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/temp_memory_resource.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <rmm/cuda_stream.hpp>
+#include <rmm/mr/device/arena_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+struct TempMemoryResourceTest : public cudf::test::BaseFixture {
+  ~TempMemoryResourceTest() { cudf::set_temp_memory_resource(nullptr); }
+};
+
+TEST_F(TempMemoryResourceTest, DefaultsToCurrentDeviceResource)
+{
+  EXPECT_EQ(rmm::mr::get_current_device_resource(), cudf::get_temp_memory_resource());
+}
+
+TEST_F(TempMemoryResourceTest, SetAndReset)
+{
+  rmm::mr::arena_memory_resource<rmm::mr::device_memory_resource> arena{
+    rmm::mr::get_current_device_resource()};
+
+  auto* previous = cudf::set_temp_memory_resource(&arena);
+  EXPECT_EQ(nullptr, previous);
+  EXPECT_EQ(&arena, cudf::get_temp_memory_resource());
+
+  // Allocations through the installed resource are usable
+  rmm::cuda_stream stream;
+  auto* ptr = cudf::get_temp_memory_resource()->allocate(1024, stream.view());
+  cudf::get_temp_memory_resource()->deallocate(ptr, 1024, stream.view());
+  stream.synchronize();
+
+  previous = cudf::set_temp_memory_resource(nullptr);
+  EXPECT_EQ(&arena, previous);
+  EXPECT_EQ(rmm::mr::get_current_device_resource(), cudf::get_temp_memory_resource());
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/working_memory.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+struct WorkingMemoryTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(WorkingMemoryTest, HashJoinEstimate)
+{
+  auto const small = cudf::estimate_working_memory(cudf::hash_join_memory_descriptor{1000});
+  auto const large = cudf::estimate_working_memory(cudf::hash_join_memory_descriptor{1000000});
+
+  // At least one entry per build row at 50% occupancy, plus the row hashes
+  EXPECT_GE(small, std::size_t{2 * 1000 * 8});
+  EXPECT_GT(large, small);
+  EXPECT_EQ(cudf::estimate_working_memory(cudf::hash_join_memory_descriptor{0}), std::size_t{0});
+}
+
+TEST_F(WorkingMemoryTest, SortEstimate)
+{
+  auto const estimate =
+    cudf::estimate_working_memory(cudf::sort_memory_descriptor{1000, sizeof(int64_t)});
+
+  // Double-buffered keys and permutation indices
+  EXPECT_GE(estimate, std::size_t{2 * 1000 * (sizeof(int64_t) + sizeof(cudf::size_type))});
+}
+
+TEST_F(WorkingMemoryTest, FixedWidthRowBytes)
+{
+  auto col32   = cudf::test::fixed_width_column_wrapper<int32_t>{{1, 2, 3}};
+  auto col64   = cudf::test::fixed_width_column_wrapper<int64_t>{{1, 2, 3}};
+  auto strings = cudf::test::strings_column_wrapper{"a", "b", "c"};
+
+  EXPECT_EQ(cudf::fixed_width_row_bytes(cudf::table_view{{col32, col64}}),
+            sizeof(int32_t) + sizeof(int64_t));
+  // Variable-width columns contribute their offsets
+  EXPECT_EQ(cudf::fixed_width_row_bytes(cudf::table_view{{col32, strings}}),
+            sizeof(int32_t) + sizeof(cudf::offset_type));
+}
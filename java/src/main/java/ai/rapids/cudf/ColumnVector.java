@@ -63,6 +63,36 @@ public final class ColumnVector extends ColumnView {
     incRefCountInternal(true);
   }
 
+  /**
+   * Wrap an existing on device cudf::column with the corresponding ColumnVector. The new
+   * ColumnVector takes ownership of the pointer and will free it when the ref count reaches zero.
+   * Unlike {@link #ColumnVector(long)} all of the metadata and the view for the column was
+   * already fetched from the native code, typically in a single batched JNI call covering every
+   * column in a table, so constructing the vector makes no additional JNI calls.
+   * @param nativePointer host address of the cudf::column object which will be owned by this
+   *                      instance.
+   * @param viewHandle host address of a cudf::column_view for the column. Ownership of the view
+   *                   is also taken by this instance.
+   * @param type the type of the column
+   * @param rows the number of rows in the column
+   * @param nullCount the number of nulls in the column
+   * @param data a view of the data buffer for the column, may be null
+   * @param valid a view of the validity buffer for the column, may be null
+   * @param offsets a view of the offsets buffer for the column, may be null
+   */
+  ColumnVector(long nativePointer, long viewHandle, DType type, long rows, long nullCount,
+               DeviceMemoryBufferView data, DeviceMemoryBufferView valid,
+               DeviceMemoryBufferView offsets) {
+    super(viewHandle, type, rows, nullCount);
+    assert nativePointer != 0;
+    assert viewHandle != 0;
+    offHeap = new OffHeapState(nativePointer, viewHandle, data, valid, offsets);
+    MemoryCleaner.register(this, offHeap);
+    this.nullCount = Optional.of(nullCount);
+    this.refCount = 0;
+    incRefCountInternal(true);
+  }
+
   /**
    * Create a new column vector based off of data already on the device.
    * @param type the type of the vector
@@ -920,6 +950,20 @@ public final class ColumnVector extends ColumnView {
       this.toClose.add(getOffsets());
     }
 
+    /**
+     * Make a column from an existing cudf::column * and a cudf::column_view * whose buffers
+     * were already fetched from the native code, so no JNI calls are needed.
+     */
+    public OffHeapState(long columnHandle, long viewHandle,
+                        BaseDeviceMemoryBuffer data, BaseDeviceMemoryBuffer valid,
+                        BaseDeviceMemoryBuffer offsets) {
+      this.columnHandle = columnHandle;
+      this.viewHandle = viewHandle;
+      this.toClose.add(data);
+      this.toClose.add(valid);
+      this.toClose.add(offsets);
+    }
+
     /**
      * Create a cudf::column_view from device side data.
      */
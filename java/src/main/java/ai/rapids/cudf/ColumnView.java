@@ -48,6 +48,22 @@ public class ColumnView implements AutoCloseable, BinaryOperable {
     this.nullCount = ColumnView.getNativeNullCount(viewHandle);
   }
 
+  /**
+   * Constructs a Column View given a native view address along with metadata that was already
+   * fetched from the native code. This avoids several JNI calls per column when the metadata
+   * for all of the columns in a table was retrieved in a single batched call.
+   * @param address the view handle
+   * @param type the type of the column
+   * @param rows the number of rows in the column
+   * @param nullCount the number of nulls in the column
+   */
+  ColumnView(long address, DType type, long rows, long nullCount) {
+    this.viewHandle = address;
+    this.type = type;
+    this.rows = rows;
+    this.nullCount = nullCount;
+  }
+
   /**
    * Create a new column view based off of data already on the device. Ref count on the buffers
    * is not incremented and none of the underlying buffers are owned by this view. The returned
@@ -83,12 +83,25 @@ public final class Table implements AutoCloseable {
     assert cudfColumns != null && cudfColumns.length > 0 : "CudfColumns can't be null or empty";
     this.columns = new ColumnVector[cudfColumns.length];
     try {
+      // Fetch the views and the metadata for all of the columns in a single batched JNI call
+      // instead of making several calls for each column.
+      long[] metadata = columnMetadataFromColumns(cudfColumns);
+      long[] views = new long[cudfColumns.length];
       for (int i = 0; i < cudfColumns.length; i++) {
-        this.columns[i] = new ColumnVector(cudfColumns[i]);
-      }
-      long[] views = new long[columns.length];
-      for (int i = 0; i < columns.length; i++) {
-        views[i] = columns[i].getNativeView();
+        int at = i * BATCHED_COLUMN_METADATA_SIZE;
+        long viewHandle = metadata[at];
+        DType type = DType.fromNative((int) metadata[at + 1], (int) metadata[at + 2]);
+        long rows = metadata[at + 3];
+        long nullCount = metadata[at + 4];
+        DeviceMemoryBufferView data = metadata[at + 5] == 0 ? null :
+            new DeviceMemoryBufferView(metadata[at + 5], metadata[at + 6]);
+        DeviceMemoryBufferView valid = metadata[at + 7] == 0 ? null :
+            new DeviceMemoryBufferView(metadata[at + 7], metadata[at + 8]);
+        DeviceMemoryBufferView offsets = metadata[at + 9] == 0 ? null :
+            new DeviceMemoryBufferView(metadata[at + 9], metadata[at + 10]);
+        this.columns[i] = new ColumnVector(cudfColumns[i], viewHandle, type, rows, nullCount,
+            data, valid, offsets);
+        views[i] = viewHandle;
       }
       nativeHandle = createCudfTableView(views);
       this.rows = columns[0].getRowCount();
@@ -647,6 +660,22 @@ public final class Table implements AutoCloseable {
 
   private static native long createCudfTableView(long[] nativeColumnViewHandles);
 
+  /**
+   * The number of longs of metadata returned for each column by
+   * {@link #columnMetadataFromColumns(long[])}. This must be kept in sync with the native code.
+   */
+  private static final int BATCHED_COLUMN_METADATA_SIZE = 11;
+
+  /**
+   * Fetch the view handle, type, row count, null count, and buffer addresses/lengths for each
+   * cudf::column in a single JNI call. The result holds
+   * {@link #BATCHED_COLUMN_METADATA_SIZE} longs per column: the view handle (owned by the
+   * caller), the type id, the type scale, the row count, the null count, and the address and
+   * length of the data, validity, and offsets buffers in that order. A zero address means the
+   * column does not have that buffer.
+   */
+  private static native long[] columnMetadataFromColumns(long[] cudfColumnHandles) throws CudfException;
+
   private static native long[] columnViewsFromPacked(ByteBuffer metadata, long dataAddress);
 
   private static native ContiguousTable[] contiguousSplitGroups(long inputTable,
@@ -2603,8 +2632,8 @@ public final class Table implements AutoCloseable {
 
   /**
    * Convert this table of columns into a row major format that is useful for interacting with other
-   * systems that do row major processing of the data. Currently only fixed-width column types are
-   * supported.
+   * systems that do row major processing of the data. Currently only fixed-width and string column
+   * types are supported.
    * <p/>
    * The output is one or more ColumnVectors that are lists of bytes. A ColumnVector that is a
    * list of bytes can have at most 2GB of data stored in it. Multiple ColumnVectors are returned
@@ -2634,6 +2663,12 @@ public final class Table implements AutoCloseable {
    * row. Because the validity is byte aligned there is no padding between it and the last column
    * in the row.
    * <p/>
+   * String columns take up 8 bytes in the fixed width section of the row. This is a 32-bit offset
+   * into the row followed by a 32-bit length. The character data itself is packed in after the
+   * validity bytes and the row is then padded out to a 64-bit boundary. Because rows that contain
+   * string data vary in size the output cannot be split into multiple batches, so the entire
+   * result must fit in a single 2GB ColumnVector.
+   * <p/>
    * For example a table consisting of the following columns A, B, C with the corresponding types
    * <p/><pre>
    *   | A - BOOL8 (8-bit) | B - INT16 (16-bit) | C - DURATION_DAYS (32-bit) |
@@ -30,7 +30,9 @@
 #include <cudf/io/parquet.hpp>
 #include <cudf/join.hpp>
 #include <cudf/lists/explode.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/merge.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/partitioning.hpp>
 #include <cudf/replace.hpp>
 #include <cudf/reshape.hpp>
@@ -38,6 +40,7 @@
 #include <cudf/search.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/stream_compaction.hpp>
+#include <cudf/strings/strings_column_view.hpp>
 #include <cudf/types.hpp>
 #include <rmm/cuda_stream_view.hpp>
 
@@ -1032,6 +1035,80 @@ JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_Table_createCudfTableView(JNIEnv *en
   CATCH_STD(env, 0);
 }
 
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_columnMetadataFromColumns(
+    JNIEnv *env, jclass, jlongArray j_cudf_columns) {
+  JNI_NULL_CHECK(env, j_cudf_columns, "columns are null", 0);
+
+  try {
+    cudf::jni::auto_set_device(env);
+    cudf::jni::native_jpointerArray<cudf::column> n_cudf_columns(env, j_cudf_columns);
+
+    // The layout of the metadata written for each column must be kept in sync
+    // with BATCHED_COLUMN_METADATA_SIZE and the parsing code in Table.java
+    constexpr int metadata_size = 11;
+    cudf::jni::native_jlongArray metadata(env, n_cudf_columns.size() * metadata_size);
+    for (int i = 0; i < n_cudf_columns.size(); i++) {
+      cudf::column *column = n_cudf_columns[i];
+      // TODO Exception handling is not ideal. If an exception is thrown part way through then the
+      // views created by earlier iterations are leaked, but like columnViewsFromPacked it is a
+      // small amount of host memory and coordinating the cleanup with the Java side is not worth
+      // the complexity.
+      std::unique_ptr<cudf::column_view> view(new cudf::column_view());
+      *view.get() = column->view();
+
+      jlong data_address = 0;
+      jlong data_length = 0;
+      jlong offsets_address = 0;
+      jlong offsets_length = 0;
+      cudf::type_id type_id = view->type().id();
+      if (type_id == cudf::type_id::STRING) {
+        if (view->size() > 0) {
+          cudf::strings_column_view strings_view(*view);
+          cudf::column_view data_view = strings_view.chars();
+          data_address = reinterpret_cast<jlong>(data_view.data<char>());
+          data_length = data_view.size();
+          cudf::column_view offsets_view = strings_view.offsets();
+          offsets_address = reinterpret_cast<jlong>(offsets_view.data<char>());
+          offsets_length = sizeof(int) * offsets_view.size();
+        }
+      } else if (type_id == cudf::type_id::LIST) {
+        if (view->size() > 0) {
+          cudf::lists_column_view lists_view(*view);
+          cudf::column_view offsets_view = lists_view.offsets();
+          offsets_address = reinterpret_cast<jlong>(offsets_view.data<char>());
+          offsets_length = sizeof(int) * offsets_view.size();
+        }
+      } else if (type_id != cudf::type_id::STRUCT) {
+        data_address = reinterpret_cast<jlong>(view->data<char>());
+        data_length = cudf::size_of(view->type()) * view->size();
+      }
+      jlong validity_address = reinterpret_cast<jlong>(view->null_mask());
+      jlong validity_length =
+          view->null_mask() == nullptr ?
+              0 :
+              static_cast<jlong>(cudf::bitmask_allocation_size_bytes(view->size()));
+
+      int at = i * metadata_size;
+      metadata[at + 1] = static_cast<jlong>(type_id);
+      metadata[at + 2] = view->type().scale();
+      metadata[at + 3] = view->size();
+      metadata[at + 4] = view->null_count();
+      metadata[at + 5] = data_address;
+      metadata[at + 6] = data_length;
+      metadata[at + 7] = validity_address;
+      metadata[at + 8] = validity_length;
+      metadata[at + 9] = offsets_address;
+      metadata[at + 10] = offsets_length;
+      // Ownership of the view passes to the Java side, so release it last in case
+      // anything above throws.
+      metadata[at] = reinterpret_cast<jlong>(view.release());
+    }
+    metadata.commit();
+    return metadata.get_jArray();
+  }
+  CATCH_STD(env, 0);
+}
+
 JNIEXPORT void JNICALL Java_ai_rapids_cudf_Table_deleteCudfTable(JNIEnv *env, jclass,
                                                                  jlong j_cudf_table_view) {
   JNI_NULL_CHECK(env, j_cudf_table_view, "table view handle is null", );
@@ -17,15 +17,24 @@
 #include <iostream>
 #include <limits>
 
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/sequence.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/strings/string_view.cuh>
 #include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/transform_reduce.h>
+#include <thrust/transform_scan.h>
 
 #include "row_conversion.hpp"
 
@@ -304,6 +313,159 @@ copy_from_fixed_width_columns(const cudf::size_type start_row, const cudf::size_
   }
 }
 
+/**
+ * Copy data from the columns into rows that can contain both fixed width and
+ * string data. Each thread copies one entire row so, unlike the fixed width
+ * kernels, no shared memory staging or validity ballot is needed. Strings
+ * occupy a (offset, length) pair of 32-bit values in the fixed width section
+ * of the row with the character data packed after the validity bytes.
+ */
+__global__ void copy_from_columns_to_var_rows(const cudf::size_type num_rows,
+                                              const cudf::size_type num_columns,
+                                              const cudf::size_type *output_offset_in_row,
+                                              const cudf::size_type *num_bytes,
+                                              const cudf::size_type fixed_width_size,
+                                              cudf::table_device_view input,
+                                              const int32_t *row_offsets, int8_t *output_data) {
+
+  cudf::size_type validity_offset =
+      output_offset_in_row[num_columns - 1] + num_bytes[num_columns - 1];
+  cudf::size_type validity_bytes = (num_columns + 7) / 8;
+
+  for (cudf::size_type row_index = (blockIdx.x * blockDim.x) + threadIdx.x; row_index < num_rows;
+       row_index += blockDim.x * gridDim.x) {
+    int8_t *row_tmp = &output_data[row_offsets[row_index]];
+    int8_t *row_vld_tmp = &row_tmp[validity_offset];
+    // This thread owns the entire row so validity can be written a byte at a time
+    for (cudf::size_type b = 0; b < validity_bytes; b++) {
+      row_vld_tmp[b] = 0;
+    }
+
+    int32_t var_offset = fixed_width_size;
+    for (cudf::size_type col_index = 0; col_index < num_columns; col_index++) {
+      cudf::column_device_view col = input.column(col_index);
+      int8_t *col_tmp = &(row_tmp[output_offset_in_row[col_index]]);
+      bool is_valid = col.is_valid(row_index);
+      if (col.type().id() == cudf::type_id::STRING) {
+        int32_t length = 0;
+        if (is_valid) {
+          cudf::string_view d_str = col.element<cudf::string_view>(row_index);
+          length = d_str.size_bytes();
+          const char *str_input = d_str.data();
+          char *str_output = reinterpret_cast<char *>(&row_tmp[var_offset]);
+          for (int32_t b = 0; b < length; b++) {
+            str_output[b] = str_input[b];
+          }
+        }
+        reinterpret_cast<int32_t *>(col_tmp)[0] = var_offset;
+        reinterpret_cast<int32_t *>(col_tmp)[1] = length;
+        var_offset += length;
+      } else {
+        cudf::size_type col_size = num_bytes[col_index];
+        const int8_t *col_input = col.head<int8_t>() + ((col.offset() + row_index) * col_size);
+        switch (col_size) {
+          case 1: {
+            *col_tmp = *col_input;
+            break;
+          }
+          case 2: {
+            *reinterpret_cast<int16_t *>(col_tmp) = *reinterpret_cast<const int16_t *>(col_input);
+            break;
+          }
+          case 4: {
+            *reinterpret_cast<int32_t *>(col_tmp) = *reinterpret_cast<const int32_t *>(col_input);
+            break;
+          }
+          case 8: {
+            *reinterpret_cast<int64_t *>(col_tmp) = *reinterpret_cast<const int64_t *>(col_input);
+            break;
+          }
+          default: {
+            for (cudf::size_type b = 0; b < col_size; b++) {
+              col_tmp[b] = col_input[b];
+            }
+            break;
+          }
+        }
+      }
+      if (is_valid) {
+        row_vld_tmp[col_index / 8] |= (1 << (col_index % 8));
+      }
+    } // end column loop
+  }
+}
+
+/**
+ * Copy data from rows that can contain both fixed width and string data back
+ * into columns. The character data for each string column is copied into a
+ * chars buffer whose offsets were computed in advance on the device, so each
+ * thread can again copy one entire row independently. Validity is or-ed into
+ * masks that start out all null; rows within a 32-bit validity word are always
+ * processed by the same block so block scoped atomics are sufficient.
+ */
+__global__ void copy_from_var_rows_to_columns(
+    const cudf::size_type num_rows, const cudf::size_type num_columns,
+    const cudf::size_type *input_offset_in_row, const cudf::size_type *num_bytes,
+    const int8_t *is_string, int8_t **output_data, int32_t **output_str_offsets,
+    cudf::bitmask_type **output_nm, const int32_t *row_offsets, const int8_t *input_data) {
+
+  cudf::size_type validity_offset =
+      input_offset_in_row[num_columns - 1] + num_bytes[num_columns - 1];
+
+  for (cudf::size_type row_index = (blockIdx.x * blockDim.x) + threadIdx.x; row_index < num_rows;
+       row_index += blockDim.x * gridDim.x) {
+    const int8_t *row_tmp = &input_data[row_offsets[row_index]];
+    const int8_t *row_vld_tmp = &row_tmp[validity_offset];
+
+    for (cudf::size_type col_index = 0; col_index < num_columns; col_index++) {
+      const int8_t *col_tmp = &(row_tmp[input_offset_in_row[col_index]]);
+      int predicate = row_vld_tmp[col_index / 8] & (1 << (col_index % 8));
+      if (predicate) {
+        atomicOr_block(&output_nm[col_index][word_index(row_index)],
+                       cudf::bitmask_type{1} << intra_word_index(row_index));
+      }
+      if (is_string[col_index]) {
+        if (predicate) {
+          int32_t var_offset = reinterpret_cast<const int32_t *>(col_tmp)[0];
+          int32_t length = reinterpret_cast<const int32_t *>(col_tmp)[1];
+          const int8_t *str_input = &row_tmp[var_offset];
+          int8_t *str_output = output_data[col_index] + output_str_offsets[col_index][row_index];
+          for (int32_t b = 0; b < length; b++) {
+            str_output[b] = str_input[b];
+          }
+        }
+      } else {
+        cudf::size_type col_size = num_bytes[col_index];
+        int8_t *col_output = output_data[col_index] + (row_index * col_size);
+        switch (col_size) {
+          case 1: {
+            *col_output = *col_tmp;
+            break;
+          }
+          case 2: {
+            *reinterpret_cast<int16_t *>(col_output) = *reinterpret_cast<const int16_t *>(col_tmp);
+            break;
+          }
+          case 4: {
+            *reinterpret_cast<int32_t *>(col_output) = *reinterpret_cast<const int32_t *>(col_tmp);
+            break;
+          }
+          case 8: {
+            *reinterpret_cast<int64_t *>(col_output) = *reinterpret_cast<const int64_t *>(col_tmp);
+            break;
+          }
+          default: {
+            for (cudf::size_type b = 0; b < col_size; b++) {
+              col_output[b] = col_tmp[b];
+            }
+            break;
+          }
+        }
+      }
+    } // end column loop
+  }
+}
+
 /**
  * Calculate the dimensions of the kernel for fixed width only columns.
  * @param [in] num_columns the number of columns being copied.
@@ -415,7 +577,7 @@ static bool is_fixed_width(const cudf::data_type &t) {
   return cudf::is_fixed_width(t);
 }
 
-static inline int32_t align_offset(int32_t offset, std::size_t alignment) {
+static inline __host__ __device__ int32_t align_offset(int32_t offset, std::size_t alignment) {
   return (offset + alignment - 1) & ~(alignment - 1);
 }
 
@@ -423,12 +585,70 @@ static inline bool are_all_fixed_width(std::vector<cudf::data_type> const &schem
   return std::all_of(schema.begin(), schema.end(), cudf::java::is_fixed_width);
 }
 
+static bool is_fixed_width_or_string(const cudf::data_type &t) {
+  return cudf::is_fixed_width(t) || t.id() == cudf::type_id::STRING;
+}
+
+static inline bool are_all_fixed_width_or_string(std::vector<cudf::data_type> const &schema) {
+  return std::all_of(schema.begin(), schema.end(), cudf::java::is_fixed_width_or_string);
+}
+
 /**
- * Given a set of fixed width columns, calculate how the data will be laid out in memory.
+ * Computes the number of bytes a single variable width row needs. This covers
+ * the fixed width section, the validity bytes, and the character data of any
+ * string columns, padded so every row stays 64-bit aligned. Returns 0 for the
+ * entry just past the last row so it can also feed an exclusive scan that
+ * produces the row offsets.
+ */
+struct var_row_size_functor {
+  cudf::table_device_view d_table;
+  cudf::size_type fixed_width_size;
+  cudf::size_type num_rows;
+
+  __device__ int32_t operator()(cudf::size_type row_index) const {
+    if (row_index >= num_rows) {
+      return 0;
+    }
+    int32_t size = fixed_width_size;
+    for (cudf::size_type col_index = 0; col_index < d_table.num_columns(); col_index++) {
+      cudf::column_device_view col = d_table.column(col_index);
+      if (col.type().id() == cudf::type_id::STRING && col.is_valid(row_index)) {
+        size += col.element<cudf::string_view>(row_index).size_bytes();
+      }
+    }
+    return align_offset(size, 8);
+  }
+};
+
+/**
+ * Reads the length of one string column entry out of the fixed width section
+ * of a packed row. Null entries are written with a zero length so no validity
+ * check is needed. Returns 0 for the entry just past the last row so it can
+ * feed an exclusive scan that produces the string offsets.
+ */
+struct var_string_length_functor {
+  const int8_t *d_input_data;
+  const int32_t *d_row_offsets;
+  cudf::size_type column_offset;
+  cudf::size_type num_rows;
+
+  __device__ int32_t operator()(cudf::size_type row_index) const {
+    if (row_index >= num_rows) {
+      return 0;
+    }
+    // the length is the second 32-bit value of the (offset, length) pair
+    return *reinterpret_cast<const int32_t *>(d_input_data + d_row_offsets[row_index] +
+                                              column_offset + sizeof(int32_t));
+  }
+};
+
+/**
+ * Given a set of fixed width or string columns, calculate how the fixed width
+ * part of the data will be laid out in memory.
  * @param [in] schema the types of columns that need to be laid out.
  * @param [out] column_start the byte offset where each column starts in the row.
  * @param [out] column_size the size in bytes of the data for each columns in the row.
- * @return the size in bytes each row needs.
+ * @return the size in bytes each row needs, not counting any variable width data.
  */
 static inline int32_t compute_fixed_width_layout(std::vector<cudf::data_type> const &schema,
                                                  std::vector<cudf::size_type> &column_start,
@@ -437,7 +657,10 @@ static inline int32_t compute_fixed_width_layout(std::vector<cudf::data_type> co
   // there, but to make the code simple we will still do an alignment for it.
   int32_t at_offset = 0;
   for (auto col = schema.begin(); col < schema.end(); col++) {
-    cudf::size_type s = cudf::size_of(*col);
+    // Strings are stored as a 32-bit offset into the row plus a 32-bit length,
+    // with the character data packed after the validity bytes.
+    cudf::size_type s =
+        col->id() == cudf::type_id::STRING ? 2 * sizeof(int32_t) : cudf::size_of(*col);
     column_size.emplace_back(s);
     std::size_t allocation_needed = s;
     std::size_t alignment_needed = allocation_needed; // They are the same for fixed width types
@@ -456,6 +679,67 @@ static inline int32_t compute_fixed_width_layout(std::vector<cudf::data_type> co
   return align_offset(at_offset, 8); // 8 bytes (64 bits)
 }
 
+/**
+ * Convert a table that can contain string columns into a single column of rows.
+ * Rows vary in size so, unlike the fixed width path, the offsets cannot be
+ * computed with a sequence and the output cannot be split into batches. The
+ * 32-bit offsets limit the total output to 2 GB, which is verified up front.
+ */
+static std::unique_ptr<cudf::column>
+variable_width_convert_to_rows(cudf::table_view const &tbl,
+                               std::vector<cudf::data_type> const &schema,
+                               rmm::cuda_stream_view stream, rmm::mr::device_memory_resource *mr) {
+  const cudf::size_type num_columns = tbl.num_columns();
+  const cudf::size_type num_rows = tbl.num_rows();
+
+  std::vector<cudf::size_type> column_start;
+  std::vector<cudf::size_type> column_size;
+
+  int32_t fixed_width_size = compute_fixed_width_layout(schema, column_start, column_size);
+  auto dev_column_start = copy_to_dev_async(column_start, stream, mr);
+  auto dev_column_size = copy_to_dev_async(column_size, stream, mr);
+
+  auto device_input = cudf::table_device_view::create(tbl, stream);
+  var_row_size_functor row_size{*device_input, fixed_width_size, num_rows};
+
+  int64_t total_allocation = thrust::transform_reduce(
+      rmm::exec_policy(stream), thrust::make_counting_iterator<cudf::size_type>(0),
+      thrust::make_counting_iterator<cudf::size_type>(num_rows), row_size, int64_t{0},
+      thrust::plus<int64_t>());
+  CUDF_EXPECTS(total_allocation < std::numeric_limits<int>::max(), "Table is too large to fit!");
+
+  // Build the offsets for the byte array directly in the output column
+  std::unique_ptr<cudf::column> offsets =
+      cudf::make_numeric_column(cudf::data_type(cudf::type_id::INT32), num_rows + 1,
+                                cudf::mask_state::UNALLOCATED, stream, mr);
+  int32_t *d_offsets = offsets->mutable_view().data<int32_t>();
+  thrust::transform_exclusive_scan(rmm::exec_policy(stream),
+                                   thrust::make_counting_iterator<cudf::size_type>(0),
+                                   thrust::make_counting_iterator<cudf::size_type>(num_rows + 1),
+                                   d_offsets, row_size, 0, thrust::plus<int32_t>());
+
+  std::unique_ptr<cudf::column> data = cudf::make_numeric_column(
+      cudf::data_type(cudf::type_id::INT8), static_cast<cudf::size_type>(total_allocation),
+      cudf::mask_state::UNALLOCATED, stream, mr);
+
+  // One thread copies an entire row so only the x dimension is needed
+  int block_size = 256;
+  int num_blocks = (num_rows + block_size - 1) / block_size;
+  if (num_blocks < 1) {
+    num_blocks = 1;
+  } else if (num_blocks > 10240) {
+    // Keep the same grid limit as the fixed width kernels
+    num_blocks = 10240;
+  }
+
+  copy_from_columns_to_var_rows<<<num_blocks, block_size, 0, stream.value()>>>(
+      num_rows, num_columns, dev_column_start->data(), dev_column_size->data(), fixed_width_size,
+      *device_input, d_offsets, data->mutable_view().data<int8_t>());
+
+  return cudf::make_lists_column(num_rows, std::move(offsets), std::move(data), 0,
+                                 rmm::device_buffer{}, stream, mr);
+}
+
 std::vector<std::unique_ptr<cudf::column>> convert_to_rows(cudf::table_view const &tbl,
                                                            rmm::cuda_stream_view stream,
                                                            rmm::mr::device_memory_resource *mr) {
@@ -511,9 +795,13 @@ std::vector<std::unique_ptr<cudf::column>> convert_to_rows(cudf::table_view cons
           dev_input_data, dev_input_nm, *zero, *step, stream, mr));
     }
 
+    return ret;
+  } else if (are_all_fixed_width_or_string(schema)) {
+    std::vector<std::unique_ptr<cudf::column>> ret;
+    ret.emplace_back(variable_width_convert_to_rows(tbl, schema, stream, mr));
     return ret;
   } else {
-    CUDF_FAIL("Only fixed width types are currently supported");
+    CUDF_FAIL("Only fixed width and string types are currently supported");
   }
 }
 
@@ -569,9 +857,99 @@ std::unique_ptr<cudf::table> convert_from_rows(cudf::lists_column_view const &in
         num_rows, num_columns, size_per_row, dev_column_start->data(), dev_column_size->data(),
         dev_output_data->data(), dev_output_nm->data(), child.data<int8_t>());
 
+    return std::make_unique<cudf::table>(std::move(output_columns));
+  } else if (are_all_fixed_width_or_string(schema)) {
+    std::vector<cudf::size_type> column_start;
+    std::vector<cudf::size_type> column_size;
+
+    cudf::size_type num_rows = input.parent().size();
+    compute_fixed_width_layout(schema, column_start, column_size);
+    auto dev_column_start = copy_to_dev_async(column_start, stream, mr);
+    auto dev_column_size = copy_to_dev_async(column_size, stream, mr);
+
+    const int32_t *d_row_offsets = input.offsets().data<int32_t>();
+    const int8_t *d_input_data = child.data<int8_t>();
+
+    // Allocate the columns we are going to write into. The string columns
+    // cannot be assembled until after the copy, so their pieces are kept
+    // separately. All of the validity starts out as all null and the kernel
+    // ors in the valid bits, so the null counts are computed lazily at the end.
+    std::vector<std::unique_ptr<cudf::column>> output_columns(num_columns);
+    std::vector<std::unique_ptr<cudf::column>> string_offsets(num_columns);
+    std::vector<std::unique_ptr<cudf::column>> string_chars(num_columns);
+    std::vector<rmm::device_buffer> string_nm(num_columns);
+    std::vector<int8_t> is_string(num_columns, 0);
+    std::vector<int8_t *> output_data(num_columns);
+    std::vector<int32_t *> output_str_offsets(num_columns, nullptr);
+    std::vector<cudf::bitmask_type *> output_nm(num_columns);
+    for (cudf::size_type i = 0; i < num_columns; i++) {
+      if (schema[i].id() == cudf::type_id::STRING) {
+        is_string[i] = 1;
+        // Build the string offsets from the lengths stored in the rows
+        auto offsets_column =
+            cudf::make_numeric_column(cudf::data_type(cudf::type_id::INT32), num_rows + 1,
+                                      cudf::mask_state::UNALLOCATED, stream, mr);
+        int32_t *d_offsets = offsets_column->mutable_view().data<int32_t>();
+        thrust::transform_exclusive_scan(
+            rmm::exec_policy(stream), thrust::make_counting_iterator<cudf::size_type>(0),
+            thrust::make_counting_iterator<cudf::size_type>(num_rows + 1), d_offsets,
+            var_string_length_functor{d_input_data, d_row_offsets, column_start[i], num_rows}, 0,
+            thrust::plus<int32_t>());
+        auto total_chars =
+            cudf::detail::get_value<int32_t>(offsets_column->view(), num_rows, stream);
+        auto chars_column =
+            cudf::make_numeric_column(cudf::data_type(cudf::type_id::INT8), total_chars,
+                                      cudf::mask_state::UNALLOCATED, stream, mr);
+        string_nm[i] = cudf::detail::create_null_mask(num_rows, cudf::mask_state::ALL_NULL, stream, mr);
+        output_data[i] = chars_column->mutable_view().data<int8_t>();
+        output_str_offsets[i] = d_offsets;
+        output_nm[i] = reinterpret_cast<cudf::bitmask_type *>(string_nm[i].data());
+        string_offsets[i] = std::move(offsets_column);
+        string_chars[i] = std::move(chars_column);
+      } else {
+        auto column =
+            cudf::make_fixed_width_column(schema[i], num_rows, cudf::mask_state::ALL_NULL, stream, mr);
+        auto mut = column->mutable_view();
+        output_data[i] = mut.data<int8_t>();
+        output_nm[i] = mut.null_mask();
+        output_columns[i] = std::move(column);
+      }
+    }
+
+    auto dev_is_string = copy_to_dev_async(is_string, stream, mr);
+    auto dev_output_data = copy_to_dev_async(output_data, stream, mr);
+    auto dev_output_str_offsets = copy_to_dev_async(output_str_offsets, stream, mr);
+    auto dev_output_nm = copy_to_dev_async(output_nm, stream, mr);
+
+    // One thread copies an entire row so only the x dimension is needed
+    int block_size = 256;
+    int num_blocks = (num_rows + block_size - 1) / block_size;
+    if (num_blocks < 1) {
+      num_blocks = 1;
+    } else if (num_blocks > 10240) {
+      // Keep the same grid limit as the fixed width kernels
+      num_blocks = 10240;
+    }
+
+    copy_from_var_rows_to_columns<<<num_blocks, block_size, 0, stream.value()>>>(
+        num_rows, num_columns, dev_column_start->data(), dev_column_size->data(),
+        dev_is_string->data(), dev_output_data->data(), dev_output_str_offsets->data(),
+        dev_output_nm->data(), d_row_offsets, d_input_data);
+
+    for (cudf::size_type i = 0; i < num_columns; i++) {
+      if (is_string[i]) {
+        output_columns[i] =
+            cudf::make_strings_column(num_rows, std::move(string_offsets[i]),
+                                      std::move(string_chars[i]), cudf::UNKNOWN_NULL_COUNT,
+                                      std::move(string_nm[i]));
+      } else {
+        output_columns[i]->set_null_count(cudf::UNKNOWN_NULL_COUNT);
+      }
+    }
+
     return std::make_unique<cudf::table>(std::move(output_columns));
   } else {
-    CUDF_FAIL("Only fixed width types are currently supported");
+    CUDF_FAIL("Only fixed width and string types are currently supported");
   }
 }
 
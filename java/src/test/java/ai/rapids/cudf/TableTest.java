@@ -7030,6 +7030,37 @@ public class TableTest extends CudfTestBase {
     }
   }
 
+  @Test
+  void variableWidthRowsRoundTrip() {
+    try (Table t = new TestBuilder()
+        .column(3l, 9l, 4l, 2l, 20l, null)
+        .column("a", "bc", null, "", "longer string", null)
+        .column(5, 1, 0, 2, 7, null)
+        .column(true, false, false, true, false, null)
+        .column(null, "d", "efg", null, "hi", "jklmno")
+        .build()) {
+      ColumnVector[] rows = t.convertToRows();
+      try {
+        // Variable width data always fits in a single column
+        assert rows.length == 1;
+        ColumnVector cv = rows[0];
+        assert cv.getRowCount() == t.getRowCount();
+
+        DType[] types = new DType[t.getNumberOfColumns()];
+        for (int i = 0; i < t.getNumberOfColumns(); i++) {
+          types[i] = t.getColumn(i).getType();
+        }
+        try (Table backAgain = Table.convertFromRows(cv, types)) {
+          assertTablesAreEqual(t, backAgain);
+        }
+      } finally {
+        for (ColumnVector cv : rows) {
+          cv.close();
+        }
+      }
+    }
+  }
+
   // utility methods to reduce typing
 
   private StructData struct(Object... values) {